@@ -64,7 +64,9 @@ echo
 echo "── Suite 1: Ring 0 Generator Compilation ─────────────────────────────────────"
 
 log_test "schemagen.c compiles"
-if cc -O2 -Wall -Werror -std=c11 -o "$TEST_DIR/schemagen" tools/schemagen.c 2>/dev/null; then
+SCHEMAGEN_FRONT="build/front/schemagen_lexer.c build/front/schemagen_parser.c"
+if make -s $SCHEMAGEN_FRONT >/dev/null 2>&1 && \
+   cc -O2 -Wall -Werror -std=c11 -Itools -Ibuild/front -o "$TEST_DIR/schemagen" tools/schemagen.c $SCHEMAGEN_FRONT 2>/dev/null; then
     log_pass
 else
     log_fail "compilation error"
@@ -77,6 +79,13 @@ else
     log_fail "compilation error"
 fi
 
+log_test "lexgen.c compiles"
+if cc -O2 -Wall -Werror -std=c11 -Itools/lexgen -o "$TEST_DIR/lexgen" tools/lexgen/lexgen.c 2>/dev/null; then
+    log_pass
+else
+    log_fail "compilation error"
+fi
+
 log_test "schemagen --help works"
 if "$TEST_DIR/schemagen" --help 2>&1 | grep -q "schemagen"; then
     log_pass
@@ -147,6 +156,612 @@ else
     log_fail "generator failed"
 fi
 
+log_test "schemagen --columnar produces _columnar.h and _columnar.c"
+if "$TEST_DIR/schemagen" --columnar specs/domain/livereload.schema "$TEST_DIR/gen" livereload 2>/dev/null; then
+    if [ -f "$TEST_DIR/gen/livereload_columnar.c" ] && [ -f "$TEST_DIR/gen/livereload_columnar.h" ]; then
+        log_pass
+    else
+        log_fail "missing _columnar files"
+    fi
+else
+    log_fail "generator failed"
+fi
+
+log_test "columnar codec round-trips nested structs and fixed arrays"
+cat > "$TEST_DIR/colrt.schema" <<'SCHEMA'
+type Vec {
+    x: i32
+    y: f64
+}
+
+type Row {
+    id:    u32
+    at:    Vec
+    hops:  i32[4]
+    flags: bool[2]
+    score: f32
+    name:  string[16]
+}
+SCHEMA
+cat > "$TEST_DIR/colrt_main.c" <<'SRC'
+#include "colrt_columnar.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define N 2500
+int main(void) {
+    static Row in[N], back[N];
+    for (int i = 0; i < N; i++) {
+        Row_init(&in[i]);
+        in[i].id = (uint32_t)i;
+        in[i].at.x = -i;
+        in[i].at.y = i * 0.5;
+        for (int k = 0; k < 4; k++) in[i].hops[k] = i * 4 + k;
+        in[i].flags[i % 2] = true;
+        in[i].score = (float)i / 3;
+        snprintf(in[i].name, sizeof(in[i].name), "row%d", i);
+    }
+    size_t cap = Row_col_bound(N);
+    uint8_t *buf = malloc(cap);
+    size_t len = buf ? Row_col_encode(in, N, buf, cap) : 0;
+    if (len == 0 || Row_col_decode(buf, len, back, N) != N) return 1;
+    for (int i = 0; i < N; i++) {
+        if (back[i].id != in[i].id || back[i].at.x != in[i].at.x || back[i].at.y != in[i].at.y ||
+            memcmp(back[i].hops, in[i].hops, sizeof(in[i].hops)) != 0 ||
+            memcmp(back[i].flags, in[i].flags, sizeof(in[i].flags)) != 0 ||
+            back[i].score != in[i].score || strcmp(back[i].name, in[i].name) != 0)
+            return 1;
+    }
+    free(buf);
+    return 0;
+}
+SRC
+printf 'type Link {\n    next: Link*\n}\n' > "$TEST_DIR/colptr.schema"
+if "$TEST_DIR/schemagen" --c specs/domain/livereload.schema "$TEST_DIR/gen" livereload 2>/dev/null && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/gen/livereload_columnar.c" -o "$TEST_DIR/livereload_columnar.o" 2>/dev/null && \
+   "$TEST_DIR/schemagen" --c --columnar "$TEST_DIR/colrt.schema" "$TEST_DIR/gen" colrt 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/colrt_main.c" "$TEST_DIR/gen/colrt_types.c" \
+      "$TEST_DIR/gen/colrt_columnar.c" -o "$TEST_DIR/colrt_main" 2>/dev/null && \
+   "$TEST_DIR/colrt_main" && \
+   ! "$TEST_DIR/schemagen" --columnar "$TEST_DIR/colptr.schema" "$TEST_DIR/gen" colptr 2>/dev/null; then
+    log_pass
+else
+    log_fail "columnar rows lost fields or a pointer type was accepted"
+fi
+
+log_test "columnar scans push predicates down and skip blocks by zone map"
+printf 'type Event {\n    ts:   u64\n    temp: i16\n    load: f32\n}\n' > "$TEST_DIR/colscan.schema"
+cat > "$TEST_DIR/colscan_main.c" <<'SRC'
+#include "colscan_columnar.h"
+#include <stdlib.h>
+/* 10 blocks of 1024 rows; ts rises by 10 per row, temp is -50 in block 0
+ * and 10 higher in each later block */
+#define N (10 * colscan_COL_BLOCK_ROWS)
+static int count_row(const Event *row, void *ctx) {
+    (void)row;
+    ++*(long *)ctx;
+    return 0;
+}
+static int scan(const uint8_t *buf, size_t len, const colscan_col_pred_t *preds, size_t npreds,
+                long matched, size_t skipped) {
+    colscan_col_stats_t st;
+    long visited = 0;
+    long n = Event_col_scan(buf, len, preds, npreds, count_row, &visited, &st);
+    return n == matched && visited == matched && st.rows_matched == (size_t)matched &&
+           st.blocks_total == 10 && st.blocks_skipped == skipped;
+}
+int main(void) {
+    static Event rows[N];
+    for (int i = 0; i < N; i++) {
+        Event_init(&rows[i]);
+        rows[i].ts = 1000000 + (uint64_t)i * 10;
+        rows[i].temp = (int16_t)(i / colscan_COL_BLOCK_ROWS * 10 - 50);
+        rows[i].load = (float)i;
+    }
+    size_t cap = Event_col_bound(N);
+    uint8_t *buf = malloc(cap);
+    size_t len = buf ? Event_col_encode(rows, N, buf, cap) : 0;
+    if (len == 0) return 1;
+    /* rows 2000..3000 lie in blocks 1 and 2 */
+    colscan_col_pred_t ts = { Event_COL_ts, 1000000 + 2000 * 10, 1000000 + 3000 * 10 };
+    if (!scan(buf, len, &ts, 1, 1001, 8)) return 2;
+    /* a negative range: only block 1 (temp -40) */
+    colscan_col_pred_t temp = { Event_COL_temp, (uint64_t)(int64_t)-45, (uint64_t)(int64_t)-35 };
+    if (!scan(buf, len, &temp, 1, colscan_COL_BLOCK_ROWS, 9)) return 3;
+    /* both: rows 2000..2047 */
+    colscan_col_pred_t both[2] = { ts, temp };
+    if (!scan(buf, len, both, 2, 48, 9)) return 4;
+    /* a range straddling zero: blocks 4 (-10), 5 (0) and 6 (10) */
+    colscan_col_pred_t mid = { Event_COL_temp, (uint64_t)(int64_t)-10, 10 };
+    if (!scan(buf, len, &mid, 1, 3 * colscan_COL_BLOCK_ROWS, 7)) return 5;
+    free(buf);
+    return 0;
+}
+SRC
+if "$TEST_DIR/schemagen" --c --columnar "$TEST_DIR/colscan.schema" "$TEST_DIR/gen" colscan 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/colscan_main.c" "$TEST_DIR/gen/colscan_types.c" \
+      "$TEST_DIR/gen/colscan_columnar.c" -o "$TEST_DIR/colscan_main" 2>/dev/null && \
+   "$TEST_DIR/colscan_main"; then
+    log_pass
+else
+    log_fail "scan matched or skipped the wrong rows"
+fi
+
+log_test "generated delta codec compiles"
+printf 'type Pt {\n    x: f64\n    y: f32\n}\n' > "$TEST_DIR/pt.schema"
+if "$TEST_DIR/schemagen" --diff specs/domain/livereload.schema "$TEST_DIR/gen" livereload 2>/dev/null && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/gen/livereload_diff.c" -o "$TEST_DIR/livereload_diff.o" 2>/dev/null && \
+   "$TEST_DIR/schemagen" --c --diff "$TEST_DIR/pt.schema" "$TEST_DIR/gen" pt 2>/dev/null && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/gen/pt_diff.c" -o "$TEST_DIR/pt_diff.o" 2>/dev/null; then
+    log_pass
+else
+    log_fail "generated code has errors"
+fi
+
+log_test "delta round-trips nested structs and fixed arrays through JSON and binary"
+cat > "$TEST_DIR/dlt.schema" <<'SCHEMA'
+type Vec {
+    x: i32
+    y: f64
+}
+
+type Row {
+    id:    u32
+    at:    Vec
+    path:  Vec[2]
+    hops:  i32[4]
+    flags: bool[2]
+    score: f32
+    name:  string[16]
+    trim:  i16
+}
+SCHEMA
+cat > "$TEST_DIR/dlt_main.c" <<'SRC'
+#include "dlt_diff.h"
+#include <string.h>
+int main(void) {
+    Row old, cur, patched;
+    Row_delta_t delta, back;
+    char json[1024];
+    uint8_t bin[256];
+    int n;
+    Row_init(&old);
+    old.id = 1;
+    old.hops[2] = 7;
+    strcpy(old.name, "old");
+    cur = old;
+    cur.at.x = -3;
+    cur.at.y = 2.5;
+    cur.path[1].x = 9;
+    cur.hops[0] = 11;
+    cur.hops[3] = -4;
+    cur.flags[1] = true;
+    strcpy(cur.name, "cur");
+    cur.trim = -300;
+    if (Row_diff(&old, &cur, &delta) != 6) return 1;
+    if (Row_delta_to_json(&delta, json, sizeof(json)) <= 0) return 1;
+    if (Row_delta_from_json(json, &back) != 0) return 1;
+    if (memcmp(back.changed, delta.changed, sizeof(delta.changed)) != 0) return 1;
+    patched = old;
+    Row_apply_patch(&patched, &back);
+    if (memcmp(&patched, &cur, sizeof(cur)) != 0) return 1;
+
+    /* binary: full round trip */
+    n = Row_delta_encode(&delta, bin, sizeof(bin));
+    if (n <= 0) return 2;
+    memset(&back, 0, sizeof(back));
+    if (Row_delta_decode(bin, (size_t)n, &back) != n) return 2;
+    if (memcmp(back.changed, delta.changed, sizeof(delta.changed)) != 0) return 2;
+    patched = old;
+    Row_apply_patch(&patched, &back);
+    if (memcmp(&patched, &cur, sizeof(cur)) != 0) return 2;
+    /* every short buffer is refused without writing past its end */
+    for (int size = 0; size < n; size++) {
+        uint8_t small[256];
+        memset(small, 0xA5, sizeof(small));
+        if (Row_delta_encode(&delta, small, (size_t)size) != -1) return 3;
+        for (int k = size; k < (int)sizeof(small); k++)
+            if (small[k] != 0xA5) return 3;
+    }
+    /* every truncation of the encoding is rejected */
+    for (int len = 0; len < n; len++) {
+        if (Row_delta_decode(bin, (size_t)len, &back) != -1) return 4;
+    }
+    return 0;
+}
+SRC
+printf 'type Hop {\n    x: i32\n}\n\ntype Route {\n    hops: Hop[]\n}\n\ntype VecRow {\n    route: Route\n}\n' > "$TEST_DIR/vecrow.schema"
+if "$TEST_DIR/schemagen" --c --diff "$TEST_DIR/dlt.schema" "$TEST_DIR/gen" dlt 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/dlt_main.c" "$TEST_DIR/gen/dlt_types.c" \
+      "$TEST_DIR/gen/dlt_diff.c" vendors/libs/yyjson.c -o "$TEST_DIR/dlt_main" 2>/dev/null && \
+   "$TEST_DIR/dlt_main" && \
+   ! "$TEST_DIR/schemagen" --diff "$TEST_DIR/vecrow.schema" "$TEST_DIR/gen" vecrow 2>/dev/null; then
+    log_pass
+else
+    log_fail "JSON or binary delta dropped changes, overran a buffer, or a T[] type was accepted"
+fi
+
+log_test "lock-free rings deliver every item once, in order, across threads"
+if "$TEST_DIR/schemagen" --c --ring specs/domain/e9livereload.schema "$TEST_DIR/gen" e9livereload 2>/dev/null && \
+   grep -q "E9LiveReloadEvent_mpmc_ring_push_batch" "$TEST_DIR/gen/e9livereload_ring.h" && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/gen/e9livereload_ring.c" -o "$TEST_DIR/e9livereload_ring.o" 2>/dev/null && \
+   SCHEMAGEN="$TEST_DIR/schemagen" ./scripts/ring-stress.sh 50000 >/dev/null 2>&1; then
+    log_pass
+else
+    log_fail "ring lost, duplicated or reordered items (scripts/ring-stress.sh)"
+fi
+
+log_test "seqlock shm snapshots publish consistently across processes"
+cat > "$TEST_DIR/shmrt.schema" <<'SCHEMA'
+type Snap {
+    seq:  u64
+    vals: u64[64]
+    name: string[24]
+}
+SCHEMA
+cat > "$TEST_DIR/shmrt_main.c" <<'SRC'
+#define _POSIX_C_SOURCE 200809L
+#include "shmrt_shm.h"
+#include <fcntl.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define N 20000
+static void fill(Snap *s, uint64_t seq) {
+    s->seq = seq;
+    for (int k = 0; k < 64; k++) s->vals[k] = seq * 64 + (uint64_t)k;
+    snprintf(s->name, sizeof(s->name), "v%llu", (unsigned long long)seq);
+}
+static int consistent(const Snap *s) {
+    Snap want;
+    memset(&want, 0, sizeof(want));
+    fill(&want, s->seq);
+    return memcmp(s->vals, want.vals, sizeof(want.vals)) == 0 && strcmp(s->name, want.name) == 0;
+}
+int main(int argc, char **argv) {
+    const char *name = argc > 1 ? argv[1] : "/bde-shmrt";
+    Snap v;
+    int status;
+    memset(&v, 0, sizeof(v));
+    shm_unlink(name);
+    /* not yet truncated by the publisher, then a smaller foreign object */
+    for (off_t size = 0; size <= 16; size += 16) {
+        int fd = shm_open(name, O_RDWR | O_CREAT, 0644);
+        if (fd < 0 || ftruncate(fd, size) != 0) return 8;
+        close(fd);
+        if (Snap_shm_open(name, false) != NULL) return 9;
+    }
+    shm_unlink(name);
+    Snap_shm_t *w = Snap_shm_open(name, true);
+    Snap_shm_t *r = Snap_shm_open(name, false);
+    if (!w || !r) return 1;
+    /* a publisher that died mid-write: readers retry, then give up */
+    atomic_store(&w->seq, 1);
+    if (Snap_shm_read(r, &v) != -1) return 2;
+    atomic_store(&w->seq, 0);
+    fill(&v, 0);
+    Snap_shm_publish(w, &v);
+    pid_t pid = fork();
+    if (pid == 0) {
+        Snap_shm_t *c = Snap_shm_open(name, false);
+        uint64_t last = 0;
+        int gave_up = 0;
+        if (!c) _exit(3);
+        while (last < N) {
+            /* -1: the publisher was preempted mid-write; let it finish */
+            if (Snap_shm_read(c, &v) != 0) {
+                if (++gave_up > 1000) _exit(4);
+                sched_yield();
+                continue;
+            }
+            if (!consistent(&v) || v.seq < last) _exit(5);
+            last = v.seq;
+        }
+        _exit(0);
+    }
+    for (uint64_t i = 1; i <= N; i++) {
+        fill(&v, i);
+        Snap_shm_publish(w, &v);
+    }
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) return 6;
+    memset(&v, 0, sizeof(v));
+    if (Snap_shm_read(r, &v) != 0 || v.seq != N || !consistent(&v) || Snap_shm_version(r) != N + 1) return 7;
+    Snap_shm_close(r);
+    Snap_shm_close(w);
+    shm_unlink(name);
+    return 0;
+}
+SRC
+if "$TEST_DIR/schemagen" --c --shm specs/domain/livereload.schema "$TEST_DIR/gen" livereload 2>/dev/null && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/gen/livereload_shm.c" -o "$TEST_DIR/livereload_shm.o" 2>/dev/null && \
+   "$TEST_DIR/schemagen" --c --shm "$TEST_DIR/shmrt.schema" "$TEST_DIR/gen" shmrt 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/shmrt_main.c" \
+      "$TEST_DIR/gen/shmrt_types.c" "$TEST_DIR/gen/shmrt_shm.c" -o "$TEST_DIR/shmrt_main" 2>/dev/null && \
+   "$TEST_DIR/shmrt_main" "/bde-meta-shm-$$" && \
+   ! "$TEST_DIR/schemagen" --shm "$TEST_DIR/colptr.schema" "$TEST_DIR/gen" colptr 2>/dev/null; then
+    log_pass
+else
+    log_fail "torn or stale snapshot read, short segment mapped, or a pointer type was accepted"
+fi
+
+log_test "table-driven codec ([codec: table]) matches the unrolled codec"
+cat > "$TEST_DIR/reflect.schema" <<'SCHEMA'
+type Point {
+    x: i32 [range: -1000..1000]
+    y: i32
+}
+
+type Sample [codec: table] {
+    name:  string[32] [not_empty]
+    at:    Point
+    ok:    bool
+    id:    u64
+    delta: i16
+    ratio: f64
+    hist:  u8[4]
+    path:  Point[2]
+}
+
+type Unrolled {
+    name:  string[32] [not_empty]
+    at:    Point
+    ok:    bool
+    id:    u64
+    delta: i16
+    ratio: f64
+    hist:  u8[4]
+    path:  Point[2]
+}
+SCHEMA
+cat > "$TEST_DIR/reflect_main.c" <<'SRC'
+#include "reflect_json.h"
+#include <string.h>
+_Static_assert(sizeof(Sample) == sizeof(Unrolled), "same layout");
+int main(void) {
+    Sample s, s_back;
+    Unrolled u, u_back;
+    char js[1024], ju[1024];
+    Sample_init(&s);
+    strcpy(s.name, "probe \"7\"");
+    s.at.x = -12;
+    s.at.y = 40;
+    s.ok = true;
+    s.id = 18000000000000000000ULL;
+    s.delta = -300;
+    s.ratio = 0.125;
+    for (int i = 0; i < 4; i++) s.hist[i] = (uint8_t)(250 + i);
+    s.path[0].x = 1;
+    s.path[1].y = -2;
+    Unrolled_init(&u);
+    memcpy(&u, &s, sizeof(u));
+    if (Sample_to_json(&s, js, sizeof(js)) <= 0 || Unrolled_to_json(&u, ju, sizeof(ju)) <= 0) return 1;
+    if (strcmp(js, ju) != 0) return 2;
+    /* each decoder reads the other's output back to the same object */
+    Sample_init(&s_back);
+    Unrolled_init(&u_back);
+    if (Sample_from_json(ju, &s_back) != 0 || Unrolled_from_json(js, &u_back) != 0) return 3;
+    if (memcmp(&s_back, &s, sizeof(s)) != 0 || memcmp(&u_back, &u, sizeof(u)) != 0) return 4;
+    return 0;
+}
+SRC
+cat > "$TEST_DIR/reflect_sql_main.c" <<'SRC'
+#include "reflect_sql.h"
+#include <string.h>
+/* Both modes keep rows by the id column: id 42 goes in second */
+int main(void) {
+    sqlite3 *db;
+    Sample s, s_back;
+    Unrolled u, u_back;
+    if (sqlite3_open(":memory:", &db) != SQLITE_OK) return 1;
+    if (Sample_create_table(db) != 0 || Unrolled_create_table(db) != 0) return 2;
+    for (int k = 0; k < 2; k++) {
+        Sample_init(&s);
+        strcpy(s.name, k ? "forty-two" : "first");
+        s.at.x = -12;
+        s.ok = true;
+        s.id = k ? 42 : 1;
+        s.delta = -300;
+        s.ratio = 0.125;
+        s.hist[3] = 250;
+        s.path[1].y = -2;
+        Unrolled_init(&u);
+        memcpy(&u, &s, sizeof(u));
+        if (Sample_insert(db, &s) != 0 || Unrolled_insert(db, &u) != 0) return 3;
+    }
+    Sample_init(&s_back);
+    Unrolled_init(&u_back);
+    if (Sample_select_by_id(db, 42, &s_back) != 0 || Unrolled_select_by_id(db, 42, &u_back) != 0) return 4;
+    if (memcmp(&s_back, &s, sizeof(s)) != 0 || memcmp(&u_back, &u, sizeof(u)) != 0) return 5;
+    if (Sample_select_by_id(db, 2, &s_back) == 0 || Unrolled_select_by_id(db, 2, &u_back) == 0) return 6;
+    sqlite3_close(db);
+    return 0;
+}
+SRC
+printf 'type Tagged [codec: table] {\n    tags: u32[]\n}\n' > "$TEST_DIR/tablevec.schema"
+if "$TEST_DIR/schemagen" --c --json --sql "$TEST_DIR/reflect.schema" "$TEST_DIR/gen" reflect 2>/dev/null && \
+   grep -q "schema_json_write(&Sample_desc" "$TEST_DIR/gen/reflect_json.c" && \
+   ! grep -q "schema_json_write(&Unrolled_desc" "$TEST_DIR/gen/reflect_json.c" && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/reflect_main.c" \
+      "$TEST_DIR/gen/reflect_types.c" "$TEST_DIR/gen/reflect_reflect.c" "$TEST_DIR/gen/reflect_json.c" \
+      "$TEST_DIR/gen/schema_codec.c" "$TEST_DIR/gen/schema_codec_json.c" vendors/libs/yyjson.c \
+      -o "$TEST_DIR/reflect_main" 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/reflect_sql_main.c" \
+      "$TEST_DIR/gen/reflect_types.c" "$TEST_DIR/gen/reflect_reflect.c" "$TEST_DIR/gen/reflect_sql.c" \
+      "$TEST_DIR/gen/schema_codec.c" "$TEST_DIR/gen/schema_codec_sql.c" -lsqlite3 \
+      -o "$TEST_DIR/reflect_sql_main" 2>/dev/null && \
+   "$TEST_DIR/reflect_main" && \
+   "$TEST_DIR/reflect_sql_main" && \
+   ! "$TEST_DIR/schemagen" --json "$TEST_DIR/tablevec.schema" "$TEST_DIR/gen" tablevec 2>/dev/null; then
+    log_pass
+else
+    log_fail "table-coded JSON or SQL differs from the unrolled codec"
+fi
+
+log_test "schemagen handles >256 types and >64 fields per type"
+{
+    for i in $(seq 1 300); do
+        printf 'type GeneratedTypeWithAnUnusuallyLongMachineProducedName%03d {\n' "$i"
+        n=2; [ "$i" = 300 ] && n=100
+        for j in $(seq 1 "$n"); do printf '    f%d: u32\n' "$j"; done
+        printf '}\n'
+    done
+} > "$TEST_DIR/large.schema"
+if "$TEST_DIR/schemagen" --c "$TEST_DIR/large.schema" "$TEST_DIR/gen" large 2>/dev/null && \
+   grep -q "f100;" "$TEST_DIR/gen/large_types.h" && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/gen/large_types.c" -o "$TEST_DIR/large_types.o" 2>/dev/null; then
+    log_pass
+else
+    log_fail "large schema not generated"
+fi
+
+log_test "schemagen import resolves through the symbol index"
+mkdir -p "$TEST_DIR/imp"
+printf 'type Unit {\n    scale: i32\n}\n' > "$TEST_DIR/imp/units.schema"
+printf 'import "units.schema"\ntype Reading {\n    value: f64\n    unit: Unit\n}\n' > "$TEST_DIR/imp/reading.schema"
+if "$TEST_DIR/schemagen" --c --index "$TEST_DIR/schema.idx" "$TEST_DIR/imp/units.schema" "$TEST_DIR/gen" units 2>/dev/null && \
+   "$TEST_DIR/schemagen" --c --index "$TEST_DIR/schema.idx" "$TEST_DIR/imp/reading.schema" "$TEST_DIR/gen" reading 2>/dev/null && \
+   [ -s "$TEST_DIR/schema.idx" ] && grep -q '#include "units_types.h"' "$TEST_DIR/gen/reading_types.h" && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" "$TEST_DIR/gen/reading_types.c" -o "$TEST_DIR/reading_types.o" 2>/dev/null; then
+    log_pass
+else
+    log_fail "import not resolved"
+fi
+
+log_test "schemagen unmaps specs between in-process runs"
+cat > "$TEST_DIR/rerun_main.c" <<'SRC'
+#include <stdio.h>
+#include <string.h>
+int schemagen_main(int argc, char **argv);
+/* bde runs schemagen once per dirty spec in the same process */
+int main(int argc, char **argv) {
+    char *args[] = { "schemagen", "--c", "--index", argv[1], argv[2], argv[3], "reading", NULL };
+    char line[4096];
+    int mapped = 0;
+    (void)argc;
+    for (int i = 0; i < 50; i++)
+        if (schemagen_main(7, args) != 0) return 1;
+    FILE *maps = fopen("/proc/self/maps", "r");
+    if (!maps) return 2;
+    while (fgets(line, sizeof(line), maps))
+        if (strstr(line, ".schema")) mapped++;
+    fclose(maps);
+    /* only the last run's reading.schema and units.schema */
+    return mapped <= 2 ? 0 : 3;
+}
+SRC
+if cc -O2 -std=c11 -w -Ibuild/front -Dmain=schemagen_main -c tools/schemagen.c -o "$TEST_DIR/schemagen_lib.o" 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -Itools "$TEST_DIR/rerun_main.c" "$TEST_DIR/schemagen_lib.o" $SCHEMAGEN_FRONT -o "$TEST_DIR/rerun_main" 2>/dev/null && \
+   "$TEST_DIR/rerun_main" "$TEST_DIR/schema.idx" "$TEST_DIR/imp/reading.schema" "$TEST_DIR/gen" 2>/dev/null; then
+    log_pass
+else
+    log_fail "spec mappings leak across runs"
+fi
+
+log_test "schemagen appends to the symbol index and compacts superseded records"
+mkdir -p "$TEST_DIR/app"
+printf 'type Base {\n    id: u32\n}\n' > "$TEST_DIR/app/base.schema"
+printf 'import "base.schema"\ntype Mid {\n    b: Base\n}\n' > "$TEST_DIR/app/mid.schema"
+printf 'import "mid.schema"\ntype Top {\n    m: Mid\n    n: i32\n}\n' > "$TEST_DIR/app/top.schema"
+APP_IDX="$TEST_DIR/app/schema.idx"
+app_gen() {
+    "$TEST_DIR/schemagen" --c --index "$APP_IDX" "$TEST_DIR/app/$1.schema" "$TEST_DIR/app/gen" "$1" 2>/dev/null
+}
+app_edit_top() {
+    printf '\n' >> "$TEST_DIR/app/top.schema" && app_gen top
+}
+# base, mid, top: one segment each, top never rewrites them. A changed top
+# appends in place; the fifth edit finds 4 superseded records over 3 live
+# ones and compacts to base, mid, top before appending again.
+if app_gen base && app_gen mid && app_gen top && \
+   app_ino=$(stat -c %i "$APP_IDX") && app_size=$(stat -c %s "$APP_IDX") && \
+   app_gen top && [ "$(stat -c %s "$APP_IDX")" = "$app_size" ] && \
+   app_edit_top && [ "$(stat -c %i "$APP_IDX")" = "$app_ino" ] && \
+   app_seg=$(( $(stat -c %s "$APP_IDX") - app_size )) && [ "$app_seg" -gt 0 ] && \
+   app_edit_top && app_edit_top && app_edit_top && \
+   [ "$(stat -c %s "$APP_IDX")" = "$((app_size + 4 * app_seg))" ] && \
+   app_edit_top && [ "$(stat -c %i "$APP_IDX")" != "$app_ino" ] && \
+   [ "$(stat -c %s "$APP_IDX")" = "$((app_size + app_seg))" ] && \
+   grep -q '#include "mid_types.h"' "$TEST_DIR/app/gen/top_types.h" && \
+   cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/app/gen" "$TEST_DIR/app/gen/top_types.c" -o "$TEST_DIR/app/top_types.o" 2>/dev/null; then
+    log_pass
+else
+    log_fail "symbol index rewritten per spec or never compacted"
+fi
+
+log_test "schemagen nests structs and fixed arrays in JSON/SQL"
+cat > "$TEST_DIR/nested.schema" <<'SCHEMA'
+type Path {
+    start: Vec
+    pts:   Vec[2]
+    hops:  i32[4] [default: 1]
+}
+
+type Vec {
+    x: i32
+    y: f64
+}
+SCHEMA
+nested_ok=0
+if "$TEST_DIR/schemagen" --c --json --sql "$TEST_DIR/nested.schema" "$TEST_DIR/gen" nested 2>/dev/null && \
+   grep -q 'yyjson_mut_obj_add_obj(doc, root, "start")' "$TEST_DIR/gen/nested_json.c" && \
+   grep -q 'pts_1_y REAL' "$TEST_DIR/gen/nested_sql.c"; then
+    nested_ok=1
+    for f in nested_types.c nested_json.c nested_sql.c; do
+        cc -c -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/gen/$f" -o "$TEST_DIR/${f%.c}.o" 2>/dev/null || nested_ok=0
+    done
+fi
+if [ "$nested_ok" = 1 ]; then
+    log_pass
+else
+    log_fail "nested fields not generated"
+fi
+
+log_test "schemagen T[] vectors spill from inline storage to an arena"
+cat > "$TEST_DIR/vec.schema" <<'SCHEMA'
+type Run {
+    steps: Stage[] [inline: 2]
+    codes: i32[]
+}
+
+type Stage {
+    line: i32
+}
+SCHEMA
+cat > "$TEST_DIR/vec_main.c" <<'SRC'
+#include "vec_json.h"
+#include <string.h>
+int main(void) {
+    schema_arena_t arena = {0};
+    Run a, b;
+    char buf[512];
+    Run_init(&a);
+    for (int i = 0; i < 5; i++) {
+        Stage s = { i };
+        if (Run_steps_push(&a, &arena, &s) != 0) return 1;
+    }
+    if (!a.steps.heap || a.steps.len != 5 || Run_codes_push(&a, NULL, 7) != 0) return 1;
+    if (Run_to_json(&a, buf, sizeof(buf)) < 0) return 1;
+    Run_init(&b);
+    if (Run_from_json(buf, &b) == 0 || Run_from_json_arena(buf, &b, &arena) != 0) return 1;
+    int sum = 0;
+    Run_steps_foreach(&b, it) sum += it->line;
+    schema_arena_free(&arena);
+    return sum == 10 && b.codes.len == 1 ? 0 : 1;
+}
+SRC
+if "$TEST_DIR/schemagen" --c --json "$TEST_DIR/vec.schema" "$TEST_DIR/gen" vec 2>/dev/null && \
+   [ -f "$TEST_DIR/gen/schema_vec.h" ] && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/gen" -Ivendors/libs "$TEST_DIR/vec_main.c" \
+      "$TEST_DIR/gen/vec_types.c" "$TEST_DIR/gen/vec_json.c" vendors/libs/yyjson.c -o "$TEST_DIR/vec_main" 2>/dev/null && \
+   "$TEST_DIR/vec_main"; then
+    log_pass
+else
+    log_fail "vector codegen or round trip failed"
+fi
+
 log_test "schemagen --all produces all 8 files"
 rm -rf "$TEST_DIR/gen"
 mkdir -p "$TEST_DIR/gen"
@@ -184,6 +799,480 @@ else
     log_fail "invalid fbs syntax"
 fi
 
+log_test "lexgen DFA lexer handles keywords, patterns and skips"
+cat > "$TEST_DIR/lex_main.c" <<'SRC'
+#include "def_lexer.h"
+#include <string.h>
+int main(void) {
+    static const DEF_token_type_t want[] = {
+        DEF_ENUM, DEF_IDENT, DEF_COLON, DEF_U8, DEF_LBRACE, DEF_IDENT, DEF_EQUALS,
+        DEF_HEX_NUMBER, DEF_COMMA, DEF_IDENT, DEF_EQUALS, DEF_NUMBER, DEF_STRING_LIT,
+        DEF_DOTDOT, DEF_LSHIFT, DEF_RBRACE, DEF_TOKEN_EOF
+    };
+    DEF_lexer_t lex;
+    DEF_token_t t;
+    DEF_lexer_init(&lex, "enum enumx: u8 {\n  A_rather_long_identifier_spanning_vectors = 0x1F,"
+                         " u8x = -42 # a comment long enough to cross a 32-byte block\n \"a\\\"b\" .. << }");
+    for (size_t i = 0; i < sizeof(want) / sizeof(want[0]); i++) {
+        t = DEF_lexer_next(&lex);
+        if (t.type != want[i]) return 1;
+        if (i == 1 && (t.length != 5 || t.column != 6)) return 1;
+        if (i == 11 && (t.line != 2 || t.length != 3)) return 1;
+    }
+    return 0;
+}
+SRC
+if "$TEST_DIR/lexgen" specs/parsing/def.lex "$TEST_DIR/lex" DEF 2>/dev/null && \
+   ! grep -q "Replace with" "$TEST_DIR/lex/def_lexer.c" && \
+   cc -std=c11 -Wall -Wextra -Werror -I"$TEST_DIR/lex" "$TEST_DIR/lex_main.c" "$TEST_DIR/lex/def_lexer.c" \
+      -o "$TEST_DIR/lex_main" 2>/dev/null && \
+   "$TEST_DIR/lex_main"; then
+    log_pass
+else
+    log_fail "lexer generation or tokenization failed"
+fi
+
+log_test "lexgen --direct lexer matches the table lexer"
+if "$TEST_DIR/lexgen" --direct specs/parsing/def.lex "$TEST_DIR/lexd" DEF 2>/dev/null && \
+   ! grep -q "dfa_next" "$TEST_DIR/lexd/def_lexer.c" && \
+   cc -std=c11 -Wall -Wextra -Werror -I"$TEST_DIR/lexd" "$TEST_DIR/lex_main.c" "$TEST_DIR/lexd/def_lexer.c" \
+      -o "$TEST_DIR/lexd_main" 2>/dev/null && \
+   "$TEST_DIR/lexd_main"; then
+    log_pass
+else
+    log_fail "direct-coded lexer failed"
+fi
+
+log_test "lexgen moves keywords from the DFA to a perfect hash"
+if grep -q "kw_lookup" "$TEST_DIR/lexd/def_lexer.c" && \
+   grep -q "type = DEF_IDENT;" "$TEST_DIR/lexd/def_lexer.c" && \
+   ! grep -q "type = DEF_ENUM;" "$TEST_DIR/lexd/def_lexer.c"; then
+    log_pass
+else
+    log_fail "keywords still coded into the DFA"
+fi
+
+log_test "lexgen run scanners agree with the scalar fallback"
+if grep -q "lex_run1" "$TEST_DIR/lex/def_lexer.c" && \
+   cc -std=c11 -Wall -Werror -DLEX_NO_SIMD -I"$TEST_DIR/lex" "$TEST_DIR/lex_main.c" "$TEST_DIR/lex/def_lexer.c" \
+      -o "$TEST_DIR/lex_scalar" 2>/dev/null && \
+   "$TEST_DIR/lex_scalar" && "$TEST_DIR/lex_main"; then
+    log_pass
+else
+    log_fail "run scanner lexer failed"
+fi
+
+log_test "lexgen streaming lexer keeps tokens across refills at every chunk size"
+cat > "$TEST_DIR/lex_stream.c" <<'SRC'
+#include "def_lexer.h"
+#include <string.h>
+static const char *texts[] = {
+    "const LIMIT_WITH_A_LONG_NAME = 0x7fff # trailing comment\nenum E : u8 { A = -1 }",
+    "x = abc",
+    "=u8",
+};
+static const char *text;
+static size_t chunk;
+static size_t feed(void *ctx, char *buf, size_t cap) {
+    size_t *pos = ctx, n = strlen(text) - *pos;
+    if (n > chunk) n = chunk;
+    if (n > cap) n = cap;
+    memcpy(buf, text + *pos, n);
+    *pos += n;
+    return n;
+}
+int main(void) {
+    for (size_t t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+        text = texts[t];
+        for (chunk = 1; chunk <= strlen(text); chunk++) {
+            for (size_t cap = 1; cap <= 8; cap *= 2) {
+                char exact[128];               /* not NUL-terminated */
+                DEF_lexer_t a, b;
+                DEF_token_t x, y;
+                size_t pos = 0;
+                memcpy(exact, text, strlen(text));
+                DEF_lexer_init_n(&a, exact, strlen(text));
+                if (DEF_lexer_init_stream(&b, feed, &pos, cap) != 0) return 1;
+                do {
+                    x = DEF_lexer_next(&a);
+                    y = DEF_lexer_next(&b);
+                    if (x.type != y.type || x.length != y.length || x.line != y.line ||
+                        x.column != y.column || memcmp(x.start, y.start, x.length) != 0)
+                        return 1;
+                } while (x.type != DEF_TOKEN_EOF);
+                DEF_lexer_free(&b);
+            }
+        }
+    }
+    return 0;
+}
+SRC
+if cc -std=c11 -Wall -Werror -I"$TEST_DIR/lex" "$TEST_DIR/lex_stream.c" "$TEST_DIR/lex/def_lexer.c" \
+      -o "$TEST_DIR/lex_stream" 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/lexd" "$TEST_DIR/lex_stream.c" "$TEST_DIR/lexd/def_lexer.c" \
+      -o "$TEST_DIR/lexd_stream" 2>/dev/null && \
+   "$TEST_DIR/lex_stream" && "$TEST_DIR/lexd_stream"; then
+    log_pass
+else
+    log_fail "streamed tokens differ from the in-memory lexer"
+fi
+
+log_test "lexgen tokenize_all matches lexer_next with lazy positions"
+cat > "$TEST_DIR/lex_all.c" <<'SRC'
+#include "def_lexer.h"
+#include <string.h>
+int main(void) {
+    static const char text[] = "const A = 1\n\n  enum E : u8 {\n    X = 0x2, # note\n    Y = -3 }\n\"s\" ?";
+    DEF_tokens_t all;
+    DEF_lexer_t lex;
+    DEF_token_t t;
+    size_t i = 0;
+    if (DEF_tokenize_all(text, sizeof(text) - 1, &all) != 0 || all.line_start) return 1;
+    DEF_lexer_init(&lex, text);
+    do {
+        int line, column;
+        t = DEF_lexer_next(&lex);
+        if (i >= all.count || all.type[i] != t.type || all.length[i] != t.length ||
+            text + all.offset[i] != t.start)
+            return 1;
+        if (DEF_tokens_position(&all, i, &line, &column) != 0 || line != t.line || column != t.column)
+            return 1;
+        i++;
+    } while (t.type != DEF_TOKEN_EOF);
+    if (i != all.count) return 1;
+    DEF_tokens_free(&all);
+    return 0;
+}
+SRC
+if cc -std=c11 -Wall -Werror -I"$TEST_DIR/lex" "$TEST_DIR/lex_all.c" "$TEST_DIR/lex/def_lexer.c" \
+      -o "$TEST_DIR/lex_all" 2>/dev/null && \
+   "$TEST_DIR/lex_all"; then
+    log_pass
+else
+    log_fail "batch tokens differ from lexer_next"
+fi
+
+log_test "lempar arena parser grows its stack in the arena, keeps nodes aligned and profiles reduces"
+mkdir -p "$TEST_DIR/lempar"
+cat > "$TEST_DIR/lempar/calc.y" <<'SRC'
+%include {
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#define YYARENA 1
+#define YYARENA_ALIGN 128  /* wider than the in-place stack growth steps */
+#define YYPROFILE 1
+typedef struct Node { int value; struct Node *next; } Node;
+int calc_misaligned;
+}
+%name Calc
+%token_type { int }
+%extra_argument { long *pSum }
+%stack_size 0
+%type list { Node* }
+
+program ::= list(L). { for (Node *n = L; n; n = n->next) *pSum += n->value; }
+list(A) ::= NUM(N) list(B). {
+    A = CalcArenaAlloc(yypParser, sizeof(Node));
+    if ((uintptr_t)A % YYARENA_ALIGN) calc_misaligned++;
+    if (A) { A->value = N; A->next = B; }
+}
+list(A) ::= . { A = 0; }
+SRC
+cat > "$TEST_DIR/lempar/main.c" <<'SRC'
+#include <stdio.h>
+#include <stdlib.h>
+#include "calc.h"
+void *CalcAlloc(void *(*)(size_t));
+void Calc(void *, int, int, long *);
+void CalcFree(void *, void (*)(void *));
+void CalcArenaInit(void *, void *, size_t);
+void CalcArenaReset(void *);
+size_t CalcArenaUsed(void *);
+unsigned long CalcProfile(void *, FILE *);
+extern int calc_misaligned;
+static char arena[1 << 20];
+int main(void) {
+    void *p = CalcAlloc(malloc);
+    CalcArenaInit(p, arena + 1, sizeof(arena) - 1);
+    for (int round = 0; round < 2; round++) {
+        long sum = 0;
+        for (int i = 1; i <= 1000; i++) Calc(p, NUM, i, &sum);
+        Calc(p, 0, 0, &sum);
+        if (sum != 500500 || calc_misaligned || CalcArenaUsed(p) < 1000 * sizeof(void *)) return 1;
+        CalcArenaReset(p);
+        if (CalcArenaUsed(p) != 0) return 1;
+    }
+    if (CalcProfile(p, NULL) != 2004) return 1;
+    CalcFree(p, free);
+    return 0;
+}
+SRC
+if "$TEST_DIR/lemon" -T"$ROOT_DIR/tools/lempar.c" "$TEST_DIR/lempar/calc.y" >/dev/null 2>&1 && \
+   cc -std=c11 -Wall -Werror -I"$TEST_DIR/lempar" \
+      "$TEST_DIR/lempar/calc.c" "$TEST_DIR/lempar/main.c" -o "$TEST_DIR/lempar/calc" 2>/dev/null && \
+   "$TEST_DIR/lempar/calc"; then
+    log_pass
+else
+    log_fail "arena parse, node alignment or reduce counts wrong"
+fi
+
+log_test "bddgen generated front end keeps long steps and skips docstrings"
+LONG_STEP=$(printf 'x%.0s' $(seq 1 2000))
+cat > "$TEST_DIR/front.feature" <<SRC
+@smoke
+Feature: Front end
+  Givens on a description line are prose
+
+  Scenario: Long
+    Given a step of $LONG_STEP
+    """
+    Given text inside a docstring
+    """
+    Then it passes
+SRC
+if make -s build/bddgen >/dev/null 2>&1 && \
+   build/bddgen --run "$TEST_DIR/front.feature" | grep -q "Scenario: Long (2 step(s))" && \
+   build/bddgen "$TEST_DIR/front.feature" "$TEST_DIR/front" FRONT >/dev/null 2>&1 && \
+   grep -q "$LONG_STEP\"" "$TEST_DIR/front/front_bdd.c"; then
+    log_pass
+else
+    log_fail "front end dropped or split steps"
+fi
+
+log_test "hsmgen and apigen generated front ends keep long lines whole"
+LONG_NAME=$(printf 'x%.0s' $(seq 1 1500))
+cat > "$TEST_DIR/front.hsm" <<SRC
+machine Front {
+    initial: Idle
+    state Idle { on Go_$LONG_NAME -> Busy / start() }
+    state Busy {
+        on Stop -> Idle
+    }
+}
+SRC
+LONG_ERRORS=$(seq 1 12 | sed "s/^/Failure-/; s/\$/-$(printf 'y%.0s' $(seq 1 150))/" | paste -sd, - | sed 's/,/, /g')
+cat > "$TEST_DIR/front.api" <<SRC
+api Front {
+    version: "1.0"
+    endpoint Poke {
+        method: POST
+        path: "/poke"
+        errors: [$LONG_ERRORS]
+    }
+}
+SRC
+printf 'machine Bad {\n    state A {\n        on -> A\n    }\n}\n' > "$TEST_DIR/bad.hsm"
+if make -s build/hsmgen build/apigen >/dev/null 2>&1 && \
+   build/hsmgen "$TEST_DIR/front.hsm" "$TEST_DIR/front" >/dev/null 2>&1 && \
+   grep -q "Front_EVENT_GO_$(echo $LONG_NAME | tr x X) = 0" "$TEST_DIR/front/front_hsm.h" && \
+   grep -q "extern void start(" "$TEST_DIR/front/front_hsm.h" && \
+   build/apigen "$TEST_DIR/front.api" "$TEST_DIR/front" >/dev/null 2>&1 && \
+   grep -q "Front_ERR_FAILURE_12_$(printf 'Y%.0s' $(seq 1 150))," "$TEST_DIR/front/front_api.h" && \
+   ! build/hsmgen "$TEST_DIR/bad.hsm" "$TEST_DIR/front" 2>"$TEST_DIR/bad.log" && \
+   grep -q "bad.hsm:3: syntax error" "$TEST_DIR/bad.log"; then
+    log_pass
+else
+    log_fail "front end truncated a line or missed a syntax error"
+fi
+
+log_test "schemagen and sqlgen generated front ends parse by token, not by line"
+cat > "$TEST_DIR/front.schema" <<'SRC'
+type Front {
+    has_range:  i32
+    retries:    i32           # Retries (default: 3)
+    color:      u32 [default: 0xFFFFFF, doc: "RGB"]
+    level:      i32 [range: -5..5]
+}
+SRC
+printf 'type Bad {\n    a: i32 [range: 1..]\n}\n' > "$TEST_DIR/bad.schema"
+mkdir -p "$TEST_DIR/sql"
+{
+    echo "table t_$LONG_NAME {"
+    seq 1 40 | sed 's/.*/    c&: integer not null/'
+    echo "    owner: integer references users(id)"
+    echo "}"
+    echo "index t_owner on t_$LONG_NAME(c1, owner)"
+    echo "query pick($(seq 1 12 | sed 's/.*/p&: integer/' | paste -sd, -)) -> t_$LONG_NAME {"
+    echo "    SELECT * FROM t_$LONG_NAME"
+    echo "}"
+} > "$TEST_DIR/sql/a.sql"
+printf 'table b {\n    id: integer primary key\n}\n' > "$TEST_DIR/sql/b.sql"
+cat > "$TEST_DIR/sql/rerun_main.c" <<'SRC'
+int sqlgen_main(int argc, char **argv);
+/* bde's multi-call binary may run sqlgen more than once per process */
+int main(int argc, char **argv) {
+    char *a[] = { "sqlgen", argv[1], argv[3], "a", 0 };
+    char *b[] = { "sqlgen", argv[2], argv[3], "b", 0 };
+    (void)argc;
+    return sqlgen_main(4, a) != 0 || sqlgen_main(4, b) != 0;
+}
+SRC
+SQL_OUT="$TEST_DIR/sql/gen"
+if make -s build/schemagen build/front/sql_lexer.c build/front/sql_parser.c >/dev/null 2>&1 && \
+   build/schemagen --c "$TEST_DIR/front.schema" "$TEST_DIR/front" front >/dev/null 2>&1 && \
+   ! grep -q "has_range <" "$TEST_DIR/front/front_types.c" && \
+   ! grep -q "obj->retries =" "$TEST_DIR/front/front_types.c" && \
+   grep -q "obj->color = 16777215;" "$TEST_DIR/front/front_types.c" && \
+   grep -q "obj->level < -5 || obj->level > 5" "$TEST_DIR/front/front_types.c" && \
+   ! build/schemagen "$TEST_DIR/bad.schema" "$TEST_DIR/front" 2>"$TEST_DIR/bad.log" && \
+   grep -q "bad.schema:2: syntax error" "$TEST_DIR/bad.log" && \
+   cc -O2 -std=c11 -w -Itools/sqlgen -Ibuild/front -Dmain=sqlgen_main -c tools/sqlgen/sqlgen.c -o "$TEST_DIR/sql/sqlgen_lib.o" 2>/dev/null && \
+   cc -std=c11 -Wall -Werror -Itools/sqlgen "$TEST_DIR/sql/rerun_main.c" "$TEST_DIR/sql/sqlgen_lib.o" \
+       build/front/sql_lexer.c build/front/sql_parser.c -o "$TEST_DIR/sql/rerun_main" 2>/dev/null && \
+   "$TEST_DIR/sql/rerun_main" "$TEST_DIR/sql/a.sql" "$TEST_DIR/sql/b.sql" "$SQL_OUT" 2>/dev/null && \
+   grep -q "    c40 integer NOT NULL,\$" "$SQL_OUT/a_schema.sql" && \
+   grep -q "owner integer REFERENCES users(id)\$" "$SQL_OUT/a_schema.sql" && \
+   grep -q "ON t_$LONG_NAME(c1, owner);" "$SQL_OUT/a_schema.sql" && \
+   grep -q "int64_t p12, a_t_${LONG_NAME}_row_t \*out);" "$SQL_OUT/a_db.h" && \
+   ! grep -q "t_$LONG_NAME" "$SQL_OUT/b_schema.sql"; then
+    log_pass
+else
+    log_fail "a front end split, truncated or leaked a spec"
+fi
+
+log_test "bde regen matches the per-tool generators in one process"
+mkdir -p "$TEST_DIR/bde/specs/domain" "$TEST_DIR/bde/specs/behavior" "$TEST_DIR/bde/specs/testing"
+cp specs/domain/example.schema specs/domain/types.def "$TEST_DIR/bde/specs/domain/"
+cp specs/behavior/traffic_light.hsm "$TEST_DIR/bde/specs/behavior/"
+cp specs/testing/e9livereload.feature "$TEST_DIR/bde/specs/testing/"
+BDE_SPECS="$TEST_DIR/bde/specs"
+if make -s build/bde build/schemagen build/defgen build/hsmgen build/bddgen >/dev/null 2>&1 && \
+   build/schemagen --all "$BDE_SPECS/domain/example.schema" "$TEST_DIR/bde/a/domain" example >/dev/null 2>&1 && \
+   build/defgen "$BDE_SPECS/domain/types.def" "$TEST_DIR/bde/a/domain" types >/dev/null 2>&1 && \
+   build/hsmgen "$BDE_SPECS/behavior/traffic_light.hsm" "$TEST_DIR/bde/a/behavior" >/dev/null 2>&1 && \
+   build/bddgen "$BDE_SPECS/testing/e9livereload.feature" "$TEST_DIR/bde/a/testing" >/dev/null 2>&1 && \
+   build/bde regen --gen "$TEST_DIR/bde/b" --index "$TEST_DIR/bde/schema.idx" \
+       --manifest "$TEST_DIR/bde/regen.manifest" "$BDE_SPECS" >/dev/null && \
+   diff -r "$TEST_DIR/bde/a" "$TEST_DIR/bde/b" >/dev/null && \
+   ln -sf "$PWD/build/bde" "$TEST_DIR/bde/defgen" && \
+   "$TEST_DIR/bde/defgen" 2>&1 | grep -q "^defgen"; then
+    log_pass
+else
+    log_fail "bde output differs from the standalone generators"
+fi
+
+log_test "bde regen skips unchanged specs and follows imports"
+mkdir -p "$TEST_DIR/dag/specs/domain" "$TEST_DIR/dag/specs/behavior"
+printf 'type Unit {\n    scale: i32\n}\n' > "$TEST_DIR/dag/specs/domain/units.schema"
+printf 'import "units.schema"\ntype Reading {\n    value: f64\n    unit: Unit\n}\n' > "$TEST_DIR/dag/specs/domain/reading.schema"
+cp specs/behavior/traffic_light.hsm "$TEST_DIR/dag/specs/behavior/"
+dag_regen() {
+    build/bde regen -j 2 --gen "$TEST_DIR/dag/gen" --index "$TEST_DIR/dag/schema.idx" \
+        --manifest "$TEST_DIR/dag/regen.manifest" "$TEST_DIR/dag/specs" | tail -1
+}
+if make -s build/bde >/dev/null 2>&1 && \
+   dag_regen | grep -q "3 regenerated, 0 up to date" && \
+   dag_regen | grep -q "0 regenerated, 3 up to date" && \
+   printf 'type Extra {\n    id: u32\n}\n' >> "$TEST_DIR/dag/specs/domain/units.schema" && \
+   dag_regen | grep -q "2 regenerated, 1 up to date" && \
+   rm "$TEST_DIR/dag/gen/behavior/trafficlight_hsm.c" && \
+   dag_regen | grep -q "1 regenerated, 2 up to date" && \
+   [ -f "$TEST_DIR/dag/gen/behavior/trafficlight_hsm.c" ] && \
+   grep -q "Extra" "$TEST_DIR/dag/gen/domain/units_types.h"; then
+    log_pass
+else
+    log_fail "manifest did not track spec, import or output changes"
+fi
+
+log_test "bde regen --check finds drift without touching gen/"
+dag_check() {
+    build/bde regen --check --gen "$TEST_DIR/dag/gen" --index "$TEST_DIR/dag/schema.idx" \
+        --manifest "$TEST_DIR/dag/regen.manifest" "$TEST_DIR/dag/specs"
+}
+if dag_check | grep -q "0 checked, 3 up to date, 0 drifted" && \
+   echo "/* edited */" >> "$TEST_DIR/dag/gen/domain/reading_types.h" && \
+   ! dag_check >/dev/null && \
+   grep -q "edited" "$TEST_DIR/dag/gen/domain/reading_types.h" && \
+   dag_check | grep -q "1 checked, 2 up to date, 1 drifted"; then
+    log_pass
+else
+    log_fail "check mode missed drift or rewrote gen/"
+fi
+
+log_test "bde watch regenerates a saved spec"
+mkdir -p "$TEST_DIR/watch/specs/domain"
+printf 'type Probe {\n    a: i32\n}\n' > "$TEST_DIR/watch/specs/domain/probe.schema"
+build/bde watch -n 1 --gen "$TEST_DIR/watch/gen" --index "$TEST_DIR/watch/schema.idx" \
+    --manifest "$TEST_DIR/watch/regen.manifest" "$TEST_DIR/watch/specs" > "$TEST_DIR/watch/log" 2>&1 &
+WATCH_PID=$!
+for _ in 1 2 3 4 5 6 7 8 9 10; do
+    grep -q "watching" "$TEST_DIR/watch/log" 2>/dev/null && break
+    sleep 0.2
+done
+printf 'type Probe {\n    a: i32\n    b: i32\n}\n' > "$TEST_DIR/watch/specs/domain/probe.schema"
+for _ in 1 2 3 4 5 6 7 8 9 10; do
+    kill -0 "$WATCH_PID" 2>/dev/null || break
+    sleep 0.2
+done
+kill "$WATCH_PID" 2>/dev/null || true
+if grep -q "since the change" "$TEST_DIR/watch/log" && \
+   grep -q "int32_t b;" "$TEST_DIR/watch/gen/domain/probe_types.h"; then
+    log_pass
+else
+    log_fail "no regen after the spec was saved"
+fi
+
+log_test "generators leave unchanged outputs untouched"
+mkdir -p "$TEST_DIR/wic"
+if build/hsmgen specs/behavior/traffic_light.hsm "$TEST_DIR/wic" >/dev/null 2>&1 && \
+   touch -d '2000-01-01' "$TEST_DIR/wic/trafficlight_hsm.c" && \
+   build/hsmgen specs/behavior/traffic_light.hsm "$TEST_DIR/wic" >/dev/null 2>&1 && \
+   [ "$(stat -c %Y "$TEST_DIR/wic/trafficlight_hsm.c")" = "$(date -d '2000-01-01' +%s)" ] && \
+   ! ls "$TEST_DIR/wic" | grep -q '\.tmp\.' && \
+   ! grep -q "generated:" "$TEST_DIR/wic/GENERATOR_VERSION"; then
+    log_pass
+else
+    log_fail "unchanged output was rewritten or carries a timestamp"
+fi
+
+log_test "failed outputs keep the old file and fail the generator"
+cat > "$TEST_DIR/abort_main.c" <<'SRC'
+#include "gen_output.h"
+#include <stdlib.h>
+static int holds(const char *path, const char *want) {
+    char got[64] = {0};
+    FILE *f = fopen(path, "r");
+    if (!f) return 0;
+    size_t n = fread(got, 1, sizeof(got) - 1, f);
+    fclose(f);
+    return n == strlen(want) && memcmp(got, want, n) == 0;
+}
+int main(int argc, char **argv) {
+    char path[512];
+    (void)argc;
+    snprintf(path, sizeof(path), "%s/out.c", argv[1]);
+    FILE *f = gen_fopen(path);
+    if (!f) return 1;
+    fputs("good\n", f);
+    if (gen_fclose(f) != 0 || !holds(path, "good\n")) return 2;
+    /* an error path mid-write leaves the old output in place */
+    f = gen_fopen(path);
+    if (!f) return 3;
+    fputs("partial", f);
+    gen_fabort(f);
+    if (!holds(path, "good\n")) return 4;
+    /* a target that cannot be replaced is reported */
+    snprintf(path, sizeof(path), "%s/dir.c", argv[1]);
+    f = gen_fopen(path);
+    if (!f) return 5;
+    fputs("x\n", f);
+    return gen_fclose(f) == EOF ? 0 : 6;
+}
+SRC
+mkdir -p "$TEST_DIR/abort/dir.c" "$TEST_DIR/busy/trafficlight_hsm.c" "$TEST_DIR/busy/example_types.h"
+if cc -std=c11 -Wall -Werror -Itools "$TEST_DIR/abort_main.c" -o "$TEST_DIR/abort_main" 2>/dev/null && \
+   "$TEST_DIR/abort_main" "$TEST_DIR/abort" && \
+   ! ls "$TEST_DIR/abort" | grep -q '\.tmp\.' && \
+   ! build/hsmgen specs/behavior/traffic_light.hsm "$TEST_DIR/busy" >/dev/null 2>&1 && \
+   ! build/schemagen --c specs/domain/example.schema "$TEST_DIR/busy" example >/dev/null 2>&1 && \
+   ! ls "$TEST_DIR/busy" | grep -q '\.tmp\.'; then
+    log_pass
+else
+    log_fail "an aborted output was published or a failed rename exited 0"
+fi
+
 echo
 
 # ── Suite 3: Format Discovery ─────────────────────────────────────────────────
@@ -266,6 +1355,22 @@ else
     log_fail "error"
 fi
 
+log_test "every app gen/ source compiles and the app links the JSON bindings"
+GEN_OBJS=$(find gen -name '*.c' ! -path 'gen/generators/*' ! -path 'gen/ring2/*' | sed 's|^|build/obj/|; s|\.c$|.o|')
+if make -s $GEN_OBJS >/dev/null 2>&1 && \
+   make -s app SQLITE_LIBS=-lsqlite3 >/dev/null 2>&1 && \
+   build/app | grep -q '"name":"Hello from specs!"' && \
+   make -s BUILD_DIR="$TEST_DIR/release-all" PROFILE=release SQLITE_LIBS=-lsqlite3 app >/dev/null 2>&1 && \
+   grep -q '#include "gen/behavior/trafficlight_hsm.c"' "$TEST_DIR/release-all/unity/behavior.c" && \
+   grep -q '#include "gen/domain/example_json.c"' "$TEST_DIR/release-all/unity/domain.c" && \
+   [ -f "$TEST_DIR/release-all/obj/unity/api.o" ] && \
+   [ -f "$TEST_DIR/release-all/obj/unity/persistence.o" ] && \
+   "$TEST_DIR/release-all/app" | grep -q "Validation: PASSED"; then
+    log_pass
+else
+    log_fail "a gen/ layer does not compile or the app does not link yyjson"
+fi
+
 log_test "make run executes"
 if make run >/dev/null 2>&1; then
     log_pass
@@ -273,6 +1378,45 @@ else
     log_fail "error"
 fi
 
+log_test "app objects rebuild from depfiles only when their headers change"
+if make -s app >/dev/null 2>&1 && [ -f build/obj/src/main.d ] && \
+   make app > "$TEST_DIR/make1.log" 2>&1 && \
+   sleep 1 && touch gen/domain/example_types.h && \
+   make app > "$TEST_DIR/make2.log" 2>&1 && \
+   make app > "$TEST_DIR/make3.log" 2>&1 && \
+   ! grep -q -- "-c -o" "$TEST_DIR/make1.log" && \
+   grep -q -- "-o build/obj/src/main.o" "$TEST_DIR/make2.log" && \
+   ! grep -q -- "-c -o" "$TEST_DIR/make3.log"; then
+    log_pass
+else
+    log_fail "build/obj depfiles missing or stale"
+fi
+
+log_test "PROFILE=release links the app from per-layer unity objects"
+if make -s BUILD_DIR="$TEST_DIR/release" PROFILE=release app >/dev/null 2>&1 && \
+   grep -q '#include "gen/domain/example_types.c"' "$TEST_DIR/release/unity/domain.c" && \
+   grep -q '#include "gen/domain/example_json.c"' "$TEST_DIR/release/unity/domain.c" && \
+   grep -q '#include "gen/behavior/editor_msm.c"' "$TEST_DIR/release/unity/behavior.c" && \
+   [ -f "$TEST_DIR/release/obj/unity/domain.o" ] && \
+   [ -f "$TEST_DIR/release/obj/unity/behavior.o" ] && \
+   [ -f "$TEST_DIR/release/obj/unity/api.o" ] && \
+   [ -f "$TEST_DIR/release/obj/unity/testing.o" ] && \
+   [ ! -f "$TEST_DIR/release/obj/gen/domain/example_types.o" ] && \
+   "$TEST_DIR/release/app" | grep -q "Validation: PASSED"; then
+    log_pass
+else
+    log_fail "release build did not use the unity translation unit"
+fi
+
+log_test "bench-generators runs every Ring 0 tool on full-size synthetic specs"
+if BENCH_MAX_GROWTH=99 ./scripts/bench-generators.sh 1 1 > "$TEST_DIR/bench-generators.log" 2>&1 && \
+   [ "$(awk -F '\t' 'NR > 1 && $4 > 0 && $7 > 0 && $8 > 0' build/bench-generators/results.tsv | wc -l)" -eq 10 ] && \
+   awk -F '\t' '$1 == "lexgen" && $2 == "full" && $3 == 500 { ok = 1 } END { exit !ok }' build/bench-generators/results.tsv; then
+    log_pass
+else
+    log_fail "see $TEST_DIR/bench-generators.log"
+fi
+
 log_test "make verify runs (drift check)"
 if make verify >/dev/null 2>&1; then
     log_pass
@@ -280,6 +1424,20 @@ else
     log_skip "drift detected (expected if uncommitted changes)"
 fi
 
+log_test "make verify catches edits to gen/ outside bde's outputs"
+if ! make verify >/dev/null 2>&1; then
+    log_skip "drift detected (expected if uncommitted changes)"
+else
+    cp gen/persistence/users_db.c "$TEST_DIR/users_db.c.orig"
+    echo "/* hand edit */" >> gen/persistence/users_db.c
+    if make verify 2>/dev/null | grep -q "gen/persistence/users_db.c"; then
+        log_pass
+    else
+        log_fail "hand edit to gen/persistence/users_db.c not reported"
+    fi
+    cp "$TEST_DIR/users_db.c.orig" gen/persistence/users_db.c
+fi
+
 echo
 
 # ── Suite 5: CI Workflow Syntax ───────────────────────────────────────────────
@@ -0,0 +1,8003 @@
+Feature: Synthetic workload
+  Exercises bddgen with 5000 steps
+
+  @synthetic
+  Scenario: Synthetic scenario 0
+    Given record 0 exists
+    And record 0 has value 0
+    When record 0 is updated
+    Then record 0 should be saved
+    But record 0 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 1
+    Given record 1 exists
+    And record 1 has value 7
+    When record 1 is updated
+    Then record 1 should be saved
+    But record 1 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 2
+    Given record 2 exists
+    And record 2 has value 14
+    When record 2 is updated
+    Then record 2 should be saved
+    But record 2 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 3
+    Given record 3 exists
+    And record 3 has value 21
+    When record 3 is updated
+    Then record 3 should be saved
+    But record 3 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 4
+    Given record 4 exists
+    And record 4 has value 28
+    When record 4 is updated
+    Then record 4 should be saved
+    But record 4 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 5
+    Given record 5 exists
+    And record 5 has value 35
+    When record 5 is updated
+    Then record 5 should be saved
+    But record 5 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 6
+    Given record 6 exists
+    And record 6 has value 42
+    When record 6 is updated
+    Then record 6 should be saved
+    But record 6 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 7
+    Given record 7 exists
+    And record 7 has value 49
+    When record 7 is updated
+    Then record 7 should be saved
+    But record 7 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 8
+    Given record 8 exists
+    And record 8 has value 56
+    When record 8 is updated
+    Then record 8 should be saved
+    But record 8 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 9
+    Given record 9 exists
+    And record 9 has value 63
+    When record 9 is updated
+    Then record 9 should be saved
+    But record 9 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 10
+    Given record 10 exists
+    And record 10 has value 70
+    When record 10 is updated
+    Then record 10 should be saved
+    But record 10 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 11
+    Given record 11 exists
+    And record 11 has value 77
+    When record 11 is updated
+    Then record 11 should be saved
+    But record 11 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 12
+    Given record 12 exists
+    And record 12 has value 84
+    When record 12 is updated
+    Then record 12 should be saved
+    But record 12 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 13
+    Given record 13 exists
+    And record 13 has value 91
+    When record 13 is updated
+    Then record 13 should be saved
+    But record 13 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 14
+    Given record 14 exists
+    And record 14 has value 98
+    When record 14 is updated
+    Then record 14 should be saved
+    But record 14 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 15
+    Given record 15 exists
+    And record 15 has value 105
+    When record 15 is updated
+    Then record 15 should be saved
+    But record 15 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 16
+    Given record 16 exists
+    And record 16 has value 112
+    When record 16 is updated
+    Then record 16 should be saved
+    But record 16 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 17
+    Given record 17 exists
+    And record 17 has value 119
+    When record 17 is updated
+    Then record 17 should be saved
+    But record 17 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 18
+    Given record 18 exists
+    And record 18 has value 126
+    When record 18 is updated
+    Then record 18 should be saved
+    But record 18 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 19
+    Given record 19 exists
+    And record 19 has value 133
+    When record 19 is updated
+    Then record 19 should be saved
+    But record 19 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 20
+    Given record 20 exists
+    And record 20 has value 140
+    When record 20 is updated
+    Then record 20 should be saved
+    But record 20 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 21
+    Given record 21 exists
+    And record 21 has value 147
+    When record 21 is updated
+    Then record 21 should be saved
+    But record 21 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 22
+    Given record 22 exists
+    And record 22 has value 154
+    When record 22 is updated
+    Then record 22 should be saved
+    But record 22 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 23
+    Given record 23 exists
+    And record 23 has value 161
+    When record 23 is updated
+    Then record 23 should be saved
+    But record 23 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 24
+    Given record 24 exists
+    And record 24 has value 168
+    When record 24 is updated
+    Then record 24 should be saved
+    But record 24 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 25
+    Given record 25 exists
+    And record 25 has value 175
+    When record 25 is updated
+    Then record 25 should be saved
+    But record 25 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 26
+    Given record 26 exists
+    And record 26 has value 182
+    When record 26 is updated
+    Then record 26 should be saved
+    But record 26 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 27
+    Given record 27 exists
+    And record 27 has value 189
+    When record 27 is updated
+    Then record 27 should be saved
+    But record 27 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 28
+    Given record 28 exists
+    And record 28 has value 196
+    When record 28 is updated
+    Then record 28 should be saved
+    But record 28 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 29
+    Given record 29 exists
+    And record 29 has value 203
+    When record 29 is updated
+    Then record 29 should be saved
+    But record 29 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 30
+    Given record 30 exists
+    And record 30 has value 210
+    When record 30 is updated
+    Then record 30 should be saved
+    But record 30 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 31
+    Given record 31 exists
+    And record 31 has value 217
+    When record 31 is updated
+    Then record 31 should be saved
+    But record 31 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 32
+    Given record 32 exists
+    And record 32 has value 224
+    When record 32 is updated
+    Then record 32 should be saved
+    But record 32 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 33
+    Given record 33 exists
+    And record 33 has value 231
+    When record 33 is updated
+    Then record 33 should be saved
+    But record 33 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 34
+    Given record 34 exists
+    And record 34 has value 238
+    When record 34 is updated
+    Then record 34 should be saved
+    But record 34 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 35
+    Given record 35 exists
+    And record 35 has value 245
+    When record 35 is updated
+    Then record 35 should be saved
+    But record 35 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 36
+    Given record 36 exists
+    And record 36 has value 252
+    When record 36 is updated
+    Then record 36 should be saved
+    But record 36 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 37
+    Given record 37 exists
+    And record 37 has value 259
+    When record 37 is updated
+    Then record 37 should be saved
+    But record 37 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 38
+    Given record 38 exists
+    And record 38 has value 266
+    When record 38 is updated
+    Then record 38 should be saved
+    But record 38 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 39
+    Given record 39 exists
+    And record 39 has value 273
+    When record 39 is updated
+    Then record 39 should be saved
+    But record 39 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 40
+    Given record 40 exists
+    And record 40 has value 280
+    When record 40 is updated
+    Then record 40 should be saved
+    But record 40 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 41
+    Given record 41 exists
+    And record 41 has value 287
+    When record 41 is updated
+    Then record 41 should be saved
+    But record 41 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 42
+    Given record 42 exists
+    And record 42 has value 294
+    When record 42 is updated
+    Then record 42 should be saved
+    But record 42 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 43
+    Given record 43 exists
+    And record 43 has value 301
+    When record 43 is updated
+    Then record 43 should be saved
+    But record 43 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 44
+    Given record 44 exists
+    And record 44 has value 308
+    When record 44 is updated
+    Then record 44 should be saved
+    But record 44 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 45
+    Given record 45 exists
+    And record 45 has value 315
+    When record 45 is updated
+    Then record 45 should be saved
+    But record 45 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 46
+    Given record 46 exists
+    And record 46 has value 322
+    When record 46 is updated
+    Then record 46 should be saved
+    But record 46 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 47
+    Given record 47 exists
+    And record 47 has value 329
+    When record 47 is updated
+    Then record 47 should be saved
+    But record 47 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 48
+    Given record 48 exists
+    And record 48 has value 336
+    When record 48 is updated
+    Then record 48 should be saved
+    But record 48 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 49
+    Given record 49 exists
+    And record 49 has value 343
+    When record 49 is updated
+    Then record 49 should be saved
+    But record 49 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 50
+    Given record 50 exists
+    And record 50 has value 350
+    When record 50 is updated
+    Then record 50 should be saved
+    But record 50 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 51
+    Given record 51 exists
+    And record 51 has value 357
+    When record 51 is updated
+    Then record 51 should be saved
+    But record 51 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 52
+    Given record 52 exists
+    And record 52 has value 364
+    When record 52 is updated
+    Then record 52 should be saved
+    But record 52 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 53
+    Given record 53 exists
+    And record 53 has value 371
+    When record 53 is updated
+    Then record 53 should be saved
+    But record 53 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 54
+    Given record 54 exists
+    And record 54 has value 378
+    When record 54 is updated
+    Then record 54 should be saved
+    But record 54 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 55
+    Given record 55 exists
+    And record 55 has value 385
+    When record 55 is updated
+    Then record 55 should be saved
+    But record 55 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 56
+    Given record 56 exists
+    And record 56 has value 392
+    When record 56 is updated
+    Then record 56 should be saved
+    But record 56 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 57
+    Given record 57 exists
+    And record 57 has value 399
+    When record 57 is updated
+    Then record 57 should be saved
+    But record 57 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 58
+    Given record 58 exists
+    And record 58 has value 406
+    When record 58 is updated
+    Then record 58 should be saved
+    But record 58 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 59
+    Given record 59 exists
+    And record 59 has value 413
+    When record 59 is updated
+    Then record 59 should be saved
+    But record 59 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 60
+    Given record 60 exists
+    And record 60 has value 420
+    When record 60 is updated
+    Then record 60 should be saved
+    But record 60 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 61
+    Given record 61 exists
+    And record 61 has value 427
+    When record 61 is updated
+    Then record 61 should be saved
+    But record 61 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 62
+    Given record 62 exists
+    And record 62 has value 434
+    When record 62 is updated
+    Then record 62 should be saved
+    But record 62 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 63
+    Given record 63 exists
+    And record 63 has value 441
+    When record 63 is updated
+    Then record 63 should be saved
+    But record 63 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 64
+    Given record 64 exists
+    And record 64 has value 448
+    When record 64 is updated
+    Then record 64 should be saved
+    But record 64 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 65
+    Given record 65 exists
+    And record 65 has value 455
+    When record 65 is updated
+    Then record 65 should be saved
+    But record 65 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 66
+    Given record 66 exists
+    And record 66 has value 462
+    When record 66 is updated
+    Then record 66 should be saved
+    But record 66 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 67
+    Given record 67 exists
+    And record 67 has value 469
+    When record 67 is updated
+    Then record 67 should be saved
+    But record 67 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 68
+    Given record 68 exists
+    And record 68 has value 476
+    When record 68 is updated
+    Then record 68 should be saved
+    But record 68 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 69
+    Given record 69 exists
+    And record 69 has value 483
+    When record 69 is updated
+    Then record 69 should be saved
+    But record 69 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 70
+    Given record 70 exists
+    And record 70 has value 490
+    When record 70 is updated
+    Then record 70 should be saved
+    But record 70 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 71
+    Given record 71 exists
+    And record 71 has value 497
+    When record 71 is updated
+    Then record 71 should be saved
+    But record 71 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 72
+    Given record 72 exists
+    And record 72 has value 504
+    When record 72 is updated
+    Then record 72 should be saved
+    But record 72 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 73
+    Given record 73 exists
+    And record 73 has value 511
+    When record 73 is updated
+    Then record 73 should be saved
+    But record 73 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 74
+    Given record 74 exists
+    And record 74 has value 518
+    When record 74 is updated
+    Then record 74 should be saved
+    But record 74 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 75
+    Given record 75 exists
+    And record 75 has value 525
+    When record 75 is updated
+    Then record 75 should be saved
+    But record 75 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 76
+    Given record 76 exists
+    And record 76 has value 532
+    When record 76 is updated
+    Then record 76 should be saved
+    But record 76 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 77
+    Given record 77 exists
+    And record 77 has value 539
+    When record 77 is updated
+    Then record 77 should be saved
+    But record 77 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 78
+    Given record 78 exists
+    And record 78 has value 546
+    When record 78 is updated
+    Then record 78 should be saved
+    But record 78 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 79
+    Given record 79 exists
+    And record 79 has value 553
+    When record 79 is updated
+    Then record 79 should be saved
+    But record 79 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 80
+    Given record 80 exists
+    And record 80 has value 560
+    When record 80 is updated
+    Then record 80 should be saved
+    But record 80 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 81
+    Given record 81 exists
+    And record 81 has value 567
+    When record 81 is updated
+    Then record 81 should be saved
+    But record 81 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 82
+    Given record 82 exists
+    And record 82 has value 574
+    When record 82 is updated
+    Then record 82 should be saved
+    But record 82 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 83
+    Given record 83 exists
+    And record 83 has value 581
+    When record 83 is updated
+    Then record 83 should be saved
+    But record 83 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 84
+    Given record 84 exists
+    And record 84 has value 588
+    When record 84 is updated
+    Then record 84 should be saved
+    But record 84 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 85
+    Given record 85 exists
+    And record 85 has value 595
+    When record 85 is updated
+    Then record 85 should be saved
+    But record 85 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 86
+    Given record 86 exists
+    And record 86 has value 602
+    When record 86 is updated
+    Then record 86 should be saved
+    But record 86 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 87
+    Given record 87 exists
+    And record 87 has value 609
+    When record 87 is updated
+    Then record 87 should be saved
+    But record 87 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 88
+    Given record 88 exists
+    And record 88 has value 616
+    When record 88 is updated
+    Then record 88 should be saved
+    But record 88 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 89
+    Given record 89 exists
+    And record 89 has value 623
+    When record 89 is updated
+    Then record 89 should be saved
+    But record 89 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 90
+    Given record 90 exists
+    And record 90 has value 630
+    When record 90 is updated
+    Then record 90 should be saved
+    But record 90 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 91
+    Given record 91 exists
+    And record 91 has value 637
+    When record 91 is updated
+    Then record 91 should be saved
+    But record 91 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 92
+    Given record 92 exists
+    And record 92 has value 644
+    When record 92 is updated
+    Then record 92 should be saved
+    But record 92 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 93
+    Given record 93 exists
+    And record 93 has value 651
+    When record 93 is updated
+    Then record 93 should be saved
+    But record 93 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 94
+    Given record 94 exists
+    And record 94 has value 658
+    When record 94 is updated
+    Then record 94 should be saved
+    But record 94 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 95
+    Given record 95 exists
+    And record 95 has value 665
+    When record 95 is updated
+    Then record 95 should be saved
+    But record 95 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 96
+    Given record 96 exists
+    And record 96 has value 672
+    When record 96 is updated
+    Then record 96 should be saved
+    But record 96 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 97
+    Given record 97 exists
+    And record 97 has value 679
+    When record 97 is updated
+    Then record 97 should be saved
+    But record 97 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 98
+    Given record 98 exists
+    And record 98 has value 686
+    When record 98 is updated
+    Then record 98 should be saved
+    But record 98 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 99
+    Given record 99 exists
+    And record 99 has value 693
+    When record 99 is updated
+    Then record 99 should be saved
+    But record 99 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 100
+    Given record 100 exists
+    And record 100 has value 700
+    When record 100 is updated
+    Then record 100 should be saved
+    But record 100 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 101
+    Given record 101 exists
+    And record 101 has value 707
+    When record 101 is updated
+    Then record 101 should be saved
+    But record 101 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 102
+    Given record 102 exists
+    And record 102 has value 714
+    When record 102 is updated
+    Then record 102 should be saved
+    But record 102 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 103
+    Given record 103 exists
+    And record 103 has value 721
+    When record 103 is updated
+    Then record 103 should be saved
+    But record 103 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 104
+    Given record 104 exists
+    And record 104 has value 728
+    When record 104 is updated
+    Then record 104 should be saved
+    But record 104 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 105
+    Given record 105 exists
+    And record 105 has value 735
+    When record 105 is updated
+    Then record 105 should be saved
+    But record 105 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 106
+    Given record 106 exists
+    And record 106 has value 742
+    When record 106 is updated
+    Then record 106 should be saved
+    But record 106 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 107
+    Given record 107 exists
+    And record 107 has value 749
+    When record 107 is updated
+    Then record 107 should be saved
+    But record 107 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 108
+    Given record 108 exists
+    And record 108 has value 756
+    When record 108 is updated
+    Then record 108 should be saved
+    But record 108 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 109
+    Given record 109 exists
+    And record 109 has value 763
+    When record 109 is updated
+    Then record 109 should be saved
+    But record 109 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 110
+    Given record 110 exists
+    And record 110 has value 770
+    When record 110 is updated
+    Then record 110 should be saved
+    But record 110 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 111
+    Given record 111 exists
+    And record 111 has value 777
+    When record 111 is updated
+    Then record 111 should be saved
+    But record 111 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 112
+    Given record 112 exists
+    And record 112 has value 784
+    When record 112 is updated
+    Then record 112 should be saved
+    But record 112 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 113
+    Given record 113 exists
+    And record 113 has value 791
+    When record 113 is updated
+    Then record 113 should be saved
+    But record 113 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 114
+    Given record 114 exists
+    And record 114 has value 798
+    When record 114 is updated
+    Then record 114 should be saved
+    But record 114 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 115
+    Given record 115 exists
+    And record 115 has value 805
+    When record 115 is updated
+    Then record 115 should be saved
+    But record 115 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 116
+    Given record 116 exists
+    And record 116 has value 812
+    When record 116 is updated
+    Then record 116 should be saved
+    But record 116 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 117
+    Given record 117 exists
+    And record 117 has value 819
+    When record 117 is updated
+    Then record 117 should be saved
+    But record 117 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 118
+    Given record 118 exists
+    And record 118 has value 826
+    When record 118 is updated
+    Then record 118 should be saved
+    But record 118 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 119
+    Given record 119 exists
+    And record 119 has value 833
+    When record 119 is updated
+    Then record 119 should be saved
+    But record 119 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 120
+    Given record 120 exists
+    And record 120 has value 840
+    When record 120 is updated
+    Then record 120 should be saved
+    But record 120 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 121
+    Given record 121 exists
+    And record 121 has value 847
+    When record 121 is updated
+    Then record 121 should be saved
+    But record 121 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 122
+    Given record 122 exists
+    And record 122 has value 854
+    When record 122 is updated
+    Then record 122 should be saved
+    But record 122 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 123
+    Given record 123 exists
+    And record 123 has value 861
+    When record 123 is updated
+    Then record 123 should be saved
+    But record 123 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 124
+    Given record 124 exists
+    And record 124 has value 868
+    When record 124 is updated
+    Then record 124 should be saved
+    But record 124 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 125
+    Given record 125 exists
+    And record 125 has value 875
+    When record 125 is updated
+    Then record 125 should be saved
+    But record 125 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 126
+    Given record 126 exists
+    And record 126 has value 882
+    When record 126 is updated
+    Then record 126 should be saved
+    But record 126 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 127
+    Given record 127 exists
+    And record 127 has value 889
+    When record 127 is updated
+    Then record 127 should be saved
+    But record 127 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 128
+    Given record 128 exists
+    And record 128 has value 896
+    When record 128 is updated
+    Then record 128 should be saved
+    But record 128 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 129
+    Given record 129 exists
+    And record 129 has value 903
+    When record 129 is updated
+    Then record 129 should be saved
+    But record 129 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 130
+    Given record 130 exists
+    And record 130 has value 910
+    When record 130 is updated
+    Then record 130 should be saved
+    But record 130 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 131
+    Given record 131 exists
+    And record 131 has value 917
+    When record 131 is updated
+    Then record 131 should be saved
+    But record 131 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 132
+    Given record 132 exists
+    And record 132 has value 924
+    When record 132 is updated
+    Then record 132 should be saved
+    But record 132 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 133
+    Given record 133 exists
+    And record 133 has value 931
+    When record 133 is updated
+    Then record 133 should be saved
+    But record 133 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 134
+    Given record 134 exists
+    And record 134 has value 938
+    When record 134 is updated
+    Then record 134 should be saved
+    But record 134 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 135
+    Given record 135 exists
+    And record 135 has value 945
+    When record 135 is updated
+    Then record 135 should be saved
+    But record 135 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 136
+    Given record 136 exists
+    And record 136 has value 952
+    When record 136 is updated
+    Then record 136 should be saved
+    But record 136 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 137
+    Given record 137 exists
+    And record 137 has value 959
+    When record 137 is updated
+    Then record 137 should be saved
+    But record 137 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 138
+    Given record 138 exists
+    And record 138 has value 966
+    When record 138 is updated
+    Then record 138 should be saved
+    But record 138 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 139
+    Given record 139 exists
+    And record 139 has value 973
+    When record 139 is updated
+    Then record 139 should be saved
+    But record 139 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 140
+    Given record 140 exists
+    And record 140 has value 980
+    When record 140 is updated
+    Then record 140 should be saved
+    But record 140 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 141
+    Given record 141 exists
+    And record 141 has value 987
+    When record 141 is updated
+    Then record 141 should be saved
+    But record 141 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 142
+    Given record 142 exists
+    And record 142 has value 994
+    When record 142 is updated
+    Then record 142 should be saved
+    But record 142 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 143
+    Given record 143 exists
+    And record 143 has value 1001
+    When record 143 is updated
+    Then record 143 should be saved
+    But record 143 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 144
+    Given record 144 exists
+    And record 144 has value 1008
+    When record 144 is updated
+    Then record 144 should be saved
+    But record 144 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 145
+    Given record 145 exists
+    And record 145 has value 1015
+    When record 145 is updated
+    Then record 145 should be saved
+    But record 145 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 146
+    Given record 146 exists
+    And record 146 has value 1022
+    When record 146 is updated
+    Then record 146 should be saved
+    But record 146 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 147
+    Given record 147 exists
+    And record 147 has value 1029
+    When record 147 is updated
+    Then record 147 should be saved
+    But record 147 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 148
+    Given record 148 exists
+    And record 148 has value 1036
+    When record 148 is updated
+    Then record 148 should be saved
+    But record 148 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 149
+    Given record 149 exists
+    And record 149 has value 1043
+    When record 149 is updated
+    Then record 149 should be saved
+    But record 149 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 150
+    Given record 150 exists
+    And record 150 has value 1050
+    When record 150 is updated
+    Then record 150 should be saved
+    But record 150 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 151
+    Given record 151 exists
+    And record 151 has value 1057
+    When record 151 is updated
+    Then record 151 should be saved
+    But record 151 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 152
+    Given record 152 exists
+    And record 152 has value 1064
+    When record 152 is updated
+    Then record 152 should be saved
+    But record 152 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 153
+    Given record 153 exists
+    And record 153 has value 1071
+    When record 153 is updated
+    Then record 153 should be saved
+    But record 153 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 154
+    Given record 154 exists
+    And record 154 has value 1078
+    When record 154 is updated
+    Then record 154 should be saved
+    But record 154 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 155
+    Given record 155 exists
+    And record 155 has value 1085
+    When record 155 is updated
+    Then record 155 should be saved
+    But record 155 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 156
+    Given record 156 exists
+    And record 156 has value 1092
+    When record 156 is updated
+    Then record 156 should be saved
+    But record 156 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 157
+    Given record 157 exists
+    And record 157 has value 1099
+    When record 157 is updated
+    Then record 157 should be saved
+    But record 157 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 158
+    Given record 158 exists
+    And record 158 has value 1106
+    When record 158 is updated
+    Then record 158 should be saved
+    But record 158 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 159
+    Given record 159 exists
+    And record 159 has value 1113
+    When record 159 is updated
+    Then record 159 should be saved
+    But record 159 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 160
+    Given record 160 exists
+    And record 160 has value 1120
+    When record 160 is updated
+    Then record 160 should be saved
+    But record 160 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 161
+    Given record 161 exists
+    And record 161 has value 1127
+    When record 161 is updated
+    Then record 161 should be saved
+    But record 161 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 162
+    Given record 162 exists
+    And record 162 has value 1134
+    When record 162 is updated
+    Then record 162 should be saved
+    But record 162 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 163
+    Given record 163 exists
+    And record 163 has value 1141
+    When record 163 is updated
+    Then record 163 should be saved
+    But record 163 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 164
+    Given record 164 exists
+    And record 164 has value 1148
+    When record 164 is updated
+    Then record 164 should be saved
+    But record 164 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 165
+    Given record 165 exists
+    And record 165 has value 1155
+    When record 165 is updated
+    Then record 165 should be saved
+    But record 165 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 166
+    Given record 166 exists
+    And record 166 has value 1162
+    When record 166 is updated
+    Then record 166 should be saved
+    But record 166 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 167
+    Given record 167 exists
+    And record 167 has value 1169
+    When record 167 is updated
+    Then record 167 should be saved
+    But record 167 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 168
+    Given record 168 exists
+    And record 168 has value 1176
+    When record 168 is updated
+    Then record 168 should be saved
+    But record 168 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 169
+    Given record 169 exists
+    And record 169 has value 1183
+    When record 169 is updated
+    Then record 169 should be saved
+    But record 169 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 170
+    Given record 170 exists
+    And record 170 has value 1190
+    When record 170 is updated
+    Then record 170 should be saved
+    But record 170 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 171
+    Given record 171 exists
+    And record 171 has value 1197
+    When record 171 is updated
+    Then record 171 should be saved
+    But record 171 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 172
+    Given record 172 exists
+    And record 172 has value 1204
+    When record 172 is updated
+    Then record 172 should be saved
+    But record 172 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 173
+    Given record 173 exists
+    And record 173 has value 1211
+    When record 173 is updated
+    Then record 173 should be saved
+    But record 173 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 174
+    Given record 174 exists
+    And record 174 has value 1218
+    When record 174 is updated
+    Then record 174 should be saved
+    But record 174 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 175
+    Given record 175 exists
+    And record 175 has value 1225
+    When record 175 is updated
+    Then record 175 should be saved
+    But record 175 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 176
+    Given record 176 exists
+    And record 176 has value 1232
+    When record 176 is updated
+    Then record 176 should be saved
+    But record 176 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 177
+    Given record 177 exists
+    And record 177 has value 1239
+    When record 177 is updated
+    Then record 177 should be saved
+    But record 177 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 178
+    Given record 178 exists
+    And record 178 has value 1246
+    When record 178 is updated
+    Then record 178 should be saved
+    But record 178 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 179
+    Given record 179 exists
+    And record 179 has value 1253
+    When record 179 is updated
+    Then record 179 should be saved
+    But record 179 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 180
+    Given record 180 exists
+    And record 180 has value 1260
+    When record 180 is updated
+    Then record 180 should be saved
+    But record 180 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 181
+    Given record 181 exists
+    And record 181 has value 1267
+    When record 181 is updated
+    Then record 181 should be saved
+    But record 181 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 182
+    Given record 182 exists
+    And record 182 has value 1274
+    When record 182 is updated
+    Then record 182 should be saved
+    But record 182 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 183
+    Given record 183 exists
+    And record 183 has value 1281
+    When record 183 is updated
+    Then record 183 should be saved
+    But record 183 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 184
+    Given record 184 exists
+    And record 184 has value 1288
+    When record 184 is updated
+    Then record 184 should be saved
+    But record 184 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 185
+    Given record 185 exists
+    And record 185 has value 1295
+    When record 185 is updated
+    Then record 185 should be saved
+    But record 185 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 186
+    Given record 186 exists
+    And record 186 has value 1302
+    When record 186 is updated
+    Then record 186 should be saved
+    But record 186 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 187
+    Given record 187 exists
+    And record 187 has value 1309
+    When record 187 is updated
+    Then record 187 should be saved
+    But record 187 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 188
+    Given record 188 exists
+    And record 188 has value 1316
+    When record 188 is updated
+    Then record 188 should be saved
+    But record 188 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 189
+    Given record 189 exists
+    And record 189 has value 1323
+    When record 189 is updated
+    Then record 189 should be saved
+    But record 189 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 190
+    Given record 190 exists
+    And record 190 has value 1330
+    When record 190 is updated
+    Then record 190 should be saved
+    But record 190 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 191
+    Given record 191 exists
+    And record 191 has value 1337
+    When record 191 is updated
+    Then record 191 should be saved
+    But record 191 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 192
+    Given record 192 exists
+    And record 192 has value 1344
+    When record 192 is updated
+    Then record 192 should be saved
+    But record 192 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 193
+    Given record 193 exists
+    And record 193 has value 1351
+    When record 193 is updated
+    Then record 193 should be saved
+    But record 193 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 194
+    Given record 194 exists
+    And record 194 has value 1358
+    When record 194 is updated
+    Then record 194 should be saved
+    But record 194 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 195
+    Given record 195 exists
+    And record 195 has value 1365
+    When record 195 is updated
+    Then record 195 should be saved
+    But record 195 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 196
+    Given record 196 exists
+    And record 196 has value 1372
+    When record 196 is updated
+    Then record 196 should be saved
+    But record 196 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 197
+    Given record 197 exists
+    And record 197 has value 1379
+    When record 197 is updated
+    Then record 197 should be saved
+    But record 197 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 198
+    Given record 198 exists
+    And record 198 has value 1386
+    When record 198 is updated
+    Then record 198 should be saved
+    But record 198 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 199
+    Given record 199 exists
+    And record 199 has value 1393
+    When record 199 is updated
+    Then record 199 should be saved
+    But record 199 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 200
+    Given record 200 exists
+    And record 200 has value 1400
+    When record 200 is updated
+    Then record 200 should be saved
+    But record 200 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 201
+    Given record 201 exists
+    And record 201 has value 1407
+    When record 201 is updated
+    Then record 201 should be saved
+    But record 201 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 202
+    Given record 202 exists
+    And record 202 has value 1414
+    When record 202 is updated
+    Then record 202 should be saved
+    But record 202 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 203
+    Given record 203 exists
+    And record 203 has value 1421
+    When record 203 is updated
+    Then record 203 should be saved
+    But record 203 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 204
+    Given record 204 exists
+    And record 204 has value 1428
+    When record 204 is updated
+    Then record 204 should be saved
+    But record 204 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 205
+    Given record 205 exists
+    And record 205 has value 1435
+    When record 205 is updated
+    Then record 205 should be saved
+    But record 205 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 206
+    Given record 206 exists
+    And record 206 has value 1442
+    When record 206 is updated
+    Then record 206 should be saved
+    But record 206 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 207
+    Given record 207 exists
+    And record 207 has value 1449
+    When record 207 is updated
+    Then record 207 should be saved
+    But record 207 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 208
+    Given record 208 exists
+    And record 208 has value 1456
+    When record 208 is updated
+    Then record 208 should be saved
+    But record 208 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 209
+    Given record 209 exists
+    And record 209 has value 1463
+    When record 209 is updated
+    Then record 209 should be saved
+    But record 209 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 210
+    Given record 210 exists
+    And record 210 has value 1470
+    When record 210 is updated
+    Then record 210 should be saved
+    But record 210 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 211
+    Given record 211 exists
+    And record 211 has value 1477
+    When record 211 is updated
+    Then record 211 should be saved
+    But record 211 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 212
+    Given record 212 exists
+    And record 212 has value 1484
+    When record 212 is updated
+    Then record 212 should be saved
+    But record 212 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 213
+    Given record 213 exists
+    And record 213 has value 1491
+    When record 213 is updated
+    Then record 213 should be saved
+    But record 213 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 214
+    Given record 214 exists
+    And record 214 has value 1498
+    When record 214 is updated
+    Then record 214 should be saved
+    But record 214 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 215
+    Given record 215 exists
+    And record 215 has value 1505
+    When record 215 is updated
+    Then record 215 should be saved
+    But record 215 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 216
+    Given record 216 exists
+    And record 216 has value 1512
+    When record 216 is updated
+    Then record 216 should be saved
+    But record 216 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 217
+    Given record 217 exists
+    And record 217 has value 1519
+    When record 217 is updated
+    Then record 217 should be saved
+    But record 217 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 218
+    Given record 218 exists
+    And record 218 has value 1526
+    When record 218 is updated
+    Then record 218 should be saved
+    But record 218 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 219
+    Given record 219 exists
+    And record 219 has value 1533
+    When record 219 is updated
+    Then record 219 should be saved
+    But record 219 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 220
+    Given record 220 exists
+    And record 220 has value 1540
+    When record 220 is updated
+    Then record 220 should be saved
+    But record 220 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 221
+    Given record 221 exists
+    And record 221 has value 1547
+    When record 221 is updated
+    Then record 221 should be saved
+    But record 221 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 222
+    Given record 222 exists
+    And record 222 has value 1554
+    When record 222 is updated
+    Then record 222 should be saved
+    But record 222 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 223
+    Given record 223 exists
+    And record 223 has value 1561
+    When record 223 is updated
+    Then record 223 should be saved
+    But record 223 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 224
+    Given record 224 exists
+    And record 224 has value 1568
+    When record 224 is updated
+    Then record 224 should be saved
+    But record 224 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 225
+    Given record 225 exists
+    And record 225 has value 1575
+    When record 225 is updated
+    Then record 225 should be saved
+    But record 225 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 226
+    Given record 226 exists
+    And record 226 has value 1582
+    When record 226 is updated
+    Then record 226 should be saved
+    But record 226 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 227
+    Given record 227 exists
+    And record 227 has value 1589
+    When record 227 is updated
+    Then record 227 should be saved
+    But record 227 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 228
+    Given record 228 exists
+    And record 228 has value 1596
+    When record 228 is updated
+    Then record 228 should be saved
+    But record 228 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 229
+    Given record 229 exists
+    And record 229 has value 1603
+    When record 229 is updated
+    Then record 229 should be saved
+    But record 229 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 230
+    Given record 230 exists
+    And record 230 has value 1610
+    When record 230 is updated
+    Then record 230 should be saved
+    But record 230 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 231
+    Given record 231 exists
+    And record 231 has value 1617
+    When record 231 is updated
+    Then record 231 should be saved
+    But record 231 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 232
+    Given record 232 exists
+    And record 232 has value 1624
+    When record 232 is updated
+    Then record 232 should be saved
+    But record 232 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 233
+    Given record 233 exists
+    And record 233 has value 1631
+    When record 233 is updated
+    Then record 233 should be saved
+    But record 233 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 234
+    Given record 234 exists
+    And record 234 has value 1638
+    When record 234 is updated
+    Then record 234 should be saved
+    But record 234 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 235
+    Given record 235 exists
+    And record 235 has value 1645
+    When record 235 is updated
+    Then record 235 should be saved
+    But record 235 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 236
+    Given record 236 exists
+    And record 236 has value 1652
+    When record 236 is updated
+    Then record 236 should be saved
+    But record 236 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 237
+    Given record 237 exists
+    And record 237 has value 1659
+    When record 237 is updated
+    Then record 237 should be saved
+    But record 237 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 238
+    Given record 238 exists
+    And record 238 has value 1666
+    When record 238 is updated
+    Then record 238 should be saved
+    But record 238 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 239
+    Given record 239 exists
+    And record 239 has value 1673
+    When record 239 is updated
+    Then record 239 should be saved
+    But record 239 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 240
+    Given record 240 exists
+    And record 240 has value 1680
+    When record 240 is updated
+    Then record 240 should be saved
+    But record 240 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 241
+    Given record 241 exists
+    And record 241 has value 1687
+    When record 241 is updated
+    Then record 241 should be saved
+    But record 241 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 242
+    Given record 242 exists
+    And record 242 has value 1694
+    When record 242 is updated
+    Then record 242 should be saved
+    But record 242 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 243
+    Given record 243 exists
+    And record 243 has value 1701
+    When record 243 is updated
+    Then record 243 should be saved
+    But record 243 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 244
+    Given record 244 exists
+    And record 244 has value 1708
+    When record 244 is updated
+    Then record 244 should be saved
+    But record 244 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 245
+    Given record 245 exists
+    And record 245 has value 1715
+    When record 245 is updated
+    Then record 245 should be saved
+    But record 245 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 246
+    Given record 246 exists
+    And record 246 has value 1722
+    When record 246 is updated
+    Then record 246 should be saved
+    But record 246 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 247
+    Given record 247 exists
+    And record 247 has value 1729
+    When record 247 is updated
+    Then record 247 should be saved
+    But record 247 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 248
+    Given record 248 exists
+    And record 248 has value 1736
+    When record 248 is updated
+    Then record 248 should be saved
+    But record 248 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 249
+    Given record 249 exists
+    And record 249 has value 1743
+    When record 249 is updated
+    Then record 249 should be saved
+    But record 249 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 250
+    Given record 250 exists
+    And record 250 has value 1750
+    When record 250 is updated
+    Then record 250 should be saved
+    But record 250 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 251
+    Given record 251 exists
+    And record 251 has value 1757
+    When record 251 is updated
+    Then record 251 should be saved
+    But record 251 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 252
+    Given record 252 exists
+    And record 252 has value 1764
+    When record 252 is updated
+    Then record 252 should be saved
+    But record 252 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 253
+    Given record 253 exists
+    And record 253 has value 1771
+    When record 253 is updated
+    Then record 253 should be saved
+    But record 253 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 254
+    Given record 254 exists
+    And record 254 has value 1778
+    When record 254 is updated
+    Then record 254 should be saved
+    But record 254 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 255
+    Given record 255 exists
+    And record 255 has value 1785
+    When record 255 is updated
+    Then record 255 should be saved
+    But record 255 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 256
+    Given record 256 exists
+    And record 256 has value 1792
+    When record 256 is updated
+    Then record 256 should be saved
+    But record 256 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 257
+    Given record 257 exists
+    And record 257 has value 1799
+    When record 257 is updated
+    Then record 257 should be saved
+    But record 257 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 258
+    Given record 258 exists
+    And record 258 has value 1806
+    When record 258 is updated
+    Then record 258 should be saved
+    But record 258 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 259
+    Given record 259 exists
+    And record 259 has value 1813
+    When record 259 is updated
+    Then record 259 should be saved
+    But record 259 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 260
+    Given record 260 exists
+    And record 260 has value 1820
+    When record 260 is updated
+    Then record 260 should be saved
+    But record 260 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 261
+    Given record 261 exists
+    And record 261 has value 1827
+    When record 261 is updated
+    Then record 261 should be saved
+    But record 261 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 262
+    Given record 262 exists
+    And record 262 has value 1834
+    When record 262 is updated
+    Then record 262 should be saved
+    But record 262 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 263
+    Given record 263 exists
+    And record 263 has value 1841
+    When record 263 is updated
+    Then record 263 should be saved
+    But record 263 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 264
+    Given record 264 exists
+    And record 264 has value 1848
+    When record 264 is updated
+    Then record 264 should be saved
+    But record 264 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 265
+    Given record 265 exists
+    And record 265 has value 1855
+    When record 265 is updated
+    Then record 265 should be saved
+    But record 265 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 266
+    Given record 266 exists
+    And record 266 has value 1862
+    When record 266 is updated
+    Then record 266 should be saved
+    But record 266 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 267
+    Given record 267 exists
+    And record 267 has value 1869
+    When record 267 is updated
+    Then record 267 should be saved
+    But record 267 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 268
+    Given record 268 exists
+    And record 268 has value 1876
+    When record 268 is updated
+    Then record 268 should be saved
+    But record 268 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 269
+    Given record 269 exists
+    And record 269 has value 1883
+    When record 269 is updated
+    Then record 269 should be saved
+    But record 269 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 270
+    Given record 270 exists
+    And record 270 has value 1890
+    When record 270 is updated
+    Then record 270 should be saved
+    But record 270 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 271
+    Given record 271 exists
+    And record 271 has value 1897
+    When record 271 is updated
+    Then record 271 should be saved
+    But record 271 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 272
+    Given record 272 exists
+    And record 272 has value 1904
+    When record 272 is updated
+    Then record 272 should be saved
+    But record 272 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 273
+    Given record 273 exists
+    And record 273 has value 1911
+    When record 273 is updated
+    Then record 273 should be saved
+    But record 273 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 274
+    Given record 274 exists
+    And record 274 has value 1918
+    When record 274 is updated
+    Then record 274 should be saved
+    But record 274 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 275
+    Given record 275 exists
+    And record 275 has value 1925
+    When record 275 is updated
+    Then record 275 should be saved
+    But record 275 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 276
+    Given record 276 exists
+    And record 276 has value 1932
+    When record 276 is updated
+    Then record 276 should be saved
+    But record 276 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 277
+    Given record 277 exists
+    And record 277 has value 1939
+    When record 277 is updated
+    Then record 277 should be saved
+    But record 277 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 278
+    Given record 278 exists
+    And record 278 has value 1946
+    When record 278 is updated
+    Then record 278 should be saved
+    But record 278 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 279
+    Given record 279 exists
+    And record 279 has value 1953
+    When record 279 is updated
+    Then record 279 should be saved
+    But record 279 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 280
+    Given record 280 exists
+    And record 280 has value 1960
+    When record 280 is updated
+    Then record 280 should be saved
+    But record 280 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 281
+    Given record 281 exists
+    And record 281 has value 1967
+    When record 281 is updated
+    Then record 281 should be saved
+    But record 281 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 282
+    Given record 282 exists
+    And record 282 has value 1974
+    When record 282 is updated
+    Then record 282 should be saved
+    But record 282 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 283
+    Given record 283 exists
+    And record 283 has value 1981
+    When record 283 is updated
+    Then record 283 should be saved
+    But record 283 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 284
+    Given record 284 exists
+    And record 284 has value 1988
+    When record 284 is updated
+    Then record 284 should be saved
+    But record 284 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 285
+    Given record 285 exists
+    And record 285 has value 1995
+    When record 285 is updated
+    Then record 285 should be saved
+    But record 285 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 286
+    Given record 286 exists
+    And record 286 has value 2002
+    When record 286 is updated
+    Then record 286 should be saved
+    But record 286 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 287
+    Given record 287 exists
+    And record 287 has value 2009
+    When record 287 is updated
+    Then record 287 should be saved
+    But record 287 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 288
+    Given record 288 exists
+    And record 288 has value 2016
+    When record 288 is updated
+    Then record 288 should be saved
+    But record 288 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 289
+    Given record 289 exists
+    And record 289 has value 2023
+    When record 289 is updated
+    Then record 289 should be saved
+    But record 289 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 290
+    Given record 290 exists
+    And record 290 has value 2030
+    When record 290 is updated
+    Then record 290 should be saved
+    But record 290 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 291
+    Given record 291 exists
+    And record 291 has value 2037
+    When record 291 is updated
+    Then record 291 should be saved
+    But record 291 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 292
+    Given record 292 exists
+    And record 292 has value 2044
+    When record 292 is updated
+    Then record 292 should be saved
+    But record 292 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 293
+    Given record 293 exists
+    And record 293 has value 2051
+    When record 293 is updated
+    Then record 293 should be saved
+    But record 293 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 294
+    Given record 294 exists
+    And record 294 has value 2058
+    When record 294 is updated
+    Then record 294 should be saved
+    But record 294 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 295
+    Given record 295 exists
+    And record 295 has value 2065
+    When record 295 is updated
+    Then record 295 should be saved
+    But record 295 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 296
+    Given record 296 exists
+    And record 296 has value 2072
+    When record 296 is updated
+    Then record 296 should be saved
+    But record 296 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 297
+    Given record 297 exists
+    And record 297 has value 2079
+    When record 297 is updated
+    Then record 297 should be saved
+    But record 297 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 298
+    Given record 298 exists
+    And record 298 has value 2086
+    When record 298 is updated
+    Then record 298 should be saved
+    But record 298 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 299
+    Given record 299 exists
+    And record 299 has value 2093
+    When record 299 is updated
+    Then record 299 should be saved
+    But record 299 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 300
+    Given record 300 exists
+    And record 300 has value 2100
+    When record 300 is updated
+    Then record 300 should be saved
+    But record 300 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 301
+    Given record 301 exists
+    And record 301 has value 2107
+    When record 301 is updated
+    Then record 301 should be saved
+    But record 301 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 302
+    Given record 302 exists
+    And record 302 has value 2114
+    When record 302 is updated
+    Then record 302 should be saved
+    But record 302 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 303
+    Given record 303 exists
+    And record 303 has value 2121
+    When record 303 is updated
+    Then record 303 should be saved
+    But record 303 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 304
+    Given record 304 exists
+    And record 304 has value 2128
+    When record 304 is updated
+    Then record 304 should be saved
+    But record 304 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 305
+    Given record 305 exists
+    And record 305 has value 2135
+    When record 305 is updated
+    Then record 305 should be saved
+    But record 305 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 306
+    Given record 306 exists
+    And record 306 has value 2142
+    When record 306 is updated
+    Then record 306 should be saved
+    But record 306 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 307
+    Given record 307 exists
+    And record 307 has value 2149
+    When record 307 is updated
+    Then record 307 should be saved
+    But record 307 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 308
+    Given record 308 exists
+    And record 308 has value 2156
+    When record 308 is updated
+    Then record 308 should be saved
+    But record 308 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 309
+    Given record 309 exists
+    And record 309 has value 2163
+    When record 309 is updated
+    Then record 309 should be saved
+    But record 309 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 310
+    Given record 310 exists
+    And record 310 has value 2170
+    When record 310 is updated
+    Then record 310 should be saved
+    But record 310 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 311
+    Given record 311 exists
+    And record 311 has value 2177
+    When record 311 is updated
+    Then record 311 should be saved
+    But record 311 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 312
+    Given record 312 exists
+    And record 312 has value 2184
+    When record 312 is updated
+    Then record 312 should be saved
+    But record 312 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 313
+    Given record 313 exists
+    And record 313 has value 2191
+    When record 313 is updated
+    Then record 313 should be saved
+    But record 313 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 314
+    Given record 314 exists
+    And record 314 has value 2198
+    When record 314 is updated
+    Then record 314 should be saved
+    But record 314 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 315
+    Given record 315 exists
+    And record 315 has value 2205
+    When record 315 is updated
+    Then record 315 should be saved
+    But record 315 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 316
+    Given record 316 exists
+    And record 316 has value 2212
+    When record 316 is updated
+    Then record 316 should be saved
+    But record 316 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 317
+    Given record 317 exists
+    And record 317 has value 2219
+    When record 317 is updated
+    Then record 317 should be saved
+    But record 317 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 318
+    Given record 318 exists
+    And record 318 has value 2226
+    When record 318 is updated
+    Then record 318 should be saved
+    But record 318 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 319
+    Given record 319 exists
+    And record 319 has value 2233
+    When record 319 is updated
+    Then record 319 should be saved
+    But record 319 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 320
+    Given record 320 exists
+    And record 320 has value 2240
+    When record 320 is updated
+    Then record 320 should be saved
+    But record 320 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 321
+    Given record 321 exists
+    And record 321 has value 2247
+    When record 321 is updated
+    Then record 321 should be saved
+    But record 321 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 322
+    Given record 322 exists
+    And record 322 has value 2254
+    When record 322 is updated
+    Then record 322 should be saved
+    But record 322 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 323
+    Given record 323 exists
+    And record 323 has value 2261
+    When record 323 is updated
+    Then record 323 should be saved
+    But record 323 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 324
+    Given record 324 exists
+    And record 324 has value 2268
+    When record 324 is updated
+    Then record 324 should be saved
+    But record 324 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 325
+    Given record 325 exists
+    And record 325 has value 2275
+    When record 325 is updated
+    Then record 325 should be saved
+    But record 325 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 326
+    Given record 326 exists
+    And record 326 has value 2282
+    When record 326 is updated
+    Then record 326 should be saved
+    But record 326 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 327
+    Given record 327 exists
+    And record 327 has value 2289
+    When record 327 is updated
+    Then record 327 should be saved
+    But record 327 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 328
+    Given record 328 exists
+    And record 328 has value 2296
+    When record 328 is updated
+    Then record 328 should be saved
+    But record 328 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 329
+    Given record 329 exists
+    And record 329 has value 2303
+    When record 329 is updated
+    Then record 329 should be saved
+    But record 329 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 330
+    Given record 330 exists
+    And record 330 has value 2310
+    When record 330 is updated
+    Then record 330 should be saved
+    But record 330 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 331
+    Given record 331 exists
+    And record 331 has value 2317
+    When record 331 is updated
+    Then record 331 should be saved
+    But record 331 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 332
+    Given record 332 exists
+    And record 332 has value 2324
+    When record 332 is updated
+    Then record 332 should be saved
+    But record 332 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 333
+    Given record 333 exists
+    And record 333 has value 2331
+    When record 333 is updated
+    Then record 333 should be saved
+    But record 333 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 334
+    Given record 334 exists
+    And record 334 has value 2338
+    When record 334 is updated
+    Then record 334 should be saved
+    But record 334 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 335
+    Given record 335 exists
+    And record 335 has value 2345
+    When record 335 is updated
+    Then record 335 should be saved
+    But record 335 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 336
+    Given record 336 exists
+    And record 336 has value 2352
+    When record 336 is updated
+    Then record 336 should be saved
+    But record 336 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 337
+    Given record 337 exists
+    And record 337 has value 2359
+    When record 337 is updated
+    Then record 337 should be saved
+    But record 337 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 338
+    Given record 338 exists
+    And record 338 has value 2366
+    When record 338 is updated
+    Then record 338 should be saved
+    But record 338 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 339
+    Given record 339 exists
+    And record 339 has value 2373
+    When record 339 is updated
+    Then record 339 should be saved
+    But record 339 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 340
+    Given record 340 exists
+    And record 340 has value 2380
+    When record 340 is updated
+    Then record 340 should be saved
+    But record 340 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 341
+    Given record 341 exists
+    And record 341 has value 2387
+    When record 341 is updated
+    Then record 341 should be saved
+    But record 341 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 342
+    Given record 342 exists
+    And record 342 has value 2394
+    When record 342 is updated
+    Then record 342 should be saved
+    But record 342 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 343
+    Given record 343 exists
+    And record 343 has value 2401
+    When record 343 is updated
+    Then record 343 should be saved
+    But record 343 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 344
+    Given record 344 exists
+    And record 344 has value 2408
+    When record 344 is updated
+    Then record 344 should be saved
+    But record 344 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 345
+    Given record 345 exists
+    And record 345 has value 2415
+    When record 345 is updated
+    Then record 345 should be saved
+    But record 345 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 346
+    Given record 346 exists
+    And record 346 has value 2422
+    When record 346 is updated
+    Then record 346 should be saved
+    But record 346 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 347
+    Given record 347 exists
+    And record 347 has value 2429
+    When record 347 is updated
+    Then record 347 should be saved
+    But record 347 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 348
+    Given record 348 exists
+    And record 348 has value 2436
+    When record 348 is updated
+    Then record 348 should be saved
+    But record 348 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 349
+    Given record 349 exists
+    And record 349 has value 2443
+    When record 349 is updated
+    Then record 349 should be saved
+    But record 349 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 350
+    Given record 350 exists
+    And record 350 has value 2450
+    When record 350 is updated
+    Then record 350 should be saved
+    But record 350 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 351
+    Given record 351 exists
+    And record 351 has value 2457
+    When record 351 is updated
+    Then record 351 should be saved
+    But record 351 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 352
+    Given record 352 exists
+    And record 352 has value 2464
+    When record 352 is updated
+    Then record 352 should be saved
+    But record 352 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 353
+    Given record 353 exists
+    And record 353 has value 2471
+    When record 353 is updated
+    Then record 353 should be saved
+    But record 353 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 354
+    Given record 354 exists
+    And record 354 has value 2478
+    When record 354 is updated
+    Then record 354 should be saved
+    But record 354 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 355
+    Given record 355 exists
+    And record 355 has value 2485
+    When record 355 is updated
+    Then record 355 should be saved
+    But record 355 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 356
+    Given record 356 exists
+    And record 356 has value 2492
+    When record 356 is updated
+    Then record 356 should be saved
+    But record 356 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 357
+    Given record 357 exists
+    And record 357 has value 2499
+    When record 357 is updated
+    Then record 357 should be saved
+    But record 357 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 358
+    Given record 358 exists
+    And record 358 has value 2506
+    When record 358 is updated
+    Then record 358 should be saved
+    But record 358 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 359
+    Given record 359 exists
+    And record 359 has value 2513
+    When record 359 is updated
+    Then record 359 should be saved
+    But record 359 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 360
+    Given record 360 exists
+    And record 360 has value 2520
+    When record 360 is updated
+    Then record 360 should be saved
+    But record 360 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 361
+    Given record 361 exists
+    And record 361 has value 2527
+    When record 361 is updated
+    Then record 361 should be saved
+    But record 361 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 362
+    Given record 362 exists
+    And record 362 has value 2534
+    When record 362 is updated
+    Then record 362 should be saved
+    But record 362 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 363
+    Given record 363 exists
+    And record 363 has value 2541
+    When record 363 is updated
+    Then record 363 should be saved
+    But record 363 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 364
+    Given record 364 exists
+    And record 364 has value 2548
+    When record 364 is updated
+    Then record 364 should be saved
+    But record 364 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 365
+    Given record 365 exists
+    And record 365 has value 2555
+    When record 365 is updated
+    Then record 365 should be saved
+    But record 365 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 366
+    Given record 366 exists
+    And record 366 has value 2562
+    When record 366 is updated
+    Then record 366 should be saved
+    But record 366 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 367
+    Given record 367 exists
+    And record 367 has value 2569
+    When record 367 is updated
+    Then record 367 should be saved
+    But record 367 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 368
+    Given record 368 exists
+    And record 368 has value 2576
+    When record 368 is updated
+    Then record 368 should be saved
+    But record 368 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 369
+    Given record 369 exists
+    And record 369 has value 2583
+    When record 369 is updated
+    Then record 369 should be saved
+    But record 369 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 370
+    Given record 370 exists
+    And record 370 has value 2590
+    When record 370 is updated
+    Then record 370 should be saved
+    But record 370 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 371
+    Given record 371 exists
+    And record 371 has value 2597
+    When record 371 is updated
+    Then record 371 should be saved
+    But record 371 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 372
+    Given record 372 exists
+    And record 372 has value 2604
+    When record 372 is updated
+    Then record 372 should be saved
+    But record 372 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 373
+    Given record 373 exists
+    And record 373 has value 2611
+    When record 373 is updated
+    Then record 373 should be saved
+    But record 373 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 374
+    Given record 374 exists
+    And record 374 has value 2618
+    When record 374 is updated
+    Then record 374 should be saved
+    But record 374 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 375
+    Given record 375 exists
+    And record 375 has value 2625
+    When record 375 is updated
+    Then record 375 should be saved
+    But record 375 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 376
+    Given record 376 exists
+    And record 376 has value 2632
+    When record 376 is updated
+    Then record 376 should be saved
+    But record 376 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 377
+    Given record 377 exists
+    And record 377 has value 2639
+    When record 377 is updated
+    Then record 377 should be saved
+    But record 377 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 378
+    Given record 378 exists
+    And record 378 has value 2646
+    When record 378 is updated
+    Then record 378 should be saved
+    But record 378 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 379
+    Given record 379 exists
+    And record 379 has value 2653
+    When record 379 is updated
+    Then record 379 should be saved
+    But record 379 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 380
+    Given record 380 exists
+    And record 380 has value 2660
+    When record 380 is updated
+    Then record 380 should be saved
+    But record 380 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 381
+    Given record 381 exists
+    And record 381 has value 2667
+    When record 381 is updated
+    Then record 381 should be saved
+    But record 381 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 382
+    Given record 382 exists
+    And record 382 has value 2674
+    When record 382 is updated
+    Then record 382 should be saved
+    But record 382 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 383
+    Given record 383 exists
+    And record 383 has value 2681
+    When record 383 is updated
+    Then record 383 should be saved
+    But record 383 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 384
+    Given record 384 exists
+    And record 384 has value 2688
+    When record 384 is updated
+    Then record 384 should be saved
+    But record 384 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 385
+    Given record 385 exists
+    And record 385 has value 2695
+    When record 385 is updated
+    Then record 385 should be saved
+    But record 385 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 386
+    Given record 386 exists
+    And record 386 has value 2702
+    When record 386 is updated
+    Then record 386 should be saved
+    But record 386 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 387
+    Given record 387 exists
+    And record 387 has value 2709
+    When record 387 is updated
+    Then record 387 should be saved
+    But record 387 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 388
+    Given record 388 exists
+    And record 388 has value 2716
+    When record 388 is updated
+    Then record 388 should be saved
+    But record 388 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 389
+    Given record 389 exists
+    And record 389 has value 2723
+    When record 389 is updated
+    Then record 389 should be saved
+    But record 389 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 390
+    Given record 390 exists
+    And record 390 has value 2730
+    When record 390 is updated
+    Then record 390 should be saved
+    But record 390 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 391
+    Given record 391 exists
+    And record 391 has value 2737
+    When record 391 is updated
+    Then record 391 should be saved
+    But record 391 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 392
+    Given record 392 exists
+    And record 392 has value 2744
+    When record 392 is updated
+    Then record 392 should be saved
+    But record 392 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 393
+    Given record 393 exists
+    And record 393 has value 2751
+    When record 393 is updated
+    Then record 393 should be saved
+    But record 393 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 394
+    Given record 394 exists
+    And record 394 has value 2758
+    When record 394 is updated
+    Then record 394 should be saved
+    But record 394 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 395
+    Given record 395 exists
+    And record 395 has value 2765
+    When record 395 is updated
+    Then record 395 should be saved
+    But record 395 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 396
+    Given record 396 exists
+    And record 396 has value 2772
+    When record 396 is updated
+    Then record 396 should be saved
+    But record 396 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 397
+    Given record 397 exists
+    And record 397 has value 2779
+    When record 397 is updated
+    Then record 397 should be saved
+    But record 397 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 398
+    Given record 398 exists
+    And record 398 has value 2786
+    When record 398 is updated
+    Then record 398 should be saved
+    But record 398 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 399
+    Given record 399 exists
+    And record 399 has value 2793
+    When record 399 is updated
+    Then record 399 should be saved
+    But record 399 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 400
+    Given record 400 exists
+    And record 400 has value 2800
+    When record 400 is updated
+    Then record 400 should be saved
+    But record 400 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 401
+    Given record 401 exists
+    And record 401 has value 2807
+    When record 401 is updated
+    Then record 401 should be saved
+    But record 401 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 402
+    Given record 402 exists
+    And record 402 has value 2814
+    When record 402 is updated
+    Then record 402 should be saved
+    But record 402 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 403
+    Given record 403 exists
+    And record 403 has value 2821
+    When record 403 is updated
+    Then record 403 should be saved
+    But record 403 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 404
+    Given record 404 exists
+    And record 404 has value 2828
+    When record 404 is updated
+    Then record 404 should be saved
+    But record 404 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 405
+    Given record 405 exists
+    And record 405 has value 2835
+    When record 405 is updated
+    Then record 405 should be saved
+    But record 405 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 406
+    Given record 406 exists
+    And record 406 has value 2842
+    When record 406 is updated
+    Then record 406 should be saved
+    But record 406 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 407
+    Given record 407 exists
+    And record 407 has value 2849
+    When record 407 is updated
+    Then record 407 should be saved
+    But record 407 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 408
+    Given record 408 exists
+    And record 408 has value 2856
+    When record 408 is updated
+    Then record 408 should be saved
+    But record 408 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 409
+    Given record 409 exists
+    And record 409 has value 2863
+    When record 409 is updated
+    Then record 409 should be saved
+    But record 409 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 410
+    Given record 410 exists
+    And record 410 has value 2870
+    When record 410 is updated
+    Then record 410 should be saved
+    But record 410 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 411
+    Given record 411 exists
+    And record 411 has value 2877
+    When record 411 is updated
+    Then record 411 should be saved
+    But record 411 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 412
+    Given record 412 exists
+    And record 412 has value 2884
+    When record 412 is updated
+    Then record 412 should be saved
+    But record 412 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 413
+    Given record 413 exists
+    And record 413 has value 2891
+    When record 413 is updated
+    Then record 413 should be saved
+    But record 413 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 414
+    Given record 414 exists
+    And record 414 has value 2898
+    When record 414 is updated
+    Then record 414 should be saved
+    But record 414 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 415
+    Given record 415 exists
+    And record 415 has value 2905
+    When record 415 is updated
+    Then record 415 should be saved
+    But record 415 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 416
+    Given record 416 exists
+    And record 416 has value 2912
+    When record 416 is updated
+    Then record 416 should be saved
+    But record 416 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 417
+    Given record 417 exists
+    And record 417 has value 2919
+    When record 417 is updated
+    Then record 417 should be saved
+    But record 417 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 418
+    Given record 418 exists
+    And record 418 has value 2926
+    When record 418 is updated
+    Then record 418 should be saved
+    But record 418 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 419
+    Given record 419 exists
+    And record 419 has value 2933
+    When record 419 is updated
+    Then record 419 should be saved
+    But record 419 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 420
+    Given record 420 exists
+    And record 420 has value 2940
+    When record 420 is updated
+    Then record 420 should be saved
+    But record 420 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 421
+    Given record 421 exists
+    And record 421 has value 2947
+    When record 421 is updated
+    Then record 421 should be saved
+    But record 421 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 422
+    Given record 422 exists
+    And record 422 has value 2954
+    When record 422 is updated
+    Then record 422 should be saved
+    But record 422 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 423
+    Given record 423 exists
+    And record 423 has value 2961
+    When record 423 is updated
+    Then record 423 should be saved
+    But record 423 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 424
+    Given record 424 exists
+    And record 424 has value 2968
+    When record 424 is updated
+    Then record 424 should be saved
+    But record 424 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 425
+    Given record 425 exists
+    And record 425 has value 2975
+    When record 425 is updated
+    Then record 425 should be saved
+    But record 425 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 426
+    Given record 426 exists
+    And record 426 has value 2982
+    When record 426 is updated
+    Then record 426 should be saved
+    But record 426 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 427
+    Given record 427 exists
+    And record 427 has value 2989
+    When record 427 is updated
+    Then record 427 should be saved
+    But record 427 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 428
+    Given record 428 exists
+    And record 428 has value 2996
+    When record 428 is updated
+    Then record 428 should be saved
+    But record 428 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 429
+    Given record 429 exists
+    And record 429 has value 3003
+    When record 429 is updated
+    Then record 429 should be saved
+    But record 429 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 430
+    Given record 430 exists
+    And record 430 has value 3010
+    When record 430 is updated
+    Then record 430 should be saved
+    But record 430 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 431
+    Given record 431 exists
+    And record 431 has value 3017
+    When record 431 is updated
+    Then record 431 should be saved
+    But record 431 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 432
+    Given record 432 exists
+    And record 432 has value 3024
+    When record 432 is updated
+    Then record 432 should be saved
+    But record 432 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 433
+    Given record 433 exists
+    And record 433 has value 3031
+    When record 433 is updated
+    Then record 433 should be saved
+    But record 433 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 434
+    Given record 434 exists
+    And record 434 has value 3038
+    When record 434 is updated
+    Then record 434 should be saved
+    But record 434 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 435
+    Given record 435 exists
+    And record 435 has value 3045
+    When record 435 is updated
+    Then record 435 should be saved
+    But record 435 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 436
+    Given record 436 exists
+    And record 436 has value 3052
+    When record 436 is updated
+    Then record 436 should be saved
+    But record 436 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 437
+    Given record 437 exists
+    And record 437 has value 3059
+    When record 437 is updated
+    Then record 437 should be saved
+    But record 437 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 438
+    Given record 438 exists
+    And record 438 has value 3066
+    When record 438 is updated
+    Then record 438 should be saved
+    But record 438 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 439
+    Given record 439 exists
+    And record 439 has value 3073
+    When record 439 is updated
+    Then record 439 should be saved
+    But record 439 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 440
+    Given record 440 exists
+    And record 440 has value 3080
+    When record 440 is updated
+    Then record 440 should be saved
+    But record 440 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 441
+    Given record 441 exists
+    And record 441 has value 3087
+    When record 441 is updated
+    Then record 441 should be saved
+    But record 441 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 442
+    Given record 442 exists
+    And record 442 has value 3094
+    When record 442 is updated
+    Then record 442 should be saved
+    But record 442 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 443
+    Given record 443 exists
+    And record 443 has value 3101
+    When record 443 is updated
+    Then record 443 should be saved
+    But record 443 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 444
+    Given record 444 exists
+    And record 444 has value 3108
+    When record 444 is updated
+    Then record 444 should be saved
+    But record 444 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 445
+    Given record 445 exists
+    And record 445 has value 3115
+    When record 445 is updated
+    Then record 445 should be saved
+    But record 445 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 446
+    Given record 446 exists
+    And record 446 has value 3122
+    When record 446 is updated
+    Then record 446 should be saved
+    But record 446 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 447
+    Given record 447 exists
+    And record 447 has value 3129
+    When record 447 is updated
+    Then record 447 should be saved
+    But record 447 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 448
+    Given record 448 exists
+    And record 448 has value 3136
+    When record 448 is updated
+    Then record 448 should be saved
+    But record 448 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 449
+    Given record 449 exists
+    And record 449 has value 3143
+    When record 449 is updated
+    Then record 449 should be saved
+    But record 449 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 450
+    Given record 450 exists
+    And record 450 has value 3150
+    When record 450 is updated
+    Then record 450 should be saved
+    But record 450 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 451
+    Given record 451 exists
+    And record 451 has value 3157
+    When record 451 is updated
+    Then record 451 should be saved
+    But record 451 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 452
+    Given record 452 exists
+    And record 452 has value 3164
+    When record 452 is updated
+    Then record 452 should be saved
+    But record 452 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 453
+    Given record 453 exists
+    And record 453 has value 3171
+    When record 453 is updated
+    Then record 453 should be saved
+    But record 453 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 454
+    Given record 454 exists
+    And record 454 has value 3178
+    When record 454 is updated
+    Then record 454 should be saved
+    But record 454 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 455
+    Given record 455 exists
+    And record 455 has value 3185
+    When record 455 is updated
+    Then record 455 should be saved
+    But record 455 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 456
+    Given record 456 exists
+    And record 456 has value 3192
+    When record 456 is updated
+    Then record 456 should be saved
+    But record 456 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 457
+    Given record 457 exists
+    And record 457 has value 3199
+    When record 457 is updated
+    Then record 457 should be saved
+    But record 457 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 458
+    Given record 458 exists
+    And record 458 has value 3206
+    When record 458 is updated
+    Then record 458 should be saved
+    But record 458 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 459
+    Given record 459 exists
+    And record 459 has value 3213
+    When record 459 is updated
+    Then record 459 should be saved
+    But record 459 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 460
+    Given record 460 exists
+    And record 460 has value 3220
+    When record 460 is updated
+    Then record 460 should be saved
+    But record 460 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 461
+    Given record 461 exists
+    And record 461 has value 3227
+    When record 461 is updated
+    Then record 461 should be saved
+    But record 461 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 462
+    Given record 462 exists
+    And record 462 has value 3234
+    When record 462 is updated
+    Then record 462 should be saved
+    But record 462 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 463
+    Given record 463 exists
+    And record 463 has value 3241
+    When record 463 is updated
+    Then record 463 should be saved
+    But record 463 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 464
+    Given record 464 exists
+    And record 464 has value 3248
+    When record 464 is updated
+    Then record 464 should be saved
+    But record 464 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 465
+    Given record 465 exists
+    And record 465 has value 3255
+    When record 465 is updated
+    Then record 465 should be saved
+    But record 465 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 466
+    Given record 466 exists
+    And record 466 has value 3262
+    When record 466 is updated
+    Then record 466 should be saved
+    But record 466 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 467
+    Given record 467 exists
+    And record 467 has value 3269
+    When record 467 is updated
+    Then record 467 should be saved
+    But record 467 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 468
+    Given record 468 exists
+    And record 468 has value 3276
+    When record 468 is updated
+    Then record 468 should be saved
+    But record 468 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 469
+    Given record 469 exists
+    And record 469 has value 3283
+    When record 469 is updated
+    Then record 469 should be saved
+    But record 469 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 470
+    Given record 470 exists
+    And record 470 has value 3290
+    When record 470 is updated
+    Then record 470 should be saved
+    But record 470 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 471
+    Given record 471 exists
+    And record 471 has value 3297
+    When record 471 is updated
+    Then record 471 should be saved
+    But record 471 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 472
+    Given record 472 exists
+    And record 472 has value 3304
+    When record 472 is updated
+    Then record 472 should be saved
+    But record 472 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 473
+    Given record 473 exists
+    And record 473 has value 3311
+    When record 473 is updated
+    Then record 473 should be saved
+    But record 473 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 474
+    Given record 474 exists
+    And record 474 has value 3318
+    When record 474 is updated
+    Then record 474 should be saved
+    But record 474 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 475
+    Given record 475 exists
+    And record 475 has value 3325
+    When record 475 is updated
+    Then record 475 should be saved
+    But record 475 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 476
+    Given record 476 exists
+    And record 476 has value 3332
+    When record 476 is updated
+    Then record 476 should be saved
+    But record 476 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 477
+    Given record 477 exists
+    And record 477 has value 3339
+    When record 477 is updated
+    Then record 477 should be saved
+    But record 477 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 478
+    Given record 478 exists
+    And record 478 has value 3346
+    When record 478 is updated
+    Then record 478 should be saved
+    But record 478 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 479
+    Given record 479 exists
+    And record 479 has value 3353
+    When record 479 is updated
+    Then record 479 should be saved
+    But record 479 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 480
+    Given record 480 exists
+    And record 480 has value 3360
+    When record 480 is updated
+    Then record 480 should be saved
+    But record 480 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 481
+    Given record 481 exists
+    And record 481 has value 3367
+    When record 481 is updated
+    Then record 481 should be saved
+    But record 481 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 482
+    Given record 482 exists
+    And record 482 has value 3374
+    When record 482 is updated
+    Then record 482 should be saved
+    But record 482 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 483
+    Given record 483 exists
+    And record 483 has value 3381
+    When record 483 is updated
+    Then record 483 should be saved
+    But record 483 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 484
+    Given record 484 exists
+    And record 484 has value 3388
+    When record 484 is updated
+    Then record 484 should be saved
+    But record 484 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 485
+    Given record 485 exists
+    And record 485 has value 3395
+    When record 485 is updated
+    Then record 485 should be saved
+    But record 485 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 486
+    Given record 486 exists
+    And record 486 has value 3402
+    When record 486 is updated
+    Then record 486 should be saved
+    But record 486 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 487
+    Given record 487 exists
+    And record 487 has value 3409
+    When record 487 is updated
+    Then record 487 should be saved
+    But record 487 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 488
+    Given record 488 exists
+    And record 488 has value 3416
+    When record 488 is updated
+    Then record 488 should be saved
+    But record 488 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 489
+    Given record 489 exists
+    And record 489 has value 3423
+    When record 489 is updated
+    Then record 489 should be saved
+    But record 489 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 490
+    Given record 490 exists
+    And record 490 has value 3430
+    When record 490 is updated
+    Then record 490 should be saved
+    But record 490 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 491
+    Given record 491 exists
+    And record 491 has value 3437
+    When record 491 is updated
+    Then record 491 should be saved
+    But record 491 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 492
+    Given record 492 exists
+    And record 492 has value 3444
+    When record 492 is updated
+    Then record 492 should be saved
+    But record 492 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 493
+    Given record 493 exists
+    And record 493 has value 3451
+    When record 493 is updated
+    Then record 493 should be saved
+    But record 493 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 494
+    Given record 494 exists
+    And record 494 has value 3458
+    When record 494 is updated
+    Then record 494 should be saved
+    But record 494 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 495
+    Given record 495 exists
+    And record 495 has value 3465
+    When record 495 is updated
+    Then record 495 should be saved
+    But record 495 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 496
+    Given record 496 exists
+    And record 496 has value 3472
+    When record 496 is updated
+    Then record 496 should be saved
+    But record 496 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 497
+    Given record 497 exists
+    And record 497 has value 3479
+    When record 497 is updated
+    Then record 497 should be saved
+    But record 497 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 498
+    Given record 498 exists
+    And record 498 has value 3486
+    When record 498 is updated
+    Then record 498 should be saved
+    But record 498 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 499
+    Given record 499 exists
+    And record 499 has value 3493
+    When record 499 is updated
+    Then record 499 should be saved
+    But record 499 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 500
+    Given record 500 exists
+    And record 500 has value 3500
+    When record 500 is updated
+    Then record 500 should be saved
+    But record 500 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 501
+    Given record 501 exists
+    And record 501 has value 3507
+    When record 501 is updated
+    Then record 501 should be saved
+    But record 501 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 502
+    Given record 502 exists
+    And record 502 has value 3514
+    When record 502 is updated
+    Then record 502 should be saved
+    But record 502 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 503
+    Given record 503 exists
+    And record 503 has value 3521
+    When record 503 is updated
+    Then record 503 should be saved
+    But record 503 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 504
+    Given record 504 exists
+    And record 504 has value 3528
+    When record 504 is updated
+    Then record 504 should be saved
+    But record 504 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 505
+    Given record 505 exists
+    And record 505 has value 3535
+    When record 505 is updated
+    Then record 505 should be saved
+    But record 505 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 506
+    Given record 506 exists
+    And record 506 has value 3542
+    When record 506 is updated
+    Then record 506 should be saved
+    But record 506 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 507
+    Given record 507 exists
+    And record 507 has value 3549
+    When record 507 is updated
+    Then record 507 should be saved
+    But record 507 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 508
+    Given record 508 exists
+    And record 508 has value 3556
+    When record 508 is updated
+    Then record 508 should be saved
+    But record 508 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 509
+    Given record 509 exists
+    And record 509 has value 3563
+    When record 509 is updated
+    Then record 509 should be saved
+    But record 509 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 510
+    Given record 510 exists
+    And record 510 has value 3570
+    When record 510 is updated
+    Then record 510 should be saved
+    But record 510 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 511
+    Given record 511 exists
+    And record 511 has value 3577
+    When record 511 is updated
+    Then record 511 should be saved
+    But record 511 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 512
+    Given record 512 exists
+    And record 512 has value 3584
+    When record 512 is updated
+    Then record 512 should be saved
+    But record 512 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 513
+    Given record 513 exists
+    And record 513 has value 3591
+    When record 513 is updated
+    Then record 513 should be saved
+    But record 513 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 514
+    Given record 514 exists
+    And record 514 has value 3598
+    When record 514 is updated
+    Then record 514 should be saved
+    But record 514 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 515
+    Given record 515 exists
+    And record 515 has value 3605
+    When record 515 is updated
+    Then record 515 should be saved
+    But record 515 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 516
+    Given record 516 exists
+    And record 516 has value 3612
+    When record 516 is updated
+    Then record 516 should be saved
+    But record 516 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 517
+    Given record 517 exists
+    And record 517 has value 3619
+    When record 517 is updated
+    Then record 517 should be saved
+    But record 517 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 518
+    Given record 518 exists
+    And record 518 has value 3626
+    When record 518 is updated
+    Then record 518 should be saved
+    But record 518 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 519
+    Given record 519 exists
+    And record 519 has value 3633
+    When record 519 is updated
+    Then record 519 should be saved
+    But record 519 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 520
+    Given record 520 exists
+    And record 520 has value 3640
+    When record 520 is updated
+    Then record 520 should be saved
+    But record 520 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 521
+    Given record 521 exists
+    And record 521 has value 3647
+    When record 521 is updated
+    Then record 521 should be saved
+    But record 521 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 522
+    Given record 522 exists
+    And record 522 has value 3654
+    When record 522 is updated
+    Then record 522 should be saved
+    But record 522 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 523
+    Given record 523 exists
+    And record 523 has value 3661
+    When record 523 is updated
+    Then record 523 should be saved
+    But record 523 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 524
+    Given record 524 exists
+    And record 524 has value 3668
+    When record 524 is updated
+    Then record 524 should be saved
+    But record 524 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 525
+    Given record 525 exists
+    And record 525 has value 3675
+    When record 525 is updated
+    Then record 525 should be saved
+    But record 525 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 526
+    Given record 526 exists
+    And record 526 has value 3682
+    When record 526 is updated
+    Then record 526 should be saved
+    But record 526 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 527
+    Given record 527 exists
+    And record 527 has value 3689
+    When record 527 is updated
+    Then record 527 should be saved
+    But record 527 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 528
+    Given record 528 exists
+    And record 528 has value 3696
+    When record 528 is updated
+    Then record 528 should be saved
+    But record 528 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 529
+    Given record 529 exists
+    And record 529 has value 3703
+    When record 529 is updated
+    Then record 529 should be saved
+    But record 529 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 530
+    Given record 530 exists
+    And record 530 has value 3710
+    When record 530 is updated
+    Then record 530 should be saved
+    But record 530 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 531
+    Given record 531 exists
+    And record 531 has value 3717
+    When record 531 is updated
+    Then record 531 should be saved
+    But record 531 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 532
+    Given record 532 exists
+    And record 532 has value 3724
+    When record 532 is updated
+    Then record 532 should be saved
+    But record 532 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 533
+    Given record 533 exists
+    And record 533 has value 3731
+    When record 533 is updated
+    Then record 533 should be saved
+    But record 533 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 534
+    Given record 534 exists
+    And record 534 has value 3738
+    When record 534 is updated
+    Then record 534 should be saved
+    But record 534 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 535
+    Given record 535 exists
+    And record 535 has value 3745
+    When record 535 is updated
+    Then record 535 should be saved
+    But record 535 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 536
+    Given record 536 exists
+    And record 536 has value 3752
+    When record 536 is updated
+    Then record 536 should be saved
+    But record 536 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 537
+    Given record 537 exists
+    And record 537 has value 3759
+    When record 537 is updated
+    Then record 537 should be saved
+    But record 537 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 538
+    Given record 538 exists
+    And record 538 has value 3766
+    When record 538 is updated
+    Then record 538 should be saved
+    But record 538 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 539
+    Given record 539 exists
+    And record 539 has value 3773
+    When record 539 is updated
+    Then record 539 should be saved
+    But record 539 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 540
+    Given record 540 exists
+    And record 540 has value 3780
+    When record 540 is updated
+    Then record 540 should be saved
+    But record 540 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 541
+    Given record 541 exists
+    And record 541 has value 3787
+    When record 541 is updated
+    Then record 541 should be saved
+    But record 541 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 542
+    Given record 542 exists
+    And record 542 has value 3794
+    When record 542 is updated
+    Then record 542 should be saved
+    But record 542 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 543
+    Given record 543 exists
+    And record 543 has value 3801
+    When record 543 is updated
+    Then record 543 should be saved
+    But record 543 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 544
+    Given record 544 exists
+    And record 544 has value 3808
+    When record 544 is updated
+    Then record 544 should be saved
+    But record 544 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 545
+    Given record 545 exists
+    And record 545 has value 3815
+    When record 545 is updated
+    Then record 545 should be saved
+    But record 545 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 546
+    Given record 546 exists
+    And record 546 has value 3822
+    When record 546 is updated
+    Then record 546 should be saved
+    But record 546 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 547
+    Given record 547 exists
+    And record 547 has value 3829
+    When record 547 is updated
+    Then record 547 should be saved
+    But record 547 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 548
+    Given record 548 exists
+    And record 548 has value 3836
+    When record 548 is updated
+    Then record 548 should be saved
+    But record 548 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 549
+    Given record 549 exists
+    And record 549 has value 3843
+    When record 549 is updated
+    Then record 549 should be saved
+    But record 549 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 550
+    Given record 550 exists
+    And record 550 has value 3850
+    When record 550 is updated
+    Then record 550 should be saved
+    But record 550 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 551
+    Given record 551 exists
+    And record 551 has value 3857
+    When record 551 is updated
+    Then record 551 should be saved
+    But record 551 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 552
+    Given record 552 exists
+    And record 552 has value 3864
+    When record 552 is updated
+    Then record 552 should be saved
+    But record 552 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 553
+    Given record 553 exists
+    And record 553 has value 3871
+    When record 553 is updated
+    Then record 553 should be saved
+    But record 553 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 554
+    Given record 554 exists
+    And record 554 has value 3878
+    When record 554 is updated
+    Then record 554 should be saved
+    But record 554 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 555
+    Given record 555 exists
+    And record 555 has value 3885
+    When record 555 is updated
+    Then record 555 should be saved
+    But record 555 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 556
+    Given record 556 exists
+    And record 556 has value 3892
+    When record 556 is updated
+    Then record 556 should be saved
+    But record 556 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 557
+    Given record 557 exists
+    And record 557 has value 3899
+    When record 557 is updated
+    Then record 557 should be saved
+    But record 557 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 558
+    Given record 558 exists
+    And record 558 has value 3906
+    When record 558 is updated
+    Then record 558 should be saved
+    But record 558 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 559
+    Given record 559 exists
+    And record 559 has value 3913
+    When record 559 is updated
+    Then record 559 should be saved
+    But record 559 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 560
+    Given record 560 exists
+    And record 560 has value 3920
+    When record 560 is updated
+    Then record 560 should be saved
+    But record 560 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 561
+    Given record 561 exists
+    And record 561 has value 3927
+    When record 561 is updated
+    Then record 561 should be saved
+    But record 561 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 562
+    Given record 562 exists
+    And record 562 has value 3934
+    When record 562 is updated
+    Then record 562 should be saved
+    But record 562 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 563
+    Given record 563 exists
+    And record 563 has value 3941
+    When record 563 is updated
+    Then record 563 should be saved
+    But record 563 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 564
+    Given record 564 exists
+    And record 564 has value 3948
+    When record 564 is updated
+    Then record 564 should be saved
+    But record 564 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 565
+    Given record 565 exists
+    And record 565 has value 3955
+    When record 565 is updated
+    Then record 565 should be saved
+    But record 565 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 566
+    Given record 566 exists
+    And record 566 has value 3962
+    When record 566 is updated
+    Then record 566 should be saved
+    But record 566 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 567
+    Given record 567 exists
+    And record 567 has value 3969
+    When record 567 is updated
+    Then record 567 should be saved
+    But record 567 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 568
+    Given record 568 exists
+    And record 568 has value 3976
+    When record 568 is updated
+    Then record 568 should be saved
+    But record 568 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 569
+    Given record 569 exists
+    And record 569 has value 3983
+    When record 569 is updated
+    Then record 569 should be saved
+    But record 569 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 570
+    Given record 570 exists
+    And record 570 has value 3990
+    When record 570 is updated
+    Then record 570 should be saved
+    But record 570 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 571
+    Given record 571 exists
+    And record 571 has value 3997
+    When record 571 is updated
+    Then record 571 should be saved
+    But record 571 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 572
+    Given record 572 exists
+    And record 572 has value 4004
+    When record 572 is updated
+    Then record 572 should be saved
+    But record 572 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 573
+    Given record 573 exists
+    And record 573 has value 4011
+    When record 573 is updated
+    Then record 573 should be saved
+    But record 573 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 574
+    Given record 574 exists
+    And record 574 has value 4018
+    When record 574 is updated
+    Then record 574 should be saved
+    But record 574 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 575
+    Given record 575 exists
+    And record 575 has value 4025
+    When record 575 is updated
+    Then record 575 should be saved
+    But record 575 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 576
+    Given record 576 exists
+    And record 576 has value 4032
+    When record 576 is updated
+    Then record 576 should be saved
+    But record 576 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 577
+    Given record 577 exists
+    And record 577 has value 4039
+    When record 577 is updated
+    Then record 577 should be saved
+    But record 577 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 578
+    Given record 578 exists
+    And record 578 has value 4046
+    When record 578 is updated
+    Then record 578 should be saved
+    But record 578 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 579
+    Given record 579 exists
+    And record 579 has value 4053
+    When record 579 is updated
+    Then record 579 should be saved
+    But record 579 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 580
+    Given record 580 exists
+    And record 580 has value 4060
+    When record 580 is updated
+    Then record 580 should be saved
+    But record 580 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 581
+    Given record 581 exists
+    And record 581 has value 4067
+    When record 581 is updated
+    Then record 581 should be saved
+    But record 581 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 582
+    Given record 582 exists
+    And record 582 has value 4074
+    When record 582 is updated
+    Then record 582 should be saved
+    But record 582 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 583
+    Given record 583 exists
+    And record 583 has value 4081
+    When record 583 is updated
+    Then record 583 should be saved
+    But record 583 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 584
+    Given record 584 exists
+    And record 584 has value 4088
+    When record 584 is updated
+    Then record 584 should be saved
+    But record 584 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 585
+    Given record 585 exists
+    And record 585 has value 4095
+    When record 585 is updated
+    Then record 585 should be saved
+    But record 585 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 586
+    Given record 586 exists
+    And record 586 has value 4102
+    When record 586 is updated
+    Then record 586 should be saved
+    But record 586 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 587
+    Given record 587 exists
+    And record 587 has value 4109
+    When record 587 is updated
+    Then record 587 should be saved
+    But record 587 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 588
+    Given record 588 exists
+    And record 588 has value 4116
+    When record 588 is updated
+    Then record 588 should be saved
+    But record 588 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 589
+    Given record 589 exists
+    And record 589 has value 4123
+    When record 589 is updated
+    Then record 589 should be saved
+    But record 589 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 590
+    Given record 590 exists
+    And record 590 has value 4130
+    When record 590 is updated
+    Then record 590 should be saved
+    But record 590 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 591
+    Given record 591 exists
+    And record 591 has value 4137
+    When record 591 is updated
+    Then record 591 should be saved
+    But record 591 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 592
+    Given record 592 exists
+    And record 592 has value 4144
+    When record 592 is updated
+    Then record 592 should be saved
+    But record 592 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 593
+    Given record 593 exists
+    And record 593 has value 4151
+    When record 593 is updated
+    Then record 593 should be saved
+    But record 593 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 594
+    Given record 594 exists
+    And record 594 has value 4158
+    When record 594 is updated
+    Then record 594 should be saved
+    But record 594 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 595
+    Given record 595 exists
+    And record 595 has value 4165
+    When record 595 is updated
+    Then record 595 should be saved
+    But record 595 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 596
+    Given record 596 exists
+    And record 596 has value 4172
+    When record 596 is updated
+    Then record 596 should be saved
+    But record 596 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 597
+    Given record 597 exists
+    And record 597 has value 4179
+    When record 597 is updated
+    Then record 597 should be saved
+    But record 597 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 598
+    Given record 598 exists
+    And record 598 has value 4186
+    When record 598 is updated
+    Then record 598 should be saved
+    But record 598 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 599
+    Given record 599 exists
+    And record 599 has value 4193
+    When record 599 is updated
+    Then record 599 should be saved
+    But record 599 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 600
+    Given record 600 exists
+    And record 600 has value 4200
+    When record 600 is updated
+    Then record 600 should be saved
+    But record 600 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 601
+    Given record 601 exists
+    And record 601 has value 4207
+    When record 601 is updated
+    Then record 601 should be saved
+    But record 601 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 602
+    Given record 602 exists
+    And record 602 has value 4214
+    When record 602 is updated
+    Then record 602 should be saved
+    But record 602 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 603
+    Given record 603 exists
+    And record 603 has value 4221
+    When record 603 is updated
+    Then record 603 should be saved
+    But record 603 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 604
+    Given record 604 exists
+    And record 604 has value 4228
+    When record 604 is updated
+    Then record 604 should be saved
+    But record 604 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 605
+    Given record 605 exists
+    And record 605 has value 4235
+    When record 605 is updated
+    Then record 605 should be saved
+    But record 605 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 606
+    Given record 606 exists
+    And record 606 has value 4242
+    When record 606 is updated
+    Then record 606 should be saved
+    But record 606 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 607
+    Given record 607 exists
+    And record 607 has value 4249
+    When record 607 is updated
+    Then record 607 should be saved
+    But record 607 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 608
+    Given record 608 exists
+    And record 608 has value 4256
+    When record 608 is updated
+    Then record 608 should be saved
+    But record 608 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 609
+    Given record 609 exists
+    And record 609 has value 4263
+    When record 609 is updated
+    Then record 609 should be saved
+    But record 609 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 610
+    Given record 610 exists
+    And record 610 has value 4270
+    When record 610 is updated
+    Then record 610 should be saved
+    But record 610 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 611
+    Given record 611 exists
+    And record 611 has value 4277
+    When record 611 is updated
+    Then record 611 should be saved
+    But record 611 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 612
+    Given record 612 exists
+    And record 612 has value 4284
+    When record 612 is updated
+    Then record 612 should be saved
+    But record 612 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 613
+    Given record 613 exists
+    And record 613 has value 4291
+    When record 613 is updated
+    Then record 613 should be saved
+    But record 613 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 614
+    Given record 614 exists
+    And record 614 has value 4298
+    When record 614 is updated
+    Then record 614 should be saved
+    But record 614 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 615
+    Given record 615 exists
+    And record 615 has value 4305
+    When record 615 is updated
+    Then record 615 should be saved
+    But record 615 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 616
+    Given record 616 exists
+    And record 616 has value 4312
+    When record 616 is updated
+    Then record 616 should be saved
+    But record 616 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 617
+    Given record 617 exists
+    And record 617 has value 4319
+    When record 617 is updated
+    Then record 617 should be saved
+    But record 617 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 618
+    Given record 618 exists
+    And record 618 has value 4326
+    When record 618 is updated
+    Then record 618 should be saved
+    But record 618 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 619
+    Given record 619 exists
+    And record 619 has value 4333
+    When record 619 is updated
+    Then record 619 should be saved
+    But record 619 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 620
+    Given record 620 exists
+    And record 620 has value 4340
+    When record 620 is updated
+    Then record 620 should be saved
+    But record 620 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 621
+    Given record 621 exists
+    And record 621 has value 4347
+    When record 621 is updated
+    Then record 621 should be saved
+    But record 621 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 622
+    Given record 622 exists
+    And record 622 has value 4354
+    When record 622 is updated
+    Then record 622 should be saved
+    But record 622 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 623
+    Given record 623 exists
+    And record 623 has value 4361
+    When record 623 is updated
+    Then record 623 should be saved
+    But record 623 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 624
+    Given record 624 exists
+    And record 624 has value 4368
+    When record 624 is updated
+    Then record 624 should be saved
+    But record 624 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 625
+    Given record 625 exists
+    And record 625 has value 4375
+    When record 625 is updated
+    Then record 625 should be saved
+    But record 625 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 626
+    Given record 626 exists
+    And record 626 has value 4382
+    When record 626 is updated
+    Then record 626 should be saved
+    But record 626 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 627
+    Given record 627 exists
+    And record 627 has value 4389
+    When record 627 is updated
+    Then record 627 should be saved
+    But record 627 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 628
+    Given record 628 exists
+    And record 628 has value 4396
+    When record 628 is updated
+    Then record 628 should be saved
+    But record 628 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 629
+    Given record 629 exists
+    And record 629 has value 4403
+    When record 629 is updated
+    Then record 629 should be saved
+    But record 629 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 630
+    Given record 630 exists
+    And record 630 has value 4410
+    When record 630 is updated
+    Then record 630 should be saved
+    But record 630 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 631
+    Given record 631 exists
+    And record 631 has value 4417
+    When record 631 is updated
+    Then record 631 should be saved
+    But record 631 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 632
+    Given record 632 exists
+    And record 632 has value 4424
+    When record 632 is updated
+    Then record 632 should be saved
+    But record 632 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 633
+    Given record 633 exists
+    And record 633 has value 4431
+    When record 633 is updated
+    Then record 633 should be saved
+    But record 633 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 634
+    Given record 634 exists
+    And record 634 has value 4438
+    When record 634 is updated
+    Then record 634 should be saved
+    But record 634 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 635
+    Given record 635 exists
+    And record 635 has value 4445
+    When record 635 is updated
+    Then record 635 should be saved
+    But record 635 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 636
+    Given record 636 exists
+    And record 636 has value 4452
+    When record 636 is updated
+    Then record 636 should be saved
+    But record 636 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 637
+    Given record 637 exists
+    And record 637 has value 4459
+    When record 637 is updated
+    Then record 637 should be saved
+    But record 637 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 638
+    Given record 638 exists
+    And record 638 has value 4466
+    When record 638 is updated
+    Then record 638 should be saved
+    But record 638 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 639
+    Given record 639 exists
+    And record 639 has value 4473
+    When record 639 is updated
+    Then record 639 should be saved
+    But record 639 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 640
+    Given record 640 exists
+    And record 640 has value 4480
+    When record 640 is updated
+    Then record 640 should be saved
+    But record 640 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 641
+    Given record 641 exists
+    And record 641 has value 4487
+    When record 641 is updated
+    Then record 641 should be saved
+    But record 641 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 642
+    Given record 642 exists
+    And record 642 has value 4494
+    When record 642 is updated
+    Then record 642 should be saved
+    But record 642 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 643
+    Given record 643 exists
+    And record 643 has value 4501
+    When record 643 is updated
+    Then record 643 should be saved
+    But record 643 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 644
+    Given record 644 exists
+    And record 644 has value 4508
+    When record 644 is updated
+    Then record 644 should be saved
+    But record 644 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 645
+    Given record 645 exists
+    And record 645 has value 4515
+    When record 645 is updated
+    Then record 645 should be saved
+    But record 645 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 646
+    Given record 646 exists
+    And record 646 has value 4522
+    When record 646 is updated
+    Then record 646 should be saved
+    But record 646 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 647
+    Given record 647 exists
+    And record 647 has value 4529
+    When record 647 is updated
+    Then record 647 should be saved
+    But record 647 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 648
+    Given record 648 exists
+    And record 648 has value 4536
+    When record 648 is updated
+    Then record 648 should be saved
+    But record 648 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 649
+    Given record 649 exists
+    And record 649 has value 4543
+    When record 649 is updated
+    Then record 649 should be saved
+    But record 649 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 650
+    Given record 650 exists
+    And record 650 has value 4550
+    When record 650 is updated
+    Then record 650 should be saved
+    But record 650 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 651
+    Given record 651 exists
+    And record 651 has value 4557
+    When record 651 is updated
+    Then record 651 should be saved
+    But record 651 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 652
+    Given record 652 exists
+    And record 652 has value 4564
+    When record 652 is updated
+    Then record 652 should be saved
+    But record 652 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 653
+    Given record 653 exists
+    And record 653 has value 4571
+    When record 653 is updated
+    Then record 653 should be saved
+    But record 653 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 654
+    Given record 654 exists
+    And record 654 has value 4578
+    When record 654 is updated
+    Then record 654 should be saved
+    But record 654 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 655
+    Given record 655 exists
+    And record 655 has value 4585
+    When record 655 is updated
+    Then record 655 should be saved
+    But record 655 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 656
+    Given record 656 exists
+    And record 656 has value 4592
+    When record 656 is updated
+    Then record 656 should be saved
+    But record 656 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 657
+    Given record 657 exists
+    And record 657 has value 4599
+    When record 657 is updated
+    Then record 657 should be saved
+    But record 657 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 658
+    Given record 658 exists
+    And record 658 has value 4606
+    When record 658 is updated
+    Then record 658 should be saved
+    But record 658 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 659
+    Given record 659 exists
+    And record 659 has value 4613
+    When record 659 is updated
+    Then record 659 should be saved
+    But record 659 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 660
+    Given record 660 exists
+    And record 660 has value 4620
+    When record 660 is updated
+    Then record 660 should be saved
+    But record 660 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 661
+    Given record 661 exists
+    And record 661 has value 4627
+    When record 661 is updated
+    Then record 661 should be saved
+    But record 661 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 662
+    Given record 662 exists
+    And record 662 has value 4634
+    When record 662 is updated
+    Then record 662 should be saved
+    But record 662 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 663
+    Given record 663 exists
+    And record 663 has value 4641
+    When record 663 is updated
+    Then record 663 should be saved
+    But record 663 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 664
+    Given record 664 exists
+    And record 664 has value 4648
+    When record 664 is updated
+    Then record 664 should be saved
+    But record 664 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 665
+    Given record 665 exists
+    And record 665 has value 4655
+    When record 665 is updated
+    Then record 665 should be saved
+    But record 665 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 666
+    Given record 666 exists
+    And record 666 has value 4662
+    When record 666 is updated
+    Then record 666 should be saved
+    But record 666 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 667
+    Given record 667 exists
+    And record 667 has value 4669
+    When record 667 is updated
+    Then record 667 should be saved
+    But record 667 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 668
+    Given record 668 exists
+    And record 668 has value 4676
+    When record 668 is updated
+    Then record 668 should be saved
+    But record 668 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 669
+    Given record 669 exists
+    And record 669 has value 4683
+    When record 669 is updated
+    Then record 669 should be saved
+    But record 669 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 670
+    Given record 670 exists
+    And record 670 has value 4690
+    When record 670 is updated
+    Then record 670 should be saved
+    But record 670 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 671
+    Given record 671 exists
+    And record 671 has value 4697
+    When record 671 is updated
+    Then record 671 should be saved
+    But record 671 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 672
+    Given record 672 exists
+    And record 672 has value 4704
+    When record 672 is updated
+    Then record 672 should be saved
+    But record 672 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 673
+    Given record 673 exists
+    And record 673 has value 4711
+    When record 673 is updated
+    Then record 673 should be saved
+    But record 673 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 674
+    Given record 674 exists
+    And record 674 has value 4718
+    When record 674 is updated
+    Then record 674 should be saved
+    But record 674 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 675
+    Given record 675 exists
+    And record 675 has value 4725
+    When record 675 is updated
+    Then record 675 should be saved
+    But record 675 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 676
+    Given record 676 exists
+    And record 676 has value 4732
+    When record 676 is updated
+    Then record 676 should be saved
+    But record 676 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 677
+    Given record 677 exists
+    And record 677 has value 4739
+    When record 677 is updated
+    Then record 677 should be saved
+    But record 677 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 678
+    Given record 678 exists
+    And record 678 has value 4746
+    When record 678 is updated
+    Then record 678 should be saved
+    But record 678 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 679
+    Given record 679 exists
+    And record 679 has value 4753
+    When record 679 is updated
+    Then record 679 should be saved
+    But record 679 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 680
+    Given record 680 exists
+    And record 680 has value 4760
+    When record 680 is updated
+    Then record 680 should be saved
+    But record 680 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 681
+    Given record 681 exists
+    And record 681 has value 4767
+    When record 681 is updated
+    Then record 681 should be saved
+    But record 681 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 682
+    Given record 682 exists
+    And record 682 has value 4774
+    When record 682 is updated
+    Then record 682 should be saved
+    But record 682 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 683
+    Given record 683 exists
+    And record 683 has value 4781
+    When record 683 is updated
+    Then record 683 should be saved
+    But record 683 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 684
+    Given record 684 exists
+    And record 684 has value 4788
+    When record 684 is updated
+    Then record 684 should be saved
+    But record 684 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 685
+    Given record 685 exists
+    And record 685 has value 4795
+    When record 685 is updated
+    Then record 685 should be saved
+    But record 685 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 686
+    Given record 686 exists
+    And record 686 has value 4802
+    When record 686 is updated
+    Then record 686 should be saved
+    But record 686 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 687
+    Given record 687 exists
+    And record 687 has value 4809
+    When record 687 is updated
+    Then record 687 should be saved
+    But record 687 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 688
+    Given record 688 exists
+    And record 688 has value 4816
+    When record 688 is updated
+    Then record 688 should be saved
+    But record 688 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 689
+    Given record 689 exists
+    And record 689 has value 4823
+    When record 689 is updated
+    Then record 689 should be saved
+    But record 689 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 690
+    Given record 690 exists
+    And record 690 has value 4830
+    When record 690 is updated
+    Then record 690 should be saved
+    But record 690 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 691
+    Given record 691 exists
+    And record 691 has value 4837
+    When record 691 is updated
+    Then record 691 should be saved
+    But record 691 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 692
+    Given record 692 exists
+    And record 692 has value 4844
+    When record 692 is updated
+    Then record 692 should be saved
+    But record 692 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 693
+    Given record 693 exists
+    And record 693 has value 4851
+    When record 693 is updated
+    Then record 693 should be saved
+    But record 693 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 694
+    Given record 694 exists
+    And record 694 has value 4858
+    When record 694 is updated
+    Then record 694 should be saved
+    But record 694 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 695
+    Given record 695 exists
+    And record 695 has value 4865
+    When record 695 is updated
+    Then record 695 should be saved
+    But record 695 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 696
+    Given record 696 exists
+    And record 696 has value 4872
+    When record 696 is updated
+    Then record 696 should be saved
+    But record 696 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 697
+    Given record 697 exists
+    And record 697 has value 4879
+    When record 697 is updated
+    Then record 697 should be saved
+    But record 697 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 698
+    Given record 698 exists
+    And record 698 has value 4886
+    When record 698 is updated
+    Then record 698 should be saved
+    But record 698 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 699
+    Given record 699 exists
+    And record 699 has value 4893
+    When record 699 is updated
+    Then record 699 should be saved
+    But record 699 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 700
+    Given record 700 exists
+    And record 700 has value 4900
+    When record 700 is updated
+    Then record 700 should be saved
+    But record 700 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 701
+    Given record 701 exists
+    And record 701 has value 4907
+    When record 701 is updated
+    Then record 701 should be saved
+    But record 701 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 702
+    Given record 702 exists
+    And record 702 has value 4914
+    When record 702 is updated
+    Then record 702 should be saved
+    But record 702 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 703
+    Given record 703 exists
+    And record 703 has value 4921
+    When record 703 is updated
+    Then record 703 should be saved
+    But record 703 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 704
+    Given record 704 exists
+    And record 704 has value 4928
+    When record 704 is updated
+    Then record 704 should be saved
+    But record 704 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 705
+    Given record 705 exists
+    And record 705 has value 4935
+    When record 705 is updated
+    Then record 705 should be saved
+    But record 705 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 706
+    Given record 706 exists
+    And record 706 has value 4942
+    When record 706 is updated
+    Then record 706 should be saved
+    But record 706 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 707
+    Given record 707 exists
+    And record 707 has value 4949
+    When record 707 is updated
+    Then record 707 should be saved
+    But record 707 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 708
+    Given record 708 exists
+    And record 708 has value 4956
+    When record 708 is updated
+    Then record 708 should be saved
+    But record 708 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 709
+    Given record 709 exists
+    And record 709 has value 4963
+    When record 709 is updated
+    Then record 709 should be saved
+    But record 709 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 710
+    Given record 710 exists
+    And record 710 has value 4970
+    When record 710 is updated
+    Then record 710 should be saved
+    But record 710 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 711
+    Given record 711 exists
+    And record 711 has value 4977
+    When record 711 is updated
+    Then record 711 should be saved
+    But record 711 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 712
+    Given record 712 exists
+    And record 712 has value 4984
+    When record 712 is updated
+    Then record 712 should be saved
+    But record 712 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 713
+    Given record 713 exists
+    And record 713 has value 4991
+    When record 713 is updated
+    Then record 713 should be saved
+    But record 713 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 714
+    Given record 714 exists
+    And record 714 has value 4998
+    When record 714 is updated
+    Then record 714 should be saved
+    But record 714 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 715
+    Given record 715 exists
+    And record 715 has value 5005
+    When record 715 is updated
+    Then record 715 should be saved
+    But record 715 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 716
+    Given record 716 exists
+    And record 716 has value 5012
+    When record 716 is updated
+    Then record 716 should be saved
+    But record 716 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 717
+    Given record 717 exists
+    And record 717 has value 5019
+    When record 717 is updated
+    Then record 717 should be saved
+    But record 717 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 718
+    Given record 718 exists
+    And record 718 has value 5026
+    When record 718 is updated
+    Then record 718 should be saved
+    But record 718 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 719
+    Given record 719 exists
+    And record 719 has value 5033
+    When record 719 is updated
+    Then record 719 should be saved
+    But record 719 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 720
+    Given record 720 exists
+    And record 720 has value 5040
+    When record 720 is updated
+    Then record 720 should be saved
+    But record 720 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 721
+    Given record 721 exists
+    And record 721 has value 5047
+    When record 721 is updated
+    Then record 721 should be saved
+    But record 721 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 722
+    Given record 722 exists
+    And record 722 has value 5054
+    When record 722 is updated
+    Then record 722 should be saved
+    But record 722 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 723
+    Given record 723 exists
+    And record 723 has value 5061
+    When record 723 is updated
+    Then record 723 should be saved
+    But record 723 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 724
+    Given record 724 exists
+    And record 724 has value 5068
+    When record 724 is updated
+    Then record 724 should be saved
+    But record 724 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 725
+    Given record 725 exists
+    And record 725 has value 5075
+    When record 725 is updated
+    Then record 725 should be saved
+    But record 725 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 726
+    Given record 726 exists
+    And record 726 has value 5082
+    When record 726 is updated
+    Then record 726 should be saved
+    But record 726 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 727
+    Given record 727 exists
+    And record 727 has value 5089
+    When record 727 is updated
+    Then record 727 should be saved
+    But record 727 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 728
+    Given record 728 exists
+    And record 728 has value 5096
+    When record 728 is updated
+    Then record 728 should be saved
+    But record 728 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 729
+    Given record 729 exists
+    And record 729 has value 5103
+    When record 729 is updated
+    Then record 729 should be saved
+    But record 729 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 730
+    Given record 730 exists
+    And record 730 has value 5110
+    When record 730 is updated
+    Then record 730 should be saved
+    But record 730 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 731
+    Given record 731 exists
+    And record 731 has value 5117
+    When record 731 is updated
+    Then record 731 should be saved
+    But record 731 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 732
+    Given record 732 exists
+    And record 732 has value 5124
+    When record 732 is updated
+    Then record 732 should be saved
+    But record 732 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 733
+    Given record 733 exists
+    And record 733 has value 5131
+    When record 733 is updated
+    Then record 733 should be saved
+    But record 733 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 734
+    Given record 734 exists
+    And record 734 has value 5138
+    When record 734 is updated
+    Then record 734 should be saved
+    But record 734 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 735
+    Given record 735 exists
+    And record 735 has value 5145
+    When record 735 is updated
+    Then record 735 should be saved
+    But record 735 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 736
+    Given record 736 exists
+    And record 736 has value 5152
+    When record 736 is updated
+    Then record 736 should be saved
+    But record 736 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 737
+    Given record 737 exists
+    And record 737 has value 5159
+    When record 737 is updated
+    Then record 737 should be saved
+    But record 737 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 738
+    Given record 738 exists
+    And record 738 has value 5166
+    When record 738 is updated
+    Then record 738 should be saved
+    But record 738 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 739
+    Given record 739 exists
+    And record 739 has value 5173
+    When record 739 is updated
+    Then record 739 should be saved
+    But record 739 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 740
+    Given record 740 exists
+    And record 740 has value 5180
+    When record 740 is updated
+    Then record 740 should be saved
+    But record 740 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 741
+    Given record 741 exists
+    And record 741 has value 5187
+    When record 741 is updated
+    Then record 741 should be saved
+    But record 741 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 742
+    Given record 742 exists
+    And record 742 has value 5194
+    When record 742 is updated
+    Then record 742 should be saved
+    But record 742 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 743
+    Given record 743 exists
+    And record 743 has value 5201
+    When record 743 is updated
+    Then record 743 should be saved
+    But record 743 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 744
+    Given record 744 exists
+    And record 744 has value 5208
+    When record 744 is updated
+    Then record 744 should be saved
+    But record 744 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 745
+    Given record 745 exists
+    And record 745 has value 5215
+    When record 745 is updated
+    Then record 745 should be saved
+    But record 745 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 746
+    Given record 746 exists
+    And record 746 has value 5222
+    When record 746 is updated
+    Then record 746 should be saved
+    But record 746 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 747
+    Given record 747 exists
+    And record 747 has value 5229
+    When record 747 is updated
+    Then record 747 should be saved
+    But record 747 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 748
+    Given record 748 exists
+    And record 748 has value 5236
+    When record 748 is updated
+    Then record 748 should be saved
+    But record 748 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 749
+    Given record 749 exists
+    And record 749 has value 5243
+    When record 749 is updated
+    Then record 749 should be saved
+    But record 749 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 750
+    Given record 750 exists
+    And record 750 has value 5250
+    When record 750 is updated
+    Then record 750 should be saved
+    But record 750 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 751
+    Given record 751 exists
+    And record 751 has value 5257
+    When record 751 is updated
+    Then record 751 should be saved
+    But record 751 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 752
+    Given record 752 exists
+    And record 752 has value 5264
+    When record 752 is updated
+    Then record 752 should be saved
+    But record 752 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 753
+    Given record 753 exists
+    And record 753 has value 5271
+    When record 753 is updated
+    Then record 753 should be saved
+    But record 753 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 754
+    Given record 754 exists
+    And record 754 has value 5278
+    When record 754 is updated
+    Then record 754 should be saved
+    But record 754 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 755
+    Given record 755 exists
+    And record 755 has value 5285
+    When record 755 is updated
+    Then record 755 should be saved
+    But record 755 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 756
+    Given record 756 exists
+    And record 756 has value 5292
+    When record 756 is updated
+    Then record 756 should be saved
+    But record 756 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 757
+    Given record 757 exists
+    And record 757 has value 5299
+    When record 757 is updated
+    Then record 757 should be saved
+    But record 757 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 758
+    Given record 758 exists
+    And record 758 has value 5306
+    When record 758 is updated
+    Then record 758 should be saved
+    But record 758 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 759
+    Given record 759 exists
+    And record 759 has value 5313
+    When record 759 is updated
+    Then record 759 should be saved
+    But record 759 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 760
+    Given record 760 exists
+    And record 760 has value 5320
+    When record 760 is updated
+    Then record 760 should be saved
+    But record 760 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 761
+    Given record 761 exists
+    And record 761 has value 5327
+    When record 761 is updated
+    Then record 761 should be saved
+    But record 761 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 762
+    Given record 762 exists
+    And record 762 has value 5334
+    When record 762 is updated
+    Then record 762 should be saved
+    But record 762 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 763
+    Given record 763 exists
+    And record 763 has value 5341
+    When record 763 is updated
+    Then record 763 should be saved
+    But record 763 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 764
+    Given record 764 exists
+    And record 764 has value 5348
+    When record 764 is updated
+    Then record 764 should be saved
+    But record 764 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 765
+    Given record 765 exists
+    And record 765 has value 5355
+    When record 765 is updated
+    Then record 765 should be saved
+    But record 765 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 766
+    Given record 766 exists
+    And record 766 has value 5362
+    When record 766 is updated
+    Then record 766 should be saved
+    But record 766 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 767
+    Given record 767 exists
+    And record 767 has value 5369
+    When record 767 is updated
+    Then record 767 should be saved
+    But record 767 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 768
+    Given record 768 exists
+    And record 768 has value 5376
+    When record 768 is updated
+    Then record 768 should be saved
+    But record 768 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 769
+    Given record 769 exists
+    And record 769 has value 5383
+    When record 769 is updated
+    Then record 769 should be saved
+    But record 769 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 770
+    Given record 770 exists
+    And record 770 has value 5390
+    When record 770 is updated
+    Then record 770 should be saved
+    But record 770 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 771
+    Given record 771 exists
+    And record 771 has value 5397
+    When record 771 is updated
+    Then record 771 should be saved
+    But record 771 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 772
+    Given record 772 exists
+    And record 772 has value 5404
+    When record 772 is updated
+    Then record 772 should be saved
+    But record 772 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 773
+    Given record 773 exists
+    And record 773 has value 5411
+    When record 773 is updated
+    Then record 773 should be saved
+    But record 773 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 774
+    Given record 774 exists
+    And record 774 has value 5418
+    When record 774 is updated
+    Then record 774 should be saved
+    But record 774 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 775
+    Given record 775 exists
+    And record 775 has value 5425
+    When record 775 is updated
+    Then record 775 should be saved
+    But record 775 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 776
+    Given record 776 exists
+    And record 776 has value 5432
+    When record 776 is updated
+    Then record 776 should be saved
+    But record 776 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 777
+    Given record 777 exists
+    And record 777 has value 5439
+    When record 777 is updated
+    Then record 777 should be saved
+    But record 777 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 778
+    Given record 778 exists
+    And record 778 has value 5446
+    When record 778 is updated
+    Then record 778 should be saved
+    But record 778 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 779
+    Given record 779 exists
+    And record 779 has value 5453
+    When record 779 is updated
+    Then record 779 should be saved
+    But record 779 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 780
+    Given record 780 exists
+    And record 780 has value 5460
+    When record 780 is updated
+    Then record 780 should be saved
+    But record 780 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 781
+    Given record 781 exists
+    And record 781 has value 5467
+    When record 781 is updated
+    Then record 781 should be saved
+    But record 781 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 782
+    Given record 782 exists
+    And record 782 has value 5474
+    When record 782 is updated
+    Then record 782 should be saved
+    But record 782 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 783
+    Given record 783 exists
+    And record 783 has value 5481
+    When record 783 is updated
+    Then record 783 should be saved
+    But record 783 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 784
+    Given record 784 exists
+    And record 784 has value 5488
+    When record 784 is updated
+    Then record 784 should be saved
+    But record 784 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 785
+    Given record 785 exists
+    And record 785 has value 5495
+    When record 785 is updated
+    Then record 785 should be saved
+    But record 785 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 786
+    Given record 786 exists
+    And record 786 has value 5502
+    When record 786 is updated
+    Then record 786 should be saved
+    But record 786 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 787
+    Given record 787 exists
+    And record 787 has value 5509
+    When record 787 is updated
+    Then record 787 should be saved
+    But record 787 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 788
+    Given record 788 exists
+    And record 788 has value 5516
+    When record 788 is updated
+    Then record 788 should be saved
+    But record 788 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 789
+    Given record 789 exists
+    And record 789 has value 5523
+    When record 789 is updated
+    Then record 789 should be saved
+    But record 789 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 790
+    Given record 790 exists
+    And record 790 has value 5530
+    When record 790 is updated
+    Then record 790 should be saved
+    But record 790 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 791
+    Given record 791 exists
+    And record 791 has value 5537
+    When record 791 is updated
+    Then record 791 should be saved
+    But record 791 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 792
+    Given record 792 exists
+    And record 792 has value 5544
+    When record 792 is updated
+    Then record 792 should be saved
+    But record 792 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 793
+    Given record 793 exists
+    And record 793 has value 5551
+    When record 793 is updated
+    Then record 793 should be saved
+    But record 793 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 794
+    Given record 794 exists
+    And record 794 has value 5558
+    When record 794 is updated
+    Then record 794 should be saved
+    But record 794 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 795
+    Given record 795 exists
+    And record 795 has value 5565
+    When record 795 is updated
+    Then record 795 should be saved
+    But record 795 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 796
+    Given record 796 exists
+    And record 796 has value 5572
+    When record 796 is updated
+    Then record 796 should be saved
+    But record 796 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 797
+    Given record 797 exists
+    And record 797 has value 5579
+    When record 797 is updated
+    Then record 797 should be saved
+    But record 797 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 798
+    Given record 798 exists
+    And record 798 has value 5586
+    When record 798 is updated
+    Then record 798 should be saved
+    But record 798 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 799
+    Given record 799 exists
+    And record 799 has value 5593
+    When record 799 is updated
+    Then record 799 should be saved
+    But record 799 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 800
+    Given record 800 exists
+    And record 800 has value 5600
+    When record 800 is updated
+    Then record 800 should be saved
+    But record 800 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 801
+    Given record 801 exists
+    And record 801 has value 5607
+    When record 801 is updated
+    Then record 801 should be saved
+    But record 801 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 802
+    Given record 802 exists
+    And record 802 has value 5614
+    When record 802 is updated
+    Then record 802 should be saved
+    But record 802 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 803
+    Given record 803 exists
+    And record 803 has value 5621
+    When record 803 is updated
+    Then record 803 should be saved
+    But record 803 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 804
+    Given record 804 exists
+    And record 804 has value 5628
+    When record 804 is updated
+    Then record 804 should be saved
+    But record 804 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 805
+    Given record 805 exists
+    And record 805 has value 5635
+    When record 805 is updated
+    Then record 805 should be saved
+    But record 805 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 806
+    Given record 806 exists
+    And record 806 has value 5642
+    When record 806 is updated
+    Then record 806 should be saved
+    But record 806 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 807
+    Given record 807 exists
+    And record 807 has value 5649
+    When record 807 is updated
+    Then record 807 should be saved
+    But record 807 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 808
+    Given record 808 exists
+    And record 808 has value 5656
+    When record 808 is updated
+    Then record 808 should be saved
+    But record 808 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 809
+    Given record 809 exists
+    And record 809 has value 5663
+    When record 809 is updated
+    Then record 809 should be saved
+    But record 809 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 810
+    Given record 810 exists
+    And record 810 has value 5670
+    When record 810 is updated
+    Then record 810 should be saved
+    But record 810 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 811
+    Given record 811 exists
+    And record 811 has value 5677
+    When record 811 is updated
+    Then record 811 should be saved
+    But record 811 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 812
+    Given record 812 exists
+    And record 812 has value 5684
+    When record 812 is updated
+    Then record 812 should be saved
+    But record 812 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 813
+    Given record 813 exists
+    And record 813 has value 5691
+    When record 813 is updated
+    Then record 813 should be saved
+    But record 813 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 814
+    Given record 814 exists
+    And record 814 has value 5698
+    When record 814 is updated
+    Then record 814 should be saved
+    But record 814 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 815
+    Given record 815 exists
+    And record 815 has value 5705
+    When record 815 is updated
+    Then record 815 should be saved
+    But record 815 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 816
+    Given record 816 exists
+    And record 816 has value 5712
+    When record 816 is updated
+    Then record 816 should be saved
+    But record 816 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 817
+    Given record 817 exists
+    And record 817 has value 5719
+    When record 817 is updated
+    Then record 817 should be saved
+    But record 817 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 818
+    Given record 818 exists
+    And record 818 has value 5726
+    When record 818 is updated
+    Then record 818 should be saved
+    But record 818 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 819
+    Given record 819 exists
+    And record 819 has value 5733
+    When record 819 is updated
+    Then record 819 should be saved
+    But record 819 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 820
+    Given record 820 exists
+    And record 820 has value 5740
+    When record 820 is updated
+    Then record 820 should be saved
+    But record 820 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 821
+    Given record 821 exists
+    And record 821 has value 5747
+    When record 821 is updated
+    Then record 821 should be saved
+    But record 821 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 822
+    Given record 822 exists
+    And record 822 has value 5754
+    When record 822 is updated
+    Then record 822 should be saved
+    But record 822 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 823
+    Given record 823 exists
+    And record 823 has value 5761
+    When record 823 is updated
+    Then record 823 should be saved
+    But record 823 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 824
+    Given record 824 exists
+    And record 824 has value 5768
+    When record 824 is updated
+    Then record 824 should be saved
+    But record 824 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 825
+    Given record 825 exists
+    And record 825 has value 5775
+    When record 825 is updated
+    Then record 825 should be saved
+    But record 825 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 826
+    Given record 826 exists
+    And record 826 has value 5782
+    When record 826 is updated
+    Then record 826 should be saved
+    But record 826 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 827
+    Given record 827 exists
+    And record 827 has value 5789
+    When record 827 is updated
+    Then record 827 should be saved
+    But record 827 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 828
+    Given record 828 exists
+    And record 828 has value 5796
+    When record 828 is updated
+    Then record 828 should be saved
+    But record 828 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 829
+    Given record 829 exists
+    And record 829 has value 5803
+    When record 829 is updated
+    Then record 829 should be saved
+    But record 829 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 830
+    Given record 830 exists
+    And record 830 has value 5810
+    When record 830 is updated
+    Then record 830 should be saved
+    But record 830 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 831
+    Given record 831 exists
+    And record 831 has value 5817
+    When record 831 is updated
+    Then record 831 should be saved
+    But record 831 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 832
+    Given record 832 exists
+    And record 832 has value 5824
+    When record 832 is updated
+    Then record 832 should be saved
+    But record 832 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 833
+    Given record 833 exists
+    And record 833 has value 5831
+    When record 833 is updated
+    Then record 833 should be saved
+    But record 833 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 834
+    Given record 834 exists
+    And record 834 has value 5838
+    When record 834 is updated
+    Then record 834 should be saved
+    But record 834 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 835
+    Given record 835 exists
+    And record 835 has value 5845
+    When record 835 is updated
+    Then record 835 should be saved
+    But record 835 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 836
+    Given record 836 exists
+    And record 836 has value 5852
+    When record 836 is updated
+    Then record 836 should be saved
+    But record 836 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 837
+    Given record 837 exists
+    And record 837 has value 5859
+    When record 837 is updated
+    Then record 837 should be saved
+    But record 837 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 838
+    Given record 838 exists
+    And record 838 has value 5866
+    When record 838 is updated
+    Then record 838 should be saved
+    But record 838 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 839
+    Given record 839 exists
+    And record 839 has value 5873
+    When record 839 is updated
+    Then record 839 should be saved
+    But record 839 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 840
+    Given record 840 exists
+    And record 840 has value 5880
+    When record 840 is updated
+    Then record 840 should be saved
+    But record 840 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 841
+    Given record 841 exists
+    And record 841 has value 5887
+    When record 841 is updated
+    Then record 841 should be saved
+    But record 841 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 842
+    Given record 842 exists
+    And record 842 has value 5894
+    When record 842 is updated
+    Then record 842 should be saved
+    But record 842 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 843
+    Given record 843 exists
+    And record 843 has value 5901
+    When record 843 is updated
+    Then record 843 should be saved
+    But record 843 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 844
+    Given record 844 exists
+    And record 844 has value 5908
+    When record 844 is updated
+    Then record 844 should be saved
+    But record 844 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 845
+    Given record 845 exists
+    And record 845 has value 5915
+    When record 845 is updated
+    Then record 845 should be saved
+    But record 845 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 846
+    Given record 846 exists
+    And record 846 has value 5922
+    When record 846 is updated
+    Then record 846 should be saved
+    But record 846 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 847
+    Given record 847 exists
+    And record 847 has value 5929
+    When record 847 is updated
+    Then record 847 should be saved
+    But record 847 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 848
+    Given record 848 exists
+    And record 848 has value 5936
+    When record 848 is updated
+    Then record 848 should be saved
+    But record 848 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 849
+    Given record 849 exists
+    And record 849 has value 5943
+    When record 849 is updated
+    Then record 849 should be saved
+    But record 849 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 850
+    Given record 850 exists
+    And record 850 has value 5950
+    When record 850 is updated
+    Then record 850 should be saved
+    But record 850 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 851
+    Given record 851 exists
+    And record 851 has value 5957
+    When record 851 is updated
+    Then record 851 should be saved
+    But record 851 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 852
+    Given record 852 exists
+    And record 852 has value 5964
+    When record 852 is updated
+    Then record 852 should be saved
+    But record 852 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 853
+    Given record 853 exists
+    And record 853 has value 5971
+    When record 853 is updated
+    Then record 853 should be saved
+    But record 853 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 854
+    Given record 854 exists
+    And record 854 has value 5978
+    When record 854 is updated
+    Then record 854 should be saved
+    But record 854 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 855
+    Given record 855 exists
+    And record 855 has value 5985
+    When record 855 is updated
+    Then record 855 should be saved
+    But record 855 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 856
+    Given record 856 exists
+    And record 856 has value 5992
+    When record 856 is updated
+    Then record 856 should be saved
+    But record 856 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 857
+    Given record 857 exists
+    And record 857 has value 5999
+    When record 857 is updated
+    Then record 857 should be saved
+    But record 857 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 858
+    Given record 858 exists
+    And record 858 has value 6006
+    When record 858 is updated
+    Then record 858 should be saved
+    But record 858 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 859
+    Given record 859 exists
+    And record 859 has value 6013
+    When record 859 is updated
+    Then record 859 should be saved
+    But record 859 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 860
+    Given record 860 exists
+    And record 860 has value 6020
+    When record 860 is updated
+    Then record 860 should be saved
+    But record 860 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 861
+    Given record 861 exists
+    And record 861 has value 6027
+    When record 861 is updated
+    Then record 861 should be saved
+    But record 861 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 862
+    Given record 862 exists
+    And record 862 has value 6034
+    When record 862 is updated
+    Then record 862 should be saved
+    But record 862 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 863
+    Given record 863 exists
+    And record 863 has value 6041
+    When record 863 is updated
+    Then record 863 should be saved
+    But record 863 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 864
+    Given record 864 exists
+    And record 864 has value 6048
+    When record 864 is updated
+    Then record 864 should be saved
+    But record 864 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 865
+    Given record 865 exists
+    And record 865 has value 6055
+    When record 865 is updated
+    Then record 865 should be saved
+    But record 865 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 866
+    Given record 866 exists
+    And record 866 has value 6062
+    When record 866 is updated
+    Then record 866 should be saved
+    But record 866 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 867
+    Given record 867 exists
+    And record 867 has value 6069
+    When record 867 is updated
+    Then record 867 should be saved
+    But record 867 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 868
+    Given record 868 exists
+    And record 868 has value 6076
+    When record 868 is updated
+    Then record 868 should be saved
+    But record 868 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 869
+    Given record 869 exists
+    And record 869 has value 6083
+    When record 869 is updated
+    Then record 869 should be saved
+    But record 869 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 870
+    Given record 870 exists
+    And record 870 has value 6090
+    When record 870 is updated
+    Then record 870 should be saved
+    But record 870 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 871
+    Given record 871 exists
+    And record 871 has value 6097
+    When record 871 is updated
+    Then record 871 should be saved
+    But record 871 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 872
+    Given record 872 exists
+    And record 872 has value 6104
+    When record 872 is updated
+    Then record 872 should be saved
+    But record 872 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 873
+    Given record 873 exists
+    And record 873 has value 6111
+    When record 873 is updated
+    Then record 873 should be saved
+    But record 873 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 874
+    Given record 874 exists
+    And record 874 has value 6118
+    When record 874 is updated
+    Then record 874 should be saved
+    But record 874 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 875
+    Given record 875 exists
+    And record 875 has value 6125
+    When record 875 is updated
+    Then record 875 should be saved
+    But record 875 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 876
+    Given record 876 exists
+    And record 876 has value 6132
+    When record 876 is updated
+    Then record 876 should be saved
+    But record 876 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 877
+    Given record 877 exists
+    And record 877 has value 6139
+    When record 877 is updated
+    Then record 877 should be saved
+    But record 877 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 878
+    Given record 878 exists
+    And record 878 has value 6146
+    When record 878 is updated
+    Then record 878 should be saved
+    But record 878 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 879
+    Given record 879 exists
+    And record 879 has value 6153
+    When record 879 is updated
+    Then record 879 should be saved
+    But record 879 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 880
+    Given record 880 exists
+    And record 880 has value 6160
+    When record 880 is updated
+    Then record 880 should be saved
+    But record 880 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 881
+    Given record 881 exists
+    And record 881 has value 6167
+    When record 881 is updated
+    Then record 881 should be saved
+    But record 881 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 882
+    Given record 882 exists
+    And record 882 has value 6174
+    When record 882 is updated
+    Then record 882 should be saved
+    But record 882 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 883
+    Given record 883 exists
+    And record 883 has value 6181
+    When record 883 is updated
+    Then record 883 should be saved
+    But record 883 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 884
+    Given record 884 exists
+    And record 884 has value 6188
+    When record 884 is updated
+    Then record 884 should be saved
+    But record 884 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 885
+    Given record 885 exists
+    And record 885 has value 6195
+    When record 885 is updated
+    Then record 885 should be saved
+    But record 885 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 886
+    Given record 886 exists
+    And record 886 has value 6202
+    When record 886 is updated
+    Then record 886 should be saved
+    But record 886 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 887
+    Given record 887 exists
+    And record 887 has value 6209
+    When record 887 is updated
+    Then record 887 should be saved
+    But record 887 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 888
+    Given record 888 exists
+    And record 888 has value 6216
+    When record 888 is updated
+    Then record 888 should be saved
+    But record 888 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 889
+    Given record 889 exists
+    And record 889 has value 6223
+    When record 889 is updated
+    Then record 889 should be saved
+    But record 889 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 890
+    Given record 890 exists
+    And record 890 has value 6230
+    When record 890 is updated
+    Then record 890 should be saved
+    But record 890 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 891
+    Given record 891 exists
+    And record 891 has value 6237
+    When record 891 is updated
+    Then record 891 should be saved
+    But record 891 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 892
+    Given record 892 exists
+    And record 892 has value 6244
+    When record 892 is updated
+    Then record 892 should be saved
+    But record 892 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 893
+    Given record 893 exists
+    And record 893 has value 6251
+    When record 893 is updated
+    Then record 893 should be saved
+    But record 893 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 894
+    Given record 894 exists
+    And record 894 has value 6258
+    When record 894 is updated
+    Then record 894 should be saved
+    But record 894 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 895
+    Given record 895 exists
+    And record 895 has value 6265
+    When record 895 is updated
+    Then record 895 should be saved
+    But record 895 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 896
+    Given record 896 exists
+    And record 896 has value 6272
+    When record 896 is updated
+    Then record 896 should be saved
+    But record 896 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 897
+    Given record 897 exists
+    And record 897 has value 6279
+    When record 897 is updated
+    Then record 897 should be saved
+    But record 897 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 898
+    Given record 898 exists
+    And record 898 has value 6286
+    When record 898 is updated
+    Then record 898 should be saved
+    But record 898 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 899
+    Given record 899 exists
+    And record 899 has value 6293
+    When record 899 is updated
+    Then record 899 should be saved
+    But record 899 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 900
+    Given record 900 exists
+    And record 900 has value 6300
+    When record 900 is updated
+    Then record 900 should be saved
+    But record 900 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 901
+    Given record 901 exists
+    And record 901 has value 6307
+    When record 901 is updated
+    Then record 901 should be saved
+    But record 901 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 902
+    Given record 902 exists
+    And record 902 has value 6314
+    When record 902 is updated
+    Then record 902 should be saved
+    But record 902 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 903
+    Given record 903 exists
+    And record 903 has value 6321
+    When record 903 is updated
+    Then record 903 should be saved
+    But record 903 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 904
+    Given record 904 exists
+    And record 904 has value 6328
+    When record 904 is updated
+    Then record 904 should be saved
+    But record 904 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 905
+    Given record 905 exists
+    And record 905 has value 6335
+    When record 905 is updated
+    Then record 905 should be saved
+    But record 905 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 906
+    Given record 906 exists
+    And record 906 has value 6342
+    When record 906 is updated
+    Then record 906 should be saved
+    But record 906 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 907
+    Given record 907 exists
+    And record 907 has value 6349
+    When record 907 is updated
+    Then record 907 should be saved
+    But record 907 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 908
+    Given record 908 exists
+    And record 908 has value 6356
+    When record 908 is updated
+    Then record 908 should be saved
+    But record 908 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 909
+    Given record 909 exists
+    And record 909 has value 6363
+    When record 909 is updated
+    Then record 909 should be saved
+    But record 909 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 910
+    Given record 910 exists
+    And record 910 has value 6370
+    When record 910 is updated
+    Then record 910 should be saved
+    But record 910 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 911
+    Given record 911 exists
+    And record 911 has value 6377
+    When record 911 is updated
+    Then record 911 should be saved
+    But record 911 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 912
+    Given record 912 exists
+    And record 912 has value 6384
+    When record 912 is updated
+    Then record 912 should be saved
+    But record 912 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 913
+    Given record 913 exists
+    And record 913 has value 6391
+    When record 913 is updated
+    Then record 913 should be saved
+    But record 913 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 914
+    Given record 914 exists
+    And record 914 has value 6398
+    When record 914 is updated
+    Then record 914 should be saved
+    But record 914 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 915
+    Given record 915 exists
+    And record 915 has value 6405
+    When record 915 is updated
+    Then record 915 should be saved
+    But record 915 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 916
+    Given record 916 exists
+    And record 916 has value 6412
+    When record 916 is updated
+    Then record 916 should be saved
+    But record 916 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 917
+    Given record 917 exists
+    And record 917 has value 6419
+    When record 917 is updated
+    Then record 917 should be saved
+    But record 917 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 918
+    Given record 918 exists
+    And record 918 has value 6426
+    When record 918 is updated
+    Then record 918 should be saved
+    But record 918 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 919
+    Given record 919 exists
+    And record 919 has value 6433
+    When record 919 is updated
+    Then record 919 should be saved
+    But record 919 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 920
+    Given record 920 exists
+    And record 920 has value 6440
+    When record 920 is updated
+    Then record 920 should be saved
+    But record 920 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 921
+    Given record 921 exists
+    And record 921 has value 6447
+    When record 921 is updated
+    Then record 921 should be saved
+    But record 921 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 922
+    Given record 922 exists
+    And record 922 has value 6454
+    When record 922 is updated
+    Then record 922 should be saved
+    But record 922 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 923
+    Given record 923 exists
+    And record 923 has value 6461
+    When record 923 is updated
+    Then record 923 should be saved
+    But record 923 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 924
+    Given record 924 exists
+    And record 924 has value 6468
+    When record 924 is updated
+    Then record 924 should be saved
+    But record 924 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 925
+    Given record 925 exists
+    And record 925 has value 6475
+    When record 925 is updated
+    Then record 925 should be saved
+    But record 925 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 926
+    Given record 926 exists
+    And record 926 has value 6482
+    When record 926 is updated
+    Then record 926 should be saved
+    But record 926 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 927
+    Given record 927 exists
+    And record 927 has value 6489
+    When record 927 is updated
+    Then record 927 should be saved
+    But record 927 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 928
+    Given record 928 exists
+    And record 928 has value 6496
+    When record 928 is updated
+    Then record 928 should be saved
+    But record 928 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 929
+    Given record 929 exists
+    And record 929 has value 6503
+    When record 929 is updated
+    Then record 929 should be saved
+    But record 929 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 930
+    Given record 930 exists
+    And record 930 has value 6510
+    When record 930 is updated
+    Then record 930 should be saved
+    But record 930 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 931
+    Given record 931 exists
+    And record 931 has value 6517
+    When record 931 is updated
+    Then record 931 should be saved
+    But record 931 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 932
+    Given record 932 exists
+    And record 932 has value 6524
+    When record 932 is updated
+    Then record 932 should be saved
+    But record 932 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 933
+    Given record 933 exists
+    And record 933 has value 6531
+    When record 933 is updated
+    Then record 933 should be saved
+    But record 933 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 934
+    Given record 934 exists
+    And record 934 has value 6538
+    When record 934 is updated
+    Then record 934 should be saved
+    But record 934 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 935
+    Given record 935 exists
+    And record 935 has value 6545
+    When record 935 is updated
+    Then record 935 should be saved
+    But record 935 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 936
+    Given record 936 exists
+    And record 936 has value 6552
+    When record 936 is updated
+    Then record 936 should be saved
+    But record 936 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 937
+    Given record 937 exists
+    And record 937 has value 6559
+    When record 937 is updated
+    Then record 937 should be saved
+    But record 937 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 938
+    Given record 938 exists
+    And record 938 has value 6566
+    When record 938 is updated
+    Then record 938 should be saved
+    But record 938 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 939
+    Given record 939 exists
+    And record 939 has value 6573
+    When record 939 is updated
+    Then record 939 should be saved
+    But record 939 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 940
+    Given record 940 exists
+    And record 940 has value 6580
+    When record 940 is updated
+    Then record 940 should be saved
+    But record 940 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 941
+    Given record 941 exists
+    And record 941 has value 6587
+    When record 941 is updated
+    Then record 941 should be saved
+    But record 941 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 942
+    Given record 942 exists
+    And record 942 has value 6594
+    When record 942 is updated
+    Then record 942 should be saved
+    But record 942 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 943
+    Given record 943 exists
+    And record 943 has value 6601
+    When record 943 is updated
+    Then record 943 should be saved
+    But record 943 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 944
+    Given record 944 exists
+    And record 944 has value 6608
+    When record 944 is updated
+    Then record 944 should be saved
+    But record 944 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 945
+    Given record 945 exists
+    And record 945 has value 6615
+    When record 945 is updated
+    Then record 945 should be saved
+    But record 945 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 946
+    Given record 946 exists
+    And record 946 has value 6622
+    When record 946 is updated
+    Then record 946 should be saved
+    But record 946 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 947
+    Given record 947 exists
+    And record 947 has value 6629
+    When record 947 is updated
+    Then record 947 should be saved
+    But record 947 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 948
+    Given record 948 exists
+    And record 948 has value 6636
+    When record 948 is updated
+    Then record 948 should be saved
+    But record 948 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 949
+    Given record 949 exists
+    And record 949 has value 6643
+    When record 949 is updated
+    Then record 949 should be saved
+    But record 949 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 950
+    Given record 950 exists
+    And record 950 has value 6650
+    When record 950 is updated
+    Then record 950 should be saved
+    But record 950 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 951
+    Given record 951 exists
+    And record 951 has value 6657
+    When record 951 is updated
+    Then record 951 should be saved
+    But record 951 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 952
+    Given record 952 exists
+    And record 952 has value 6664
+    When record 952 is updated
+    Then record 952 should be saved
+    But record 952 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 953
+    Given record 953 exists
+    And record 953 has value 6671
+    When record 953 is updated
+    Then record 953 should be saved
+    But record 953 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 954
+    Given record 954 exists
+    And record 954 has value 6678
+    When record 954 is updated
+    Then record 954 should be saved
+    But record 954 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 955
+    Given record 955 exists
+    And record 955 has value 6685
+    When record 955 is updated
+    Then record 955 should be saved
+    But record 955 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 956
+    Given record 956 exists
+    And record 956 has value 6692
+    When record 956 is updated
+    Then record 956 should be saved
+    But record 956 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 957
+    Given record 957 exists
+    And record 957 has value 6699
+    When record 957 is updated
+    Then record 957 should be saved
+    But record 957 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 958
+    Given record 958 exists
+    And record 958 has value 6706
+    When record 958 is updated
+    Then record 958 should be saved
+    But record 958 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 959
+    Given record 959 exists
+    And record 959 has value 6713
+    When record 959 is updated
+    Then record 959 should be saved
+    But record 959 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 960
+    Given record 960 exists
+    And record 960 has value 6720
+    When record 960 is updated
+    Then record 960 should be saved
+    But record 960 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 961
+    Given record 961 exists
+    And record 961 has value 6727
+    When record 961 is updated
+    Then record 961 should be saved
+    But record 961 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 962
+    Given record 962 exists
+    And record 962 has value 6734
+    When record 962 is updated
+    Then record 962 should be saved
+    But record 962 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 963
+    Given record 963 exists
+    And record 963 has value 6741
+    When record 963 is updated
+    Then record 963 should be saved
+    But record 963 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 964
+    Given record 964 exists
+    And record 964 has value 6748
+    When record 964 is updated
+    Then record 964 should be saved
+    But record 964 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 965
+    Given record 965 exists
+    And record 965 has value 6755
+    When record 965 is updated
+    Then record 965 should be saved
+    But record 965 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 966
+    Given record 966 exists
+    And record 966 has value 6762
+    When record 966 is updated
+    Then record 966 should be saved
+    But record 966 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 967
+    Given record 967 exists
+    And record 967 has value 6769
+    When record 967 is updated
+    Then record 967 should be saved
+    But record 967 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 968
+    Given record 968 exists
+    And record 968 has value 6776
+    When record 968 is updated
+    Then record 968 should be saved
+    But record 968 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 969
+    Given record 969 exists
+    And record 969 has value 6783
+    When record 969 is updated
+    Then record 969 should be saved
+    But record 969 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 970
+    Given record 970 exists
+    And record 970 has value 6790
+    When record 970 is updated
+    Then record 970 should be saved
+    But record 970 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 971
+    Given record 971 exists
+    And record 971 has value 6797
+    When record 971 is updated
+    Then record 971 should be saved
+    But record 971 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 972
+    Given record 972 exists
+    And record 972 has value 6804
+    When record 972 is updated
+    Then record 972 should be saved
+    But record 972 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 973
+    Given record 973 exists
+    And record 973 has value 6811
+    When record 973 is updated
+    Then record 973 should be saved
+    But record 973 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 974
+    Given record 974 exists
+    And record 974 has value 6818
+    When record 974 is updated
+    Then record 974 should be saved
+    But record 974 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 975
+    Given record 975 exists
+    And record 975 has value 6825
+    When record 975 is updated
+    Then record 975 should be saved
+    But record 975 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 976
+    Given record 976 exists
+    And record 976 has value 6832
+    When record 976 is updated
+    Then record 976 should be saved
+    But record 976 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 977
+    Given record 977 exists
+    And record 977 has value 6839
+    When record 977 is updated
+    Then record 977 should be saved
+    But record 977 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 978
+    Given record 978 exists
+    And record 978 has value 6846
+    When record 978 is updated
+    Then record 978 should be saved
+    But record 978 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 979
+    Given record 979 exists
+    And record 979 has value 6853
+    When record 979 is updated
+    Then record 979 should be saved
+    But record 979 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 980
+    Given record 980 exists
+    And record 980 has value 6860
+    When record 980 is updated
+    Then record 980 should be saved
+    But record 980 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 981
+    Given record 981 exists
+    And record 981 has value 6867
+    When record 981 is updated
+    Then record 981 should be saved
+    But record 981 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 982
+    Given record 982 exists
+    And record 982 has value 6874
+    When record 982 is updated
+    Then record 982 should be saved
+    But record 982 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 983
+    Given record 983 exists
+    And record 983 has value 6881
+    When record 983 is updated
+    Then record 983 should be saved
+    But record 983 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 984
+    Given record 984 exists
+    And record 984 has value 6888
+    When record 984 is updated
+    Then record 984 should be saved
+    But record 984 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 985
+    Given record 985 exists
+    And record 985 has value 6895
+    When record 985 is updated
+    Then record 985 should be saved
+    But record 985 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 986
+    Given record 986 exists
+    And record 986 has value 6902
+    When record 986 is updated
+    Then record 986 should be saved
+    But record 986 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 987
+    Given record 987 exists
+    And record 987 has value 6909
+    When record 987 is updated
+    Then record 987 should be saved
+    But record 987 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 988
+    Given record 988 exists
+    And record 988 has value 6916
+    When record 988 is updated
+    Then record 988 should be saved
+    But record 988 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 989
+    Given record 989 exists
+    And record 989 has value 6923
+    When record 989 is updated
+    Then record 989 should be saved
+    But record 989 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 990
+    Given record 990 exists
+    And record 990 has value 6930
+    When record 990 is updated
+    Then record 990 should be saved
+    But record 990 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 991
+    Given record 991 exists
+    And record 991 has value 6937
+    When record 991 is updated
+    Then record 991 should be saved
+    But record 991 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 992
+    Given record 992 exists
+    And record 992 has value 6944
+    When record 992 is updated
+    Then record 992 should be saved
+    But record 992 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 993
+    Given record 993 exists
+    And record 993 has value 6951
+    When record 993 is updated
+    Then record 993 should be saved
+    But record 993 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 994
+    Given record 994 exists
+    And record 994 has value 6958
+    When record 994 is updated
+    Then record 994 should be saved
+    But record 994 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 995
+    Given record 995 exists
+    And record 995 has value 6965
+    When record 995 is updated
+    Then record 995 should be saved
+    But record 995 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 996
+    Given record 996 exists
+    And record 996 has value 6972
+    When record 996 is updated
+    Then record 996 should be saved
+    But record 996 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 997
+    Given record 997 exists
+    And record 997 has value 6979
+    When record 997 is updated
+    Then record 997 should be saved
+    But record 997 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 998
+    Given record 998 exists
+    And record 998 has value 6986
+    When record 998 is updated
+    Then record 998 should be saved
+    But record 998 should not be duplicated
+
+  @synthetic
+  Scenario: Synthetic scenario 999
+    Given record 999 exists
+    And record 999 has value 6993
+    When record 999 is updated
+    Then record 999 should be saved
+    But record 999 should not be duplicated
+
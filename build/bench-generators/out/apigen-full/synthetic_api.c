@@ -0,0 +1,3042 @@
+/* AUTO-GENERATED by apigen 1.0.0 — DO NOT EDIT */
+
+#include "synthetic_api.h"
+#include <string.h>
+
+static const char *error_strings[] = {
+    "OK",
+    "Invalid input",
+    "Not found",
+    "Internal error",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+};
+
+static const Synthetic_route_t routes[] = {
+    {"GET", "/r0/{id}", Synthetic_op0},
+    {"POST", "/r1/{id}", Synthetic_op1},
+    {"PUT", "/r2/{id}", Synthetic_op2},
+    {"DELETE", "/r3/{id}", Synthetic_op3},
+    {"PATCH", "/r4/{id}", Synthetic_op4},
+    {"GET", "/r5/{id}", Synthetic_op5},
+    {"POST", "/r6/{id}", Synthetic_op6},
+    {"PUT", "/r7/{id}", Synthetic_op7},
+    {"DELETE", "/r8/{id}", Synthetic_op8},
+    {"PATCH", "/r9/{id}", Synthetic_op9},
+    {"GET", "/r10/{id}", Synthetic_op10},
+    {"POST", "/r11/{id}", Synthetic_op11},
+    {"PUT", "/r12/{id}", Synthetic_op12},
+    {"DELETE", "/r13/{id}", Synthetic_op13},
+    {"PATCH", "/r14/{id}", Synthetic_op14},
+    {"GET", "/r15/{id}", Synthetic_op15},
+    {"POST", "/r16/{id}", Synthetic_op16},
+    {"PUT", "/r17/{id}", Synthetic_op17},
+    {"DELETE", "/r18/{id}", Synthetic_op18},
+    {"PATCH", "/r19/{id}", Synthetic_op19},
+    {"GET", "/r20/{id}", Synthetic_op20},
+    {"POST", "/r21/{id}", Synthetic_op21},
+    {"PUT", "/r22/{id}", Synthetic_op22},
+    {"DELETE", "/r23/{id}", Synthetic_op23},
+    {"PATCH", "/r24/{id}", Synthetic_op24},
+    {"GET", "/r25/{id}", Synthetic_op25},
+    {"POST", "/r26/{id}", Synthetic_op26},
+    {"PUT", "/r27/{id}", Synthetic_op27},
+    {"DELETE", "/r28/{id}", Synthetic_op28},
+    {"PATCH", "/r29/{id}", Synthetic_op29},
+    {"GET", "/r30/{id}", Synthetic_op30},
+    {"POST", "/r31/{id}", Synthetic_op31},
+    {"PUT", "/r32/{id}", Synthetic_op32},
+    {"DELETE", "/r33/{id}", Synthetic_op33},
+    {"PATCH", "/r34/{id}", Synthetic_op34},
+    {"GET", "/r35/{id}", Synthetic_op35},
+    {"POST", "/r36/{id}", Synthetic_op36},
+    {"PUT", "/r37/{id}", Synthetic_op37},
+    {"DELETE", "/r38/{id}", Synthetic_op38},
+    {"PATCH", "/r39/{id}", Synthetic_op39},
+    {"GET", "/r40/{id}", Synthetic_op40},
+    {"POST", "/r41/{id}", Synthetic_op41},
+    {"PUT", "/r42/{id}", Synthetic_op42},
+    {"DELETE", "/r43/{id}", Synthetic_op43},
+    {"PATCH", "/r44/{id}", Synthetic_op44},
+    {"GET", "/r45/{id}", Synthetic_op45},
+    {"POST", "/r46/{id}", Synthetic_op46},
+    {"PUT", "/r47/{id}", Synthetic_op47},
+    {"DELETE", "/r48/{id}", Synthetic_op48},
+    {"PATCH", "/r49/{id}", Synthetic_op49},
+    {"GET", "/r50/{id}", Synthetic_op50},
+    {"POST", "/r51/{id}", Synthetic_op51},
+    {"PUT", "/r52/{id}", Synthetic_op52},
+    {"DELETE", "/r53/{id}", Synthetic_op53},
+    {"PATCH", "/r54/{id}", Synthetic_op54},
+    {"GET", "/r55/{id}", Synthetic_op55},
+    {"POST", "/r56/{id}", Synthetic_op56},
+    {"PUT", "/r57/{id}", Synthetic_op57},
+    {"DELETE", "/r58/{id}", Synthetic_op58},
+    {"PATCH", "/r59/{id}", Synthetic_op59},
+    {"GET", "/r60/{id}", Synthetic_op60},
+    {"POST", "/r61/{id}", Synthetic_op61},
+    {"PUT", "/r62/{id}", Synthetic_op62},
+    {"DELETE", "/r63/{id}", Synthetic_op63},
+    {"PATCH", "/r64/{id}", Synthetic_op64},
+    {"GET", "/r65/{id}", Synthetic_op65},
+    {"POST", "/r66/{id}", Synthetic_op66},
+    {"PUT", "/r67/{id}", Synthetic_op67},
+    {"DELETE", "/r68/{id}", Synthetic_op68},
+    {"PATCH", "/r69/{id}", Synthetic_op69},
+    {"GET", "/r70/{id}", Synthetic_op70},
+    {"POST", "/r71/{id}", Synthetic_op71},
+    {"PUT", "/r72/{id}", Synthetic_op72},
+    {"DELETE", "/r73/{id}", Synthetic_op73},
+    {"PATCH", "/r74/{id}", Synthetic_op74},
+    {"GET", "/r75/{id}", Synthetic_op75},
+    {"POST", "/r76/{id}", Synthetic_op76},
+    {"PUT", "/r77/{id}", Synthetic_op77},
+    {"DELETE", "/r78/{id}", Synthetic_op78},
+    {"PATCH", "/r79/{id}", Synthetic_op79},
+    {"GET", "/r80/{id}", Synthetic_op80},
+    {"POST", "/r81/{id}", Synthetic_op81},
+    {"PUT", "/r82/{id}", Synthetic_op82},
+    {"DELETE", "/r83/{id}", Synthetic_op83},
+    {"PATCH", "/r84/{id}", Synthetic_op84},
+    {"GET", "/r85/{id}", Synthetic_op85},
+    {"POST", "/r86/{id}", Synthetic_op86},
+    {"PUT", "/r87/{id}", Synthetic_op87},
+    {"DELETE", "/r88/{id}", Synthetic_op88},
+    {"PATCH", "/r89/{id}", Synthetic_op89},
+    {"GET", "/r90/{id}", Synthetic_op90},
+    {"POST", "/r91/{id}", Synthetic_op91},
+    {"PUT", "/r92/{id}", Synthetic_op92},
+    {"DELETE", "/r93/{id}", Synthetic_op93},
+    {"PATCH", "/r94/{id}", Synthetic_op94},
+    {"GET", "/r95/{id}", Synthetic_op95},
+    {"POST", "/r96/{id}", Synthetic_op96},
+    {"PUT", "/r97/{id}", Synthetic_op97},
+    {"DELETE", "/r98/{id}", Synthetic_op98},
+    {"PATCH", "/r99/{id}", Synthetic_op99},
+    {"GET", "/r100/{id}", Synthetic_op100},
+    {"POST", "/r101/{id}", Synthetic_op101},
+    {"PUT", "/r102/{id}", Synthetic_op102},
+    {"DELETE", "/r103/{id}", Synthetic_op103},
+    {"PATCH", "/r104/{id}", Synthetic_op104},
+    {"GET", "/r105/{id}", Synthetic_op105},
+    {"POST", "/r106/{id}", Synthetic_op106},
+    {"PUT", "/r107/{id}", Synthetic_op107},
+    {"DELETE", "/r108/{id}", Synthetic_op108},
+    {"PATCH", "/r109/{id}", Synthetic_op109},
+    {"GET", "/r110/{id}", Synthetic_op110},
+    {"POST", "/r111/{id}", Synthetic_op111},
+    {"PUT", "/r112/{id}", Synthetic_op112},
+    {"DELETE", "/r113/{id}", Synthetic_op113},
+    {"PATCH", "/r114/{id}", Synthetic_op114},
+    {"GET", "/r115/{id}", Synthetic_op115},
+    {"POST", "/r116/{id}", Synthetic_op116},
+    {"PUT", "/r117/{id}", Synthetic_op117},
+    {"DELETE", "/r118/{id}", Synthetic_op118},
+    {"PATCH", "/r119/{id}", Synthetic_op119},
+    {"GET", "/r120/{id}", Synthetic_op120},
+    {"POST", "/r121/{id}", Synthetic_op121},
+    {"PUT", "/r122/{id}", Synthetic_op122},
+    {"DELETE", "/r123/{id}", Synthetic_op123},
+    {"PATCH", "/r124/{id}", Synthetic_op124},
+    {"GET", "/r125/{id}", Synthetic_op125},
+    {"POST", "/r126/{id}", Synthetic_op126},
+    {"PUT", "/r127/{id}", Synthetic_op127},
+    {"DELETE", "/r128/{id}", Synthetic_op128},
+    {"PATCH", "/r129/{id}", Synthetic_op129},
+    {"GET", "/r130/{id}", Synthetic_op130},
+    {"POST", "/r131/{id}", Synthetic_op131},
+    {"PUT", "/r132/{id}", Synthetic_op132},
+    {"DELETE", "/r133/{id}", Synthetic_op133},
+    {"PATCH", "/r134/{id}", Synthetic_op134},
+    {"GET", "/r135/{id}", Synthetic_op135},
+    {"POST", "/r136/{id}", Synthetic_op136},
+    {"PUT", "/r137/{id}", Synthetic_op137},
+    {"DELETE", "/r138/{id}", Synthetic_op138},
+    {"PATCH", "/r139/{id}", Synthetic_op139},
+    {"GET", "/r140/{id}", Synthetic_op140},
+    {"POST", "/r141/{id}", Synthetic_op141},
+    {"PUT", "/r142/{id}", Synthetic_op142},
+    {"DELETE", "/r143/{id}", Synthetic_op143},
+    {"PATCH", "/r144/{id}", Synthetic_op144},
+    {"GET", "/r145/{id}", Synthetic_op145},
+    {"POST", "/r146/{id}", Synthetic_op146},
+    {"PUT", "/r147/{id}", Synthetic_op147},
+    {"DELETE", "/r148/{id}", Synthetic_op148},
+    {"PATCH", "/r149/{id}", Synthetic_op149},
+    {"GET", "/r150/{id}", Synthetic_op150},
+    {"POST", "/r151/{id}", Synthetic_op151},
+    {"PUT", "/r152/{id}", Synthetic_op152},
+    {"DELETE", "/r153/{id}", Synthetic_op153},
+    {"PATCH", "/r154/{id}", Synthetic_op154},
+    {"GET", "/r155/{id}", Synthetic_op155},
+    {"POST", "/r156/{id}", Synthetic_op156},
+    {"PUT", "/r157/{id}", Synthetic_op157},
+    {"DELETE", "/r158/{id}", Synthetic_op158},
+    {"PATCH", "/r159/{id}", Synthetic_op159},
+    {"GET", "/r160/{id}", Synthetic_op160},
+    {"POST", "/r161/{id}", Synthetic_op161},
+    {"PUT", "/r162/{id}", Synthetic_op162},
+    {"DELETE", "/r163/{id}", Synthetic_op163},
+    {"PATCH", "/r164/{id}", Synthetic_op164},
+    {"GET", "/r165/{id}", Synthetic_op165},
+    {"POST", "/r166/{id}", Synthetic_op166},
+    {"PUT", "/r167/{id}", Synthetic_op167},
+    {"DELETE", "/r168/{id}", Synthetic_op168},
+    {"PATCH", "/r169/{id}", Synthetic_op169},
+    {"GET", "/r170/{id}", Synthetic_op170},
+    {"POST", "/r171/{id}", Synthetic_op171},
+    {"PUT", "/r172/{id}", Synthetic_op172},
+    {"DELETE", "/r173/{id}", Synthetic_op173},
+    {"PATCH", "/r174/{id}", Synthetic_op174},
+    {"GET", "/r175/{id}", Synthetic_op175},
+    {"POST", "/r176/{id}", Synthetic_op176},
+    {"PUT", "/r177/{id}", Synthetic_op177},
+    {"DELETE", "/r178/{id}", Synthetic_op178},
+    {"PATCH", "/r179/{id}", Synthetic_op179},
+    {"GET", "/r180/{id}", Synthetic_op180},
+    {"POST", "/r181/{id}", Synthetic_op181},
+    {"PUT", "/r182/{id}", Synthetic_op182},
+    {"DELETE", "/r183/{id}", Synthetic_op183},
+    {"PATCH", "/r184/{id}", Synthetic_op184},
+    {"GET", "/r185/{id}", Synthetic_op185},
+    {"POST", "/r186/{id}", Synthetic_op186},
+    {"PUT", "/r187/{id}", Synthetic_op187},
+    {"DELETE", "/r188/{id}", Synthetic_op188},
+    {"PATCH", "/r189/{id}", Synthetic_op189},
+    {"GET", "/r190/{id}", Synthetic_op190},
+    {"POST", "/r191/{id}", Synthetic_op191},
+    {"PUT", "/r192/{id}", Synthetic_op192},
+    {"DELETE", "/r193/{id}", Synthetic_op193},
+    {"PATCH", "/r194/{id}", Synthetic_op194},
+    {"GET", "/r195/{id}", Synthetic_op195},
+    {"POST", "/r196/{id}", Synthetic_op196},
+    {"PUT", "/r197/{id}", Synthetic_op197},
+    {"DELETE", "/r198/{id}", Synthetic_op198},
+    {"PATCH", "/r199/{id}", Synthetic_op199},
+    {"GET", "/r200/{id}", Synthetic_op200},
+    {"POST", "/r201/{id}", Synthetic_op201},
+    {"PUT", "/r202/{id}", Synthetic_op202},
+    {"DELETE", "/r203/{id}", Synthetic_op203},
+    {"PATCH", "/r204/{id}", Synthetic_op204},
+    {"GET", "/r205/{id}", Synthetic_op205},
+    {"POST", "/r206/{id}", Synthetic_op206},
+    {"PUT", "/r207/{id}", Synthetic_op207},
+    {"DELETE", "/r208/{id}", Synthetic_op208},
+    {"PATCH", "/r209/{id}", Synthetic_op209},
+    {"GET", "/r210/{id}", Synthetic_op210},
+    {"POST", "/r211/{id}", Synthetic_op211},
+    {"PUT", "/r212/{id}", Synthetic_op212},
+    {"DELETE", "/r213/{id}", Synthetic_op213},
+    {"PATCH", "/r214/{id}", Synthetic_op214},
+    {"GET", "/r215/{id}", Synthetic_op215},
+    {"POST", "/r216/{id}", Synthetic_op216},
+    {"PUT", "/r217/{id}", Synthetic_op217},
+    {"DELETE", "/r218/{id}", Synthetic_op218},
+    {"PATCH", "/r219/{id}", Synthetic_op219},
+    {"GET", "/r220/{id}", Synthetic_op220},
+    {"POST", "/r221/{id}", Synthetic_op221},
+    {"PUT", "/r222/{id}", Synthetic_op222},
+    {"DELETE", "/r223/{id}", Synthetic_op223},
+    {"PATCH", "/r224/{id}", Synthetic_op224},
+    {"GET", "/r225/{id}", Synthetic_op225},
+    {"POST", "/r226/{id}", Synthetic_op226},
+    {"PUT", "/r227/{id}", Synthetic_op227},
+    {"DELETE", "/r228/{id}", Synthetic_op228},
+    {"PATCH", "/r229/{id}", Synthetic_op229},
+    {"GET", "/r230/{id}", Synthetic_op230},
+    {"POST", "/r231/{id}", Synthetic_op231},
+    {"PUT", "/r232/{id}", Synthetic_op232},
+    {"DELETE", "/r233/{id}", Synthetic_op233},
+    {"PATCH", "/r234/{id}", Synthetic_op234},
+    {"GET", "/r235/{id}", Synthetic_op235},
+    {"POST", "/r236/{id}", Synthetic_op236},
+    {"PUT", "/r237/{id}", Synthetic_op237},
+    {"DELETE", "/r238/{id}", Synthetic_op238},
+    {"PATCH", "/r239/{id}", Synthetic_op239},
+    {"GET", "/r240/{id}", Synthetic_op240},
+    {"POST", "/r241/{id}", Synthetic_op241},
+    {"PUT", "/r242/{id}", Synthetic_op242},
+    {"DELETE", "/r243/{id}", Synthetic_op243},
+    {"PATCH", "/r244/{id}", Synthetic_op244},
+    {"GET", "/r245/{id}", Synthetic_op245},
+    {"POST", "/r246/{id}", Synthetic_op246},
+    {"PUT", "/r247/{id}", Synthetic_op247},
+    {"DELETE", "/r248/{id}", Synthetic_op248},
+    {"PATCH", "/r249/{id}", Synthetic_op249},
+    {"GET", "/r250/{id}", Synthetic_op250},
+    {"POST", "/r251/{id}", Synthetic_op251},
+    {"PUT", "/r252/{id}", Synthetic_op252},
+    {"DELETE", "/r253/{id}", Synthetic_op253},
+    {"PATCH", "/r254/{id}", Synthetic_op254},
+    {"GET", "/r255/{id}", Synthetic_op255},
+    {"POST", "/r256/{id}", Synthetic_op256},
+    {"PUT", "/r257/{id}", Synthetic_op257},
+    {"DELETE", "/r258/{id}", Synthetic_op258},
+    {"PATCH", "/r259/{id}", Synthetic_op259},
+    {"GET", "/r260/{id}", Synthetic_op260},
+    {"POST", "/r261/{id}", Synthetic_op261},
+    {"PUT", "/r262/{id}", Synthetic_op262},
+    {"DELETE", "/r263/{id}", Synthetic_op263},
+    {"PATCH", "/r264/{id}", Synthetic_op264},
+    {"GET", "/r265/{id}", Synthetic_op265},
+    {"POST", "/r266/{id}", Synthetic_op266},
+    {"PUT", "/r267/{id}", Synthetic_op267},
+    {"DELETE", "/r268/{id}", Synthetic_op268},
+    {"PATCH", "/r269/{id}", Synthetic_op269},
+    {"GET", "/r270/{id}", Synthetic_op270},
+    {"POST", "/r271/{id}", Synthetic_op271},
+    {"PUT", "/r272/{id}", Synthetic_op272},
+    {"DELETE", "/r273/{id}", Synthetic_op273},
+    {"PATCH", "/r274/{id}", Synthetic_op274},
+    {"GET", "/r275/{id}", Synthetic_op275},
+    {"POST", "/r276/{id}", Synthetic_op276},
+    {"PUT", "/r277/{id}", Synthetic_op277},
+    {"DELETE", "/r278/{id}", Synthetic_op278},
+    {"PATCH", "/r279/{id}", Synthetic_op279},
+    {"GET", "/r280/{id}", Synthetic_op280},
+    {"POST", "/r281/{id}", Synthetic_op281},
+    {"PUT", "/r282/{id}", Synthetic_op282},
+    {"DELETE", "/r283/{id}", Synthetic_op283},
+    {"PATCH", "/r284/{id}", Synthetic_op284},
+    {"GET", "/r285/{id}", Synthetic_op285},
+    {"POST", "/r286/{id}", Synthetic_op286},
+    {"PUT", "/r287/{id}", Synthetic_op287},
+    {"DELETE", "/r288/{id}", Synthetic_op288},
+    {"PATCH", "/r289/{id}", Synthetic_op289},
+    {"GET", "/r290/{id}", Synthetic_op290},
+    {"POST", "/r291/{id}", Synthetic_op291},
+    {"PUT", "/r292/{id}", Synthetic_op292},
+    {"DELETE", "/r293/{id}", Synthetic_op293},
+    {"PATCH", "/r294/{id}", Synthetic_op294},
+    {"GET", "/r295/{id}", Synthetic_op295},
+    {"POST", "/r296/{id}", Synthetic_op296},
+    {"PUT", "/r297/{id}", Synthetic_op297},
+    {"DELETE", "/r298/{id}", Synthetic_op298},
+    {"PATCH", "/r299/{id}", Synthetic_op299},
+    {"GET", "/r300/{id}", Synthetic_op300},
+    {"POST", "/r301/{id}", Synthetic_op301},
+    {"PUT", "/r302/{id}", Synthetic_op302},
+    {"DELETE", "/r303/{id}", Synthetic_op303},
+    {"PATCH", "/r304/{id}", Synthetic_op304},
+    {"GET", "/r305/{id}", Synthetic_op305},
+    {"POST", "/r306/{id}", Synthetic_op306},
+    {"PUT", "/r307/{id}", Synthetic_op307},
+    {"DELETE", "/r308/{id}", Synthetic_op308},
+    {"PATCH", "/r309/{id}", Synthetic_op309},
+    {"GET", "/r310/{id}", Synthetic_op310},
+    {"POST", "/r311/{id}", Synthetic_op311},
+    {"PUT", "/r312/{id}", Synthetic_op312},
+    {"DELETE", "/r313/{id}", Synthetic_op313},
+    {"PATCH", "/r314/{id}", Synthetic_op314},
+    {"GET", "/r315/{id}", Synthetic_op315},
+    {"POST", "/r316/{id}", Synthetic_op316},
+    {"PUT", "/r317/{id}", Synthetic_op317},
+    {"DELETE", "/r318/{id}", Synthetic_op318},
+    {"PATCH", "/r319/{id}", Synthetic_op319},
+    {"GET", "/r320/{id}", Synthetic_op320},
+    {"POST", "/r321/{id}", Synthetic_op321},
+    {"PUT", "/r322/{id}", Synthetic_op322},
+    {"DELETE", "/r323/{id}", Synthetic_op323},
+    {"PATCH", "/r324/{id}", Synthetic_op324},
+    {"GET", "/r325/{id}", Synthetic_op325},
+    {"POST", "/r326/{id}", Synthetic_op326},
+    {"PUT", "/r327/{id}", Synthetic_op327},
+    {"DELETE", "/r328/{id}", Synthetic_op328},
+    {"PATCH", "/r329/{id}", Synthetic_op329},
+    {"GET", "/r330/{id}", Synthetic_op330},
+    {"POST", "/r331/{id}", Synthetic_op331},
+    {"PUT", "/r332/{id}", Synthetic_op332},
+    {"DELETE", "/r333/{id}", Synthetic_op333},
+    {"PATCH", "/r334/{id}", Synthetic_op334},
+    {"GET", "/r335/{id}", Synthetic_op335},
+    {"POST", "/r336/{id}", Synthetic_op336},
+    {"PUT", "/r337/{id}", Synthetic_op337},
+    {"DELETE", "/r338/{id}", Synthetic_op338},
+    {"PATCH", "/r339/{id}", Synthetic_op339},
+    {"GET", "/r340/{id}", Synthetic_op340},
+    {"POST", "/r341/{id}", Synthetic_op341},
+    {"PUT", "/r342/{id}", Synthetic_op342},
+    {"DELETE", "/r343/{id}", Synthetic_op343},
+    {"PATCH", "/r344/{id}", Synthetic_op344},
+    {"GET", "/r345/{id}", Synthetic_op345},
+    {"POST", "/r346/{id}", Synthetic_op346},
+    {"PUT", "/r347/{id}", Synthetic_op347},
+    {"DELETE", "/r348/{id}", Synthetic_op348},
+    {"PATCH", "/r349/{id}", Synthetic_op349},
+    {"GET", "/r350/{id}", Synthetic_op350},
+    {"POST", "/r351/{id}", Synthetic_op351},
+    {"PUT", "/r352/{id}", Synthetic_op352},
+    {"DELETE", "/r353/{id}", Synthetic_op353},
+    {"PATCH", "/r354/{id}", Synthetic_op354},
+    {"GET", "/r355/{id}", Synthetic_op355},
+    {"POST", "/r356/{id}", Synthetic_op356},
+    {"PUT", "/r357/{id}", Synthetic_op357},
+    {"DELETE", "/r358/{id}", Synthetic_op358},
+    {"PATCH", "/r359/{id}", Synthetic_op359},
+    {"GET", "/r360/{id}", Synthetic_op360},
+    {"POST", "/r361/{id}", Synthetic_op361},
+    {"PUT", "/r362/{id}", Synthetic_op362},
+    {"DELETE", "/r363/{id}", Synthetic_op363},
+    {"PATCH", "/r364/{id}", Synthetic_op364},
+    {"GET", "/r365/{id}", Synthetic_op365},
+    {"POST", "/r366/{id}", Synthetic_op366},
+    {"PUT", "/r367/{id}", Synthetic_op367},
+    {"DELETE", "/r368/{id}", Synthetic_op368},
+    {"PATCH", "/r369/{id}", Synthetic_op369},
+    {"GET", "/r370/{id}", Synthetic_op370},
+    {"POST", "/r371/{id}", Synthetic_op371},
+    {"PUT", "/r372/{id}", Synthetic_op372},
+    {"DELETE", "/r373/{id}", Synthetic_op373},
+    {"PATCH", "/r374/{id}", Synthetic_op374},
+    {"GET", "/r375/{id}", Synthetic_op375},
+    {"POST", "/r376/{id}", Synthetic_op376},
+    {"PUT", "/r377/{id}", Synthetic_op377},
+    {"DELETE", "/r378/{id}", Synthetic_op378},
+    {"PATCH", "/r379/{id}", Synthetic_op379},
+    {"GET", "/r380/{id}", Synthetic_op380},
+    {"POST", "/r381/{id}", Synthetic_op381},
+    {"PUT", "/r382/{id}", Synthetic_op382},
+    {"DELETE", "/r383/{id}", Synthetic_op383},
+    {"PATCH", "/r384/{id}", Synthetic_op384},
+    {"GET", "/r385/{id}", Synthetic_op385},
+    {"POST", "/r386/{id}", Synthetic_op386},
+    {"PUT", "/r387/{id}", Synthetic_op387},
+    {"DELETE", "/r388/{id}", Synthetic_op388},
+    {"PATCH", "/r389/{id}", Synthetic_op389},
+    {"GET", "/r390/{id}", Synthetic_op390},
+    {"POST", "/r391/{id}", Synthetic_op391},
+    {"PUT", "/r392/{id}", Synthetic_op392},
+    {"DELETE", "/r393/{id}", Synthetic_op393},
+    {"PATCH", "/r394/{id}", Synthetic_op394},
+    {"GET", "/r395/{id}", Synthetic_op395},
+    {"POST", "/r396/{id}", Synthetic_op396},
+    {"PUT", "/r397/{id}", Synthetic_op397},
+    {"DELETE", "/r398/{id}", Synthetic_op398},
+    {"PATCH", "/r399/{id}", Synthetic_op399},
+    {"GET", "/r400/{id}", Synthetic_op400},
+    {"POST", "/r401/{id}", Synthetic_op401},
+    {"PUT", "/r402/{id}", Synthetic_op402},
+    {"DELETE", "/r403/{id}", Synthetic_op403},
+    {"PATCH", "/r404/{id}", Synthetic_op404},
+    {"GET", "/r405/{id}", Synthetic_op405},
+    {"POST", "/r406/{id}", Synthetic_op406},
+    {"PUT", "/r407/{id}", Synthetic_op407},
+    {"DELETE", "/r408/{id}", Synthetic_op408},
+    {"PATCH", "/r409/{id}", Synthetic_op409},
+    {"GET", "/r410/{id}", Synthetic_op410},
+    {"POST", "/r411/{id}", Synthetic_op411},
+    {"PUT", "/r412/{id}", Synthetic_op412},
+    {"DELETE", "/r413/{id}", Synthetic_op413},
+    {"PATCH", "/r414/{id}", Synthetic_op414},
+    {"GET", "/r415/{id}", Synthetic_op415},
+    {"POST", "/r416/{id}", Synthetic_op416},
+    {"PUT", "/r417/{id}", Synthetic_op417},
+    {"DELETE", "/r418/{id}", Synthetic_op418},
+    {"PATCH", "/r419/{id}", Synthetic_op419},
+    {"GET", "/r420/{id}", Synthetic_op420},
+    {"POST", "/r421/{id}", Synthetic_op421},
+    {"PUT", "/r422/{id}", Synthetic_op422},
+    {"DELETE", "/r423/{id}", Synthetic_op423},
+    {"PATCH", "/r424/{id}", Synthetic_op424},
+    {"GET", "/r425/{id}", Synthetic_op425},
+    {"POST", "/r426/{id}", Synthetic_op426},
+    {"PUT", "/r427/{id}", Synthetic_op427},
+    {"DELETE", "/r428/{id}", Synthetic_op428},
+    {"PATCH", "/r429/{id}", Synthetic_op429},
+    {"GET", "/r430/{id}", Synthetic_op430},
+    {"POST", "/r431/{id}", Synthetic_op431},
+    {"PUT", "/r432/{id}", Synthetic_op432},
+    {"DELETE", "/r433/{id}", Synthetic_op433},
+    {"PATCH", "/r434/{id}", Synthetic_op434},
+    {"GET", "/r435/{id}", Synthetic_op435},
+    {"POST", "/r436/{id}", Synthetic_op436},
+    {"PUT", "/r437/{id}", Synthetic_op437},
+    {"DELETE", "/r438/{id}", Synthetic_op438},
+    {"PATCH", "/r439/{id}", Synthetic_op439},
+    {"GET", "/r440/{id}", Synthetic_op440},
+    {"POST", "/r441/{id}", Synthetic_op441},
+    {"PUT", "/r442/{id}", Synthetic_op442},
+    {"DELETE", "/r443/{id}", Synthetic_op443},
+    {"PATCH", "/r444/{id}", Synthetic_op444},
+    {"GET", "/r445/{id}", Synthetic_op445},
+    {"POST", "/r446/{id}", Synthetic_op446},
+    {"PUT", "/r447/{id}", Synthetic_op447},
+    {"DELETE", "/r448/{id}", Synthetic_op448},
+    {"PATCH", "/r449/{id}", Synthetic_op449},
+    {"GET", "/r450/{id}", Synthetic_op450},
+    {"POST", "/r451/{id}", Synthetic_op451},
+    {"PUT", "/r452/{id}", Synthetic_op452},
+    {"DELETE", "/r453/{id}", Synthetic_op453},
+    {"PATCH", "/r454/{id}", Synthetic_op454},
+    {"GET", "/r455/{id}", Synthetic_op455},
+    {"POST", "/r456/{id}", Synthetic_op456},
+    {"PUT", "/r457/{id}", Synthetic_op457},
+    {"DELETE", "/r458/{id}", Synthetic_op458},
+    {"PATCH", "/r459/{id}", Synthetic_op459},
+    {"GET", "/r460/{id}", Synthetic_op460},
+    {"POST", "/r461/{id}", Synthetic_op461},
+    {"PUT", "/r462/{id}", Synthetic_op462},
+    {"DELETE", "/r463/{id}", Synthetic_op463},
+    {"PATCH", "/r464/{id}", Synthetic_op464},
+    {"GET", "/r465/{id}", Synthetic_op465},
+    {"POST", "/r466/{id}", Synthetic_op466},
+    {"PUT", "/r467/{id}", Synthetic_op467},
+    {"DELETE", "/r468/{id}", Synthetic_op468},
+    {"PATCH", "/r469/{id}", Synthetic_op469},
+    {"GET", "/r470/{id}", Synthetic_op470},
+    {"POST", "/r471/{id}", Synthetic_op471},
+    {"PUT", "/r472/{id}", Synthetic_op472},
+    {"DELETE", "/r473/{id}", Synthetic_op473},
+    {"PATCH", "/r474/{id}", Synthetic_op474},
+    {"GET", "/r475/{id}", Synthetic_op475},
+    {"POST", "/r476/{id}", Synthetic_op476},
+    {"PUT", "/r477/{id}", Synthetic_op477},
+    {"DELETE", "/r478/{id}", Synthetic_op478},
+    {"PATCH", "/r479/{id}", Synthetic_op479},
+    {"GET", "/r480/{id}", Synthetic_op480},
+    {"POST", "/r481/{id}", Synthetic_op481},
+    {"PUT", "/r482/{id}", Synthetic_op482},
+    {"DELETE", "/r483/{id}", Synthetic_op483},
+    {"PATCH", "/r484/{id}", Synthetic_op484},
+    {"GET", "/r485/{id}", Synthetic_op485},
+    {"POST", "/r486/{id}", Synthetic_op486},
+    {"PUT", "/r487/{id}", Synthetic_op487},
+    {"DELETE", "/r488/{id}", Synthetic_op488},
+    {"PATCH", "/r489/{id}", Synthetic_op489},
+    {"GET", "/r490/{id}", Synthetic_op490},
+    {"POST", "/r491/{id}", Synthetic_op491},
+    {"PUT", "/r492/{id}", Synthetic_op492},
+    {"DELETE", "/r493/{id}", Synthetic_op493},
+    {"PATCH", "/r494/{id}", Synthetic_op494},
+    {"GET", "/r495/{id}", Synthetic_op495},
+    {"POST", "/r496/{id}", Synthetic_op496},
+    {"PUT", "/r497/{id}", Synthetic_op497},
+    {"DELETE", "/r498/{id}", Synthetic_op498},
+    {"PATCH", "/r499/{id}", Synthetic_op499},
+    {"GET", "/r500/{id}", Synthetic_op500},
+    {"POST", "/r501/{id}", Synthetic_op501},
+    {"PUT", "/r502/{id}", Synthetic_op502},
+    {"DELETE", "/r503/{id}", Synthetic_op503},
+    {"PATCH", "/r504/{id}", Synthetic_op504},
+    {"GET", "/r505/{id}", Synthetic_op505},
+    {"POST", "/r506/{id}", Synthetic_op506},
+    {"PUT", "/r507/{id}", Synthetic_op507},
+    {"DELETE", "/r508/{id}", Synthetic_op508},
+    {"PATCH", "/r509/{id}", Synthetic_op509},
+    {"GET", "/r510/{id}", Synthetic_op510},
+    {"POST", "/r511/{id}", Synthetic_op511},
+    {"PUT", "/r512/{id}", Synthetic_op512},
+    {"DELETE", "/r513/{id}", Synthetic_op513},
+    {"PATCH", "/r514/{id}", Synthetic_op514},
+    {"GET", "/r515/{id}", Synthetic_op515},
+    {"POST", "/r516/{id}", Synthetic_op516},
+    {"PUT", "/r517/{id}", Synthetic_op517},
+    {"DELETE", "/r518/{id}", Synthetic_op518},
+    {"PATCH", "/r519/{id}", Synthetic_op519},
+    {"GET", "/r520/{id}", Synthetic_op520},
+    {"POST", "/r521/{id}", Synthetic_op521},
+    {"PUT", "/r522/{id}", Synthetic_op522},
+    {"DELETE", "/r523/{id}", Synthetic_op523},
+    {"PATCH", "/r524/{id}", Synthetic_op524},
+    {"GET", "/r525/{id}", Synthetic_op525},
+    {"POST", "/r526/{id}", Synthetic_op526},
+    {"PUT", "/r527/{id}", Synthetic_op527},
+    {"DELETE", "/r528/{id}", Synthetic_op528},
+    {"PATCH", "/r529/{id}", Synthetic_op529},
+    {"GET", "/r530/{id}", Synthetic_op530},
+    {"POST", "/r531/{id}", Synthetic_op531},
+    {"PUT", "/r532/{id}", Synthetic_op532},
+    {"DELETE", "/r533/{id}", Synthetic_op533},
+    {"PATCH", "/r534/{id}", Synthetic_op534},
+    {"GET", "/r535/{id}", Synthetic_op535},
+    {"POST", "/r536/{id}", Synthetic_op536},
+    {"PUT", "/r537/{id}", Synthetic_op537},
+    {"DELETE", "/r538/{id}", Synthetic_op538},
+    {"PATCH", "/r539/{id}", Synthetic_op539},
+    {"GET", "/r540/{id}", Synthetic_op540},
+    {"POST", "/r541/{id}", Synthetic_op541},
+    {"PUT", "/r542/{id}", Synthetic_op542},
+    {"DELETE", "/r543/{id}", Synthetic_op543},
+    {"PATCH", "/r544/{id}", Synthetic_op544},
+    {"GET", "/r545/{id}", Synthetic_op545},
+    {"POST", "/r546/{id}", Synthetic_op546},
+    {"PUT", "/r547/{id}", Synthetic_op547},
+    {"DELETE", "/r548/{id}", Synthetic_op548},
+    {"PATCH", "/r549/{id}", Synthetic_op549},
+    {"GET", "/r550/{id}", Synthetic_op550},
+    {"POST", "/r551/{id}", Synthetic_op551},
+    {"PUT", "/r552/{id}", Synthetic_op552},
+    {"DELETE", "/r553/{id}", Synthetic_op553},
+    {"PATCH", "/r554/{id}", Synthetic_op554},
+    {"GET", "/r555/{id}", Synthetic_op555},
+    {"POST", "/r556/{id}", Synthetic_op556},
+    {"PUT", "/r557/{id}", Synthetic_op557},
+    {"DELETE", "/r558/{id}", Synthetic_op558},
+    {"PATCH", "/r559/{id}", Synthetic_op559},
+    {"GET", "/r560/{id}", Synthetic_op560},
+    {"POST", "/r561/{id}", Synthetic_op561},
+    {"PUT", "/r562/{id}", Synthetic_op562},
+    {"DELETE", "/r563/{id}", Synthetic_op563},
+    {"PATCH", "/r564/{id}", Synthetic_op564},
+    {"GET", "/r565/{id}", Synthetic_op565},
+    {"POST", "/r566/{id}", Synthetic_op566},
+    {"PUT", "/r567/{id}", Synthetic_op567},
+    {"DELETE", "/r568/{id}", Synthetic_op568},
+    {"PATCH", "/r569/{id}", Synthetic_op569},
+    {"GET", "/r570/{id}", Synthetic_op570},
+    {"POST", "/r571/{id}", Synthetic_op571},
+    {"PUT", "/r572/{id}", Synthetic_op572},
+    {"DELETE", "/r573/{id}", Synthetic_op573},
+    {"PATCH", "/r574/{id}", Synthetic_op574},
+    {"GET", "/r575/{id}", Synthetic_op575},
+    {"POST", "/r576/{id}", Synthetic_op576},
+    {"PUT", "/r577/{id}", Synthetic_op577},
+    {"DELETE", "/r578/{id}", Synthetic_op578},
+    {"PATCH", "/r579/{id}", Synthetic_op579},
+    {"GET", "/r580/{id}", Synthetic_op580},
+    {"POST", "/r581/{id}", Synthetic_op581},
+    {"PUT", "/r582/{id}", Synthetic_op582},
+    {"DELETE", "/r583/{id}", Synthetic_op583},
+    {"PATCH", "/r584/{id}", Synthetic_op584},
+    {"GET", "/r585/{id}", Synthetic_op585},
+    {"POST", "/r586/{id}", Synthetic_op586},
+    {"PUT", "/r587/{id}", Synthetic_op587},
+    {"DELETE", "/r588/{id}", Synthetic_op588},
+    {"PATCH", "/r589/{id}", Synthetic_op589},
+    {"GET", "/r590/{id}", Synthetic_op590},
+    {"POST", "/r591/{id}", Synthetic_op591},
+    {"PUT", "/r592/{id}", Synthetic_op592},
+    {"DELETE", "/r593/{id}", Synthetic_op593},
+    {"PATCH", "/r594/{id}", Synthetic_op594},
+    {"GET", "/r595/{id}", Synthetic_op595},
+    {"POST", "/r596/{id}", Synthetic_op596},
+    {"PUT", "/r597/{id}", Synthetic_op597},
+    {"DELETE", "/r598/{id}", Synthetic_op598},
+    {"PATCH", "/r599/{id}", Synthetic_op599},
+    {"GET", "/r600/{id}", Synthetic_op600},
+    {"POST", "/r601/{id}", Synthetic_op601},
+    {"PUT", "/r602/{id}", Synthetic_op602},
+    {"DELETE", "/r603/{id}", Synthetic_op603},
+    {"PATCH", "/r604/{id}", Synthetic_op604},
+    {"GET", "/r605/{id}", Synthetic_op605},
+    {"POST", "/r606/{id}", Synthetic_op606},
+    {"PUT", "/r607/{id}", Synthetic_op607},
+    {"DELETE", "/r608/{id}", Synthetic_op608},
+    {"PATCH", "/r609/{id}", Synthetic_op609},
+    {"GET", "/r610/{id}", Synthetic_op610},
+    {"POST", "/r611/{id}", Synthetic_op611},
+    {"PUT", "/r612/{id}", Synthetic_op612},
+    {"DELETE", "/r613/{id}", Synthetic_op613},
+    {"PATCH", "/r614/{id}", Synthetic_op614},
+    {"GET", "/r615/{id}", Synthetic_op615},
+    {"POST", "/r616/{id}", Synthetic_op616},
+    {"PUT", "/r617/{id}", Synthetic_op617},
+    {"DELETE", "/r618/{id}", Synthetic_op618},
+    {"PATCH", "/r619/{id}", Synthetic_op619},
+    {"GET", "/r620/{id}", Synthetic_op620},
+    {"POST", "/r621/{id}", Synthetic_op621},
+    {"PUT", "/r622/{id}", Synthetic_op622},
+    {"DELETE", "/r623/{id}", Synthetic_op623},
+    {"PATCH", "/r624/{id}", Synthetic_op624},
+    {"GET", "/r625/{id}", Synthetic_op625},
+    {"POST", "/r626/{id}", Synthetic_op626},
+    {"PUT", "/r627/{id}", Synthetic_op627},
+    {"DELETE", "/r628/{id}", Synthetic_op628},
+    {"PATCH", "/r629/{id}", Synthetic_op629},
+    {"GET", "/r630/{id}", Synthetic_op630},
+    {"POST", "/r631/{id}", Synthetic_op631},
+    {"PUT", "/r632/{id}", Synthetic_op632},
+    {"DELETE", "/r633/{id}", Synthetic_op633},
+    {"PATCH", "/r634/{id}", Synthetic_op634},
+    {"GET", "/r635/{id}", Synthetic_op635},
+    {"POST", "/r636/{id}", Synthetic_op636},
+    {"PUT", "/r637/{id}", Synthetic_op637},
+    {"DELETE", "/r638/{id}", Synthetic_op638},
+    {"PATCH", "/r639/{id}", Synthetic_op639},
+    {"GET", "/r640/{id}", Synthetic_op640},
+    {"POST", "/r641/{id}", Synthetic_op641},
+    {"PUT", "/r642/{id}", Synthetic_op642},
+    {"DELETE", "/r643/{id}", Synthetic_op643},
+    {"PATCH", "/r644/{id}", Synthetic_op644},
+    {"GET", "/r645/{id}", Synthetic_op645},
+    {"POST", "/r646/{id}", Synthetic_op646},
+    {"PUT", "/r647/{id}", Synthetic_op647},
+    {"DELETE", "/r648/{id}", Synthetic_op648},
+    {"PATCH", "/r649/{id}", Synthetic_op649},
+    {"GET", "/r650/{id}", Synthetic_op650},
+    {"POST", "/r651/{id}", Synthetic_op651},
+    {"PUT", "/r652/{id}", Synthetic_op652},
+    {"DELETE", "/r653/{id}", Synthetic_op653},
+    {"PATCH", "/r654/{id}", Synthetic_op654},
+    {"GET", "/r655/{id}", Synthetic_op655},
+    {"POST", "/r656/{id}", Synthetic_op656},
+    {"PUT", "/r657/{id}", Synthetic_op657},
+    {"DELETE", "/r658/{id}", Synthetic_op658},
+    {"PATCH", "/r659/{id}", Synthetic_op659},
+    {"GET", "/r660/{id}", Synthetic_op660},
+    {"POST", "/r661/{id}", Synthetic_op661},
+    {"PUT", "/r662/{id}", Synthetic_op662},
+    {"DELETE", "/r663/{id}", Synthetic_op663},
+    {"PATCH", "/r664/{id}", Synthetic_op664},
+    {"GET", "/r665/{id}", Synthetic_op665},
+    {"POST", "/r666/{id}", Synthetic_op666},
+    {"PUT", "/r667/{id}", Synthetic_op667},
+    {"DELETE", "/r668/{id}", Synthetic_op668},
+    {"PATCH", "/r669/{id}", Synthetic_op669},
+    {"GET", "/r670/{id}", Synthetic_op670},
+    {"POST", "/r671/{id}", Synthetic_op671},
+    {"PUT", "/r672/{id}", Synthetic_op672},
+    {"DELETE", "/r673/{id}", Synthetic_op673},
+    {"PATCH", "/r674/{id}", Synthetic_op674},
+    {"GET", "/r675/{id}", Synthetic_op675},
+    {"POST", "/r676/{id}", Synthetic_op676},
+    {"PUT", "/r677/{id}", Synthetic_op677},
+    {"DELETE", "/r678/{id}", Synthetic_op678},
+    {"PATCH", "/r679/{id}", Synthetic_op679},
+    {"GET", "/r680/{id}", Synthetic_op680},
+    {"POST", "/r681/{id}", Synthetic_op681},
+    {"PUT", "/r682/{id}", Synthetic_op682},
+    {"DELETE", "/r683/{id}", Synthetic_op683},
+    {"PATCH", "/r684/{id}", Synthetic_op684},
+    {"GET", "/r685/{id}", Synthetic_op685},
+    {"POST", "/r686/{id}", Synthetic_op686},
+    {"PUT", "/r687/{id}", Synthetic_op687},
+    {"DELETE", "/r688/{id}", Synthetic_op688},
+    {"PATCH", "/r689/{id}", Synthetic_op689},
+    {"GET", "/r690/{id}", Synthetic_op690},
+    {"POST", "/r691/{id}", Synthetic_op691},
+    {"PUT", "/r692/{id}", Synthetic_op692},
+    {"DELETE", "/r693/{id}", Synthetic_op693},
+    {"PATCH", "/r694/{id}", Synthetic_op694},
+    {"GET", "/r695/{id}", Synthetic_op695},
+    {"POST", "/r696/{id}", Synthetic_op696},
+    {"PUT", "/r697/{id}", Synthetic_op697},
+    {"DELETE", "/r698/{id}", Synthetic_op698},
+    {"PATCH", "/r699/{id}", Synthetic_op699},
+    {"GET", "/r700/{id}", Synthetic_op700},
+    {"POST", "/r701/{id}", Synthetic_op701},
+    {"PUT", "/r702/{id}", Synthetic_op702},
+    {"DELETE", "/r703/{id}", Synthetic_op703},
+    {"PATCH", "/r704/{id}", Synthetic_op704},
+    {"GET", "/r705/{id}", Synthetic_op705},
+    {"POST", "/r706/{id}", Synthetic_op706},
+    {"PUT", "/r707/{id}", Synthetic_op707},
+    {"DELETE", "/r708/{id}", Synthetic_op708},
+    {"PATCH", "/r709/{id}", Synthetic_op709},
+    {"GET", "/r710/{id}", Synthetic_op710},
+    {"POST", "/r711/{id}", Synthetic_op711},
+    {"PUT", "/r712/{id}", Synthetic_op712},
+    {"DELETE", "/r713/{id}", Synthetic_op713},
+    {"PATCH", "/r714/{id}", Synthetic_op714},
+    {"GET", "/r715/{id}", Synthetic_op715},
+    {"POST", "/r716/{id}", Synthetic_op716},
+    {"PUT", "/r717/{id}", Synthetic_op717},
+    {"DELETE", "/r718/{id}", Synthetic_op718},
+    {"PATCH", "/r719/{id}", Synthetic_op719},
+    {"GET", "/r720/{id}", Synthetic_op720},
+    {"POST", "/r721/{id}", Synthetic_op721},
+    {"PUT", "/r722/{id}", Synthetic_op722},
+    {"DELETE", "/r723/{id}", Synthetic_op723},
+    {"PATCH", "/r724/{id}", Synthetic_op724},
+    {"GET", "/r725/{id}", Synthetic_op725},
+    {"POST", "/r726/{id}", Synthetic_op726},
+    {"PUT", "/r727/{id}", Synthetic_op727},
+    {"DELETE", "/r728/{id}", Synthetic_op728},
+    {"PATCH", "/r729/{id}", Synthetic_op729},
+    {"GET", "/r730/{id}", Synthetic_op730},
+    {"POST", "/r731/{id}", Synthetic_op731},
+    {"PUT", "/r732/{id}", Synthetic_op732},
+    {"DELETE", "/r733/{id}", Synthetic_op733},
+    {"PATCH", "/r734/{id}", Synthetic_op734},
+    {"GET", "/r735/{id}", Synthetic_op735},
+    {"POST", "/r736/{id}", Synthetic_op736},
+    {"PUT", "/r737/{id}", Synthetic_op737},
+    {"DELETE", "/r738/{id}", Synthetic_op738},
+    {"PATCH", "/r739/{id}", Synthetic_op739},
+    {"GET", "/r740/{id}", Synthetic_op740},
+    {"POST", "/r741/{id}", Synthetic_op741},
+    {"PUT", "/r742/{id}", Synthetic_op742},
+    {"DELETE", "/r743/{id}", Synthetic_op743},
+    {"PATCH", "/r744/{id}", Synthetic_op744},
+    {"GET", "/r745/{id}", Synthetic_op745},
+    {"POST", "/r746/{id}", Synthetic_op746},
+    {"PUT", "/r747/{id}", Synthetic_op747},
+    {"DELETE", "/r748/{id}", Synthetic_op748},
+    {"PATCH", "/r749/{id}", Synthetic_op749},
+    {"GET", "/r750/{id}", Synthetic_op750},
+    {"POST", "/r751/{id}", Synthetic_op751},
+    {"PUT", "/r752/{id}", Synthetic_op752},
+    {"DELETE", "/r753/{id}", Synthetic_op753},
+    {"PATCH", "/r754/{id}", Synthetic_op754},
+    {"GET", "/r755/{id}", Synthetic_op755},
+    {"POST", "/r756/{id}", Synthetic_op756},
+    {"PUT", "/r757/{id}", Synthetic_op757},
+    {"DELETE", "/r758/{id}", Synthetic_op758},
+    {"PATCH", "/r759/{id}", Synthetic_op759},
+    {"GET", "/r760/{id}", Synthetic_op760},
+    {"POST", "/r761/{id}", Synthetic_op761},
+    {"PUT", "/r762/{id}", Synthetic_op762},
+    {"DELETE", "/r763/{id}", Synthetic_op763},
+    {"PATCH", "/r764/{id}", Synthetic_op764},
+    {"GET", "/r765/{id}", Synthetic_op765},
+    {"POST", "/r766/{id}", Synthetic_op766},
+    {"PUT", "/r767/{id}", Synthetic_op767},
+    {"DELETE", "/r768/{id}", Synthetic_op768},
+    {"PATCH", "/r769/{id}", Synthetic_op769},
+    {"GET", "/r770/{id}", Synthetic_op770},
+    {"POST", "/r771/{id}", Synthetic_op771},
+    {"PUT", "/r772/{id}", Synthetic_op772},
+    {"DELETE", "/r773/{id}", Synthetic_op773},
+    {"PATCH", "/r774/{id}", Synthetic_op774},
+    {"GET", "/r775/{id}", Synthetic_op775},
+    {"POST", "/r776/{id}", Synthetic_op776},
+    {"PUT", "/r777/{id}", Synthetic_op777},
+    {"DELETE", "/r778/{id}", Synthetic_op778},
+    {"PATCH", "/r779/{id}", Synthetic_op779},
+    {"GET", "/r780/{id}", Synthetic_op780},
+    {"POST", "/r781/{id}", Synthetic_op781},
+    {"PUT", "/r782/{id}", Synthetic_op782},
+    {"DELETE", "/r783/{id}", Synthetic_op783},
+    {"PATCH", "/r784/{id}", Synthetic_op784},
+    {"GET", "/r785/{id}", Synthetic_op785},
+    {"POST", "/r786/{id}", Synthetic_op786},
+    {"PUT", "/r787/{id}", Synthetic_op787},
+    {"DELETE", "/r788/{id}", Synthetic_op788},
+    {"PATCH", "/r789/{id}", Synthetic_op789},
+    {"GET", "/r790/{id}", Synthetic_op790},
+    {"POST", "/r791/{id}", Synthetic_op791},
+    {"PUT", "/r792/{id}", Synthetic_op792},
+    {"DELETE", "/r793/{id}", Synthetic_op793},
+    {"PATCH", "/r794/{id}", Synthetic_op794},
+    {"GET", "/r795/{id}", Synthetic_op795},
+    {"POST", "/r796/{id}", Synthetic_op796},
+    {"PUT", "/r797/{id}", Synthetic_op797},
+    {"DELETE", "/r798/{id}", Synthetic_op798},
+    {"PATCH", "/r799/{id}", Synthetic_op799},
+    {"GET", "/r800/{id}", Synthetic_op800},
+    {"POST", "/r801/{id}", Synthetic_op801},
+    {"PUT", "/r802/{id}", Synthetic_op802},
+    {"DELETE", "/r803/{id}", Synthetic_op803},
+    {"PATCH", "/r804/{id}", Synthetic_op804},
+    {"GET", "/r805/{id}", Synthetic_op805},
+    {"POST", "/r806/{id}", Synthetic_op806},
+    {"PUT", "/r807/{id}", Synthetic_op807},
+    {"DELETE", "/r808/{id}", Synthetic_op808},
+    {"PATCH", "/r809/{id}", Synthetic_op809},
+    {"GET", "/r810/{id}", Synthetic_op810},
+    {"POST", "/r811/{id}", Synthetic_op811},
+    {"PUT", "/r812/{id}", Synthetic_op812},
+    {"DELETE", "/r813/{id}", Synthetic_op813},
+    {"PATCH", "/r814/{id}", Synthetic_op814},
+    {"GET", "/r815/{id}", Synthetic_op815},
+    {"POST", "/r816/{id}", Synthetic_op816},
+    {"PUT", "/r817/{id}", Synthetic_op817},
+    {"DELETE", "/r818/{id}", Synthetic_op818},
+    {"PATCH", "/r819/{id}", Synthetic_op819},
+    {"GET", "/r820/{id}", Synthetic_op820},
+    {"POST", "/r821/{id}", Synthetic_op821},
+    {"PUT", "/r822/{id}", Synthetic_op822},
+    {"DELETE", "/r823/{id}", Synthetic_op823},
+    {"PATCH", "/r824/{id}", Synthetic_op824},
+    {"GET", "/r825/{id}", Synthetic_op825},
+    {"POST", "/r826/{id}", Synthetic_op826},
+    {"PUT", "/r827/{id}", Synthetic_op827},
+    {"DELETE", "/r828/{id}", Synthetic_op828},
+    {"PATCH", "/r829/{id}", Synthetic_op829},
+    {"GET", "/r830/{id}", Synthetic_op830},
+    {"POST", "/r831/{id}", Synthetic_op831},
+    {"PUT", "/r832/{id}", Synthetic_op832},
+    {"DELETE", "/r833/{id}", Synthetic_op833},
+    {"PATCH", "/r834/{id}", Synthetic_op834},
+    {"GET", "/r835/{id}", Synthetic_op835},
+    {"POST", "/r836/{id}", Synthetic_op836},
+    {"PUT", "/r837/{id}", Synthetic_op837},
+    {"DELETE", "/r838/{id}", Synthetic_op838},
+    {"PATCH", "/r839/{id}", Synthetic_op839},
+    {"GET", "/r840/{id}", Synthetic_op840},
+    {"POST", "/r841/{id}", Synthetic_op841},
+    {"PUT", "/r842/{id}", Synthetic_op842},
+    {"DELETE", "/r843/{id}", Synthetic_op843},
+    {"PATCH", "/r844/{id}", Synthetic_op844},
+    {"GET", "/r845/{id}", Synthetic_op845},
+    {"POST", "/r846/{id}", Synthetic_op846},
+    {"PUT", "/r847/{id}", Synthetic_op847},
+    {"DELETE", "/r848/{id}", Synthetic_op848},
+    {"PATCH", "/r849/{id}", Synthetic_op849},
+    {"GET", "/r850/{id}", Synthetic_op850},
+    {"POST", "/r851/{id}", Synthetic_op851},
+    {"PUT", "/r852/{id}", Synthetic_op852},
+    {"DELETE", "/r853/{id}", Synthetic_op853},
+    {"PATCH", "/r854/{id}", Synthetic_op854},
+    {"GET", "/r855/{id}", Synthetic_op855},
+    {"POST", "/r856/{id}", Synthetic_op856},
+    {"PUT", "/r857/{id}", Synthetic_op857},
+    {"DELETE", "/r858/{id}", Synthetic_op858},
+    {"PATCH", "/r859/{id}", Synthetic_op859},
+    {"GET", "/r860/{id}", Synthetic_op860},
+    {"POST", "/r861/{id}", Synthetic_op861},
+    {"PUT", "/r862/{id}", Synthetic_op862},
+    {"DELETE", "/r863/{id}", Synthetic_op863},
+    {"PATCH", "/r864/{id}", Synthetic_op864},
+    {"GET", "/r865/{id}", Synthetic_op865},
+    {"POST", "/r866/{id}", Synthetic_op866},
+    {"PUT", "/r867/{id}", Synthetic_op867},
+    {"DELETE", "/r868/{id}", Synthetic_op868},
+    {"PATCH", "/r869/{id}", Synthetic_op869},
+    {"GET", "/r870/{id}", Synthetic_op870},
+    {"POST", "/r871/{id}", Synthetic_op871},
+    {"PUT", "/r872/{id}", Synthetic_op872},
+    {"DELETE", "/r873/{id}", Synthetic_op873},
+    {"PATCH", "/r874/{id}", Synthetic_op874},
+    {"GET", "/r875/{id}", Synthetic_op875},
+    {"POST", "/r876/{id}", Synthetic_op876},
+    {"PUT", "/r877/{id}", Synthetic_op877},
+    {"DELETE", "/r878/{id}", Synthetic_op878},
+    {"PATCH", "/r879/{id}", Synthetic_op879},
+    {"GET", "/r880/{id}", Synthetic_op880},
+    {"POST", "/r881/{id}", Synthetic_op881},
+    {"PUT", "/r882/{id}", Synthetic_op882},
+    {"DELETE", "/r883/{id}", Synthetic_op883},
+    {"PATCH", "/r884/{id}", Synthetic_op884},
+    {"GET", "/r885/{id}", Synthetic_op885},
+    {"POST", "/r886/{id}", Synthetic_op886},
+    {"PUT", "/r887/{id}", Synthetic_op887},
+    {"DELETE", "/r888/{id}", Synthetic_op888},
+    {"PATCH", "/r889/{id}", Synthetic_op889},
+    {"GET", "/r890/{id}", Synthetic_op890},
+    {"POST", "/r891/{id}", Synthetic_op891},
+    {"PUT", "/r892/{id}", Synthetic_op892},
+    {"DELETE", "/r893/{id}", Synthetic_op893},
+    {"PATCH", "/r894/{id}", Synthetic_op894},
+    {"GET", "/r895/{id}", Synthetic_op895},
+    {"POST", "/r896/{id}", Synthetic_op896},
+    {"PUT", "/r897/{id}", Synthetic_op897},
+    {"DELETE", "/r898/{id}", Synthetic_op898},
+    {"PATCH", "/r899/{id}", Synthetic_op899},
+    {"GET", "/r900/{id}", Synthetic_op900},
+    {"POST", "/r901/{id}", Synthetic_op901},
+    {"PUT", "/r902/{id}", Synthetic_op902},
+    {"DELETE", "/r903/{id}", Synthetic_op903},
+    {"PATCH", "/r904/{id}", Synthetic_op904},
+    {"GET", "/r905/{id}", Synthetic_op905},
+    {"POST", "/r906/{id}", Synthetic_op906},
+    {"PUT", "/r907/{id}", Synthetic_op907},
+    {"DELETE", "/r908/{id}", Synthetic_op908},
+    {"PATCH", "/r909/{id}", Synthetic_op909},
+    {"GET", "/r910/{id}", Synthetic_op910},
+    {"POST", "/r911/{id}", Synthetic_op911},
+    {"PUT", "/r912/{id}", Synthetic_op912},
+    {"DELETE", "/r913/{id}", Synthetic_op913},
+    {"PATCH", "/r914/{id}", Synthetic_op914},
+    {"GET", "/r915/{id}", Synthetic_op915},
+    {"POST", "/r916/{id}", Synthetic_op916},
+    {"PUT", "/r917/{id}", Synthetic_op917},
+    {"DELETE", "/r918/{id}", Synthetic_op918},
+    {"PATCH", "/r919/{id}", Synthetic_op919},
+    {"GET", "/r920/{id}", Synthetic_op920},
+    {"POST", "/r921/{id}", Synthetic_op921},
+    {"PUT", "/r922/{id}", Synthetic_op922},
+    {"DELETE", "/r923/{id}", Synthetic_op923},
+    {"PATCH", "/r924/{id}", Synthetic_op924},
+    {"GET", "/r925/{id}", Synthetic_op925},
+    {"POST", "/r926/{id}", Synthetic_op926},
+    {"PUT", "/r927/{id}", Synthetic_op927},
+    {"DELETE", "/r928/{id}", Synthetic_op928},
+    {"PATCH", "/r929/{id}", Synthetic_op929},
+    {"GET", "/r930/{id}", Synthetic_op930},
+    {"POST", "/r931/{id}", Synthetic_op931},
+    {"PUT", "/r932/{id}", Synthetic_op932},
+    {"DELETE", "/r933/{id}", Synthetic_op933},
+    {"PATCH", "/r934/{id}", Synthetic_op934},
+    {"GET", "/r935/{id}", Synthetic_op935},
+    {"POST", "/r936/{id}", Synthetic_op936},
+    {"PUT", "/r937/{id}", Synthetic_op937},
+    {"DELETE", "/r938/{id}", Synthetic_op938},
+    {"PATCH", "/r939/{id}", Synthetic_op939},
+    {"GET", "/r940/{id}", Synthetic_op940},
+    {"POST", "/r941/{id}", Synthetic_op941},
+    {"PUT", "/r942/{id}", Synthetic_op942},
+    {"DELETE", "/r943/{id}", Synthetic_op943},
+    {"PATCH", "/r944/{id}", Synthetic_op944},
+    {"GET", "/r945/{id}", Synthetic_op945},
+    {"POST", "/r946/{id}", Synthetic_op946},
+    {"PUT", "/r947/{id}", Synthetic_op947},
+    {"DELETE", "/r948/{id}", Synthetic_op948},
+    {"PATCH", "/r949/{id}", Synthetic_op949},
+    {"GET", "/r950/{id}", Synthetic_op950},
+    {"POST", "/r951/{id}", Synthetic_op951},
+    {"PUT", "/r952/{id}", Synthetic_op952},
+    {"DELETE", "/r953/{id}", Synthetic_op953},
+    {"PATCH", "/r954/{id}", Synthetic_op954},
+    {"GET", "/r955/{id}", Synthetic_op955},
+    {"POST", "/r956/{id}", Synthetic_op956},
+    {"PUT", "/r957/{id}", Synthetic_op957},
+    {"DELETE", "/r958/{id}", Synthetic_op958},
+    {"PATCH", "/r959/{id}", Synthetic_op959},
+    {"GET", "/r960/{id}", Synthetic_op960},
+    {"POST", "/r961/{id}", Synthetic_op961},
+    {"PUT", "/r962/{id}", Synthetic_op962},
+    {"DELETE", "/r963/{id}", Synthetic_op963},
+    {"PATCH", "/r964/{id}", Synthetic_op964},
+    {"GET", "/r965/{id}", Synthetic_op965},
+    {"POST", "/r966/{id}", Synthetic_op966},
+    {"PUT", "/r967/{id}", Synthetic_op967},
+    {"DELETE", "/r968/{id}", Synthetic_op968},
+    {"PATCH", "/r969/{id}", Synthetic_op969},
+    {"GET", "/r970/{id}", Synthetic_op970},
+    {"POST", "/r971/{id}", Synthetic_op971},
+    {"PUT", "/r972/{id}", Synthetic_op972},
+    {"DELETE", "/r973/{id}", Synthetic_op973},
+    {"PATCH", "/r974/{id}", Synthetic_op974},
+    {"GET", "/r975/{id}", Synthetic_op975},
+    {"POST", "/r976/{id}", Synthetic_op976},
+    {"PUT", "/r977/{id}", Synthetic_op977},
+    {"DELETE", "/r978/{id}", Synthetic_op978},
+    {"PATCH", "/r979/{id}", Synthetic_op979},
+    {"GET", "/r980/{id}", Synthetic_op980},
+    {"POST", "/r981/{id}", Synthetic_op981},
+    {"PUT", "/r982/{id}", Synthetic_op982},
+    {"DELETE", "/r983/{id}", Synthetic_op983},
+    {"PATCH", "/r984/{id}", Synthetic_op984},
+    {"GET", "/r985/{id}", Synthetic_op985},
+    {"POST", "/r986/{id}", Synthetic_op986},
+    {"PUT", "/r987/{id}", Synthetic_op987},
+    {"DELETE", "/r988/{id}", Synthetic_op988},
+    {"PATCH", "/r989/{id}", Synthetic_op989},
+    {"GET", "/r990/{id}", Synthetic_op990},
+    {"POST", "/r991/{id}", Synthetic_op991},
+    {"PUT", "/r992/{id}", Synthetic_op992},
+    {"DELETE", "/r993/{id}", Synthetic_op993},
+    {"PATCH", "/r994/{id}", Synthetic_op994},
+    {"GET", "/r995/{id}", Synthetic_op995},
+    {"POST", "/r996/{id}", Synthetic_op996},
+    {"PUT", "/r997/{id}", Synthetic_op997},
+    {"DELETE", "/r998/{id}", Synthetic_op998},
+    {"PATCH", "/r999/{id}", Synthetic_op999},
+};
+static const int route_count = 1000;
+
+void Synthetic_init(void) {
+    /* API initialization */
+}
+
+const char *Synthetic_error_str(Synthetic_error_t err) {
+    if (err >= 0 && err < Synthetic_ERR_COUNT) {
+        return error_strings[err];
+    }
+    return "Unknown error";
+}
+
+const Synthetic_route_t *Synthetic_get_routes(int *count) {
+    *count = route_count;
+    return routes;
+}
+
+Synthetic_error_t Synthetic_dispatch(Synthetic_request_t *req, Synthetic_response_t *resp) {
+    for (int i = 0; i < route_count; i++) {
+        if (strcmp(routes[i].method, req->method) == 0 &&
+            strcmp(routes[i].path, req->path) == 0) {
+            return routes[i].handler(req, resp);
+        }
+    }
+    resp->status_code = 404;
+    return Synthetic_ERR_NOT_FOUND;
+}
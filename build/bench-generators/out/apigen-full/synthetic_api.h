@@ -0,0 +1,1155 @@
+/* AUTO-GENERATED by apigen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_API_H
+#define SYNTHETIC_API_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* API: Synthetic v1.0 */
+
+/* Types */
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req0_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res0_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req1_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res1_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req2_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res2_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req3_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res3_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req4_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res4_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req5_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res5_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req6_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res6_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req7_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res7_t;
+
+/* Error codes */
+typedef enum {
+    Synthetic_OK = 0,
+    Synthetic_ERR_INVALID_INPUT,
+    Synthetic_ERR_NOT_FOUND,
+    Synthetic_ERR_INTERNAL,
+    Synthetic_ERR_CONFLICT0,
+    Synthetic_ERR_CONFLICT1,
+    Synthetic_ERR_CONFLICT2,
+    Synthetic_ERR_CONFLICT3,
+    Synthetic_ERR_CONFLICT4,
+    Synthetic_ERR_CONFLICT5,
+    Synthetic_ERR_CONFLICT6,
+    Synthetic_ERR_CONFLICT7,
+    Synthetic_ERR_CONFLICT8,
+    Synthetic_ERR_CONFLICT9,
+    Synthetic_ERR_CONFLICT10,
+    Synthetic_ERR_CONFLICT11,
+    Synthetic_ERR_COUNT
+} Synthetic_error_t;
+
+/* Request context */
+typedef struct {
+    const char *method;
+    const char *path;
+    const char *body;
+    size_t body_len;
+    void *user_data;
+} Synthetic_request_t;
+
+typedef struct {
+    int status_code;
+    char *body;
+    size_t body_len;
+    size_t body_cap;
+} Synthetic_response_t;
+
+/* Handler function type */
+typedef Synthetic_error_t (*Synthetic_handler_fn)(Synthetic_request_t *req, Synthetic_response_t *resp);
+
+/* Route table entry */
+typedef struct {
+    const char *method;
+    const char *path;
+    Synthetic_handler_fn handler;
+} Synthetic_route_t;
+
+/* API functions */
+void Synthetic_init(void);
+Synthetic_error_t Synthetic_dispatch(Synthetic_request_t *req, Synthetic_response_t *resp);
+const Synthetic_route_t *Synthetic_get_routes(int *count);
+const char *Synthetic_error_str(Synthetic_error_t err);
+
+/* Endpoint handlers (implement these) */
+Synthetic_error_t Synthetic_op0(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op1(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op2(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op3(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op4(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op5(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op6(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op7(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op8(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op9(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op10(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op11(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op12(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op13(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op14(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op15(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op16(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op17(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op18(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op19(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op20(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op21(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op22(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op23(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op24(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op25(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op26(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op27(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op28(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op29(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op30(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op31(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op32(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op33(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op34(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op35(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op36(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op37(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op38(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op39(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op40(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op41(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op42(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op43(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op44(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op45(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op46(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op47(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op48(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op49(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op50(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op51(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op52(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op53(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op54(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op55(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op56(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op57(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op58(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op59(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op60(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op61(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op62(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op63(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op64(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op65(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op66(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op67(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op68(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op69(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op70(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op71(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op72(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op73(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op74(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op75(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op76(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op77(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op78(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op79(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op80(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op81(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op82(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op83(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op84(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op85(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op86(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op87(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op88(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op89(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op90(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op91(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op92(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op93(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op94(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op95(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op96(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op97(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op98(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op99(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op100(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op101(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op102(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op103(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op104(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op105(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op106(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op107(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op108(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op109(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op110(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op111(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op112(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op113(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op114(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op115(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op116(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op117(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op118(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op119(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op120(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op121(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op122(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op123(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op124(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op125(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op126(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op127(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op128(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op129(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op130(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op131(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op132(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op133(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op134(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op135(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op136(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op137(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op138(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op139(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op140(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op141(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op142(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op143(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op144(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op145(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op146(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op147(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op148(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op149(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op150(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op151(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op152(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op153(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op154(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op155(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op156(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op157(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op158(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op159(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op160(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op161(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op162(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op163(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op164(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op165(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op166(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op167(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op168(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op169(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op170(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op171(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op172(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op173(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op174(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op175(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op176(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op177(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op178(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op179(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op180(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op181(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op182(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op183(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op184(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op185(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op186(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op187(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op188(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op189(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op190(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op191(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op192(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op193(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op194(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op195(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op196(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op197(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op198(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op199(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op200(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op201(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op202(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op203(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op204(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op205(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op206(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op207(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op208(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op209(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op210(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op211(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op212(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op213(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op214(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op215(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op216(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op217(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op218(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op219(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op220(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op221(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op222(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op223(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op224(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op225(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op226(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op227(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op228(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op229(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op230(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op231(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op232(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op233(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op234(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op235(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op236(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op237(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op238(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op239(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op240(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op241(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op242(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op243(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op244(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op245(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op246(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op247(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op248(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op249(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op250(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op251(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op252(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op253(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op254(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op255(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op256(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op257(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op258(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op259(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op260(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op261(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op262(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op263(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op264(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op265(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op266(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op267(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op268(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op269(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op270(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op271(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op272(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op273(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op274(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op275(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op276(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op277(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op278(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op279(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op280(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op281(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op282(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op283(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op284(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op285(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op286(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op287(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op288(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op289(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op290(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op291(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op292(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op293(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op294(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op295(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op296(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op297(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op298(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op299(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op300(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op301(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op302(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op303(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op304(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op305(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op306(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op307(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op308(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op309(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op310(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op311(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op312(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op313(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op314(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op315(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op316(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op317(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op318(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op319(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op320(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op321(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op322(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op323(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op324(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op325(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op326(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op327(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op328(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op329(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op330(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op331(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op332(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op333(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op334(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op335(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op336(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op337(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op338(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op339(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op340(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op341(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op342(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op343(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op344(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op345(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op346(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op347(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op348(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op349(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op350(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op351(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op352(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op353(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op354(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op355(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op356(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op357(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op358(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op359(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op360(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op361(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op362(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op363(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op364(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op365(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op366(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op367(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op368(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op369(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op370(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op371(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op372(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op373(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op374(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op375(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op376(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op377(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op378(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op379(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op380(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op381(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op382(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op383(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op384(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op385(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op386(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op387(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op388(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op389(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op390(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op391(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op392(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op393(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op394(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op395(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op396(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op397(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op398(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op399(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op400(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op401(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op402(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op403(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op404(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op405(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op406(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op407(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op408(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op409(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op410(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op411(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op412(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op413(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op414(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op415(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op416(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op417(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op418(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op419(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op420(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op421(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op422(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op423(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op424(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op425(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op426(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op427(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op428(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op429(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op430(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op431(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op432(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op433(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op434(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op435(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op436(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op437(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op438(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op439(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op440(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op441(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op442(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op443(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op444(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op445(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op446(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op447(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op448(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op449(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op450(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op451(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op452(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op453(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op454(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op455(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op456(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op457(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op458(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op459(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op460(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op461(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op462(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op463(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op464(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op465(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op466(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op467(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op468(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op469(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op470(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op471(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op472(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op473(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op474(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op475(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op476(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op477(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op478(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op479(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op480(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op481(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op482(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op483(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op484(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op485(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op486(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op487(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op488(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op489(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op490(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op491(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op492(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op493(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op494(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op495(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op496(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op497(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op498(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op499(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op500(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op501(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op502(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op503(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op504(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op505(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op506(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op507(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op508(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op509(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op510(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op511(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op512(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op513(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op514(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op515(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op516(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op517(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op518(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op519(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op520(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op521(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op522(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op523(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op524(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op525(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op526(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op527(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op528(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op529(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op530(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op531(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op532(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op533(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op534(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op535(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op536(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op537(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op538(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op539(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op540(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op541(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op542(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op543(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op544(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op545(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op546(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op547(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op548(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op549(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op550(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op551(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op552(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op553(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op554(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op555(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op556(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op557(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op558(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op559(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op560(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op561(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op562(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op563(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op564(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op565(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op566(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op567(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op568(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op569(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op570(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op571(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op572(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op573(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op574(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op575(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op576(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op577(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op578(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op579(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op580(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op581(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op582(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op583(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op584(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op585(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op586(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op587(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op588(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op589(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op590(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op591(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op592(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op593(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op594(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op595(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op596(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op597(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op598(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op599(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op600(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op601(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op602(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op603(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op604(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op605(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op606(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op607(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op608(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op609(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op610(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op611(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op612(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op613(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op614(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op615(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op616(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op617(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op618(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op619(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op620(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op621(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op622(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op623(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op624(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op625(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op626(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op627(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op628(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op629(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op630(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op631(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op632(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op633(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op634(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op635(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op636(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op637(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op638(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op639(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op640(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op641(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op642(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op643(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op644(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op645(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op646(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op647(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op648(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op649(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op650(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op651(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op652(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op653(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op654(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op655(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op656(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op657(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op658(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op659(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op660(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op661(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op662(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op663(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op664(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op665(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op666(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op667(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op668(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op669(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op670(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op671(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op672(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op673(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op674(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op675(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op676(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op677(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op678(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op679(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op680(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op681(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op682(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op683(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op684(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op685(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op686(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op687(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op688(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op689(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op690(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op691(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op692(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op693(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op694(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op695(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op696(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op697(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op698(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op699(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op700(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op701(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op702(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op703(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op704(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op705(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op706(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op707(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op708(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op709(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op710(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op711(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op712(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op713(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op714(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op715(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op716(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op717(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op718(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op719(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op720(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op721(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op722(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op723(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op724(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op725(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op726(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op727(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op728(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op729(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op730(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op731(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op732(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op733(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op734(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op735(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op736(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op737(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op738(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op739(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op740(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op741(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op742(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op743(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op744(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op745(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op746(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op747(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op748(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op749(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op750(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op751(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op752(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op753(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op754(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op755(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op756(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op757(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op758(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op759(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op760(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op761(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op762(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op763(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op764(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op765(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op766(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op767(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op768(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op769(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op770(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op771(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op772(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op773(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op774(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op775(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op776(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op777(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op778(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op779(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op780(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op781(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op782(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op783(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op784(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op785(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op786(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op787(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op788(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op789(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op790(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op791(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op792(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op793(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op794(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op795(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op796(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op797(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op798(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op799(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op800(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op801(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op802(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op803(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op804(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op805(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op806(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op807(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op808(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op809(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op810(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op811(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op812(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op813(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op814(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op815(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op816(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op817(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op818(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op819(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op820(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op821(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op822(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op823(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op824(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op825(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op826(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op827(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op828(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op829(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op830(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op831(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op832(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op833(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op834(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op835(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op836(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op837(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op838(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op839(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op840(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op841(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op842(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op843(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op844(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op845(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op846(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op847(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op848(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op849(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op850(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op851(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op852(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op853(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op854(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op855(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op856(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op857(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op858(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op859(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op860(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op861(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op862(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op863(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op864(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op865(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op866(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op867(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op868(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op869(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op870(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op871(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op872(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op873(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op874(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op875(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op876(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op877(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op878(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op879(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op880(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op881(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op882(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op883(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op884(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op885(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op886(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op887(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op888(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op889(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op890(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op891(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op892(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op893(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op894(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op895(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op896(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op897(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op898(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op899(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op900(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op901(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op902(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op903(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op904(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op905(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op906(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op907(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op908(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op909(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op910(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op911(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op912(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op913(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op914(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op915(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op916(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op917(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op918(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op919(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op920(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op921(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op922(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op923(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op924(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op925(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op926(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op927(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op928(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op929(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op930(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op931(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op932(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op933(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op934(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op935(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op936(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op937(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op938(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op939(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op940(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op941(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op942(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op943(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op944(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op945(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op946(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op947(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op948(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op949(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op950(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op951(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op952(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op953(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op954(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op955(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op956(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op957(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op958(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op959(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op960(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op961(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op962(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op963(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op964(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op965(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op966(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op967(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op968(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op969(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op970(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op971(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op972(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op973(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op974(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op975(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op976(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op977(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op978(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op979(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op980(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op981(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op982(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op983(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op984(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op985(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op986(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op987(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op988(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op989(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op990(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op991(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op992(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op993(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op994(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op995(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op996(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op997(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op998(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op999(Synthetic_request_t *req, Synthetic_response_t *resp);
+
+#endif /* SYNTHETIC_API_H */
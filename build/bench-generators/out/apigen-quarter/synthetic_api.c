@@ -0,0 +1,792 @@
+/* AUTO-GENERATED by apigen 1.0.0 — DO NOT EDIT */
+
+#include "synthetic_api.h"
+#include <string.h>
+
+static const char *error_strings[] = {
+    "OK",
+    "Invalid input",
+    "Not found",
+    "Internal error",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+    "NotFound",
+    "Conflict10",
+    "NotFound",
+    "Conflict11",
+    "NotFound",
+    "Conflict0",
+    "NotFound",
+    "Conflict1",
+    "NotFound",
+    "Conflict2",
+    "NotFound",
+    "Conflict3",
+    "NotFound",
+    "Conflict4",
+    "NotFound",
+    "Conflict5",
+    "NotFound",
+    "Conflict6",
+    "NotFound",
+    "Conflict7",
+    "NotFound",
+    "Conflict8",
+    "NotFound",
+    "Conflict9",
+};
+
+static const Synthetic_route_t routes[] = {
+    {"GET", "/r0/{id}", Synthetic_op0},
+    {"POST", "/r1/{id}", Synthetic_op1},
+    {"PUT", "/r2/{id}", Synthetic_op2},
+    {"DELETE", "/r3/{id}", Synthetic_op3},
+    {"PATCH", "/r4/{id}", Synthetic_op4},
+    {"GET", "/r5/{id}", Synthetic_op5},
+    {"POST", "/r6/{id}", Synthetic_op6},
+    {"PUT", "/r7/{id}", Synthetic_op7},
+    {"DELETE", "/r8/{id}", Synthetic_op8},
+    {"PATCH", "/r9/{id}", Synthetic_op9},
+    {"GET", "/r10/{id}", Synthetic_op10},
+    {"POST", "/r11/{id}", Synthetic_op11},
+    {"PUT", "/r12/{id}", Synthetic_op12},
+    {"DELETE", "/r13/{id}", Synthetic_op13},
+    {"PATCH", "/r14/{id}", Synthetic_op14},
+    {"GET", "/r15/{id}", Synthetic_op15},
+    {"POST", "/r16/{id}", Synthetic_op16},
+    {"PUT", "/r17/{id}", Synthetic_op17},
+    {"DELETE", "/r18/{id}", Synthetic_op18},
+    {"PATCH", "/r19/{id}", Synthetic_op19},
+    {"GET", "/r20/{id}", Synthetic_op20},
+    {"POST", "/r21/{id}", Synthetic_op21},
+    {"PUT", "/r22/{id}", Synthetic_op22},
+    {"DELETE", "/r23/{id}", Synthetic_op23},
+    {"PATCH", "/r24/{id}", Synthetic_op24},
+    {"GET", "/r25/{id}", Synthetic_op25},
+    {"POST", "/r26/{id}", Synthetic_op26},
+    {"PUT", "/r27/{id}", Synthetic_op27},
+    {"DELETE", "/r28/{id}", Synthetic_op28},
+    {"PATCH", "/r29/{id}", Synthetic_op29},
+    {"GET", "/r30/{id}", Synthetic_op30},
+    {"POST", "/r31/{id}", Synthetic_op31},
+    {"PUT", "/r32/{id}", Synthetic_op32},
+    {"DELETE", "/r33/{id}", Synthetic_op33},
+    {"PATCH", "/r34/{id}", Synthetic_op34},
+    {"GET", "/r35/{id}", Synthetic_op35},
+    {"POST", "/r36/{id}", Synthetic_op36},
+    {"PUT", "/r37/{id}", Synthetic_op37},
+    {"DELETE", "/r38/{id}", Synthetic_op38},
+    {"PATCH", "/r39/{id}", Synthetic_op39},
+    {"GET", "/r40/{id}", Synthetic_op40},
+    {"POST", "/r41/{id}", Synthetic_op41},
+    {"PUT", "/r42/{id}", Synthetic_op42},
+    {"DELETE", "/r43/{id}", Synthetic_op43},
+    {"PATCH", "/r44/{id}", Synthetic_op44},
+    {"GET", "/r45/{id}", Synthetic_op45},
+    {"POST", "/r46/{id}", Synthetic_op46},
+    {"PUT", "/r47/{id}", Synthetic_op47},
+    {"DELETE", "/r48/{id}", Synthetic_op48},
+    {"PATCH", "/r49/{id}", Synthetic_op49},
+    {"GET", "/r50/{id}", Synthetic_op50},
+    {"POST", "/r51/{id}", Synthetic_op51},
+    {"PUT", "/r52/{id}", Synthetic_op52},
+    {"DELETE", "/r53/{id}", Synthetic_op53},
+    {"PATCH", "/r54/{id}", Synthetic_op54},
+    {"GET", "/r55/{id}", Synthetic_op55},
+    {"POST", "/r56/{id}", Synthetic_op56},
+    {"PUT", "/r57/{id}", Synthetic_op57},
+    {"DELETE", "/r58/{id}", Synthetic_op58},
+    {"PATCH", "/r59/{id}", Synthetic_op59},
+    {"GET", "/r60/{id}", Synthetic_op60},
+    {"POST", "/r61/{id}", Synthetic_op61},
+    {"PUT", "/r62/{id}", Synthetic_op62},
+    {"DELETE", "/r63/{id}", Synthetic_op63},
+    {"PATCH", "/r64/{id}", Synthetic_op64},
+    {"GET", "/r65/{id}", Synthetic_op65},
+    {"POST", "/r66/{id}", Synthetic_op66},
+    {"PUT", "/r67/{id}", Synthetic_op67},
+    {"DELETE", "/r68/{id}", Synthetic_op68},
+    {"PATCH", "/r69/{id}", Synthetic_op69},
+    {"GET", "/r70/{id}", Synthetic_op70},
+    {"POST", "/r71/{id}", Synthetic_op71},
+    {"PUT", "/r72/{id}", Synthetic_op72},
+    {"DELETE", "/r73/{id}", Synthetic_op73},
+    {"PATCH", "/r74/{id}", Synthetic_op74},
+    {"GET", "/r75/{id}", Synthetic_op75},
+    {"POST", "/r76/{id}", Synthetic_op76},
+    {"PUT", "/r77/{id}", Synthetic_op77},
+    {"DELETE", "/r78/{id}", Synthetic_op78},
+    {"PATCH", "/r79/{id}", Synthetic_op79},
+    {"GET", "/r80/{id}", Synthetic_op80},
+    {"POST", "/r81/{id}", Synthetic_op81},
+    {"PUT", "/r82/{id}", Synthetic_op82},
+    {"DELETE", "/r83/{id}", Synthetic_op83},
+    {"PATCH", "/r84/{id}", Synthetic_op84},
+    {"GET", "/r85/{id}", Synthetic_op85},
+    {"POST", "/r86/{id}", Synthetic_op86},
+    {"PUT", "/r87/{id}", Synthetic_op87},
+    {"DELETE", "/r88/{id}", Synthetic_op88},
+    {"PATCH", "/r89/{id}", Synthetic_op89},
+    {"GET", "/r90/{id}", Synthetic_op90},
+    {"POST", "/r91/{id}", Synthetic_op91},
+    {"PUT", "/r92/{id}", Synthetic_op92},
+    {"DELETE", "/r93/{id}", Synthetic_op93},
+    {"PATCH", "/r94/{id}", Synthetic_op94},
+    {"GET", "/r95/{id}", Synthetic_op95},
+    {"POST", "/r96/{id}", Synthetic_op96},
+    {"PUT", "/r97/{id}", Synthetic_op97},
+    {"DELETE", "/r98/{id}", Synthetic_op98},
+    {"PATCH", "/r99/{id}", Synthetic_op99},
+    {"GET", "/r100/{id}", Synthetic_op100},
+    {"POST", "/r101/{id}", Synthetic_op101},
+    {"PUT", "/r102/{id}", Synthetic_op102},
+    {"DELETE", "/r103/{id}", Synthetic_op103},
+    {"PATCH", "/r104/{id}", Synthetic_op104},
+    {"GET", "/r105/{id}", Synthetic_op105},
+    {"POST", "/r106/{id}", Synthetic_op106},
+    {"PUT", "/r107/{id}", Synthetic_op107},
+    {"DELETE", "/r108/{id}", Synthetic_op108},
+    {"PATCH", "/r109/{id}", Synthetic_op109},
+    {"GET", "/r110/{id}", Synthetic_op110},
+    {"POST", "/r111/{id}", Synthetic_op111},
+    {"PUT", "/r112/{id}", Synthetic_op112},
+    {"DELETE", "/r113/{id}", Synthetic_op113},
+    {"PATCH", "/r114/{id}", Synthetic_op114},
+    {"GET", "/r115/{id}", Synthetic_op115},
+    {"POST", "/r116/{id}", Synthetic_op116},
+    {"PUT", "/r117/{id}", Synthetic_op117},
+    {"DELETE", "/r118/{id}", Synthetic_op118},
+    {"PATCH", "/r119/{id}", Synthetic_op119},
+    {"GET", "/r120/{id}", Synthetic_op120},
+    {"POST", "/r121/{id}", Synthetic_op121},
+    {"PUT", "/r122/{id}", Synthetic_op122},
+    {"DELETE", "/r123/{id}", Synthetic_op123},
+    {"PATCH", "/r124/{id}", Synthetic_op124},
+    {"GET", "/r125/{id}", Synthetic_op125},
+    {"POST", "/r126/{id}", Synthetic_op126},
+    {"PUT", "/r127/{id}", Synthetic_op127},
+    {"DELETE", "/r128/{id}", Synthetic_op128},
+    {"PATCH", "/r129/{id}", Synthetic_op129},
+    {"GET", "/r130/{id}", Synthetic_op130},
+    {"POST", "/r131/{id}", Synthetic_op131},
+    {"PUT", "/r132/{id}", Synthetic_op132},
+    {"DELETE", "/r133/{id}", Synthetic_op133},
+    {"PATCH", "/r134/{id}", Synthetic_op134},
+    {"GET", "/r135/{id}", Synthetic_op135},
+    {"POST", "/r136/{id}", Synthetic_op136},
+    {"PUT", "/r137/{id}", Synthetic_op137},
+    {"DELETE", "/r138/{id}", Synthetic_op138},
+    {"PATCH", "/r139/{id}", Synthetic_op139},
+    {"GET", "/r140/{id}", Synthetic_op140},
+    {"POST", "/r141/{id}", Synthetic_op141},
+    {"PUT", "/r142/{id}", Synthetic_op142},
+    {"DELETE", "/r143/{id}", Synthetic_op143},
+    {"PATCH", "/r144/{id}", Synthetic_op144},
+    {"GET", "/r145/{id}", Synthetic_op145},
+    {"POST", "/r146/{id}", Synthetic_op146},
+    {"PUT", "/r147/{id}", Synthetic_op147},
+    {"DELETE", "/r148/{id}", Synthetic_op148},
+    {"PATCH", "/r149/{id}", Synthetic_op149},
+    {"GET", "/r150/{id}", Synthetic_op150},
+    {"POST", "/r151/{id}", Synthetic_op151},
+    {"PUT", "/r152/{id}", Synthetic_op152},
+    {"DELETE", "/r153/{id}", Synthetic_op153},
+    {"PATCH", "/r154/{id}", Synthetic_op154},
+    {"GET", "/r155/{id}", Synthetic_op155},
+    {"POST", "/r156/{id}", Synthetic_op156},
+    {"PUT", "/r157/{id}", Synthetic_op157},
+    {"DELETE", "/r158/{id}", Synthetic_op158},
+    {"PATCH", "/r159/{id}", Synthetic_op159},
+    {"GET", "/r160/{id}", Synthetic_op160},
+    {"POST", "/r161/{id}", Synthetic_op161},
+    {"PUT", "/r162/{id}", Synthetic_op162},
+    {"DELETE", "/r163/{id}", Synthetic_op163},
+    {"PATCH", "/r164/{id}", Synthetic_op164},
+    {"GET", "/r165/{id}", Synthetic_op165},
+    {"POST", "/r166/{id}", Synthetic_op166},
+    {"PUT", "/r167/{id}", Synthetic_op167},
+    {"DELETE", "/r168/{id}", Synthetic_op168},
+    {"PATCH", "/r169/{id}", Synthetic_op169},
+    {"GET", "/r170/{id}", Synthetic_op170},
+    {"POST", "/r171/{id}", Synthetic_op171},
+    {"PUT", "/r172/{id}", Synthetic_op172},
+    {"DELETE", "/r173/{id}", Synthetic_op173},
+    {"PATCH", "/r174/{id}", Synthetic_op174},
+    {"GET", "/r175/{id}", Synthetic_op175},
+    {"POST", "/r176/{id}", Synthetic_op176},
+    {"PUT", "/r177/{id}", Synthetic_op177},
+    {"DELETE", "/r178/{id}", Synthetic_op178},
+    {"PATCH", "/r179/{id}", Synthetic_op179},
+    {"GET", "/r180/{id}", Synthetic_op180},
+    {"POST", "/r181/{id}", Synthetic_op181},
+    {"PUT", "/r182/{id}", Synthetic_op182},
+    {"DELETE", "/r183/{id}", Synthetic_op183},
+    {"PATCH", "/r184/{id}", Synthetic_op184},
+    {"GET", "/r185/{id}", Synthetic_op185},
+    {"POST", "/r186/{id}", Synthetic_op186},
+    {"PUT", "/r187/{id}", Synthetic_op187},
+    {"DELETE", "/r188/{id}", Synthetic_op188},
+    {"PATCH", "/r189/{id}", Synthetic_op189},
+    {"GET", "/r190/{id}", Synthetic_op190},
+    {"POST", "/r191/{id}", Synthetic_op191},
+    {"PUT", "/r192/{id}", Synthetic_op192},
+    {"DELETE", "/r193/{id}", Synthetic_op193},
+    {"PATCH", "/r194/{id}", Synthetic_op194},
+    {"GET", "/r195/{id}", Synthetic_op195},
+    {"POST", "/r196/{id}", Synthetic_op196},
+    {"PUT", "/r197/{id}", Synthetic_op197},
+    {"DELETE", "/r198/{id}", Synthetic_op198},
+    {"PATCH", "/r199/{id}", Synthetic_op199},
+    {"GET", "/r200/{id}", Synthetic_op200},
+    {"POST", "/r201/{id}", Synthetic_op201},
+    {"PUT", "/r202/{id}", Synthetic_op202},
+    {"DELETE", "/r203/{id}", Synthetic_op203},
+    {"PATCH", "/r204/{id}", Synthetic_op204},
+    {"GET", "/r205/{id}", Synthetic_op205},
+    {"POST", "/r206/{id}", Synthetic_op206},
+    {"PUT", "/r207/{id}", Synthetic_op207},
+    {"DELETE", "/r208/{id}", Synthetic_op208},
+    {"PATCH", "/r209/{id}", Synthetic_op209},
+    {"GET", "/r210/{id}", Synthetic_op210},
+    {"POST", "/r211/{id}", Synthetic_op211},
+    {"PUT", "/r212/{id}", Synthetic_op212},
+    {"DELETE", "/r213/{id}", Synthetic_op213},
+    {"PATCH", "/r214/{id}", Synthetic_op214},
+    {"GET", "/r215/{id}", Synthetic_op215},
+    {"POST", "/r216/{id}", Synthetic_op216},
+    {"PUT", "/r217/{id}", Synthetic_op217},
+    {"DELETE", "/r218/{id}", Synthetic_op218},
+    {"PATCH", "/r219/{id}", Synthetic_op219},
+    {"GET", "/r220/{id}", Synthetic_op220},
+    {"POST", "/r221/{id}", Synthetic_op221},
+    {"PUT", "/r222/{id}", Synthetic_op222},
+    {"DELETE", "/r223/{id}", Synthetic_op223},
+    {"PATCH", "/r224/{id}", Synthetic_op224},
+    {"GET", "/r225/{id}", Synthetic_op225},
+    {"POST", "/r226/{id}", Synthetic_op226},
+    {"PUT", "/r227/{id}", Synthetic_op227},
+    {"DELETE", "/r228/{id}", Synthetic_op228},
+    {"PATCH", "/r229/{id}", Synthetic_op229},
+    {"GET", "/r230/{id}", Synthetic_op230},
+    {"POST", "/r231/{id}", Synthetic_op231},
+    {"PUT", "/r232/{id}", Synthetic_op232},
+    {"DELETE", "/r233/{id}", Synthetic_op233},
+    {"PATCH", "/r234/{id}", Synthetic_op234},
+    {"GET", "/r235/{id}", Synthetic_op235},
+    {"POST", "/r236/{id}", Synthetic_op236},
+    {"PUT", "/r237/{id}", Synthetic_op237},
+    {"DELETE", "/r238/{id}", Synthetic_op238},
+    {"PATCH", "/r239/{id}", Synthetic_op239},
+    {"GET", "/r240/{id}", Synthetic_op240},
+    {"POST", "/r241/{id}", Synthetic_op241},
+    {"PUT", "/r242/{id}", Synthetic_op242},
+    {"DELETE", "/r243/{id}", Synthetic_op243},
+    {"PATCH", "/r244/{id}", Synthetic_op244},
+    {"GET", "/r245/{id}", Synthetic_op245},
+    {"POST", "/r246/{id}", Synthetic_op246},
+    {"PUT", "/r247/{id}", Synthetic_op247},
+    {"DELETE", "/r248/{id}", Synthetic_op248},
+    {"PATCH", "/r249/{id}", Synthetic_op249},
+};
+static const int route_count = 250;
+
+void Synthetic_init(void) {
+    /* API initialization */
+}
+
+const char *Synthetic_error_str(Synthetic_error_t err) {
+    if (err >= 0 && err < Synthetic_ERR_COUNT) {
+        return error_strings[err];
+    }
+    return "Unknown error";
+}
+
+const Synthetic_route_t *Synthetic_get_routes(int *count) {
+    *count = route_count;
+    return routes;
+}
+
+Synthetic_error_t Synthetic_dispatch(Synthetic_request_t *req, Synthetic_response_t *resp) {
+    for (int i = 0; i < route_count; i++) {
+        if (strcmp(routes[i].method, req->method) == 0 &&
+            strcmp(routes[i].path, req->path) == 0) {
+            return routes[i].handler(req, resp);
+        }
+    }
+    resp->status_code = 404;
+    return Synthetic_ERR_NOT_FOUND;
+}
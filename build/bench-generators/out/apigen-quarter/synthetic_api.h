@@ -0,0 +1,405 @@
+/* AUTO-GENERATED by apigen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_API_H
+#define SYNTHETIC_API_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* API: Synthetic v1.0 */
+
+/* Types */
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req0_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res0_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req1_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res1_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req2_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res2_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req3_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res3_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req4_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res4_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req5_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res5_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req6_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res6_t;
+
+typedef struct {
+    char* name;
+    int32_t count;
+} Synthetic_Req7_t;
+
+typedef struct {
+    uint64_t id;
+    char* name;
+    int64_t created_at;
+} Synthetic_Res7_t;
+
+/* Error codes */
+typedef enum {
+    Synthetic_OK = 0,
+    Synthetic_ERR_INVALID_INPUT,
+    Synthetic_ERR_NOT_FOUND,
+    Synthetic_ERR_INTERNAL,
+    Synthetic_ERR_CONFLICT0,
+    Synthetic_ERR_CONFLICT1,
+    Synthetic_ERR_CONFLICT2,
+    Synthetic_ERR_CONFLICT3,
+    Synthetic_ERR_CONFLICT4,
+    Synthetic_ERR_CONFLICT5,
+    Synthetic_ERR_CONFLICT6,
+    Synthetic_ERR_CONFLICT7,
+    Synthetic_ERR_CONFLICT8,
+    Synthetic_ERR_CONFLICT9,
+    Synthetic_ERR_CONFLICT10,
+    Synthetic_ERR_CONFLICT11,
+    Synthetic_ERR_COUNT
+} Synthetic_error_t;
+
+/* Request context */
+typedef struct {
+    const char *method;
+    const char *path;
+    const char *body;
+    size_t body_len;
+    void *user_data;
+} Synthetic_request_t;
+
+typedef struct {
+    int status_code;
+    char *body;
+    size_t body_len;
+    size_t body_cap;
+} Synthetic_response_t;
+
+/* Handler function type */
+typedef Synthetic_error_t (*Synthetic_handler_fn)(Synthetic_request_t *req, Synthetic_response_t *resp);
+
+/* Route table entry */
+typedef struct {
+    const char *method;
+    const char *path;
+    Synthetic_handler_fn handler;
+} Synthetic_route_t;
+
+/* API functions */
+void Synthetic_init(void);
+Synthetic_error_t Synthetic_dispatch(Synthetic_request_t *req, Synthetic_response_t *resp);
+const Synthetic_route_t *Synthetic_get_routes(int *count);
+const char *Synthetic_error_str(Synthetic_error_t err);
+
+/* Endpoint handlers (implement these) */
+Synthetic_error_t Synthetic_op0(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op1(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op2(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op3(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op4(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op5(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op6(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op7(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op8(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op9(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op10(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op11(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op12(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op13(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op14(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op15(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op16(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op17(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op18(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op19(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op20(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op21(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op22(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op23(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op24(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op25(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op26(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op27(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op28(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op29(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op30(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op31(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op32(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op33(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op34(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op35(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op36(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op37(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op38(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op39(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op40(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op41(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op42(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op43(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op44(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op45(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op46(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op47(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op48(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op49(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op50(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op51(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op52(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op53(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op54(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op55(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op56(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op57(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op58(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op59(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op60(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op61(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op62(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op63(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op64(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op65(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op66(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op67(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op68(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op69(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op70(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op71(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op72(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op73(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op74(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op75(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op76(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op77(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op78(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op79(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op80(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op81(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op82(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op83(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op84(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op85(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op86(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op87(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op88(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op89(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op90(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op91(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op92(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op93(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op94(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op95(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op96(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op97(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op98(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op99(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op100(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op101(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op102(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op103(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op104(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op105(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op106(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op107(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op108(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op109(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op110(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op111(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op112(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op113(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op114(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op115(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op116(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op117(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op118(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op119(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op120(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op121(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op122(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op123(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op124(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op125(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op126(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op127(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op128(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op129(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op130(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op131(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op132(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op133(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op134(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op135(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op136(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op137(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op138(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op139(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op140(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op141(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op142(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op143(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op144(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op145(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op146(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op147(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op148(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op149(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op150(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op151(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op152(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op153(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op154(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op155(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op156(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op157(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op158(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op159(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op160(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op161(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op162(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op163(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op164(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op165(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op166(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op167(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op168(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op169(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op170(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op171(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op172(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op173(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op174(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op175(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op176(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op177(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op178(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op179(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op180(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op181(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op182(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op183(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op184(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op185(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op186(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op187(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op188(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op189(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op190(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op191(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op192(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op193(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op194(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op195(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op196(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op197(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op198(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op199(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op200(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op201(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op202(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op203(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op204(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op205(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op206(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op207(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op208(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op209(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op210(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op211(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op212(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op213(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op214(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op215(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op216(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op217(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op218(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op219(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op220(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op221(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op222(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op223(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op224(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op225(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op226(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op227(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op228(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op229(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op230(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op231(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op232(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op233(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op234(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op235(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op236(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op237(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op238(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op239(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op240(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op241(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op242(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op243(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op244(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op245(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op246(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op247(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op248(Synthetic_request_t *req, Synthetic_response_t *resp);
+Synthetic_error_t Synthetic_op249(Synthetic_request_t *req, Synthetic_response_t *resp);
+
+#endif /* SYNTHETIC_API_H */
@@ -0,0 +1,5047 @@
+/* AUTO-GENERATED by bddgen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_BDD_H
+#define SYNTHETIC_BDD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Test result status */
+typedef enum {
+    SYNTHETIC_PASS = 0,
+    SYNTHETIC_FAIL,
+    SYNTHETIC_SKIP,
+    SYNTHETIC_PENDING,
+    SYNTHETIC_ERROR
+} SYNTHETIC_result_t;
+
+/* Step execution context */
+typedef struct {
+    void *world;           /* User-defined world state */
+    const char *step_text; /* Current step text */
+    int step_line;         /* Line number in feature file */
+    const char *scenario;  /* Current scenario name */
+    const char *feature;   /* Current feature name */
+} SYNTHETIC_context_t;
+
+/* Test run statistics */
+typedef struct {
+    int total_scenarios;
+    int passed_scenarios;
+    int failed_scenarios;
+    int skipped_scenarios;
+    int total_steps;
+    int passed_steps;
+    int failed_steps;
+} SYNTHETIC_stats_t;
+
+/* Step function prototype */
+typedef SYNTHETIC_result_t (*SYNTHETIC_step_fn)(SYNTHETIC_context_t *ctx);
+
+/* Test runner */
+void SYNTHETIC_run_all(void *world, SYNTHETIC_stats_t *stats);
+void SYNTHETIC_run_scenario(void *world, int scenario_index, SYNTHETIC_stats_t *stats);
+void SYNTHETIC_print_stats(const SYNTHETIC_stats_t *stats);
+
+/* Step definitions (implement these in synthetic_steps.c) */
+SYNTHETIC_result_t step_record_0_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_has_value_0(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_has_value_7(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_has_value_14(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_has_value_21(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_has_value_28(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_has_value_35(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_has_value_42(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_has_value_49(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_has_value_56(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_has_value_63(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_has_value_70(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_has_value_77(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_has_value_84(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_has_value_91(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_has_value_98(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_has_value_105(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_has_value_112(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_has_value_119(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_has_value_126(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_has_value_133(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_has_value_140(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_has_value_147(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_has_value_154(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_has_value_161(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_has_value_168(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_has_value_175(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_has_value_182(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_has_value_189(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_has_value_196(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_has_value_203(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_has_value_210(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_has_value_217(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_has_value_224(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_has_value_231(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_has_value_238(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_has_value_245(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_has_value_252(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_has_value_259(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_has_value_266(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_has_value_273(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_has_value_280(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_has_value_287(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_has_value_294(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_has_value_301(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_has_value_308(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_has_value_315(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_has_value_322(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_has_value_329(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_has_value_336(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_has_value_343(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_has_value_350(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_has_value_357(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_has_value_364(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_has_value_371(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_has_value_378(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_has_value_385(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_has_value_392(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_has_value_399(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_has_value_406(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_has_value_413(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_has_value_420(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_has_value_427(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_has_value_434(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_has_value_441(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_has_value_448(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_has_value_455(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_has_value_462(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_has_value_469(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_has_value_476(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_has_value_483(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_has_value_490(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_has_value_497(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_has_value_504(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_has_value_511(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_has_value_518(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_has_value_525(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_has_value_532(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_has_value_539(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_has_value_546(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_has_value_553(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_has_value_560(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_has_value_567(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_has_value_574(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_has_value_581(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_has_value_588(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_has_value_595(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_has_value_602(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_has_value_609(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_has_value_616(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_has_value_623(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_has_value_630(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_has_value_637(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_has_value_644(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_has_value_651(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_has_value_658(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_has_value_665(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_has_value_672(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_has_value_679(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_has_value_686(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_has_value_693(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_has_value_700(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_has_value_707(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_has_value_714(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_has_value_721(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_has_value_728(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_has_value_735(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_has_value_742(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_has_value_749(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_has_value_756(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_has_value_763(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_has_value_770(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_has_value_777(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_has_value_784(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_has_value_791(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_has_value_798(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_has_value_805(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_has_value_812(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_has_value_819(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_has_value_826(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_has_value_833(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_has_value_840(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_has_value_847(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_has_value_854(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_has_value_861(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_has_value_868(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_has_value_875(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_has_value_882(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_has_value_889(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_has_value_896(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_has_value_903(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_has_value_910(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_has_value_917(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_has_value_924(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_has_value_931(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_has_value_938(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_has_value_945(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_has_value_952(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_has_value_959(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_has_value_966(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_has_value_973(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_has_value_980(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_has_value_987(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_has_value_994(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_has_value_1001(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_has_value_1008(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_has_value_1015(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_has_value_1022(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_has_value_1029(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_has_value_1036(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_has_value_1043(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_has_value_1050(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_has_value_1057(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_has_value_1064(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_has_value_1071(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_has_value_1078(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_has_value_1085(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_has_value_1092(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_has_value_1099(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_has_value_1106(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_has_value_1113(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_has_value_1120(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_has_value_1127(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_has_value_1134(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_has_value_1141(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_has_value_1148(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_has_value_1155(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_has_value_1162(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_has_value_1169(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_has_value_1176(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_has_value_1183(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_has_value_1190(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_has_value_1197(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_has_value_1204(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_has_value_1211(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_has_value_1218(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_has_value_1225(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_has_value_1232(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_has_value_1239(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_has_value_1246(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_has_value_1253(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_has_value_1260(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_has_value_1267(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_has_value_1274(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_has_value_1281(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_has_value_1288(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_has_value_1295(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_has_value_1302(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_has_value_1309(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_has_value_1316(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_has_value_1323(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_has_value_1330(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_has_value_1337(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_has_value_1344(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_has_value_1351(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_has_value_1358(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_has_value_1365(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_has_value_1372(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_has_value_1379(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_has_value_1386(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_has_value_1393(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_has_value_1400(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_has_value_1407(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_has_value_1414(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_has_value_1421(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_has_value_1428(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_has_value_1435(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_has_value_1442(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_has_value_1449(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_has_value_1456(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_has_value_1463(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_has_value_1470(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_has_value_1477(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_has_value_1484(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_has_value_1491(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_has_value_1498(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_has_value_1505(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_has_value_1512(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_has_value_1519(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_has_value_1526(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_has_value_1533(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_has_value_1540(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_has_value_1547(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_has_value_1554(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_has_value_1561(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_has_value_1568(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_has_value_1575(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_has_value_1582(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_has_value_1589(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_has_value_1596(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_has_value_1603(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_has_value_1610(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_has_value_1617(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_has_value_1624(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_has_value_1631(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_has_value_1638(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_has_value_1645(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_has_value_1652(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_has_value_1659(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_has_value_1666(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_has_value_1673(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_has_value_1680(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_has_value_1687(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_has_value_1694(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_has_value_1701(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_has_value_1708(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_has_value_1715(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_has_value_1722(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_has_value_1729(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_has_value_1736(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_has_value_1743(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_250_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_250_has_value_1750(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_250_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_250_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_250_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_251_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_251_has_value_1757(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_251_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_251_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_251_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_252_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_252_has_value_1764(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_252_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_252_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_252_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_253_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_253_has_value_1771(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_253_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_253_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_253_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_254_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_254_has_value_1778(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_254_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_254_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_254_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_255_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_255_has_value_1785(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_255_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_255_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_255_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_256_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_256_has_value_1792(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_256_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_256_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_256_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_257_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_257_has_value_1799(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_257_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_257_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_257_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_258_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_258_has_value_1806(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_258_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_258_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_258_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_259_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_259_has_value_1813(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_259_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_259_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_259_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_260_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_260_has_value_1820(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_260_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_260_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_260_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_261_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_261_has_value_1827(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_261_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_261_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_261_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_262_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_262_has_value_1834(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_262_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_262_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_262_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_263_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_263_has_value_1841(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_263_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_263_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_263_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_264_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_264_has_value_1848(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_264_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_264_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_264_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_265_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_265_has_value_1855(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_265_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_265_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_265_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_266_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_266_has_value_1862(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_266_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_266_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_266_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_267_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_267_has_value_1869(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_267_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_267_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_267_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_268_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_268_has_value_1876(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_268_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_268_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_268_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_269_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_269_has_value_1883(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_269_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_269_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_269_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_270_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_270_has_value_1890(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_270_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_270_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_270_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_271_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_271_has_value_1897(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_271_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_271_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_271_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_272_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_272_has_value_1904(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_272_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_272_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_272_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_273_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_273_has_value_1911(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_273_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_273_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_273_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_274_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_274_has_value_1918(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_274_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_274_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_274_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_275_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_275_has_value_1925(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_275_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_275_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_275_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_276_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_276_has_value_1932(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_276_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_276_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_276_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_277_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_277_has_value_1939(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_277_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_277_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_277_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_278_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_278_has_value_1946(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_278_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_278_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_278_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_279_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_279_has_value_1953(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_279_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_279_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_279_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_280_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_280_has_value_1960(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_280_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_280_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_280_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_281_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_281_has_value_1967(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_281_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_281_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_281_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_282_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_282_has_value_1974(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_282_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_282_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_282_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_283_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_283_has_value_1981(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_283_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_283_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_283_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_284_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_284_has_value_1988(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_284_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_284_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_284_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_285_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_285_has_value_1995(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_285_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_285_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_285_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_286_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_286_has_value_2002(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_286_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_286_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_286_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_287_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_287_has_value_2009(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_287_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_287_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_287_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_288_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_288_has_value_2016(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_288_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_288_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_288_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_289_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_289_has_value_2023(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_289_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_289_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_289_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_290_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_290_has_value_2030(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_290_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_290_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_290_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_291_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_291_has_value_2037(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_291_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_291_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_291_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_292_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_292_has_value_2044(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_292_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_292_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_292_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_293_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_293_has_value_2051(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_293_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_293_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_293_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_294_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_294_has_value_2058(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_294_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_294_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_294_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_295_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_295_has_value_2065(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_295_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_295_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_295_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_296_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_296_has_value_2072(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_296_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_296_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_296_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_297_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_297_has_value_2079(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_297_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_297_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_297_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_298_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_298_has_value_2086(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_298_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_298_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_298_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_299_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_299_has_value_2093(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_299_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_299_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_299_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_300_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_300_has_value_2100(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_300_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_300_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_300_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_301_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_301_has_value_2107(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_301_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_301_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_301_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_302_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_302_has_value_2114(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_302_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_302_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_302_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_303_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_303_has_value_2121(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_303_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_303_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_303_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_304_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_304_has_value_2128(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_304_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_304_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_304_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_305_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_305_has_value_2135(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_305_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_305_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_305_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_306_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_306_has_value_2142(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_306_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_306_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_306_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_307_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_307_has_value_2149(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_307_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_307_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_307_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_308_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_308_has_value_2156(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_308_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_308_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_308_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_309_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_309_has_value_2163(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_309_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_309_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_309_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_310_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_310_has_value_2170(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_310_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_310_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_310_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_311_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_311_has_value_2177(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_311_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_311_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_311_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_312_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_312_has_value_2184(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_312_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_312_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_312_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_313_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_313_has_value_2191(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_313_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_313_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_313_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_314_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_314_has_value_2198(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_314_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_314_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_314_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_315_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_315_has_value_2205(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_315_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_315_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_315_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_316_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_316_has_value_2212(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_316_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_316_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_316_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_317_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_317_has_value_2219(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_317_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_317_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_317_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_318_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_318_has_value_2226(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_318_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_318_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_318_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_319_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_319_has_value_2233(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_319_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_319_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_319_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_320_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_320_has_value_2240(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_320_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_320_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_320_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_321_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_321_has_value_2247(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_321_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_321_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_321_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_322_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_322_has_value_2254(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_322_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_322_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_322_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_323_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_323_has_value_2261(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_323_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_323_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_323_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_324_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_324_has_value_2268(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_324_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_324_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_324_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_325_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_325_has_value_2275(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_325_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_325_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_325_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_326_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_326_has_value_2282(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_326_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_326_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_326_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_327_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_327_has_value_2289(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_327_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_327_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_327_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_328_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_328_has_value_2296(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_328_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_328_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_328_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_329_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_329_has_value_2303(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_329_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_329_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_329_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_330_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_330_has_value_2310(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_330_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_330_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_330_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_331_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_331_has_value_2317(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_331_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_331_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_331_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_332_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_332_has_value_2324(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_332_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_332_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_332_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_333_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_333_has_value_2331(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_333_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_333_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_333_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_334_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_334_has_value_2338(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_334_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_334_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_334_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_335_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_335_has_value_2345(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_335_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_335_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_335_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_336_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_336_has_value_2352(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_336_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_336_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_336_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_337_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_337_has_value_2359(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_337_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_337_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_337_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_338_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_338_has_value_2366(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_338_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_338_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_338_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_339_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_339_has_value_2373(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_339_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_339_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_339_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_340_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_340_has_value_2380(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_340_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_340_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_340_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_341_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_341_has_value_2387(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_341_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_341_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_341_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_342_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_342_has_value_2394(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_342_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_342_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_342_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_343_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_343_has_value_2401(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_343_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_343_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_343_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_344_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_344_has_value_2408(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_344_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_344_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_344_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_345_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_345_has_value_2415(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_345_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_345_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_345_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_346_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_346_has_value_2422(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_346_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_346_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_346_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_347_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_347_has_value_2429(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_347_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_347_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_347_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_348_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_348_has_value_2436(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_348_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_348_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_348_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_349_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_349_has_value_2443(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_349_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_349_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_349_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_350_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_350_has_value_2450(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_350_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_350_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_350_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_351_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_351_has_value_2457(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_351_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_351_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_351_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_352_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_352_has_value_2464(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_352_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_352_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_352_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_353_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_353_has_value_2471(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_353_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_353_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_353_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_354_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_354_has_value_2478(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_354_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_354_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_354_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_355_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_355_has_value_2485(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_355_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_355_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_355_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_356_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_356_has_value_2492(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_356_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_356_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_356_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_357_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_357_has_value_2499(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_357_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_357_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_357_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_358_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_358_has_value_2506(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_358_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_358_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_358_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_359_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_359_has_value_2513(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_359_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_359_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_359_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_360_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_360_has_value_2520(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_360_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_360_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_360_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_361_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_361_has_value_2527(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_361_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_361_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_361_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_362_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_362_has_value_2534(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_362_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_362_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_362_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_363_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_363_has_value_2541(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_363_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_363_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_363_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_364_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_364_has_value_2548(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_364_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_364_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_364_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_365_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_365_has_value_2555(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_365_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_365_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_365_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_366_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_366_has_value_2562(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_366_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_366_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_366_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_367_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_367_has_value_2569(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_367_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_367_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_367_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_368_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_368_has_value_2576(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_368_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_368_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_368_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_369_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_369_has_value_2583(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_369_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_369_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_369_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_370_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_370_has_value_2590(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_370_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_370_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_370_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_371_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_371_has_value_2597(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_371_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_371_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_371_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_372_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_372_has_value_2604(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_372_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_372_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_372_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_373_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_373_has_value_2611(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_373_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_373_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_373_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_374_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_374_has_value_2618(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_374_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_374_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_374_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_375_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_375_has_value_2625(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_375_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_375_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_375_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_376_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_376_has_value_2632(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_376_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_376_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_376_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_377_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_377_has_value_2639(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_377_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_377_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_377_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_378_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_378_has_value_2646(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_378_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_378_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_378_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_379_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_379_has_value_2653(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_379_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_379_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_379_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_380_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_380_has_value_2660(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_380_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_380_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_380_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_381_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_381_has_value_2667(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_381_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_381_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_381_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_382_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_382_has_value_2674(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_382_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_382_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_382_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_383_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_383_has_value_2681(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_383_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_383_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_383_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_384_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_384_has_value_2688(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_384_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_384_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_384_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_385_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_385_has_value_2695(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_385_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_385_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_385_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_386_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_386_has_value_2702(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_386_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_386_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_386_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_387_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_387_has_value_2709(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_387_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_387_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_387_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_388_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_388_has_value_2716(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_388_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_388_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_388_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_389_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_389_has_value_2723(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_389_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_389_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_389_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_390_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_390_has_value_2730(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_390_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_390_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_390_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_391_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_391_has_value_2737(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_391_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_391_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_391_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_392_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_392_has_value_2744(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_392_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_392_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_392_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_393_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_393_has_value_2751(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_393_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_393_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_393_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_394_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_394_has_value_2758(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_394_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_394_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_394_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_395_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_395_has_value_2765(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_395_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_395_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_395_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_396_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_396_has_value_2772(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_396_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_396_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_396_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_397_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_397_has_value_2779(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_397_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_397_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_397_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_398_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_398_has_value_2786(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_398_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_398_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_398_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_399_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_399_has_value_2793(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_399_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_399_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_399_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_400_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_400_has_value_2800(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_400_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_400_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_400_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_401_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_401_has_value_2807(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_401_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_401_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_401_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_402_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_402_has_value_2814(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_402_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_402_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_402_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_403_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_403_has_value_2821(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_403_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_403_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_403_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_404_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_404_has_value_2828(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_404_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_404_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_404_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_405_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_405_has_value_2835(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_405_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_405_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_405_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_406_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_406_has_value_2842(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_406_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_406_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_406_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_407_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_407_has_value_2849(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_407_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_407_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_407_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_408_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_408_has_value_2856(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_408_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_408_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_408_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_409_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_409_has_value_2863(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_409_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_409_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_409_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_410_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_410_has_value_2870(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_410_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_410_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_410_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_411_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_411_has_value_2877(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_411_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_411_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_411_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_412_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_412_has_value_2884(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_412_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_412_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_412_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_413_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_413_has_value_2891(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_413_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_413_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_413_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_414_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_414_has_value_2898(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_414_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_414_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_414_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_415_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_415_has_value_2905(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_415_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_415_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_415_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_416_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_416_has_value_2912(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_416_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_416_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_416_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_417_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_417_has_value_2919(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_417_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_417_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_417_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_418_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_418_has_value_2926(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_418_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_418_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_418_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_419_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_419_has_value_2933(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_419_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_419_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_419_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_420_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_420_has_value_2940(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_420_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_420_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_420_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_421_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_421_has_value_2947(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_421_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_421_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_421_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_422_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_422_has_value_2954(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_422_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_422_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_422_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_423_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_423_has_value_2961(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_423_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_423_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_423_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_424_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_424_has_value_2968(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_424_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_424_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_424_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_425_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_425_has_value_2975(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_425_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_425_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_425_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_426_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_426_has_value_2982(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_426_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_426_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_426_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_427_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_427_has_value_2989(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_427_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_427_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_427_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_428_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_428_has_value_2996(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_428_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_428_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_428_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_429_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_429_has_value_3003(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_429_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_429_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_429_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_430_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_430_has_value_3010(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_430_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_430_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_430_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_431_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_431_has_value_3017(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_431_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_431_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_431_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_432_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_432_has_value_3024(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_432_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_432_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_432_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_433_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_433_has_value_3031(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_433_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_433_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_433_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_434_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_434_has_value_3038(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_434_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_434_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_434_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_435_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_435_has_value_3045(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_435_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_435_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_435_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_436_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_436_has_value_3052(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_436_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_436_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_436_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_437_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_437_has_value_3059(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_437_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_437_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_437_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_438_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_438_has_value_3066(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_438_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_438_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_438_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_439_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_439_has_value_3073(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_439_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_439_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_439_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_440_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_440_has_value_3080(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_440_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_440_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_440_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_441_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_441_has_value_3087(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_441_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_441_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_441_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_442_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_442_has_value_3094(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_442_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_442_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_442_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_443_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_443_has_value_3101(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_443_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_443_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_443_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_444_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_444_has_value_3108(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_444_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_444_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_444_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_445_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_445_has_value_3115(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_445_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_445_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_445_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_446_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_446_has_value_3122(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_446_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_446_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_446_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_447_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_447_has_value_3129(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_447_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_447_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_447_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_448_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_448_has_value_3136(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_448_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_448_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_448_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_449_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_449_has_value_3143(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_449_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_449_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_449_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_450_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_450_has_value_3150(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_450_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_450_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_450_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_451_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_451_has_value_3157(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_451_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_451_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_451_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_452_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_452_has_value_3164(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_452_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_452_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_452_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_453_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_453_has_value_3171(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_453_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_453_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_453_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_454_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_454_has_value_3178(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_454_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_454_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_454_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_455_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_455_has_value_3185(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_455_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_455_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_455_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_456_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_456_has_value_3192(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_456_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_456_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_456_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_457_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_457_has_value_3199(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_457_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_457_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_457_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_458_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_458_has_value_3206(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_458_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_458_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_458_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_459_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_459_has_value_3213(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_459_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_459_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_459_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_460_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_460_has_value_3220(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_460_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_460_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_460_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_461_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_461_has_value_3227(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_461_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_461_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_461_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_462_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_462_has_value_3234(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_462_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_462_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_462_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_463_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_463_has_value_3241(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_463_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_463_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_463_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_464_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_464_has_value_3248(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_464_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_464_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_464_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_465_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_465_has_value_3255(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_465_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_465_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_465_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_466_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_466_has_value_3262(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_466_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_466_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_466_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_467_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_467_has_value_3269(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_467_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_467_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_467_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_468_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_468_has_value_3276(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_468_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_468_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_468_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_469_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_469_has_value_3283(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_469_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_469_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_469_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_470_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_470_has_value_3290(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_470_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_470_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_470_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_471_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_471_has_value_3297(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_471_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_471_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_471_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_472_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_472_has_value_3304(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_472_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_472_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_472_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_473_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_473_has_value_3311(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_473_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_473_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_473_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_474_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_474_has_value_3318(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_474_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_474_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_474_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_475_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_475_has_value_3325(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_475_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_475_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_475_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_476_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_476_has_value_3332(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_476_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_476_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_476_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_477_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_477_has_value_3339(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_477_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_477_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_477_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_478_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_478_has_value_3346(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_478_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_478_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_478_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_479_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_479_has_value_3353(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_479_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_479_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_479_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_480_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_480_has_value_3360(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_480_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_480_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_480_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_481_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_481_has_value_3367(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_481_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_481_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_481_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_482_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_482_has_value_3374(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_482_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_482_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_482_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_483_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_483_has_value_3381(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_483_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_483_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_483_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_484_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_484_has_value_3388(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_484_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_484_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_484_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_485_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_485_has_value_3395(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_485_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_485_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_485_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_486_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_486_has_value_3402(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_486_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_486_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_486_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_487_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_487_has_value_3409(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_487_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_487_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_487_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_488_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_488_has_value_3416(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_488_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_488_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_488_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_489_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_489_has_value_3423(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_489_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_489_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_489_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_490_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_490_has_value_3430(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_490_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_490_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_490_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_491_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_491_has_value_3437(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_491_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_491_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_491_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_492_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_492_has_value_3444(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_492_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_492_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_492_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_493_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_493_has_value_3451(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_493_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_493_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_493_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_494_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_494_has_value_3458(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_494_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_494_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_494_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_495_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_495_has_value_3465(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_495_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_495_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_495_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_496_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_496_has_value_3472(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_496_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_496_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_496_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_497_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_497_has_value_3479(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_497_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_497_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_497_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_498_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_498_has_value_3486(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_498_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_498_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_498_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_499_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_499_has_value_3493(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_499_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_499_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_499_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_500_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_500_has_value_3500(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_500_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_500_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_500_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_501_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_501_has_value_3507(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_501_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_501_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_501_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_502_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_502_has_value_3514(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_502_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_502_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_502_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_503_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_503_has_value_3521(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_503_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_503_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_503_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_504_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_504_has_value_3528(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_504_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_504_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_504_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_505_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_505_has_value_3535(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_505_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_505_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_505_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_506_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_506_has_value_3542(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_506_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_506_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_506_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_507_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_507_has_value_3549(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_507_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_507_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_507_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_508_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_508_has_value_3556(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_508_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_508_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_508_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_509_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_509_has_value_3563(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_509_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_509_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_509_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_510_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_510_has_value_3570(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_510_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_510_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_510_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_511_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_511_has_value_3577(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_511_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_511_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_511_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_512_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_512_has_value_3584(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_512_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_512_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_512_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_513_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_513_has_value_3591(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_513_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_513_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_513_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_514_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_514_has_value_3598(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_514_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_514_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_514_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_515_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_515_has_value_3605(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_515_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_515_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_515_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_516_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_516_has_value_3612(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_516_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_516_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_516_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_517_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_517_has_value_3619(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_517_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_517_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_517_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_518_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_518_has_value_3626(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_518_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_518_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_518_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_519_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_519_has_value_3633(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_519_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_519_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_519_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_520_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_520_has_value_3640(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_520_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_520_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_520_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_521_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_521_has_value_3647(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_521_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_521_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_521_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_522_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_522_has_value_3654(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_522_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_522_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_522_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_523_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_523_has_value_3661(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_523_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_523_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_523_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_524_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_524_has_value_3668(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_524_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_524_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_524_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_525_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_525_has_value_3675(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_525_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_525_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_525_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_526_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_526_has_value_3682(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_526_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_526_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_526_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_527_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_527_has_value_3689(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_527_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_527_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_527_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_528_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_528_has_value_3696(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_528_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_528_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_528_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_529_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_529_has_value_3703(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_529_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_529_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_529_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_530_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_530_has_value_3710(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_530_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_530_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_530_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_531_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_531_has_value_3717(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_531_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_531_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_531_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_532_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_532_has_value_3724(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_532_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_532_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_532_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_533_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_533_has_value_3731(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_533_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_533_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_533_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_534_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_534_has_value_3738(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_534_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_534_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_534_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_535_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_535_has_value_3745(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_535_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_535_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_535_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_536_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_536_has_value_3752(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_536_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_536_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_536_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_537_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_537_has_value_3759(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_537_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_537_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_537_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_538_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_538_has_value_3766(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_538_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_538_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_538_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_539_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_539_has_value_3773(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_539_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_539_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_539_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_540_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_540_has_value_3780(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_540_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_540_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_540_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_541_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_541_has_value_3787(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_541_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_541_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_541_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_542_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_542_has_value_3794(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_542_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_542_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_542_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_543_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_543_has_value_3801(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_543_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_543_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_543_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_544_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_544_has_value_3808(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_544_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_544_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_544_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_545_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_545_has_value_3815(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_545_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_545_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_545_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_546_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_546_has_value_3822(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_546_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_546_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_546_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_547_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_547_has_value_3829(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_547_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_547_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_547_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_548_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_548_has_value_3836(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_548_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_548_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_548_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_549_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_549_has_value_3843(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_549_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_549_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_549_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_550_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_550_has_value_3850(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_550_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_550_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_550_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_551_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_551_has_value_3857(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_551_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_551_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_551_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_552_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_552_has_value_3864(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_552_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_552_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_552_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_553_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_553_has_value_3871(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_553_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_553_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_553_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_554_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_554_has_value_3878(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_554_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_554_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_554_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_555_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_555_has_value_3885(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_555_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_555_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_555_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_556_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_556_has_value_3892(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_556_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_556_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_556_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_557_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_557_has_value_3899(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_557_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_557_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_557_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_558_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_558_has_value_3906(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_558_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_558_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_558_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_559_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_559_has_value_3913(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_559_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_559_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_559_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_560_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_560_has_value_3920(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_560_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_560_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_560_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_561_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_561_has_value_3927(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_561_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_561_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_561_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_562_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_562_has_value_3934(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_562_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_562_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_562_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_563_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_563_has_value_3941(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_563_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_563_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_563_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_564_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_564_has_value_3948(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_564_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_564_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_564_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_565_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_565_has_value_3955(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_565_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_565_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_565_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_566_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_566_has_value_3962(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_566_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_566_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_566_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_567_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_567_has_value_3969(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_567_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_567_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_567_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_568_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_568_has_value_3976(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_568_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_568_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_568_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_569_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_569_has_value_3983(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_569_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_569_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_569_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_570_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_570_has_value_3990(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_570_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_570_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_570_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_571_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_571_has_value_3997(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_571_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_571_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_571_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_572_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_572_has_value_4004(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_572_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_572_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_572_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_573_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_573_has_value_4011(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_573_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_573_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_573_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_574_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_574_has_value_4018(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_574_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_574_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_574_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_575_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_575_has_value_4025(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_575_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_575_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_575_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_576_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_576_has_value_4032(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_576_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_576_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_576_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_577_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_577_has_value_4039(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_577_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_577_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_577_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_578_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_578_has_value_4046(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_578_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_578_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_578_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_579_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_579_has_value_4053(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_579_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_579_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_579_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_580_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_580_has_value_4060(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_580_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_580_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_580_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_581_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_581_has_value_4067(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_581_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_581_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_581_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_582_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_582_has_value_4074(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_582_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_582_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_582_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_583_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_583_has_value_4081(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_583_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_583_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_583_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_584_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_584_has_value_4088(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_584_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_584_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_584_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_585_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_585_has_value_4095(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_585_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_585_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_585_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_586_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_586_has_value_4102(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_586_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_586_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_586_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_587_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_587_has_value_4109(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_587_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_587_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_587_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_588_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_588_has_value_4116(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_588_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_588_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_588_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_589_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_589_has_value_4123(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_589_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_589_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_589_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_590_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_590_has_value_4130(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_590_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_590_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_590_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_591_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_591_has_value_4137(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_591_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_591_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_591_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_592_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_592_has_value_4144(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_592_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_592_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_592_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_593_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_593_has_value_4151(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_593_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_593_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_593_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_594_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_594_has_value_4158(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_594_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_594_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_594_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_595_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_595_has_value_4165(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_595_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_595_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_595_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_596_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_596_has_value_4172(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_596_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_596_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_596_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_597_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_597_has_value_4179(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_597_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_597_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_597_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_598_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_598_has_value_4186(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_598_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_598_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_598_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_599_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_599_has_value_4193(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_599_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_599_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_599_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_600_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_600_has_value_4200(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_600_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_600_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_600_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_601_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_601_has_value_4207(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_601_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_601_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_601_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_602_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_602_has_value_4214(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_602_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_602_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_602_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_603_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_603_has_value_4221(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_603_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_603_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_603_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_604_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_604_has_value_4228(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_604_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_604_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_604_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_605_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_605_has_value_4235(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_605_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_605_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_605_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_606_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_606_has_value_4242(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_606_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_606_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_606_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_607_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_607_has_value_4249(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_607_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_607_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_607_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_608_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_608_has_value_4256(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_608_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_608_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_608_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_609_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_609_has_value_4263(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_609_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_609_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_609_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_610_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_610_has_value_4270(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_610_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_610_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_610_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_611_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_611_has_value_4277(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_611_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_611_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_611_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_612_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_612_has_value_4284(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_612_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_612_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_612_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_613_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_613_has_value_4291(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_613_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_613_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_613_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_614_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_614_has_value_4298(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_614_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_614_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_614_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_615_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_615_has_value_4305(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_615_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_615_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_615_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_616_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_616_has_value_4312(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_616_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_616_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_616_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_617_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_617_has_value_4319(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_617_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_617_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_617_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_618_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_618_has_value_4326(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_618_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_618_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_618_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_619_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_619_has_value_4333(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_619_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_619_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_619_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_620_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_620_has_value_4340(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_620_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_620_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_620_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_621_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_621_has_value_4347(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_621_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_621_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_621_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_622_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_622_has_value_4354(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_622_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_622_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_622_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_623_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_623_has_value_4361(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_623_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_623_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_623_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_624_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_624_has_value_4368(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_624_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_624_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_624_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_625_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_625_has_value_4375(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_625_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_625_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_625_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_626_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_626_has_value_4382(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_626_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_626_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_626_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_627_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_627_has_value_4389(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_627_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_627_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_627_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_628_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_628_has_value_4396(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_628_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_628_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_628_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_629_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_629_has_value_4403(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_629_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_629_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_629_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_630_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_630_has_value_4410(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_630_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_630_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_630_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_631_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_631_has_value_4417(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_631_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_631_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_631_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_632_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_632_has_value_4424(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_632_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_632_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_632_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_633_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_633_has_value_4431(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_633_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_633_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_633_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_634_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_634_has_value_4438(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_634_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_634_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_634_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_635_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_635_has_value_4445(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_635_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_635_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_635_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_636_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_636_has_value_4452(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_636_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_636_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_636_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_637_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_637_has_value_4459(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_637_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_637_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_637_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_638_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_638_has_value_4466(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_638_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_638_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_638_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_639_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_639_has_value_4473(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_639_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_639_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_639_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_640_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_640_has_value_4480(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_640_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_640_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_640_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_641_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_641_has_value_4487(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_641_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_641_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_641_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_642_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_642_has_value_4494(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_642_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_642_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_642_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_643_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_643_has_value_4501(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_643_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_643_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_643_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_644_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_644_has_value_4508(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_644_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_644_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_644_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_645_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_645_has_value_4515(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_645_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_645_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_645_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_646_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_646_has_value_4522(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_646_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_646_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_646_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_647_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_647_has_value_4529(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_647_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_647_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_647_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_648_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_648_has_value_4536(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_648_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_648_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_648_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_649_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_649_has_value_4543(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_649_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_649_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_649_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_650_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_650_has_value_4550(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_650_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_650_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_650_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_651_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_651_has_value_4557(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_651_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_651_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_651_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_652_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_652_has_value_4564(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_652_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_652_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_652_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_653_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_653_has_value_4571(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_653_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_653_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_653_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_654_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_654_has_value_4578(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_654_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_654_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_654_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_655_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_655_has_value_4585(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_655_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_655_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_655_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_656_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_656_has_value_4592(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_656_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_656_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_656_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_657_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_657_has_value_4599(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_657_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_657_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_657_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_658_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_658_has_value_4606(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_658_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_658_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_658_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_659_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_659_has_value_4613(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_659_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_659_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_659_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_660_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_660_has_value_4620(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_660_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_660_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_660_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_661_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_661_has_value_4627(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_661_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_661_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_661_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_662_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_662_has_value_4634(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_662_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_662_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_662_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_663_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_663_has_value_4641(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_663_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_663_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_663_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_664_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_664_has_value_4648(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_664_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_664_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_664_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_665_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_665_has_value_4655(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_665_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_665_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_665_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_666_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_666_has_value_4662(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_666_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_666_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_666_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_667_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_667_has_value_4669(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_667_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_667_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_667_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_668_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_668_has_value_4676(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_668_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_668_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_668_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_669_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_669_has_value_4683(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_669_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_669_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_669_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_670_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_670_has_value_4690(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_670_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_670_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_670_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_671_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_671_has_value_4697(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_671_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_671_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_671_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_672_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_672_has_value_4704(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_672_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_672_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_672_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_673_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_673_has_value_4711(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_673_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_673_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_673_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_674_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_674_has_value_4718(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_674_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_674_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_674_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_675_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_675_has_value_4725(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_675_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_675_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_675_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_676_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_676_has_value_4732(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_676_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_676_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_676_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_677_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_677_has_value_4739(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_677_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_677_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_677_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_678_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_678_has_value_4746(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_678_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_678_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_678_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_679_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_679_has_value_4753(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_679_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_679_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_679_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_680_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_680_has_value_4760(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_680_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_680_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_680_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_681_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_681_has_value_4767(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_681_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_681_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_681_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_682_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_682_has_value_4774(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_682_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_682_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_682_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_683_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_683_has_value_4781(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_683_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_683_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_683_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_684_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_684_has_value_4788(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_684_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_684_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_684_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_685_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_685_has_value_4795(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_685_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_685_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_685_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_686_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_686_has_value_4802(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_686_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_686_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_686_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_687_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_687_has_value_4809(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_687_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_687_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_687_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_688_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_688_has_value_4816(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_688_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_688_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_688_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_689_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_689_has_value_4823(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_689_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_689_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_689_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_690_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_690_has_value_4830(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_690_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_690_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_690_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_691_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_691_has_value_4837(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_691_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_691_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_691_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_692_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_692_has_value_4844(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_692_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_692_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_692_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_693_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_693_has_value_4851(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_693_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_693_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_693_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_694_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_694_has_value_4858(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_694_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_694_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_694_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_695_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_695_has_value_4865(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_695_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_695_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_695_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_696_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_696_has_value_4872(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_696_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_696_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_696_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_697_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_697_has_value_4879(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_697_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_697_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_697_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_698_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_698_has_value_4886(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_698_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_698_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_698_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_699_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_699_has_value_4893(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_699_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_699_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_699_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_700_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_700_has_value_4900(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_700_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_700_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_700_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_701_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_701_has_value_4907(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_701_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_701_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_701_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_702_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_702_has_value_4914(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_702_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_702_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_702_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_703_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_703_has_value_4921(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_703_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_703_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_703_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_704_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_704_has_value_4928(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_704_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_704_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_704_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_705_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_705_has_value_4935(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_705_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_705_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_705_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_706_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_706_has_value_4942(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_706_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_706_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_706_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_707_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_707_has_value_4949(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_707_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_707_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_707_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_708_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_708_has_value_4956(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_708_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_708_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_708_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_709_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_709_has_value_4963(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_709_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_709_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_709_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_710_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_710_has_value_4970(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_710_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_710_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_710_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_711_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_711_has_value_4977(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_711_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_711_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_711_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_712_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_712_has_value_4984(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_712_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_712_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_712_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_713_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_713_has_value_4991(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_713_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_713_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_713_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_714_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_714_has_value_4998(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_714_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_714_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_714_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_715_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_715_has_value_5005(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_715_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_715_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_715_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_716_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_716_has_value_5012(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_716_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_716_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_716_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_717_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_717_has_value_5019(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_717_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_717_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_717_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_718_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_718_has_value_5026(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_718_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_718_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_718_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_719_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_719_has_value_5033(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_719_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_719_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_719_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_720_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_720_has_value_5040(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_720_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_720_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_720_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_721_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_721_has_value_5047(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_721_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_721_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_721_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_722_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_722_has_value_5054(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_722_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_722_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_722_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_723_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_723_has_value_5061(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_723_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_723_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_723_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_724_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_724_has_value_5068(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_724_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_724_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_724_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_725_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_725_has_value_5075(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_725_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_725_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_725_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_726_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_726_has_value_5082(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_726_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_726_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_726_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_727_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_727_has_value_5089(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_727_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_727_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_727_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_728_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_728_has_value_5096(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_728_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_728_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_728_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_729_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_729_has_value_5103(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_729_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_729_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_729_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_730_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_730_has_value_5110(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_730_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_730_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_730_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_731_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_731_has_value_5117(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_731_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_731_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_731_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_732_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_732_has_value_5124(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_732_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_732_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_732_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_733_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_733_has_value_5131(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_733_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_733_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_733_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_734_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_734_has_value_5138(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_734_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_734_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_734_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_735_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_735_has_value_5145(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_735_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_735_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_735_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_736_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_736_has_value_5152(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_736_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_736_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_736_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_737_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_737_has_value_5159(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_737_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_737_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_737_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_738_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_738_has_value_5166(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_738_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_738_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_738_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_739_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_739_has_value_5173(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_739_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_739_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_739_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_740_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_740_has_value_5180(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_740_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_740_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_740_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_741_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_741_has_value_5187(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_741_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_741_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_741_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_742_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_742_has_value_5194(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_742_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_742_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_742_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_743_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_743_has_value_5201(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_743_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_743_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_743_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_744_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_744_has_value_5208(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_744_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_744_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_744_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_745_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_745_has_value_5215(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_745_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_745_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_745_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_746_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_746_has_value_5222(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_746_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_746_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_746_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_747_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_747_has_value_5229(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_747_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_747_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_747_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_748_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_748_has_value_5236(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_748_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_748_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_748_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_749_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_749_has_value_5243(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_749_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_749_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_749_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_750_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_750_has_value_5250(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_750_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_750_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_750_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_751_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_751_has_value_5257(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_751_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_751_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_751_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_752_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_752_has_value_5264(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_752_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_752_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_752_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_753_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_753_has_value_5271(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_753_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_753_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_753_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_754_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_754_has_value_5278(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_754_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_754_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_754_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_755_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_755_has_value_5285(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_755_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_755_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_755_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_756_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_756_has_value_5292(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_756_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_756_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_756_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_757_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_757_has_value_5299(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_757_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_757_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_757_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_758_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_758_has_value_5306(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_758_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_758_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_758_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_759_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_759_has_value_5313(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_759_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_759_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_759_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_760_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_760_has_value_5320(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_760_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_760_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_760_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_761_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_761_has_value_5327(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_761_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_761_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_761_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_762_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_762_has_value_5334(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_762_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_762_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_762_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_763_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_763_has_value_5341(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_763_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_763_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_763_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_764_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_764_has_value_5348(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_764_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_764_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_764_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_765_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_765_has_value_5355(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_765_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_765_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_765_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_766_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_766_has_value_5362(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_766_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_766_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_766_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_767_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_767_has_value_5369(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_767_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_767_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_767_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_768_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_768_has_value_5376(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_768_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_768_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_768_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_769_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_769_has_value_5383(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_769_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_769_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_769_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_770_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_770_has_value_5390(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_770_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_770_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_770_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_771_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_771_has_value_5397(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_771_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_771_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_771_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_772_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_772_has_value_5404(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_772_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_772_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_772_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_773_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_773_has_value_5411(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_773_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_773_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_773_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_774_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_774_has_value_5418(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_774_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_774_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_774_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_775_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_775_has_value_5425(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_775_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_775_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_775_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_776_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_776_has_value_5432(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_776_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_776_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_776_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_777_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_777_has_value_5439(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_777_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_777_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_777_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_778_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_778_has_value_5446(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_778_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_778_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_778_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_779_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_779_has_value_5453(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_779_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_779_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_779_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_780_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_780_has_value_5460(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_780_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_780_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_780_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_781_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_781_has_value_5467(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_781_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_781_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_781_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_782_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_782_has_value_5474(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_782_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_782_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_782_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_783_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_783_has_value_5481(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_783_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_783_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_783_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_784_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_784_has_value_5488(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_784_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_784_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_784_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_785_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_785_has_value_5495(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_785_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_785_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_785_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_786_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_786_has_value_5502(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_786_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_786_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_786_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_787_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_787_has_value_5509(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_787_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_787_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_787_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_788_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_788_has_value_5516(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_788_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_788_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_788_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_789_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_789_has_value_5523(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_789_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_789_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_789_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_790_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_790_has_value_5530(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_790_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_790_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_790_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_791_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_791_has_value_5537(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_791_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_791_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_791_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_792_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_792_has_value_5544(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_792_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_792_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_792_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_793_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_793_has_value_5551(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_793_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_793_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_793_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_794_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_794_has_value_5558(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_794_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_794_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_794_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_795_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_795_has_value_5565(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_795_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_795_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_795_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_796_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_796_has_value_5572(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_796_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_796_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_796_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_797_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_797_has_value_5579(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_797_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_797_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_797_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_798_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_798_has_value_5586(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_798_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_798_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_798_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_799_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_799_has_value_5593(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_799_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_799_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_799_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_800_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_800_has_value_5600(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_800_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_800_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_800_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_801_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_801_has_value_5607(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_801_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_801_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_801_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_802_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_802_has_value_5614(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_802_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_802_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_802_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_803_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_803_has_value_5621(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_803_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_803_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_803_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_804_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_804_has_value_5628(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_804_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_804_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_804_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_805_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_805_has_value_5635(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_805_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_805_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_805_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_806_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_806_has_value_5642(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_806_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_806_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_806_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_807_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_807_has_value_5649(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_807_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_807_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_807_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_808_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_808_has_value_5656(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_808_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_808_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_808_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_809_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_809_has_value_5663(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_809_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_809_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_809_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_810_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_810_has_value_5670(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_810_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_810_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_810_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_811_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_811_has_value_5677(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_811_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_811_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_811_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_812_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_812_has_value_5684(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_812_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_812_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_812_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_813_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_813_has_value_5691(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_813_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_813_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_813_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_814_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_814_has_value_5698(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_814_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_814_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_814_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_815_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_815_has_value_5705(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_815_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_815_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_815_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_816_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_816_has_value_5712(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_816_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_816_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_816_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_817_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_817_has_value_5719(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_817_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_817_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_817_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_818_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_818_has_value_5726(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_818_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_818_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_818_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_819_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_819_has_value_5733(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_819_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_819_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_819_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_820_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_820_has_value_5740(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_820_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_820_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_820_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_821_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_821_has_value_5747(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_821_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_821_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_821_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_822_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_822_has_value_5754(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_822_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_822_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_822_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_823_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_823_has_value_5761(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_823_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_823_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_823_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_824_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_824_has_value_5768(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_824_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_824_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_824_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_825_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_825_has_value_5775(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_825_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_825_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_825_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_826_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_826_has_value_5782(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_826_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_826_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_826_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_827_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_827_has_value_5789(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_827_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_827_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_827_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_828_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_828_has_value_5796(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_828_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_828_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_828_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_829_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_829_has_value_5803(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_829_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_829_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_829_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_830_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_830_has_value_5810(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_830_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_830_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_830_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_831_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_831_has_value_5817(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_831_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_831_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_831_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_832_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_832_has_value_5824(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_832_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_832_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_832_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_833_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_833_has_value_5831(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_833_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_833_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_833_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_834_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_834_has_value_5838(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_834_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_834_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_834_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_835_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_835_has_value_5845(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_835_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_835_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_835_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_836_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_836_has_value_5852(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_836_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_836_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_836_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_837_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_837_has_value_5859(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_837_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_837_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_837_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_838_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_838_has_value_5866(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_838_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_838_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_838_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_839_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_839_has_value_5873(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_839_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_839_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_839_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_840_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_840_has_value_5880(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_840_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_840_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_840_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_841_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_841_has_value_5887(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_841_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_841_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_841_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_842_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_842_has_value_5894(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_842_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_842_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_842_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_843_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_843_has_value_5901(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_843_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_843_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_843_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_844_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_844_has_value_5908(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_844_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_844_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_844_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_845_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_845_has_value_5915(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_845_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_845_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_845_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_846_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_846_has_value_5922(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_846_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_846_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_846_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_847_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_847_has_value_5929(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_847_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_847_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_847_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_848_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_848_has_value_5936(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_848_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_848_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_848_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_849_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_849_has_value_5943(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_849_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_849_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_849_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_850_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_850_has_value_5950(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_850_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_850_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_850_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_851_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_851_has_value_5957(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_851_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_851_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_851_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_852_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_852_has_value_5964(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_852_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_852_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_852_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_853_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_853_has_value_5971(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_853_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_853_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_853_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_854_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_854_has_value_5978(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_854_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_854_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_854_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_855_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_855_has_value_5985(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_855_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_855_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_855_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_856_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_856_has_value_5992(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_856_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_856_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_856_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_857_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_857_has_value_5999(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_857_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_857_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_857_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_858_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_858_has_value_6006(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_858_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_858_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_858_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_859_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_859_has_value_6013(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_859_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_859_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_859_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_860_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_860_has_value_6020(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_860_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_860_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_860_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_861_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_861_has_value_6027(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_861_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_861_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_861_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_862_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_862_has_value_6034(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_862_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_862_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_862_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_863_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_863_has_value_6041(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_863_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_863_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_863_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_864_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_864_has_value_6048(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_864_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_864_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_864_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_865_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_865_has_value_6055(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_865_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_865_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_865_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_866_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_866_has_value_6062(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_866_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_866_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_866_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_867_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_867_has_value_6069(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_867_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_867_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_867_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_868_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_868_has_value_6076(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_868_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_868_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_868_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_869_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_869_has_value_6083(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_869_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_869_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_869_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_870_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_870_has_value_6090(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_870_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_870_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_870_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_871_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_871_has_value_6097(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_871_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_871_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_871_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_872_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_872_has_value_6104(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_872_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_872_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_872_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_873_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_873_has_value_6111(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_873_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_873_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_873_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_874_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_874_has_value_6118(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_874_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_874_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_874_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_875_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_875_has_value_6125(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_875_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_875_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_875_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_876_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_876_has_value_6132(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_876_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_876_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_876_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_877_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_877_has_value_6139(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_877_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_877_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_877_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_878_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_878_has_value_6146(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_878_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_878_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_878_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_879_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_879_has_value_6153(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_879_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_879_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_879_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_880_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_880_has_value_6160(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_880_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_880_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_880_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_881_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_881_has_value_6167(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_881_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_881_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_881_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_882_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_882_has_value_6174(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_882_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_882_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_882_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_883_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_883_has_value_6181(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_883_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_883_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_883_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_884_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_884_has_value_6188(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_884_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_884_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_884_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_885_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_885_has_value_6195(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_885_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_885_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_885_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_886_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_886_has_value_6202(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_886_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_886_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_886_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_887_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_887_has_value_6209(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_887_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_887_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_887_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_888_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_888_has_value_6216(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_888_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_888_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_888_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_889_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_889_has_value_6223(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_889_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_889_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_889_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_890_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_890_has_value_6230(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_890_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_890_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_890_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_891_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_891_has_value_6237(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_891_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_891_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_891_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_892_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_892_has_value_6244(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_892_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_892_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_892_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_893_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_893_has_value_6251(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_893_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_893_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_893_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_894_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_894_has_value_6258(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_894_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_894_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_894_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_895_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_895_has_value_6265(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_895_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_895_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_895_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_896_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_896_has_value_6272(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_896_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_896_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_896_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_897_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_897_has_value_6279(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_897_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_897_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_897_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_898_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_898_has_value_6286(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_898_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_898_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_898_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_899_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_899_has_value_6293(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_899_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_899_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_899_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_900_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_900_has_value_6300(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_900_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_900_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_900_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_901_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_901_has_value_6307(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_901_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_901_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_901_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_902_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_902_has_value_6314(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_902_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_902_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_902_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_903_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_903_has_value_6321(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_903_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_903_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_903_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_904_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_904_has_value_6328(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_904_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_904_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_904_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_905_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_905_has_value_6335(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_905_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_905_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_905_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_906_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_906_has_value_6342(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_906_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_906_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_906_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_907_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_907_has_value_6349(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_907_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_907_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_907_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_908_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_908_has_value_6356(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_908_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_908_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_908_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_909_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_909_has_value_6363(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_909_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_909_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_909_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_910_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_910_has_value_6370(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_910_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_910_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_910_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_911_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_911_has_value_6377(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_911_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_911_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_911_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_912_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_912_has_value_6384(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_912_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_912_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_912_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_913_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_913_has_value_6391(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_913_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_913_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_913_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_914_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_914_has_value_6398(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_914_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_914_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_914_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_915_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_915_has_value_6405(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_915_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_915_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_915_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_916_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_916_has_value_6412(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_916_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_916_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_916_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_917_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_917_has_value_6419(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_917_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_917_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_917_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_918_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_918_has_value_6426(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_918_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_918_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_918_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_919_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_919_has_value_6433(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_919_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_919_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_919_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_920_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_920_has_value_6440(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_920_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_920_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_920_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_921_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_921_has_value_6447(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_921_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_921_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_921_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_922_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_922_has_value_6454(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_922_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_922_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_922_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_923_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_923_has_value_6461(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_923_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_923_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_923_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_924_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_924_has_value_6468(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_924_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_924_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_924_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_925_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_925_has_value_6475(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_925_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_925_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_925_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_926_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_926_has_value_6482(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_926_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_926_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_926_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_927_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_927_has_value_6489(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_927_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_927_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_927_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_928_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_928_has_value_6496(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_928_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_928_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_928_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_929_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_929_has_value_6503(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_929_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_929_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_929_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_930_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_930_has_value_6510(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_930_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_930_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_930_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_931_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_931_has_value_6517(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_931_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_931_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_931_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_932_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_932_has_value_6524(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_932_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_932_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_932_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_933_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_933_has_value_6531(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_933_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_933_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_933_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_934_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_934_has_value_6538(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_934_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_934_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_934_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_935_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_935_has_value_6545(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_935_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_935_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_935_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_936_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_936_has_value_6552(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_936_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_936_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_936_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_937_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_937_has_value_6559(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_937_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_937_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_937_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_938_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_938_has_value_6566(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_938_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_938_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_938_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_939_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_939_has_value_6573(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_939_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_939_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_939_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_940_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_940_has_value_6580(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_940_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_940_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_940_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_941_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_941_has_value_6587(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_941_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_941_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_941_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_942_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_942_has_value_6594(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_942_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_942_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_942_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_943_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_943_has_value_6601(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_943_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_943_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_943_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_944_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_944_has_value_6608(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_944_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_944_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_944_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_945_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_945_has_value_6615(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_945_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_945_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_945_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_946_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_946_has_value_6622(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_946_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_946_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_946_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_947_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_947_has_value_6629(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_947_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_947_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_947_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_948_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_948_has_value_6636(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_948_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_948_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_948_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_949_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_949_has_value_6643(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_949_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_949_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_949_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_950_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_950_has_value_6650(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_950_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_950_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_950_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_951_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_951_has_value_6657(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_951_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_951_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_951_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_952_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_952_has_value_6664(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_952_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_952_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_952_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_953_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_953_has_value_6671(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_953_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_953_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_953_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_954_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_954_has_value_6678(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_954_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_954_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_954_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_955_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_955_has_value_6685(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_955_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_955_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_955_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_956_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_956_has_value_6692(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_956_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_956_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_956_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_957_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_957_has_value_6699(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_957_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_957_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_957_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_958_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_958_has_value_6706(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_958_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_958_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_958_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_959_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_959_has_value_6713(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_959_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_959_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_959_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_960_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_960_has_value_6720(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_960_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_960_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_960_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_961_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_961_has_value_6727(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_961_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_961_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_961_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_962_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_962_has_value_6734(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_962_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_962_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_962_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_963_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_963_has_value_6741(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_963_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_963_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_963_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_964_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_964_has_value_6748(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_964_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_964_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_964_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_965_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_965_has_value_6755(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_965_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_965_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_965_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_966_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_966_has_value_6762(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_966_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_966_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_966_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_967_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_967_has_value_6769(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_967_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_967_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_967_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_968_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_968_has_value_6776(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_968_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_968_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_968_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_969_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_969_has_value_6783(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_969_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_969_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_969_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_970_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_970_has_value_6790(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_970_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_970_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_970_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_971_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_971_has_value_6797(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_971_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_971_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_971_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_972_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_972_has_value_6804(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_972_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_972_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_972_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_973_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_973_has_value_6811(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_973_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_973_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_973_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_974_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_974_has_value_6818(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_974_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_974_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_974_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_975_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_975_has_value_6825(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_975_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_975_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_975_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_976_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_976_has_value_6832(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_976_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_976_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_976_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_977_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_977_has_value_6839(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_977_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_977_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_977_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_978_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_978_has_value_6846(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_978_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_978_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_978_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_979_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_979_has_value_6853(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_979_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_979_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_979_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_980_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_980_has_value_6860(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_980_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_980_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_980_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_981_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_981_has_value_6867(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_981_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_981_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_981_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_982_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_982_has_value_6874(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_982_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_982_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_982_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_983_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_983_has_value_6881(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_983_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_983_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_983_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_984_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_984_has_value_6888(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_984_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_984_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_984_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_985_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_985_has_value_6895(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_985_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_985_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_985_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_986_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_986_has_value_6902(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_986_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_986_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_986_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_987_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_987_has_value_6909(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_987_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_987_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_987_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_988_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_988_has_value_6916(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_988_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_988_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_988_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_989_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_989_has_value_6923(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_989_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_989_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_989_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_990_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_990_has_value_6930(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_990_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_990_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_990_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_991_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_991_has_value_6937(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_991_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_991_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_991_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_992_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_992_has_value_6944(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_992_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_992_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_992_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_993_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_993_has_value_6951(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_993_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_993_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_993_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_994_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_994_has_value_6958(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_994_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_994_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_994_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_995_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_995_has_value_6965(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_995_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_995_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_995_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_996_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_996_has_value_6972(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_996_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_996_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_996_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_997_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_997_has_value_6979(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_997_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_997_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_997_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_998_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_998_has_value_6986(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_998_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_998_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_998_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_999_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_999_has_value_6993(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_999_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_999_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_999_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+
+#endif /* SYNTHETIC_BDD_H */
@@ -0,0 +1,30008 @@
+/* Step definitions for BDD tests
+ * Generated skeleton by bddgen 1.0.0
+ * Implement each step function to make tests pass.
+ */
+
+#include "synthetic_bdd.h"
+#include <stdio.h>
+
+/* Given record 0 exists */
+SYNTHETIC_result_t step_record_0_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 0 has value 0 */
+SYNTHETIC_result_t step_record_0_has_value_0(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 0 is updated */
+SYNTHETIC_result_t step_record_0_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 0 should be saved */
+SYNTHETIC_result_t step_record_0_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 0 should not be duplicated */
+SYNTHETIC_result_t step_record_0_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 1 exists */
+SYNTHETIC_result_t step_record_1_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 1 has value 7 */
+SYNTHETIC_result_t step_record_1_has_value_7(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 1 is updated */
+SYNTHETIC_result_t step_record_1_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 1 should be saved */
+SYNTHETIC_result_t step_record_1_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 1 should not be duplicated */
+SYNTHETIC_result_t step_record_1_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 2 exists */
+SYNTHETIC_result_t step_record_2_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 2 has value 14 */
+SYNTHETIC_result_t step_record_2_has_value_14(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 2 is updated */
+SYNTHETIC_result_t step_record_2_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 2 should be saved */
+SYNTHETIC_result_t step_record_2_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 2 should not be duplicated */
+SYNTHETIC_result_t step_record_2_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 3 exists */
+SYNTHETIC_result_t step_record_3_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 3 has value 21 */
+SYNTHETIC_result_t step_record_3_has_value_21(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 3 is updated */
+SYNTHETIC_result_t step_record_3_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 3 should be saved */
+SYNTHETIC_result_t step_record_3_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 3 should not be duplicated */
+SYNTHETIC_result_t step_record_3_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 4 exists */
+SYNTHETIC_result_t step_record_4_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 4 has value 28 */
+SYNTHETIC_result_t step_record_4_has_value_28(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 4 is updated */
+SYNTHETIC_result_t step_record_4_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 4 should be saved */
+SYNTHETIC_result_t step_record_4_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 4 should not be duplicated */
+SYNTHETIC_result_t step_record_4_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 5 exists */
+SYNTHETIC_result_t step_record_5_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 5 has value 35 */
+SYNTHETIC_result_t step_record_5_has_value_35(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 5 is updated */
+SYNTHETIC_result_t step_record_5_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 5 should be saved */
+SYNTHETIC_result_t step_record_5_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 5 should not be duplicated */
+SYNTHETIC_result_t step_record_5_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 6 exists */
+SYNTHETIC_result_t step_record_6_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 6 has value 42 */
+SYNTHETIC_result_t step_record_6_has_value_42(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 6 is updated */
+SYNTHETIC_result_t step_record_6_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 6 should be saved */
+SYNTHETIC_result_t step_record_6_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 6 should not be duplicated */
+SYNTHETIC_result_t step_record_6_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 7 exists */
+SYNTHETIC_result_t step_record_7_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 7 has value 49 */
+SYNTHETIC_result_t step_record_7_has_value_49(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 7 is updated */
+SYNTHETIC_result_t step_record_7_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 7 should be saved */
+SYNTHETIC_result_t step_record_7_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 7 should not be duplicated */
+SYNTHETIC_result_t step_record_7_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 8 exists */
+SYNTHETIC_result_t step_record_8_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 8 has value 56 */
+SYNTHETIC_result_t step_record_8_has_value_56(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 8 is updated */
+SYNTHETIC_result_t step_record_8_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 8 should be saved */
+SYNTHETIC_result_t step_record_8_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 8 should not be duplicated */
+SYNTHETIC_result_t step_record_8_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 9 exists */
+SYNTHETIC_result_t step_record_9_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 9 has value 63 */
+SYNTHETIC_result_t step_record_9_has_value_63(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 9 is updated */
+SYNTHETIC_result_t step_record_9_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 9 should be saved */
+SYNTHETIC_result_t step_record_9_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 9 should not be duplicated */
+SYNTHETIC_result_t step_record_9_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 10 exists */
+SYNTHETIC_result_t step_record_10_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 10 has value 70 */
+SYNTHETIC_result_t step_record_10_has_value_70(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 10 is updated */
+SYNTHETIC_result_t step_record_10_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 10 should be saved */
+SYNTHETIC_result_t step_record_10_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 10 should not be duplicated */
+SYNTHETIC_result_t step_record_10_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 11 exists */
+SYNTHETIC_result_t step_record_11_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 11 has value 77 */
+SYNTHETIC_result_t step_record_11_has_value_77(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 11 is updated */
+SYNTHETIC_result_t step_record_11_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 11 should be saved */
+SYNTHETIC_result_t step_record_11_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 11 should not be duplicated */
+SYNTHETIC_result_t step_record_11_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 12 exists */
+SYNTHETIC_result_t step_record_12_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 12 has value 84 */
+SYNTHETIC_result_t step_record_12_has_value_84(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 12 is updated */
+SYNTHETIC_result_t step_record_12_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 12 should be saved */
+SYNTHETIC_result_t step_record_12_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 12 should not be duplicated */
+SYNTHETIC_result_t step_record_12_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 13 exists */
+SYNTHETIC_result_t step_record_13_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 13 has value 91 */
+SYNTHETIC_result_t step_record_13_has_value_91(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 13 is updated */
+SYNTHETIC_result_t step_record_13_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 13 should be saved */
+SYNTHETIC_result_t step_record_13_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 13 should not be duplicated */
+SYNTHETIC_result_t step_record_13_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 14 exists */
+SYNTHETIC_result_t step_record_14_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 14 has value 98 */
+SYNTHETIC_result_t step_record_14_has_value_98(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 14 is updated */
+SYNTHETIC_result_t step_record_14_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 14 should be saved */
+SYNTHETIC_result_t step_record_14_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 14 should not be duplicated */
+SYNTHETIC_result_t step_record_14_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 15 exists */
+SYNTHETIC_result_t step_record_15_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 15 has value 105 */
+SYNTHETIC_result_t step_record_15_has_value_105(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 15 is updated */
+SYNTHETIC_result_t step_record_15_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 15 should be saved */
+SYNTHETIC_result_t step_record_15_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 15 should not be duplicated */
+SYNTHETIC_result_t step_record_15_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 16 exists */
+SYNTHETIC_result_t step_record_16_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 16 has value 112 */
+SYNTHETIC_result_t step_record_16_has_value_112(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 16 is updated */
+SYNTHETIC_result_t step_record_16_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 16 should be saved */
+SYNTHETIC_result_t step_record_16_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 16 should not be duplicated */
+SYNTHETIC_result_t step_record_16_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 17 exists */
+SYNTHETIC_result_t step_record_17_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 17 has value 119 */
+SYNTHETIC_result_t step_record_17_has_value_119(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 17 is updated */
+SYNTHETIC_result_t step_record_17_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 17 should be saved */
+SYNTHETIC_result_t step_record_17_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 17 should not be duplicated */
+SYNTHETIC_result_t step_record_17_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 18 exists */
+SYNTHETIC_result_t step_record_18_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 18 has value 126 */
+SYNTHETIC_result_t step_record_18_has_value_126(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 18 is updated */
+SYNTHETIC_result_t step_record_18_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 18 should be saved */
+SYNTHETIC_result_t step_record_18_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 18 should not be duplicated */
+SYNTHETIC_result_t step_record_18_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 19 exists */
+SYNTHETIC_result_t step_record_19_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 19 has value 133 */
+SYNTHETIC_result_t step_record_19_has_value_133(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 19 is updated */
+SYNTHETIC_result_t step_record_19_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 19 should be saved */
+SYNTHETIC_result_t step_record_19_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 19 should not be duplicated */
+SYNTHETIC_result_t step_record_19_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 20 exists */
+SYNTHETIC_result_t step_record_20_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 20 has value 140 */
+SYNTHETIC_result_t step_record_20_has_value_140(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 20 is updated */
+SYNTHETIC_result_t step_record_20_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 20 should be saved */
+SYNTHETIC_result_t step_record_20_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 20 should not be duplicated */
+SYNTHETIC_result_t step_record_20_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 21 exists */
+SYNTHETIC_result_t step_record_21_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 21 has value 147 */
+SYNTHETIC_result_t step_record_21_has_value_147(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 21 is updated */
+SYNTHETIC_result_t step_record_21_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 21 should be saved */
+SYNTHETIC_result_t step_record_21_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 21 should not be duplicated */
+SYNTHETIC_result_t step_record_21_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 22 exists */
+SYNTHETIC_result_t step_record_22_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 22 has value 154 */
+SYNTHETIC_result_t step_record_22_has_value_154(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 22 is updated */
+SYNTHETIC_result_t step_record_22_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 22 should be saved */
+SYNTHETIC_result_t step_record_22_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 22 should not be duplicated */
+SYNTHETIC_result_t step_record_22_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 23 exists */
+SYNTHETIC_result_t step_record_23_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 23 has value 161 */
+SYNTHETIC_result_t step_record_23_has_value_161(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 23 is updated */
+SYNTHETIC_result_t step_record_23_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 23 should be saved */
+SYNTHETIC_result_t step_record_23_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 23 should not be duplicated */
+SYNTHETIC_result_t step_record_23_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 24 exists */
+SYNTHETIC_result_t step_record_24_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 24 has value 168 */
+SYNTHETIC_result_t step_record_24_has_value_168(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 24 is updated */
+SYNTHETIC_result_t step_record_24_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 24 should be saved */
+SYNTHETIC_result_t step_record_24_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 24 should not be duplicated */
+SYNTHETIC_result_t step_record_24_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 25 exists */
+SYNTHETIC_result_t step_record_25_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 25 has value 175 */
+SYNTHETIC_result_t step_record_25_has_value_175(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 25 is updated */
+SYNTHETIC_result_t step_record_25_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 25 should be saved */
+SYNTHETIC_result_t step_record_25_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 25 should not be duplicated */
+SYNTHETIC_result_t step_record_25_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 26 exists */
+SYNTHETIC_result_t step_record_26_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 26 has value 182 */
+SYNTHETIC_result_t step_record_26_has_value_182(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 26 is updated */
+SYNTHETIC_result_t step_record_26_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 26 should be saved */
+SYNTHETIC_result_t step_record_26_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 26 should not be duplicated */
+SYNTHETIC_result_t step_record_26_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 27 exists */
+SYNTHETIC_result_t step_record_27_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 27 has value 189 */
+SYNTHETIC_result_t step_record_27_has_value_189(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 27 is updated */
+SYNTHETIC_result_t step_record_27_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 27 should be saved */
+SYNTHETIC_result_t step_record_27_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 27 should not be duplicated */
+SYNTHETIC_result_t step_record_27_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 28 exists */
+SYNTHETIC_result_t step_record_28_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 28 has value 196 */
+SYNTHETIC_result_t step_record_28_has_value_196(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 28 is updated */
+SYNTHETIC_result_t step_record_28_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 28 should be saved */
+SYNTHETIC_result_t step_record_28_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 28 should not be duplicated */
+SYNTHETIC_result_t step_record_28_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 29 exists */
+SYNTHETIC_result_t step_record_29_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 29 has value 203 */
+SYNTHETIC_result_t step_record_29_has_value_203(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 29 is updated */
+SYNTHETIC_result_t step_record_29_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 29 should be saved */
+SYNTHETIC_result_t step_record_29_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 29 should not be duplicated */
+SYNTHETIC_result_t step_record_29_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 30 exists */
+SYNTHETIC_result_t step_record_30_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 30 has value 210 */
+SYNTHETIC_result_t step_record_30_has_value_210(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 30 is updated */
+SYNTHETIC_result_t step_record_30_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 30 should be saved */
+SYNTHETIC_result_t step_record_30_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 30 should not be duplicated */
+SYNTHETIC_result_t step_record_30_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 31 exists */
+SYNTHETIC_result_t step_record_31_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 31 has value 217 */
+SYNTHETIC_result_t step_record_31_has_value_217(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 31 is updated */
+SYNTHETIC_result_t step_record_31_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 31 should be saved */
+SYNTHETIC_result_t step_record_31_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 31 should not be duplicated */
+SYNTHETIC_result_t step_record_31_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 32 exists */
+SYNTHETIC_result_t step_record_32_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 32 has value 224 */
+SYNTHETIC_result_t step_record_32_has_value_224(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 32 is updated */
+SYNTHETIC_result_t step_record_32_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 32 should be saved */
+SYNTHETIC_result_t step_record_32_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 32 should not be duplicated */
+SYNTHETIC_result_t step_record_32_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 33 exists */
+SYNTHETIC_result_t step_record_33_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 33 has value 231 */
+SYNTHETIC_result_t step_record_33_has_value_231(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 33 is updated */
+SYNTHETIC_result_t step_record_33_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 33 should be saved */
+SYNTHETIC_result_t step_record_33_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 33 should not be duplicated */
+SYNTHETIC_result_t step_record_33_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 34 exists */
+SYNTHETIC_result_t step_record_34_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 34 has value 238 */
+SYNTHETIC_result_t step_record_34_has_value_238(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 34 is updated */
+SYNTHETIC_result_t step_record_34_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 34 should be saved */
+SYNTHETIC_result_t step_record_34_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 34 should not be duplicated */
+SYNTHETIC_result_t step_record_34_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 35 exists */
+SYNTHETIC_result_t step_record_35_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 35 has value 245 */
+SYNTHETIC_result_t step_record_35_has_value_245(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 35 is updated */
+SYNTHETIC_result_t step_record_35_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 35 should be saved */
+SYNTHETIC_result_t step_record_35_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 35 should not be duplicated */
+SYNTHETIC_result_t step_record_35_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 36 exists */
+SYNTHETIC_result_t step_record_36_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 36 has value 252 */
+SYNTHETIC_result_t step_record_36_has_value_252(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 36 is updated */
+SYNTHETIC_result_t step_record_36_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 36 should be saved */
+SYNTHETIC_result_t step_record_36_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 36 should not be duplicated */
+SYNTHETIC_result_t step_record_36_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 37 exists */
+SYNTHETIC_result_t step_record_37_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 37 has value 259 */
+SYNTHETIC_result_t step_record_37_has_value_259(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 37 is updated */
+SYNTHETIC_result_t step_record_37_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 37 should be saved */
+SYNTHETIC_result_t step_record_37_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 37 should not be duplicated */
+SYNTHETIC_result_t step_record_37_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 38 exists */
+SYNTHETIC_result_t step_record_38_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 38 has value 266 */
+SYNTHETIC_result_t step_record_38_has_value_266(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 38 is updated */
+SYNTHETIC_result_t step_record_38_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 38 should be saved */
+SYNTHETIC_result_t step_record_38_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 38 should not be duplicated */
+SYNTHETIC_result_t step_record_38_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 39 exists */
+SYNTHETIC_result_t step_record_39_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 39 has value 273 */
+SYNTHETIC_result_t step_record_39_has_value_273(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 39 is updated */
+SYNTHETIC_result_t step_record_39_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 39 should be saved */
+SYNTHETIC_result_t step_record_39_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 39 should not be duplicated */
+SYNTHETIC_result_t step_record_39_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 40 exists */
+SYNTHETIC_result_t step_record_40_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 40 has value 280 */
+SYNTHETIC_result_t step_record_40_has_value_280(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 40 is updated */
+SYNTHETIC_result_t step_record_40_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 40 should be saved */
+SYNTHETIC_result_t step_record_40_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 40 should not be duplicated */
+SYNTHETIC_result_t step_record_40_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 41 exists */
+SYNTHETIC_result_t step_record_41_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 41 has value 287 */
+SYNTHETIC_result_t step_record_41_has_value_287(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 41 is updated */
+SYNTHETIC_result_t step_record_41_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 41 should be saved */
+SYNTHETIC_result_t step_record_41_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 41 should not be duplicated */
+SYNTHETIC_result_t step_record_41_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 42 exists */
+SYNTHETIC_result_t step_record_42_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 42 has value 294 */
+SYNTHETIC_result_t step_record_42_has_value_294(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 42 is updated */
+SYNTHETIC_result_t step_record_42_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 42 should be saved */
+SYNTHETIC_result_t step_record_42_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 42 should not be duplicated */
+SYNTHETIC_result_t step_record_42_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 43 exists */
+SYNTHETIC_result_t step_record_43_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 43 has value 301 */
+SYNTHETIC_result_t step_record_43_has_value_301(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 43 is updated */
+SYNTHETIC_result_t step_record_43_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 43 should be saved */
+SYNTHETIC_result_t step_record_43_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 43 should not be duplicated */
+SYNTHETIC_result_t step_record_43_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 44 exists */
+SYNTHETIC_result_t step_record_44_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 44 has value 308 */
+SYNTHETIC_result_t step_record_44_has_value_308(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 44 is updated */
+SYNTHETIC_result_t step_record_44_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 44 should be saved */
+SYNTHETIC_result_t step_record_44_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 44 should not be duplicated */
+SYNTHETIC_result_t step_record_44_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 45 exists */
+SYNTHETIC_result_t step_record_45_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 45 has value 315 */
+SYNTHETIC_result_t step_record_45_has_value_315(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 45 is updated */
+SYNTHETIC_result_t step_record_45_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 45 should be saved */
+SYNTHETIC_result_t step_record_45_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 45 should not be duplicated */
+SYNTHETIC_result_t step_record_45_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 46 exists */
+SYNTHETIC_result_t step_record_46_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 46 has value 322 */
+SYNTHETIC_result_t step_record_46_has_value_322(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 46 is updated */
+SYNTHETIC_result_t step_record_46_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 46 should be saved */
+SYNTHETIC_result_t step_record_46_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 46 should not be duplicated */
+SYNTHETIC_result_t step_record_46_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 47 exists */
+SYNTHETIC_result_t step_record_47_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 47 has value 329 */
+SYNTHETIC_result_t step_record_47_has_value_329(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 47 is updated */
+SYNTHETIC_result_t step_record_47_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 47 should be saved */
+SYNTHETIC_result_t step_record_47_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 47 should not be duplicated */
+SYNTHETIC_result_t step_record_47_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 48 exists */
+SYNTHETIC_result_t step_record_48_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 48 has value 336 */
+SYNTHETIC_result_t step_record_48_has_value_336(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 48 is updated */
+SYNTHETIC_result_t step_record_48_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 48 should be saved */
+SYNTHETIC_result_t step_record_48_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 48 should not be duplicated */
+SYNTHETIC_result_t step_record_48_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 49 exists */
+SYNTHETIC_result_t step_record_49_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 49 has value 343 */
+SYNTHETIC_result_t step_record_49_has_value_343(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 49 is updated */
+SYNTHETIC_result_t step_record_49_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 49 should be saved */
+SYNTHETIC_result_t step_record_49_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 49 should not be duplicated */
+SYNTHETIC_result_t step_record_49_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 50 exists */
+SYNTHETIC_result_t step_record_50_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 50 has value 350 */
+SYNTHETIC_result_t step_record_50_has_value_350(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 50 is updated */
+SYNTHETIC_result_t step_record_50_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 50 should be saved */
+SYNTHETIC_result_t step_record_50_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 50 should not be duplicated */
+SYNTHETIC_result_t step_record_50_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 51 exists */
+SYNTHETIC_result_t step_record_51_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 51 has value 357 */
+SYNTHETIC_result_t step_record_51_has_value_357(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 51 is updated */
+SYNTHETIC_result_t step_record_51_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 51 should be saved */
+SYNTHETIC_result_t step_record_51_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 51 should not be duplicated */
+SYNTHETIC_result_t step_record_51_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 52 exists */
+SYNTHETIC_result_t step_record_52_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 52 has value 364 */
+SYNTHETIC_result_t step_record_52_has_value_364(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 52 is updated */
+SYNTHETIC_result_t step_record_52_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 52 should be saved */
+SYNTHETIC_result_t step_record_52_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 52 should not be duplicated */
+SYNTHETIC_result_t step_record_52_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 53 exists */
+SYNTHETIC_result_t step_record_53_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 53 has value 371 */
+SYNTHETIC_result_t step_record_53_has_value_371(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 53 is updated */
+SYNTHETIC_result_t step_record_53_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 53 should be saved */
+SYNTHETIC_result_t step_record_53_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 53 should not be duplicated */
+SYNTHETIC_result_t step_record_53_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 54 exists */
+SYNTHETIC_result_t step_record_54_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 54 has value 378 */
+SYNTHETIC_result_t step_record_54_has_value_378(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 54 is updated */
+SYNTHETIC_result_t step_record_54_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 54 should be saved */
+SYNTHETIC_result_t step_record_54_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 54 should not be duplicated */
+SYNTHETIC_result_t step_record_54_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 55 exists */
+SYNTHETIC_result_t step_record_55_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 55 has value 385 */
+SYNTHETIC_result_t step_record_55_has_value_385(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 55 is updated */
+SYNTHETIC_result_t step_record_55_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 55 should be saved */
+SYNTHETIC_result_t step_record_55_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 55 should not be duplicated */
+SYNTHETIC_result_t step_record_55_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 56 exists */
+SYNTHETIC_result_t step_record_56_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 56 has value 392 */
+SYNTHETIC_result_t step_record_56_has_value_392(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 56 is updated */
+SYNTHETIC_result_t step_record_56_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 56 should be saved */
+SYNTHETIC_result_t step_record_56_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 56 should not be duplicated */
+SYNTHETIC_result_t step_record_56_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 57 exists */
+SYNTHETIC_result_t step_record_57_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 57 has value 399 */
+SYNTHETIC_result_t step_record_57_has_value_399(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 57 is updated */
+SYNTHETIC_result_t step_record_57_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 57 should be saved */
+SYNTHETIC_result_t step_record_57_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 57 should not be duplicated */
+SYNTHETIC_result_t step_record_57_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 58 exists */
+SYNTHETIC_result_t step_record_58_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 58 has value 406 */
+SYNTHETIC_result_t step_record_58_has_value_406(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 58 is updated */
+SYNTHETIC_result_t step_record_58_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 58 should be saved */
+SYNTHETIC_result_t step_record_58_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 58 should not be duplicated */
+SYNTHETIC_result_t step_record_58_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 59 exists */
+SYNTHETIC_result_t step_record_59_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 59 has value 413 */
+SYNTHETIC_result_t step_record_59_has_value_413(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 59 is updated */
+SYNTHETIC_result_t step_record_59_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 59 should be saved */
+SYNTHETIC_result_t step_record_59_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 59 should not be duplicated */
+SYNTHETIC_result_t step_record_59_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 60 exists */
+SYNTHETIC_result_t step_record_60_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 60 has value 420 */
+SYNTHETIC_result_t step_record_60_has_value_420(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 60 is updated */
+SYNTHETIC_result_t step_record_60_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 60 should be saved */
+SYNTHETIC_result_t step_record_60_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 60 should not be duplicated */
+SYNTHETIC_result_t step_record_60_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 61 exists */
+SYNTHETIC_result_t step_record_61_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 61 has value 427 */
+SYNTHETIC_result_t step_record_61_has_value_427(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 61 is updated */
+SYNTHETIC_result_t step_record_61_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 61 should be saved */
+SYNTHETIC_result_t step_record_61_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 61 should not be duplicated */
+SYNTHETIC_result_t step_record_61_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 62 exists */
+SYNTHETIC_result_t step_record_62_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 62 has value 434 */
+SYNTHETIC_result_t step_record_62_has_value_434(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 62 is updated */
+SYNTHETIC_result_t step_record_62_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 62 should be saved */
+SYNTHETIC_result_t step_record_62_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 62 should not be duplicated */
+SYNTHETIC_result_t step_record_62_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 63 exists */
+SYNTHETIC_result_t step_record_63_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 63 has value 441 */
+SYNTHETIC_result_t step_record_63_has_value_441(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 63 is updated */
+SYNTHETIC_result_t step_record_63_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 63 should be saved */
+SYNTHETIC_result_t step_record_63_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 63 should not be duplicated */
+SYNTHETIC_result_t step_record_63_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 64 exists */
+SYNTHETIC_result_t step_record_64_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 64 has value 448 */
+SYNTHETIC_result_t step_record_64_has_value_448(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 64 is updated */
+SYNTHETIC_result_t step_record_64_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 64 should be saved */
+SYNTHETIC_result_t step_record_64_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 64 should not be duplicated */
+SYNTHETIC_result_t step_record_64_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 65 exists */
+SYNTHETIC_result_t step_record_65_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 65 has value 455 */
+SYNTHETIC_result_t step_record_65_has_value_455(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 65 is updated */
+SYNTHETIC_result_t step_record_65_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 65 should be saved */
+SYNTHETIC_result_t step_record_65_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 65 should not be duplicated */
+SYNTHETIC_result_t step_record_65_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 66 exists */
+SYNTHETIC_result_t step_record_66_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 66 has value 462 */
+SYNTHETIC_result_t step_record_66_has_value_462(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 66 is updated */
+SYNTHETIC_result_t step_record_66_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 66 should be saved */
+SYNTHETIC_result_t step_record_66_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 66 should not be duplicated */
+SYNTHETIC_result_t step_record_66_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 67 exists */
+SYNTHETIC_result_t step_record_67_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 67 has value 469 */
+SYNTHETIC_result_t step_record_67_has_value_469(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 67 is updated */
+SYNTHETIC_result_t step_record_67_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 67 should be saved */
+SYNTHETIC_result_t step_record_67_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 67 should not be duplicated */
+SYNTHETIC_result_t step_record_67_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 68 exists */
+SYNTHETIC_result_t step_record_68_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 68 has value 476 */
+SYNTHETIC_result_t step_record_68_has_value_476(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 68 is updated */
+SYNTHETIC_result_t step_record_68_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 68 should be saved */
+SYNTHETIC_result_t step_record_68_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 68 should not be duplicated */
+SYNTHETIC_result_t step_record_68_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 69 exists */
+SYNTHETIC_result_t step_record_69_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 69 has value 483 */
+SYNTHETIC_result_t step_record_69_has_value_483(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 69 is updated */
+SYNTHETIC_result_t step_record_69_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 69 should be saved */
+SYNTHETIC_result_t step_record_69_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 69 should not be duplicated */
+SYNTHETIC_result_t step_record_69_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 70 exists */
+SYNTHETIC_result_t step_record_70_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 70 has value 490 */
+SYNTHETIC_result_t step_record_70_has_value_490(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 70 is updated */
+SYNTHETIC_result_t step_record_70_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 70 should be saved */
+SYNTHETIC_result_t step_record_70_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 70 should not be duplicated */
+SYNTHETIC_result_t step_record_70_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 71 exists */
+SYNTHETIC_result_t step_record_71_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 71 has value 497 */
+SYNTHETIC_result_t step_record_71_has_value_497(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 71 is updated */
+SYNTHETIC_result_t step_record_71_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 71 should be saved */
+SYNTHETIC_result_t step_record_71_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 71 should not be duplicated */
+SYNTHETIC_result_t step_record_71_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 72 exists */
+SYNTHETIC_result_t step_record_72_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 72 has value 504 */
+SYNTHETIC_result_t step_record_72_has_value_504(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 72 is updated */
+SYNTHETIC_result_t step_record_72_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 72 should be saved */
+SYNTHETIC_result_t step_record_72_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 72 should not be duplicated */
+SYNTHETIC_result_t step_record_72_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 73 exists */
+SYNTHETIC_result_t step_record_73_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 73 has value 511 */
+SYNTHETIC_result_t step_record_73_has_value_511(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 73 is updated */
+SYNTHETIC_result_t step_record_73_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 73 should be saved */
+SYNTHETIC_result_t step_record_73_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 73 should not be duplicated */
+SYNTHETIC_result_t step_record_73_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 74 exists */
+SYNTHETIC_result_t step_record_74_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 74 has value 518 */
+SYNTHETIC_result_t step_record_74_has_value_518(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 74 is updated */
+SYNTHETIC_result_t step_record_74_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 74 should be saved */
+SYNTHETIC_result_t step_record_74_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 74 should not be duplicated */
+SYNTHETIC_result_t step_record_74_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 75 exists */
+SYNTHETIC_result_t step_record_75_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 75 has value 525 */
+SYNTHETIC_result_t step_record_75_has_value_525(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 75 is updated */
+SYNTHETIC_result_t step_record_75_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 75 should be saved */
+SYNTHETIC_result_t step_record_75_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 75 should not be duplicated */
+SYNTHETIC_result_t step_record_75_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 76 exists */
+SYNTHETIC_result_t step_record_76_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 76 has value 532 */
+SYNTHETIC_result_t step_record_76_has_value_532(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 76 is updated */
+SYNTHETIC_result_t step_record_76_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 76 should be saved */
+SYNTHETIC_result_t step_record_76_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 76 should not be duplicated */
+SYNTHETIC_result_t step_record_76_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 77 exists */
+SYNTHETIC_result_t step_record_77_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 77 has value 539 */
+SYNTHETIC_result_t step_record_77_has_value_539(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 77 is updated */
+SYNTHETIC_result_t step_record_77_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 77 should be saved */
+SYNTHETIC_result_t step_record_77_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 77 should not be duplicated */
+SYNTHETIC_result_t step_record_77_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 78 exists */
+SYNTHETIC_result_t step_record_78_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 78 has value 546 */
+SYNTHETIC_result_t step_record_78_has_value_546(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 78 is updated */
+SYNTHETIC_result_t step_record_78_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 78 should be saved */
+SYNTHETIC_result_t step_record_78_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 78 should not be duplicated */
+SYNTHETIC_result_t step_record_78_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 79 exists */
+SYNTHETIC_result_t step_record_79_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 79 has value 553 */
+SYNTHETIC_result_t step_record_79_has_value_553(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 79 is updated */
+SYNTHETIC_result_t step_record_79_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 79 should be saved */
+SYNTHETIC_result_t step_record_79_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 79 should not be duplicated */
+SYNTHETIC_result_t step_record_79_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 80 exists */
+SYNTHETIC_result_t step_record_80_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 80 has value 560 */
+SYNTHETIC_result_t step_record_80_has_value_560(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 80 is updated */
+SYNTHETIC_result_t step_record_80_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 80 should be saved */
+SYNTHETIC_result_t step_record_80_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 80 should not be duplicated */
+SYNTHETIC_result_t step_record_80_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 81 exists */
+SYNTHETIC_result_t step_record_81_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 81 has value 567 */
+SYNTHETIC_result_t step_record_81_has_value_567(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 81 is updated */
+SYNTHETIC_result_t step_record_81_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 81 should be saved */
+SYNTHETIC_result_t step_record_81_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 81 should not be duplicated */
+SYNTHETIC_result_t step_record_81_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 82 exists */
+SYNTHETIC_result_t step_record_82_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 82 has value 574 */
+SYNTHETIC_result_t step_record_82_has_value_574(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 82 is updated */
+SYNTHETIC_result_t step_record_82_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 82 should be saved */
+SYNTHETIC_result_t step_record_82_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 82 should not be duplicated */
+SYNTHETIC_result_t step_record_82_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 83 exists */
+SYNTHETIC_result_t step_record_83_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 83 has value 581 */
+SYNTHETIC_result_t step_record_83_has_value_581(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 83 is updated */
+SYNTHETIC_result_t step_record_83_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 83 should be saved */
+SYNTHETIC_result_t step_record_83_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 83 should not be duplicated */
+SYNTHETIC_result_t step_record_83_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 84 exists */
+SYNTHETIC_result_t step_record_84_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 84 has value 588 */
+SYNTHETIC_result_t step_record_84_has_value_588(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 84 is updated */
+SYNTHETIC_result_t step_record_84_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 84 should be saved */
+SYNTHETIC_result_t step_record_84_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 84 should not be duplicated */
+SYNTHETIC_result_t step_record_84_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 85 exists */
+SYNTHETIC_result_t step_record_85_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 85 has value 595 */
+SYNTHETIC_result_t step_record_85_has_value_595(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 85 is updated */
+SYNTHETIC_result_t step_record_85_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 85 should be saved */
+SYNTHETIC_result_t step_record_85_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 85 should not be duplicated */
+SYNTHETIC_result_t step_record_85_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 86 exists */
+SYNTHETIC_result_t step_record_86_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 86 has value 602 */
+SYNTHETIC_result_t step_record_86_has_value_602(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 86 is updated */
+SYNTHETIC_result_t step_record_86_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 86 should be saved */
+SYNTHETIC_result_t step_record_86_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 86 should not be duplicated */
+SYNTHETIC_result_t step_record_86_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 87 exists */
+SYNTHETIC_result_t step_record_87_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 87 has value 609 */
+SYNTHETIC_result_t step_record_87_has_value_609(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 87 is updated */
+SYNTHETIC_result_t step_record_87_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 87 should be saved */
+SYNTHETIC_result_t step_record_87_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 87 should not be duplicated */
+SYNTHETIC_result_t step_record_87_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 88 exists */
+SYNTHETIC_result_t step_record_88_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 88 has value 616 */
+SYNTHETIC_result_t step_record_88_has_value_616(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 88 is updated */
+SYNTHETIC_result_t step_record_88_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 88 should be saved */
+SYNTHETIC_result_t step_record_88_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 88 should not be duplicated */
+SYNTHETIC_result_t step_record_88_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 89 exists */
+SYNTHETIC_result_t step_record_89_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 89 has value 623 */
+SYNTHETIC_result_t step_record_89_has_value_623(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 89 is updated */
+SYNTHETIC_result_t step_record_89_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 89 should be saved */
+SYNTHETIC_result_t step_record_89_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 89 should not be duplicated */
+SYNTHETIC_result_t step_record_89_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 90 exists */
+SYNTHETIC_result_t step_record_90_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 90 has value 630 */
+SYNTHETIC_result_t step_record_90_has_value_630(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 90 is updated */
+SYNTHETIC_result_t step_record_90_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 90 should be saved */
+SYNTHETIC_result_t step_record_90_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 90 should not be duplicated */
+SYNTHETIC_result_t step_record_90_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 91 exists */
+SYNTHETIC_result_t step_record_91_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 91 has value 637 */
+SYNTHETIC_result_t step_record_91_has_value_637(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 91 is updated */
+SYNTHETIC_result_t step_record_91_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 91 should be saved */
+SYNTHETIC_result_t step_record_91_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 91 should not be duplicated */
+SYNTHETIC_result_t step_record_91_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 92 exists */
+SYNTHETIC_result_t step_record_92_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 92 has value 644 */
+SYNTHETIC_result_t step_record_92_has_value_644(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 92 is updated */
+SYNTHETIC_result_t step_record_92_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 92 should be saved */
+SYNTHETIC_result_t step_record_92_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 92 should not be duplicated */
+SYNTHETIC_result_t step_record_92_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 93 exists */
+SYNTHETIC_result_t step_record_93_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 93 has value 651 */
+SYNTHETIC_result_t step_record_93_has_value_651(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 93 is updated */
+SYNTHETIC_result_t step_record_93_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 93 should be saved */
+SYNTHETIC_result_t step_record_93_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 93 should not be duplicated */
+SYNTHETIC_result_t step_record_93_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 94 exists */
+SYNTHETIC_result_t step_record_94_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 94 has value 658 */
+SYNTHETIC_result_t step_record_94_has_value_658(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 94 is updated */
+SYNTHETIC_result_t step_record_94_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 94 should be saved */
+SYNTHETIC_result_t step_record_94_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 94 should not be duplicated */
+SYNTHETIC_result_t step_record_94_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 95 exists */
+SYNTHETIC_result_t step_record_95_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 95 has value 665 */
+SYNTHETIC_result_t step_record_95_has_value_665(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 95 is updated */
+SYNTHETIC_result_t step_record_95_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 95 should be saved */
+SYNTHETIC_result_t step_record_95_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 95 should not be duplicated */
+SYNTHETIC_result_t step_record_95_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 96 exists */
+SYNTHETIC_result_t step_record_96_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 96 has value 672 */
+SYNTHETIC_result_t step_record_96_has_value_672(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 96 is updated */
+SYNTHETIC_result_t step_record_96_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 96 should be saved */
+SYNTHETIC_result_t step_record_96_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 96 should not be duplicated */
+SYNTHETIC_result_t step_record_96_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 97 exists */
+SYNTHETIC_result_t step_record_97_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 97 has value 679 */
+SYNTHETIC_result_t step_record_97_has_value_679(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 97 is updated */
+SYNTHETIC_result_t step_record_97_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 97 should be saved */
+SYNTHETIC_result_t step_record_97_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 97 should not be duplicated */
+SYNTHETIC_result_t step_record_97_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 98 exists */
+SYNTHETIC_result_t step_record_98_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 98 has value 686 */
+SYNTHETIC_result_t step_record_98_has_value_686(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 98 is updated */
+SYNTHETIC_result_t step_record_98_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 98 should be saved */
+SYNTHETIC_result_t step_record_98_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 98 should not be duplicated */
+SYNTHETIC_result_t step_record_98_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 99 exists */
+SYNTHETIC_result_t step_record_99_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 99 has value 693 */
+SYNTHETIC_result_t step_record_99_has_value_693(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 99 is updated */
+SYNTHETIC_result_t step_record_99_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 99 should be saved */
+SYNTHETIC_result_t step_record_99_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 99 should not be duplicated */
+SYNTHETIC_result_t step_record_99_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 100 exists */
+SYNTHETIC_result_t step_record_100_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 100 has value 700 */
+SYNTHETIC_result_t step_record_100_has_value_700(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 100 is updated */
+SYNTHETIC_result_t step_record_100_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 100 should be saved */
+SYNTHETIC_result_t step_record_100_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 100 should not be duplicated */
+SYNTHETIC_result_t step_record_100_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 101 exists */
+SYNTHETIC_result_t step_record_101_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 101 has value 707 */
+SYNTHETIC_result_t step_record_101_has_value_707(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 101 is updated */
+SYNTHETIC_result_t step_record_101_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 101 should be saved */
+SYNTHETIC_result_t step_record_101_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 101 should not be duplicated */
+SYNTHETIC_result_t step_record_101_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 102 exists */
+SYNTHETIC_result_t step_record_102_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 102 has value 714 */
+SYNTHETIC_result_t step_record_102_has_value_714(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 102 is updated */
+SYNTHETIC_result_t step_record_102_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 102 should be saved */
+SYNTHETIC_result_t step_record_102_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 102 should not be duplicated */
+SYNTHETIC_result_t step_record_102_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 103 exists */
+SYNTHETIC_result_t step_record_103_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 103 has value 721 */
+SYNTHETIC_result_t step_record_103_has_value_721(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 103 is updated */
+SYNTHETIC_result_t step_record_103_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 103 should be saved */
+SYNTHETIC_result_t step_record_103_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 103 should not be duplicated */
+SYNTHETIC_result_t step_record_103_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 104 exists */
+SYNTHETIC_result_t step_record_104_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 104 has value 728 */
+SYNTHETIC_result_t step_record_104_has_value_728(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 104 is updated */
+SYNTHETIC_result_t step_record_104_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 104 should be saved */
+SYNTHETIC_result_t step_record_104_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 104 should not be duplicated */
+SYNTHETIC_result_t step_record_104_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 105 exists */
+SYNTHETIC_result_t step_record_105_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 105 has value 735 */
+SYNTHETIC_result_t step_record_105_has_value_735(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 105 is updated */
+SYNTHETIC_result_t step_record_105_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 105 should be saved */
+SYNTHETIC_result_t step_record_105_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 105 should not be duplicated */
+SYNTHETIC_result_t step_record_105_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 106 exists */
+SYNTHETIC_result_t step_record_106_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 106 has value 742 */
+SYNTHETIC_result_t step_record_106_has_value_742(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 106 is updated */
+SYNTHETIC_result_t step_record_106_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 106 should be saved */
+SYNTHETIC_result_t step_record_106_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 106 should not be duplicated */
+SYNTHETIC_result_t step_record_106_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 107 exists */
+SYNTHETIC_result_t step_record_107_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 107 has value 749 */
+SYNTHETIC_result_t step_record_107_has_value_749(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 107 is updated */
+SYNTHETIC_result_t step_record_107_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 107 should be saved */
+SYNTHETIC_result_t step_record_107_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 107 should not be duplicated */
+SYNTHETIC_result_t step_record_107_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 108 exists */
+SYNTHETIC_result_t step_record_108_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 108 has value 756 */
+SYNTHETIC_result_t step_record_108_has_value_756(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 108 is updated */
+SYNTHETIC_result_t step_record_108_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 108 should be saved */
+SYNTHETIC_result_t step_record_108_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 108 should not be duplicated */
+SYNTHETIC_result_t step_record_108_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 109 exists */
+SYNTHETIC_result_t step_record_109_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 109 has value 763 */
+SYNTHETIC_result_t step_record_109_has_value_763(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 109 is updated */
+SYNTHETIC_result_t step_record_109_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 109 should be saved */
+SYNTHETIC_result_t step_record_109_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 109 should not be duplicated */
+SYNTHETIC_result_t step_record_109_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 110 exists */
+SYNTHETIC_result_t step_record_110_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 110 has value 770 */
+SYNTHETIC_result_t step_record_110_has_value_770(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 110 is updated */
+SYNTHETIC_result_t step_record_110_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 110 should be saved */
+SYNTHETIC_result_t step_record_110_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 110 should not be duplicated */
+SYNTHETIC_result_t step_record_110_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 111 exists */
+SYNTHETIC_result_t step_record_111_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 111 has value 777 */
+SYNTHETIC_result_t step_record_111_has_value_777(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 111 is updated */
+SYNTHETIC_result_t step_record_111_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 111 should be saved */
+SYNTHETIC_result_t step_record_111_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 111 should not be duplicated */
+SYNTHETIC_result_t step_record_111_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 112 exists */
+SYNTHETIC_result_t step_record_112_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 112 has value 784 */
+SYNTHETIC_result_t step_record_112_has_value_784(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 112 is updated */
+SYNTHETIC_result_t step_record_112_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 112 should be saved */
+SYNTHETIC_result_t step_record_112_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 112 should not be duplicated */
+SYNTHETIC_result_t step_record_112_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 113 exists */
+SYNTHETIC_result_t step_record_113_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 113 has value 791 */
+SYNTHETIC_result_t step_record_113_has_value_791(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 113 is updated */
+SYNTHETIC_result_t step_record_113_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 113 should be saved */
+SYNTHETIC_result_t step_record_113_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 113 should not be duplicated */
+SYNTHETIC_result_t step_record_113_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 114 exists */
+SYNTHETIC_result_t step_record_114_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 114 has value 798 */
+SYNTHETIC_result_t step_record_114_has_value_798(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 114 is updated */
+SYNTHETIC_result_t step_record_114_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 114 should be saved */
+SYNTHETIC_result_t step_record_114_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 114 should not be duplicated */
+SYNTHETIC_result_t step_record_114_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 115 exists */
+SYNTHETIC_result_t step_record_115_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 115 has value 805 */
+SYNTHETIC_result_t step_record_115_has_value_805(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 115 is updated */
+SYNTHETIC_result_t step_record_115_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 115 should be saved */
+SYNTHETIC_result_t step_record_115_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 115 should not be duplicated */
+SYNTHETIC_result_t step_record_115_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 116 exists */
+SYNTHETIC_result_t step_record_116_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 116 has value 812 */
+SYNTHETIC_result_t step_record_116_has_value_812(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 116 is updated */
+SYNTHETIC_result_t step_record_116_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 116 should be saved */
+SYNTHETIC_result_t step_record_116_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 116 should not be duplicated */
+SYNTHETIC_result_t step_record_116_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 117 exists */
+SYNTHETIC_result_t step_record_117_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 117 has value 819 */
+SYNTHETIC_result_t step_record_117_has_value_819(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 117 is updated */
+SYNTHETIC_result_t step_record_117_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 117 should be saved */
+SYNTHETIC_result_t step_record_117_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 117 should not be duplicated */
+SYNTHETIC_result_t step_record_117_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 118 exists */
+SYNTHETIC_result_t step_record_118_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 118 has value 826 */
+SYNTHETIC_result_t step_record_118_has_value_826(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 118 is updated */
+SYNTHETIC_result_t step_record_118_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 118 should be saved */
+SYNTHETIC_result_t step_record_118_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 118 should not be duplicated */
+SYNTHETIC_result_t step_record_118_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 119 exists */
+SYNTHETIC_result_t step_record_119_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 119 has value 833 */
+SYNTHETIC_result_t step_record_119_has_value_833(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 119 is updated */
+SYNTHETIC_result_t step_record_119_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 119 should be saved */
+SYNTHETIC_result_t step_record_119_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 119 should not be duplicated */
+SYNTHETIC_result_t step_record_119_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 120 exists */
+SYNTHETIC_result_t step_record_120_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 120 has value 840 */
+SYNTHETIC_result_t step_record_120_has_value_840(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 120 is updated */
+SYNTHETIC_result_t step_record_120_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 120 should be saved */
+SYNTHETIC_result_t step_record_120_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 120 should not be duplicated */
+SYNTHETIC_result_t step_record_120_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 121 exists */
+SYNTHETIC_result_t step_record_121_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 121 has value 847 */
+SYNTHETIC_result_t step_record_121_has_value_847(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 121 is updated */
+SYNTHETIC_result_t step_record_121_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 121 should be saved */
+SYNTHETIC_result_t step_record_121_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 121 should not be duplicated */
+SYNTHETIC_result_t step_record_121_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 122 exists */
+SYNTHETIC_result_t step_record_122_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 122 has value 854 */
+SYNTHETIC_result_t step_record_122_has_value_854(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 122 is updated */
+SYNTHETIC_result_t step_record_122_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 122 should be saved */
+SYNTHETIC_result_t step_record_122_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 122 should not be duplicated */
+SYNTHETIC_result_t step_record_122_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 123 exists */
+SYNTHETIC_result_t step_record_123_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 123 has value 861 */
+SYNTHETIC_result_t step_record_123_has_value_861(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 123 is updated */
+SYNTHETIC_result_t step_record_123_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 123 should be saved */
+SYNTHETIC_result_t step_record_123_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 123 should not be duplicated */
+SYNTHETIC_result_t step_record_123_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 124 exists */
+SYNTHETIC_result_t step_record_124_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 124 has value 868 */
+SYNTHETIC_result_t step_record_124_has_value_868(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 124 is updated */
+SYNTHETIC_result_t step_record_124_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 124 should be saved */
+SYNTHETIC_result_t step_record_124_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 124 should not be duplicated */
+SYNTHETIC_result_t step_record_124_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 125 exists */
+SYNTHETIC_result_t step_record_125_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 125 has value 875 */
+SYNTHETIC_result_t step_record_125_has_value_875(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 125 is updated */
+SYNTHETIC_result_t step_record_125_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 125 should be saved */
+SYNTHETIC_result_t step_record_125_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 125 should not be duplicated */
+SYNTHETIC_result_t step_record_125_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 126 exists */
+SYNTHETIC_result_t step_record_126_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 126 has value 882 */
+SYNTHETIC_result_t step_record_126_has_value_882(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 126 is updated */
+SYNTHETIC_result_t step_record_126_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 126 should be saved */
+SYNTHETIC_result_t step_record_126_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 126 should not be duplicated */
+SYNTHETIC_result_t step_record_126_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 127 exists */
+SYNTHETIC_result_t step_record_127_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 127 has value 889 */
+SYNTHETIC_result_t step_record_127_has_value_889(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 127 is updated */
+SYNTHETIC_result_t step_record_127_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 127 should be saved */
+SYNTHETIC_result_t step_record_127_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 127 should not be duplicated */
+SYNTHETIC_result_t step_record_127_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 128 exists */
+SYNTHETIC_result_t step_record_128_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 128 has value 896 */
+SYNTHETIC_result_t step_record_128_has_value_896(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 128 is updated */
+SYNTHETIC_result_t step_record_128_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 128 should be saved */
+SYNTHETIC_result_t step_record_128_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 128 should not be duplicated */
+SYNTHETIC_result_t step_record_128_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 129 exists */
+SYNTHETIC_result_t step_record_129_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 129 has value 903 */
+SYNTHETIC_result_t step_record_129_has_value_903(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 129 is updated */
+SYNTHETIC_result_t step_record_129_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 129 should be saved */
+SYNTHETIC_result_t step_record_129_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 129 should not be duplicated */
+SYNTHETIC_result_t step_record_129_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 130 exists */
+SYNTHETIC_result_t step_record_130_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 130 has value 910 */
+SYNTHETIC_result_t step_record_130_has_value_910(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 130 is updated */
+SYNTHETIC_result_t step_record_130_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 130 should be saved */
+SYNTHETIC_result_t step_record_130_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 130 should not be duplicated */
+SYNTHETIC_result_t step_record_130_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 131 exists */
+SYNTHETIC_result_t step_record_131_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 131 has value 917 */
+SYNTHETIC_result_t step_record_131_has_value_917(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 131 is updated */
+SYNTHETIC_result_t step_record_131_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 131 should be saved */
+SYNTHETIC_result_t step_record_131_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 131 should not be duplicated */
+SYNTHETIC_result_t step_record_131_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 132 exists */
+SYNTHETIC_result_t step_record_132_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 132 has value 924 */
+SYNTHETIC_result_t step_record_132_has_value_924(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 132 is updated */
+SYNTHETIC_result_t step_record_132_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 132 should be saved */
+SYNTHETIC_result_t step_record_132_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 132 should not be duplicated */
+SYNTHETIC_result_t step_record_132_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 133 exists */
+SYNTHETIC_result_t step_record_133_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 133 has value 931 */
+SYNTHETIC_result_t step_record_133_has_value_931(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 133 is updated */
+SYNTHETIC_result_t step_record_133_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 133 should be saved */
+SYNTHETIC_result_t step_record_133_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 133 should not be duplicated */
+SYNTHETIC_result_t step_record_133_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 134 exists */
+SYNTHETIC_result_t step_record_134_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 134 has value 938 */
+SYNTHETIC_result_t step_record_134_has_value_938(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 134 is updated */
+SYNTHETIC_result_t step_record_134_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 134 should be saved */
+SYNTHETIC_result_t step_record_134_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 134 should not be duplicated */
+SYNTHETIC_result_t step_record_134_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 135 exists */
+SYNTHETIC_result_t step_record_135_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 135 has value 945 */
+SYNTHETIC_result_t step_record_135_has_value_945(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 135 is updated */
+SYNTHETIC_result_t step_record_135_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 135 should be saved */
+SYNTHETIC_result_t step_record_135_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 135 should not be duplicated */
+SYNTHETIC_result_t step_record_135_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 136 exists */
+SYNTHETIC_result_t step_record_136_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 136 has value 952 */
+SYNTHETIC_result_t step_record_136_has_value_952(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 136 is updated */
+SYNTHETIC_result_t step_record_136_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 136 should be saved */
+SYNTHETIC_result_t step_record_136_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 136 should not be duplicated */
+SYNTHETIC_result_t step_record_136_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 137 exists */
+SYNTHETIC_result_t step_record_137_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 137 has value 959 */
+SYNTHETIC_result_t step_record_137_has_value_959(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 137 is updated */
+SYNTHETIC_result_t step_record_137_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 137 should be saved */
+SYNTHETIC_result_t step_record_137_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 137 should not be duplicated */
+SYNTHETIC_result_t step_record_137_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 138 exists */
+SYNTHETIC_result_t step_record_138_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 138 has value 966 */
+SYNTHETIC_result_t step_record_138_has_value_966(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 138 is updated */
+SYNTHETIC_result_t step_record_138_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 138 should be saved */
+SYNTHETIC_result_t step_record_138_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 138 should not be duplicated */
+SYNTHETIC_result_t step_record_138_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 139 exists */
+SYNTHETIC_result_t step_record_139_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 139 has value 973 */
+SYNTHETIC_result_t step_record_139_has_value_973(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 139 is updated */
+SYNTHETIC_result_t step_record_139_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 139 should be saved */
+SYNTHETIC_result_t step_record_139_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 139 should not be duplicated */
+SYNTHETIC_result_t step_record_139_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 140 exists */
+SYNTHETIC_result_t step_record_140_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 140 has value 980 */
+SYNTHETIC_result_t step_record_140_has_value_980(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 140 is updated */
+SYNTHETIC_result_t step_record_140_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 140 should be saved */
+SYNTHETIC_result_t step_record_140_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 140 should not be duplicated */
+SYNTHETIC_result_t step_record_140_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 141 exists */
+SYNTHETIC_result_t step_record_141_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 141 has value 987 */
+SYNTHETIC_result_t step_record_141_has_value_987(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 141 is updated */
+SYNTHETIC_result_t step_record_141_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 141 should be saved */
+SYNTHETIC_result_t step_record_141_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 141 should not be duplicated */
+SYNTHETIC_result_t step_record_141_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 142 exists */
+SYNTHETIC_result_t step_record_142_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 142 has value 994 */
+SYNTHETIC_result_t step_record_142_has_value_994(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 142 is updated */
+SYNTHETIC_result_t step_record_142_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 142 should be saved */
+SYNTHETIC_result_t step_record_142_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 142 should not be duplicated */
+SYNTHETIC_result_t step_record_142_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 143 exists */
+SYNTHETIC_result_t step_record_143_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 143 has value 1001 */
+SYNTHETIC_result_t step_record_143_has_value_1001(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 143 is updated */
+SYNTHETIC_result_t step_record_143_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 143 should be saved */
+SYNTHETIC_result_t step_record_143_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 143 should not be duplicated */
+SYNTHETIC_result_t step_record_143_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 144 exists */
+SYNTHETIC_result_t step_record_144_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 144 has value 1008 */
+SYNTHETIC_result_t step_record_144_has_value_1008(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 144 is updated */
+SYNTHETIC_result_t step_record_144_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 144 should be saved */
+SYNTHETIC_result_t step_record_144_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 144 should not be duplicated */
+SYNTHETIC_result_t step_record_144_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 145 exists */
+SYNTHETIC_result_t step_record_145_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 145 has value 1015 */
+SYNTHETIC_result_t step_record_145_has_value_1015(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 145 is updated */
+SYNTHETIC_result_t step_record_145_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 145 should be saved */
+SYNTHETIC_result_t step_record_145_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 145 should not be duplicated */
+SYNTHETIC_result_t step_record_145_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 146 exists */
+SYNTHETIC_result_t step_record_146_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 146 has value 1022 */
+SYNTHETIC_result_t step_record_146_has_value_1022(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 146 is updated */
+SYNTHETIC_result_t step_record_146_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 146 should be saved */
+SYNTHETIC_result_t step_record_146_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 146 should not be duplicated */
+SYNTHETIC_result_t step_record_146_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 147 exists */
+SYNTHETIC_result_t step_record_147_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 147 has value 1029 */
+SYNTHETIC_result_t step_record_147_has_value_1029(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 147 is updated */
+SYNTHETIC_result_t step_record_147_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 147 should be saved */
+SYNTHETIC_result_t step_record_147_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 147 should not be duplicated */
+SYNTHETIC_result_t step_record_147_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 148 exists */
+SYNTHETIC_result_t step_record_148_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 148 has value 1036 */
+SYNTHETIC_result_t step_record_148_has_value_1036(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 148 is updated */
+SYNTHETIC_result_t step_record_148_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 148 should be saved */
+SYNTHETIC_result_t step_record_148_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 148 should not be duplicated */
+SYNTHETIC_result_t step_record_148_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 149 exists */
+SYNTHETIC_result_t step_record_149_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 149 has value 1043 */
+SYNTHETIC_result_t step_record_149_has_value_1043(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 149 is updated */
+SYNTHETIC_result_t step_record_149_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 149 should be saved */
+SYNTHETIC_result_t step_record_149_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 149 should not be duplicated */
+SYNTHETIC_result_t step_record_149_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 150 exists */
+SYNTHETIC_result_t step_record_150_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 150 has value 1050 */
+SYNTHETIC_result_t step_record_150_has_value_1050(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 150 is updated */
+SYNTHETIC_result_t step_record_150_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 150 should be saved */
+SYNTHETIC_result_t step_record_150_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 150 should not be duplicated */
+SYNTHETIC_result_t step_record_150_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 151 exists */
+SYNTHETIC_result_t step_record_151_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 151 has value 1057 */
+SYNTHETIC_result_t step_record_151_has_value_1057(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 151 is updated */
+SYNTHETIC_result_t step_record_151_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 151 should be saved */
+SYNTHETIC_result_t step_record_151_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 151 should not be duplicated */
+SYNTHETIC_result_t step_record_151_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 152 exists */
+SYNTHETIC_result_t step_record_152_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 152 has value 1064 */
+SYNTHETIC_result_t step_record_152_has_value_1064(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 152 is updated */
+SYNTHETIC_result_t step_record_152_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 152 should be saved */
+SYNTHETIC_result_t step_record_152_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 152 should not be duplicated */
+SYNTHETIC_result_t step_record_152_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 153 exists */
+SYNTHETIC_result_t step_record_153_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 153 has value 1071 */
+SYNTHETIC_result_t step_record_153_has_value_1071(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 153 is updated */
+SYNTHETIC_result_t step_record_153_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 153 should be saved */
+SYNTHETIC_result_t step_record_153_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 153 should not be duplicated */
+SYNTHETIC_result_t step_record_153_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 154 exists */
+SYNTHETIC_result_t step_record_154_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 154 has value 1078 */
+SYNTHETIC_result_t step_record_154_has_value_1078(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 154 is updated */
+SYNTHETIC_result_t step_record_154_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 154 should be saved */
+SYNTHETIC_result_t step_record_154_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 154 should not be duplicated */
+SYNTHETIC_result_t step_record_154_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 155 exists */
+SYNTHETIC_result_t step_record_155_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 155 has value 1085 */
+SYNTHETIC_result_t step_record_155_has_value_1085(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 155 is updated */
+SYNTHETIC_result_t step_record_155_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 155 should be saved */
+SYNTHETIC_result_t step_record_155_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 155 should not be duplicated */
+SYNTHETIC_result_t step_record_155_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 156 exists */
+SYNTHETIC_result_t step_record_156_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 156 has value 1092 */
+SYNTHETIC_result_t step_record_156_has_value_1092(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 156 is updated */
+SYNTHETIC_result_t step_record_156_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 156 should be saved */
+SYNTHETIC_result_t step_record_156_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 156 should not be duplicated */
+SYNTHETIC_result_t step_record_156_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 157 exists */
+SYNTHETIC_result_t step_record_157_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 157 has value 1099 */
+SYNTHETIC_result_t step_record_157_has_value_1099(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 157 is updated */
+SYNTHETIC_result_t step_record_157_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 157 should be saved */
+SYNTHETIC_result_t step_record_157_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 157 should not be duplicated */
+SYNTHETIC_result_t step_record_157_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 158 exists */
+SYNTHETIC_result_t step_record_158_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 158 has value 1106 */
+SYNTHETIC_result_t step_record_158_has_value_1106(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 158 is updated */
+SYNTHETIC_result_t step_record_158_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 158 should be saved */
+SYNTHETIC_result_t step_record_158_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 158 should not be duplicated */
+SYNTHETIC_result_t step_record_158_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 159 exists */
+SYNTHETIC_result_t step_record_159_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 159 has value 1113 */
+SYNTHETIC_result_t step_record_159_has_value_1113(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 159 is updated */
+SYNTHETIC_result_t step_record_159_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 159 should be saved */
+SYNTHETIC_result_t step_record_159_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 159 should not be duplicated */
+SYNTHETIC_result_t step_record_159_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 160 exists */
+SYNTHETIC_result_t step_record_160_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 160 has value 1120 */
+SYNTHETIC_result_t step_record_160_has_value_1120(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 160 is updated */
+SYNTHETIC_result_t step_record_160_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 160 should be saved */
+SYNTHETIC_result_t step_record_160_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 160 should not be duplicated */
+SYNTHETIC_result_t step_record_160_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 161 exists */
+SYNTHETIC_result_t step_record_161_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 161 has value 1127 */
+SYNTHETIC_result_t step_record_161_has_value_1127(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 161 is updated */
+SYNTHETIC_result_t step_record_161_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 161 should be saved */
+SYNTHETIC_result_t step_record_161_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 161 should not be duplicated */
+SYNTHETIC_result_t step_record_161_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 162 exists */
+SYNTHETIC_result_t step_record_162_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 162 has value 1134 */
+SYNTHETIC_result_t step_record_162_has_value_1134(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 162 is updated */
+SYNTHETIC_result_t step_record_162_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 162 should be saved */
+SYNTHETIC_result_t step_record_162_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 162 should not be duplicated */
+SYNTHETIC_result_t step_record_162_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 163 exists */
+SYNTHETIC_result_t step_record_163_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 163 has value 1141 */
+SYNTHETIC_result_t step_record_163_has_value_1141(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 163 is updated */
+SYNTHETIC_result_t step_record_163_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 163 should be saved */
+SYNTHETIC_result_t step_record_163_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 163 should not be duplicated */
+SYNTHETIC_result_t step_record_163_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 164 exists */
+SYNTHETIC_result_t step_record_164_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 164 has value 1148 */
+SYNTHETIC_result_t step_record_164_has_value_1148(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 164 is updated */
+SYNTHETIC_result_t step_record_164_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 164 should be saved */
+SYNTHETIC_result_t step_record_164_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 164 should not be duplicated */
+SYNTHETIC_result_t step_record_164_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 165 exists */
+SYNTHETIC_result_t step_record_165_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 165 has value 1155 */
+SYNTHETIC_result_t step_record_165_has_value_1155(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 165 is updated */
+SYNTHETIC_result_t step_record_165_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 165 should be saved */
+SYNTHETIC_result_t step_record_165_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 165 should not be duplicated */
+SYNTHETIC_result_t step_record_165_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 166 exists */
+SYNTHETIC_result_t step_record_166_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 166 has value 1162 */
+SYNTHETIC_result_t step_record_166_has_value_1162(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 166 is updated */
+SYNTHETIC_result_t step_record_166_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 166 should be saved */
+SYNTHETIC_result_t step_record_166_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 166 should not be duplicated */
+SYNTHETIC_result_t step_record_166_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 167 exists */
+SYNTHETIC_result_t step_record_167_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 167 has value 1169 */
+SYNTHETIC_result_t step_record_167_has_value_1169(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 167 is updated */
+SYNTHETIC_result_t step_record_167_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 167 should be saved */
+SYNTHETIC_result_t step_record_167_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 167 should not be duplicated */
+SYNTHETIC_result_t step_record_167_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 168 exists */
+SYNTHETIC_result_t step_record_168_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 168 has value 1176 */
+SYNTHETIC_result_t step_record_168_has_value_1176(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 168 is updated */
+SYNTHETIC_result_t step_record_168_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 168 should be saved */
+SYNTHETIC_result_t step_record_168_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 168 should not be duplicated */
+SYNTHETIC_result_t step_record_168_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 169 exists */
+SYNTHETIC_result_t step_record_169_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 169 has value 1183 */
+SYNTHETIC_result_t step_record_169_has_value_1183(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 169 is updated */
+SYNTHETIC_result_t step_record_169_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 169 should be saved */
+SYNTHETIC_result_t step_record_169_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 169 should not be duplicated */
+SYNTHETIC_result_t step_record_169_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 170 exists */
+SYNTHETIC_result_t step_record_170_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 170 has value 1190 */
+SYNTHETIC_result_t step_record_170_has_value_1190(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 170 is updated */
+SYNTHETIC_result_t step_record_170_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 170 should be saved */
+SYNTHETIC_result_t step_record_170_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 170 should not be duplicated */
+SYNTHETIC_result_t step_record_170_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 171 exists */
+SYNTHETIC_result_t step_record_171_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 171 has value 1197 */
+SYNTHETIC_result_t step_record_171_has_value_1197(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 171 is updated */
+SYNTHETIC_result_t step_record_171_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 171 should be saved */
+SYNTHETIC_result_t step_record_171_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 171 should not be duplicated */
+SYNTHETIC_result_t step_record_171_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 172 exists */
+SYNTHETIC_result_t step_record_172_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 172 has value 1204 */
+SYNTHETIC_result_t step_record_172_has_value_1204(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 172 is updated */
+SYNTHETIC_result_t step_record_172_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 172 should be saved */
+SYNTHETIC_result_t step_record_172_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 172 should not be duplicated */
+SYNTHETIC_result_t step_record_172_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 173 exists */
+SYNTHETIC_result_t step_record_173_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 173 has value 1211 */
+SYNTHETIC_result_t step_record_173_has_value_1211(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 173 is updated */
+SYNTHETIC_result_t step_record_173_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 173 should be saved */
+SYNTHETIC_result_t step_record_173_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 173 should not be duplicated */
+SYNTHETIC_result_t step_record_173_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 174 exists */
+SYNTHETIC_result_t step_record_174_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 174 has value 1218 */
+SYNTHETIC_result_t step_record_174_has_value_1218(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 174 is updated */
+SYNTHETIC_result_t step_record_174_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 174 should be saved */
+SYNTHETIC_result_t step_record_174_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 174 should not be duplicated */
+SYNTHETIC_result_t step_record_174_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 175 exists */
+SYNTHETIC_result_t step_record_175_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 175 has value 1225 */
+SYNTHETIC_result_t step_record_175_has_value_1225(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 175 is updated */
+SYNTHETIC_result_t step_record_175_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 175 should be saved */
+SYNTHETIC_result_t step_record_175_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 175 should not be duplicated */
+SYNTHETIC_result_t step_record_175_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 176 exists */
+SYNTHETIC_result_t step_record_176_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 176 has value 1232 */
+SYNTHETIC_result_t step_record_176_has_value_1232(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 176 is updated */
+SYNTHETIC_result_t step_record_176_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 176 should be saved */
+SYNTHETIC_result_t step_record_176_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 176 should not be duplicated */
+SYNTHETIC_result_t step_record_176_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 177 exists */
+SYNTHETIC_result_t step_record_177_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 177 has value 1239 */
+SYNTHETIC_result_t step_record_177_has_value_1239(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 177 is updated */
+SYNTHETIC_result_t step_record_177_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 177 should be saved */
+SYNTHETIC_result_t step_record_177_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 177 should not be duplicated */
+SYNTHETIC_result_t step_record_177_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 178 exists */
+SYNTHETIC_result_t step_record_178_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 178 has value 1246 */
+SYNTHETIC_result_t step_record_178_has_value_1246(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 178 is updated */
+SYNTHETIC_result_t step_record_178_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 178 should be saved */
+SYNTHETIC_result_t step_record_178_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 178 should not be duplicated */
+SYNTHETIC_result_t step_record_178_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 179 exists */
+SYNTHETIC_result_t step_record_179_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 179 has value 1253 */
+SYNTHETIC_result_t step_record_179_has_value_1253(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 179 is updated */
+SYNTHETIC_result_t step_record_179_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 179 should be saved */
+SYNTHETIC_result_t step_record_179_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 179 should not be duplicated */
+SYNTHETIC_result_t step_record_179_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 180 exists */
+SYNTHETIC_result_t step_record_180_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 180 has value 1260 */
+SYNTHETIC_result_t step_record_180_has_value_1260(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 180 is updated */
+SYNTHETIC_result_t step_record_180_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 180 should be saved */
+SYNTHETIC_result_t step_record_180_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 180 should not be duplicated */
+SYNTHETIC_result_t step_record_180_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 181 exists */
+SYNTHETIC_result_t step_record_181_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 181 has value 1267 */
+SYNTHETIC_result_t step_record_181_has_value_1267(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 181 is updated */
+SYNTHETIC_result_t step_record_181_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 181 should be saved */
+SYNTHETIC_result_t step_record_181_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 181 should not be duplicated */
+SYNTHETIC_result_t step_record_181_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 182 exists */
+SYNTHETIC_result_t step_record_182_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 182 has value 1274 */
+SYNTHETIC_result_t step_record_182_has_value_1274(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 182 is updated */
+SYNTHETIC_result_t step_record_182_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 182 should be saved */
+SYNTHETIC_result_t step_record_182_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 182 should not be duplicated */
+SYNTHETIC_result_t step_record_182_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 183 exists */
+SYNTHETIC_result_t step_record_183_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 183 has value 1281 */
+SYNTHETIC_result_t step_record_183_has_value_1281(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 183 is updated */
+SYNTHETIC_result_t step_record_183_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 183 should be saved */
+SYNTHETIC_result_t step_record_183_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 183 should not be duplicated */
+SYNTHETIC_result_t step_record_183_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 184 exists */
+SYNTHETIC_result_t step_record_184_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 184 has value 1288 */
+SYNTHETIC_result_t step_record_184_has_value_1288(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 184 is updated */
+SYNTHETIC_result_t step_record_184_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 184 should be saved */
+SYNTHETIC_result_t step_record_184_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 184 should not be duplicated */
+SYNTHETIC_result_t step_record_184_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 185 exists */
+SYNTHETIC_result_t step_record_185_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 185 has value 1295 */
+SYNTHETIC_result_t step_record_185_has_value_1295(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 185 is updated */
+SYNTHETIC_result_t step_record_185_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 185 should be saved */
+SYNTHETIC_result_t step_record_185_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 185 should not be duplicated */
+SYNTHETIC_result_t step_record_185_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 186 exists */
+SYNTHETIC_result_t step_record_186_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 186 has value 1302 */
+SYNTHETIC_result_t step_record_186_has_value_1302(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 186 is updated */
+SYNTHETIC_result_t step_record_186_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 186 should be saved */
+SYNTHETIC_result_t step_record_186_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 186 should not be duplicated */
+SYNTHETIC_result_t step_record_186_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 187 exists */
+SYNTHETIC_result_t step_record_187_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 187 has value 1309 */
+SYNTHETIC_result_t step_record_187_has_value_1309(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 187 is updated */
+SYNTHETIC_result_t step_record_187_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 187 should be saved */
+SYNTHETIC_result_t step_record_187_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 187 should not be duplicated */
+SYNTHETIC_result_t step_record_187_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 188 exists */
+SYNTHETIC_result_t step_record_188_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 188 has value 1316 */
+SYNTHETIC_result_t step_record_188_has_value_1316(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 188 is updated */
+SYNTHETIC_result_t step_record_188_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 188 should be saved */
+SYNTHETIC_result_t step_record_188_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 188 should not be duplicated */
+SYNTHETIC_result_t step_record_188_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 189 exists */
+SYNTHETIC_result_t step_record_189_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 189 has value 1323 */
+SYNTHETIC_result_t step_record_189_has_value_1323(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 189 is updated */
+SYNTHETIC_result_t step_record_189_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 189 should be saved */
+SYNTHETIC_result_t step_record_189_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 189 should not be duplicated */
+SYNTHETIC_result_t step_record_189_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 190 exists */
+SYNTHETIC_result_t step_record_190_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 190 has value 1330 */
+SYNTHETIC_result_t step_record_190_has_value_1330(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 190 is updated */
+SYNTHETIC_result_t step_record_190_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 190 should be saved */
+SYNTHETIC_result_t step_record_190_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 190 should not be duplicated */
+SYNTHETIC_result_t step_record_190_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 191 exists */
+SYNTHETIC_result_t step_record_191_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 191 has value 1337 */
+SYNTHETIC_result_t step_record_191_has_value_1337(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 191 is updated */
+SYNTHETIC_result_t step_record_191_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 191 should be saved */
+SYNTHETIC_result_t step_record_191_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 191 should not be duplicated */
+SYNTHETIC_result_t step_record_191_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 192 exists */
+SYNTHETIC_result_t step_record_192_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 192 has value 1344 */
+SYNTHETIC_result_t step_record_192_has_value_1344(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 192 is updated */
+SYNTHETIC_result_t step_record_192_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 192 should be saved */
+SYNTHETIC_result_t step_record_192_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 192 should not be duplicated */
+SYNTHETIC_result_t step_record_192_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 193 exists */
+SYNTHETIC_result_t step_record_193_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 193 has value 1351 */
+SYNTHETIC_result_t step_record_193_has_value_1351(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 193 is updated */
+SYNTHETIC_result_t step_record_193_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 193 should be saved */
+SYNTHETIC_result_t step_record_193_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 193 should not be duplicated */
+SYNTHETIC_result_t step_record_193_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 194 exists */
+SYNTHETIC_result_t step_record_194_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 194 has value 1358 */
+SYNTHETIC_result_t step_record_194_has_value_1358(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 194 is updated */
+SYNTHETIC_result_t step_record_194_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 194 should be saved */
+SYNTHETIC_result_t step_record_194_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 194 should not be duplicated */
+SYNTHETIC_result_t step_record_194_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 195 exists */
+SYNTHETIC_result_t step_record_195_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 195 has value 1365 */
+SYNTHETIC_result_t step_record_195_has_value_1365(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 195 is updated */
+SYNTHETIC_result_t step_record_195_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 195 should be saved */
+SYNTHETIC_result_t step_record_195_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 195 should not be duplicated */
+SYNTHETIC_result_t step_record_195_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 196 exists */
+SYNTHETIC_result_t step_record_196_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 196 has value 1372 */
+SYNTHETIC_result_t step_record_196_has_value_1372(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 196 is updated */
+SYNTHETIC_result_t step_record_196_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 196 should be saved */
+SYNTHETIC_result_t step_record_196_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 196 should not be duplicated */
+SYNTHETIC_result_t step_record_196_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 197 exists */
+SYNTHETIC_result_t step_record_197_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 197 has value 1379 */
+SYNTHETIC_result_t step_record_197_has_value_1379(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 197 is updated */
+SYNTHETIC_result_t step_record_197_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 197 should be saved */
+SYNTHETIC_result_t step_record_197_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 197 should not be duplicated */
+SYNTHETIC_result_t step_record_197_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 198 exists */
+SYNTHETIC_result_t step_record_198_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 198 has value 1386 */
+SYNTHETIC_result_t step_record_198_has_value_1386(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 198 is updated */
+SYNTHETIC_result_t step_record_198_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 198 should be saved */
+SYNTHETIC_result_t step_record_198_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 198 should not be duplicated */
+SYNTHETIC_result_t step_record_198_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 199 exists */
+SYNTHETIC_result_t step_record_199_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 199 has value 1393 */
+SYNTHETIC_result_t step_record_199_has_value_1393(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 199 is updated */
+SYNTHETIC_result_t step_record_199_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 199 should be saved */
+SYNTHETIC_result_t step_record_199_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 199 should not be duplicated */
+SYNTHETIC_result_t step_record_199_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 200 exists */
+SYNTHETIC_result_t step_record_200_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 200 has value 1400 */
+SYNTHETIC_result_t step_record_200_has_value_1400(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 200 is updated */
+SYNTHETIC_result_t step_record_200_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 200 should be saved */
+SYNTHETIC_result_t step_record_200_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 200 should not be duplicated */
+SYNTHETIC_result_t step_record_200_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 201 exists */
+SYNTHETIC_result_t step_record_201_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 201 has value 1407 */
+SYNTHETIC_result_t step_record_201_has_value_1407(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 201 is updated */
+SYNTHETIC_result_t step_record_201_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 201 should be saved */
+SYNTHETIC_result_t step_record_201_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 201 should not be duplicated */
+SYNTHETIC_result_t step_record_201_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 202 exists */
+SYNTHETIC_result_t step_record_202_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 202 has value 1414 */
+SYNTHETIC_result_t step_record_202_has_value_1414(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 202 is updated */
+SYNTHETIC_result_t step_record_202_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 202 should be saved */
+SYNTHETIC_result_t step_record_202_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 202 should not be duplicated */
+SYNTHETIC_result_t step_record_202_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 203 exists */
+SYNTHETIC_result_t step_record_203_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 203 has value 1421 */
+SYNTHETIC_result_t step_record_203_has_value_1421(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 203 is updated */
+SYNTHETIC_result_t step_record_203_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 203 should be saved */
+SYNTHETIC_result_t step_record_203_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 203 should not be duplicated */
+SYNTHETIC_result_t step_record_203_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 204 exists */
+SYNTHETIC_result_t step_record_204_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 204 has value 1428 */
+SYNTHETIC_result_t step_record_204_has_value_1428(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 204 is updated */
+SYNTHETIC_result_t step_record_204_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 204 should be saved */
+SYNTHETIC_result_t step_record_204_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 204 should not be duplicated */
+SYNTHETIC_result_t step_record_204_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 205 exists */
+SYNTHETIC_result_t step_record_205_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 205 has value 1435 */
+SYNTHETIC_result_t step_record_205_has_value_1435(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 205 is updated */
+SYNTHETIC_result_t step_record_205_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 205 should be saved */
+SYNTHETIC_result_t step_record_205_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 205 should not be duplicated */
+SYNTHETIC_result_t step_record_205_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 206 exists */
+SYNTHETIC_result_t step_record_206_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 206 has value 1442 */
+SYNTHETIC_result_t step_record_206_has_value_1442(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 206 is updated */
+SYNTHETIC_result_t step_record_206_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 206 should be saved */
+SYNTHETIC_result_t step_record_206_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 206 should not be duplicated */
+SYNTHETIC_result_t step_record_206_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 207 exists */
+SYNTHETIC_result_t step_record_207_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 207 has value 1449 */
+SYNTHETIC_result_t step_record_207_has_value_1449(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 207 is updated */
+SYNTHETIC_result_t step_record_207_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 207 should be saved */
+SYNTHETIC_result_t step_record_207_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 207 should not be duplicated */
+SYNTHETIC_result_t step_record_207_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 208 exists */
+SYNTHETIC_result_t step_record_208_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 208 has value 1456 */
+SYNTHETIC_result_t step_record_208_has_value_1456(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 208 is updated */
+SYNTHETIC_result_t step_record_208_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 208 should be saved */
+SYNTHETIC_result_t step_record_208_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 208 should not be duplicated */
+SYNTHETIC_result_t step_record_208_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 209 exists */
+SYNTHETIC_result_t step_record_209_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 209 has value 1463 */
+SYNTHETIC_result_t step_record_209_has_value_1463(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 209 is updated */
+SYNTHETIC_result_t step_record_209_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 209 should be saved */
+SYNTHETIC_result_t step_record_209_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 209 should not be duplicated */
+SYNTHETIC_result_t step_record_209_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 210 exists */
+SYNTHETIC_result_t step_record_210_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 210 has value 1470 */
+SYNTHETIC_result_t step_record_210_has_value_1470(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 210 is updated */
+SYNTHETIC_result_t step_record_210_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 210 should be saved */
+SYNTHETIC_result_t step_record_210_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 210 should not be duplicated */
+SYNTHETIC_result_t step_record_210_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 211 exists */
+SYNTHETIC_result_t step_record_211_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 211 has value 1477 */
+SYNTHETIC_result_t step_record_211_has_value_1477(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 211 is updated */
+SYNTHETIC_result_t step_record_211_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 211 should be saved */
+SYNTHETIC_result_t step_record_211_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 211 should not be duplicated */
+SYNTHETIC_result_t step_record_211_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 212 exists */
+SYNTHETIC_result_t step_record_212_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 212 has value 1484 */
+SYNTHETIC_result_t step_record_212_has_value_1484(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 212 is updated */
+SYNTHETIC_result_t step_record_212_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 212 should be saved */
+SYNTHETIC_result_t step_record_212_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 212 should not be duplicated */
+SYNTHETIC_result_t step_record_212_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 213 exists */
+SYNTHETIC_result_t step_record_213_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 213 has value 1491 */
+SYNTHETIC_result_t step_record_213_has_value_1491(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 213 is updated */
+SYNTHETIC_result_t step_record_213_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 213 should be saved */
+SYNTHETIC_result_t step_record_213_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 213 should not be duplicated */
+SYNTHETIC_result_t step_record_213_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 214 exists */
+SYNTHETIC_result_t step_record_214_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 214 has value 1498 */
+SYNTHETIC_result_t step_record_214_has_value_1498(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 214 is updated */
+SYNTHETIC_result_t step_record_214_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 214 should be saved */
+SYNTHETIC_result_t step_record_214_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 214 should not be duplicated */
+SYNTHETIC_result_t step_record_214_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 215 exists */
+SYNTHETIC_result_t step_record_215_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 215 has value 1505 */
+SYNTHETIC_result_t step_record_215_has_value_1505(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 215 is updated */
+SYNTHETIC_result_t step_record_215_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 215 should be saved */
+SYNTHETIC_result_t step_record_215_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 215 should not be duplicated */
+SYNTHETIC_result_t step_record_215_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 216 exists */
+SYNTHETIC_result_t step_record_216_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 216 has value 1512 */
+SYNTHETIC_result_t step_record_216_has_value_1512(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 216 is updated */
+SYNTHETIC_result_t step_record_216_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 216 should be saved */
+SYNTHETIC_result_t step_record_216_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 216 should not be duplicated */
+SYNTHETIC_result_t step_record_216_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 217 exists */
+SYNTHETIC_result_t step_record_217_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 217 has value 1519 */
+SYNTHETIC_result_t step_record_217_has_value_1519(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 217 is updated */
+SYNTHETIC_result_t step_record_217_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 217 should be saved */
+SYNTHETIC_result_t step_record_217_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 217 should not be duplicated */
+SYNTHETIC_result_t step_record_217_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 218 exists */
+SYNTHETIC_result_t step_record_218_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 218 has value 1526 */
+SYNTHETIC_result_t step_record_218_has_value_1526(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 218 is updated */
+SYNTHETIC_result_t step_record_218_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 218 should be saved */
+SYNTHETIC_result_t step_record_218_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 218 should not be duplicated */
+SYNTHETIC_result_t step_record_218_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 219 exists */
+SYNTHETIC_result_t step_record_219_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 219 has value 1533 */
+SYNTHETIC_result_t step_record_219_has_value_1533(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 219 is updated */
+SYNTHETIC_result_t step_record_219_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 219 should be saved */
+SYNTHETIC_result_t step_record_219_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 219 should not be duplicated */
+SYNTHETIC_result_t step_record_219_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 220 exists */
+SYNTHETIC_result_t step_record_220_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 220 has value 1540 */
+SYNTHETIC_result_t step_record_220_has_value_1540(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 220 is updated */
+SYNTHETIC_result_t step_record_220_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 220 should be saved */
+SYNTHETIC_result_t step_record_220_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 220 should not be duplicated */
+SYNTHETIC_result_t step_record_220_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 221 exists */
+SYNTHETIC_result_t step_record_221_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 221 has value 1547 */
+SYNTHETIC_result_t step_record_221_has_value_1547(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 221 is updated */
+SYNTHETIC_result_t step_record_221_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 221 should be saved */
+SYNTHETIC_result_t step_record_221_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 221 should not be duplicated */
+SYNTHETIC_result_t step_record_221_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 222 exists */
+SYNTHETIC_result_t step_record_222_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 222 has value 1554 */
+SYNTHETIC_result_t step_record_222_has_value_1554(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 222 is updated */
+SYNTHETIC_result_t step_record_222_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 222 should be saved */
+SYNTHETIC_result_t step_record_222_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 222 should not be duplicated */
+SYNTHETIC_result_t step_record_222_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 223 exists */
+SYNTHETIC_result_t step_record_223_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 223 has value 1561 */
+SYNTHETIC_result_t step_record_223_has_value_1561(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 223 is updated */
+SYNTHETIC_result_t step_record_223_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 223 should be saved */
+SYNTHETIC_result_t step_record_223_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 223 should not be duplicated */
+SYNTHETIC_result_t step_record_223_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 224 exists */
+SYNTHETIC_result_t step_record_224_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 224 has value 1568 */
+SYNTHETIC_result_t step_record_224_has_value_1568(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 224 is updated */
+SYNTHETIC_result_t step_record_224_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 224 should be saved */
+SYNTHETIC_result_t step_record_224_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 224 should not be duplicated */
+SYNTHETIC_result_t step_record_224_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 225 exists */
+SYNTHETIC_result_t step_record_225_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 225 has value 1575 */
+SYNTHETIC_result_t step_record_225_has_value_1575(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 225 is updated */
+SYNTHETIC_result_t step_record_225_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 225 should be saved */
+SYNTHETIC_result_t step_record_225_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 225 should not be duplicated */
+SYNTHETIC_result_t step_record_225_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 226 exists */
+SYNTHETIC_result_t step_record_226_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 226 has value 1582 */
+SYNTHETIC_result_t step_record_226_has_value_1582(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 226 is updated */
+SYNTHETIC_result_t step_record_226_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 226 should be saved */
+SYNTHETIC_result_t step_record_226_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 226 should not be duplicated */
+SYNTHETIC_result_t step_record_226_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 227 exists */
+SYNTHETIC_result_t step_record_227_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 227 has value 1589 */
+SYNTHETIC_result_t step_record_227_has_value_1589(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 227 is updated */
+SYNTHETIC_result_t step_record_227_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 227 should be saved */
+SYNTHETIC_result_t step_record_227_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 227 should not be duplicated */
+SYNTHETIC_result_t step_record_227_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 228 exists */
+SYNTHETIC_result_t step_record_228_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 228 has value 1596 */
+SYNTHETIC_result_t step_record_228_has_value_1596(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 228 is updated */
+SYNTHETIC_result_t step_record_228_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 228 should be saved */
+SYNTHETIC_result_t step_record_228_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 228 should not be duplicated */
+SYNTHETIC_result_t step_record_228_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 229 exists */
+SYNTHETIC_result_t step_record_229_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 229 has value 1603 */
+SYNTHETIC_result_t step_record_229_has_value_1603(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 229 is updated */
+SYNTHETIC_result_t step_record_229_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 229 should be saved */
+SYNTHETIC_result_t step_record_229_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 229 should not be duplicated */
+SYNTHETIC_result_t step_record_229_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 230 exists */
+SYNTHETIC_result_t step_record_230_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 230 has value 1610 */
+SYNTHETIC_result_t step_record_230_has_value_1610(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 230 is updated */
+SYNTHETIC_result_t step_record_230_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 230 should be saved */
+SYNTHETIC_result_t step_record_230_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 230 should not be duplicated */
+SYNTHETIC_result_t step_record_230_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 231 exists */
+SYNTHETIC_result_t step_record_231_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 231 has value 1617 */
+SYNTHETIC_result_t step_record_231_has_value_1617(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 231 is updated */
+SYNTHETIC_result_t step_record_231_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 231 should be saved */
+SYNTHETIC_result_t step_record_231_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 231 should not be duplicated */
+SYNTHETIC_result_t step_record_231_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 232 exists */
+SYNTHETIC_result_t step_record_232_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 232 has value 1624 */
+SYNTHETIC_result_t step_record_232_has_value_1624(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 232 is updated */
+SYNTHETIC_result_t step_record_232_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 232 should be saved */
+SYNTHETIC_result_t step_record_232_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 232 should not be duplicated */
+SYNTHETIC_result_t step_record_232_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 233 exists */
+SYNTHETIC_result_t step_record_233_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 233 has value 1631 */
+SYNTHETIC_result_t step_record_233_has_value_1631(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 233 is updated */
+SYNTHETIC_result_t step_record_233_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 233 should be saved */
+SYNTHETIC_result_t step_record_233_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 233 should not be duplicated */
+SYNTHETIC_result_t step_record_233_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 234 exists */
+SYNTHETIC_result_t step_record_234_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 234 has value 1638 */
+SYNTHETIC_result_t step_record_234_has_value_1638(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 234 is updated */
+SYNTHETIC_result_t step_record_234_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 234 should be saved */
+SYNTHETIC_result_t step_record_234_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 234 should not be duplicated */
+SYNTHETIC_result_t step_record_234_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 235 exists */
+SYNTHETIC_result_t step_record_235_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 235 has value 1645 */
+SYNTHETIC_result_t step_record_235_has_value_1645(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 235 is updated */
+SYNTHETIC_result_t step_record_235_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 235 should be saved */
+SYNTHETIC_result_t step_record_235_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 235 should not be duplicated */
+SYNTHETIC_result_t step_record_235_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 236 exists */
+SYNTHETIC_result_t step_record_236_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 236 has value 1652 */
+SYNTHETIC_result_t step_record_236_has_value_1652(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 236 is updated */
+SYNTHETIC_result_t step_record_236_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 236 should be saved */
+SYNTHETIC_result_t step_record_236_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 236 should not be duplicated */
+SYNTHETIC_result_t step_record_236_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 237 exists */
+SYNTHETIC_result_t step_record_237_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 237 has value 1659 */
+SYNTHETIC_result_t step_record_237_has_value_1659(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 237 is updated */
+SYNTHETIC_result_t step_record_237_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 237 should be saved */
+SYNTHETIC_result_t step_record_237_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 237 should not be duplicated */
+SYNTHETIC_result_t step_record_237_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 238 exists */
+SYNTHETIC_result_t step_record_238_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 238 has value 1666 */
+SYNTHETIC_result_t step_record_238_has_value_1666(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 238 is updated */
+SYNTHETIC_result_t step_record_238_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 238 should be saved */
+SYNTHETIC_result_t step_record_238_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 238 should not be duplicated */
+SYNTHETIC_result_t step_record_238_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 239 exists */
+SYNTHETIC_result_t step_record_239_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 239 has value 1673 */
+SYNTHETIC_result_t step_record_239_has_value_1673(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 239 is updated */
+SYNTHETIC_result_t step_record_239_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 239 should be saved */
+SYNTHETIC_result_t step_record_239_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 239 should not be duplicated */
+SYNTHETIC_result_t step_record_239_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 240 exists */
+SYNTHETIC_result_t step_record_240_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 240 has value 1680 */
+SYNTHETIC_result_t step_record_240_has_value_1680(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 240 is updated */
+SYNTHETIC_result_t step_record_240_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 240 should be saved */
+SYNTHETIC_result_t step_record_240_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 240 should not be duplicated */
+SYNTHETIC_result_t step_record_240_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 241 exists */
+SYNTHETIC_result_t step_record_241_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 241 has value 1687 */
+SYNTHETIC_result_t step_record_241_has_value_1687(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 241 is updated */
+SYNTHETIC_result_t step_record_241_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 241 should be saved */
+SYNTHETIC_result_t step_record_241_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 241 should not be duplicated */
+SYNTHETIC_result_t step_record_241_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 242 exists */
+SYNTHETIC_result_t step_record_242_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 242 has value 1694 */
+SYNTHETIC_result_t step_record_242_has_value_1694(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 242 is updated */
+SYNTHETIC_result_t step_record_242_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 242 should be saved */
+SYNTHETIC_result_t step_record_242_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 242 should not be duplicated */
+SYNTHETIC_result_t step_record_242_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 243 exists */
+SYNTHETIC_result_t step_record_243_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 243 has value 1701 */
+SYNTHETIC_result_t step_record_243_has_value_1701(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 243 is updated */
+SYNTHETIC_result_t step_record_243_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 243 should be saved */
+SYNTHETIC_result_t step_record_243_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 243 should not be duplicated */
+SYNTHETIC_result_t step_record_243_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 244 exists */
+SYNTHETIC_result_t step_record_244_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 244 has value 1708 */
+SYNTHETIC_result_t step_record_244_has_value_1708(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 244 is updated */
+SYNTHETIC_result_t step_record_244_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 244 should be saved */
+SYNTHETIC_result_t step_record_244_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 244 should not be duplicated */
+SYNTHETIC_result_t step_record_244_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 245 exists */
+SYNTHETIC_result_t step_record_245_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 245 has value 1715 */
+SYNTHETIC_result_t step_record_245_has_value_1715(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 245 is updated */
+SYNTHETIC_result_t step_record_245_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 245 should be saved */
+SYNTHETIC_result_t step_record_245_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 245 should not be duplicated */
+SYNTHETIC_result_t step_record_245_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 246 exists */
+SYNTHETIC_result_t step_record_246_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 246 has value 1722 */
+SYNTHETIC_result_t step_record_246_has_value_1722(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 246 is updated */
+SYNTHETIC_result_t step_record_246_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 246 should be saved */
+SYNTHETIC_result_t step_record_246_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 246 should not be duplicated */
+SYNTHETIC_result_t step_record_246_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 247 exists */
+SYNTHETIC_result_t step_record_247_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 247 has value 1729 */
+SYNTHETIC_result_t step_record_247_has_value_1729(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 247 is updated */
+SYNTHETIC_result_t step_record_247_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 247 should be saved */
+SYNTHETIC_result_t step_record_247_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 247 should not be duplicated */
+SYNTHETIC_result_t step_record_247_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 248 exists */
+SYNTHETIC_result_t step_record_248_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 248 has value 1736 */
+SYNTHETIC_result_t step_record_248_has_value_1736(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 248 is updated */
+SYNTHETIC_result_t step_record_248_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 248 should be saved */
+SYNTHETIC_result_t step_record_248_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 248 should not be duplicated */
+SYNTHETIC_result_t step_record_248_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 249 exists */
+SYNTHETIC_result_t step_record_249_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 249 has value 1743 */
+SYNTHETIC_result_t step_record_249_has_value_1743(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 249 is updated */
+SYNTHETIC_result_t step_record_249_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 249 should be saved */
+SYNTHETIC_result_t step_record_249_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 249 should not be duplicated */
+SYNTHETIC_result_t step_record_249_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 250 exists */
+SYNTHETIC_result_t step_record_250_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 250 has value 1750 */
+SYNTHETIC_result_t step_record_250_has_value_1750(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 250 is updated */
+SYNTHETIC_result_t step_record_250_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 250 should be saved */
+SYNTHETIC_result_t step_record_250_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 250 should not be duplicated */
+SYNTHETIC_result_t step_record_250_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 251 exists */
+SYNTHETIC_result_t step_record_251_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 251 has value 1757 */
+SYNTHETIC_result_t step_record_251_has_value_1757(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 251 is updated */
+SYNTHETIC_result_t step_record_251_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 251 should be saved */
+SYNTHETIC_result_t step_record_251_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 251 should not be duplicated */
+SYNTHETIC_result_t step_record_251_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 252 exists */
+SYNTHETIC_result_t step_record_252_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 252 has value 1764 */
+SYNTHETIC_result_t step_record_252_has_value_1764(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 252 is updated */
+SYNTHETIC_result_t step_record_252_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 252 should be saved */
+SYNTHETIC_result_t step_record_252_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 252 should not be duplicated */
+SYNTHETIC_result_t step_record_252_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 253 exists */
+SYNTHETIC_result_t step_record_253_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 253 has value 1771 */
+SYNTHETIC_result_t step_record_253_has_value_1771(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 253 is updated */
+SYNTHETIC_result_t step_record_253_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 253 should be saved */
+SYNTHETIC_result_t step_record_253_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 253 should not be duplicated */
+SYNTHETIC_result_t step_record_253_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 254 exists */
+SYNTHETIC_result_t step_record_254_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 254 has value 1778 */
+SYNTHETIC_result_t step_record_254_has_value_1778(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 254 is updated */
+SYNTHETIC_result_t step_record_254_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 254 should be saved */
+SYNTHETIC_result_t step_record_254_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 254 should not be duplicated */
+SYNTHETIC_result_t step_record_254_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 255 exists */
+SYNTHETIC_result_t step_record_255_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 255 has value 1785 */
+SYNTHETIC_result_t step_record_255_has_value_1785(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 255 is updated */
+SYNTHETIC_result_t step_record_255_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 255 should be saved */
+SYNTHETIC_result_t step_record_255_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 255 should not be duplicated */
+SYNTHETIC_result_t step_record_255_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 256 exists */
+SYNTHETIC_result_t step_record_256_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 256 has value 1792 */
+SYNTHETIC_result_t step_record_256_has_value_1792(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 256 is updated */
+SYNTHETIC_result_t step_record_256_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 256 should be saved */
+SYNTHETIC_result_t step_record_256_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 256 should not be duplicated */
+SYNTHETIC_result_t step_record_256_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 257 exists */
+SYNTHETIC_result_t step_record_257_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 257 has value 1799 */
+SYNTHETIC_result_t step_record_257_has_value_1799(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 257 is updated */
+SYNTHETIC_result_t step_record_257_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 257 should be saved */
+SYNTHETIC_result_t step_record_257_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 257 should not be duplicated */
+SYNTHETIC_result_t step_record_257_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 258 exists */
+SYNTHETIC_result_t step_record_258_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 258 has value 1806 */
+SYNTHETIC_result_t step_record_258_has_value_1806(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 258 is updated */
+SYNTHETIC_result_t step_record_258_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 258 should be saved */
+SYNTHETIC_result_t step_record_258_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 258 should not be duplicated */
+SYNTHETIC_result_t step_record_258_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 259 exists */
+SYNTHETIC_result_t step_record_259_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 259 has value 1813 */
+SYNTHETIC_result_t step_record_259_has_value_1813(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 259 is updated */
+SYNTHETIC_result_t step_record_259_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 259 should be saved */
+SYNTHETIC_result_t step_record_259_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 259 should not be duplicated */
+SYNTHETIC_result_t step_record_259_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 260 exists */
+SYNTHETIC_result_t step_record_260_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 260 has value 1820 */
+SYNTHETIC_result_t step_record_260_has_value_1820(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 260 is updated */
+SYNTHETIC_result_t step_record_260_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 260 should be saved */
+SYNTHETIC_result_t step_record_260_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 260 should not be duplicated */
+SYNTHETIC_result_t step_record_260_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 261 exists */
+SYNTHETIC_result_t step_record_261_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 261 has value 1827 */
+SYNTHETIC_result_t step_record_261_has_value_1827(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 261 is updated */
+SYNTHETIC_result_t step_record_261_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 261 should be saved */
+SYNTHETIC_result_t step_record_261_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 261 should not be duplicated */
+SYNTHETIC_result_t step_record_261_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 262 exists */
+SYNTHETIC_result_t step_record_262_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 262 has value 1834 */
+SYNTHETIC_result_t step_record_262_has_value_1834(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 262 is updated */
+SYNTHETIC_result_t step_record_262_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 262 should be saved */
+SYNTHETIC_result_t step_record_262_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 262 should not be duplicated */
+SYNTHETIC_result_t step_record_262_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 263 exists */
+SYNTHETIC_result_t step_record_263_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 263 has value 1841 */
+SYNTHETIC_result_t step_record_263_has_value_1841(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 263 is updated */
+SYNTHETIC_result_t step_record_263_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 263 should be saved */
+SYNTHETIC_result_t step_record_263_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 263 should not be duplicated */
+SYNTHETIC_result_t step_record_263_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 264 exists */
+SYNTHETIC_result_t step_record_264_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 264 has value 1848 */
+SYNTHETIC_result_t step_record_264_has_value_1848(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 264 is updated */
+SYNTHETIC_result_t step_record_264_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 264 should be saved */
+SYNTHETIC_result_t step_record_264_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 264 should not be duplicated */
+SYNTHETIC_result_t step_record_264_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 265 exists */
+SYNTHETIC_result_t step_record_265_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 265 has value 1855 */
+SYNTHETIC_result_t step_record_265_has_value_1855(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 265 is updated */
+SYNTHETIC_result_t step_record_265_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 265 should be saved */
+SYNTHETIC_result_t step_record_265_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 265 should not be duplicated */
+SYNTHETIC_result_t step_record_265_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 266 exists */
+SYNTHETIC_result_t step_record_266_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 266 has value 1862 */
+SYNTHETIC_result_t step_record_266_has_value_1862(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 266 is updated */
+SYNTHETIC_result_t step_record_266_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 266 should be saved */
+SYNTHETIC_result_t step_record_266_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 266 should not be duplicated */
+SYNTHETIC_result_t step_record_266_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 267 exists */
+SYNTHETIC_result_t step_record_267_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 267 has value 1869 */
+SYNTHETIC_result_t step_record_267_has_value_1869(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 267 is updated */
+SYNTHETIC_result_t step_record_267_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 267 should be saved */
+SYNTHETIC_result_t step_record_267_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 267 should not be duplicated */
+SYNTHETIC_result_t step_record_267_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 268 exists */
+SYNTHETIC_result_t step_record_268_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 268 has value 1876 */
+SYNTHETIC_result_t step_record_268_has_value_1876(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 268 is updated */
+SYNTHETIC_result_t step_record_268_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 268 should be saved */
+SYNTHETIC_result_t step_record_268_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 268 should not be duplicated */
+SYNTHETIC_result_t step_record_268_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 269 exists */
+SYNTHETIC_result_t step_record_269_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 269 has value 1883 */
+SYNTHETIC_result_t step_record_269_has_value_1883(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 269 is updated */
+SYNTHETIC_result_t step_record_269_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 269 should be saved */
+SYNTHETIC_result_t step_record_269_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 269 should not be duplicated */
+SYNTHETIC_result_t step_record_269_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 270 exists */
+SYNTHETIC_result_t step_record_270_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 270 has value 1890 */
+SYNTHETIC_result_t step_record_270_has_value_1890(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 270 is updated */
+SYNTHETIC_result_t step_record_270_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 270 should be saved */
+SYNTHETIC_result_t step_record_270_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 270 should not be duplicated */
+SYNTHETIC_result_t step_record_270_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 271 exists */
+SYNTHETIC_result_t step_record_271_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 271 has value 1897 */
+SYNTHETIC_result_t step_record_271_has_value_1897(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 271 is updated */
+SYNTHETIC_result_t step_record_271_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 271 should be saved */
+SYNTHETIC_result_t step_record_271_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 271 should not be duplicated */
+SYNTHETIC_result_t step_record_271_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 272 exists */
+SYNTHETIC_result_t step_record_272_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 272 has value 1904 */
+SYNTHETIC_result_t step_record_272_has_value_1904(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 272 is updated */
+SYNTHETIC_result_t step_record_272_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 272 should be saved */
+SYNTHETIC_result_t step_record_272_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 272 should not be duplicated */
+SYNTHETIC_result_t step_record_272_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 273 exists */
+SYNTHETIC_result_t step_record_273_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 273 has value 1911 */
+SYNTHETIC_result_t step_record_273_has_value_1911(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 273 is updated */
+SYNTHETIC_result_t step_record_273_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 273 should be saved */
+SYNTHETIC_result_t step_record_273_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 273 should not be duplicated */
+SYNTHETIC_result_t step_record_273_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 274 exists */
+SYNTHETIC_result_t step_record_274_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 274 has value 1918 */
+SYNTHETIC_result_t step_record_274_has_value_1918(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 274 is updated */
+SYNTHETIC_result_t step_record_274_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 274 should be saved */
+SYNTHETIC_result_t step_record_274_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 274 should not be duplicated */
+SYNTHETIC_result_t step_record_274_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 275 exists */
+SYNTHETIC_result_t step_record_275_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 275 has value 1925 */
+SYNTHETIC_result_t step_record_275_has_value_1925(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 275 is updated */
+SYNTHETIC_result_t step_record_275_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 275 should be saved */
+SYNTHETIC_result_t step_record_275_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 275 should not be duplicated */
+SYNTHETIC_result_t step_record_275_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 276 exists */
+SYNTHETIC_result_t step_record_276_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 276 has value 1932 */
+SYNTHETIC_result_t step_record_276_has_value_1932(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 276 is updated */
+SYNTHETIC_result_t step_record_276_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 276 should be saved */
+SYNTHETIC_result_t step_record_276_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 276 should not be duplicated */
+SYNTHETIC_result_t step_record_276_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 277 exists */
+SYNTHETIC_result_t step_record_277_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 277 has value 1939 */
+SYNTHETIC_result_t step_record_277_has_value_1939(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 277 is updated */
+SYNTHETIC_result_t step_record_277_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 277 should be saved */
+SYNTHETIC_result_t step_record_277_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 277 should not be duplicated */
+SYNTHETIC_result_t step_record_277_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 278 exists */
+SYNTHETIC_result_t step_record_278_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 278 has value 1946 */
+SYNTHETIC_result_t step_record_278_has_value_1946(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 278 is updated */
+SYNTHETIC_result_t step_record_278_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 278 should be saved */
+SYNTHETIC_result_t step_record_278_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 278 should not be duplicated */
+SYNTHETIC_result_t step_record_278_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 279 exists */
+SYNTHETIC_result_t step_record_279_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 279 has value 1953 */
+SYNTHETIC_result_t step_record_279_has_value_1953(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 279 is updated */
+SYNTHETIC_result_t step_record_279_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 279 should be saved */
+SYNTHETIC_result_t step_record_279_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 279 should not be duplicated */
+SYNTHETIC_result_t step_record_279_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 280 exists */
+SYNTHETIC_result_t step_record_280_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 280 has value 1960 */
+SYNTHETIC_result_t step_record_280_has_value_1960(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 280 is updated */
+SYNTHETIC_result_t step_record_280_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 280 should be saved */
+SYNTHETIC_result_t step_record_280_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 280 should not be duplicated */
+SYNTHETIC_result_t step_record_280_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 281 exists */
+SYNTHETIC_result_t step_record_281_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 281 has value 1967 */
+SYNTHETIC_result_t step_record_281_has_value_1967(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 281 is updated */
+SYNTHETIC_result_t step_record_281_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 281 should be saved */
+SYNTHETIC_result_t step_record_281_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 281 should not be duplicated */
+SYNTHETIC_result_t step_record_281_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 282 exists */
+SYNTHETIC_result_t step_record_282_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 282 has value 1974 */
+SYNTHETIC_result_t step_record_282_has_value_1974(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 282 is updated */
+SYNTHETIC_result_t step_record_282_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 282 should be saved */
+SYNTHETIC_result_t step_record_282_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 282 should not be duplicated */
+SYNTHETIC_result_t step_record_282_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 283 exists */
+SYNTHETIC_result_t step_record_283_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 283 has value 1981 */
+SYNTHETIC_result_t step_record_283_has_value_1981(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 283 is updated */
+SYNTHETIC_result_t step_record_283_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 283 should be saved */
+SYNTHETIC_result_t step_record_283_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 283 should not be duplicated */
+SYNTHETIC_result_t step_record_283_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 284 exists */
+SYNTHETIC_result_t step_record_284_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 284 has value 1988 */
+SYNTHETIC_result_t step_record_284_has_value_1988(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 284 is updated */
+SYNTHETIC_result_t step_record_284_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 284 should be saved */
+SYNTHETIC_result_t step_record_284_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 284 should not be duplicated */
+SYNTHETIC_result_t step_record_284_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 285 exists */
+SYNTHETIC_result_t step_record_285_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 285 has value 1995 */
+SYNTHETIC_result_t step_record_285_has_value_1995(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 285 is updated */
+SYNTHETIC_result_t step_record_285_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 285 should be saved */
+SYNTHETIC_result_t step_record_285_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 285 should not be duplicated */
+SYNTHETIC_result_t step_record_285_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 286 exists */
+SYNTHETIC_result_t step_record_286_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 286 has value 2002 */
+SYNTHETIC_result_t step_record_286_has_value_2002(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 286 is updated */
+SYNTHETIC_result_t step_record_286_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 286 should be saved */
+SYNTHETIC_result_t step_record_286_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 286 should not be duplicated */
+SYNTHETIC_result_t step_record_286_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 287 exists */
+SYNTHETIC_result_t step_record_287_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 287 has value 2009 */
+SYNTHETIC_result_t step_record_287_has_value_2009(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 287 is updated */
+SYNTHETIC_result_t step_record_287_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 287 should be saved */
+SYNTHETIC_result_t step_record_287_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 287 should not be duplicated */
+SYNTHETIC_result_t step_record_287_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 288 exists */
+SYNTHETIC_result_t step_record_288_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 288 has value 2016 */
+SYNTHETIC_result_t step_record_288_has_value_2016(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 288 is updated */
+SYNTHETIC_result_t step_record_288_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 288 should be saved */
+SYNTHETIC_result_t step_record_288_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 288 should not be duplicated */
+SYNTHETIC_result_t step_record_288_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 289 exists */
+SYNTHETIC_result_t step_record_289_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 289 has value 2023 */
+SYNTHETIC_result_t step_record_289_has_value_2023(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 289 is updated */
+SYNTHETIC_result_t step_record_289_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 289 should be saved */
+SYNTHETIC_result_t step_record_289_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 289 should not be duplicated */
+SYNTHETIC_result_t step_record_289_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 290 exists */
+SYNTHETIC_result_t step_record_290_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 290 has value 2030 */
+SYNTHETIC_result_t step_record_290_has_value_2030(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 290 is updated */
+SYNTHETIC_result_t step_record_290_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 290 should be saved */
+SYNTHETIC_result_t step_record_290_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 290 should not be duplicated */
+SYNTHETIC_result_t step_record_290_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 291 exists */
+SYNTHETIC_result_t step_record_291_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 291 has value 2037 */
+SYNTHETIC_result_t step_record_291_has_value_2037(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 291 is updated */
+SYNTHETIC_result_t step_record_291_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 291 should be saved */
+SYNTHETIC_result_t step_record_291_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 291 should not be duplicated */
+SYNTHETIC_result_t step_record_291_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 292 exists */
+SYNTHETIC_result_t step_record_292_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 292 has value 2044 */
+SYNTHETIC_result_t step_record_292_has_value_2044(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 292 is updated */
+SYNTHETIC_result_t step_record_292_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 292 should be saved */
+SYNTHETIC_result_t step_record_292_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 292 should not be duplicated */
+SYNTHETIC_result_t step_record_292_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 293 exists */
+SYNTHETIC_result_t step_record_293_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 293 has value 2051 */
+SYNTHETIC_result_t step_record_293_has_value_2051(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 293 is updated */
+SYNTHETIC_result_t step_record_293_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 293 should be saved */
+SYNTHETIC_result_t step_record_293_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 293 should not be duplicated */
+SYNTHETIC_result_t step_record_293_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 294 exists */
+SYNTHETIC_result_t step_record_294_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 294 has value 2058 */
+SYNTHETIC_result_t step_record_294_has_value_2058(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 294 is updated */
+SYNTHETIC_result_t step_record_294_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 294 should be saved */
+SYNTHETIC_result_t step_record_294_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 294 should not be duplicated */
+SYNTHETIC_result_t step_record_294_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 295 exists */
+SYNTHETIC_result_t step_record_295_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 295 has value 2065 */
+SYNTHETIC_result_t step_record_295_has_value_2065(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 295 is updated */
+SYNTHETIC_result_t step_record_295_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 295 should be saved */
+SYNTHETIC_result_t step_record_295_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 295 should not be duplicated */
+SYNTHETIC_result_t step_record_295_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 296 exists */
+SYNTHETIC_result_t step_record_296_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 296 has value 2072 */
+SYNTHETIC_result_t step_record_296_has_value_2072(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 296 is updated */
+SYNTHETIC_result_t step_record_296_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 296 should be saved */
+SYNTHETIC_result_t step_record_296_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 296 should not be duplicated */
+SYNTHETIC_result_t step_record_296_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 297 exists */
+SYNTHETIC_result_t step_record_297_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 297 has value 2079 */
+SYNTHETIC_result_t step_record_297_has_value_2079(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 297 is updated */
+SYNTHETIC_result_t step_record_297_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 297 should be saved */
+SYNTHETIC_result_t step_record_297_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 297 should not be duplicated */
+SYNTHETIC_result_t step_record_297_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 298 exists */
+SYNTHETIC_result_t step_record_298_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 298 has value 2086 */
+SYNTHETIC_result_t step_record_298_has_value_2086(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 298 is updated */
+SYNTHETIC_result_t step_record_298_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 298 should be saved */
+SYNTHETIC_result_t step_record_298_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 298 should not be duplicated */
+SYNTHETIC_result_t step_record_298_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 299 exists */
+SYNTHETIC_result_t step_record_299_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 299 has value 2093 */
+SYNTHETIC_result_t step_record_299_has_value_2093(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 299 is updated */
+SYNTHETIC_result_t step_record_299_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 299 should be saved */
+SYNTHETIC_result_t step_record_299_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 299 should not be duplicated */
+SYNTHETIC_result_t step_record_299_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 300 exists */
+SYNTHETIC_result_t step_record_300_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 300 has value 2100 */
+SYNTHETIC_result_t step_record_300_has_value_2100(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 300 is updated */
+SYNTHETIC_result_t step_record_300_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 300 should be saved */
+SYNTHETIC_result_t step_record_300_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 300 should not be duplicated */
+SYNTHETIC_result_t step_record_300_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 301 exists */
+SYNTHETIC_result_t step_record_301_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 301 has value 2107 */
+SYNTHETIC_result_t step_record_301_has_value_2107(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 301 is updated */
+SYNTHETIC_result_t step_record_301_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 301 should be saved */
+SYNTHETIC_result_t step_record_301_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 301 should not be duplicated */
+SYNTHETIC_result_t step_record_301_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 302 exists */
+SYNTHETIC_result_t step_record_302_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 302 has value 2114 */
+SYNTHETIC_result_t step_record_302_has_value_2114(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 302 is updated */
+SYNTHETIC_result_t step_record_302_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 302 should be saved */
+SYNTHETIC_result_t step_record_302_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 302 should not be duplicated */
+SYNTHETIC_result_t step_record_302_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 303 exists */
+SYNTHETIC_result_t step_record_303_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 303 has value 2121 */
+SYNTHETIC_result_t step_record_303_has_value_2121(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 303 is updated */
+SYNTHETIC_result_t step_record_303_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 303 should be saved */
+SYNTHETIC_result_t step_record_303_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 303 should not be duplicated */
+SYNTHETIC_result_t step_record_303_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 304 exists */
+SYNTHETIC_result_t step_record_304_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 304 has value 2128 */
+SYNTHETIC_result_t step_record_304_has_value_2128(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 304 is updated */
+SYNTHETIC_result_t step_record_304_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 304 should be saved */
+SYNTHETIC_result_t step_record_304_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 304 should not be duplicated */
+SYNTHETIC_result_t step_record_304_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 305 exists */
+SYNTHETIC_result_t step_record_305_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 305 has value 2135 */
+SYNTHETIC_result_t step_record_305_has_value_2135(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 305 is updated */
+SYNTHETIC_result_t step_record_305_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 305 should be saved */
+SYNTHETIC_result_t step_record_305_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 305 should not be duplicated */
+SYNTHETIC_result_t step_record_305_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 306 exists */
+SYNTHETIC_result_t step_record_306_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 306 has value 2142 */
+SYNTHETIC_result_t step_record_306_has_value_2142(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 306 is updated */
+SYNTHETIC_result_t step_record_306_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 306 should be saved */
+SYNTHETIC_result_t step_record_306_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 306 should not be duplicated */
+SYNTHETIC_result_t step_record_306_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 307 exists */
+SYNTHETIC_result_t step_record_307_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 307 has value 2149 */
+SYNTHETIC_result_t step_record_307_has_value_2149(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 307 is updated */
+SYNTHETIC_result_t step_record_307_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 307 should be saved */
+SYNTHETIC_result_t step_record_307_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 307 should not be duplicated */
+SYNTHETIC_result_t step_record_307_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 308 exists */
+SYNTHETIC_result_t step_record_308_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 308 has value 2156 */
+SYNTHETIC_result_t step_record_308_has_value_2156(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 308 is updated */
+SYNTHETIC_result_t step_record_308_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 308 should be saved */
+SYNTHETIC_result_t step_record_308_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 308 should not be duplicated */
+SYNTHETIC_result_t step_record_308_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 309 exists */
+SYNTHETIC_result_t step_record_309_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 309 has value 2163 */
+SYNTHETIC_result_t step_record_309_has_value_2163(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 309 is updated */
+SYNTHETIC_result_t step_record_309_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 309 should be saved */
+SYNTHETIC_result_t step_record_309_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 309 should not be duplicated */
+SYNTHETIC_result_t step_record_309_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 310 exists */
+SYNTHETIC_result_t step_record_310_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 310 has value 2170 */
+SYNTHETIC_result_t step_record_310_has_value_2170(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 310 is updated */
+SYNTHETIC_result_t step_record_310_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 310 should be saved */
+SYNTHETIC_result_t step_record_310_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 310 should not be duplicated */
+SYNTHETIC_result_t step_record_310_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 311 exists */
+SYNTHETIC_result_t step_record_311_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 311 has value 2177 */
+SYNTHETIC_result_t step_record_311_has_value_2177(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 311 is updated */
+SYNTHETIC_result_t step_record_311_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 311 should be saved */
+SYNTHETIC_result_t step_record_311_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 311 should not be duplicated */
+SYNTHETIC_result_t step_record_311_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 312 exists */
+SYNTHETIC_result_t step_record_312_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 312 has value 2184 */
+SYNTHETIC_result_t step_record_312_has_value_2184(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 312 is updated */
+SYNTHETIC_result_t step_record_312_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 312 should be saved */
+SYNTHETIC_result_t step_record_312_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 312 should not be duplicated */
+SYNTHETIC_result_t step_record_312_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 313 exists */
+SYNTHETIC_result_t step_record_313_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 313 has value 2191 */
+SYNTHETIC_result_t step_record_313_has_value_2191(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 313 is updated */
+SYNTHETIC_result_t step_record_313_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 313 should be saved */
+SYNTHETIC_result_t step_record_313_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 313 should not be duplicated */
+SYNTHETIC_result_t step_record_313_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 314 exists */
+SYNTHETIC_result_t step_record_314_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 314 has value 2198 */
+SYNTHETIC_result_t step_record_314_has_value_2198(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 314 is updated */
+SYNTHETIC_result_t step_record_314_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 314 should be saved */
+SYNTHETIC_result_t step_record_314_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 314 should not be duplicated */
+SYNTHETIC_result_t step_record_314_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 315 exists */
+SYNTHETIC_result_t step_record_315_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 315 has value 2205 */
+SYNTHETIC_result_t step_record_315_has_value_2205(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 315 is updated */
+SYNTHETIC_result_t step_record_315_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 315 should be saved */
+SYNTHETIC_result_t step_record_315_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 315 should not be duplicated */
+SYNTHETIC_result_t step_record_315_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 316 exists */
+SYNTHETIC_result_t step_record_316_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 316 has value 2212 */
+SYNTHETIC_result_t step_record_316_has_value_2212(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 316 is updated */
+SYNTHETIC_result_t step_record_316_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 316 should be saved */
+SYNTHETIC_result_t step_record_316_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 316 should not be duplicated */
+SYNTHETIC_result_t step_record_316_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 317 exists */
+SYNTHETIC_result_t step_record_317_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 317 has value 2219 */
+SYNTHETIC_result_t step_record_317_has_value_2219(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 317 is updated */
+SYNTHETIC_result_t step_record_317_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 317 should be saved */
+SYNTHETIC_result_t step_record_317_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 317 should not be duplicated */
+SYNTHETIC_result_t step_record_317_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 318 exists */
+SYNTHETIC_result_t step_record_318_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 318 has value 2226 */
+SYNTHETIC_result_t step_record_318_has_value_2226(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 318 is updated */
+SYNTHETIC_result_t step_record_318_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 318 should be saved */
+SYNTHETIC_result_t step_record_318_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 318 should not be duplicated */
+SYNTHETIC_result_t step_record_318_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 319 exists */
+SYNTHETIC_result_t step_record_319_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 319 has value 2233 */
+SYNTHETIC_result_t step_record_319_has_value_2233(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 319 is updated */
+SYNTHETIC_result_t step_record_319_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 319 should be saved */
+SYNTHETIC_result_t step_record_319_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 319 should not be duplicated */
+SYNTHETIC_result_t step_record_319_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 320 exists */
+SYNTHETIC_result_t step_record_320_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 320 has value 2240 */
+SYNTHETIC_result_t step_record_320_has_value_2240(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 320 is updated */
+SYNTHETIC_result_t step_record_320_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 320 should be saved */
+SYNTHETIC_result_t step_record_320_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 320 should not be duplicated */
+SYNTHETIC_result_t step_record_320_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 321 exists */
+SYNTHETIC_result_t step_record_321_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 321 has value 2247 */
+SYNTHETIC_result_t step_record_321_has_value_2247(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 321 is updated */
+SYNTHETIC_result_t step_record_321_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 321 should be saved */
+SYNTHETIC_result_t step_record_321_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 321 should not be duplicated */
+SYNTHETIC_result_t step_record_321_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 322 exists */
+SYNTHETIC_result_t step_record_322_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 322 has value 2254 */
+SYNTHETIC_result_t step_record_322_has_value_2254(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 322 is updated */
+SYNTHETIC_result_t step_record_322_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 322 should be saved */
+SYNTHETIC_result_t step_record_322_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 322 should not be duplicated */
+SYNTHETIC_result_t step_record_322_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 323 exists */
+SYNTHETIC_result_t step_record_323_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 323 has value 2261 */
+SYNTHETIC_result_t step_record_323_has_value_2261(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 323 is updated */
+SYNTHETIC_result_t step_record_323_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 323 should be saved */
+SYNTHETIC_result_t step_record_323_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 323 should not be duplicated */
+SYNTHETIC_result_t step_record_323_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 324 exists */
+SYNTHETIC_result_t step_record_324_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 324 has value 2268 */
+SYNTHETIC_result_t step_record_324_has_value_2268(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 324 is updated */
+SYNTHETIC_result_t step_record_324_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 324 should be saved */
+SYNTHETIC_result_t step_record_324_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 324 should not be duplicated */
+SYNTHETIC_result_t step_record_324_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 325 exists */
+SYNTHETIC_result_t step_record_325_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 325 has value 2275 */
+SYNTHETIC_result_t step_record_325_has_value_2275(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 325 is updated */
+SYNTHETIC_result_t step_record_325_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 325 should be saved */
+SYNTHETIC_result_t step_record_325_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 325 should not be duplicated */
+SYNTHETIC_result_t step_record_325_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 326 exists */
+SYNTHETIC_result_t step_record_326_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 326 has value 2282 */
+SYNTHETIC_result_t step_record_326_has_value_2282(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 326 is updated */
+SYNTHETIC_result_t step_record_326_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 326 should be saved */
+SYNTHETIC_result_t step_record_326_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 326 should not be duplicated */
+SYNTHETIC_result_t step_record_326_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 327 exists */
+SYNTHETIC_result_t step_record_327_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 327 has value 2289 */
+SYNTHETIC_result_t step_record_327_has_value_2289(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 327 is updated */
+SYNTHETIC_result_t step_record_327_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 327 should be saved */
+SYNTHETIC_result_t step_record_327_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 327 should not be duplicated */
+SYNTHETIC_result_t step_record_327_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 328 exists */
+SYNTHETIC_result_t step_record_328_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 328 has value 2296 */
+SYNTHETIC_result_t step_record_328_has_value_2296(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 328 is updated */
+SYNTHETIC_result_t step_record_328_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 328 should be saved */
+SYNTHETIC_result_t step_record_328_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 328 should not be duplicated */
+SYNTHETIC_result_t step_record_328_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 329 exists */
+SYNTHETIC_result_t step_record_329_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 329 has value 2303 */
+SYNTHETIC_result_t step_record_329_has_value_2303(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 329 is updated */
+SYNTHETIC_result_t step_record_329_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 329 should be saved */
+SYNTHETIC_result_t step_record_329_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 329 should not be duplicated */
+SYNTHETIC_result_t step_record_329_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 330 exists */
+SYNTHETIC_result_t step_record_330_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 330 has value 2310 */
+SYNTHETIC_result_t step_record_330_has_value_2310(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 330 is updated */
+SYNTHETIC_result_t step_record_330_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 330 should be saved */
+SYNTHETIC_result_t step_record_330_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 330 should not be duplicated */
+SYNTHETIC_result_t step_record_330_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 331 exists */
+SYNTHETIC_result_t step_record_331_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 331 has value 2317 */
+SYNTHETIC_result_t step_record_331_has_value_2317(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 331 is updated */
+SYNTHETIC_result_t step_record_331_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 331 should be saved */
+SYNTHETIC_result_t step_record_331_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 331 should not be duplicated */
+SYNTHETIC_result_t step_record_331_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 332 exists */
+SYNTHETIC_result_t step_record_332_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 332 has value 2324 */
+SYNTHETIC_result_t step_record_332_has_value_2324(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 332 is updated */
+SYNTHETIC_result_t step_record_332_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 332 should be saved */
+SYNTHETIC_result_t step_record_332_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 332 should not be duplicated */
+SYNTHETIC_result_t step_record_332_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 333 exists */
+SYNTHETIC_result_t step_record_333_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 333 has value 2331 */
+SYNTHETIC_result_t step_record_333_has_value_2331(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 333 is updated */
+SYNTHETIC_result_t step_record_333_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 333 should be saved */
+SYNTHETIC_result_t step_record_333_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 333 should not be duplicated */
+SYNTHETIC_result_t step_record_333_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 334 exists */
+SYNTHETIC_result_t step_record_334_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 334 has value 2338 */
+SYNTHETIC_result_t step_record_334_has_value_2338(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 334 is updated */
+SYNTHETIC_result_t step_record_334_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 334 should be saved */
+SYNTHETIC_result_t step_record_334_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 334 should not be duplicated */
+SYNTHETIC_result_t step_record_334_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 335 exists */
+SYNTHETIC_result_t step_record_335_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 335 has value 2345 */
+SYNTHETIC_result_t step_record_335_has_value_2345(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 335 is updated */
+SYNTHETIC_result_t step_record_335_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 335 should be saved */
+SYNTHETIC_result_t step_record_335_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 335 should not be duplicated */
+SYNTHETIC_result_t step_record_335_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 336 exists */
+SYNTHETIC_result_t step_record_336_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 336 has value 2352 */
+SYNTHETIC_result_t step_record_336_has_value_2352(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 336 is updated */
+SYNTHETIC_result_t step_record_336_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 336 should be saved */
+SYNTHETIC_result_t step_record_336_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 336 should not be duplicated */
+SYNTHETIC_result_t step_record_336_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 337 exists */
+SYNTHETIC_result_t step_record_337_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 337 has value 2359 */
+SYNTHETIC_result_t step_record_337_has_value_2359(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 337 is updated */
+SYNTHETIC_result_t step_record_337_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 337 should be saved */
+SYNTHETIC_result_t step_record_337_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 337 should not be duplicated */
+SYNTHETIC_result_t step_record_337_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 338 exists */
+SYNTHETIC_result_t step_record_338_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 338 has value 2366 */
+SYNTHETIC_result_t step_record_338_has_value_2366(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 338 is updated */
+SYNTHETIC_result_t step_record_338_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 338 should be saved */
+SYNTHETIC_result_t step_record_338_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 338 should not be duplicated */
+SYNTHETIC_result_t step_record_338_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 339 exists */
+SYNTHETIC_result_t step_record_339_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 339 has value 2373 */
+SYNTHETIC_result_t step_record_339_has_value_2373(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 339 is updated */
+SYNTHETIC_result_t step_record_339_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 339 should be saved */
+SYNTHETIC_result_t step_record_339_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 339 should not be duplicated */
+SYNTHETIC_result_t step_record_339_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 340 exists */
+SYNTHETIC_result_t step_record_340_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 340 has value 2380 */
+SYNTHETIC_result_t step_record_340_has_value_2380(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 340 is updated */
+SYNTHETIC_result_t step_record_340_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 340 should be saved */
+SYNTHETIC_result_t step_record_340_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 340 should not be duplicated */
+SYNTHETIC_result_t step_record_340_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 341 exists */
+SYNTHETIC_result_t step_record_341_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 341 has value 2387 */
+SYNTHETIC_result_t step_record_341_has_value_2387(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 341 is updated */
+SYNTHETIC_result_t step_record_341_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 341 should be saved */
+SYNTHETIC_result_t step_record_341_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 341 should not be duplicated */
+SYNTHETIC_result_t step_record_341_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 342 exists */
+SYNTHETIC_result_t step_record_342_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 342 has value 2394 */
+SYNTHETIC_result_t step_record_342_has_value_2394(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 342 is updated */
+SYNTHETIC_result_t step_record_342_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 342 should be saved */
+SYNTHETIC_result_t step_record_342_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 342 should not be duplicated */
+SYNTHETIC_result_t step_record_342_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 343 exists */
+SYNTHETIC_result_t step_record_343_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 343 has value 2401 */
+SYNTHETIC_result_t step_record_343_has_value_2401(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 343 is updated */
+SYNTHETIC_result_t step_record_343_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 343 should be saved */
+SYNTHETIC_result_t step_record_343_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 343 should not be duplicated */
+SYNTHETIC_result_t step_record_343_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 344 exists */
+SYNTHETIC_result_t step_record_344_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 344 has value 2408 */
+SYNTHETIC_result_t step_record_344_has_value_2408(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 344 is updated */
+SYNTHETIC_result_t step_record_344_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 344 should be saved */
+SYNTHETIC_result_t step_record_344_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 344 should not be duplicated */
+SYNTHETIC_result_t step_record_344_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 345 exists */
+SYNTHETIC_result_t step_record_345_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 345 has value 2415 */
+SYNTHETIC_result_t step_record_345_has_value_2415(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 345 is updated */
+SYNTHETIC_result_t step_record_345_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 345 should be saved */
+SYNTHETIC_result_t step_record_345_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 345 should not be duplicated */
+SYNTHETIC_result_t step_record_345_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 346 exists */
+SYNTHETIC_result_t step_record_346_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 346 has value 2422 */
+SYNTHETIC_result_t step_record_346_has_value_2422(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 346 is updated */
+SYNTHETIC_result_t step_record_346_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 346 should be saved */
+SYNTHETIC_result_t step_record_346_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 346 should not be duplicated */
+SYNTHETIC_result_t step_record_346_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 347 exists */
+SYNTHETIC_result_t step_record_347_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 347 has value 2429 */
+SYNTHETIC_result_t step_record_347_has_value_2429(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 347 is updated */
+SYNTHETIC_result_t step_record_347_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 347 should be saved */
+SYNTHETIC_result_t step_record_347_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 347 should not be duplicated */
+SYNTHETIC_result_t step_record_347_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 348 exists */
+SYNTHETIC_result_t step_record_348_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 348 has value 2436 */
+SYNTHETIC_result_t step_record_348_has_value_2436(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 348 is updated */
+SYNTHETIC_result_t step_record_348_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 348 should be saved */
+SYNTHETIC_result_t step_record_348_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 348 should not be duplicated */
+SYNTHETIC_result_t step_record_348_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 349 exists */
+SYNTHETIC_result_t step_record_349_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 349 has value 2443 */
+SYNTHETIC_result_t step_record_349_has_value_2443(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 349 is updated */
+SYNTHETIC_result_t step_record_349_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 349 should be saved */
+SYNTHETIC_result_t step_record_349_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 349 should not be duplicated */
+SYNTHETIC_result_t step_record_349_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 350 exists */
+SYNTHETIC_result_t step_record_350_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 350 has value 2450 */
+SYNTHETIC_result_t step_record_350_has_value_2450(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 350 is updated */
+SYNTHETIC_result_t step_record_350_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 350 should be saved */
+SYNTHETIC_result_t step_record_350_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 350 should not be duplicated */
+SYNTHETIC_result_t step_record_350_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 351 exists */
+SYNTHETIC_result_t step_record_351_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 351 has value 2457 */
+SYNTHETIC_result_t step_record_351_has_value_2457(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 351 is updated */
+SYNTHETIC_result_t step_record_351_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 351 should be saved */
+SYNTHETIC_result_t step_record_351_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 351 should not be duplicated */
+SYNTHETIC_result_t step_record_351_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 352 exists */
+SYNTHETIC_result_t step_record_352_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 352 has value 2464 */
+SYNTHETIC_result_t step_record_352_has_value_2464(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 352 is updated */
+SYNTHETIC_result_t step_record_352_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 352 should be saved */
+SYNTHETIC_result_t step_record_352_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 352 should not be duplicated */
+SYNTHETIC_result_t step_record_352_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 353 exists */
+SYNTHETIC_result_t step_record_353_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 353 has value 2471 */
+SYNTHETIC_result_t step_record_353_has_value_2471(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 353 is updated */
+SYNTHETIC_result_t step_record_353_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 353 should be saved */
+SYNTHETIC_result_t step_record_353_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 353 should not be duplicated */
+SYNTHETIC_result_t step_record_353_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 354 exists */
+SYNTHETIC_result_t step_record_354_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 354 has value 2478 */
+SYNTHETIC_result_t step_record_354_has_value_2478(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 354 is updated */
+SYNTHETIC_result_t step_record_354_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 354 should be saved */
+SYNTHETIC_result_t step_record_354_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 354 should not be duplicated */
+SYNTHETIC_result_t step_record_354_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 355 exists */
+SYNTHETIC_result_t step_record_355_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 355 has value 2485 */
+SYNTHETIC_result_t step_record_355_has_value_2485(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 355 is updated */
+SYNTHETIC_result_t step_record_355_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 355 should be saved */
+SYNTHETIC_result_t step_record_355_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 355 should not be duplicated */
+SYNTHETIC_result_t step_record_355_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 356 exists */
+SYNTHETIC_result_t step_record_356_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 356 has value 2492 */
+SYNTHETIC_result_t step_record_356_has_value_2492(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 356 is updated */
+SYNTHETIC_result_t step_record_356_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 356 should be saved */
+SYNTHETIC_result_t step_record_356_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 356 should not be duplicated */
+SYNTHETIC_result_t step_record_356_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 357 exists */
+SYNTHETIC_result_t step_record_357_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 357 has value 2499 */
+SYNTHETIC_result_t step_record_357_has_value_2499(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 357 is updated */
+SYNTHETIC_result_t step_record_357_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 357 should be saved */
+SYNTHETIC_result_t step_record_357_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 357 should not be duplicated */
+SYNTHETIC_result_t step_record_357_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 358 exists */
+SYNTHETIC_result_t step_record_358_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 358 has value 2506 */
+SYNTHETIC_result_t step_record_358_has_value_2506(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 358 is updated */
+SYNTHETIC_result_t step_record_358_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 358 should be saved */
+SYNTHETIC_result_t step_record_358_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 358 should not be duplicated */
+SYNTHETIC_result_t step_record_358_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 359 exists */
+SYNTHETIC_result_t step_record_359_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 359 has value 2513 */
+SYNTHETIC_result_t step_record_359_has_value_2513(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 359 is updated */
+SYNTHETIC_result_t step_record_359_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 359 should be saved */
+SYNTHETIC_result_t step_record_359_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 359 should not be duplicated */
+SYNTHETIC_result_t step_record_359_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 360 exists */
+SYNTHETIC_result_t step_record_360_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 360 has value 2520 */
+SYNTHETIC_result_t step_record_360_has_value_2520(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 360 is updated */
+SYNTHETIC_result_t step_record_360_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 360 should be saved */
+SYNTHETIC_result_t step_record_360_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 360 should not be duplicated */
+SYNTHETIC_result_t step_record_360_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 361 exists */
+SYNTHETIC_result_t step_record_361_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 361 has value 2527 */
+SYNTHETIC_result_t step_record_361_has_value_2527(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 361 is updated */
+SYNTHETIC_result_t step_record_361_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 361 should be saved */
+SYNTHETIC_result_t step_record_361_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 361 should not be duplicated */
+SYNTHETIC_result_t step_record_361_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 362 exists */
+SYNTHETIC_result_t step_record_362_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 362 has value 2534 */
+SYNTHETIC_result_t step_record_362_has_value_2534(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 362 is updated */
+SYNTHETIC_result_t step_record_362_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 362 should be saved */
+SYNTHETIC_result_t step_record_362_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 362 should not be duplicated */
+SYNTHETIC_result_t step_record_362_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 363 exists */
+SYNTHETIC_result_t step_record_363_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 363 has value 2541 */
+SYNTHETIC_result_t step_record_363_has_value_2541(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 363 is updated */
+SYNTHETIC_result_t step_record_363_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 363 should be saved */
+SYNTHETIC_result_t step_record_363_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 363 should not be duplicated */
+SYNTHETIC_result_t step_record_363_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 364 exists */
+SYNTHETIC_result_t step_record_364_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 364 has value 2548 */
+SYNTHETIC_result_t step_record_364_has_value_2548(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 364 is updated */
+SYNTHETIC_result_t step_record_364_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 364 should be saved */
+SYNTHETIC_result_t step_record_364_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 364 should not be duplicated */
+SYNTHETIC_result_t step_record_364_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 365 exists */
+SYNTHETIC_result_t step_record_365_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 365 has value 2555 */
+SYNTHETIC_result_t step_record_365_has_value_2555(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 365 is updated */
+SYNTHETIC_result_t step_record_365_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 365 should be saved */
+SYNTHETIC_result_t step_record_365_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 365 should not be duplicated */
+SYNTHETIC_result_t step_record_365_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 366 exists */
+SYNTHETIC_result_t step_record_366_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 366 has value 2562 */
+SYNTHETIC_result_t step_record_366_has_value_2562(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 366 is updated */
+SYNTHETIC_result_t step_record_366_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 366 should be saved */
+SYNTHETIC_result_t step_record_366_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 366 should not be duplicated */
+SYNTHETIC_result_t step_record_366_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 367 exists */
+SYNTHETIC_result_t step_record_367_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 367 has value 2569 */
+SYNTHETIC_result_t step_record_367_has_value_2569(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 367 is updated */
+SYNTHETIC_result_t step_record_367_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 367 should be saved */
+SYNTHETIC_result_t step_record_367_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 367 should not be duplicated */
+SYNTHETIC_result_t step_record_367_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 368 exists */
+SYNTHETIC_result_t step_record_368_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 368 has value 2576 */
+SYNTHETIC_result_t step_record_368_has_value_2576(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 368 is updated */
+SYNTHETIC_result_t step_record_368_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 368 should be saved */
+SYNTHETIC_result_t step_record_368_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 368 should not be duplicated */
+SYNTHETIC_result_t step_record_368_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 369 exists */
+SYNTHETIC_result_t step_record_369_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 369 has value 2583 */
+SYNTHETIC_result_t step_record_369_has_value_2583(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 369 is updated */
+SYNTHETIC_result_t step_record_369_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 369 should be saved */
+SYNTHETIC_result_t step_record_369_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 369 should not be duplicated */
+SYNTHETIC_result_t step_record_369_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 370 exists */
+SYNTHETIC_result_t step_record_370_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 370 has value 2590 */
+SYNTHETIC_result_t step_record_370_has_value_2590(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 370 is updated */
+SYNTHETIC_result_t step_record_370_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 370 should be saved */
+SYNTHETIC_result_t step_record_370_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 370 should not be duplicated */
+SYNTHETIC_result_t step_record_370_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 371 exists */
+SYNTHETIC_result_t step_record_371_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 371 has value 2597 */
+SYNTHETIC_result_t step_record_371_has_value_2597(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 371 is updated */
+SYNTHETIC_result_t step_record_371_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 371 should be saved */
+SYNTHETIC_result_t step_record_371_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 371 should not be duplicated */
+SYNTHETIC_result_t step_record_371_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 372 exists */
+SYNTHETIC_result_t step_record_372_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 372 has value 2604 */
+SYNTHETIC_result_t step_record_372_has_value_2604(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 372 is updated */
+SYNTHETIC_result_t step_record_372_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 372 should be saved */
+SYNTHETIC_result_t step_record_372_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 372 should not be duplicated */
+SYNTHETIC_result_t step_record_372_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 373 exists */
+SYNTHETIC_result_t step_record_373_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 373 has value 2611 */
+SYNTHETIC_result_t step_record_373_has_value_2611(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 373 is updated */
+SYNTHETIC_result_t step_record_373_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 373 should be saved */
+SYNTHETIC_result_t step_record_373_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 373 should not be duplicated */
+SYNTHETIC_result_t step_record_373_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 374 exists */
+SYNTHETIC_result_t step_record_374_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 374 has value 2618 */
+SYNTHETIC_result_t step_record_374_has_value_2618(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 374 is updated */
+SYNTHETIC_result_t step_record_374_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 374 should be saved */
+SYNTHETIC_result_t step_record_374_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 374 should not be duplicated */
+SYNTHETIC_result_t step_record_374_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 375 exists */
+SYNTHETIC_result_t step_record_375_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 375 has value 2625 */
+SYNTHETIC_result_t step_record_375_has_value_2625(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 375 is updated */
+SYNTHETIC_result_t step_record_375_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 375 should be saved */
+SYNTHETIC_result_t step_record_375_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 375 should not be duplicated */
+SYNTHETIC_result_t step_record_375_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 376 exists */
+SYNTHETIC_result_t step_record_376_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 376 has value 2632 */
+SYNTHETIC_result_t step_record_376_has_value_2632(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 376 is updated */
+SYNTHETIC_result_t step_record_376_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 376 should be saved */
+SYNTHETIC_result_t step_record_376_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 376 should not be duplicated */
+SYNTHETIC_result_t step_record_376_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 377 exists */
+SYNTHETIC_result_t step_record_377_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 377 has value 2639 */
+SYNTHETIC_result_t step_record_377_has_value_2639(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 377 is updated */
+SYNTHETIC_result_t step_record_377_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 377 should be saved */
+SYNTHETIC_result_t step_record_377_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 377 should not be duplicated */
+SYNTHETIC_result_t step_record_377_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 378 exists */
+SYNTHETIC_result_t step_record_378_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 378 has value 2646 */
+SYNTHETIC_result_t step_record_378_has_value_2646(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 378 is updated */
+SYNTHETIC_result_t step_record_378_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 378 should be saved */
+SYNTHETIC_result_t step_record_378_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 378 should not be duplicated */
+SYNTHETIC_result_t step_record_378_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 379 exists */
+SYNTHETIC_result_t step_record_379_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 379 has value 2653 */
+SYNTHETIC_result_t step_record_379_has_value_2653(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 379 is updated */
+SYNTHETIC_result_t step_record_379_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 379 should be saved */
+SYNTHETIC_result_t step_record_379_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 379 should not be duplicated */
+SYNTHETIC_result_t step_record_379_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 380 exists */
+SYNTHETIC_result_t step_record_380_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 380 has value 2660 */
+SYNTHETIC_result_t step_record_380_has_value_2660(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 380 is updated */
+SYNTHETIC_result_t step_record_380_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 380 should be saved */
+SYNTHETIC_result_t step_record_380_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 380 should not be duplicated */
+SYNTHETIC_result_t step_record_380_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 381 exists */
+SYNTHETIC_result_t step_record_381_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 381 has value 2667 */
+SYNTHETIC_result_t step_record_381_has_value_2667(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 381 is updated */
+SYNTHETIC_result_t step_record_381_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 381 should be saved */
+SYNTHETIC_result_t step_record_381_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 381 should not be duplicated */
+SYNTHETIC_result_t step_record_381_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 382 exists */
+SYNTHETIC_result_t step_record_382_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 382 has value 2674 */
+SYNTHETIC_result_t step_record_382_has_value_2674(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 382 is updated */
+SYNTHETIC_result_t step_record_382_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 382 should be saved */
+SYNTHETIC_result_t step_record_382_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 382 should not be duplicated */
+SYNTHETIC_result_t step_record_382_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 383 exists */
+SYNTHETIC_result_t step_record_383_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 383 has value 2681 */
+SYNTHETIC_result_t step_record_383_has_value_2681(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 383 is updated */
+SYNTHETIC_result_t step_record_383_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 383 should be saved */
+SYNTHETIC_result_t step_record_383_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 383 should not be duplicated */
+SYNTHETIC_result_t step_record_383_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 384 exists */
+SYNTHETIC_result_t step_record_384_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 384 has value 2688 */
+SYNTHETIC_result_t step_record_384_has_value_2688(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 384 is updated */
+SYNTHETIC_result_t step_record_384_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 384 should be saved */
+SYNTHETIC_result_t step_record_384_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 384 should not be duplicated */
+SYNTHETIC_result_t step_record_384_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 385 exists */
+SYNTHETIC_result_t step_record_385_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 385 has value 2695 */
+SYNTHETIC_result_t step_record_385_has_value_2695(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 385 is updated */
+SYNTHETIC_result_t step_record_385_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 385 should be saved */
+SYNTHETIC_result_t step_record_385_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 385 should not be duplicated */
+SYNTHETIC_result_t step_record_385_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 386 exists */
+SYNTHETIC_result_t step_record_386_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 386 has value 2702 */
+SYNTHETIC_result_t step_record_386_has_value_2702(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 386 is updated */
+SYNTHETIC_result_t step_record_386_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 386 should be saved */
+SYNTHETIC_result_t step_record_386_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 386 should not be duplicated */
+SYNTHETIC_result_t step_record_386_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 387 exists */
+SYNTHETIC_result_t step_record_387_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 387 has value 2709 */
+SYNTHETIC_result_t step_record_387_has_value_2709(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 387 is updated */
+SYNTHETIC_result_t step_record_387_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 387 should be saved */
+SYNTHETIC_result_t step_record_387_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 387 should not be duplicated */
+SYNTHETIC_result_t step_record_387_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 388 exists */
+SYNTHETIC_result_t step_record_388_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 388 has value 2716 */
+SYNTHETIC_result_t step_record_388_has_value_2716(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 388 is updated */
+SYNTHETIC_result_t step_record_388_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 388 should be saved */
+SYNTHETIC_result_t step_record_388_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 388 should not be duplicated */
+SYNTHETIC_result_t step_record_388_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 389 exists */
+SYNTHETIC_result_t step_record_389_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 389 has value 2723 */
+SYNTHETIC_result_t step_record_389_has_value_2723(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 389 is updated */
+SYNTHETIC_result_t step_record_389_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 389 should be saved */
+SYNTHETIC_result_t step_record_389_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 389 should not be duplicated */
+SYNTHETIC_result_t step_record_389_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 390 exists */
+SYNTHETIC_result_t step_record_390_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 390 has value 2730 */
+SYNTHETIC_result_t step_record_390_has_value_2730(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 390 is updated */
+SYNTHETIC_result_t step_record_390_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 390 should be saved */
+SYNTHETIC_result_t step_record_390_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 390 should not be duplicated */
+SYNTHETIC_result_t step_record_390_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 391 exists */
+SYNTHETIC_result_t step_record_391_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 391 has value 2737 */
+SYNTHETIC_result_t step_record_391_has_value_2737(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 391 is updated */
+SYNTHETIC_result_t step_record_391_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 391 should be saved */
+SYNTHETIC_result_t step_record_391_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 391 should not be duplicated */
+SYNTHETIC_result_t step_record_391_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 392 exists */
+SYNTHETIC_result_t step_record_392_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 392 has value 2744 */
+SYNTHETIC_result_t step_record_392_has_value_2744(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 392 is updated */
+SYNTHETIC_result_t step_record_392_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 392 should be saved */
+SYNTHETIC_result_t step_record_392_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 392 should not be duplicated */
+SYNTHETIC_result_t step_record_392_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 393 exists */
+SYNTHETIC_result_t step_record_393_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 393 has value 2751 */
+SYNTHETIC_result_t step_record_393_has_value_2751(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 393 is updated */
+SYNTHETIC_result_t step_record_393_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 393 should be saved */
+SYNTHETIC_result_t step_record_393_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 393 should not be duplicated */
+SYNTHETIC_result_t step_record_393_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 394 exists */
+SYNTHETIC_result_t step_record_394_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 394 has value 2758 */
+SYNTHETIC_result_t step_record_394_has_value_2758(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 394 is updated */
+SYNTHETIC_result_t step_record_394_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 394 should be saved */
+SYNTHETIC_result_t step_record_394_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 394 should not be duplicated */
+SYNTHETIC_result_t step_record_394_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 395 exists */
+SYNTHETIC_result_t step_record_395_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 395 has value 2765 */
+SYNTHETIC_result_t step_record_395_has_value_2765(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 395 is updated */
+SYNTHETIC_result_t step_record_395_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 395 should be saved */
+SYNTHETIC_result_t step_record_395_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 395 should not be duplicated */
+SYNTHETIC_result_t step_record_395_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 396 exists */
+SYNTHETIC_result_t step_record_396_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 396 has value 2772 */
+SYNTHETIC_result_t step_record_396_has_value_2772(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 396 is updated */
+SYNTHETIC_result_t step_record_396_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 396 should be saved */
+SYNTHETIC_result_t step_record_396_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 396 should not be duplicated */
+SYNTHETIC_result_t step_record_396_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 397 exists */
+SYNTHETIC_result_t step_record_397_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 397 has value 2779 */
+SYNTHETIC_result_t step_record_397_has_value_2779(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 397 is updated */
+SYNTHETIC_result_t step_record_397_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 397 should be saved */
+SYNTHETIC_result_t step_record_397_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 397 should not be duplicated */
+SYNTHETIC_result_t step_record_397_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 398 exists */
+SYNTHETIC_result_t step_record_398_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 398 has value 2786 */
+SYNTHETIC_result_t step_record_398_has_value_2786(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 398 is updated */
+SYNTHETIC_result_t step_record_398_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 398 should be saved */
+SYNTHETIC_result_t step_record_398_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 398 should not be duplicated */
+SYNTHETIC_result_t step_record_398_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 399 exists */
+SYNTHETIC_result_t step_record_399_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 399 has value 2793 */
+SYNTHETIC_result_t step_record_399_has_value_2793(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 399 is updated */
+SYNTHETIC_result_t step_record_399_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 399 should be saved */
+SYNTHETIC_result_t step_record_399_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 399 should not be duplicated */
+SYNTHETIC_result_t step_record_399_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 400 exists */
+SYNTHETIC_result_t step_record_400_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 400 has value 2800 */
+SYNTHETIC_result_t step_record_400_has_value_2800(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 400 is updated */
+SYNTHETIC_result_t step_record_400_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 400 should be saved */
+SYNTHETIC_result_t step_record_400_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 400 should not be duplicated */
+SYNTHETIC_result_t step_record_400_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 401 exists */
+SYNTHETIC_result_t step_record_401_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 401 has value 2807 */
+SYNTHETIC_result_t step_record_401_has_value_2807(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 401 is updated */
+SYNTHETIC_result_t step_record_401_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 401 should be saved */
+SYNTHETIC_result_t step_record_401_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 401 should not be duplicated */
+SYNTHETIC_result_t step_record_401_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 402 exists */
+SYNTHETIC_result_t step_record_402_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 402 has value 2814 */
+SYNTHETIC_result_t step_record_402_has_value_2814(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 402 is updated */
+SYNTHETIC_result_t step_record_402_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 402 should be saved */
+SYNTHETIC_result_t step_record_402_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 402 should not be duplicated */
+SYNTHETIC_result_t step_record_402_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 403 exists */
+SYNTHETIC_result_t step_record_403_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 403 has value 2821 */
+SYNTHETIC_result_t step_record_403_has_value_2821(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 403 is updated */
+SYNTHETIC_result_t step_record_403_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 403 should be saved */
+SYNTHETIC_result_t step_record_403_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 403 should not be duplicated */
+SYNTHETIC_result_t step_record_403_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 404 exists */
+SYNTHETIC_result_t step_record_404_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 404 has value 2828 */
+SYNTHETIC_result_t step_record_404_has_value_2828(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 404 is updated */
+SYNTHETIC_result_t step_record_404_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 404 should be saved */
+SYNTHETIC_result_t step_record_404_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 404 should not be duplicated */
+SYNTHETIC_result_t step_record_404_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 405 exists */
+SYNTHETIC_result_t step_record_405_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 405 has value 2835 */
+SYNTHETIC_result_t step_record_405_has_value_2835(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 405 is updated */
+SYNTHETIC_result_t step_record_405_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 405 should be saved */
+SYNTHETIC_result_t step_record_405_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 405 should not be duplicated */
+SYNTHETIC_result_t step_record_405_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 406 exists */
+SYNTHETIC_result_t step_record_406_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 406 has value 2842 */
+SYNTHETIC_result_t step_record_406_has_value_2842(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 406 is updated */
+SYNTHETIC_result_t step_record_406_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 406 should be saved */
+SYNTHETIC_result_t step_record_406_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 406 should not be duplicated */
+SYNTHETIC_result_t step_record_406_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 407 exists */
+SYNTHETIC_result_t step_record_407_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 407 has value 2849 */
+SYNTHETIC_result_t step_record_407_has_value_2849(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 407 is updated */
+SYNTHETIC_result_t step_record_407_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 407 should be saved */
+SYNTHETIC_result_t step_record_407_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 407 should not be duplicated */
+SYNTHETIC_result_t step_record_407_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 408 exists */
+SYNTHETIC_result_t step_record_408_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 408 has value 2856 */
+SYNTHETIC_result_t step_record_408_has_value_2856(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 408 is updated */
+SYNTHETIC_result_t step_record_408_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 408 should be saved */
+SYNTHETIC_result_t step_record_408_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 408 should not be duplicated */
+SYNTHETIC_result_t step_record_408_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 409 exists */
+SYNTHETIC_result_t step_record_409_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 409 has value 2863 */
+SYNTHETIC_result_t step_record_409_has_value_2863(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 409 is updated */
+SYNTHETIC_result_t step_record_409_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 409 should be saved */
+SYNTHETIC_result_t step_record_409_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 409 should not be duplicated */
+SYNTHETIC_result_t step_record_409_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 410 exists */
+SYNTHETIC_result_t step_record_410_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 410 has value 2870 */
+SYNTHETIC_result_t step_record_410_has_value_2870(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 410 is updated */
+SYNTHETIC_result_t step_record_410_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 410 should be saved */
+SYNTHETIC_result_t step_record_410_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 410 should not be duplicated */
+SYNTHETIC_result_t step_record_410_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 411 exists */
+SYNTHETIC_result_t step_record_411_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 411 has value 2877 */
+SYNTHETIC_result_t step_record_411_has_value_2877(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 411 is updated */
+SYNTHETIC_result_t step_record_411_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 411 should be saved */
+SYNTHETIC_result_t step_record_411_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 411 should not be duplicated */
+SYNTHETIC_result_t step_record_411_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 412 exists */
+SYNTHETIC_result_t step_record_412_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 412 has value 2884 */
+SYNTHETIC_result_t step_record_412_has_value_2884(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 412 is updated */
+SYNTHETIC_result_t step_record_412_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 412 should be saved */
+SYNTHETIC_result_t step_record_412_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 412 should not be duplicated */
+SYNTHETIC_result_t step_record_412_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 413 exists */
+SYNTHETIC_result_t step_record_413_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 413 has value 2891 */
+SYNTHETIC_result_t step_record_413_has_value_2891(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 413 is updated */
+SYNTHETIC_result_t step_record_413_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 413 should be saved */
+SYNTHETIC_result_t step_record_413_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 413 should not be duplicated */
+SYNTHETIC_result_t step_record_413_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 414 exists */
+SYNTHETIC_result_t step_record_414_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 414 has value 2898 */
+SYNTHETIC_result_t step_record_414_has_value_2898(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 414 is updated */
+SYNTHETIC_result_t step_record_414_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 414 should be saved */
+SYNTHETIC_result_t step_record_414_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 414 should not be duplicated */
+SYNTHETIC_result_t step_record_414_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 415 exists */
+SYNTHETIC_result_t step_record_415_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 415 has value 2905 */
+SYNTHETIC_result_t step_record_415_has_value_2905(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 415 is updated */
+SYNTHETIC_result_t step_record_415_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 415 should be saved */
+SYNTHETIC_result_t step_record_415_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 415 should not be duplicated */
+SYNTHETIC_result_t step_record_415_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 416 exists */
+SYNTHETIC_result_t step_record_416_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 416 has value 2912 */
+SYNTHETIC_result_t step_record_416_has_value_2912(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 416 is updated */
+SYNTHETIC_result_t step_record_416_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 416 should be saved */
+SYNTHETIC_result_t step_record_416_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 416 should not be duplicated */
+SYNTHETIC_result_t step_record_416_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 417 exists */
+SYNTHETIC_result_t step_record_417_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 417 has value 2919 */
+SYNTHETIC_result_t step_record_417_has_value_2919(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 417 is updated */
+SYNTHETIC_result_t step_record_417_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 417 should be saved */
+SYNTHETIC_result_t step_record_417_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 417 should not be duplicated */
+SYNTHETIC_result_t step_record_417_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 418 exists */
+SYNTHETIC_result_t step_record_418_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 418 has value 2926 */
+SYNTHETIC_result_t step_record_418_has_value_2926(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 418 is updated */
+SYNTHETIC_result_t step_record_418_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 418 should be saved */
+SYNTHETIC_result_t step_record_418_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 418 should not be duplicated */
+SYNTHETIC_result_t step_record_418_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 419 exists */
+SYNTHETIC_result_t step_record_419_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 419 has value 2933 */
+SYNTHETIC_result_t step_record_419_has_value_2933(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 419 is updated */
+SYNTHETIC_result_t step_record_419_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 419 should be saved */
+SYNTHETIC_result_t step_record_419_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 419 should not be duplicated */
+SYNTHETIC_result_t step_record_419_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 420 exists */
+SYNTHETIC_result_t step_record_420_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 420 has value 2940 */
+SYNTHETIC_result_t step_record_420_has_value_2940(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 420 is updated */
+SYNTHETIC_result_t step_record_420_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 420 should be saved */
+SYNTHETIC_result_t step_record_420_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 420 should not be duplicated */
+SYNTHETIC_result_t step_record_420_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 421 exists */
+SYNTHETIC_result_t step_record_421_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 421 has value 2947 */
+SYNTHETIC_result_t step_record_421_has_value_2947(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 421 is updated */
+SYNTHETIC_result_t step_record_421_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 421 should be saved */
+SYNTHETIC_result_t step_record_421_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 421 should not be duplicated */
+SYNTHETIC_result_t step_record_421_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 422 exists */
+SYNTHETIC_result_t step_record_422_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 422 has value 2954 */
+SYNTHETIC_result_t step_record_422_has_value_2954(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 422 is updated */
+SYNTHETIC_result_t step_record_422_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 422 should be saved */
+SYNTHETIC_result_t step_record_422_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 422 should not be duplicated */
+SYNTHETIC_result_t step_record_422_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 423 exists */
+SYNTHETIC_result_t step_record_423_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 423 has value 2961 */
+SYNTHETIC_result_t step_record_423_has_value_2961(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 423 is updated */
+SYNTHETIC_result_t step_record_423_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 423 should be saved */
+SYNTHETIC_result_t step_record_423_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 423 should not be duplicated */
+SYNTHETIC_result_t step_record_423_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 424 exists */
+SYNTHETIC_result_t step_record_424_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 424 has value 2968 */
+SYNTHETIC_result_t step_record_424_has_value_2968(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 424 is updated */
+SYNTHETIC_result_t step_record_424_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 424 should be saved */
+SYNTHETIC_result_t step_record_424_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 424 should not be duplicated */
+SYNTHETIC_result_t step_record_424_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 425 exists */
+SYNTHETIC_result_t step_record_425_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 425 has value 2975 */
+SYNTHETIC_result_t step_record_425_has_value_2975(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 425 is updated */
+SYNTHETIC_result_t step_record_425_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 425 should be saved */
+SYNTHETIC_result_t step_record_425_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 425 should not be duplicated */
+SYNTHETIC_result_t step_record_425_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 426 exists */
+SYNTHETIC_result_t step_record_426_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 426 has value 2982 */
+SYNTHETIC_result_t step_record_426_has_value_2982(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 426 is updated */
+SYNTHETIC_result_t step_record_426_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 426 should be saved */
+SYNTHETIC_result_t step_record_426_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 426 should not be duplicated */
+SYNTHETIC_result_t step_record_426_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 427 exists */
+SYNTHETIC_result_t step_record_427_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 427 has value 2989 */
+SYNTHETIC_result_t step_record_427_has_value_2989(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 427 is updated */
+SYNTHETIC_result_t step_record_427_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 427 should be saved */
+SYNTHETIC_result_t step_record_427_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 427 should not be duplicated */
+SYNTHETIC_result_t step_record_427_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 428 exists */
+SYNTHETIC_result_t step_record_428_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 428 has value 2996 */
+SYNTHETIC_result_t step_record_428_has_value_2996(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 428 is updated */
+SYNTHETIC_result_t step_record_428_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 428 should be saved */
+SYNTHETIC_result_t step_record_428_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 428 should not be duplicated */
+SYNTHETIC_result_t step_record_428_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 429 exists */
+SYNTHETIC_result_t step_record_429_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 429 has value 3003 */
+SYNTHETIC_result_t step_record_429_has_value_3003(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 429 is updated */
+SYNTHETIC_result_t step_record_429_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 429 should be saved */
+SYNTHETIC_result_t step_record_429_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 429 should not be duplicated */
+SYNTHETIC_result_t step_record_429_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 430 exists */
+SYNTHETIC_result_t step_record_430_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 430 has value 3010 */
+SYNTHETIC_result_t step_record_430_has_value_3010(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 430 is updated */
+SYNTHETIC_result_t step_record_430_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 430 should be saved */
+SYNTHETIC_result_t step_record_430_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 430 should not be duplicated */
+SYNTHETIC_result_t step_record_430_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 431 exists */
+SYNTHETIC_result_t step_record_431_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 431 has value 3017 */
+SYNTHETIC_result_t step_record_431_has_value_3017(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 431 is updated */
+SYNTHETIC_result_t step_record_431_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 431 should be saved */
+SYNTHETIC_result_t step_record_431_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 431 should not be duplicated */
+SYNTHETIC_result_t step_record_431_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 432 exists */
+SYNTHETIC_result_t step_record_432_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 432 has value 3024 */
+SYNTHETIC_result_t step_record_432_has_value_3024(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 432 is updated */
+SYNTHETIC_result_t step_record_432_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 432 should be saved */
+SYNTHETIC_result_t step_record_432_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 432 should not be duplicated */
+SYNTHETIC_result_t step_record_432_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 433 exists */
+SYNTHETIC_result_t step_record_433_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 433 has value 3031 */
+SYNTHETIC_result_t step_record_433_has_value_3031(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 433 is updated */
+SYNTHETIC_result_t step_record_433_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 433 should be saved */
+SYNTHETIC_result_t step_record_433_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 433 should not be duplicated */
+SYNTHETIC_result_t step_record_433_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 434 exists */
+SYNTHETIC_result_t step_record_434_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 434 has value 3038 */
+SYNTHETIC_result_t step_record_434_has_value_3038(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 434 is updated */
+SYNTHETIC_result_t step_record_434_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 434 should be saved */
+SYNTHETIC_result_t step_record_434_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 434 should not be duplicated */
+SYNTHETIC_result_t step_record_434_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 435 exists */
+SYNTHETIC_result_t step_record_435_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 435 has value 3045 */
+SYNTHETIC_result_t step_record_435_has_value_3045(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 435 is updated */
+SYNTHETIC_result_t step_record_435_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 435 should be saved */
+SYNTHETIC_result_t step_record_435_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 435 should not be duplicated */
+SYNTHETIC_result_t step_record_435_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 436 exists */
+SYNTHETIC_result_t step_record_436_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 436 has value 3052 */
+SYNTHETIC_result_t step_record_436_has_value_3052(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 436 is updated */
+SYNTHETIC_result_t step_record_436_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 436 should be saved */
+SYNTHETIC_result_t step_record_436_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 436 should not be duplicated */
+SYNTHETIC_result_t step_record_436_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 437 exists */
+SYNTHETIC_result_t step_record_437_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 437 has value 3059 */
+SYNTHETIC_result_t step_record_437_has_value_3059(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 437 is updated */
+SYNTHETIC_result_t step_record_437_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 437 should be saved */
+SYNTHETIC_result_t step_record_437_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 437 should not be duplicated */
+SYNTHETIC_result_t step_record_437_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 438 exists */
+SYNTHETIC_result_t step_record_438_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 438 has value 3066 */
+SYNTHETIC_result_t step_record_438_has_value_3066(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 438 is updated */
+SYNTHETIC_result_t step_record_438_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 438 should be saved */
+SYNTHETIC_result_t step_record_438_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 438 should not be duplicated */
+SYNTHETIC_result_t step_record_438_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 439 exists */
+SYNTHETIC_result_t step_record_439_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 439 has value 3073 */
+SYNTHETIC_result_t step_record_439_has_value_3073(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 439 is updated */
+SYNTHETIC_result_t step_record_439_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 439 should be saved */
+SYNTHETIC_result_t step_record_439_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 439 should not be duplicated */
+SYNTHETIC_result_t step_record_439_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 440 exists */
+SYNTHETIC_result_t step_record_440_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 440 has value 3080 */
+SYNTHETIC_result_t step_record_440_has_value_3080(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 440 is updated */
+SYNTHETIC_result_t step_record_440_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 440 should be saved */
+SYNTHETIC_result_t step_record_440_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 440 should not be duplicated */
+SYNTHETIC_result_t step_record_440_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 441 exists */
+SYNTHETIC_result_t step_record_441_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 441 has value 3087 */
+SYNTHETIC_result_t step_record_441_has_value_3087(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 441 is updated */
+SYNTHETIC_result_t step_record_441_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 441 should be saved */
+SYNTHETIC_result_t step_record_441_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 441 should not be duplicated */
+SYNTHETIC_result_t step_record_441_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 442 exists */
+SYNTHETIC_result_t step_record_442_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 442 has value 3094 */
+SYNTHETIC_result_t step_record_442_has_value_3094(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 442 is updated */
+SYNTHETIC_result_t step_record_442_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 442 should be saved */
+SYNTHETIC_result_t step_record_442_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 442 should not be duplicated */
+SYNTHETIC_result_t step_record_442_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 443 exists */
+SYNTHETIC_result_t step_record_443_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 443 has value 3101 */
+SYNTHETIC_result_t step_record_443_has_value_3101(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 443 is updated */
+SYNTHETIC_result_t step_record_443_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 443 should be saved */
+SYNTHETIC_result_t step_record_443_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 443 should not be duplicated */
+SYNTHETIC_result_t step_record_443_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 444 exists */
+SYNTHETIC_result_t step_record_444_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 444 has value 3108 */
+SYNTHETIC_result_t step_record_444_has_value_3108(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 444 is updated */
+SYNTHETIC_result_t step_record_444_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 444 should be saved */
+SYNTHETIC_result_t step_record_444_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 444 should not be duplicated */
+SYNTHETIC_result_t step_record_444_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 445 exists */
+SYNTHETIC_result_t step_record_445_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 445 has value 3115 */
+SYNTHETIC_result_t step_record_445_has_value_3115(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 445 is updated */
+SYNTHETIC_result_t step_record_445_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 445 should be saved */
+SYNTHETIC_result_t step_record_445_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 445 should not be duplicated */
+SYNTHETIC_result_t step_record_445_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 446 exists */
+SYNTHETIC_result_t step_record_446_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 446 has value 3122 */
+SYNTHETIC_result_t step_record_446_has_value_3122(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 446 is updated */
+SYNTHETIC_result_t step_record_446_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 446 should be saved */
+SYNTHETIC_result_t step_record_446_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 446 should not be duplicated */
+SYNTHETIC_result_t step_record_446_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 447 exists */
+SYNTHETIC_result_t step_record_447_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 447 has value 3129 */
+SYNTHETIC_result_t step_record_447_has_value_3129(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 447 is updated */
+SYNTHETIC_result_t step_record_447_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 447 should be saved */
+SYNTHETIC_result_t step_record_447_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 447 should not be duplicated */
+SYNTHETIC_result_t step_record_447_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 448 exists */
+SYNTHETIC_result_t step_record_448_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 448 has value 3136 */
+SYNTHETIC_result_t step_record_448_has_value_3136(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 448 is updated */
+SYNTHETIC_result_t step_record_448_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 448 should be saved */
+SYNTHETIC_result_t step_record_448_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 448 should not be duplicated */
+SYNTHETIC_result_t step_record_448_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 449 exists */
+SYNTHETIC_result_t step_record_449_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 449 has value 3143 */
+SYNTHETIC_result_t step_record_449_has_value_3143(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 449 is updated */
+SYNTHETIC_result_t step_record_449_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 449 should be saved */
+SYNTHETIC_result_t step_record_449_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 449 should not be duplicated */
+SYNTHETIC_result_t step_record_449_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 450 exists */
+SYNTHETIC_result_t step_record_450_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 450 has value 3150 */
+SYNTHETIC_result_t step_record_450_has_value_3150(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 450 is updated */
+SYNTHETIC_result_t step_record_450_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 450 should be saved */
+SYNTHETIC_result_t step_record_450_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 450 should not be duplicated */
+SYNTHETIC_result_t step_record_450_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 451 exists */
+SYNTHETIC_result_t step_record_451_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 451 has value 3157 */
+SYNTHETIC_result_t step_record_451_has_value_3157(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 451 is updated */
+SYNTHETIC_result_t step_record_451_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 451 should be saved */
+SYNTHETIC_result_t step_record_451_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 451 should not be duplicated */
+SYNTHETIC_result_t step_record_451_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 452 exists */
+SYNTHETIC_result_t step_record_452_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 452 has value 3164 */
+SYNTHETIC_result_t step_record_452_has_value_3164(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 452 is updated */
+SYNTHETIC_result_t step_record_452_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 452 should be saved */
+SYNTHETIC_result_t step_record_452_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 452 should not be duplicated */
+SYNTHETIC_result_t step_record_452_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 453 exists */
+SYNTHETIC_result_t step_record_453_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 453 has value 3171 */
+SYNTHETIC_result_t step_record_453_has_value_3171(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 453 is updated */
+SYNTHETIC_result_t step_record_453_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 453 should be saved */
+SYNTHETIC_result_t step_record_453_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 453 should not be duplicated */
+SYNTHETIC_result_t step_record_453_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 454 exists */
+SYNTHETIC_result_t step_record_454_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 454 has value 3178 */
+SYNTHETIC_result_t step_record_454_has_value_3178(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 454 is updated */
+SYNTHETIC_result_t step_record_454_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 454 should be saved */
+SYNTHETIC_result_t step_record_454_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 454 should not be duplicated */
+SYNTHETIC_result_t step_record_454_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 455 exists */
+SYNTHETIC_result_t step_record_455_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 455 has value 3185 */
+SYNTHETIC_result_t step_record_455_has_value_3185(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 455 is updated */
+SYNTHETIC_result_t step_record_455_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 455 should be saved */
+SYNTHETIC_result_t step_record_455_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 455 should not be duplicated */
+SYNTHETIC_result_t step_record_455_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 456 exists */
+SYNTHETIC_result_t step_record_456_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 456 has value 3192 */
+SYNTHETIC_result_t step_record_456_has_value_3192(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 456 is updated */
+SYNTHETIC_result_t step_record_456_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 456 should be saved */
+SYNTHETIC_result_t step_record_456_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 456 should not be duplicated */
+SYNTHETIC_result_t step_record_456_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 457 exists */
+SYNTHETIC_result_t step_record_457_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 457 has value 3199 */
+SYNTHETIC_result_t step_record_457_has_value_3199(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 457 is updated */
+SYNTHETIC_result_t step_record_457_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 457 should be saved */
+SYNTHETIC_result_t step_record_457_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 457 should not be duplicated */
+SYNTHETIC_result_t step_record_457_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 458 exists */
+SYNTHETIC_result_t step_record_458_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 458 has value 3206 */
+SYNTHETIC_result_t step_record_458_has_value_3206(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 458 is updated */
+SYNTHETIC_result_t step_record_458_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 458 should be saved */
+SYNTHETIC_result_t step_record_458_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 458 should not be duplicated */
+SYNTHETIC_result_t step_record_458_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 459 exists */
+SYNTHETIC_result_t step_record_459_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 459 has value 3213 */
+SYNTHETIC_result_t step_record_459_has_value_3213(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 459 is updated */
+SYNTHETIC_result_t step_record_459_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 459 should be saved */
+SYNTHETIC_result_t step_record_459_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 459 should not be duplicated */
+SYNTHETIC_result_t step_record_459_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 460 exists */
+SYNTHETIC_result_t step_record_460_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 460 has value 3220 */
+SYNTHETIC_result_t step_record_460_has_value_3220(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 460 is updated */
+SYNTHETIC_result_t step_record_460_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 460 should be saved */
+SYNTHETIC_result_t step_record_460_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 460 should not be duplicated */
+SYNTHETIC_result_t step_record_460_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 461 exists */
+SYNTHETIC_result_t step_record_461_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 461 has value 3227 */
+SYNTHETIC_result_t step_record_461_has_value_3227(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 461 is updated */
+SYNTHETIC_result_t step_record_461_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 461 should be saved */
+SYNTHETIC_result_t step_record_461_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 461 should not be duplicated */
+SYNTHETIC_result_t step_record_461_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 462 exists */
+SYNTHETIC_result_t step_record_462_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 462 has value 3234 */
+SYNTHETIC_result_t step_record_462_has_value_3234(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 462 is updated */
+SYNTHETIC_result_t step_record_462_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 462 should be saved */
+SYNTHETIC_result_t step_record_462_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 462 should not be duplicated */
+SYNTHETIC_result_t step_record_462_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 463 exists */
+SYNTHETIC_result_t step_record_463_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 463 has value 3241 */
+SYNTHETIC_result_t step_record_463_has_value_3241(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 463 is updated */
+SYNTHETIC_result_t step_record_463_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 463 should be saved */
+SYNTHETIC_result_t step_record_463_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 463 should not be duplicated */
+SYNTHETIC_result_t step_record_463_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 464 exists */
+SYNTHETIC_result_t step_record_464_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 464 has value 3248 */
+SYNTHETIC_result_t step_record_464_has_value_3248(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 464 is updated */
+SYNTHETIC_result_t step_record_464_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 464 should be saved */
+SYNTHETIC_result_t step_record_464_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 464 should not be duplicated */
+SYNTHETIC_result_t step_record_464_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 465 exists */
+SYNTHETIC_result_t step_record_465_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 465 has value 3255 */
+SYNTHETIC_result_t step_record_465_has_value_3255(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 465 is updated */
+SYNTHETIC_result_t step_record_465_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 465 should be saved */
+SYNTHETIC_result_t step_record_465_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 465 should not be duplicated */
+SYNTHETIC_result_t step_record_465_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 466 exists */
+SYNTHETIC_result_t step_record_466_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 466 has value 3262 */
+SYNTHETIC_result_t step_record_466_has_value_3262(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 466 is updated */
+SYNTHETIC_result_t step_record_466_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 466 should be saved */
+SYNTHETIC_result_t step_record_466_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 466 should not be duplicated */
+SYNTHETIC_result_t step_record_466_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 467 exists */
+SYNTHETIC_result_t step_record_467_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 467 has value 3269 */
+SYNTHETIC_result_t step_record_467_has_value_3269(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 467 is updated */
+SYNTHETIC_result_t step_record_467_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 467 should be saved */
+SYNTHETIC_result_t step_record_467_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 467 should not be duplicated */
+SYNTHETIC_result_t step_record_467_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 468 exists */
+SYNTHETIC_result_t step_record_468_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 468 has value 3276 */
+SYNTHETIC_result_t step_record_468_has_value_3276(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 468 is updated */
+SYNTHETIC_result_t step_record_468_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 468 should be saved */
+SYNTHETIC_result_t step_record_468_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 468 should not be duplicated */
+SYNTHETIC_result_t step_record_468_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 469 exists */
+SYNTHETIC_result_t step_record_469_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 469 has value 3283 */
+SYNTHETIC_result_t step_record_469_has_value_3283(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 469 is updated */
+SYNTHETIC_result_t step_record_469_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 469 should be saved */
+SYNTHETIC_result_t step_record_469_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 469 should not be duplicated */
+SYNTHETIC_result_t step_record_469_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 470 exists */
+SYNTHETIC_result_t step_record_470_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 470 has value 3290 */
+SYNTHETIC_result_t step_record_470_has_value_3290(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 470 is updated */
+SYNTHETIC_result_t step_record_470_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 470 should be saved */
+SYNTHETIC_result_t step_record_470_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 470 should not be duplicated */
+SYNTHETIC_result_t step_record_470_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 471 exists */
+SYNTHETIC_result_t step_record_471_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 471 has value 3297 */
+SYNTHETIC_result_t step_record_471_has_value_3297(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 471 is updated */
+SYNTHETIC_result_t step_record_471_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 471 should be saved */
+SYNTHETIC_result_t step_record_471_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 471 should not be duplicated */
+SYNTHETIC_result_t step_record_471_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 472 exists */
+SYNTHETIC_result_t step_record_472_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 472 has value 3304 */
+SYNTHETIC_result_t step_record_472_has_value_3304(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 472 is updated */
+SYNTHETIC_result_t step_record_472_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 472 should be saved */
+SYNTHETIC_result_t step_record_472_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 472 should not be duplicated */
+SYNTHETIC_result_t step_record_472_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 473 exists */
+SYNTHETIC_result_t step_record_473_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 473 has value 3311 */
+SYNTHETIC_result_t step_record_473_has_value_3311(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 473 is updated */
+SYNTHETIC_result_t step_record_473_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 473 should be saved */
+SYNTHETIC_result_t step_record_473_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 473 should not be duplicated */
+SYNTHETIC_result_t step_record_473_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 474 exists */
+SYNTHETIC_result_t step_record_474_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 474 has value 3318 */
+SYNTHETIC_result_t step_record_474_has_value_3318(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 474 is updated */
+SYNTHETIC_result_t step_record_474_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 474 should be saved */
+SYNTHETIC_result_t step_record_474_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 474 should not be duplicated */
+SYNTHETIC_result_t step_record_474_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 475 exists */
+SYNTHETIC_result_t step_record_475_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 475 has value 3325 */
+SYNTHETIC_result_t step_record_475_has_value_3325(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 475 is updated */
+SYNTHETIC_result_t step_record_475_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 475 should be saved */
+SYNTHETIC_result_t step_record_475_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 475 should not be duplicated */
+SYNTHETIC_result_t step_record_475_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 476 exists */
+SYNTHETIC_result_t step_record_476_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 476 has value 3332 */
+SYNTHETIC_result_t step_record_476_has_value_3332(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 476 is updated */
+SYNTHETIC_result_t step_record_476_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 476 should be saved */
+SYNTHETIC_result_t step_record_476_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 476 should not be duplicated */
+SYNTHETIC_result_t step_record_476_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 477 exists */
+SYNTHETIC_result_t step_record_477_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 477 has value 3339 */
+SYNTHETIC_result_t step_record_477_has_value_3339(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 477 is updated */
+SYNTHETIC_result_t step_record_477_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 477 should be saved */
+SYNTHETIC_result_t step_record_477_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 477 should not be duplicated */
+SYNTHETIC_result_t step_record_477_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 478 exists */
+SYNTHETIC_result_t step_record_478_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 478 has value 3346 */
+SYNTHETIC_result_t step_record_478_has_value_3346(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 478 is updated */
+SYNTHETIC_result_t step_record_478_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 478 should be saved */
+SYNTHETIC_result_t step_record_478_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 478 should not be duplicated */
+SYNTHETIC_result_t step_record_478_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 479 exists */
+SYNTHETIC_result_t step_record_479_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 479 has value 3353 */
+SYNTHETIC_result_t step_record_479_has_value_3353(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 479 is updated */
+SYNTHETIC_result_t step_record_479_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 479 should be saved */
+SYNTHETIC_result_t step_record_479_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 479 should not be duplicated */
+SYNTHETIC_result_t step_record_479_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 480 exists */
+SYNTHETIC_result_t step_record_480_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 480 has value 3360 */
+SYNTHETIC_result_t step_record_480_has_value_3360(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 480 is updated */
+SYNTHETIC_result_t step_record_480_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 480 should be saved */
+SYNTHETIC_result_t step_record_480_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 480 should not be duplicated */
+SYNTHETIC_result_t step_record_480_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 481 exists */
+SYNTHETIC_result_t step_record_481_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 481 has value 3367 */
+SYNTHETIC_result_t step_record_481_has_value_3367(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 481 is updated */
+SYNTHETIC_result_t step_record_481_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 481 should be saved */
+SYNTHETIC_result_t step_record_481_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 481 should not be duplicated */
+SYNTHETIC_result_t step_record_481_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 482 exists */
+SYNTHETIC_result_t step_record_482_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 482 has value 3374 */
+SYNTHETIC_result_t step_record_482_has_value_3374(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 482 is updated */
+SYNTHETIC_result_t step_record_482_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 482 should be saved */
+SYNTHETIC_result_t step_record_482_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 482 should not be duplicated */
+SYNTHETIC_result_t step_record_482_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 483 exists */
+SYNTHETIC_result_t step_record_483_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 483 has value 3381 */
+SYNTHETIC_result_t step_record_483_has_value_3381(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 483 is updated */
+SYNTHETIC_result_t step_record_483_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 483 should be saved */
+SYNTHETIC_result_t step_record_483_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 483 should not be duplicated */
+SYNTHETIC_result_t step_record_483_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 484 exists */
+SYNTHETIC_result_t step_record_484_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 484 has value 3388 */
+SYNTHETIC_result_t step_record_484_has_value_3388(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 484 is updated */
+SYNTHETIC_result_t step_record_484_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 484 should be saved */
+SYNTHETIC_result_t step_record_484_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 484 should not be duplicated */
+SYNTHETIC_result_t step_record_484_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 485 exists */
+SYNTHETIC_result_t step_record_485_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 485 has value 3395 */
+SYNTHETIC_result_t step_record_485_has_value_3395(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 485 is updated */
+SYNTHETIC_result_t step_record_485_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 485 should be saved */
+SYNTHETIC_result_t step_record_485_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 485 should not be duplicated */
+SYNTHETIC_result_t step_record_485_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 486 exists */
+SYNTHETIC_result_t step_record_486_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 486 has value 3402 */
+SYNTHETIC_result_t step_record_486_has_value_3402(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 486 is updated */
+SYNTHETIC_result_t step_record_486_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 486 should be saved */
+SYNTHETIC_result_t step_record_486_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 486 should not be duplicated */
+SYNTHETIC_result_t step_record_486_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 487 exists */
+SYNTHETIC_result_t step_record_487_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 487 has value 3409 */
+SYNTHETIC_result_t step_record_487_has_value_3409(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 487 is updated */
+SYNTHETIC_result_t step_record_487_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 487 should be saved */
+SYNTHETIC_result_t step_record_487_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 487 should not be duplicated */
+SYNTHETIC_result_t step_record_487_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 488 exists */
+SYNTHETIC_result_t step_record_488_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 488 has value 3416 */
+SYNTHETIC_result_t step_record_488_has_value_3416(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 488 is updated */
+SYNTHETIC_result_t step_record_488_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 488 should be saved */
+SYNTHETIC_result_t step_record_488_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 488 should not be duplicated */
+SYNTHETIC_result_t step_record_488_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 489 exists */
+SYNTHETIC_result_t step_record_489_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 489 has value 3423 */
+SYNTHETIC_result_t step_record_489_has_value_3423(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 489 is updated */
+SYNTHETIC_result_t step_record_489_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 489 should be saved */
+SYNTHETIC_result_t step_record_489_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 489 should not be duplicated */
+SYNTHETIC_result_t step_record_489_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 490 exists */
+SYNTHETIC_result_t step_record_490_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 490 has value 3430 */
+SYNTHETIC_result_t step_record_490_has_value_3430(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 490 is updated */
+SYNTHETIC_result_t step_record_490_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 490 should be saved */
+SYNTHETIC_result_t step_record_490_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 490 should not be duplicated */
+SYNTHETIC_result_t step_record_490_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 491 exists */
+SYNTHETIC_result_t step_record_491_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 491 has value 3437 */
+SYNTHETIC_result_t step_record_491_has_value_3437(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 491 is updated */
+SYNTHETIC_result_t step_record_491_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 491 should be saved */
+SYNTHETIC_result_t step_record_491_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 491 should not be duplicated */
+SYNTHETIC_result_t step_record_491_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 492 exists */
+SYNTHETIC_result_t step_record_492_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 492 has value 3444 */
+SYNTHETIC_result_t step_record_492_has_value_3444(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 492 is updated */
+SYNTHETIC_result_t step_record_492_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 492 should be saved */
+SYNTHETIC_result_t step_record_492_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 492 should not be duplicated */
+SYNTHETIC_result_t step_record_492_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 493 exists */
+SYNTHETIC_result_t step_record_493_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 493 has value 3451 */
+SYNTHETIC_result_t step_record_493_has_value_3451(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 493 is updated */
+SYNTHETIC_result_t step_record_493_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 493 should be saved */
+SYNTHETIC_result_t step_record_493_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 493 should not be duplicated */
+SYNTHETIC_result_t step_record_493_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 494 exists */
+SYNTHETIC_result_t step_record_494_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 494 has value 3458 */
+SYNTHETIC_result_t step_record_494_has_value_3458(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 494 is updated */
+SYNTHETIC_result_t step_record_494_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 494 should be saved */
+SYNTHETIC_result_t step_record_494_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 494 should not be duplicated */
+SYNTHETIC_result_t step_record_494_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 495 exists */
+SYNTHETIC_result_t step_record_495_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 495 has value 3465 */
+SYNTHETIC_result_t step_record_495_has_value_3465(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 495 is updated */
+SYNTHETIC_result_t step_record_495_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 495 should be saved */
+SYNTHETIC_result_t step_record_495_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 495 should not be duplicated */
+SYNTHETIC_result_t step_record_495_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 496 exists */
+SYNTHETIC_result_t step_record_496_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 496 has value 3472 */
+SYNTHETIC_result_t step_record_496_has_value_3472(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 496 is updated */
+SYNTHETIC_result_t step_record_496_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 496 should be saved */
+SYNTHETIC_result_t step_record_496_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 496 should not be duplicated */
+SYNTHETIC_result_t step_record_496_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 497 exists */
+SYNTHETIC_result_t step_record_497_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 497 has value 3479 */
+SYNTHETIC_result_t step_record_497_has_value_3479(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 497 is updated */
+SYNTHETIC_result_t step_record_497_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 497 should be saved */
+SYNTHETIC_result_t step_record_497_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 497 should not be duplicated */
+SYNTHETIC_result_t step_record_497_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 498 exists */
+SYNTHETIC_result_t step_record_498_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 498 has value 3486 */
+SYNTHETIC_result_t step_record_498_has_value_3486(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 498 is updated */
+SYNTHETIC_result_t step_record_498_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 498 should be saved */
+SYNTHETIC_result_t step_record_498_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 498 should not be duplicated */
+SYNTHETIC_result_t step_record_498_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 499 exists */
+SYNTHETIC_result_t step_record_499_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 499 has value 3493 */
+SYNTHETIC_result_t step_record_499_has_value_3493(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 499 is updated */
+SYNTHETIC_result_t step_record_499_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 499 should be saved */
+SYNTHETIC_result_t step_record_499_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 499 should not be duplicated */
+SYNTHETIC_result_t step_record_499_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 500 exists */
+SYNTHETIC_result_t step_record_500_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 500 has value 3500 */
+SYNTHETIC_result_t step_record_500_has_value_3500(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 500 is updated */
+SYNTHETIC_result_t step_record_500_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 500 should be saved */
+SYNTHETIC_result_t step_record_500_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 500 should not be duplicated */
+SYNTHETIC_result_t step_record_500_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 501 exists */
+SYNTHETIC_result_t step_record_501_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 501 has value 3507 */
+SYNTHETIC_result_t step_record_501_has_value_3507(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 501 is updated */
+SYNTHETIC_result_t step_record_501_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 501 should be saved */
+SYNTHETIC_result_t step_record_501_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 501 should not be duplicated */
+SYNTHETIC_result_t step_record_501_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 502 exists */
+SYNTHETIC_result_t step_record_502_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 502 has value 3514 */
+SYNTHETIC_result_t step_record_502_has_value_3514(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 502 is updated */
+SYNTHETIC_result_t step_record_502_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 502 should be saved */
+SYNTHETIC_result_t step_record_502_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 502 should not be duplicated */
+SYNTHETIC_result_t step_record_502_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 503 exists */
+SYNTHETIC_result_t step_record_503_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 503 has value 3521 */
+SYNTHETIC_result_t step_record_503_has_value_3521(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 503 is updated */
+SYNTHETIC_result_t step_record_503_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 503 should be saved */
+SYNTHETIC_result_t step_record_503_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 503 should not be duplicated */
+SYNTHETIC_result_t step_record_503_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 504 exists */
+SYNTHETIC_result_t step_record_504_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 504 has value 3528 */
+SYNTHETIC_result_t step_record_504_has_value_3528(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 504 is updated */
+SYNTHETIC_result_t step_record_504_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 504 should be saved */
+SYNTHETIC_result_t step_record_504_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 504 should not be duplicated */
+SYNTHETIC_result_t step_record_504_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 505 exists */
+SYNTHETIC_result_t step_record_505_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 505 has value 3535 */
+SYNTHETIC_result_t step_record_505_has_value_3535(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 505 is updated */
+SYNTHETIC_result_t step_record_505_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 505 should be saved */
+SYNTHETIC_result_t step_record_505_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 505 should not be duplicated */
+SYNTHETIC_result_t step_record_505_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 506 exists */
+SYNTHETIC_result_t step_record_506_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 506 has value 3542 */
+SYNTHETIC_result_t step_record_506_has_value_3542(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 506 is updated */
+SYNTHETIC_result_t step_record_506_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 506 should be saved */
+SYNTHETIC_result_t step_record_506_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 506 should not be duplicated */
+SYNTHETIC_result_t step_record_506_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 507 exists */
+SYNTHETIC_result_t step_record_507_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 507 has value 3549 */
+SYNTHETIC_result_t step_record_507_has_value_3549(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 507 is updated */
+SYNTHETIC_result_t step_record_507_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 507 should be saved */
+SYNTHETIC_result_t step_record_507_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 507 should not be duplicated */
+SYNTHETIC_result_t step_record_507_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 508 exists */
+SYNTHETIC_result_t step_record_508_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 508 has value 3556 */
+SYNTHETIC_result_t step_record_508_has_value_3556(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 508 is updated */
+SYNTHETIC_result_t step_record_508_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 508 should be saved */
+SYNTHETIC_result_t step_record_508_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 508 should not be duplicated */
+SYNTHETIC_result_t step_record_508_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 509 exists */
+SYNTHETIC_result_t step_record_509_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 509 has value 3563 */
+SYNTHETIC_result_t step_record_509_has_value_3563(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 509 is updated */
+SYNTHETIC_result_t step_record_509_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 509 should be saved */
+SYNTHETIC_result_t step_record_509_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 509 should not be duplicated */
+SYNTHETIC_result_t step_record_509_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 510 exists */
+SYNTHETIC_result_t step_record_510_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 510 has value 3570 */
+SYNTHETIC_result_t step_record_510_has_value_3570(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 510 is updated */
+SYNTHETIC_result_t step_record_510_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 510 should be saved */
+SYNTHETIC_result_t step_record_510_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 510 should not be duplicated */
+SYNTHETIC_result_t step_record_510_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 511 exists */
+SYNTHETIC_result_t step_record_511_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 511 has value 3577 */
+SYNTHETIC_result_t step_record_511_has_value_3577(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 511 is updated */
+SYNTHETIC_result_t step_record_511_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 511 should be saved */
+SYNTHETIC_result_t step_record_511_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 511 should not be duplicated */
+SYNTHETIC_result_t step_record_511_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 512 exists */
+SYNTHETIC_result_t step_record_512_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 512 has value 3584 */
+SYNTHETIC_result_t step_record_512_has_value_3584(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 512 is updated */
+SYNTHETIC_result_t step_record_512_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 512 should be saved */
+SYNTHETIC_result_t step_record_512_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 512 should not be duplicated */
+SYNTHETIC_result_t step_record_512_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 513 exists */
+SYNTHETIC_result_t step_record_513_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 513 has value 3591 */
+SYNTHETIC_result_t step_record_513_has_value_3591(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 513 is updated */
+SYNTHETIC_result_t step_record_513_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 513 should be saved */
+SYNTHETIC_result_t step_record_513_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 513 should not be duplicated */
+SYNTHETIC_result_t step_record_513_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 514 exists */
+SYNTHETIC_result_t step_record_514_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 514 has value 3598 */
+SYNTHETIC_result_t step_record_514_has_value_3598(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 514 is updated */
+SYNTHETIC_result_t step_record_514_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 514 should be saved */
+SYNTHETIC_result_t step_record_514_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 514 should not be duplicated */
+SYNTHETIC_result_t step_record_514_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 515 exists */
+SYNTHETIC_result_t step_record_515_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 515 has value 3605 */
+SYNTHETIC_result_t step_record_515_has_value_3605(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 515 is updated */
+SYNTHETIC_result_t step_record_515_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 515 should be saved */
+SYNTHETIC_result_t step_record_515_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 515 should not be duplicated */
+SYNTHETIC_result_t step_record_515_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 516 exists */
+SYNTHETIC_result_t step_record_516_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 516 has value 3612 */
+SYNTHETIC_result_t step_record_516_has_value_3612(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 516 is updated */
+SYNTHETIC_result_t step_record_516_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 516 should be saved */
+SYNTHETIC_result_t step_record_516_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 516 should not be duplicated */
+SYNTHETIC_result_t step_record_516_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 517 exists */
+SYNTHETIC_result_t step_record_517_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 517 has value 3619 */
+SYNTHETIC_result_t step_record_517_has_value_3619(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 517 is updated */
+SYNTHETIC_result_t step_record_517_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 517 should be saved */
+SYNTHETIC_result_t step_record_517_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 517 should not be duplicated */
+SYNTHETIC_result_t step_record_517_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 518 exists */
+SYNTHETIC_result_t step_record_518_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 518 has value 3626 */
+SYNTHETIC_result_t step_record_518_has_value_3626(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 518 is updated */
+SYNTHETIC_result_t step_record_518_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 518 should be saved */
+SYNTHETIC_result_t step_record_518_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 518 should not be duplicated */
+SYNTHETIC_result_t step_record_518_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 519 exists */
+SYNTHETIC_result_t step_record_519_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 519 has value 3633 */
+SYNTHETIC_result_t step_record_519_has_value_3633(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 519 is updated */
+SYNTHETIC_result_t step_record_519_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 519 should be saved */
+SYNTHETIC_result_t step_record_519_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 519 should not be duplicated */
+SYNTHETIC_result_t step_record_519_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 520 exists */
+SYNTHETIC_result_t step_record_520_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 520 has value 3640 */
+SYNTHETIC_result_t step_record_520_has_value_3640(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 520 is updated */
+SYNTHETIC_result_t step_record_520_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 520 should be saved */
+SYNTHETIC_result_t step_record_520_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 520 should not be duplicated */
+SYNTHETIC_result_t step_record_520_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 521 exists */
+SYNTHETIC_result_t step_record_521_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 521 has value 3647 */
+SYNTHETIC_result_t step_record_521_has_value_3647(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 521 is updated */
+SYNTHETIC_result_t step_record_521_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 521 should be saved */
+SYNTHETIC_result_t step_record_521_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 521 should not be duplicated */
+SYNTHETIC_result_t step_record_521_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 522 exists */
+SYNTHETIC_result_t step_record_522_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 522 has value 3654 */
+SYNTHETIC_result_t step_record_522_has_value_3654(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 522 is updated */
+SYNTHETIC_result_t step_record_522_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 522 should be saved */
+SYNTHETIC_result_t step_record_522_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 522 should not be duplicated */
+SYNTHETIC_result_t step_record_522_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 523 exists */
+SYNTHETIC_result_t step_record_523_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 523 has value 3661 */
+SYNTHETIC_result_t step_record_523_has_value_3661(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 523 is updated */
+SYNTHETIC_result_t step_record_523_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 523 should be saved */
+SYNTHETIC_result_t step_record_523_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 523 should not be duplicated */
+SYNTHETIC_result_t step_record_523_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 524 exists */
+SYNTHETIC_result_t step_record_524_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 524 has value 3668 */
+SYNTHETIC_result_t step_record_524_has_value_3668(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 524 is updated */
+SYNTHETIC_result_t step_record_524_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 524 should be saved */
+SYNTHETIC_result_t step_record_524_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 524 should not be duplicated */
+SYNTHETIC_result_t step_record_524_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 525 exists */
+SYNTHETIC_result_t step_record_525_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 525 has value 3675 */
+SYNTHETIC_result_t step_record_525_has_value_3675(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 525 is updated */
+SYNTHETIC_result_t step_record_525_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 525 should be saved */
+SYNTHETIC_result_t step_record_525_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 525 should not be duplicated */
+SYNTHETIC_result_t step_record_525_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 526 exists */
+SYNTHETIC_result_t step_record_526_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 526 has value 3682 */
+SYNTHETIC_result_t step_record_526_has_value_3682(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 526 is updated */
+SYNTHETIC_result_t step_record_526_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 526 should be saved */
+SYNTHETIC_result_t step_record_526_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 526 should not be duplicated */
+SYNTHETIC_result_t step_record_526_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 527 exists */
+SYNTHETIC_result_t step_record_527_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 527 has value 3689 */
+SYNTHETIC_result_t step_record_527_has_value_3689(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 527 is updated */
+SYNTHETIC_result_t step_record_527_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 527 should be saved */
+SYNTHETIC_result_t step_record_527_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 527 should not be duplicated */
+SYNTHETIC_result_t step_record_527_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 528 exists */
+SYNTHETIC_result_t step_record_528_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 528 has value 3696 */
+SYNTHETIC_result_t step_record_528_has_value_3696(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 528 is updated */
+SYNTHETIC_result_t step_record_528_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 528 should be saved */
+SYNTHETIC_result_t step_record_528_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 528 should not be duplicated */
+SYNTHETIC_result_t step_record_528_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 529 exists */
+SYNTHETIC_result_t step_record_529_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 529 has value 3703 */
+SYNTHETIC_result_t step_record_529_has_value_3703(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 529 is updated */
+SYNTHETIC_result_t step_record_529_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 529 should be saved */
+SYNTHETIC_result_t step_record_529_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 529 should not be duplicated */
+SYNTHETIC_result_t step_record_529_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 530 exists */
+SYNTHETIC_result_t step_record_530_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 530 has value 3710 */
+SYNTHETIC_result_t step_record_530_has_value_3710(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 530 is updated */
+SYNTHETIC_result_t step_record_530_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 530 should be saved */
+SYNTHETIC_result_t step_record_530_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 530 should not be duplicated */
+SYNTHETIC_result_t step_record_530_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 531 exists */
+SYNTHETIC_result_t step_record_531_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 531 has value 3717 */
+SYNTHETIC_result_t step_record_531_has_value_3717(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 531 is updated */
+SYNTHETIC_result_t step_record_531_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 531 should be saved */
+SYNTHETIC_result_t step_record_531_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 531 should not be duplicated */
+SYNTHETIC_result_t step_record_531_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 532 exists */
+SYNTHETIC_result_t step_record_532_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 532 has value 3724 */
+SYNTHETIC_result_t step_record_532_has_value_3724(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 532 is updated */
+SYNTHETIC_result_t step_record_532_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 532 should be saved */
+SYNTHETIC_result_t step_record_532_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 532 should not be duplicated */
+SYNTHETIC_result_t step_record_532_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 533 exists */
+SYNTHETIC_result_t step_record_533_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 533 has value 3731 */
+SYNTHETIC_result_t step_record_533_has_value_3731(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 533 is updated */
+SYNTHETIC_result_t step_record_533_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 533 should be saved */
+SYNTHETIC_result_t step_record_533_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 533 should not be duplicated */
+SYNTHETIC_result_t step_record_533_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 534 exists */
+SYNTHETIC_result_t step_record_534_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 534 has value 3738 */
+SYNTHETIC_result_t step_record_534_has_value_3738(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 534 is updated */
+SYNTHETIC_result_t step_record_534_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 534 should be saved */
+SYNTHETIC_result_t step_record_534_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 534 should not be duplicated */
+SYNTHETIC_result_t step_record_534_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 535 exists */
+SYNTHETIC_result_t step_record_535_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 535 has value 3745 */
+SYNTHETIC_result_t step_record_535_has_value_3745(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 535 is updated */
+SYNTHETIC_result_t step_record_535_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 535 should be saved */
+SYNTHETIC_result_t step_record_535_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 535 should not be duplicated */
+SYNTHETIC_result_t step_record_535_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 536 exists */
+SYNTHETIC_result_t step_record_536_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 536 has value 3752 */
+SYNTHETIC_result_t step_record_536_has_value_3752(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 536 is updated */
+SYNTHETIC_result_t step_record_536_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 536 should be saved */
+SYNTHETIC_result_t step_record_536_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 536 should not be duplicated */
+SYNTHETIC_result_t step_record_536_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 537 exists */
+SYNTHETIC_result_t step_record_537_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 537 has value 3759 */
+SYNTHETIC_result_t step_record_537_has_value_3759(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 537 is updated */
+SYNTHETIC_result_t step_record_537_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 537 should be saved */
+SYNTHETIC_result_t step_record_537_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 537 should not be duplicated */
+SYNTHETIC_result_t step_record_537_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 538 exists */
+SYNTHETIC_result_t step_record_538_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 538 has value 3766 */
+SYNTHETIC_result_t step_record_538_has_value_3766(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 538 is updated */
+SYNTHETIC_result_t step_record_538_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 538 should be saved */
+SYNTHETIC_result_t step_record_538_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 538 should not be duplicated */
+SYNTHETIC_result_t step_record_538_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 539 exists */
+SYNTHETIC_result_t step_record_539_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 539 has value 3773 */
+SYNTHETIC_result_t step_record_539_has_value_3773(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 539 is updated */
+SYNTHETIC_result_t step_record_539_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 539 should be saved */
+SYNTHETIC_result_t step_record_539_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 539 should not be duplicated */
+SYNTHETIC_result_t step_record_539_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 540 exists */
+SYNTHETIC_result_t step_record_540_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 540 has value 3780 */
+SYNTHETIC_result_t step_record_540_has_value_3780(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 540 is updated */
+SYNTHETIC_result_t step_record_540_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 540 should be saved */
+SYNTHETIC_result_t step_record_540_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 540 should not be duplicated */
+SYNTHETIC_result_t step_record_540_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 541 exists */
+SYNTHETIC_result_t step_record_541_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 541 has value 3787 */
+SYNTHETIC_result_t step_record_541_has_value_3787(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 541 is updated */
+SYNTHETIC_result_t step_record_541_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 541 should be saved */
+SYNTHETIC_result_t step_record_541_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 541 should not be duplicated */
+SYNTHETIC_result_t step_record_541_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 542 exists */
+SYNTHETIC_result_t step_record_542_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 542 has value 3794 */
+SYNTHETIC_result_t step_record_542_has_value_3794(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 542 is updated */
+SYNTHETIC_result_t step_record_542_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 542 should be saved */
+SYNTHETIC_result_t step_record_542_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 542 should not be duplicated */
+SYNTHETIC_result_t step_record_542_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 543 exists */
+SYNTHETIC_result_t step_record_543_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 543 has value 3801 */
+SYNTHETIC_result_t step_record_543_has_value_3801(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 543 is updated */
+SYNTHETIC_result_t step_record_543_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 543 should be saved */
+SYNTHETIC_result_t step_record_543_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 543 should not be duplicated */
+SYNTHETIC_result_t step_record_543_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 544 exists */
+SYNTHETIC_result_t step_record_544_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 544 has value 3808 */
+SYNTHETIC_result_t step_record_544_has_value_3808(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 544 is updated */
+SYNTHETIC_result_t step_record_544_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 544 should be saved */
+SYNTHETIC_result_t step_record_544_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 544 should not be duplicated */
+SYNTHETIC_result_t step_record_544_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 545 exists */
+SYNTHETIC_result_t step_record_545_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 545 has value 3815 */
+SYNTHETIC_result_t step_record_545_has_value_3815(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 545 is updated */
+SYNTHETIC_result_t step_record_545_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 545 should be saved */
+SYNTHETIC_result_t step_record_545_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 545 should not be duplicated */
+SYNTHETIC_result_t step_record_545_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 546 exists */
+SYNTHETIC_result_t step_record_546_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 546 has value 3822 */
+SYNTHETIC_result_t step_record_546_has_value_3822(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 546 is updated */
+SYNTHETIC_result_t step_record_546_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 546 should be saved */
+SYNTHETIC_result_t step_record_546_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 546 should not be duplicated */
+SYNTHETIC_result_t step_record_546_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 547 exists */
+SYNTHETIC_result_t step_record_547_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 547 has value 3829 */
+SYNTHETIC_result_t step_record_547_has_value_3829(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 547 is updated */
+SYNTHETIC_result_t step_record_547_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 547 should be saved */
+SYNTHETIC_result_t step_record_547_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 547 should not be duplicated */
+SYNTHETIC_result_t step_record_547_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 548 exists */
+SYNTHETIC_result_t step_record_548_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 548 has value 3836 */
+SYNTHETIC_result_t step_record_548_has_value_3836(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 548 is updated */
+SYNTHETIC_result_t step_record_548_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 548 should be saved */
+SYNTHETIC_result_t step_record_548_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 548 should not be duplicated */
+SYNTHETIC_result_t step_record_548_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 549 exists */
+SYNTHETIC_result_t step_record_549_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 549 has value 3843 */
+SYNTHETIC_result_t step_record_549_has_value_3843(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 549 is updated */
+SYNTHETIC_result_t step_record_549_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 549 should be saved */
+SYNTHETIC_result_t step_record_549_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 549 should not be duplicated */
+SYNTHETIC_result_t step_record_549_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 550 exists */
+SYNTHETIC_result_t step_record_550_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 550 has value 3850 */
+SYNTHETIC_result_t step_record_550_has_value_3850(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 550 is updated */
+SYNTHETIC_result_t step_record_550_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 550 should be saved */
+SYNTHETIC_result_t step_record_550_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 550 should not be duplicated */
+SYNTHETIC_result_t step_record_550_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 551 exists */
+SYNTHETIC_result_t step_record_551_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 551 has value 3857 */
+SYNTHETIC_result_t step_record_551_has_value_3857(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 551 is updated */
+SYNTHETIC_result_t step_record_551_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 551 should be saved */
+SYNTHETIC_result_t step_record_551_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 551 should not be duplicated */
+SYNTHETIC_result_t step_record_551_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 552 exists */
+SYNTHETIC_result_t step_record_552_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 552 has value 3864 */
+SYNTHETIC_result_t step_record_552_has_value_3864(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 552 is updated */
+SYNTHETIC_result_t step_record_552_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 552 should be saved */
+SYNTHETIC_result_t step_record_552_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 552 should not be duplicated */
+SYNTHETIC_result_t step_record_552_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 553 exists */
+SYNTHETIC_result_t step_record_553_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 553 has value 3871 */
+SYNTHETIC_result_t step_record_553_has_value_3871(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 553 is updated */
+SYNTHETIC_result_t step_record_553_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 553 should be saved */
+SYNTHETIC_result_t step_record_553_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 553 should not be duplicated */
+SYNTHETIC_result_t step_record_553_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 554 exists */
+SYNTHETIC_result_t step_record_554_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 554 has value 3878 */
+SYNTHETIC_result_t step_record_554_has_value_3878(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 554 is updated */
+SYNTHETIC_result_t step_record_554_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 554 should be saved */
+SYNTHETIC_result_t step_record_554_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 554 should not be duplicated */
+SYNTHETIC_result_t step_record_554_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 555 exists */
+SYNTHETIC_result_t step_record_555_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 555 has value 3885 */
+SYNTHETIC_result_t step_record_555_has_value_3885(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 555 is updated */
+SYNTHETIC_result_t step_record_555_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 555 should be saved */
+SYNTHETIC_result_t step_record_555_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 555 should not be duplicated */
+SYNTHETIC_result_t step_record_555_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 556 exists */
+SYNTHETIC_result_t step_record_556_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 556 has value 3892 */
+SYNTHETIC_result_t step_record_556_has_value_3892(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 556 is updated */
+SYNTHETIC_result_t step_record_556_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 556 should be saved */
+SYNTHETIC_result_t step_record_556_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 556 should not be duplicated */
+SYNTHETIC_result_t step_record_556_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 557 exists */
+SYNTHETIC_result_t step_record_557_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 557 has value 3899 */
+SYNTHETIC_result_t step_record_557_has_value_3899(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 557 is updated */
+SYNTHETIC_result_t step_record_557_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 557 should be saved */
+SYNTHETIC_result_t step_record_557_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 557 should not be duplicated */
+SYNTHETIC_result_t step_record_557_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 558 exists */
+SYNTHETIC_result_t step_record_558_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 558 has value 3906 */
+SYNTHETIC_result_t step_record_558_has_value_3906(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 558 is updated */
+SYNTHETIC_result_t step_record_558_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 558 should be saved */
+SYNTHETIC_result_t step_record_558_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 558 should not be duplicated */
+SYNTHETIC_result_t step_record_558_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 559 exists */
+SYNTHETIC_result_t step_record_559_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 559 has value 3913 */
+SYNTHETIC_result_t step_record_559_has_value_3913(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 559 is updated */
+SYNTHETIC_result_t step_record_559_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 559 should be saved */
+SYNTHETIC_result_t step_record_559_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 559 should not be duplicated */
+SYNTHETIC_result_t step_record_559_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 560 exists */
+SYNTHETIC_result_t step_record_560_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 560 has value 3920 */
+SYNTHETIC_result_t step_record_560_has_value_3920(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 560 is updated */
+SYNTHETIC_result_t step_record_560_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 560 should be saved */
+SYNTHETIC_result_t step_record_560_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 560 should not be duplicated */
+SYNTHETIC_result_t step_record_560_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 561 exists */
+SYNTHETIC_result_t step_record_561_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 561 has value 3927 */
+SYNTHETIC_result_t step_record_561_has_value_3927(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 561 is updated */
+SYNTHETIC_result_t step_record_561_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 561 should be saved */
+SYNTHETIC_result_t step_record_561_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 561 should not be duplicated */
+SYNTHETIC_result_t step_record_561_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 562 exists */
+SYNTHETIC_result_t step_record_562_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 562 has value 3934 */
+SYNTHETIC_result_t step_record_562_has_value_3934(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 562 is updated */
+SYNTHETIC_result_t step_record_562_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 562 should be saved */
+SYNTHETIC_result_t step_record_562_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 562 should not be duplicated */
+SYNTHETIC_result_t step_record_562_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 563 exists */
+SYNTHETIC_result_t step_record_563_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 563 has value 3941 */
+SYNTHETIC_result_t step_record_563_has_value_3941(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 563 is updated */
+SYNTHETIC_result_t step_record_563_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 563 should be saved */
+SYNTHETIC_result_t step_record_563_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 563 should not be duplicated */
+SYNTHETIC_result_t step_record_563_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 564 exists */
+SYNTHETIC_result_t step_record_564_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 564 has value 3948 */
+SYNTHETIC_result_t step_record_564_has_value_3948(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 564 is updated */
+SYNTHETIC_result_t step_record_564_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 564 should be saved */
+SYNTHETIC_result_t step_record_564_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 564 should not be duplicated */
+SYNTHETIC_result_t step_record_564_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 565 exists */
+SYNTHETIC_result_t step_record_565_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 565 has value 3955 */
+SYNTHETIC_result_t step_record_565_has_value_3955(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 565 is updated */
+SYNTHETIC_result_t step_record_565_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 565 should be saved */
+SYNTHETIC_result_t step_record_565_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 565 should not be duplicated */
+SYNTHETIC_result_t step_record_565_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 566 exists */
+SYNTHETIC_result_t step_record_566_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 566 has value 3962 */
+SYNTHETIC_result_t step_record_566_has_value_3962(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 566 is updated */
+SYNTHETIC_result_t step_record_566_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 566 should be saved */
+SYNTHETIC_result_t step_record_566_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 566 should not be duplicated */
+SYNTHETIC_result_t step_record_566_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 567 exists */
+SYNTHETIC_result_t step_record_567_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 567 has value 3969 */
+SYNTHETIC_result_t step_record_567_has_value_3969(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 567 is updated */
+SYNTHETIC_result_t step_record_567_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 567 should be saved */
+SYNTHETIC_result_t step_record_567_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 567 should not be duplicated */
+SYNTHETIC_result_t step_record_567_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 568 exists */
+SYNTHETIC_result_t step_record_568_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 568 has value 3976 */
+SYNTHETIC_result_t step_record_568_has_value_3976(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 568 is updated */
+SYNTHETIC_result_t step_record_568_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 568 should be saved */
+SYNTHETIC_result_t step_record_568_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 568 should not be duplicated */
+SYNTHETIC_result_t step_record_568_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 569 exists */
+SYNTHETIC_result_t step_record_569_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 569 has value 3983 */
+SYNTHETIC_result_t step_record_569_has_value_3983(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 569 is updated */
+SYNTHETIC_result_t step_record_569_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 569 should be saved */
+SYNTHETIC_result_t step_record_569_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 569 should not be duplicated */
+SYNTHETIC_result_t step_record_569_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 570 exists */
+SYNTHETIC_result_t step_record_570_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 570 has value 3990 */
+SYNTHETIC_result_t step_record_570_has_value_3990(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 570 is updated */
+SYNTHETIC_result_t step_record_570_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 570 should be saved */
+SYNTHETIC_result_t step_record_570_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 570 should not be duplicated */
+SYNTHETIC_result_t step_record_570_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 571 exists */
+SYNTHETIC_result_t step_record_571_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 571 has value 3997 */
+SYNTHETIC_result_t step_record_571_has_value_3997(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 571 is updated */
+SYNTHETIC_result_t step_record_571_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 571 should be saved */
+SYNTHETIC_result_t step_record_571_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 571 should not be duplicated */
+SYNTHETIC_result_t step_record_571_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 572 exists */
+SYNTHETIC_result_t step_record_572_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 572 has value 4004 */
+SYNTHETIC_result_t step_record_572_has_value_4004(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 572 is updated */
+SYNTHETIC_result_t step_record_572_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 572 should be saved */
+SYNTHETIC_result_t step_record_572_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 572 should not be duplicated */
+SYNTHETIC_result_t step_record_572_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 573 exists */
+SYNTHETIC_result_t step_record_573_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 573 has value 4011 */
+SYNTHETIC_result_t step_record_573_has_value_4011(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 573 is updated */
+SYNTHETIC_result_t step_record_573_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 573 should be saved */
+SYNTHETIC_result_t step_record_573_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 573 should not be duplicated */
+SYNTHETIC_result_t step_record_573_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 574 exists */
+SYNTHETIC_result_t step_record_574_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 574 has value 4018 */
+SYNTHETIC_result_t step_record_574_has_value_4018(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 574 is updated */
+SYNTHETIC_result_t step_record_574_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 574 should be saved */
+SYNTHETIC_result_t step_record_574_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 574 should not be duplicated */
+SYNTHETIC_result_t step_record_574_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 575 exists */
+SYNTHETIC_result_t step_record_575_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 575 has value 4025 */
+SYNTHETIC_result_t step_record_575_has_value_4025(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 575 is updated */
+SYNTHETIC_result_t step_record_575_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 575 should be saved */
+SYNTHETIC_result_t step_record_575_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 575 should not be duplicated */
+SYNTHETIC_result_t step_record_575_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 576 exists */
+SYNTHETIC_result_t step_record_576_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 576 has value 4032 */
+SYNTHETIC_result_t step_record_576_has_value_4032(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 576 is updated */
+SYNTHETIC_result_t step_record_576_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 576 should be saved */
+SYNTHETIC_result_t step_record_576_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 576 should not be duplicated */
+SYNTHETIC_result_t step_record_576_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 577 exists */
+SYNTHETIC_result_t step_record_577_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 577 has value 4039 */
+SYNTHETIC_result_t step_record_577_has_value_4039(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 577 is updated */
+SYNTHETIC_result_t step_record_577_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 577 should be saved */
+SYNTHETIC_result_t step_record_577_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 577 should not be duplicated */
+SYNTHETIC_result_t step_record_577_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 578 exists */
+SYNTHETIC_result_t step_record_578_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 578 has value 4046 */
+SYNTHETIC_result_t step_record_578_has_value_4046(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 578 is updated */
+SYNTHETIC_result_t step_record_578_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 578 should be saved */
+SYNTHETIC_result_t step_record_578_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 578 should not be duplicated */
+SYNTHETIC_result_t step_record_578_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 579 exists */
+SYNTHETIC_result_t step_record_579_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 579 has value 4053 */
+SYNTHETIC_result_t step_record_579_has_value_4053(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 579 is updated */
+SYNTHETIC_result_t step_record_579_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 579 should be saved */
+SYNTHETIC_result_t step_record_579_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 579 should not be duplicated */
+SYNTHETIC_result_t step_record_579_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 580 exists */
+SYNTHETIC_result_t step_record_580_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 580 has value 4060 */
+SYNTHETIC_result_t step_record_580_has_value_4060(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 580 is updated */
+SYNTHETIC_result_t step_record_580_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 580 should be saved */
+SYNTHETIC_result_t step_record_580_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 580 should not be duplicated */
+SYNTHETIC_result_t step_record_580_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 581 exists */
+SYNTHETIC_result_t step_record_581_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 581 has value 4067 */
+SYNTHETIC_result_t step_record_581_has_value_4067(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 581 is updated */
+SYNTHETIC_result_t step_record_581_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 581 should be saved */
+SYNTHETIC_result_t step_record_581_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 581 should not be duplicated */
+SYNTHETIC_result_t step_record_581_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 582 exists */
+SYNTHETIC_result_t step_record_582_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 582 has value 4074 */
+SYNTHETIC_result_t step_record_582_has_value_4074(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 582 is updated */
+SYNTHETIC_result_t step_record_582_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 582 should be saved */
+SYNTHETIC_result_t step_record_582_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 582 should not be duplicated */
+SYNTHETIC_result_t step_record_582_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 583 exists */
+SYNTHETIC_result_t step_record_583_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 583 has value 4081 */
+SYNTHETIC_result_t step_record_583_has_value_4081(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 583 is updated */
+SYNTHETIC_result_t step_record_583_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 583 should be saved */
+SYNTHETIC_result_t step_record_583_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 583 should not be duplicated */
+SYNTHETIC_result_t step_record_583_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 584 exists */
+SYNTHETIC_result_t step_record_584_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 584 has value 4088 */
+SYNTHETIC_result_t step_record_584_has_value_4088(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 584 is updated */
+SYNTHETIC_result_t step_record_584_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 584 should be saved */
+SYNTHETIC_result_t step_record_584_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 584 should not be duplicated */
+SYNTHETIC_result_t step_record_584_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 585 exists */
+SYNTHETIC_result_t step_record_585_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 585 has value 4095 */
+SYNTHETIC_result_t step_record_585_has_value_4095(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 585 is updated */
+SYNTHETIC_result_t step_record_585_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 585 should be saved */
+SYNTHETIC_result_t step_record_585_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 585 should not be duplicated */
+SYNTHETIC_result_t step_record_585_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 586 exists */
+SYNTHETIC_result_t step_record_586_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 586 has value 4102 */
+SYNTHETIC_result_t step_record_586_has_value_4102(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 586 is updated */
+SYNTHETIC_result_t step_record_586_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 586 should be saved */
+SYNTHETIC_result_t step_record_586_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 586 should not be duplicated */
+SYNTHETIC_result_t step_record_586_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 587 exists */
+SYNTHETIC_result_t step_record_587_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 587 has value 4109 */
+SYNTHETIC_result_t step_record_587_has_value_4109(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 587 is updated */
+SYNTHETIC_result_t step_record_587_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 587 should be saved */
+SYNTHETIC_result_t step_record_587_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 587 should not be duplicated */
+SYNTHETIC_result_t step_record_587_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 588 exists */
+SYNTHETIC_result_t step_record_588_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 588 has value 4116 */
+SYNTHETIC_result_t step_record_588_has_value_4116(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 588 is updated */
+SYNTHETIC_result_t step_record_588_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 588 should be saved */
+SYNTHETIC_result_t step_record_588_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 588 should not be duplicated */
+SYNTHETIC_result_t step_record_588_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 589 exists */
+SYNTHETIC_result_t step_record_589_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 589 has value 4123 */
+SYNTHETIC_result_t step_record_589_has_value_4123(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 589 is updated */
+SYNTHETIC_result_t step_record_589_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 589 should be saved */
+SYNTHETIC_result_t step_record_589_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 589 should not be duplicated */
+SYNTHETIC_result_t step_record_589_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 590 exists */
+SYNTHETIC_result_t step_record_590_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 590 has value 4130 */
+SYNTHETIC_result_t step_record_590_has_value_4130(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 590 is updated */
+SYNTHETIC_result_t step_record_590_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 590 should be saved */
+SYNTHETIC_result_t step_record_590_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 590 should not be duplicated */
+SYNTHETIC_result_t step_record_590_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 591 exists */
+SYNTHETIC_result_t step_record_591_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 591 has value 4137 */
+SYNTHETIC_result_t step_record_591_has_value_4137(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 591 is updated */
+SYNTHETIC_result_t step_record_591_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 591 should be saved */
+SYNTHETIC_result_t step_record_591_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 591 should not be duplicated */
+SYNTHETIC_result_t step_record_591_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 592 exists */
+SYNTHETIC_result_t step_record_592_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 592 has value 4144 */
+SYNTHETIC_result_t step_record_592_has_value_4144(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 592 is updated */
+SYNTHETIC_result_t step_record_592_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 592 should be saved */
+SYNTHETIC_result_t step_record_592_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 592 should not be duplicated */
+SYNTHETIC_result_t step_record_592_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 593 exists */
+SYNTHETIC_result_t step_record_593_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 593 has value 4151 */
+SYNTHETIC_result_t step_record_593_has_value_4151(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 593 is updated */
+SYNTHETIC_result_t step_record_593_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 593 should be saved */
+SYNTHETIC_result_t step_record_593_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 593 should not be duplicated */
+SYNTHETIC_result_t step_record_593_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 594 exists */
+SYNTHETIC_result_t step_record_594_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 594 has value 4158 */
+SYNTHETIC_result_t step_record_594_has_value_4158(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 594 is updated */
+SYNTHETIC_result_t step_record_594_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 594 should be saved */
+SYNTHETIC_result_t step_record_594_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 594 should not be duplicated */
+SYNTHETIC_result_t step_record_594_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 595 exists */
+SYNTHETIC_result_t step_record_595_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 595 has value 4165 */
+SYNTHETIC_result_t step_record_595_has_value_4165(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 595 is updated */
+SYNTHETIC_result_t step_record_595_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 595 should be saved */
+SYNTHETIC_result_t step_record_595_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 595 should not be duplicated */
+SYNTHETIC_result_t step_record_595_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 596 exists */
+SYNTHETIC_result_t step_record_596_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 596 has value 4172 */
+SYNTHETIC_result_t step_record_596_has_value_4172(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 596 is updated */
+SYNTHETIC_result_t step_record_596_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 596 should be saved */
+SYNTHETIC_result_t step_record_596_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 596 should not be duplicated */
+SYNTHETIC_result_t step_record_596_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 597 exists */
+SYNTHETIC_result_t step_record_597_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 597 has value 4179 */
+SYNTHETIC_result_t step_record_597_has_value_4179(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 597 is updated */
+SYNTHETIC_result_t step_record_597_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 597 should be saved */
+SYNTHETIC_result_t step_record_597_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 597 should not be duplicated */
+SYNTHETIC_result_t step_record_597_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 598 exists */
+SYNTHETIC_result_t step_record_598_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 598 has value 4186 */
+SYNTHETIC_result_t step_record_598_has_value_4186(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 598 is updated */
+SYNTHETIC_result_t step_record_598_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 598 should be saved */
+SYNTHETIC_result_t step_record_598_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 598 should not be duplicated */
+SYNTHETIC_result_t step_record_598_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 599 exists */
+SYNTHETIC_result_t step_record_599_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 599 has value 4193 */
+SYNTHETIC_result_t step_record_599_has_value_4193(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 599 is updated */
+SYNTHETIC_result_t step_record_599_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 599 should be saved */
+SYNTHETIC_result_t step_record_599_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 599 should not be duplicated */
+SYNTHETIC_result_t step_record_599_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 600 exists */
+SYNTHETIC_result_t step_record_600_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 600 has value 4200 */
+SYNTHETIC_result_t step_record_600_has_value_4200(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 600 is updated */
+SYNTHETIC_result_t step_record_600_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 600 should be saved */
+SYNTHETIC_result_t step_record_600_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 600 should not be duplicated */
+SYNTHETIC_result_t step_record_600_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 601 exists */
+SYNTHETIC_result_t step_record_601_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 601 has value 4207 */
+SYNTHETIC_result_t step_record_601_has_value_4207(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 601 is updated */
+SYNTHETIC_result_t step_record_601_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 601 should be saved */
+SYNTHETIC_result_t step_record_601_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 601 should not be duplicated */
+SYNTHETIC_result_t step_record_601_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 602 exists */
+SYNTHETIC_result_t step_record_602_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 602 has value 4214 */
+SYNTHETIC_result_t step_record_602_has_value_4214(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 602 is updated */
+SYNTHETIC_result_t step_record_602_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 602 should be saved */
+SYNTHETIC_result_t step_record_602_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 602 should not be duplicated */
+SYNTHETIC_result_t step_record_602_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 603 exists */
+SYNTHETIC_result_t step_record_603_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 603 has value 4221 */
+SYNTHETIC_result_t step_record_603_has_value_4221(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 603 is updated */
+SYNTHETIC_result_t step_record_603_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 603 should be saved */
+SYNTHETIC_result_t step_record_603_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 603 should not be duplicated */
+SYNTHETIC_result_t step_record_603_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 604 exists */
+SYNTHETIC_result_t step_record_604_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 604 has value 4228 */
+SYNTHETIC_result_t step_record_604_has_value_4228(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 604 is updated */
+SYNTHETIC_result_t step_record_604_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 604 should be saved */
+SYNTHETIC_result_t step_record_604_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 604 should not be duplicated */
+SYNTHETIC_result_t step_record_604_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 605 exists */
+SYNTHETIC_result_t step_record_605_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 605 has value 4235 */
+SYNTHETIC_result_t step_record_605_has_value_4235(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 605 is updated */
+SYNTHETIC_result_t step_record_605_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 605 should be saved */
+SYNTHETIC_result_t step_record_605_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 605 should not be duplicated */
+SYNTHETIC_result_t step_record_605_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 606 exists */
+SYNTHETIC_result_t step_record_606_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 606 has value 4242 */
+SYNTHETIC_result_t step_record_606_has_value_4242(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 606 is updated */
+SYNTHETIC_result_t step_record_606_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 606 should be saved */
+SYNTHETIC_result_t step_record_606_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 606 should not be duplicated */
+SYNTHETIC_result_t step_record_606_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 607 exists */
+SYNTHETIC_result_t step_record_607_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 607 has value 4249 */
+SYNTHETIC_result_t step_record_607_has_value_4249(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 607 is updated */
+SYNTHETIC_result_t step_record_607_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 607 should be saved */
+SYNTHETIC_result_t step_record_607_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 607 should not be duplicated */
+SYNTHETIC_result_t step_record_607_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 608 exists */
+SYNTHETIC_result_t step_record_608_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 608 has value 4256 */
+SYNTHETIC_result_t step_record_608_has_value_4256(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 608 is updated */
+SYNTHETIC_result_t step_record_608_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 608 should be saved */
+SYNTHETIC_result_t step_record_608_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 608 should not be duplicated */
+SYNTHETIC_result_t step_record_608_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 609 exists */
+SYNTHETIC_result_t step_record_609_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 609 has value 4263 */
+SYNTHETIC_result_t step_record_609_has_value_4263(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 609 is updated */
+SYNTHETIC_result_t step_record_609_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 609 should be saved */
+SYNTHETIC_result_t step_record_609_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 609 should not be duplicated */
+SYNTHETIC_result_t step_record_609_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 610 exists */
+SYNTHETIC_result_t step_record_610_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 610 has value 4270 */
+SYNTHETIC_result_t step_record_610_has_value_4270(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 610 is updated */
+SYNTHETIC_result_t step_record_610_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 610 should be saved */
+SYNTHETIC_result_t step_record_610_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 610 should not be duplicated */
+SYNTHETIC_result_t step_record_610_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 611 exists */
+SYNTHETIC_result_t step_record_611_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 611 has value 4277 */
+SYNTHETIC_result_t step_record_611_has_value_4277(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 611 is updated */
+SYNTHETIC_result_t step_record_611_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 611 should be saved */
+SYNTHETIC_result_t step_record_611_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 611 should not be duplicated */
+SYNTHETIC_result_t step_record_611_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 612 exists */
+SYNTHETIC_result_t step_record_612_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 612 has value 4284 */
+SYNTHETIC_result_t step_record_612_has_value_4284(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 612 is updated */
+SYNTHETIC_result_t step_record_612_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 612 should be saved */
+SYNTHETIC_result_t step_record_612_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 612 should not be duplicated */
+SYNTHETIC_result_t step_record_612_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 613 exists */
+SYNTHETIC_result_t step_record_613_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 613 has value 4291 */
+SYNTHETIC_result_t step_record_613_has_value_4291(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 613 is updated */
+SYNTHETIC_result_t step_record_613_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 613 should be saved */
+SYNTHETIC_result_t step_record_613_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 613 should not be duplicated */
+SYNTHETIC_result_t step_record_613_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 614 exists */
+SYNTHETIC_result_t step_record_614_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 614 has value 4298 */
+SYNTHETIC_result_t step_record_614_has_value_4298(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 614 is updated */
+SYNTHETIC_result_t step_record_614_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 614 should be saved */
+SYNTHETIC_result_t step_record_614_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 614 should not be duplicated */
+SYNTHETIC_result_t step_record_614_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 615 exists */
+SYNTHETIC_result_t step_record_615_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 615 has value 4305 */
+SYNTHETIC_result_t step_record_615_has_value_4305(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 615 is updated */
+SYNTHETIC_result_t step_record_615_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 615 should be saved */
+SYNTHETIC_result_t step_record_615_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 615 should not be duplicated */
+SYNTHETIC_result_t step_record_615_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 616 exists */
+SYNTHETIC_result_t step_record_616_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 616 has value 4312 */
+SYNTHETIC_result_t step_record_616_has_value_4312(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 616 is updated */
+SYNTHETIC_result_t step_record_616_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 616 should be saved */
+SYNTHETIC_result_t step_record_616_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 616 should not be duplicated */
+SYNTHETIC_result_t step_record_616_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 617 exists */
+SYNTHETIC_result_t step_record_617_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 617 has value 4319 */
+SYNTHETIC_result_t step_record_617_has_value_4319(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 617 is updated */
+SYNTHETIC_result_t step_record_617_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 617 should be saved */
+SYNTHETIC_result_t step_record_617_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 617 should not be duplicated */
+SYNTHETIC_result_t step_record_617_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 618 exists */
+SYNTHETIC_result_t step_record_618_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 618 has value 4326 */
+SYNTHETIC_result_t step_record_618_has_value_4326(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 618 is updated */
+SYNTHETIC_result_t step_record_618_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 618 should be saved */
+SYNTHETIC_result_t step_record_618_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 618 should not be duplicated */
+SYNTHETIC_result_t step_record_618_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 619 exists */
+SYNTHETIC_result_t step_record_619_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 619 has value 4333 */
+SYNTHETIC_result_t step_record_619_has_value_4333(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 619 is updated */
+SYNTHETIC_result_t step_record_619_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 619 should be saved */
+SYNTHETIC_result_t step_record_619_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 619 should not be duplicated */
+SYNTHETIC_result_t step_record_619_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 620 exists */
+SYNTHETIC_result_t step_record_620_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 620 has value 4340 */
+SYNTHETIC_result_t step_record_620_has_value_4340(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 620 is updated */
+SYNTHETIC_result_t step_record_620_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 620 should be saved */
+SYNTHETIC_result_t step_record_620_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 620 should not be duplicated */
+SYNTHETIC_result_t step_record_620_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 621 exists */
+SYNTHETIC_result_t step_record_621_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 621 has value 4347 */
+SYNTHETIC_result_t step_record_621_has_value_4347(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 621 is updated */
+SYNTHETIC_result_t step_record_621_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 621 should be saved */
+SYNTHETIC_result_t step_record_621_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 621 should not be duplicated */
+SYNTHETIC_result_t step_record_621_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 622 exists */
+SYNTHETIC_result_t step_record_622_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 622 has value 4354 */
+SYNTHETIC_result_t step_record_622_has_value_4354(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 622 is updated */
+SYNTHETIC_result_t step_record_622_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 622 should be saved */
+SYNTHETIC_result_t step_record_622_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 622 should not be duplicated */
+SYNTHETIC_result_t step_record_622_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 623 exists */
+SYNTHETIC_result_t step_record_623_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 623 has value 4361 */
+SYNTHETIC_result_t step_record_623_has_value_4361(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 623 is updated */
+SYNTHETIC_result_t step_record_623_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 623 should be saved */
+SYNTHETIC_result_t step_record_623_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 623 should not be duplicated */
+SYNTHETIC_result_t step_record_623_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 624 exists */
+SYNTHETIC_result_t step_record_624_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 624 has value 4368 */
+SYNTHETIC_result_t step_record_624_has_value_4368(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 624 is updated */
+SYNTHETIC_result_t step_record_624_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 624 should be saved */
+SYNTHETIC_result_t step_record_624_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 624 should not be duplicated */
+SYNTHETIC_result_t step_record_624_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 625 exists */
+SYNTHETIC_result_t step_record_625_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 625 has value 4375 */
+SYNTHETIC_result_t step_record_625_has_value_4375(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 625 is updated */
+SYNTHETIC_result_t step_record_625_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 625 should be saved */
+SYNTHETIC_result_t step_record_625_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 625 should not be duplicated */
+SYNTHETIC_result_t step_record_625_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 626 exists */
+SYNTHETIC_result_t step_record_626_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 626 has value 4382 */
+SYNTHETIC_result_t step_record_626_has_value_4382(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 626 is updated */
+SYNTHETIC_result_t step_record_626_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 626 should be saved */
+SYNTHETIC_result_t step_record_626_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 626 should not be duplicated */
+SYNTHETIC_result_t step_record_626_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 627 exists */
+SYNTHETIC_result_t step_record_627_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 627 has value 4389 */
+SYNTHETIC_result_t step_record_627_has_value_4389(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 627 is updated */
+SYNTHETIC_result_t step_record_627_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 627 should be saved */
+SYNTHETIC_result_t step_record_627_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 627 should not be duplicated */
+SYNTHETIC_result_t step_record_627_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 628 exists */
+SYNTHETIC_result_t step_record_628_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 628 has value 4396 */
+SYNTHETIC_result_t step_record_628_has_value_4396(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 628 is updated */
+SYNTHETIC_result_t step_record_628_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 628 should be saved */
+SYNTHETIC_result_t step_record_628_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 628 should not be duplicated */
+SYNTHETIC_result_t step_record_628_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 629 exists */
+SYNTHETIC_result_t step_record_629_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 629 has value 4403 */
+SYNTHETIC_result_t step_record_629_has_value_4403(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 629 is updated */
+SYNTHETIC_result_t step_record_629_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 629 should be saved */
+SYNTHETIC_result_t step_record_629_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 629 should not be duplicated */
+SYNTHETIC_result_t step_record_629_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 630 exists */
+SYNTHETIC_result_t step_record_630_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 630 has value 4410 */
+SYNTHETIC_result_t step_record_630_has_value_4410(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 630 is updated */
+SYNTHETIC_result_t step_record_630_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 630 should be saved */
+SYNTHETIC_result_t step_record_630_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 630 should not be duplicated */
+SYNTHETIC_result_t step_record_630_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 631 exists */
+SYNTHETIC_result_t step_record_631_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 631 has value 4417 */
+SYNTHETIC_result_t step_record_631_has_value_4417(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 631 is updated */
+SYNTHETIC_result_t step_record_631_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 631 should be saved */
+SYNTHETIC_result_t step_record_631_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 631 should not be duplicated */
+SYNTHETIC_result_t step_record_631_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 632 exists */
+SYNTHETIC_result_t step_record_632_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 632 has value 4424 */
+SYNTHETIC_result_t step_record_632_has_value_4424(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 632 is updated */
+SYNTHETIC_result_t step_record_632_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 632 should be saved */
+SYNTHETIC_result_t step_record_632_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 632 should not be duplicated */
+SYNTHETIC_result_t step_record_632_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 633 exists */
+SYNTHETIC_result_t step_record_633_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 633 has value 4431 */
+SYNTHETIC_result_t step_record_633_has_value_4431(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 633 is updated */
+SYNTHETIC_result_t step_record_633_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 633 should be saved */
+SYNTHETIC_result_t step_record_633_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 633 should not be duplicated */
+SYNTHETIC_result_t step_record_633_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 634 exists */
+SYNTHETIC_result_t step_record_634_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 634 has value 4438 */
+SYNTHETIC_result_t step_record_634_has_value_4438(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 634 is updated */
+SYNTHETIC_result_t step_record_634_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 634 should be saved */
+SYNTHETIC_result_t step_record_634_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 634 should not be duplicated */
+SYNTHETIC_result_t step_record_634_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 635 exists */
+SYNTHETIC_result_t step_record_635_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 635 has value 4445 */
+SYNTHETIC_result_t step_record_635_has_value_4445(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 635 is updated */
+SYNTHETIC_result_t step_record_635_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 635 should be saved */
+SYNTHETIC_result_t step_record_635_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 635 should not be duplicated */
+SYNTHETIC_result_t step_record_635_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 636 exists */
+SYNTHETIC_result_t step_record_636_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 636 has value 4452 */
+SYNTHETIC_result_t step_record_636_has_value_4452(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 636 is updated */
+SYNTHETIC_result_t step_record_636_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 636 should be saved */
+SYNTHETIC_result_t step_record_636_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 636 should not be duplicated */
+SYNTHETIC_result_t step_record_636_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 637 exists */
+SYNTHETIC_result_t step_record_637_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 637 has value 4459 */
+SYNTHETIC_result_t step_record_637_has_value_4459(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 637 is updated */
+SYNTHETIC_result_t step_record_637_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 637 should be saved */
+SYNTHETIC_result_t step_record_637_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 637 should not be duplicated */
+SYNTHETIC_result_t step_record_637_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 638 exists */
+SYNTHETIC_result_t step_record_638_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 638 has value 4466 */
+SYNTHETIC_result_t step_record_638_has_value_4466(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 638 is updated */
+SYNTHETIC_result_t step_record_638_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 638 should be saved */
+SYNTHETIC_result_t step_record_638_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 638 should not be duplicated */
+SYNTHETIC_result_t step_record_638_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 639 exists */
+SYNTHETIC_result_t step_record_639_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 639 has value 4473 */
+SYNTHETIC_result_t step_record_639_has_value_4473(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 639 is updated */
+SYNTHETIC_result_t step_record_639_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 639 should be saved */
+SYNTHETIC_result_t step_record_639_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 639 should not be duplicated */
+SYNTHETIC_result_t step_record_639_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 640 exists */
+SYNTHETIC_result_t step_record_640_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 640 has value 4480 */
+SYNTHETIC_result_t step_record_640_has_value_4480(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 640 is updated */
+SYNTHETIC_result_t step_record_640_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 640 should be saved */
+SYNTHETIC_result_t step_record_640_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 640 should not be duplicated */
+SYNTHETIC_result_t step_record_640_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 641 exists */
+SYNTHETIC_result_t step_record_641_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 641 has value 4487 */
+SYNTHETIC_result_t step_record_641_has_value_4487(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 641 is updated */
+SYNTHETIC_result_t step_record_641_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 641 should be saved */
+SYNTHETIC_result_t step_record_641_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 641 should not be duplicated */
+SYNTHETIC_result_t step_record_641_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 642 exists */
+SYNTHETIC_result_t step_record_642_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 642 has value 4494 */
+SYNTHETIC_result_t step_record_642_has_value_4494(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 642 is updated */
+SYNTHETIC_result_t step_record_642_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 642 should be saved */
+SYNTHETIC_result_t step_record_642_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 642 should not be duplicated */
+SYNTHETIC_result_t step_record_642_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 643 exists */
+SYNTHETIC_result_t step_record_643_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 643 has value 4501 */
+SYNTHETIC_result_t step_record_643_has_value_4501(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 643 is updated */
+SYNTHETIC_result_t step_record_643_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 643 should be saved */
+SYNTHETIC_result_t step_record_643_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 643 should not be duplicated */
+SYNTHETIC_result_t step_record_643_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 644 exists */
+SYNTHETIC_result_t step_record_644_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 644 has value 4508 */
+SYNTHETIC_result_t step_record_644_has_value_4508(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 644 is updated */
+SYNTHETIC_result_t step_record_644_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 644 should be saved */
+SYNTHETIC_result_t step_record_644_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 644 should not be duplicated */
+SYNTHETIC_result_t step_record_644_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 645 exists */
+SYNTHETIC_result_t step_record_645_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 645 has value 4515 */
+SYNTHETIC_result_t step_record_645_has_value_4515(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 645 is updated */
+SYNTHETIC_result_t step_record_645_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 645 should be saved */
+SYNTHETIC_result_t step_record_645_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 645 should not be duplicated */
+SYNTHETIC_result_t step_record_645_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 646 exists */
+SYNTHETIC_result_t step_record_646_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 646 has value 4522 */
+SYNTHETIC_result_t step_record_646_has_value_4522(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 646 is updated */
+SYNTHETIC_result_t step_record_646_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 646 should be saved */
+SYNTHETIC_result_t step_record_646_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 646 should not be duplicated */
+SYNTHETIC_result_t step_record_646_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 647 exists */
+SYNTHETIC_result_t step_record_647_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 647 has value 4529 */
+SYNTHETIC_result_t step_record_647_has_value_4529(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 647 is updated */
+SYNTHETIC_result_t step_record_647_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 647 should be saved */
+SYNTHETIC_result_t step_record_647_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 647 should not be duplicated */
+SYNTHETIC_result_t step_record_647_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 648 exists */
+SYNTHETIC_result_t step_record_648_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 648 has value 4536 */
+SYNTHETIC_result_t step_record_648_has_value_4536(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 648 is updated */
+SYNTHETIC_result_t step_record_648_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 648 should be saved */
+SYNTHETIC_result_t step_record_648_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 648 should not be duplicated */
+SYNTHETIC_result_t step_record_648_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 649 exists */
+SYNTHETIC_result_t step_record_649_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 649 has value 4543 */
+SYNTHETIC_result_t step_record_649_has_value_4543(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 649 is updated */
+SYNTHETIC_result_t step_record_649_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 649 should be saved */
+SYNTHETIC_result_t step_record_649_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 649 should not be duplicated */
+SYNTHETIC_result_t step_record_649_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 650 exists */
+SYNTHETIC_result_t step_record_650_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 650 has value 4550 */
+SYNTHETIC_result_t step_record_650_has_value_4550(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 650 is updated */
+SYNTHETIC_result_t step_record_650_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 650 should be saved */
+SYNTHETIC_result_t step_record_650_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 650 should not be duplicated */
+SYNTHETIC_result_t step_record_650_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 651 exists */
+SYNTHETIC_result_t step_record_651_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 651 has value 4557 */
+SYNTHETIC_result_t step_record_651_has_value_4557(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 651 is updated */
+SYNTHETIC_result_t step_record_651_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 651 should be saved */
+SYNTHETIC_result_t step_record_651_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 651 should not be duplicated */
+SYNTHETIC_result_t step_record_651_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 652 exists */
+SYNTHETIC_result_t step_record_652_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 652 has value 4564 */
+SYNTHETIC_result_t step_record_652_has_value_4564(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 652 is updated */
+SYNTHETIC_result_t step_record_652_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 652 should be saved */
+SYNTHETIC_result_t step_record_652_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 652 should not be duplicated */
+SYNTHETIC_result_t step_record_652_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 653 exists */
+SYNTHETIC_result_t step_record_653_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 653 has value 4571 */
+SYNTHETIC_result_t step_record_653_has_value_4571(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 653 is updated */
+SYNTHETIC_result_t step_record_653_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 653 should be saved */
+SYNTHETIC_result_t step_record_653_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 653 should not be duplicated */
+SYNTHETIC_result_t step_record_653_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 654 exists */
+SYNTHETIC_result_t step_record_654_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 654 has value 4578 */
+SYNTHETIC_result_t step_record_654_has_value_4578(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 654 is updated */
+SYNTHETIC_result_t step_record_654_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 654 should be saved */
+SYNTHETIC_result_t step_record_654_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 654 should not be duplicated */
+SYNTHETIC_result_t step_record_654_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 655 exists */
+SYNTHETIC_result_t step_record_655_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 655 has value 4585 */
+SYNTHETIC_result_t step_record_655_has_value_4585(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 655 is updated */
+SYNTHETIC_result_t step_record_655_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 655 should be saved */
+SYNTHETIC_result_t step_record_655_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 655 should not be duplicated */
+SYNTHETIC_result_t step_record_655_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 656 exists */
+SYNTHETIC_result_t step_record_656_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 656 has value 4592 */
+SYNTHETIC_result_t step_record_656_has_value_4592(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 656 is updated */
+SYNTHETIC_result_t step_record_656_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 656 should be saved */
+SYNTHETIC_result_t step_record_656_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 656 should not be duplicated */
+SYNTHETIC_result_t step_record_656_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 657 exists */
+SYNTHETIC_result_t step_record_657_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 657 has value 4599 */
+SYNTHETIC_result_t step_record_657_has_value_4599(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 657 is updated */
+SYNTHETIC_result_t step_record_657_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 657 should be saved */
+SYNTHETIC_result_t step_record_657_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 657 should not be duplicated */
+SYNTHETIC_result_t step_record_657_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 658 exists */
+SYNTHETIC_result_t step_record_658_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 658 has value 4606 */
+SYNTHETIC_result_t step_record_658_has_value_4606(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 658 is updated */
+SYNTHETIC_result_t step_record_658_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 658 should be saved */
+SYNTHETIC_result_t step_record_658_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 658 should not be duplicated */
+SYNTHETIC_result_t step_record_658_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 659 exists */
+SYNTHETIC_result_t step_record_659_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 659 has value 4613 */
+SYNTHETIC_result_t step_record_659_has_value_4613(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 659 is updated */
+SYNTHETIC_result_t step_record_659_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 659 should be saved */
+SYNTHETIC_result_t step_record_659_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 659 should not be duplicated */
+SYNTHETIC_result_t step_record_659_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 660 exists */
+SYNTHETIC_result_t step_record_660_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 660 has value 4620 */
+SYNTHETIC_result_t step_record_660_has_value_4620(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 660 is updated */
+SYNTHETIC_result_t step_record_660_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 660 should be saved */
+SYNTHETIC_result_t step_record_660_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 660 should not be duplicated */
+SYNTHETIC_result_t step_record_660_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 661 exists */
+SYNTHETIC_result_t step_record_661_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 661 has value 4627 */
+SYNTHETIC_result_t step_record_661_has_value_4627(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 661 is updated */
+SYNTHETIC_result_t step_record_661_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 661 should be saved */
+SYNTHETIC_result_t step_record_661_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 661 should not be duplicated */
+SYNTHETIC_result_t step_record_661_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 662 exists */
+SYNTHETIC_result_t step_record_662_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 662 has value 4634 */
+SYNTHETIC_result_t step_record_662_has_value_4634(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 662 is updated */
+SYNTHETIC_result_t step_record_662_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 662 should be saved */
+SYNTHETIC_result_t step_record_662_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 662 should not be duplicated */
+SYNTHETIC_result_t step_record_662_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 663 exists */
+SYNTHETIC_result_t step_record_663_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 663 has value 4641 */
+SYNTHETIC_result_t step_record_663_has_value_4641(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 663 is updated */
+SYNTHETIC_result_t step_record_663_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 663 should be saved */
+SYNTHETIC_result_t step_record_663_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 663 should not be duplicated */
+SYNTHETIC_result_t step_record_663_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 664 exists */
+SYNTHETIC_result_t step_record_664_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 664 has value 4648 */
+SYNTHETIC_result_t step_record_664_has_value_4648(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 664 is updated */
+SYNTHETIC_result_t step_record_664_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 664 should be saved */
+SYNTHETIC_result_t step_record_664_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 664 should not be duplicated */
+SYNTHETIC_result_t step_record_664_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 665 exists */
+SYNTHETIC_result_t step_record_665_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 665 has value 4655 */
+SYNTHETIC_result_t step_record_665_has_value_4655(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 665 is updated */
+SYNTHETIC_result_t step_record_665_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 665 should be saved */
+SYNTHETIC_result_t step_record_665_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 665 should not be duplicated */
+SYNTHETIC_result_t step_record_665_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 666 exists */
+SYNTHETIC_result_t step_record_666_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 666 has value 4662 */
+SYNTHETIC_result_t step_record_666_has_value_4662(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 666 is updated */
+SYNTHETIC_result_t step_record_666_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 666 should be saved */
+SYNTHETIC_result_t step_record_666_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 666 should not be duplicated */
+SYNTHETIC_result_t step_record_666_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 667 exists */
+SYNTHETIC_result_t step_record_667_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 667 has value 4669 */
+SYNTHETIC_result_t step_record_667_has_value_4669(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 667 is updated */
+SYNTHETIC_result_t step_record_667_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 667 should be saved */
+SYNTHETIC_result_t step_record_667_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 667 should not be duplicated */
+SYNTHETIC_result_t step_record_667_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 668 exists */
+SYNTHETIC_result_t step_record_668_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 668 has value 4676 */
+SYNTHETIC_result_t step_record_668_has_value_4676(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 668 is updated */
+SYNTHETIC_result_t step_record_668_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 668 should be saved */
+SYNTHETIC_result_t step_record_668_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 668 should not be duplicated */
+SYNTHETIC_result_t step_record_668_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 669 exists */
+SYNTHETIC_result_t step_record_669_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 669 has value 4683 */
+SYNTHETIC_result_t step_record_669_has_value_4683(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 669 is updated */
+SYNTHETIC_result_t step_record_669_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 669 should be saved */
+SYNTHETIC_result_t step_record_669_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 669 should not be duplicated */
+SYNTHETIC_result_t step_record_669_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 670 exists */
+SYNTHETIC_result_t step_record_670_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 670 has value 4690 */
+SYNTHETIC_result_t step_record_670_has_value_4690(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 670 is updated */
+SYNTHETIC_result_t step_record_670_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 670 should be saved */
+SYNTHETIC_result_t step_record_670_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 670 should not be duplicated */
+SYNTHETIC_result_t step_record_670_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 671 exists */
+SYNTHETIC_result_t step_record_671_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 671 has value 4697 */
+SYNTHETIC_result_t step_record_671_has_value_4697(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 671 is updated */
+SYNTHETIC_result_t step_record_671_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 671 should be saved */
+SYNTHETIC_result_t step_record_671_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 671 should not be duplicated */
+SYNTHETIC_result_t step_record_671_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 672 exists */
+SYNTHETIC_result_t step_record_672_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 672 has value 4704 */
+SYNTHETIC_result_t step_record_672_has_value_4704(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 672 is updated */
+SYNTHETIC_result_t step_record_672_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 672 should be saved */
+SYNTHETIC_result_t step_record_672_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 672 should not be duplicated */
+SYNTHETIC_result_t step_record_672_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 673 exists */
+SYNTHETIC_result_t step_record_673_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 673 has value 4711 */
+SYNTHETIC_result_t step_record_673_has_value_4711(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 673 is updated */
+SYNTHETIC_result_t step_record_673_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 673 should be saved */
+SYNTHETIC_result_t step_record_673_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 673 should not be duplicated */
+SYNTHETIC_result_t step_record_673_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 674 exists */
+SYNTHETIC_result_t step_record_674_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 674 has value 4718 */
+SYNTHETIC_result_t step_record_674_has_value_4718(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 674 is updated */
+SYNTHETIC_result_t step_record_674_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 674 should be saved */
+SYNTHETIC_result_t step_record_674_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 674 should not be duplicated */
+SYNTHETIC_result_t step_record_674_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 675 exists */
+SYNTHETIC_result_t step_record_675_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 675 has value 4725 */
+SYNTHETIC_result_t step_record_675_has_value_4725(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 675 is updated */
+SYNTHETIC_result_t step_record_675_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 675 should be saved */
+SYNTHETIC_result_t step_record_675_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 675 should not be duplicated */
+SYNTHETIC_result_t step_record_675_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 676 exists */
+SYNTHETIC_result_t step_record_676_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 676 has value 4732 */
+SYNTHETIC_result_t step_record_676_has_value_4732(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 676 is updated */
+SYNTHETIC_result_t step_record_676_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 676 should be saved */
+SYNTHETIC_result_t step_record_676_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 676 should not be duplicated */
+SYNTHETIC_result_t step_record_676_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 677 exists */
+SYNTHETIC_result_t step_record_677_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 677 has value 4739 */
+SYNTHETIC_result_t step_record_677_has_value_4739(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 677 is updated */
+SYNTHETIC_result_t step_record_677_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 677 should be saved */
+SYNTHETIC_result_t step_record_677_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 677 should not be duplicated */
+SYNTHETIC_result_t step_record_677_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 678 exists */
+SYNTHETIC_result_t step_record_678_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 678 has value 4746 */
+SYNTHETIC_result_t step_record_678_has_value_4746(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 678 is updated */
+SYNTHETIC_result_t step_record_678_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 678 should be saved */
+SYNTHETIC_result_t step_record_678_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 678 should not be duplicated */
+SYNTHETIC_result_t step_record_678_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 679 exists */
+SYNTHETIC_result_t step_record_679_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 679 has value 4753 */
+SYNTHETIC_result_t step_record_679_has_value_4753(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 679 is updated */
+SYNTHETIC_result_t step_record_679_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 679 should be saved */
+SYNTHETIC_result_t step_record_679_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 679 should not be duplicated */
+SYNTHETIC_result_t step_record_679_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 680 exists */
+SYNTHETIC_result_t step_record_680_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 680 has value 4760 */
+SYNTHETIC_result_t step_record_680_has_value_4760(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 680 is updated */
+SYNTHETIC_result_t step_record_680_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 680 should be saved */
+SYNTHETIC_result_t step_record_680_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 680 should not be duplicated */
+SYNTHETIC_result_t step_record_680_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 681 exists */
+SYNTHETIC_result_t step_record_681_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 681 has value 4767 */
+SYNTHETIC_result_t step_record_681_has_value_4767(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 681 is updated */
+SYNTHETIC_result_t step_record_681_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 681 should be saved */
+SYNTHETIC_result_t step_record_681_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 681 should not be duplicated */
+SYNTHETIC_result_t step_record_681_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 682 exists */
+SYNTHETIC_result_t step_record_682_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 682 has value 4774 */
+SYNTHETIC_result_t step_record_682_has_value_4774(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 682 is updated */
+SYNTHETIC_result_t step_record_682_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 682 should be saved */
+SYNTHETIC_result_t step_record_682_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 682 should not be duplicated */
+SYNTHETIC_result_t step_record_682_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 683 exists */
+SYNTHETIC_result_t step_record_683_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 683 has value 4781 */
+SYNTHETIC_result_t step_record_683_has_value_4781(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 683 is updated */
+SYNTHETIC_result_t step_record_683_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 683 should be saved */
+SYNTHETIC_result_t step_record_683_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 683 should not be duplicated */
+SYNTHETIC_result_t step_record_683_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 684 exists */
+SYNTHETIC_result_t step_record_684_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 684 has value 4788 */
+SYNTHETIC_result_t step_record_684_has_value_4788(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 684 is updated */
+SYNTHETIC_result_t step_record_684_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 684 should be saved */
+SYNTHETIC_result_t step_record_684_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 684 should not be duplicated */
+SYNTHETIC_result_t step_record_684_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 685 exists */
+SYNTHETIC_result_t step_record_685_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 685 has value 4795 */
+SYNTHETIC_result_t step_record_685_has_value_4795(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 685 is updated */
+SYNTHETIC_result_t step_record_685_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 685 should be saved */
+SYNTHETIC_result_t step_record_685_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 685 should not be duplicated */
+SYNTHETIC_result_t step_record_685_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 686 exists */
+SYNTHETIC_result_t step_record_686_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 686 has value 4802 */
+SYNTHETIC_result_t step_record_686_has_value_4802(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 686 is updated */
+SYNTHETIC_result_t step_record_686_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 686 should be saved */
+SYNTHETIC_result_t step_record_686_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 686 should not be duplicated */
+SYNTHETIC_result_t step_record_686_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 687 exists */
+SYNTHETIC_result_t step_record_687_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 687 has value 4809 */
+SYNTHETIC_result_t step_record_687_has_value_4809(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 687 is updated */
+SYNTHETIC_result_t step_record_687_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 687 should be saved */
+SYNTHETIC_result_t step_record_687_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 687 should not be duplicated */
+SYNTHETIC_result_t step_record_687_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 688 exists */
+SYNTHETIC_result_t step_record_688_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 688 has value 4816 */
+SYNTHETIC_result_t step_record_688_has_value_4816(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 688 is updated */
+SYNTHETIC_result_t step_record_688_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 688 should be saved */
+SYNTHETIC_result_t step_record_688_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 688 should not be duplicated */
+SYNTHETIC_result_t step_record_688_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 689 exists */
+SYNTHETIC_result_t step_record_689_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 689 has value 4823 */
+SYNTHETIC_result_t step_record_689_has_value_4823(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 689 is updated */
+SYNTHETIC_result_t step_record_689_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 689 should be saved */
+SYNTHETIC_result_t step_record_689_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 689 should not be duplicated */
+SYNTHETIC_result_t step_record_689_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 690 exists */
+SYNTHETIC_result_t step_record_690_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 690 has value 4830 */
+SYNTHETIC_result_t step_record_690_has_value_4830(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 690 is updated */
+SYNTHETIC_result_t step_record_690_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 690 should be saved */
+SYNTHETIC_result_t step_record_690_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 690 should not be duplicated */
+SYNTHETIC_result_t step_record_690_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 691 exists */
+SYNTHETIC_result_t step_record_691_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 691 has value 4837 */
+SYNTHETIC_result_t step_record_691_has_value_4837(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 691 is updated */
+SYNTHETIC_result_t step_record_691_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 691 should be saved */
+SYNTHETIC_result_t step_record_691_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 691 should not be duplicated */
+SYNTHETIC_result_t step_record_691_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 692 exists */
+SYNTHETIC_result_t step_record_692_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 692 has value 4844 */
+SYNTHETIC_result_t step_record_692_has_value_4844(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 692 is updated */
+SYNTHETIC_result_t step_record_692_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 692 should be saved */
+SYNTHETIC_result_t step_record_692_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 692 should not be duplicated */
+SYNTHETIC_result_t step_record_692_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 693 exists */
+SYNTHETIC_result_t step_record_693_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 693 has value 4851 */
+SYNTHETIC_result_t step_record_693_has_value_4851(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 693 is updated */
+SYNTHETIC_result_t step_record_693_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 693 should be saved */
+SYNTHETIC_result_t step_record_693_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 693 should not be duplicated */
+SYNTHETIC_result_t step_record_693_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 694 exists */
+SYNTHETIC_result_t step_record_694_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 694 has value 4858 */
+SYNTHETIC_result_t step_record_694_has_value_4858(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 694 is updated */
+SYNTHETIC_result_t step_record_694_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 694 should be saved */
+SYNTHETIC_result_t step_record_694_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 694 should not be duplicated */
+SYNTHETIC_result_t step_record_694_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 695 exists */
+SYNTHETIC_result_t step_record_695_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 695 has value 4865 */
+SYNTHETIC_result_t step_record_695_has_value_4865(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 695 is updated */
+SYNTHETIC_result_t step_record_695_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 695 should be saved */
+SYNTHETIC_result_t step_record_695_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 695 should not be duplicated */
+SYNTHETIC_result_t step_record_695_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 696 exists */
+SYNTHETIC_result_t step_record_696_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 696 has value 4872 */
+SYNTHETIC_result_t step_record_696_has_value_4872(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 696 is updated */
+SYNTHETIC_result_t step_record_696_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 696 should be saved */
+SYNTHETIC_result_t step_record_696_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 696 should not be duplicated */
+SYNTHETIC_result_t step_record_696_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 697 exists */
+SYNTHETIC_result_t step_record_697_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 697 has value 4879 */
+SYNTHETIC_result_t step_record_697_has_value_4879(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 697 is updated */
+SYNTHETIC_result_t step_record_697_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 697 should be saved */
+SYNTHETIC_result_t step_record_697_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 697 should not be duplicated */
+SYNTHETIC_result_t step_record_697_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 698 exists */
+SYNTHETIC_result_t step_record_698_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 698 has value 4886 */
+SYNTHETIC_result_t step_record_698_has_value_4886(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 698 is updated */
+SYNTHETIC_result_t step_record_698_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 698 should be saved */
+SYNTHETIC_result_t step_record_698_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 698 should not be duplicated */
+SYNTHETIC_result_t step_record_698_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 699 exists */
+SYNTHETIC_result_t step_record_699_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 699 has value 4893 */
+SYNTHETIC_result_t step_record_699_has_value_4893(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 699 is updated */
+SYNTHETIC_result_t step_record_699_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 699 should be saved */
+SYNTHETIC_result_t step_record_699_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 699 should not be duplicated */
+SYNTHETIC_result_t step_record_699_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 700 exists */
+SYNTHETIC_result_t step_record_700_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 700 has value 4900 */
+SYNTHETIC_result_t step_record_700_has_value_4900(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 700 is updated */
+SYNTHETIC_result_t step_record_700_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 700 should be saved */
+SYNTHETIC_result_t step_record_700_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 700 should not be duplicated */
+SYNTHETIC_result_t step_record_700_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 701 exists */
+SYNTHETIC_result_t step_record_701_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 701 has value 4907 */
+SYNTHETIC_result_t step_record_701_has_value_4907(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 701 is updated */
+SYNTHETIC_result_t step_record_701_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 701 should be saved */
+SYNTHETIC_result_t step_record_701_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 701 should not be duplicated */
+SYNTHETIC_result_t step_record_701_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 702 exists */
+SYNTHETIC_result_t step_record_702_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 702 has value 4914 */
+SYNTHETIC_result_t step_record_702_has_value_4914(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 702 is updated */
+SYNTHETIC_result_t step_record_702_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 702 should be saved */
+SYNTHETIC_result_t step_record_702_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 702 should not be duplicated */
+SYNTHETIC_result_t step_record_702_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 703 exists */
+SYNTHETIC_result_t step_record_703_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 703 has value 4921 */
+SYNTHETIC_result_t step_record_703_has_value_4921(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 703 is updated */
+SYNTHETIC_result_t step_record_703_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 703 should be saved */
+SYNTHETIC_result_t step_record_703_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 703 should not be duplicated */
+SYNTHETIC_result_t step_record_703_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 704 exists */
+SYNTHETIC_result_t step_record_704_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 704 has value 4928 */
+SYNTHETIC_result_t step_record_704_has_value_4928(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 704 is updated */
+SYNTHETIC_result_t step_record_704_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 704 should be saved */
+SYNTHETIC_result_t step_record_704_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 704 should not be duplicated */
+SYNTHETIC_result_t step_record_704_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 705 exists */
+SYNTHETIC_result_t step_record_705_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 705 has value 4935 */
+SYNTHETIC_result_t step_record_705_has_value_4935(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 705 is updated */
+SYNTHETIC_result_t step_record_705_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 705 should be saved */
+SYNTHETIC_result_t step_record_705_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 705 should not be duplicated */
+SYNTHETIC_result_t step_record_705_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 706 exists */
+SYNTHETIC_result_t step_record_706_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 706 has value 4942 */
+SYNTHETIC_result_t step_record_706_has_value_4942(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 706 is updated */
+SYNTHETIC_result_t step_record_706_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 706 should be saved */
+SYNTHETIC_result_t step_record_706_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 706 should not be duplicated */
+SYNTHETIC_result_t step_record_706_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 707 exists */
+SYNTHETIC_result_t step_record_707_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 707 has value 4949 */
+SYNTHETIC_result_t step_record_707_has_value_4949(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 707 is updated */
+SYNTHETIC_result_t step_record_707_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 707 should be saved */
+SYNTHETIC_result_t step_record_707_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 707 should not be duplicated */
+SYNTHETIC_result_t step_record_707_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 708 exists */
+SYNTHETIC_result_t step_record_708_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 708 has value 4956 */
+SYNTHETIC_result_t step_record_708_has_value_4956(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 708 is updated */
+SYNTHETIC_result_t step_record_708_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 708 should be saved */
+SYNTHETIC_result_t step_record_708_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 708 should not be duplicated */
+SYNTHETIC_result_t step_record_708_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 709 exists */
+SYNTHETIC_result_t step_record_709_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 709 has value 4963 */
+SYNTHETIC_result_t step_record_709_has_value_4963(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 709 is updated */
+SYNTHETIC_result_t step_record_709_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 709 should be saved */
+SYNTHETIC_result_t step_record_709_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 709 should not be duplicated */
+SYNTHETIC_result_t step_record_709_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 710 exists */
+SYNTHETIC_result_t step_record_710_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 710 has value 4970 */
+SYNTHETIC_result_t step_record_710_has_value_4970(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 710 is updated */
+SYNTHETIC_result_t step_record_710_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 710 should be saved */
+SYNTHETIC_result_t step_record_710_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 710 should not be duplicated */
+SYNTHETIC_result_t step_record_710_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 711 exists */
+SYNTHETIC_result_t step_record_711_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 711 has value 4977 */
+SYNTHETIC_result_t step_record_711_has_value_4977(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 711 is updated */
+SYNTHETIC_result_t step_record_711_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 711 should be saved */
+SYNTHETIC_result_t step_record_711_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 711 should not be duplicated */
+SYNTHETIC_result_t step_record_711_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 712 exists */
+SYNTHETIC_result_t step_record_712_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 712 has value 4984 */
+SYNTHETIC_result_t step_record_712_has_value_4984(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 712 is updated */
+SYNTHETIC_result_t step_record_712_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 712 should be saved */
+SYNTHETIC_result_t step_record_712_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 712 should not be duplicated */
+SYNTHETIC_result_t step_record_712_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 713 exists */
+SYNTHETIC_result_t step_record_713_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 713 has value 4991 */
+SYNTHETIC_result_t step_record_713_has_value_4991(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 713 is updated */
+SYNTHETIC_result_t step_record_713_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 713 should be saved */
+SYNTHETIC_result_t step_record_713_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 713 should not be duplicated */
+SYNTHETIC_result_t step_record_713_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 714 exists */
+SYNTHETIC_result_t step_record_714_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 714 has value 4998 */
+SYNTHETIC_result_t step_record_714_has_value_4998(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 714 is updated */
+SYNTHETIC_result_t step_record_714_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 714 should be saved */
+SYNTHETIC_result_t step_record_714_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 714 should not be duplicated */
+SYNTHETIC_result_t step_record_714_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 715 exists */
+SYNTHETIC_result_t step_record_715_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 715 has value 5005 */
+SYNTHETIC_result_t step_record_715_has_value_5005(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 715 is updated */
+SYNTHETIC_result_t step_record_715_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 715 should be saved */
+SYNTHETIC_result_t step_record_715_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 715 should not be duplicated */
+SYNTHETIC_result_t step_record_715_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 716 exists */
+SYNTHETIC_result_t step_record_716_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 716 has value 5012 */
+SYNTHETIC_result_t step_record_716_has_value_5012(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 716 is updated */
+SYNTHETIC_result_t step_record_716_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 716 should be saved */
+SYNTHETIC_result_t step_record_716_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 716 should not be duplicated */
+SYNTHETIC_result_t step_record_716_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 717 exists */
+SYNTHETIC_result_t step_record_717_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 717 has value 5019 */
+SYNTHETIC_result_t step_record_717_has_value_5019(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 717 is updated */
+SYNTHETIC_result_t step_record_717_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 717 should be saved */
+SYNTHETIC_result_t step_record_717_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 717 should not be duplicated */
+SYNTHETIC_result_t step_record_717_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 718 exists */
+SYNTHETIC_result_t step_record_718_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 718 has value 5026 */
+SYNTHETIC_result_t step_record_718_has_value_5026(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 718 is updated */
+SYNTHETIC_result_t step_record_718_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 718 should be saved */
+SYNTHETIC_result_t step_record_718_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 718 should not be duplicated */
+SYNTHETIC_result_t step_record_718_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 719 exists */
+SYNTHETIC_result_t step_record_719_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 719 has value 5033 */
+SYNTHETIC_result_t step_record_719_has_value_5033(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 719 is updated */
+SYNTHETIC_result_t step_record_719_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 719 should be saved */
+SYNTHETIC_result_t step_record_719_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 719 should not be duplicated */
+SYNTHETIC_result_t step_record_719_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 720 exists */
+SYNTHETIC_result_t step_record_720_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 720 has value 5040 */
+SYNTHETIC_result_t step_record_720_has_value_5040(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 720 is updated */
+SYNTHETIC_result_t step_record_720_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 720 should be saved */
+SYNTHETIC_result_t step_record_720_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 720 should not be duplicated */
+SYNTHETIC_result_t step_record_720_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 721 exists */
+SYNTHETIC_result_t step_record_721_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 721 has value 5047 */
+SYNTHETIC_result_t step_record_721_has_value_5047(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 721 is updated */
+SYNTHETIC_result_t step_record_721_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 721 should be saved */
+SYNTHETIC_result_t step_record_721_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 721 should not be duplicated */
+SYNTHETIC_result_t step_record_721_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 722 exists */
+SYNTHETIC_result_t step_record_722_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 722 has value 5054 */
+SYNTHETIC_result_t step_record_722_has_value_5054(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 722 is updated */
+SYNTHETIC_result_t step_record_722_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 722 should be saved */
+SYNTHETIC_result_t step_record_722_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 722 should not be duplicated */
+SYNTHETIC_result_t step_record_722_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 723 exists */
+SYNTHETIC_result_t step_record_723_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 723 has value 5061 */
+SYNTHETIC_result_t step_record_723_has_value_5061(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 723 is updated */
+SYNTHETIC_result_t step_record_723_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 723 should be saved */
+SYNTHETIC_result_t step_record_723_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 723 should not be duplicated */
+SYNTHETIC_result_t step_record_723_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 724 exists */
+SYNTHETIC_result_t step_record_724_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 724 has value 5068 */
+SYNTHETIC_result_t step_record_724_has_value_5068(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 724 is updated */
+SYNTHETIC_result_t step_record_724_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 724 should be saved */
+SYNTHETIC_result_t step_record_724_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 724 should not be duplicated */
+SYNTHETIC_result_t step_record_724_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 725 exists */
+SYNTHETIC_result_t step_record_725_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 725 has value 5075 */
+SYNTHETIC_result_t step_record_725_has_value_5075(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 725 is updated */
+SYNTHETIC_result_t step_record_725_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 725 should be saved */
+SYNTHETIC_result_t step_record_725_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 725 should not be duplicated */
+SYNTHETIC_result_t step_record_725_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 726 exists */
+SYNTHETIC_result_t step_record_726_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 726 has value 5082 */
+SYNTHETIC_result_t step_record_726_has_value_5082(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 726 is updated */
+SYNTHETIC_result_t step_record_726_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 726 should be saved */
+SYNTHETIC_result_t step_record_726_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 726 should not be duplicated */
+SYNTHETIC_result_t step_record_726_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 727 exists */
+SYNTHETIC_result_t step_record_727_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 727 has value 5089 */
+SYNTHETIC_result_t step_record_727_has_value_5089(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 727 is updated */
+SYNTHETIC_result_t step_record_727_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 727 should be saved */
+SYNTHETIC_result_t step_record_727_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 727 should not be duplicated */
+SYNTHETIC_result_t step_record_727_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 728 exists */
+SYNTHETIC_result_t step_record_728_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 728 has value 5096 */
+SYNTHETIC_result_t step_record_728_has_value_5096(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 728 is updated */
+SYNTHETIC_result_t step_record_728_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 728 should be saved */
+SYNTHETIC_result_t step_record_728_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 728 should not be duplicated */
+SYNTHETIC_result_t step_record_728_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 729 exists */
+SYNTHETIC_result_t step_record_729_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 729 has value 5103 */
+SYNTHETIC_result_t step_record_729_has_value_5103(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 729 is updated */
+SYNTHETIC_result_t step_record_729_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 729 should be saved */
+SYNTHETIC_result_t step_record_729_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 729 should not be duplicated */
+SYNTHETIC_result_t step_record_729_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 730 exists */
+SYNTHETIC_result_t step_record_730_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 730 has value 5110 */
+SYNTHETIC_result_t step_record_730_has_value_5110(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 730 is updated */
+SYNTHETIC_result_t step_record_730_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 730 should be saved */
+SYNTHETIC_result_t step_record_730_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 730 should not be duplicated */
+SYNTHETIC_result_t step_record_730_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 731 exists */
+SYNTHETIC_result_t step_record_731_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 731 has value 5117 */
+SYNTHETIC_result_t step_record_731_has_value_5117(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 731 is updated */
+SYNTHETIC_result_t step_record_731_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 731 should be saved */
+SYNTHETIC_result_t step_record_731_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 731 should not be duplicated */
+SYNTHETIC_result_t step_record_731_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 732 exists */
+SYNTHETIC_result_t step_record_732_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 732 has value 5124 */
+SYNTHETIC_result_t step_record_732_has_value_5124(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 732 is updated */
+SYNTHETIC_result_t step_record_732_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 732 should be saved */
+SYNTHETIC_result_t step_record_732_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 732 should not be duplicated */
+SYNTHETIC_result_t step_record_732_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 733 exists */
+SYNTHETIC_result_t step_record_733_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 733 has value 5131 */
+SYNTHETIC_result_t step_record_733_has_value_5131(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 733 is updated */
+SYNTHETIC_result_t step_record_733_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 733 should be saved */
+SYNTHETIC_result_t step_record_733_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 733 should not be duplicated */
+SYNTHETIC_result_t step_record_733_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 734 exists */
+SYNTHETIC_result_t step_record_734_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 734 has value 5138 */
+SYNTHETIC_result_t step_record_734_has_value_5138(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 734 is updated */
+SYNTHETIC_result_t step_record_734_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 734 should be saved */
+SYNTHETIC_result_t step_record_734_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 734 should not be duplicated */
+SYNTHETIC_result_t step_record_734_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 735 exists */
+SYNTHETIC_result_t step_record_735_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 735 has value 5145 */
+SYNTHETIC_result_t step_record_735_has_value_5145(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 735 is updated */
+SYNTHETIC_result_t step_record_735_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 735 should be saved */
+SYNTHETIC_result_t step_record_735_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 735 should not be duplicated */
+SYNTHETIC_result_t step_record_735_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 736 exists */
+SYNTHETIC_result_t step_record_736_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 736 has value 5152 */
+SYNTHETIC_result_t step_record_736_has_value_5152(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 736 is updated */
+SYNTHETIC_result_t step_record_736_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 736 should be saved */
+SYNTHETIC_result_t step_record_736_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 736 should not be duplicated */
+SYNTHETIC_result_t step_record_736_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 737 exists */
+SYNTHETIC_result_t step_record_737_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 737 has value 5159 */
+SYNTHETIC_result_t step_record_737_has_value_5159(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 737 is updated */
+SYNTHETIC_result_t step_record_737_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 737 should be saved */
+SYNTHETIC_result_t step_record_737_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 737 should not be duplicated */
+SYNTHETIC_result_t step_record_737_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 738 exists */
+SYNTHETIC_result_t step_record_738_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 738 has value 5166 */
+SYNTHETIC_result_t step_record_738_has_value_5166(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 738 is updated */
+SYNTHETIC_result_t step_record_738_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 738 should be saved */
+SYNTHETIC_result_t step_record_738_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 738 should not be duplicated */
+SYNTHETIC_result_t step_record_738_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 739 exists */
+SYNTHETIC_result_t step_record_739_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 739 has value 5173 */
+SYNTHETIC_result_t step_record_739_has_value_5173(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 739 is updated */
+SYNTHETIC_result_t step_record_739_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 739 should be saved */
+SYNTHETIC_result_t step_record_739_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 739 should not be duplicated */
+SYNTHETIC_result_t step_record_739_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 740 exists */
+SYNTHETIC_result_t step_record_740_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 740 has value 5180 */
+SYNTHETIC_result_t step_record_740_has_value_5180(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 740 is updated */
+SYNTHETIC_result_t step_record_740_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 740 should be saved */
+SYNTHETIC_result_t step_record_740_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 740 should not be duplicated */
+SYNTHETIC_result_t step_record_740_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 741 exists */
+SYNTHETIC_result_t step_record_741_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 741 has value 5187 */
+SYNTHETIC_result_t step_record_741_has_value_5187(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 741 is updated */
+SYNTHETIC_result_t step_record_741_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 741 should be saved */
+SYNTHETIC_result_t step_record_741_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 741 should not be duplicated */
+SYNTHETIC_result_t step_record_741_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 742 exists */
+SYNTHETIC_result_t step_record_742_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 742 has value 5194 */
+SYNTHETIC_result_t step_record_742_has_value_5194(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 742 is updated */
+SYNTHETIC_result_t step_record_742_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 742 should be saved */
+SYNTHETIC_result_t step_record_742_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 742 should not be duplicated */
+SYNTHETIC_result_t step_record_742_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 743 exists */
+SYNTHETIC_result_t step_record_743_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 743 has value 5201 */
+SYNTHETIC_result_t step_record_743_has_value_5201(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 743 is updated */
+SYNTHETIC_result_t step_record_743_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 743 should be saved */
+SYNTHETIC_result_t step_record_743_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 743 should not be duplicated */
+SYNTHETIC_result_t step_record_743_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 744 exists */
+SYNTHETIC_result_t step_record_744_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 744 has value 5208 */
+SYNTHETIC_result_t step_record_744_has_value_5208(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 744 is updated */
+SYNTHETIC_result_t step_record_744_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 744 should be saved */
+SYNTHETIC_result_t step_record_744_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 744 should not be duplicated */
+SYNTHETIC_result_t step_record_744_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 745 exists */
+SYNTHETIC_result_t step_record_745_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 745 has value 5215 */
+SYNTHETIC_result_t step_record_745_has_value_5215(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 745 is updated */
+SYNTHETIC_result_t step_record_745_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 745 should be saved */
+SYNTHETIC_result_t step_record_745_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 745 should not be duplicated */
+SYNTHETIC_result_t step_record_745_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 746 exists */
+SYNTHETIC_result_t step_record_746_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 746 has value 5222 */
+SYNTHETIC_result_t step_record_746_has_value_5222(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 746 is updated */
+SYNTHETIC_result_t step_record_746_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 746 should be saved */
+SYNTHETIC_result_t step_record_746_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 746 should not be duplicated */
+SYNTHETIC_result_t step_record_746_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 747 exists */
+SYNTHETIC_result_t step_record_747_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 747 has value 5229 */
+SYNTHETIC_result_t step_record_747_has_value_5229(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 747 is updated */
+SYNTHETIC_result_t step_record_747_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 747 should be saved */
+SYNTHETIC_result_t step_record_747_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 747 should not be duplicated */
+SYNTHETIC_result_t step_record_747_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 748 exists */
+SYNTHETIC_result_t step_record_748_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 748 has value 5236 */
+SYNTHETIC_result_t step_record_748_has_value_5236(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 748 is updated */
+SYNTHETIC_result_t step_record_748_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 748 should be saved */
+SYNTHETIC_result_t step_record_748_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 748 should not be duplicated */
+SYNTHETIC_result_t step_record_748_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 749 exists */
+SYNTHETIC_result_t step_record_749_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 749 has value 5243 */
+SYNTHETIC_result_t step_record_749_has_value_5243(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 749 is updated */
+SYNTHETIC_result_t step_record_749_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 749 should be saved */
+SYNTHETIC_result_t step_record_749_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 749 should not be duplicated */
+SYNTHETIC_result_t step_record_749_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 750 exists */
+SYNTHETIC_result_t step_record_750_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 750 has value 5250 */
+SYNTHETIC_result_t step_record_750_has_value_5250(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 750 is updated */
+SYNTHETIC_result_t step_record_750_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 750 should be saved */
+SYNTHETIC_result_t step_record_750_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 750 should not be duplicated */
+SYNTHETIC_result_t step_record_750_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 751 exists */
+SYNTHETIC_result_t step_record_751_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 751 has value 5257 */
+SYNTHETIC_result_t step_record_751_has_value_5257(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 751 is updated */
+SYNTHETIC_result_t step_record_751_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 751 should be saved */
+SYNTHETIC_result_t step_record_751_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 751 should not be duplicated */
+SYNTHETIC_result_t step_record_751_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 752 exists */
+SYNTHETIC_result_t step_record_752_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 752 has value 5264 */
+SYNTHETIC_result_t step_record_752_has_value_5264(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 752 is updated */
+SYNTHETIC_result_t step_record_752_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 752 should be saved */
+SYNTHETIC_result_t step_record_752_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 752 should not be duplicated */
+SYNTHETIC_result_t step_record_752_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 753 exists */
+SYNTHETIC_result_t step_record_753_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 753 has value 5271 */
+SYNTHETIC_result_t step_record_753_has_value_5271(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 753 is updated */
+SYNTHETIC_result_t step_record_753_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 753 should be saved */
+SYNTHETIC_result_t step_record_753_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 753 should not be duplicated */
+SYNTHETIC_result_t step_record_753_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 754 exists */
+SYNTHETIC_result_t step_record_754_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 754 has value 5278 */
+SYNTHETIC_result_t step_record_754_has_value_5278(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 754 is updated */
+SYNTHETIC_result_t step_record_754_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 754 should be saved */
+SYNTHETIC_result_t step_record_754_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 754 should not be duplicated */
+SYNTHETIC_result_t step_record_754_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 755 exists */
+SYNTHETIC_result_t step_record_755_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 755 has value 5285 */
+SYNTHETIC_result_t step_record_755_has_value_5285(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 755 is updated */
+SYNTHETIC_result_t step_record_755_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 755 should be saved */
+SYNTHETIC_result_t step_record_755_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 755 should not be duplicated */
+SYNTHETIC_result_t step_record_755_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 756 exists */
+SYNTHETIC_result_t step_record_756_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 756 has value 5292 */
+SYNTHETIC_result_t step_record_756_has_value_5292(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 756 is updated */
+SYNTHETIC_result_t step_record_756_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 756 should be saved */
+SYNTHETIC_result_t step_record_756_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 756 should not be duplicated */
+SYNTHETIC_result_t step_record_756_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 757 exists */
+SYNTHETIC_result_t step_record_757_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 757 has value 5299 */
+SYNTHETIC_result_t step_record_757_has_value_5299(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 757 is updated */
+SYNTHETIC_result_t step_record_757_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 757 should be saved */
+SYNTHETIC_result_t step_record_757_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 757 should not be duplicated */
+SYNTHETIC_result_t step_record_757_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 758 exists */
+SYNTHETIC_result_t step_record_758_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 758 has value 5306 */
+SYNTHETIC_result_t step_record_758_has_value_5306(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 758 is updated */
+SYNTHETIC_result_t step_record_758_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 758 should be saved */
+SYNTHETIC_result_t step_record_758_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 758 should not be duplicated */
+SYNTHETIC_result_t step_record_758_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 759 exists */
+SYNTHETIC_result_t step_record_759_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 759 has value 5313 */
+SYNTHETIC_result_t step_record_759_has_value_5313(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 759 is updated */
+SYNTHETIC_result_t step_record_759_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 759 should be saved */
+SYNTHETIC_result_t step_record_759_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 759 should not be duplicated */
+SYNTHETIC_result_t step_record_759_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 760 exists */
+SYNTHETIC_result_t step_record_760_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 760 has value 5320 */
+SYNTHETIC_result_t step_record_760_has_value_5320(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 760 is updated */
+SYNTHETIC_result_t step_record_760_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 760 should be saved */
+SYNTHETIC_result_t step_record_760_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 760 should not be duplicated */
+SYNTHETIC_result_t step_record_760_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 761 exists */
+SYNTHETIC_result_t step_record_761_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 761 has value 5327 */
+SYNTHETIC_result_t step_record_761_has_value_5327(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 761 is updated */
+SYNTHETIC_result_t step_record_761_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 761 should be saved */
+SYNTHETIC_result_t step_record_761_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 761 should not be duplicated */
+SYNTHETIC_result_t step_record_761_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 762 exists */
+SYNTHETIC_result_t step_record_762_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 762 has value 5334 */
+SYNTHETIC_result_t step_record_762_has_value_5334(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 762 is updated */
+SYNTHETIC_result_t step_record_762_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 762 should be saved */
+SYNTHETIC_result_t step_record_762_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 762 should not be duplicated */
+SYNTHETIC_result_t step_record_762_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 763 exists */
+SYNTHETIC_result_t step_record_763_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 763 has value 5341 */
+SYNTHETIC_result_t step_record_763_has_value_5341(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 763 is updated */
+SYNTHETIC_result_t step_record_763_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 763 should be saved */
+SYNTHETIC_result_t step_record_763_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 763 should not be duplicated */
+SYNTHETIC_result_t step_record_763_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 764 exists */
+SYNTHETIC_result_t step_record_764_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 764 has value 5348 */
+SYNTHETIC_result_t step_record_764_has_value_5348(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 764 is updated */
+SYNTHETIC_result_t step_record_764_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 764 should be saved */
+SYNTHETIC_result_t step_record_764_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 764 should not be duplicated */
+SYNTHETIC_result_t step_record_764_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 765 exists */
+SYNTHETIC_result_t step_record_765_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 765 has value 5355 */
+SYNTHETIC_result_t step_record_765_has_value_5355(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 765 is updated */
+SYNTHETIC_result_t step_record_765_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 765 should be saved */
+SYNTHETIC_result_t step_record_765_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 765 should not be duplicated */
+SYNTHETIC_result_t step_record_765_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 766 exists */
+SYNTHETIC_result_t step_record_766_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 766 has value 5362 */
+SYNTHETIC_result_t step_record_766_has_value_5362(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 766 is updated */
+SYNTHETIC_result_t step_record_766_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 766 should be saved */
+SYNTHETIC_result_t step_record_766_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 766 should not be duplicated */
+SYNTHETIC_result_t step_record_766_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 767 exists */
+SYNTHETIC_result_t step_record_767_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 767 has value 5369 */
+SYNTHETIC_result_t step_record_767_has_value_5369(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 767 is updated */
+SYNTHETIC_result_t step_record_767_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 767 should be saved */
+SYNTHETIC_result_t step_record_767_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 767 should not be duplicated */
+SYNTHETIC_result_t step_record_767_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 768 exists */
+SYNTHETIC_result_t step_record_768_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 768 has value 5376 */
+SYNTHETIC_result_t step_record_768_has_value_5376(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 768 is updated */
+SYNTHETIC_result_t step_record_768_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 768 should be saved */
+SYNTHETIC_result_t step_record_768_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 768 should not be duplicated */
+SYNTHETIC_result_t step_record_768_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 769 exists */
+SYNTHETIC_result_t step_record_769_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 769 has value 5383 */
+SYNTHETIC_result_t step_record_769_has_value_5383(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 769 is updated */
+SYNTHETIC_result_t step_record_769_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 769 should be saved */
+SYNTHETIC_result_t step_record_769_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 769 should not be duplicated */
+SYNTHETIC_result_t step_record_769_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 770 exists */
+SYNTHETIC_result_t step_record_770_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 770 has value 5390 */
+SYNTHETIC_result_t step_record_770_has_value_5390(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 770 is updated */
+SYNTHETIC_result_t step_record_770_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 770 should be saved */
+SYNTHETIC_result_t step_record_770_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 770 should not be duplicated */
+SYNTHETIC_result_t step_record_770_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 771 exists */
+SYNTHETIC_result_t step_record_771_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 771 has value 5397 */
+SYNTHETIC_result_t step_record_771_has_value_5397(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 771 is updated */
+SYNTHETIC_result_t step_record_771_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 771 should be saved */
+SYNTHETIC_result_t step_record_771_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 771 should not be duplicated */
+SYNTHETIC_result_t step_record_771_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 772 exists */
+SYNTHETIC_result_t step_record_772_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 772 has value 5404 */
+SYNTHETIC_result_t step_record_772_has_value_5404(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 772 is updated */
+SYNTHETIC_result_t step_record_772_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 772 should be saved */
+SYNTHETIC_result_t step_record_772_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 772 should not be duplicated */
+SYNTHETIC_result_t step_record_772_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 773 exists */
+SYNTHETIC_result_t step_record_773_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 773 has value 5411 */
+SYNTHETIC_result_t step_record_773_has_value_5411(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 773 is updated */
+SYNTHETIC_result_t step_record_773_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 773 should be saved */
+SYNTHETIC_result_t step_record_773_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 773 should not be duplicated */
+SYNTHETIC_result_t step_record_773_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 774 exists */
+SYNTHETIC_result_t step_record_774_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 774 has value 5418 */
+SYNTHETIC_result_t step_record_774_has_value_5418(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 774 is updated */
+SYNTHETIC_result_t step_record_774_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 774 should be saved */
+SYNTHETIC_result_t step_record_774_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 774 should not be duplicated */
+SYNTHETIC_result_t step_record_774_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 775 exists */
+SYNTHETIC_result_t step_record_775_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 775 has value 5425 */
+SYNTHETIC_result_t step_record_775_has_value_5425(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 775 is updated */
+SYNTHETIC_result_t step_record_775_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 775 should be saved */
+SYNTHETIC_result_t step_record_775_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 775 should not be duplicated */
+SYNTHETIC_result_t step_record_775_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 776 exists */
+SYNTHETIC_result_t step_record_776_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 776 has value 5432 */
+SYNTHETIC_result_t step_record_776_has_value_5432(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 776 is updated */
+SYNTHETIC_result_t step_record_776_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 776 should be saved */
+SYNTHETIC_result_t step_record_776_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 776 should not be duplicated */
+SYNTHETIC_result_t step_record_776_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 777 exists */
+SYNTHETIC_result_t step_record_777_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 777 has value 5439 */
+SYNTHETIC_result_t step_record_777_has_value_5439(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 777 is updated */
+SYNTHETIC_result_t step_record_777_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 777 should be saved */
+SYNTHETIC_result_t step_record_777_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 777 should not be duplicated */
+SYNTHETIC_result_t step_record_777_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 778 exists */
+SYNTHETIC_result_t step_record_778_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 778 has value 5446 */
+SYNTHETIC_result_t step_record_778_has_value_5446(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 778 is updated */
+SYNTHETIC_result_t step_record_778_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 778 should be saved */
+SYNTHETIC_result_t step_record_778_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 778 should not be duplicated */
+SYNTHETIC_result_t step_record_778_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 779 exists */
+SYNTHETIC_result_t step_record_779_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 779 has value 5453 */
+SYNTHETIC_result_t step_record_779_has_value_5453(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 779 is updated */
+SYNTHETIC_result_t step_record_779_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 779 should be saved */
+SYNTHETIC_result_t step_record_779_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 779 should not be duplicated */
+SYNTHETIC_result_t step_record_779_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 780 exists */
+SYNTHETIC_result_t step_record_780_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 780 has value 5460 */
+SYNTHETIC_result_t step_record_780_has_value_5460(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 780 is updated */
+SYNTHETIC_result_t step_record_780_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 780 should be saved */
+SYNTHETIC_result_t step_record_780_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 780 should not be duplicated */
+SYNTHETIC_result_t step_record_780_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 781 exists */
+SYNTHETIC_result_t step_record_781_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 781 has value 5467 */
+SYNTHETIC_result_t step_record_781_has_value_5467(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 781 is updated */
+SYNTHETIC_result_t step_record_781_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 781 should be saved */
+SYNTHETIC_result_t step_record_781_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 781 should not be duplicated */
+SYNTHETIC_result_t step_record_781_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 782 exists */
+SYNTHETIC_result_t step_record_782_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 782 has value 5474 */
+SYNTHETIC_result_t step_record_782_has_value_5474(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 782 is updated */
+SYNTHETIC_result_t step_record_782_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 782 should be saved */
+SYNTHETIC_result_t step_record_782_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 782 should not be duplicated */
+SYNTHETIC_result_t step_record_782_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 783 exists */
+SYNTHETIC_result_t step_record_783_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 783 has value 5481 */
+SYNTHETIC_result_t step_record_783_has_value_5481(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 783 is updated */
+SYNTHETIC_result_t step_record_783_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 783 should be saved */
+SYNTHETIC_result_t step_record_783_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 783 should not be duplicated */
+SYNTHETIC_result_t step_record_783_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 784 exists */
+SYNTHETIC_result_t step_record_784_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 784 has value 5488 */
+SYNTHETIC_result_t step_record_784_has_value_5488(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 784 is updated */
+SYNTHETIC_result_t step_record_784_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 784 should be saved */
+SYNTHETIC_result_t step_record_784_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 784 should not be duplicated */
+SYNTHETIC_result_t step_record_784_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 785 exists */
+SYNTHETIC_result_t step_record_785_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 785 has value 5495 */
+SYNTHETIC_result_t step_record_785_has_value_5495(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 785 is updated */
+SYNTHETIC_result_t step_record_785_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 785 should be saved */
+SYNTHETIC_result_t step_record_785_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 785 should not be duplicated */
+SYNTHETIC_result_t step_record_785_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 786 exists */
+SYNTHETIC_result_t step_record_786_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 786 has value 5502 */
+SYNTHETIC_result_t step_record_786_has_value_5502(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 786 is updated */
+SYNTHETIC_result_t step_record_786_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 786 should be saved */
+SYNTHETIC_result_t step_record_786_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 786 should not be duplicated */
+SYNTHETIC_result_t step_record_786_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 787 exists */
+SYNTHETIC_result_t step_record_787_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 787 has value 5509 */
+SYNTHETIC_result_t step_record_787_has_value_5509(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 787 is updated */
+SYNTHETIC_result_t step_record_787_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 787 should be saved */
+SYNTHETIC_result_t step_record_787_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 787 should not be duplicated */
+SYNTHETIC_result_t step_record_787_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 788 exists */
+SYNTHETIC_result_t step_record_788_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 788 has value 5516 */
+SYNTHETIC_result_t step_record_788_has_value_5516(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 788 is updated */
+SYNTHETIC_result_t step_record_788_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 788 should be saved */
+SYNTHETIC_result_t step_record_788_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 788 should not be duplicated */
+SYNTHETIC_result_t step_record_788_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 789 exists */
+SYNTHETIC_result_t step_record_789_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 789 has value 5523 */
+SYNTHETIC_result_t step_record_789_has_value_5523(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 789 is updated */
+SYNTHETIC_result_t step_record_789_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 789 should be saved */
+SYNTHETIC_result_t step_record_789_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 789 should not be duplicated */
+SYNTHETIC_result_t step_record_789_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 790 exists */
+SYNTHETIC_result_t step_record_790_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 790 has value 5530 */
+SYNTHETIC_result_t step_record_790_has_value_5530(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 790 is updated */
+SYNTHETIC_result_t step_record_790_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 790 should be saved */
+SYNTHETIC_result_t step_record_790_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 790 should not be duplicated */
+SYNTHETIC_result_t step_record_790_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 791 exists */
+SYNTHETIC_result_t step_record_791_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 791 has value 5537 */
+SYNTHETIC_result_t step_record_791_has_value_5537(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 791 is updated */
+SYNTHETIC_result_t step_record_791_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 791 should be saved */
+SYNTHETIC_result_t step_record_791_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 791 should not be duplicated */
+SYNTHETIC_result_t step_record_791_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 792 exists */
+SYNTHETIC_result_t step_record_792_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 792 has value 5544 */
+SYNTHETIC_result_t step_record_792_has_value_5544(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 792 is updated */
+SYNTHETIC_result_t step_record_792_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 792 should be saved */
+SYNTHETIC_result_t step_record_792_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 792 should not be duplicated */
+SYNTHETIC_result_t step_record_792_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 793 exists */
+SYNTHETIC_result_t step_record_793_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 793 has value 5551 */
+SYNTHETIC_result_t step_record_793_has_value_5551(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 793 is updated */
+SYNTHETIC_result_t step_record_793_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 793 should be saved */
+SYNTHETIC_result_t step_record_793_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 793 should not be duplicated */
+SYNTHETIC_result_t step_record_793_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 794 exists */
+SYNTHETIC_result_t step_record_794_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 794 has value 5558 */
+SYNTHETIC_result_t step_record_794_has_value_5558(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 794 is updated */
+SYNTHETIC_result_t step_record_794_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 794 should be saved */
+SYNTHETIC_result_t step_record_794_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 794 should not be duplicated */
+SYNTHETIC_result_t step_record_794_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 795 exists */
+SYNTHETIC_result_t step_record_795_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 795 has value 5565 */
+SYNTHETIC_result_t step_record_795_has_value_5565(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 795 is updated */
+SYNTHETIC_result_t step_record_795_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 795 should be saved */
+SYNTHETIC_result_t step_record_795_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 795 should not be duplicated */
+SYNTHETIC_result_t step_record_795_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 796 exists */
+SYNTHETIC_result_t step_record_796_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 796 has value 5572 */
+SYNTHETIC_result_t step_record_796_has_value_5572(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 796 is updated */
+SYNTHETIC_result_t step_record_796_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 796 should be saved */
+SYNTHETIC_result_t step_record_796_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 796 should not be duplicated */
+SYNTHETIC_result_t step_record_796_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 797 exists */
+SYNTHETIC_result_t step_record_797_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 797 has value 5579 */
+SYNTHETIC_result_t step_record_797_has_value_5579(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 797 is updated */
+SYNTHETIC_result_t step_record_797_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 797 should be saved */
+SYNTHETIC_result_t step_record_797_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 797 should not be duplicated */
+SYNTHETIC_result_t step_record_797_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 798 exists */
+SYNTHETIC_result_t step_record_798_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 798 has value 5586 */
+SYNTHETIC_result_t step_record_798_has_value_5586(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 798 is updated */
+SYNTHETIC_result_t step_record_798_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 798 should be saved */
+SYNTHETIC_result_t step_record_798_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 798 should not be duplicated */
+SYNTHETIC_result_t step_record_798_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 799 exists */
+SYNTHETIC_result_t step_record_799_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 799 has value 5593 */
+SYNTHETIC_result_t step_record_799_has_value_5593(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 799 is updated */
+SYNTHETIC_result_t step_record_799_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 799 should be saved */
+SYNTHETIC_result_t step_record_799_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 799 should not be duplicated */
+SYNTHETIC_result_t step_record_799_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 800 exists */
+SYNTHETIC_result_t step_record_800_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 800 has value 5600 */
+SYNTHETIC_result_t step_record_800_has_value_5600(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 800 is updated */
+SYNTHETIC_result_t step_record_800_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 800 should be saved */
+SYNTHETIC_result_t step_record_800_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 800 should not be duplicated */
+SYNTHETIC_result_t step_record_800_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 801 exists */
+SYNTHETIC_result_t step_record_801_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 801 has value 5607 */
+SYNTHETIC_result_t step_record_801_has_value_5607(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 801 is updated */
+SYNTHETIC_result_t step_record_801_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 801 should be saved */
+SYNTHETIC_result_t step_record_801_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 801 should not be duplicated */
+SYNTHETIC_result_t step_record_801_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 802 exists */
+SYNTHETIC_result_t step_record_802_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 802 has value 5614 */
+SYNTHETIC_result_t step_record_802_has_value_5614(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 802 is updated */
+SYNTHETIC_result_t step_record_802_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 802 should be saved */
+SYNTHETIC_result_t step_record_802_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 802 should not be duplicated */
+SYNTHETIC_result_t step_record_802_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 803 exists */
+SYNTHETIC_result_t step_record_803_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 803 has value 5621 */
+SYNTHETIC_result_t step_record_803_has_value_5621(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 803 is updated */
+SYNTHETIC_result_t step_record_803_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 803 should be saved */
+SYNTHETIC_result_t step_record_803_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 803 should not be duplicated */
+SYNTHETIC_result_t step_record_803_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 804 exists */
+SYNTHETIC_result_t step_record_804_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 804 has value 5628 */
+SYNTHETIC_result_t step_record_804_has_value_5628(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 804 is updated */
+SYNTHETIC_result_t step_record_804_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 804 should be saved */
+SYNTHETIC_result_t step_record_804_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 804 should not be duplicated */
+SYNTHETIC_result_t step_record_804_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 805 exists */
+SYNTHETIC_result_t step_record_805_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 805 has value 5635 */
+SYNTHETIC_result_t step_record_805_has_value_5635(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 805 is updated */
+SYNTHETIC_result_t step_record_805_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 805 should be saved */
+SYNTHETIC_result_t step_record_805_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 805 should not be duplicated */
+SYNTHETIC_result_t step_record_805_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 806 exists */
+SYNTHETIC_result_t step_record_806_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 806 has value 5642 */
+SYNTHETIC_result_t step_record_806_has_value_5642(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 806 is updated */
+SYNTHETIC_result_t step_record_806_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 806 should be saved */
+SYNTHETIC_result_t step_record_806_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 806 should not be duplicated */
+SYNTHETIC_result_t step_record_806_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 807 exists */
+SYNTHETIC_result_t step_record_807_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 807 has value 5649 */
+SYNTHETIC_result_t step_record_807_has_value_5649(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 807 is updated */
+SYNTHETIC_result_t step_record_807_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 807 should be saved */
+SYNTHETIC_result_t step_record_807_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 807 should not be duplicated */
+SYNTHETIC_result_t step_record_807_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 808 exists */
+SYNTHETIC_result_t step_record_808_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 808 has value 5656 */
+SYNTHETIC_result_t step_record_808_has_value_5656(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 808 is updated */
+SYNTHETIC_result_t step_record_808_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 808 should be saved */
+SYNTHETIC_result_t step_record_808_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 808 should not be duplicated */
+SYNTHETIC_result_t step_record_808_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 809 exists */
+SYNTHETIC_result_t step_record_809_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 809 has value 5663 */
+SYNTHETIC_result_t step_record_809_has_value_5663(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 809 is updated */
+SYNTHETIC_result_t step_record_809_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 809 should be saved */
+SYNTHETIC_result_t step_record_809_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 809 should not be duplicated */
+SYNTHETIC_result_t step_record_809_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 810 exists */
+SYNTHETIC_result_t step_record_810_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 810 has value 5670 */
+SYNTHETIC_result_t step_record_810_has_value_5670(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 810 is updated */
+SYNTHETIC_result_t step_record_810_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 810 should be saved */
+SYNTHETIC_result_t step_record_810_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 810 should not be duplicated */
+SYNTHETIC_result_t step_record_810_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 811 exists */
+SYNTHETIC_result_t step_record_811_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 811 has value 5677 */
+SYNTHETIC_result_t step_record_811_has_value_5677(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 811 is updated */
+SYNTHETIC_result_t step_record_811_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 811 should be saved */
+SYNTHETIC_result_t step_record_811_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 811 should not be duplicated */
+SYNTHETIC_result_t step_record_811_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 812 exists */
+SYNTHETIC_result_t step_record_812_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 812 has value 5684 */
+SYNTHETIC_result_t step_record_812_has_value_5684(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 812 is updated */
+SYNTHETIC_result_t step_record_812_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 812 should be saved */
+SYNTHETIC_result_t step_record_812_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 812 should not be duplicated */
+SYNTHETIC_result_t step_record_812_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 813 exists */
+SYNTHETIC_result_t step_record_813_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 813 has value 5691 */
+SYNTHETIC_result_t step_record_813_has_value_5691(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 813 is updated */
+SYNTHETIC_result_t step_record_813_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 813 should be saved */
+SYNTHETIC_result_t step_record_813_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 813 should not be duplicated */
+SYNTHETIC_result_t step_record_813_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 814 exists */
+SYNTHETIC_result_t step_record_814_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 814 has value 5698 */
+SYNTHETIC_result_t step_record_814_has_value_5698(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 814 is updated */
+SYNTHETIC_result_t step_record_814_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 814 should be saved */
+SYNTHETIC_result_t step_record_814_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 814 should not be duplicated */
+SYNTHETIC_result_t step_record_814_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 815 exists */
+SYNTHETIC_result_t step_record_815_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 815 has value 5705 */
+SYNTHETIC_result_t step_record_815_has_value_5705(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 815 is updated */
+SYNTHETIC_result_t step_record_815_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 815 should be saved */
+SYNTHETIC_result_t step_record_815_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 815 should not be duplicated */
+SYNTHETIC_result_t step_record_815_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 816 exists */
+SYNTHETIC_result_t step_record_816_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 816 has value 5712 */
+SYNTHETIC_result_t step_record_816_has_value_5712(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 816 is updated */
+SYNTHETIC_result_t step_record_816_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 816 should be saved */
+SYNTHETIC_result_t step_record_816_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 816 should not be duplicated */
+SYNTHETIC_result_t step_record_816_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 817 exists */
+SYNTHETIC_result_t step_record_817_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 817 has value 5719 */
+SYNTHETIC_result_t step_record_817_has_value_5719(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 817 is updated */
+SYNTHETIC_result_t step_record_817_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 817 should be saved */
+SYNTHETIC_result_t step_record_817_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 817 should not be duplicated */
+SYNTHETIC_result_t step_record_817_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 818 exists */
+SYNTHETIC_result_t step_record_818_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 818 has value 5726 */
+SYNTHETIC_result_t step_record_818_has_value_5726(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 818 is updated */
+SYNTHETIC_result_t step_record_818_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 818 should be saved */
+SYNTHETIC_result_t step_record_818_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 818 should not be duplicated */
+SYNTHETIC_result_t step_record_818_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 819 exists */
+SYNTHETIC_result_t step_record_819_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 819 has value 5733 */
+SYNTHETIC_result_t step_record_819_has_value_5733(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 819 is updated */
+SYNTHETIC_result_t step_record_819_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 819 should be saved */
+SYNTHETIC_result_t step_record_819_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 819 should not be duplicated */
+SYNTHETIC_result_t step_record_819_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 820 exists */
+SYNTHETIC_result_t step_record_820_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 820 has value 5740 */
+SYNTHETIC_result_t step_record_820_has_value_5740(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 820 is updated */
+SYNTHETIC_result_t step_record_820_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 820 should be saved */
+SYNTHETIC_result_t step_record_820_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 820 should not be duplicated */
+SYNTHETIC_result_t step_record_820_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 821 exists */
+SYNTHETIC_result_t step_record_821_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 821 has value 5747 */
+SYNTHETIC_result_t step_record_821_has_value_5747(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 821 is updated */
+SYNTHETIC_result_t step_record_821_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 821 should be saved */
+SYNTHETIC_result_t step_record_821_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 821 should not be duplicated */
+SYNTHETIC_result_t step_record_821_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 822 exists */
+SYNTHETIC_result_t step_record_822_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 822 has value 5754 */
+SYNTHETIC_result_t step_record_822_has_value_5754(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 822 is updated */
+SYNTHETIC_result_t step_record_822_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 822 should be saved */
+SYNTHETIC_result_t step_record_822_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 822 should not be duplicated */
+SYNTHETIC_result_t step_record_822_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 823 exists */
+SYNTHETIC_result_t step_record_823_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 823 has value 5761 */
+SYNTHETIC_result_t step_record_823_has_value_5761(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 823 is updated */
+SYNTHETIC_result_t step_record_823_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 823 should be saved */
+SYNTHETIC_result_t step_record_823_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 823 should not be duplicated */
+SYNTHETIC_result_t step_record_823_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 824 exists */
+SYNTHETIC_result_t step_record_824_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 824 has value 5768 */
+SYNTHETIC_result_t step_record_824_has_value_5768(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 824 is updated */
+SYNTHETIC_result_t step_record_824_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 824 should be saved */
+SYNTHETIC_result_t step_record_824_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 824 should not be duplicated */
+SYNTHETIC_result_t step_record_824_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 825 exists */
+SYNTHETIC_result_t step_record_825_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 825 has value 5775 */
+SYNTHETIC_result_t step_record_825_has_value_5775(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 825 is updated */
+SYNTHETIC_result_t step_record_825_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 825 should be saved */
+SYNTHETIC_result_t step_record_825_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 825 should not be duplicated */
+SYNTHETIC_result_t step_record_825_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 826 exists */
+SYNTHETIC_result_t step_record_826_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 826 has value 5782 */
+SYNTHETIC_result_t step_record_826_has_value_5782(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 826 is updated */
+SYNTHETIC_result_t step_record_826_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 826 should be saved */
+SYNTHETIC_result_t step_record_826_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 826 should not be duplicated */
+SYNTHETIC_result_t step_record_826_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 827 exists */
+SYNTHETIC_result_t step_record_827_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 827 has value 5789 */
+SYNTHETIC_result_t step_record_827_has_value_5789(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 827 is updated */
+SYNTHETIC_result_t step_record_827_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 827 should be saved */
+SYNTHETIC_result_t step_record_827_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 827 should not be duplicated */
+SYNTHETIC_result_t step_record_827_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 828 exists */
+SYNTHETIC_result_t step_record_828_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 828 has value 5796 */
+SYNTHETIC_result_t step_record_828_has_value_5796(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 828 is updated */
+SYNTHETIC_result_t step_record_828_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 828 should be saved */
+SYNTHETIC_result_t step_record_828_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 828 should not be duplicated */
+SYNTHETIC_result_t step_record_828_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 829 exists */
+SYNTHETIC_result_t step_record_829_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 829 has value 5803 */
+SYNTHETIC_result_t step_record_829_has_value_5803(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 829 is updated */
+SYNTHETIC_result_t step_record_829_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 829 should be saved */
+SYNTHETIC_result_t step_record_829_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 829 should not be duplicated */
+SYNTHETIC_result_t step_record_829_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 830 exists */
+SYNTHETIC_result_t step_record_830_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 830 has value 5810 */
+SYNTHETIC_result_t step_record_830_has_value_5810(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 830 is updated */
+SYNTHETIC_result_t step_record_830_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 830 should be saved */
+SYNTHETIC_result_t step_record_830_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 830 should not be duplicated */
+SYNTHETIC_result_t step_record_830_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 831 exists */
+SYNTHETIC_result_t step_record_831_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 831 has value 5817 */
+SYNTHETIC_result_t step_record_831_has_value_5817(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 831 is updated */
+SYNTHETIC_result_t step_record_831_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 831 should be saved */
+SYNTHETIC_result_t step_record_831_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 831 should not be duplicated */
+SYNTHETIC_result_t step_record_831_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 832 exists */
+SYNTHETIC_result_t step_record_832_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 832 has value 5824 */
+SYNTHETIC_result_t step_record_832_has_value_5824(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 832 is updated */
+SYNTHETIC_result_t step_record_832_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 832 should be saved */
+SYNTHETIC_result_t step_record_832_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 832 should not be duplicated */
+SYNTHETIC_result_t step_record_832_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 833 exists */
+SYNTHETIC_result_t step_record_833_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 833 has value 5831 */
+SYNTHETIC_result_t step_record_833_has_value_5831(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 833 is updated */
+SYNTHETIC_result_t step_record_833_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 833 should be saved */
+SYNTHETIC_result_t step_record_833_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 833 should not be duplicated */
+SYNTHETIC_result_t step_record_833_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 834 exists */
+SYNTHETIC_result_t step_record_834_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 834 has value 5838 */
+SYNTHETIC_result_t step_record_834_has_value_5838(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 834 is updated */
+SYNTHETIC_result_t step_record_834_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 834 should be saved */
+SYNTHETIC_result_t step_record_834_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 834 should not be duplicated */
+SYNTHETIC_result_t step_record_834_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 835 exists */
+SYNTHETIC_result_t step_record_835_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 835 has value 5845 */
+SYNTHETIC_result_t step_record_835_has_value_5845(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 835 is updated */
+SYNTHETIC_result_t step_record_835_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 835 should be saved */
+SYNTHETIC_result_t step_record_835_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 835 should not be duplicated */
+SYNTHETIC_result_t step_record_835_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 836 exists */
+SYNTHETIC_result_t step_record_836_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 836 has value 5852 */
+SYNTHETIC_result_t step_record_836_has_value_5852(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 836 is updated */
+SYNTHETIC_result_t step_record_836_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 836 should be saved */
+SYNTHETIC_result_t step_record_836_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 836 should not be duplicated */
+SYNTHETIC_result_t step_record_836_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 837 exists */
+SYNTHETIC_result_t step_record_837_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 837 has value 5859 */
+SYNTHETIC_result_t step_record_837_has_value_5859(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 837 is updated */
+SYNTHETIC_result_t step_record_837_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 837 should be saved */
+SYNTHETIC_result_t step_record_837_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 837 should not be duplicated */
+SYNTHETIC_result_t step_record_837_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 838 exists */
+SYNTHETIC_result_t step_record_838_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 838 has value 5866 */
+SYNTHETIC_result_t step_record_838_has_value_5866(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 838 is updated */
+SYNTHETIC_result_t step_record_838_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 838 should be saved */
+SYNTHETIC_result_t step_record_838_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 838 should not be duplicated */
+SYNTHETIC_result_t step_record_838_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 839 exists */
+SYNTHETIC_result_t step_record_839_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 839 has value 5873 */
+SYNTHETIC_result_t step_record_839_has_value_5873(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 839 is updated */
+SYNTHETIC_result_t step_record_839_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 839 should be saved */
+SYNTHETIC_result_t step_record_839_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 839 should not be duplicated */
+SYNTHETIC_result_t step_record_839_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 840 exists */
+SYNTHETIC_result_t step_record_840_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 840 has value 5880 */
+SYNTHETIC_result_t step_record_840_has_value_5880(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 840 is updated */
+SYNTHETIC_result_t step_record_840_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 840 should be saved */
+SYNTHETIC_result_t step_record_840_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 840 should not be duplicated */
+SYNTHETIC_result_t step_record_840_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 841 exists */
+SYNTHETIC_result_t step_record_841_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 841 has value 5887 */
+SYNTHETIC_result_t step_record_841_has_value_5887(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 841 is updated */
+SYNTHETIC_result_t step_record_841_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 841 should be saved */
+SYNTHETIC_result_t step_record_841_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 841 should not be duplicated */
+SYNTHETIC_result_t step_record_841_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 842 exists */
+SYNTHETIC_result_t step_record_842_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 842 has value 5894 */
+SYNTHETIC_result_t step_record_842_has_value_5894(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 842 is updated */
+SYNTHETIC_result_t step_record_842_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 842 should be saved */
+SYNTHETIC_result_t step_record_842_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 842 should not be duplicated */
+SYNTHETIC_result_t step_record_842_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 843 exists */
+SYNTHETIC_result_t step_record_843_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 843 has value 5901 */
+SYNTHETIC_result_t step_record_843_has_value_5901(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 843 is updated */
+SYNTHETIC_result_t step_record_843_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 843 should be saved */
+SYNTHETIC_result_t step_record_843_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 843 should not be duplicated */
+SYNTHETIC_result_t step_record_843_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 844 exists */
+SYNTHETIC_result_t step_record_844_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 844 has value 5908 */
+SYNTHETIC_result_t step_record_844_has_value_5908(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 844 is updated */
+SYNTHETIC_result_t step_record_844_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 844 should be saved */
+SYNTHETIC_result_t step_record_844_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 844 should not be duplicated */
+SYNTHETIC_result_t step_record_844_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 845 exists */
+SYNTHETIC_result_t step_record_845_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 845 has value 5915 */
+SYNTHETIC_result_t step_record_845_has_value_5915(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 845 is updated */
+SYNTHETIC_result_t step_record_845_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 845 should be saved */
+SYNTHETIC_result_t step_record_845_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 845 should not be duplicated */
+SYNTHETIC_result_t step_record_845_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 846 exists */
+SYNTHETIC_result_t step_record_846_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 846 has value 5922 */
+SYNTHETIC_result_t step_record_846_has_value_5922(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 846 is updated */
+SYNTHETIC_result_t step_record_846_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 846 should be saved */
+SYNTHETIC_result_t step_record_846_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 846 should not be duplicated */
+SYNTHETIC_result_t step_record_846_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 847 exists */
+SYNTHETIC_result_t step_record_847_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 847 has value 5929 */
+SYNTHETIC_result_t step_record_847_has_value_5929(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 847 is updated */
+SYNTHETIC_result_t step_record_847_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 847 should be saved */
+SYNTHETIC_result_t step_record_847_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 847 should not be duplicated */
+SYNTHETIC_result_t step_record_847_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 848 exists */
+SYNTHETIC_result_t step_record_848_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 848 has value 5936 */
+SYNTHETIC_result_t step_record_848_has_value_5936(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 848 is updated */
+SYNTHETIC_result_t step_record_848_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 848 should be saved */
+SYNTHETIC_result_t step_record_848_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 848 should not be duplicated */
+SYNTHETIC_result_t step_record_848_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 849 exists */
+SYNTHETIC_result_t step_record_849_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 849 has value 5943 */
+SYNTHETIC_result_t step_record_849_has_value_5943(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 849 is updated */
+SYNTHETIC_result_t step_record_849_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 849 should be saved */
+SYNTHETIC_result_t step_record_849_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 849 should not be duplicated */
+SYNTHETIC_result_t step_record_849_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 850 exists */
+SYNTHETIC_result_t step_record_850_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 850 has value 5950 */
+SYNTHETIC_result_t step_record_850_has_value_5950(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 850 is updated */
+SYNTHETIC_result_t step_record_850_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 850 should be saved */
+SYNTHETIC_result_t step_record_850_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 850 should not be duplicated */
+SYNTHETIC_result_t step_record_850_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 851 exists */
+SYNTHETIC_result_t step_record_851_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 851 has value 5957 */
+SYNTHETIC_result_t step_record_851_has_value_5957(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 851 is updated */
+SYNTHETIC_result_t step_record_851_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 851 should be saved */
+SYNTHETIC_result_t step_record_851_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 851 should not be duplicated */
+SYNTHETIC_result_t step_record_851_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 852 exists */
+SYNTHETIC_result_t step_record_852_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 852 has value 5964 */
+SYNTHETIC_result_t step_record_852_has_value_5964(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 852 is updated */
+SYNTHETIC_result_t step_record_852_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 852 should be saved */
+SYNTHETIC_result_t step_record_852_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 852 should not be duplicated */
+SYNTHETIC_result_t step_record_852_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 853 exists */
+SYNTHETIC_result_t step_record_853_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 853 has value 5971 */
+SYNTHETIC_result_t step_record_853_has_value_5971(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 853 is updated */
+SYNTHETIC_result_t step_record_853_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 853 should be saved */
+SYNTHETIC_result_t step_record_853_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 853 should not be duplicated */
+SYNTHETIC_result_t step_record_853_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 854 exists */
+SYNTHETIC_result_t step_record_854_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 854 has value 5978 */
+SYNTHETIC_result_t step_record_854_has_value_5978(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 854 is updated */
+SYNTHETIC_result_t step_record_854_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 854 should be saved */
+SYNTHETIC_result_t step_record_854_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 854 should not be duplicated */
+SYNTHETIC_result_t step_record_854_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 855 exists */
+SYNTHETIC_result_t step_record_855_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 855 has value 5985 */
+SYNTHETIC_result_t step_record_855_has_value_5985(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 855 is updated */
+SYNTHETIC_result_t step_record_855_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 855 should be saved */
+SYNTHETIC_result_t step_record_855_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 855 should not be duplicated */
+SYNTHETIC_result_t step_record_855_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 856 exists */
+SYNTHETIC_result_t step_record_856_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 856 has value 5992 */
+SYNTHETIC_result_t step_record_856_has_value_5992(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 856 is updated */
+SYNTHETIC_result_t step_record_856_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 856 should be saved */
+SYNTHETIC_result_t step_record_856_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 856 should not be duplicated */
+SYNTHETIC_result_t step_record_856_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 857 exists */
+SYNTHETIC_result_t step_record_857_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 857 has value 5999 */
+SYNTHETIC_result_t step_record_857_has_value_5999(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 857 is updated */
+SYNTHETIC_result_t step_record_857_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 857 should be saved */
+SYNTHETIC_result_t step_record_857_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 857 should not be duplicated */
+SYNTHETIC_result_t step_record_857_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 858 exists */
+SYNTHETIC_result_t step_record_858_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 858 has value 6006 */
+SYNTHETIC_result_t step_record_858_has_value_6006(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 858 is updated */
+SYNTHETIC_result_t step_record_858_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 858 should be saved */
+SYNTHETIC_result_t step_record_858_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 858 should not be duplicated */
+SYNTHETIC_result_t step_record_858_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 859 exists */
+SYNTHETIC_result_t step_record_859_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 859 has value 6013 */
+SYNTHETIC_result_t step_record_859_has_value_6013(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 859 is updated */
+SYNTHETIC_result_t step_record_859_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 859 should be saved */
+SYNTHETIC_result_t step_record_859_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 859 should not be duplicated */
+SYNTHETIC_result_t step_record_859_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 860 exists */
+SYNTHETIC_result_t step_record_860_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 860 has value 6020 */
+SYNTHETIC_result_t step_record_860_has_value_6020(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 860 is updated */
+SYNTHETIC_result_t step_record_860_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 860 should be saved */
+SYNTHETIC_result_t step_record_860_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 860 should not be duplicated */
+SYNTHETIC_result_t step_record_860_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 861 exists */
+SYNTHETIC_result_t step_record_861_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 861 has value 6027 */
+SYNTHETIC_result_t step_record_861_has_value_6027(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 861 is updated */
+SYNTHETIC_result_t step_record_861_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 861 should be saved */
+SYNTHETIC_result_t step_record_861_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 861 should not be duplicated */
+SYNTHETIC_result_t step_record_861_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 862 exists */
+SYNTHETIC_result_t step_record_862_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 862 has value 6034 */
+SYNTHETIC_result_t step_record_862_has_value_6034(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 862 is updated */
+SYNTHETIC_result_t step_record_862_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 862 should be saved */
+SYNTHETIC_result_t step_record_862_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 862 should not be duplicated */
+SYNTHETIC_result_t step_record_862_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 863 exists */
+SYNTHETIC_result_t step_record_863_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 863 has value 6041 */
+SYNTHETIC_result_t step_record_863_has_value_6041(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 863 is updated */
+SYNTHETIC_result_t step_record_863_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 863 should be saved */
+SYNTHETIC_result_t step_record_863_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 863 should not be duplicated */
+SYNTHETIC_result_t step_record_863_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 864 exists */
+SYNTHETIC_result_t step_record_864_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 864 has value 6048 */
+SYNTHETIC_result_t step_record_864_has_value_6048(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 864 is updated */
+SYNTHETIC_result_t step_record_864_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 864 should be saved */
+SYNTHETIC_result_t step_record_864_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 864 should not be duplicated */
+SYNTHETIC_result_t step_record_864_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 865 exists */
+SYNTHETIC_result_t step_record_865_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 865 has value 6055 */
+SYNTHETIC_result_t step_record_865_has_value_6055(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 865 is updated */
+SYNTHETIC_result_t step_record_865_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 865 should be saved */
+SYNTHETIC_result_t step_record_865_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 865 should not be duplicated */
+SYNTHETIC_result_t step_record_865_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 866 exists */
+SYNTHETIC_result_t step_record_866_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 866 has value 6062 */
+SYNTHETIC_result_t step_record_866_has_value_6062(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 866 is updated */
+SYNTHETIC_result_t step_record_866_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 866 should be saved */
+SYNTHETIC_result_t step_record_866_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 866 should not be duplicated */
+SYNTHETIC_result_t step_record_866_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 867 exists */
+SYNTHETIC_result_t step_record_867_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 867 has value 6069 */
+SYNTHETIC_result_t step_record_867_has_value_6069(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 867 is updated */
+SYNTHETIC_result_t step_record_867_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 867 should be saved */
+SYNTHETIC_result_t step_record_867_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 867 should not be duplicated */
+SYNTHETIC_result_t step_record_867_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 868 exists */
+SYNTHETIC_result_t step_record_868_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 868 has value 6076 */
+SYNTHETIC_result_t step_record_868_has_value_6076(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 868 is updated */
+SYNTHETIC_result_t step_record_868_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 868 should be saved */
+SYNTHETIC_result_t step_record_868_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 868 should not be duplicated */
+SYNTHETIC_result_t step_record_868_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 869 exists */
+SYNTHETIC_result_t step_record_869_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 869 has value 6083 */
+SYNTHETIC_result_t step_record_869_has_value_6083(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 869 is updated */
+SYNTHETIC_result_t step_record_869_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 869 should be saved */
+SYNTHETIC_result_t step_record_869_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 869 should not be duplicated */
+SYNTHETIC_result_t step_record_869_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 870 exists */
+SYNTHETIC_result_t step_record_870_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 870 has value 6090 */
+SYNTHETIC_result_t step_record_870_has_value_6090(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 870 is updated */
+SYNTHETIC_result_t step_record_870_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 870 should be saved */
+SYNTHETIC_result_t step_record_870_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 870 should not be duplicated */
+SYNTHETIC_result_t step_record_870_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 871 exists */
+SYNTHETIC_result_t step_record_871_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 871 has value 6097 */
+SYNTHETIC_result_t step_record_871_has_value_6097(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 871 is updated */
+SYNTHETIC_result_t step_record_871_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 871 should be saved */
+SYNTHETIC_result_t step_record_871_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 871 should not be duplicated */
+SYNTHETIC_result_t step_record_871_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 872 exists */
+SYNTHETIC_result_t step_record_872_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 872 has value 6104 */
+SYNTHETIC_result_t step_record_872_has_value_6104(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 872 is updated */
+SYNTHETIC_result_t step_record_872_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 872 should be saved */
+SYNTHETIC_result_t step_record_872_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 872 should not be duplicated */
+SYNTHETIC_result_t step_record_872_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 873 exists */
+SYNTHETIC_result_t step_record_873_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 873 has value 6111 */
+SYNTHETIC_result_t step_record_873_has_value_6111(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 873 is updated */
+SYNTHETIC_result_t step_record_873_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 873 should be saved */
+SYNTHETIC_result_t step_record_873_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 873 should not be duplicated */
+SYNTHETIC_result_t step_record_873_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 874 exists */
+SYNTHETIC_result_t step_record_874_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 874 has value 6118 */
+SYNTHETIC_result_t step_record_874_has_value_6118(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 874 is updated */
+SYNTHETIC_result_t step_record_874_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 874 should be saved */
+SYNTHETIC_result_t step_record_874_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 874 should not be duplicated */
+SYNTHETIC_result_t step_record_874_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 875 exists */
+SYNTHETIC_result_t step_record_875_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 875 has value 6125 */
+SYNTHETIC_result_t step_record_875_has_value_6125(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 875 is updated */
+SYNTHETIC_result_t step_record_875_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 875 should be saved */
+SYNTHETIC_result_t step_record_875_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 875 should not be duplicated */
+SYNTHETIC_result_t step_record_875_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 876 exists */
+SYNTHETIC_result_t step_record_876_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 876 has value 6132 */
+SYNTHETIC_result_t step_record_876_has_value_6132(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 876 is updated */
+SYNTHETIC_result_t step_record_876_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 876 should be saved */
+SYNTHETIC_result_t step_record_876_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 876 should not be duplicated */
+SYNTHETIC_result_t step_record_876_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 877 exists */
+SYNTHETIC_result_t step_record_877_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 877 has value 6139 */
+SYNTHETIC_result_t step_record_877_has_value_6139(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 877 is updated */
+SYNTHETIC_result_t step_record_877_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 877 should be saved */
+SYNTHETIC_result_t step_record_877_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 877 should not be duplicated */
+SYNTHETIC_result_t step_record_877_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 878 exists */
+SYNTHETIC_result_t step_record_878_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 878 has value 6146 */
+SYNTHETIC_result_t step_record_878_has_value_6146(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 878 is updated */
+SYNTHETIC_result_t step_record_878_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 878 should be saved */
+SYNTHETIC_result_t step_record_878_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 878 should not be duplicated */
+SYNTHETIC_result_t step_record_878_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 879 exists */
+SYNTHETIC_result_t step_record_879_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 879 has value 6153 */
+SYNTHETIC_result_t step_record_879_has_value_6153(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 879 is updated */
+SYNTHETIC_result_t step_record_879_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 879 should be saved */
+SYNTHETIC_result_t step_record_879_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 879 should not be duplicated */
+SYNTHETIC_result_t step_record_879_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 880 exists */
+SYNTHETIC_result_t step_record_880_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 880 has value 6160 */
+SYNTHETIC_result_t step_record_880_has_value_6160(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 880 is updated */
+SYNTHETIC_result_t step_record_880_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 880 should be saved */
+SYNTHETIC_result_t step_record_880_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 880 should not be duplicated */
+SYNTHETIC_result_t step_record_880_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 881 exists */
+SYNTHETIC_result_t step_record_881_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 881 has value 6167 */
+SYNTHETIC_result_t step_record_881_has_value_6167(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 881 is updated */
+SYNTHETIC_result_t step_record_881_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 881 should be saved */
+SYNTHETIC_result_t step_record_881_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 881 should not be duplicated */
+SYNTHETIC_result_t step_record_881_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 882 exists */
+SYNTHETIC_result_t step_record_882_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 882 has value 6174 */
+SYNTHETIC_result_t step_record_882_has_value_6174(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 882 is updated */
+SYNTHETIC_result_t step_record_882_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 882 should be saved */
+SYNTHETIC_result_t step_record_882_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 882 should not be duplicated */
+SYNTHETIC_result_t step_record_882_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 883 exists */
+SYNTHETIC_result_t step_record_883_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 883 has value 6181 */
+SYNTHETIC_result_t step_record_883_has_value_6181(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 883 is updated */
+SYNTHETIC_result_t step_record_883_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 883 should be saved */
+SYNTHETIC_result_t step_record_883_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 883 should not be duplicated */
+SYNTHETIC_result_t step_record_883_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 884 exists */
+SYNTHETIC_result_t step_record_884_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 884 has value 6188 */
+SYNTHETIC_result_t step_record_884_has_value_6188(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 884 is updated */
+SYNTHETIC_result_t step_record_884_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 884 should be saved */
+SYNTHETIC_result_t step_record_884_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 884 should not be duplicated */
+SYNTHETIC_result_t step_record_884_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 885 exists */
+SYNTHETIC_result_t step_record_885_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 885 has value 6195 */
+SYNTHETIC_result_t step_record_885_has_value_6195(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 885 is updated */
+SYNTHETIC_result_t step_record_885_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 885 should be saved */
+SYNTHETIC_result_t step_record_885_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 885 should not be duplicated */
+SYNTHETIC_result_t step_record_885_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 886 exists */
+SYNTHETIC_result_t step_record_886_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 886 has value 6202 */
+SYNTHETIC_result_t step_record_886_has_value_6202(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 886 is updated */
+SYNTHETIC_result_t step_record_886_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 886 should be saved */
+SYNTHETIC_result_t step_record_886_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 886 should not be duplicated */
+SYNTHETIC_result_t step_record_886_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 887 exists */
+SYNTHETIC_result_t step_record_887_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 887 has value 6209 */
+SYNTHETIC_result_t step_record_887_has_value_6209(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 887 is updated */
+SYNTHETIC_result_t step_record_887_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 887 should be saved */
+SYNTHETIC_result_t step_record_887_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 887 should not be duplicated */
+SYNTHETIC_result_t step_record_887_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 888 exists */
+SYNTHETIC_result_t step_record_888_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 888 has value 6216 */
+SYNTHETIC_result_t step_record_888_has_value_6216(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 888 is updated */
+SYNTHETIC_result_t step_record_888_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 888 should be saved */
+SYNTHETIC_result_t step_record_888_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 888 should not be duplicated */
+SYNTHETIC_result_t step_record_888_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 889 exists */
+SYNTHETIC_result_t step_record_889_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 889 has value 6223 */
+SYNTHETIC_result_t step_record_889_has_value_6223(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 889 is updated */
+SYNTHETIC_result_t step_record_889_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 889 should be saved */
+SYNTHETIC_result_t step_record_889_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 889 should not be duplicated */
+SYNTHETIC_result_t step_record_889_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 890 exists */
+SYNTHETIC_result_t step_record_890_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 890 has value 6230 */
+SYNTHETIC_result_t step_record_890_has_value_6230(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 890 is updated */
+SYNTHETIC_result_t step_record_890_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 890 should be saved */
+SYNTHETIC_result_t step_record_890_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 890 should not be duplicated */
+SYNTHETIC_result_t step_record_890_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 891 exists */
+SYNTHETIC_result_t step_record_891_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 891 has value 6237 */
+SYNTHETIC_result_t step_record_891_has_value_6237(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 891 is updated */
+SYNTHETIC_result_t step_record_891_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 891 should be saved */
+SYNTHETIC_result_t step_record_891_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 891 should not be duplicated */
+SYNTHETIC_result_t step_record_891_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 892 exists */
+SYNTHETIC_result_t step_record_892_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 892 has value 6244 */
+SYNTHETIC_result_t step_record_892_has_value_6244(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 892 is updated */
+SYNTHETIC_result_t step_record_892_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 892 should be saved */
+SYNTHETIC_result_t step_record_892_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 892 should not be duplicated */
+SYNTHETIC_result_t step_record_892_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 893 exists */
+SYNTHETIC_result_t step_record_893_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 893 has value 6251 */
+SYNTHETIC_result_t step_record_893_has_value_6251(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 893 is updated */
+SYNTHETIC_result_t step_record_893_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 893 should be saved */
+SYNTHETIC_result_t step_record_893_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 893 should not be duplicated */
+SYNTHETIC_result_t step_record_893_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 894 exists */
+SYNTHETIC_result_t step_record_894_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 894 has value 6258 */
+SYNTHETIC_result_t step_record_894_has_value_6258(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 894 is updated */
+SYNTHETIC_result_t step_record_894_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 894 should be saved */
+SYNTHETIC_result_t step_record_894_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 894 should not be duplicated */
+SYNTHETIC_result_t step_record_894_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 895 exists */
+SYNTHETIC_result_t step_record_895_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 895 has value 6265 */
+SYNTHETIC_result_t step_record_895_has_value_6265(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 895 is updated */
+SYNTHETIC_result_t step_record_895_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 895 should be saved */
+SYNTHETIC_result_t step_record_895_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 895 should not be duplicated */
+SYNTHETIC_result_t step_record_895_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 896 exists */
+SYNTHETIC_result_t step_record_896_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 896 has value 6272 */
+SYNTHETIC_result_t step_record_896_has_value_6272(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 896 is updated */
+SYNTHETIC_result_t step_record_896_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 896 should be saved */
+SYNTHETIC_result_t step_record_896_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 896 should not be duplicated */
+SYNTHETIC_result_t step_record_896_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 897 exists */
+SYNTHETIC_result_t step_record_897_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 897 has value 6279 */
+SYNTHETIC_result_t step_record_897_has_value_6279(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 897 is updated */
+SYNTHETIC_result_t step_record_897_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 897 should be saved */
+SYNTHETIC_result_t step_record_897_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 897 should not be duplicated */
+SYNTHETIC_result_t step_record_897_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 898 exists */
+SYNTHETIC_result_t step_record_898_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 898 has value 6286 */
+SYNTHETIC_result_t step_record_898_has_value_6286(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 898 is updated */
+SYNTHETIC_result_t step_record_898_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 898 should be saved */
+SYNTHETIC_result_t step_record_898_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 898 should not be duplicated */
+SYNTHETIC_result_t step_record_898_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 899 exists */
+SYNTHETIC_result_t step_record_899_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 899 has value 6293 */
+SYNTHETIC_result_t step_record_899_has_value_6293(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 899 is updated */
+SYNTHETIC_result_t step_record_899_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 899 should be saved */
+SYNTHETIC_result_t step_record_899_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 899 should not be duplicated */
+SYNTHETIC_result_t step_record_899_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 900 exists */
+SYNTHETIC_result_t step_record_900_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 900 has value 6300 */
+SYNTHETIC_result_t step_record_900_has_value_6300(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 900 is updated */
+SYNTHETIC_result_t step_record_900_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 900 should be saved */
+SYNTHETIC_result_t step_record_900_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 900 should not be duplicated */
+SYNTHETIC_result_t step_record_900_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 901 exists */
+SYNTHETIC_result_t step_record_901_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 901 has value 6307 */
+SYNTHETIC_result_t step_record_901_has_value_6307(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 901 is updated */
+SYNTHETIC_result_t step_record_901_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 901 should be saved */
+SYNTHETIC_result_t step_record_901_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 901 should not be duplicated */
+SYNTHETIC_result_t step_record_901_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 902 exists */
+SYNTHETIC_result_t step_record_902_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 902 has value 6314 */
+SYNTHETIC_result_t step_record_902_has_value_6314(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 902 is updated */
+SYNTHETIC_result_t step_record_902_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 902 should be saved */
+SYNTHETIC_result_t step_record_902_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 902 should not be duplicated */
+SYNTHETIC_result_t step_record_902_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 903 exists */
+SYNTHETIC_result_t step_record_903_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 903 has value 6321 */
+SYNTHETIC_result_t step_record_903_has_value_6321(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 903 is updated */
+SYNTHETIC_result_t step_record_903_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 903 should be saved */
+SYNTHETIC_result_t step_record_903_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 903 should not be duplicated */
+SYNTHETIC_result_t step_record_903_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 904 exists */
+SYNTHETIC_result_t step_record_904_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 904 has value 6328 */
+SYNTHETIC_result_t step_record_904_has_value_6328(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 904 is updated */
+SYNTHETIC_result_t step_record_904_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 904 should be saved */
+SYNTHETIC_result_t step_record_904_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 904 should not be duplicated */
+SYNTHETIC_result_t step_record_904_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 905 exists */
+SYNTHETIC_result_t step_record_905_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 905 has value 6335 */
+SYNTHETIC_result_t step_record_905_has_value_6335(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 905 is updated */
+SYNTHETIC_result_t step_record_905_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 905 should be saved */
+SYNTHETIC_result_t step_record_905_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 905 should not be duplicated */
+SYNTHETIC_result_t step_record_905_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 906 exists */
+SYNTHETIC_result_t step_record_906_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 906 has value 6342 */
+SYNTHETIC_result_t step_record_906_has_value_6342(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 906 is updated */
+SYNTHETIC_result_t step_record_906_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 906 should be saved */
+SYNTHETIC_result_t step_record_906_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 906 should not be duplicated */
+SYNTHETIC_result_t step_record_906_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 907 exists */
+SYNTHETIC_result_t step_record_907_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 907 has value 6349 */
+SYNTHETIC_result_t step_record_907_has_value_6349(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 907 is updated */
+SYNTHETIC_result_t step_record_907_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 907 should be saved */
+SYNTHETIC_result_t step_record_907_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 907 should not be duplicated */
+SYNTHETIC_result_t step_record_907_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 908 exists */
+SYNTHETIC_result_t step_record_908_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 908 has value 6356 */
+SYNTHETIC_result_t step_record_908_has_value_6356(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 908 is updated */
+SYNTHETIC_result_t step_record_908_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 908 should be saved */
+SYNTHETIC_result_t step_record_908_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 908 should not be duplicated */
+SYNTHETIC_result_t step_record_908_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 909 exists */
+SYNTHETIC_result_t step_record_909_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 909 has value 6363 */
+SYNTHETIC_result_t step_record_909_has_value_6363(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 909 is updated */
+SYNTHETIC_result_t step_record_909_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 909 should be saved */
+SYNTHETIC_result_t step_record_909_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 909 should not be duplicated */
+SYNTHETIC_result_t step_record_909_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 910 exists */
+SYNTHETIC_result_t step_record_910_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 910 has value 6370 */
+SYNTHETIC_result_t step_record_910_has_value_6370(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 910 is updated */
+SYNTHETIC_result_t step_record_910_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 910 should be saved */
+SYNTHETIC_result_t step_record_910_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 910 should not be duplicated */
+SYNTHETIC_result_t step_record_910_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 911 exists */
+SYNTHETIC_result_t step_record_911_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 911 has value 6377 */
+SYNTHETIC_result_t step_record_911_has_value_6377(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 911 is updated */
+SYNTHETIC_result_t step_record_911_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 911 should be saved */
+SYNTHETIC_result_t step_record_911_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 911 should not be duplicated */
+SYNTHETIC_result_t step_record_911_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 912 exists */
+SYNTHETIC_result_t step_record_912_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 912 has value 6384 */
+SYNTHETIC_result_t step_record_912_has_value_6384(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 912 is updated */
+SYNTHETIC_result_t step_record_912_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 912 should be saved */
+SYNTHETIC_result_t step_record_912_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 912 should not be duplicated */
+SYNTHETIC_result_t step_record_912_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 913 exists */
+SYNTHETIC_result_t step_record_913_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 913 has value 6391 */
+SYNTHETIC_result_t step_record_913_has_value_6391(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 913 is updated */
+SYNTHETIC_result_t step_record_913_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 913 should be saved */
+SYNTHETIC_result_t step_record_913_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 913 should not be duplicated */
+SYNTHETIC_result_t step_record_913_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 914 exists */
+SYNTHETIC_result_t step_record_914_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 914 has value 6398 */
+SYNTHETIC_result_t step_record_914_has_value_6398(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 914 is updated */
+SYNTHETIC_result_t step_record_914_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 914 should be saved */
+SYNTHETIC_result_t step_record_914_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 914 should not be duplicated */
+SYNTHETIC_result_t step_record_914_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 915 exists */
+SYNTHETIC_result_t step_record_915_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 915 has value 6405 */
+SYNTHETIC_result_t step_record_915_has_value_6405(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 915 is updated */
+SYNTHETIC_result_t step_record_915_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 915 should be saved */
+SYNTHETIC_result_t step_record_915_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 915 should not be duplicated */
+SYNTHETIC_result_t step_record_915_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 916 exists */
+SYNTHETIC_result_t step_record_916_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 916 has value 6412 */
+SYNTHETIC_result_t step_record_916_has_value_6412(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 916 is updated */
+SYNTHETIC_result_t step_record_916_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 916 should be saved */
+SYNTHETIC_result_t step_record_916_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 916 should not be duplicated */
+SYNTHETIC_result_t step_record_916_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 917 exists */
+SYNTHETIC_result_t step_record_917_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 917 has value 6419 */
+SYNTHETIC_result_t step_record_917_has_value_6419(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 917 is updated */
+SYNTHETIC_result_t step_record_917_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 917 should be saved */
+SYNTHETIC_result_t step_record_917_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 917 should not be duplicated */
+SYNTHETIC_result_t step_record_917_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 918 exists */
+SYNTHETIC_result_t step_record_918_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 918 has value 6426 */
+SYNTHETIC_result_t step_record_918_has_value_6426(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 918 is updated */
+SYNTHETIC_result_t step_record_918_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 918 should be saved */
+SYNTHETIC_result_t step_record_918_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 918 should not be duplicated */
+SYNTHETIC_result_t step_record_918_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 919 exists */
+SYNTHETIC_result_t step_record_919_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 919 has value 6433 */
+SYNTHETIC_result_t step_record_919_has_value_6433(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 919 is updated */
+SYNTHETIC_result_t step_record_919_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 919 should be saved */
+SYNTHETIC_result_t step_record_919_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 919 should not be duplicated */
+SYNTHETIC_result_t step_record_919_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 920 exists */
+SYNTHETIC_result_t step_record_920_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 920 has value 6440 */
+SYNTHETIC_result_t step_record_920_has_value_6440(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 920 is updated */
+SYNTHETIC_result_t step_record_920_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 920 should be saved */
+SYNTHETIC_result_t step_record_920_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 920 should not be duplicated */
+SYNTHETIC_result_t step_record_920_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 921 exists */
+SYNTHETIC_result_t step_record_921_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 921 has value 6447 */
+SYNTHETIC_result_t step_record_921_has_value_6447(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 921 is updated */
+SYNTHETIC_result_t step_record_921_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 921 should be saved */
+SYNTHETIC_result_t step_record_921_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 921 should not be duplicated */
+SYNTHETIC_result_t step_record_921_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 922 exists */
+SYNTHETIC_result_t step_record_922_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 922 has value 6454 */
+SYNTHETIC_result_t step_record_922_has_value_6454(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 922 is updated */
+SYNTHETIC_result_t step_record_922_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 922 should be saved */
+SYNTHETIC_result_t step_record_922_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 922 should not be duplicated */
+SYNTHETIC_result_t step_record_922_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 923 exists */
+SYNTHETIC_result_t step_record_923_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 923 has value 6461 */
+SYNTHETIC_result_t step_record_923_has_value_6461(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 923 is updated */
+SYNTHETIC_result_t step_record_923_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 923 should be saved */
+SYNTHETIC_result_t step_record_923_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 923 should not be duplicated */
+SYNTHETIC_result_t step_record_923_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 924 exists */
+SYNTHETIC_result_t step_record_924_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 924 has value 6468 */
+SYNTHETIC_result_t step_record_924_has_value_6468(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 924 is updated */
+SYNTHETIC_result_t step_record_924_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 924 should be saved */
+SYNTHETIC_result_t step_record_924_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 924 should not be duplicated */
+SYNTHETIC_result_t step_record_924_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 925 exists */
+SYNTHETIC_result_t step_record_925_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 925 has value 6475 */
+SYNTHETIC_result_t step_record_925_has_value_6475(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 925 is updated */
+SYNTHETIC_result_t step_record_925_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 925 should be saved */
+SYNTHETIC_result_t step_record_925_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 925 should not be duplicated */
+SYNTHETIC_result_t step_record_925_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 926 exists */
+SYNTHETIC_result_t step_record_926_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 926 has value 6482 */
+SYNTHETIC_result_t step_record_926_has_value_6482(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 926 is updated */
+SYNTHETIC_result_t step_record_926_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 926 should be saved */
+SYNTHETIC_result_t step_record_926_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 926 should not be duplicated */
+SYNTHETIC_result_t step_record_926_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 927 exists */
+SYNTHETIC_result_t step_record_927_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 927 has value 6489 */
+SYNTHETIC_result_t step_record_927_has_value_6489(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 927 is updated */
+SYNTHETIC_result_t step_record_927_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 927 should be saved */
+SYNTHETIC_result_t step_record_927_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 927 should not be duplicated */
+SYNTHETIC_result_t step_record_927_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 928 exists */
+SYNTHETIC_result_t step_record_928_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 928 has value 6496 */
+SYNTHETIC_result_t step_record_928_has_value_6496(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 928 is updated */
+SYNTHETIC_result_t step_record_928_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 928 should be saved */
+SYNTHETIC_result_t step_record_928_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 928 should not be duplicated */
+SYNTHETIC_result_t step_record_928_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 929 exists */
+SYNTHETIC_result_t step_record_929_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 929 has value 6503 */
+SYNTHETIC_result_t step_record_929_has_value_6503(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 929 is updated */
+SYNTHETIC_result_t step_record_929_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 929 should be saved */
+SYNTHETIC_result_t step_record_929_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 929 should not be duplicated */
+SYNTHETIC_result_t step_record_929_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 930 exists */
+SYNTHETIC_result_t step_record_930_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 930 has value 6510 */
+SYNTHETIC_result_t step_record_930_has_value_6510(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 930 is updated */
+SYNTHETIC_result_t step_record_930_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 930 should be saved */
+SYNTHETIC_result_t step_record_930_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 930 should not be duplicated */
+SYNTHETIC_result_t step_record_930_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 931 exists */
+SYNTHETIC_result_t step_record_931_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 931 has value 6517 */
+SYNTHETIC_result_t step_record_931_has_value_6517(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 931 is updated */
+SYNTHETIC_result_t step_record_931_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 931 should be saved */
+SYNTHETIC_result_t step_record_931_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 931 should not be duplicated */
+SYNTHETIC_result_t step_record_931_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 932 exists */
+SYNTHETIC_result_t step_record_932_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 932 has value 6524 */
+SYNTHETIC_result_t step_record_932_has_value_6524(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 932 is updated */
+SYNTHETIC_result_t step_record_932_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 932 should be saved */
+SYNTHETIC_result_t step_record_932_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 932 should not be duplicated */
+SYNTHETIC_result_t step_record_932_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 933 exists */
+SYNTHETIC_result_t step_record_933_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 933 has value 6531 */
+SYNTHETIC_result_t step_record_933_has_value_6531(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 933 is updated */
+SYNTHETIC_result_t step_record_933_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 933 should be saved */
+SYNTHETIC_result_t step_record_933_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 933 should not be duplicated */
+SYNTHETIC_result_t step_record_933_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 934 exists */
+SYNTHETIC_result_t step_record_934_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 934 has value 6538 */
+SYNTHETIC_result_t step_record_934_has_value_6538(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 934 is updated */
+SYNTHETIC_result_t step_record_934_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 934 should be saved */
+SYNTHETIC_result_t step_record_934_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 934 should not be duplicated */
+SYNTHETIC_result_t step_record_934_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 935 exists */
+SYNTHETIC_result_t step_record_935_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 935 has value 6545 */
+SYNTHETIC_result_t step_record_935_has_value_6545(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 935 is updated */
+SYNTHETIC_result_t step_record_935_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 935 should be saved */
+SYNTHETIC_result_t step_record_935_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 935 should not be duplicated */
+SYNTHETIC_result_t step_record_935_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 936 exists */
+SYNTHETIC_result_t step_record_936_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 936 has value 6552 */
+SYNTHETIC_result_t step_record_936_has_value_6552(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 936 is updated */
+SYNTHETIC_result_t step_record_936_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 936 should be saved */
+SYNTHETIC_result_t step_record_936_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 936 should not be duplicated */
+SYNTHETIC_result_t step_record_936_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 937 exists */
+SYNTHETIC_result_t step_record_937_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 937 has value 6559 */
+SYNTHETIC_result_t step_record_937_has_value_6559(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 937 is updated */
+SYNTHETIC_result_t step_record_937_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 937 should be saved */
+SYNTHETIC_result_t step_record_937_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 937 should not be duplicated */
+SYNTHETIC_result_t step_record_937_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 938 exists */
+SYNTHETIC_result_t step_record_938_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 938 has value 6566 */
+SYNTHETIC_result_t step_record_938_has_value_6566(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 938 is updated */
+SYNTHETIC_result_t step_record_938_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 938 should be saved */
+SYNTHETIC_result_t step_record_938_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 938 should not be duplicated */
+SYNTHETIC_result_t step_record_938_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 939 exists */
+SYNTHETIC_result_t step_record_939_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 939 has value 6573 */
+SYNTHETIC_result_t step_record_939_has_value_6573(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 939 is updated */
+SYNTHETIC_result_t step_record_939_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 939 should be saved */
+SYNTHETIC_result_t step_record_939_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 939 should not be duplicated */
+SYNTHETIC_result_t step_record_939_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 940 exists */
+SYNTHETIC_result_t step_record_940_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 940 has value 6580 */
+SYNTHETIC_result_t step_record_940_has_value_6580(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 940 is updated */
+SYNTHETIC_result_t step_record_940_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 940 should be saved */
+SYNTHETIC_result_t step_record_940_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 940 should not be duplicated */
+SYNTHETIC_result_t step_record_940_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 941 exists */
+SYNTHETIC_result_t step_record_941_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 941 has value 6587 */
+SYNTHETIC_result_t step_record_941_has_value_6587(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 941 is updated */
+SYNTHETIC_result_t step_record_941_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 941 should be saved */
+SYNTHETIC_result_t step_record_941_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 941 should not be duplicated */
+SYNTHETIC_result_t step_record_941_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 942 exists */
+SYNTHETIC_result_t step_record_942_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 942 has value 6594 */
+SYNTHETIC_result_t step_record_942_has_value_6594(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 942 is updated */
+SYNTHETIC_result_t step_record_942_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 942 should be saved */
+SYNTHETIC_result_t step_record_942_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 942 should not be duplicated */
+SYNTHETIC_result_t step_record_942_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 943 exists */
+SYNTHETIC_result_t step_record_943_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 943 has value 6601 */
+SYNTHETIC_result_t step_record_943_has_value_6601(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 943 is updated */
+SYNTHETIC_result_t step_record_943_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 943 should be saved */
+SYNTHETIC_result_t step_record_943_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 943 should not be duplicated */
+SYNTHETIC_result_t step_record_943_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 944 exists */
+SYNTHETIC_result_t step_record_944_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 944 has value 6608 */
+SYNTHETIC_result_t step_record_944_has_value_6608(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 944 is updated */
+SYNTHETIC_result_t step_record_944_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 944 should be saved */
+SYNTHETIC_result_t step_record_944_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 944 should not be duplicated */
+SYNTHETIC_result_t step_record_944_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 945 exists */
+SYNTHETIC_result_t step_record_945_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 945 has value 6615 */
+SYNTHETIC_result_t step_record_945_has_value_6615(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 945 is updated */
+SYNTHETIC_result_t step_record_945_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 945 should be saved */
+SYNTHETIC_result_t step_record_945_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 945 should not be duplicated */
+SYNTHETIC_result_t step_record_945_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 946 exists */
+SYNTHETIC_result_t step_record_946_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 946 has value 6622 */
+SYNTHETIC_result_t step_record_946_has_value_6622(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 946 is updated */
+SYNTHETIC_result_t step_record_946_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 946 should be saved */
+SYNTHETIC_result_t step_record_946_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 946 should not be duplicated */
+SYNTHETIC_result_t step_record_946_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 947 exists */
+SYNTHETIC_result_t step_record_947_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 947 has value 6629 */
+SYNTHETIC_result_t step_record_947_has_value_6629(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 947 is updated */
+SYNTHETIC_result_t step_record_947_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 947 should be saved */
+SYNTHETIC_result_t step_record_947_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 947 should not be duplicated */
+SYNTHETIC_result_t step_record_947_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 948 exists */
+SYNTHETIC_result_t step_record_948_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 948 has value 6636 */
+SYNTHETIC_result_t step_record_948_has_value_6636(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 948 is updated */
+SYNTHETIC_result_t step_record_948_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 948 should be saved */
+SYNTHETIC_result_t step_record_948_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 948 should not be duplicated */
+SYNTHETIC_result_t step_record_948_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 949 exists */
+SYNTHETIC_result_t step_record_949_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 949 has value 6643 */
+SYNTHETIC_result_t step_record_949_has_value_6643(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 949 is updated */
+SYNTHETIC_result_t step_record_949_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 949 should be saved */
+SYNTHETIC_result_t step_record_949_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 949 should not be duplicated */
+SYNTHETIC_result_t step_record_949_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 950 exists */
+SYNTHETIC_result_t step_record_950_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 950 has value 6650 */
+SYNTHETIC_result_t step_record_950_has_value_6650(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 950 is updated */
+SYNTHETIC_result_t step_record_950_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 950 should be saved */
+SYNTHETIC_result_t step_record_950_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 950 should not be duplicated */
+SYNTHETIC_result_t step_record_950_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 951 exists */
+SYNTHETIC_result_t step_record_951_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 951 has value 6657 */
+SYNTHETIC_result_t step_record_951_has_value_6657(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 951 is updated */
+SYNTHETIC_result_t step_record_951_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 951 should be saved */
+SYNTHETIC_result_t step_record_951_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 951 should not be duplicated */
+SYNTHETIC_result_t step_record_951_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 952 exists */
+SYNTHETIC_result_t step_record_952_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 952 has value 6664 */
+SYNTHETIC_result_t step_record_952_has_value_6664(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 952 is updated */
+SYNTHETIC_result_t step_record_952_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 952 should be saved */
+SYNTHETIC_result_t step_record_952_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 952 should not be duplicated */
+SYNTHETIC_result_t step_record_952_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 953 exists */
+SYNTHETIC_result_t step_record_953_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 953 has value 6671 */
+SYNTHETIC_result_t step_record_953_has_value_6671(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 953 is updated */
+SYNTHETIC_result_t step_record_953_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 953 should be saved */
+SYNTHETIC_result_t step_record_953_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 953 should not be duplicated */
+SYNTHETIC_result_t step_record_953_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 954 exists */
+SYNTHETIC_result_t step_record_954_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 954 has value 6678 */
+SYNTHETIC_result_t step_record_954_has_value_6678(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 954 is updated */
+SYNTHETIC_result_t step_record_954_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 954 should be saved */
+SYNTHETIC_result_t step_record_954_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 954 should not be duplicated */
+SYNTHETIC_result_t step_record_954_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 955 exists */
+SYNTHETIC_result_t step_record_955_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 955 has value 6685 */
+SYNTHETIC_result_t step_record_955_has_value_6685(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 955 is updated */
+SYNTHETIC_result_t step_record_955_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 955 should be saved */
+SYNTHETIC_result_t step_record_955_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 955 should not be duplicated */
+SYNTHETIC_result_t step_record_955_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 956 exists */
+SYNTHETIC_result_t step_record_956_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 956 has value 6692 */
+SYNTHETIC_result_t step_record_956_has_value_6692(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 956 is updated */
+SYNTHETIC_result_t step_record_956_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 956 should be saved */
+SYNTHETIC_result_t step_record_956_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 956 should not be duplicated */
+SYNTHETIC_result_t step_record_956_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 957 exists */
+SYNTHETIC_result_t step_record_957_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 957 has value 6699 */
+SYNTHETIC_result_t step_record_957_has_value_6699(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 957 is updated */
+SYNTHETIC_result_t step_record_957_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 957 should be saved */
+SYNTHETIC_result_t step_record_957_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 957 should not be duplicated */
+SYNTHETIC_result_t step_record_957_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 958 exists */
+SYNTHETIC_result_t step_record_958_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 958 has value 6706 */
+SYNTHETIC_result_t step_record_958_has_value_6706(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 958 is updated */
+SYNTHETIC_result_t step_record_958_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 958 should be saved */
+SYNTHETIC_result_t step_record_958_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 958 should not be duplicated */
+SYNTHETIC_result_t step_record_958_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 959 exists */
+SYNTHETIC_result_t step_record_959_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 959 has value 6713 */
+SYNTHETIC_result_t step_record_959_has_value_6713(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 959 is updated */
+SYNTHETIC_result_t step_record_959_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 959 should be saved */
+SYNTHETIC_result_t step_record_959_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 959 should not be duplicated */
+SYNTHETIC_result_t step_record_959_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 960 exists */
+SYNTHETIC_result_t step_record_960_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 960 has value 6720 */
+SYNTHETIC_result_t step_record_960_has_value_6720(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 960 is updated */
+SYNTHETIC_result_t step_record_960_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 960 should be saved */
+SYNTHETIC_result_t step_record_960_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 960 should not be duplicated */
+SYNTHETIC_result_t step_record_960_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 961 exists */
+SYNTHETIC_result_t step_record_961_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 961 has value 6727 */
+SYNTHETIC_result_t step_record_961_has_value_6727(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 961 is updated */
+SYNTHETIC_result_t step_record_961_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 961 should be saved */
+SYNTHETIC_result_t step_record_961_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 961 should not be duplicated */
+SYNTHETIC_result_t step_record_961_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 962 exists */
+SYNTHETIC_result_t step_record_962_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 962 has value 6734 */
+SYNTHETIC_result_t step_record_962_has_value_6734(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 962 is updated */
+SYNTHETIC_result_t step_record_962_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 962 should be saved */
+SYNTHETIC_result_t step_record_962_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 962 should not be duplicated */
+SYNTHETIC_result_t step_record_962_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 963 exists */
+SYNTHETIC_result_t step_record_963_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 963 has value 6741 */
+SYNTHETIC_result_t step_record_963_has_value_6741(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 963 is updated */
+SYNTHETIC_result_t step_record_963_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 963 should be saved */
+SYNTHETIC_result_t step_record_963_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 963 should not be duplicated */
+SYNTHETIC_result_t step_record_963_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 964 exists */
+SYNTHETIC_result_t step_record_964_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 964 has value 6748 */
+SYNTHETIC_result_t step_record_964_has_value_6748(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 964 is updated */
+SYNTHETIC_result_t step_record_964_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 964 should be saved */
+SYNTHETIC_result_t step_record_964_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 964 should not be duplicated */
+SYNTHETIC_result_t step_record_964_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 965 exists */
+SYNTHETIC_result_t step_record_965_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 965 has value 6755 */
+SYNTHETIC_result_t step_record_965_has_value_6755(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 965 is updated */
+SYNTHETIC_result_t step_record_965_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 965 should be saved */
+SYNTHETIC_result_t step_record_965_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 965 should not be duplicated */
+SYNTHETIC_result_t step_record_965_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 966 exists */
+SYNTHETIC_result_t step_record_966_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 966 has value 6762 */
+SYNTHETIC_result_t step_record_966_has_value_6762(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 966 is updated */
+SYNTHETIC_result_t step_record_966_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 966 should be saved */
+SYNTHETIC_result_t step_record_966_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 966 should not be duplicated */
+SYNTHETIC_result_t step_record_966_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 967 exists */
+SYNTHETIC_result_t step_record_967_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 967 has value 6769 */
+SYNTHETIC_result_t step_record_967_has_value_6769(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 967 is updated */
+SYNTHETIC_result_t step_record_967_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 967 should be saved */
+SYNTHETIC_result_t step_record_967_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 967 should not be duplicated */
+SYNTHETIC_result_t step_record_967_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 968 exists */
+SYNTHETIC_result_t step_record_968_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 968 has value 6776 */
+SYNTHETIC_result_t step_record_968_has_value_6776(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 968 is updated */
+SYNTHETIC_result_t step_record_968_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 968 should be saved */
+SYNTHETIC_result_t step_record_968_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 968 should not be duplicated */
+SYNTHETIC_result_t step_record_968_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 969 exists */
+SYNTHETIC_result_t step_record_969_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 969 has value 6783 */
+SYNTHETIC_result_t step_record_969_has_value_6783(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 969 is updated */
+SYNTHETIC_result_t step_record_969_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 969 should be saved */
+SYNTHETIC_result_t step_record_969_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 969 should not be duplicated */
+SYNTHETIC_result_t step_record_969_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 970 exists */
+SYNTHETIC_result_t step_record_970_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 970 has value 6790 */
+SYNTHETIC_result_t step_record_970_has_value_6790(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 970 is updated */
+SYNTHETIC_result_t step_record_970_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 970 should be saved */
+SYNTHETIC_result_t step_record_970_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 970 should not be duplicated */
+SYNTHETIC_result_t step_record_970_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 971 exists */
+SYNTHETIC_result_t step_record_971_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 971 has value 6797 */
+SYNTHETIC_result_t step_record_971_has_value_6797(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 971 is updated */
+SYNTHETIC_result_t step_record_971_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 971 should be saved */
+SYNTHETIC_result_t step_record_971_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 971 should not be duplicated */
+SYNTHETIC_result_t step_record_971_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 972 exists */
+SYNTHETIC_result_t step_record_972_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 972 has value 6804 */
+SYNTHETIC_result_t step_record_972_has_value_6804(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 972 is updated */
+SYNTHETIC_result_t step_record_972_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 972 should be saved */
+SYNTHETIC_result_t step_record_972_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 972 should not be duplicated */
+SYNTHETIC_result_t step_record_972_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 973 exists */
+SYNTHETIC_result_t step_record_973_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 973 has value 6811 */
+SYNTHETIC_result_t step_record_973_has_value_6811(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 973 is updated */
+SYNTHETIC_result_t step_record_973_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 973 should be saved */
+SYNTHETIC_result_t step_record_973_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 973 should not be duplicated */
+SYNTHETIC_result_t step_record_973_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 974 exists */
+SYNTHETIC_result_t step_record_974_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 974 has value 6818 */
+SYNTHETIC_result_t step_record_974_has_value_6818(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 974 is updated */
+SYNTHETIC_result_t step_record_974_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 974 should be saved */
+SYNTHETIC_result_t step_record_974_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 974 should not be duplicated */
+SYNTHETIC_result_t step_record_974_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 975 exists */
+SYNTHETIC_result_t step_record_975_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 975 has value 6825 */
+SYNTHETIC_result_t step_record_975_has_value_6825(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 975 is updated */
+SYNTHETIC_result_t step_record_975_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 975 should be saved */
+SYNTHETIC_result_t step_record_975_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 975 should not be duplicated */
+SYNTHETIC_result_t step_record_975_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 976 exists */
+SYNTHETIC_result_t step_record_976_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 976 has value 6832 */
+SYNTHETIC_result_t step_record_976_has_value_6832(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 976 is updated */
+SYNTHETIC_result_t step_record_976_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 976 should be saved */
+SYNTHETIC_result_t step_record_976_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 976 should not be duplicated */
+SYNTHETIC_result_t step_record_976_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 977 exists */
+SYNTHETIC_result_t step_record_977_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 977 has value 6839 */
+SYNTHETIC_result_t step_record_977_has_value_6839(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 977 is updated */
+SYNTHETIC_result_t step_record_977_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 977 should be saved */
+SYNTHETIC_result_t step_record_977_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 977 should not be duplicated */
+SYNTHETIC_result_t step_record_977_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 978 exists */
+SYNTHETIC_result_t step_record_978_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 978 has value 6846 */
+SYNTHETIC_result_t step_record_978_has_value_6846(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 978 is updated */
+SYNTHETIC_result_t step_record_978_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 978 should be saved */
+SYNTHETIC_result_t step_record_978_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 978 should not be duplicated */
+SYNTHETIC_result_t step_record_978_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 979 exists */
+SYNTHETIC_result_t step_record_979_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 979 has value 6853 */
+SYNTHETIC_result_t step_record_979_has_value_6853(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 979 is updated */
+SYNTHETIC_result_t step_record_979_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 979 should be saved */
+SYNTHETIC_result_t step_record_979_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 979 should not be duplicated */
+SYNTHETIC_result_t step_record_979_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 980 exists */
+SYNTHETIC_result_t step_record_980_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 980 has value 6860 */
+SYNTHETIC_result_t step_record_980_has_value_6860(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 980 is updated */
+SYNTHETIC_result_t step_record_980_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 980 should be saved */
+SYNTHETIC_result_t step_record_980_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 980 should not be duplicated */
+SYNTHETIC_result_t step_record_980_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 981 exists */
+SYNTHETIC_result_t step_record_981_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 981 has value 6867 */
+SYNTHETIC_result_t step_record_981_has_value_6867(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 981 is updated */
+SYNTHETIC_result_t step_record_981_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 981 should be saved */
+SYNTHETIC_result_t step_record_981_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 981 should not be duplicated */
+SYNTHETIC_result_t step_record_981_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 982 exists */
+SYNTHETIC_result_t step_record_982_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 982 has value 6874 */
+SYNTHETIC_result_t step_record_982_has_value_6874(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 982 is updated */
+SYNTHETIC_result_t step_record_982_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 982 should be saved */
+SYNTHETIC_result_t step_record_982_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 982 should not be duplicated */
+SYNTHETIC_result_t step_record_982_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 983 exists */
+SYNTHETIC_result_t step_record_983_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 983 has value 6881 */
+SYNTHETIC_result_t step_record_983_has_value_6881(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 983 is updated */
+SYNTHETIC_result_t step_record_983_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 983 should be saved */
+SYNTHETIC_result_t step_record_983_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 983 should not be duplicated */
+SYNTHETIC_result_t step_record_983_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 984 exists */
+SYNTHETIC_result_t step_record_984_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 984 has value 6888 */
+SYNTHETIC_result_t step_record_984_has_value_6888(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 984 is updated */
+SYNTHETIC_result_t step_record_984_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 984 should be saved */
+SYNTHETIC_result_t step_record_984_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 984 should not be duplicated */
+SYNTHETIC_result_t step_record_984_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 985 exists */
+SYNTHETIC_result_t step_record_985_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 985 has value 6895 */
+SYNTHETIC_result_t step_record_985_has_value_6895(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 985 is updated */
+SYNTHETIC_result_t step_record_985_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 985 should be saved */
+SYNTHETIC_result_t step_record_985_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 985 should not be duplicated */
+SYNTHETIC_result_t step_record_985_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 986 exists */
+SYNTHETIC_result_t step_record_986_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 986 has value 6902 */
+SYNTHETIC_result_t step_record_986_has_value_6902(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 986 is updated */
+SYNTHETIC_result_t step_record_986_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 986 should be saved */
+SYNTHETIC_result_t step_record_986_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 986 should not be duplicated */
+SYNTHETIC_result_t step_record_986_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 987 exists */
+SYNTHETIC_result_t step_record_987_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 987 has value 6909 */
+SYNTHETIC_result_t step_record_987_has_value_6909(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 987 is updated */
+SYNTHETIC_result_t step_record_987_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 987 should be saved */
+SYNTHETIC_result_t step_record_987_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 987 should not be duplicated */
+SYNTHETIC_result_t step_record_987_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 988 exists */
+SYNTHETIC_result_t step_record_988_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 988 has value 6916 */
+SYNTHETIC_result_t step_record_988_has_value_6916(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 988 is updated */
+SYNTHETIC_result_t step_record_988_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 988 should be saved */
+SYNTHETIC_result_t step_record_988_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 988 should not be duplicated */
+SYNTHETIC_result_t step_record_988_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 989 exists */
+SYNTHETIC_result_t step_record_989_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 989 has value 6923 */
+SYNTHETIC_result_t step_record_989_has_value_6923(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 989 is updated */
+SYNTHETIC_result_t step_record_989_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 989 should be saved */
+SYNTHETIC_result_t step_record_989_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 989 should not be duplicated */
+SYNTHETIC_result_t step_record_989_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 990 exists */
+SYNTHETIC_result_t step_record_990_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 990 has value 6930 */
+SYNTHETIC_result_t step_record_990_has_value_6930(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 990 is updated */
+SYNTHETIC_result_t step_record_990_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 990 should be saved */
+SYNTHETIC_result_t step_record_990_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 990 should not be duplicated */
+SYNTHETIC_result_t step_record_990_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 991 exists */
+SYNTHETIC_result_t step_record_991_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 991 has value 6937 */
+SYNTHETIC_result_t step_record_991_has_value_6937(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 991 is updated */
+SYNTHETIC_result_t step_record_991_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 991 should be saved */
+SYNTHETIC_result_t step_record_991_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 991 should not be duplicated */
+SYNTHETIC_result_t step_record_991_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 992 exists */
+SYNTHETIC_result_t step_record_992_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 992 has value 6944 */
+SYNTHETIC_result_t step_record_992_has_value_6944(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 992 is updated */
+SYNTHETIC_result_t step_record_992_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 992 should be saved */
+SYNTHETIC_result_t step_record_992_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 992 should not be duplicated */
+SYNTHETIC_result_t step_record_992_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 993 exists */
+SYNTHETIC_result_t step_record_993_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 993 has value 6951 */
+SYNTHETIC_result_t step_record_993_has_value_6951(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 993 is updated */
+SYNTHETIC_result_t step_record_993_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 993 should be saved */
+SYNTHETIC_result_t step_record_993_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 993 should not be duplicated */
+SYNTHETIC_result_t step_record_993_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 994 exists */
+SYNTHETIC_result_t step_record_994_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 994 has value 6958 */
+SYNTHETIC_result_t step_record_994_has_value_6958(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 994 is updated */
+SYNTHETIC_result_t step_record_994_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 994 should be saved */
+SYNTHETIC_result_t step_record_994_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 994 should not be duplicated */
+SYNTHETIC_result_t step_record_994_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 995 exists */
+SYNTHETIC_result_t step_record_995_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 995 has value 6965 */
+SYNTHETIC_result_t step_record_995_has_value_6965(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 995 is updated */
+SYNTHETIC_result_t step_record_995_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 995 should be saved */
+SYNTHETIC_result_t step_record_995_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 995 should not be duplicated */
+SYNTHETIC_result_t step_record_995_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 996 exists */
+SYNTHETIC_result_t step_record_996_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 996 has value 6972 */
+SYNTHETIC_result_t step_record_996_has_value_6972(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 996 is updated */
+SYNTHETIC_result_t step_record_996_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 996 should be saved */
+SYNTHETIC_result_t step_record_996_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 996 should not be duplicated */
+SYNTHETIC_result_t step_record_996_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 997 exists */
+SYNTHETIC_result_t step_record_997_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 997 has value 6979 */
+SYNTHETIC_result_t step_record_997_has_value_6979(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 997 is updated */
+SYNTHETIC_result_t step_record_997_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 997 should be saved */
+SYNTHETIC_result_t step_record_997_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 997 should not be duplicated */
+SYNTHETIC_result_t step_record_997_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 998 exists */
+SYNTHETIC_result_t step_record_998_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 998 has value 6986 */
+SYNTHETIC_result_t step_record_998_has_value_6986(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 998 is updated */
+SYNTHETIC_result_t step_record_998_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 998 should be saved */
+SYNTHETIC_result_t step_record_998_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 998 should not be duplicated */
+SYNTHETIC_result_t step_record_998_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 999 exists */
+SYNTHETIC_result_t step_record_999_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 999 has value 6993 */
+SYNTHETIC_result_t step_record_999_has_value_6993(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 999 is updated */
+SYNTHETIC_result_t step_record_999_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 999 should be saved */
+SYNTHETIC_result_t step_record_999_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 999 should not be duplicated */
+SYNTHETIC_result_t step_record_999_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
@@ -0,0 +1,1297 @@
+/* AUTO-GENERATED by bddgen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_BDD_H
+#define SYNTHETIC_BDD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Test result status */
+typedef enum {
+    SYNTHETIC_PASS = 0,
+    SYNTHETIC_FAIL,
+    SYNTHETIC_SKIP,
+    SYNTHETIC_PENDING,
+    SYNTHETIC_ERROR
+} SYNTHETIC_result_t;
+
+/* Step execution context */
+typedef struct {
+    void *world;           /* User-defined world state */
+    const char *step_text; /* Current step text */
+    int step_line;         /* Line number in feature file */
+    const char *scenario;  /* Current scenario name */
+    const char *feature;   /* Current feature name */
+} SYNTHETIC_context_t;
+
+/* Test run statistics */
+typedef struct {
+    int total_scenarios;
+    int passed_scenarios;
+    int failed_scenarios;
+    int skipped_scenarios;
+    int total_steps;
+    int passed_steps;
+    int failed_steps;
+} SYNTHETIC_stats_t;
+
+/* Step function prototype */
+typedef SYNTHETIC_result_t (*SYNTHETIC_step_fn)(SYNTHETIC_context_t *ctx);
+
+/* Test runner */
+void SYNTHETIC_run_all(void *world, SYNTHETIC_stats_t *stats);
+void SYNTHETIC_run_scenario(void *world, int scenario_index, SYNTHETIC_stats_t *stats);
+void SYNTHETIC_print_stats(const SYNTHETIC_stats_t *stats);
+
+/* Step definitions (implement these in synthetic_steps.c) */
+SYNTHETIC_result_t step_record_0_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_has_value_0(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_0_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_has_value_7(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_1_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_has_value_14(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_2_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_has_value_21(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_3_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_has_value_28(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_4_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_has_value_35(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_5_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_has_value_42(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_6_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_has_value_49(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_7_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_has_value_56(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_8_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_has_value_63(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_9_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_has_value_70(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_10_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_has_value_77(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_11_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_has_value_84(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_12_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_has_value_91(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_13_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_has_value_98(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_14_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_has_value_105(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_15_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_has_value_112(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_16_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_has_value_119(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_17_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_has_value_126(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_18_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_has_value_133(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_19_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_has_value_140(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_20_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_has_value_147(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_21_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_has_value_154(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_22_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_has_value_161(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_23_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_has_value_168(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_24_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_has_value_175(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_25_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_has_value_182(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_26_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_has_value_189(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_27_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_has_value_196(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_28_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_has_value_203(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_29_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_has_value_210(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_30_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_has_value_217(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_31_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_has_value_224(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_32_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_has_value_231(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_33_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_has_value_238(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_34_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_has_value_245(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_35_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_has_value_252(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_36_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_has_value_259(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_37_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_has_value_266(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_38_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_has_value_273(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_39_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_has_value_280(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_40_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_has_value_287(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_41_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_has_value_294(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_42_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_has_value_301(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_43_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_has_value_308(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_44_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_has_value_315(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_45_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_has_value_322(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_46_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_has_value_329(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_47_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_has_value_336(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_48_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_has_value_343(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_49_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_has_value_350(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_50_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_has_value_357(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_51_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_has_value_364(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_52_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_has_value_371(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_53_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_has_value_378(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_54_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_has_value_385(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_55_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_has_value_392(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_56_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_has_value_399(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_57_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_has_value_406(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_58_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_has_value_413(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_59_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_has_value_420(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_60_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_has_value_427(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_61_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_has_value_434(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_62_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_has_value_441(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_63_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_has_value_448(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_64_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_has_value_455(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_65_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_has_value_462(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_66_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_has_value_469(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_67_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_has_value_476(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_68_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_has_value_483(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_69_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_has_value_490(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_70_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_has_value_497(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_71_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_has_value_504(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_72_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_has_value_511(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_73_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_has_value_518(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_74_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_has_value_525(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_75_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_has_value_532(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_76_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_has_value_539(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_77_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_has_value_546(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_78_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_has_value_553(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_79_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_has_value_560(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_80_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_has_value_567(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_81_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_has_value_574(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_82_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_has_value_581(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_83_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_has_value_588(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_84_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_has_value_595(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_85_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_has_value_602(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_86_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_has_value_609(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_87_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_has_value_616(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_88_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_has_value_623(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_89_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_has_value_630(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_90_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_has_value_637(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_91_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_has_value_644(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_92_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_has_value_651(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_93_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_has_value_658(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_94_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_has_value_665(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_95_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_has_value_672(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_96_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_has_value_679(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_97_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_has_value_686(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_98_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_has_value_693(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_99_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_has_value_700(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_100_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_has_value_707(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_101_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_has_value_714(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_102_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_has_value_721(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_103_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_has_value_728(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_104_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_has_value_735(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_105_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_has_value_742(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_106_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_has_value_749(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_107_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_has_value_756(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_108_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_has_value_763(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_109_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_has_value_770(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_110_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_has_value_777(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_111_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_has_value_784(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_112_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_has_value_791(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_113_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_has_value_798(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_114_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_has_value_805(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_115_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_has_value_812(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_116_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_has_value_819(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_117_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_has_value_826(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_118_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_has_value_833(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_119_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_has_value_840(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_120_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_has_value_847(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_121_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_has_value_854(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_122_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_has_value_861(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_123_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_has_value_868(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_124_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_has_value_875(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_125_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_has_value_882(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_126_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_has_value_889(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_127_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_has_value_896(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_128_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_has_value_903(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_129_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_has_value_910(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_130_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_has_value_917(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_131_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_has_value_924(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_132_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_has_value_931(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_133_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_has_value_938(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_134_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_has_value_945(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_135_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_has_value_952(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_136_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_has_value_959(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_137_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_has_value_966(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_138_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_has_value_973(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_139_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_has_value_980(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_140_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_has_value_987(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_141_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_has_value_994(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_142_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_has_value_1001(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_143_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_has_value_1008(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_144_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_has_value_1015(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_145_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_has_value_1022(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_146_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_has_value_1029(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_147_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_has_value_1036(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_148_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_has_value_1043(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_149_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_has_value_1050(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_150_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_has_value_1057(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_151_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_has_value_1064(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_152_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_has_value_1071(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_153_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_has_value_1078(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_154_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_has_value_1085(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_155_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_has_value_1092(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_156_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_has_value_1099(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_157_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_has_value_1106(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_158_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_has_value_1113(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_159_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_has_value_1120(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_160_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_has_value_1127(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_161_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_has_value_1134(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_162_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_has_value_1141(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_163_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_has_value_1148(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_164_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_has_value_1155(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_165_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_has_value_1162(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_166_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_has_value_1169(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_167_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_has_value_1176(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_168_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_has_value_1183(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_169_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_has_value_1190(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_170_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_has_value_1197(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_171_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_has_value_1204(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_172_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_has_value_1211(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_173_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_has_value_1218(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_174_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_has_value_1225(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_175_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_has_value_1232(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_176_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_has_value_1239(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_177_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_has_value_1246(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_178_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_has_value_1253(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_179_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_has_value_1260(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_180_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_has_value_1267(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_181_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_has_value_1274(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_182_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_has_value_1281(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_183_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_has_value_1288(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_184_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_has_value_1295(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_185_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_has_value_1302(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_186_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_has_value_1309(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_187_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_has_value_1316(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_188_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_has_value_1323(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_189_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_has_value_1330(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_190_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_has_value_1337(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_191_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_has_value_1344(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_192_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_has_value_1351(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_193_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_has_value_1358(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_194_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_has_value_1365(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_195_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_has_value_1372(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_196_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_has_value_1379(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_197_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_has_value_1386(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_198_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_has_value_1393(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_199_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_has_value_1400(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_200_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_has_value_1407(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_201_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_has_value_1414(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_202_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_has_value_1421(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_203_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_has_value_1428(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_204_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_has_value_1435(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_205_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_has_value_1442(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_206_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_has_value_1449(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_207_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_has_value_1456(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_208_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_has_value_1463(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_209_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_has_value_1470(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_210_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_has_value_1477(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_211_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_has_value_1484(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_212_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_has_value_1491(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_213_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_has_value_1498(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_214_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_has_value_1505(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_215_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_has_value_1512(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_216_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_has_value_1519(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_217_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_has_value_1526(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_218_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_has_value_1533(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_219_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_has_value_1540(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_220_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_has_value_1547(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_221_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_has_value_1554(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_222_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_has_value_1561(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_223_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_has_value_1568(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_224_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_has_value_1575(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_225_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_has_value_1582(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_226_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_has_value_1589(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_227_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_has_value_1596(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_228_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_has_value_1603(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_229_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_has_value_1610(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_230_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_has_value_1617(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_231_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_has_value_1624(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_232_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_has_value_1631(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_233_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_has_value_1638(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_234_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_has_value_1645(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_235_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_has_value_1652(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_236_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_has_value_1659(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_237_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_has_value_1666(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_238_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_has_value_1673(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_239_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_has_value_1680(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_240_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_has_value_1687(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_241_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_has_value_1694(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_242_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_has_value_1701(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_243_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_has_value_1708(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_244_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_has_value_1715(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_245_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_has_value_1722(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_246_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_has_value_1729(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_247_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_has_value_1736(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_248_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_exists(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_has_value_1743(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_is_updated(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_should_be_saved(SYNTHETIC_context_t *ctx);
+SYNTHETIC_result_t step_record_249_should_not_be_duplicated(SYNTHETIC_context_t *ctx);
+
+#endif /* SYNTHETIC_BDD_H */
@@ -0,0 +1,7508 @@
+/* Step definitions for BDD tests
+ * Generated skeleton by bddgen 1.0.0
+ * Implement each step function to make tests pass.
+ */
+
+#include "synthetic_bdd.h"
+#include <stdio.h>
+
+/* Given record 0 exists */
+SYNTHETIC_result_t step_record_0_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 0 has value 0 */
+SYNTHETIC_result_t step_record_0_has_value_0(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 0 is updated */
+SYNTHETIC_result_t step_record_0_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 0 should be saved */
+SYNTHETIC_result_t step_record_0_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 0 should not be duplicated */
+SYNTHETIC_result_t step_record_0_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 1 exists */
+SYNTHETIC_result_t step_record_1_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 1 has value 7 */
+SYNTHETIC_result_t step_record_1_has_value_7(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 1 is updated */
+SYNTHETIC_result_t step_record_1_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 1 should be saved */
+SYNTHETIC_result_t step_record_1_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 1 should not be duplicated */
+SYNTHETIC_result_t step_record_1_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 2 exists */
+SYNTHETIC_result_t step_record_2_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 2 has value 14 */
+SYNTHETIC_result_t step_record_2_has_value_14(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 2 is updated */
+SYNTHETIC_result_t step_record_2_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 2 should be saved */
+SYNTHETIC_result_t step_record_2_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 2 should not be duplicated */
+SYNTHETIC_result_t step_record_2_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 3 exists */
+SYNTHETIC_result_t step_record_3_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 3 has value 21 */
+SYNTHETIC_result_t step_record_3_has_value_21(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 3 is updated */
+SYNTHETIC_result_t step_record_3_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 3 should be saved */
+SYNTHETIC_result_t step_record_3_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 3 should not be duplicated */
+SYNTHETIC_result_t step_record_3_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 4 exists */
+SYNTHETIC_result_t step_record_4_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 4 has value 28 */
+SYNTHETIC_result_t step_record_4_has_value_28(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 4 is updated */
+SYNTHETIC_result_t step_record_4_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 4 should be saved */
+SYNTHETIC_result_t step_record_4_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 4 should not be duplicated */
+SYNTHETIC_result_t step_record_4_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 5 exists */
+SYNTHETIC_result_t step_record_5_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 5 has value 35 */
+SYNTHETIC_result_t step_record_5_has_value_35(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 5 is updated */
+SYNTHETIC_result_t step_record_5_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 5 should be saved */
+SYNTHETIC_result_t step_record_5_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 5 should not be duplicated */
+SYNTHETIC_result_t step_record_5_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 6 exists */
+SYNTHETIC_result_t step_record_6_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 6 has value 42 */
+SYNTHETIC_result_t step_record_6_has_value_42(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 6 is updated */
+SYNTHETIC_result_t step_record_6_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 6 should be saved */
+SYNTHETIC_result_t step_record_6_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 6 should not be duplicated */
+SYNTHETIC_result_t step_record_6_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 7 exists */
+SYNTHETIC_result_t step_record_7_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 7 has value 49 */
+SYNTHETIC_result_t step_record_7_has_value_49(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 7 is updated */
+SYNTHETIC_result_t step_record_7_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 7 should be saved */
+SYNTHETIC_result_t step_record_7_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 7 should not be duplicated */
+SYNTHETIC_result_t step_record_7_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 8 exists */
+SYNTHETIC_result_t step_record_8_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 8 has value 56 */
+SYNTHETIC_result_t step_record_8_has_value_56(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 8 is updated */
+SYNTHETIC_result_t step_record_8_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 8 should be saved */
+SYNTHETIC_result_t step_record_8_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 8 should not be duplicated */
+SYNTHETIC_result_t step_record_8_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 9 exists */
+SYNTHETIC_result_t step_record_9_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 9 has value 63 */
+SYNTHETIC_result_t step_record_9_has_value_63(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 9 is updated */
+SYNTHETIC_result_t step_record_9_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 9 should be saved */
+SYNTHETIC_result_t step_record_9_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 9 should not be duplicated */
+SYNTHETIC_result_t step_record_9_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 10 exists */
+SYNTHETIC_result_t step_record_10_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 10 has value 70 */
+SYNTHETIC_result_t step_record_10_has_value_70(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 10 is updated */
+SYNTHETIC_result_t step_record_10_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 10 should be saved */
+SYNTHETIC_result_t step_record_10_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 10 should not be duplicated */
+SYNTHETIC_result_t step_record_10_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 11 exists */
+SYNTHETIC_result_t step_record_11_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 11 has value 77 */
+SYNTHETIC_result_t step_record_11_has_value_77(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 11 is updated */
+SYNTHETIC_result_t step_record_11_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 11 should be saved */
+SYNTHETIC_result_t step_record_11_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 11 should not be duplicated */
+SYNTHETIC_result_t step_record_11_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 12 exists */
+SYNTHETIC_result_t step_record_12_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 12 has value 84 */
+SYNTHETIC_result_t step_record_12_has_value_84(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 12 is updated */
+SYNTHETIC_result_t step_record_12_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 12 should be saved */
+SYNTHETIC_result_t step_record_12_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 12 should not be duplicated */
+SYNTHETIC_result_t step_record_12_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 13 exists */
+SYNTHETIC_result_t step_record_13_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 13 has value 91 */
+SYNTHETIC_result_t step_record_13_has_value_91(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 13 is updated */
+SYNTHETIC_result_t step_record_13_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 13 should be saved */
+SYNTHETIC_result_t step_record_13_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 13 should not be duplicated */
+SYNTHETIC_result_t step_record_13_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 14 exists */
+SYNTHETIC_result_t step_record_14_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 14 has value 98 */
+SYNTHETIC_result_t step_record_14_has_value_98(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 14 is updated */
+SYNTHETIC_result_t step_record_14_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 14 should be saved */
+SYNTHETIC_result_t step_record_14_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 14 should not be duplicated */
+SYNTHETIC_result_t step_record_14_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 15 exists */
+SYNTHETIC_result_t step_record_15_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 15 has value 105 */
+SYNTHETIC_result_t step_record_15_has_value_105(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 15 is updated */
+SYNTHETIC_result_t step_record_15_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 15 should be saved */
+SYNTHETIC_result_t step_record_15_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 15 should not be duplicated */
+SYNTHETIC_result_t step_record_15_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 16 exists */
+SYNTHETIC_result_t step_record_16_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 16 has value 112 */
+SYNTHETIC_result_t step_record_16_has_value_112(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 16 is updated */
+SYNTHETIC_result_t step_record_16_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 16 should be saved */
+SYNTHETIC_result_t step_record_16_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 16 should not be duplicated */
+SYNTHETIC_result_t step_record_16_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 17 exists */
+SYNTHETIC_result_t step_record_17_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 17 has value 119 */
+SYNTHETIC_result_t step_record_17_has_value_119(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 17 is updated */
+SYNTHETIC_result_t step_record_17_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 17 should be saved */
+SYNTHETIC_result_t step_record_17_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 17 should not be duplicated */
+SYNTHETIC_result_t step_record_17_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 18 exists */
+SYNTHETIC_result_t step_record_18_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 18 has value 126 */
+SYNTHETIC_result_t step_record_18_has_value_126(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 18 is updated */
+SYNTHETIC_result_t step_record_18_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 18 should be saved */
+SYNTHETIC_result_t step_record_18_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 18 should not be duplicated */
+SYNTHETIC_result_t step_record_18_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 19 exists */
+SYNTHETIC_result_t step_record_19_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 19 has value 133 */
+SYNTHETIC_result_t step_record_19_has_value_133(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 19 is updated */
+SYNTHETIC_result_t step_record_19_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 19 should be saved */
+SYNTHETIC_result_t step_record_19_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 19 should not be duplicated */
+SYNTHETIC_result_t step_record_19_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 20 exists */
+SYNTHETIC_result_t step_record_20_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 20 has value 140 */
+SYNTHETIC_result_t step_record_20_has_value_140(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 20 is updated */
+SYNTHETIC_result_t step_record_20_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 20 should be saved */
+SYNTHETIC_result_t step_record_20_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 20 should not be duplicated */
+SYNTHETIC_result_t step_record_20_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 21 exists */
+SYNTHETIC_result_t step_record_21_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 21 has value 147 */
+SYNTHETIC_result_t step_record_21_has_value_147(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 21 is updated */
+SYNTHETIC_result_t step_record_21_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 21 should be saved */
+SYNTHETIC_result_t step_record_21_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 21 should not be duplicated */
+SYNTHETIC_result_t step_record_21_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 22 exists */
+SYNTHETIC_result_t step_record_22_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 22 has value 154 */
+SYNTHETIC_result_t step_record_22_has_value_154(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 22 is updated */
+SYNTHETIC_result_t step_record_22_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 22 should be saved */
+SYNTHETIC_result_t step_record_22_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 22 should not be duplicated */
+SYNTHETIC_result_t step_record_22_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 23 exists */
+SYNTHETIC_result_t step_record_23_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 23 has value 161 */
+SYNTHETIC_result_t step_record_23_has_value_161(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 23 is updated */
+SYNTHETIC_result_t step_record_23_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 23 should be saved */
+SYNTHETIC_result_t step_record_23_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 23 should not be duplicated */
+SYNTHETIC_result_t step_record_23_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 24 exists */
+SYNTHETIC_result_t step_record_24_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 24 has value 168 */
+SYNTHETIC_result_t step_record_24_has_value_168(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 24 is updated */
+SYNTHETIC_result_t step_record_24_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 24 should be saved */
+SYNTHETIC_result_t step_record_24_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 24 should not be duplicated */
+SYNTHETIC_result_t step_record_24_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 25 exists */
+SYNTHETIC_result_t step_record_25_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 25 has value 175 */
+SYNTHETIC_result_t step_record_25_has_value_175(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 25 is updated */
+SYNTHETIC_result_t step_record_25_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 25 should be saved */
+SYNTHETIC_result_t step_record_25_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 25 should not be duplicated */
+SYNTHETIC_result_t step_record_25_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 26 exists */
+SYNTHETIC_result_t step_record_26_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 26 has value 182 */
+SYNTHETIC_result_t step_record_26_has_value_182(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 26 is updated */
+SYNTHETIC_result_t step_record_26_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 26 should be saved */
+SYNTHETIC_result_t step_record_26_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 26 should not be duplicated */
+SYNTHETIC_result_t step_record_26_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 27 exists */
+SYNTHETIC_result_t step_record_27_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 27 has value 189 */
+SYNTHETIC_result_t step_record_27_has_value_189(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 27 is updated */
+SYNTHETIC_result_t step_record_27_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 27 should be saved */
+SYNTHETIC_result_t step_record_27_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 27 should not be duplicated */
+SYNTHETIC_result_t step_record_27_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 28 exists */
+SYNTHETIC_result_t step_record_28_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 28 has value 196 */
+SYNTHETIC_result_t step_record_28_has_value_196(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 28 is updated */
+SYNTHETIC_result_t step_record_28_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 28 should be saved */
+SYNTHETIC_result_t step_record_28_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 28 should not be duplicated */
+SYNTHETIC_result_t step_record_28_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 29 exists */
+SYNTHETIC_result_t step_record_29_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 29 has value 203 */
+SYNTHETIC_result_t step_record_29_has_value_203(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 29 is updated */
+SYNTHETIC_result_t step_record_29_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 29 should be saved */
+SYNTHETIC_result_t step_record_29_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 29 should not be duplicated */
+SYNTHETIC_result_t step_record_29_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 30 exists */
+SYNTHETIC_result_t step_record_30_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 30 has value 210 */
+SYNTHETIC_result_t step_record_30_has_value_210(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 30 is updated */
+SYNTHETIC_result_t step_record_30_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 30 should be saved */
+SYNTHETIC_result_t step_record_30_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 30 should not be duplicated */
+SYNTHETIC_result_t step_record_30_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 31 exists */
+SYNTHETIC_result_t step_record_31_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 31 has value 217 */
+SYNTHETIC_result_t step_record_31_has_value_217(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 31 is updated */
+SYNTHETIC_result_t step_record_31_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 31 should be saved */
+SYNTHETIC_result_t step_record_31_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 31 should not be duplicated */
+SYNTHETIC_result_t step_record_31_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 32 exists */
+SYNTHETIC_result_t step_record_32_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 32 has value 224 */
+SYNTHETIC_result_t step_record_32_has_value_224(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 32 is updated */
+SYNTHETIC_result_t step_record_32_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 32 should be saved */
+SYNTHETIC_result_t step_record_32_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 32 should not be duplicated */
+SYNTHETIC_result_t step_record_32_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 33 exists */
+SYNTHETIC_result_t step_record_33_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 33 has value 231 */
+SYNTHETIC_result_t step_record_33_has_value_231(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 33 is updated */
+SYNTHETIC_result_t step_record_33_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 33 should be saved */
+SYNTHETIC_result_t step_record_33_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 33 should not be duplicated */
+SYNTHETIC_result_t step_record_33_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 34 exists */
+SYNTHETIC_result_t step_record_34_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 34 has value 238 */
+SYNTHETIC_result_t step_record_34_has_value_238(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 34 is updated */
+SYNTHETIC_result_t step_record_34_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 34 should be saved */
+SYNTHETIC_result_t step_record_34_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 34 should not be duplicated */
+SYNTHETIC_result_t step_record_34_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 35 exists */
+SYNTHETIC_result_t step_record_35_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 35 has value 245 */
+SYNTHETIC_result_t step_record_35_has_value_245(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 35 is updated */
+SYNTHETIC_result_t step_record_35_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 35 should be saved */
+SYNTHETIC_result_t step_record_35_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 35 should not be duplicated */
+SYNTHETIC_result_t step_record_35_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 36 exists */
+SYNTHETIC_result_t step_record_36_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 36 has value 252 */
+SYNTHETIC_result_t step_record_36_has_value_252(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 36 is updated */
+SYNTHETIC_result_t step_record_36_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 36 should be saved */
+SYNTHETIC_result_t step_record_36_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 36 should not be duplicated */
+SYNTHETIC_result_t step_record_36_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 37 exists */
+SYNTHETIC_result_t step_record_37_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 37 has value 259 */
+SYNTHETIC_result_t step_record_37_has_value_259(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 37 is updated */
+SYNTHETIC_result_t step_record_37_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 37 should be saved */
+SYNTHETIC_result_t step_record_37_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 37 should not be duplicated */
+SYNTHETIC_result_t step_record_37_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 38 exists */
+SYNTHETIC_result_t step_record_38_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 38 has value 266 */
+SYNTHETIC_result_t step_record_38_has_value_266(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 38 is updated */
+SYNTHETIC_result_t step_record_38_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 38 should be saved */
+SYNTHETIC_result_t step_record_38_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 38 should not be duplicated */
+SYNTHETIC_result_t step_record_38_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 39 exists */
+SYNTHETIC_result_t step_record_39_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 39 has value 273 */
+SYNTHETIC_result_t step_record_39_has_value_273(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 39 is updated */
+SYNTHETIC_result_t step_record_39_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 39 should be saved */
+SYNTHETIC_result_t step_record_39_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 39 should not be duplicated */
+SYNTHETIC_result_t step_record_39_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 40 exists */
+SYNTHETIC_result_t step_record_40_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 40 has value 280 */
+SYNTHETIC_result_t step_record_40_has_value_280(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 40 is updated */
+SYNTHETIC_result_t step_record_40_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 40 should be saved */
+SYNTHETIC_result_t step_record_40_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 40 should not be duplicated */
+SYNTHETIC_result_t step_record_40_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 41 exists */
+SYNTHETIC_result_t step_record_41_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 41 has value 287 */
+SYNTHETIC_result_t step_record_41_has_value_287(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 41 is updated */
+SYNTHETIC_result_t step_record_41_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 41 should be saved */
+SYNTHETIC_result_t step_record_41_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 41 should not be duplicated */
+SYNTHETIC_result_t step_record_41_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 42 exists */
+SYNTHETIC_result_t step_record_42_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 42 has value 294 */
+SYNTHETIC_result_t step_record_42_has_value_294(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 42 is updated */
+SYNTHETIC_result_t step_record_42_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 42 should be saved */
+SYNTHETIC_result_t step_record_42_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 42 should not be duplicated */
+SYNTHETIC_result_t step_record_42_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 43 exists */
+SYNTHETIC_result_t step_record_43_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 43 has value 301 */
+SYNTHETIC_result_t step_record_43_has_value_301(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 43 is updated */
+SYNTHETIC_result_t step_record_43_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 43 should be saved */
+SYNTHETIC_result_t step_record_43_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 43 should not be duplicated */
+SYNTHETIC_result_t step_record_43_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 44 exists */
+SYNTHETIC_result_t step_record_44_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 44 has value 308 */
+SYNTHETIC_result_t step_record_44_has_value_308(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 44 is updated */
+SYNTHETIC_result_t step_record_44_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 44 should be saved */
+SYNTHETIC_result_t step_record_44_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 44 should not be duplicated */
+SYNTHETIC_result_t step_record_44_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 45 exists */
+SYNTHETIC_result_t step_record_45_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 45 has value 315 */
+SYNTHETIC_result_t step_record_45_has_value_315(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 45 is updated */
+SYNTHETIC_result_t step_record_45_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 45 should be saved */
+SYNTHETIC_result_t step_record_45_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 45 should not be duplicated */
+SYNTHETIC_result_t step_record_45_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 46 exists */
+SYNTHETIC_result_t step_record_46_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 46 has value 322 */
+SYNTHETIC_result_t step_record_46_has_value_322(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 46 is updated */
+SYNTHETIC_result_t step_record_46_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 46 should be saved */
+SYNTHETIC_result_t step_record_46_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 46 should not be duplicated */
+SYNTHETIC_result_t step_record_46_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 47 exists */
+SYNTHETIC_result_t step_record_47_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 47 has value 329 */
+SYNTHETIC_result_t step_record_47_has_value_329(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 47 is updated */
+SYNTHETIC_result_t step_record_47_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 47 should be saved */
+SYNTHETIC_result_t step_record_47_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 47 should not be duplicated */
+SYNTHETIC_result_t step_record_47_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 48 exists */
+SYNTHETIC_result_t step_record_48_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 48 has value 336 */
+SYNTHETIC_result_t step_record_48_has_value_336(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 48 is updated */
+SYNTHETIC_result_t step_record_48_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 48 should be saved */
+SYNTHETIC_result_t step_record_48_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 48 should not be duplicated */
+SYNTHETIC_result_t step_record_48_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 49 exists */
+SYNTHETIC_result_t step_record_49_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 49 has value 343 */
+SYNTHETIC_result_t step_record_49_has_value_343(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 49 is updated */
+SYNTHETIC_result_t step_record_49_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 49 should be saved */
+SYNTHETIC_result_t step_record_49_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 49 should not be duplicated */
+SYNTHETIC_result_t step_record_49_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 50 exists */
+SYNTHETIC_result_t step_record_50_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 50 has value 350 */
+SYNTHETIC_result_t step_record_50_has_value_350(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 50 is updated */
+SYNTHETIC_result_t step_record_50_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 50 should be saved */
+SYNTHETIC_result_t step_record_50_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 50 should not be duplicated */
+SYNTHETIC_result_t step_record_50_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 51 exists */
+SYNTHETIC_result_t step_record_51_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 51 has value 357 */
+SYNTHETIC_result_t step_record_51_has_value_357(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 51 is updated */
+SYNTHETIC_result_t step_record_51_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 51 should be saved */
+SYNTHETIC_result_t step_record_51_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 51 should not be duplicated */
+SYNTHETIC_result_t step_record_51_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 52 exists */
+SYNTHETIC_result_t step_record_52_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 52 has value 364 */
+SYNTHETIC_result_t step_record_52_has_value_364(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 52 is updated */
+SYNTHETIC_result_t step_record_52_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 52 should be saved */
+SYNTHETIC_result_t step_record_52_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 52 should not be duplicated */
+SYNTHETIC_result_t step_record_52_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 53 exists */
+SYNTHETIC_result_t step_record_53_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 53 has value 371 */
+SYNTHETIC_result_t step_record_53_has_value_371(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 53 is updated */
+SYNTHETIC_result_t step_record_53_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 53 should be saved */
+SYNTHETIC_result_t step_record_53_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 53 should not be duplicated */
+SYNTHETIC_result_t step_record_53_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 54 exists */
+SYNTHETIC_result_t step_record_54_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 54 has value 378 */
+SYNTHETIC_result_t step_record_54_has_value_378(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 54 is updated */
+SYNTHETIC_result_t step_record_54_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 54 should be saved */
+SYNTHETIC_result_t step_record_54_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 54 should not be duplicated */
+SYNTHETIC_result_t step_record_54_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 55 exists */
+SYNTHETIC_result_t step_record_55_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 55 has value 385 */
+SYNTHETIC_result_t step_record_55_has_value_385(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 55 is updated */
+SYNTHETIC_result_t step_record_55_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 55 should be saved */
+SYNTHETIC_result_t step_record_55_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 55 should not be duplicated */
+SYNTHETIC_result_t step_record_55_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 56 exists */
+SYNTHETIC_result_t step_record_56_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 56 has value 392 */
+SYNTHETIC_result_t step_record_56_has_value_392(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 56 is updated */
+SYNTHETIC_result_t step_record_56_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 56 should be saved */
+SYNTHETIC_result_t step_record_56_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 56 should not be duplicated */
+SYNTHETIC_result_t step_record_56_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 57 exists */
+SYNTHETIC_result_t step_record_57_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 57 has value 399 */
+SYNTHETIC_result_t step_record_57_has_value_399(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 57 is updated */
+SYNTHETIC_result_t step_record_57_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 57 should be saved */
+SYNTHETIC_result_t step_record_57_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 57 should not be duplicated */
+SYNTHETIC_result_t step_record_57_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 58 exists */
+SYNTHETIC_result_t step_record_58_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 58 has value 406 */
+SYNTHETIC_result_t step_record_58_has_value_406(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 58 is updated */
+SYNTHETIC_result_t step_record_58_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 58 should be saved */
+SYNTHETIC_result_t step_record_58_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 58 should not be duplicated */
+SYNTHETIC_result_t step_record_58_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 59 exists */
+SYNTHETIC_result_t step_record_59_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 59 has value 413 */
+SYNTHETIC_result_t step_record_59_has_value_413(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 59 is updated */
+SYNTHETIC_result_t step_record_59_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 59 should be saved */
+SYNTHETIC_result_t step_record_59_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 59 should not be duplicated */
+SYNTHETIC_result_t step_record_59_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 60 exists */
+SYNTHETIC_result_t step_record_60_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 60 has value 420 */
+SYNTHETIC_result_t step_record_60_has_value_420(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 60 is updated */
+SYNTHETIC_result_t step_record_60_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 60 should be saved */
+SYNTHETIC_result_t step_record_60_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 60 should not be duplicated */
+SYNTHETIC_result_t step_record_60_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 61 exists */
+SYNTHETIC_result_t step_record_61_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 61 has value 427 */
+SYNTHETIC_result_t step_record_61_has_value_427(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 61 is updated */
+SYNTHETIC_result_t step_record_61_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 61 should be saved */
+SYNTHETIC_result_t step_record_61_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 61 should not be duplicated */
+SYNTHETIC_result_t step_record_61_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 62 exists */
+SYNTHETIC_result_t step_record_62_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 62 has value 434 */
+SYNTHETIC_result_t step_record_62_has_value_434(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 62 is updated */
+SYNTHETIC_result_t step_record_62_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 62 should be saved */
+SYNTHETIC_result_t step_record_62_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 62 should not be duplicated */
+SYNTHETIC_result_t step_record_62_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 63 exists */
+SYNTHETIC_result_t step_record_63_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 63 has value 441 */
+SYNTHETIC_result_t step_record_63_has_value_441(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 63 is updated */
+SYNTHETIC_result_t step_record_63_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 63 should be saved */
+SYNTHETIC_result_t step_record_63_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 63 should not be duplicated */
+SYNTHETIC_result_t step_record_63_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 64 exists */
+SYNTHETIC_result_t step_record_64_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 64 has value 448 */
+SYNTHETIC_result_t step_record_64_has_value_448(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 64 is updated */
+SYNTHETIC_result_t step_record_64_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 64 should be saved */
+SYNTHETIC_result_t step_record_64_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 64 should not be duplicated */
+SYNTHETIC_result_t step_record_64_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 65 exists */
+SYNTHETIC_result_t step_record_65_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 65 has value 455 */
+SYNTHETIC_result_t step_record_65_has_value_455(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 65 is updated */
+SYNTHETIC_result_t step_record_65_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 65 should be saved */
+SYNTHETIC_result_t step_record_65_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 65 should not be duplicated */
+SYNTHETIC_result_t step_record_65_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 66 exists */
+SYNTHETIC_result_t step_record_66_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 66 has value 462 */
+SYNTHETIC_result_t step_record_66_has_value_462(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 66 is updated */
+SYNTHETIC_result_t step_record_66_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 66 should be saved */
+SYNTHETIC_result_t step_record_66_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 66 should not be duplicated */
+SYNTHETIC_result_t step_record_66_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 67 exists */
+SYNTHETIC_result_t step_record_67_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 67 has value 469 */
+SYNTHETIC_result_t step_record_67_has_value_469(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 67 is updated */
+SYNTHETIC_result_t step_record_67_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 67 should be saved */
+SYNTHETIC_result_t step_record_67_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 67 should not be duplicated */
+SYNTHETIC_result_t step_record_67_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 68 exists */
+SYNTHETIC_result_t step_record_68_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 68 has value 476 */
+SYNTHETIC_result_t step_record_68_has_value_476(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 68 is updated */
+SYNTHETIC_result_t step_record_68_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 68 should be saved */
+SYNTHETIC_result_t step_record_68_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 68 should not be duplicated */
+SYNTHETIC_result_t step_record_68_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 69 exists */
+SYNTHETIC_result_t step_record_69_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 69 has value 483 */
+SYNTHETIC_result_t step_record_69_has_value_483(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 69 is updated */
+SYNTHETIC_result_t step_record_69_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 69 should be saved */
+SYNTHETIC_result_t step_record_69_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 69 should not be duplicated */
+SYNTHETIC_result_t step_record_69_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 70 exists */
+SYNTHETIC_result_t step_record_70_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 70 has value 490 */
+SYNTHETIC_result_t step_record_70_has_value_490(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 70 is updated */
+SYNTHETIC_result_t step_record_70_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 70 should be saved */
+SYNTHETIC_result_t step_record_70_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 70 should not be duplicated */
+SYNTHETIC_result_t step_record_70_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 71 exists */
+SYNTHETIC_result_t step_record_71_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 71 has value 497 */
+SYNTHETIC_result_t step_record_71_has_value_497(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 71 is updated */
+SYNTHETIC_result_t step_record_71_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 71 should be saved */
+SYNTHETIC_result_t step_record_71_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 71 should not be duplicated */
+SYNTHETIC_result_t step_record_71_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 72 exists */
+SYNTHETIC_result_t step_record_72_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 72 has value 504 */
+SYNTHETIC_result_t step_record_72_has_value_504(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 72 is updated */
+SYNTHETIC_result_t step_record_72_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 72 should be saved */
+SYNTHETIC_result_t step_record_72_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 72 should not be duplicated */
+SYNTHETIC_result_t step_record_72_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 73 exists */
+SYNTHETIC_result_t step_record_73_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 73 has value 511 */
+SYNTHETIC_result_t step_record_73_has_value_511(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 73 is updated */
+SYNTHETIC_result_t step_record_73_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 73 should be saved */
+SYNTHETIC_result_t step_record_73_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 73 should not be duplicated */
+SYNTHETIC_result_t step_record_73_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 74 exists */
+SYNTHETIC_result_t step_record_74_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 74 has value 518 */
+SYNTHETIC_result_t step_record_74_has_value_518(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 74 is updated */
+SYNTHETIC_result_t step_record_74_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 74 should be saved */
+SYNTHETIC_result_t step_record_74_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 74 should not be duplicated */
+SYNTHETIC_result_t step_record_74_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 75 exists */
+SYNTHETIC_result_t step_record_75_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 75 has value 525 */
+SYNTHETIC_result_t step_record_75_has_value_525(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 75 is updated */
+SYNTHETIC_result_t step_record_75_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 75 should be saved */
+SYNTHETIC_result_t step_record_75_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 75 should not be duplicated */
+SYNTHETIC_result_t step_record_75_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 76 exists */
+SYNTHETIC_result_t step_record_76_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 76 has value 532 */
+SYNTHETIC_result_t step_record_76_has_value_532(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 76 is updated */
+SYNTHETIC_result_t step_record_76_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 76 should be saved */
+SYNTHETIC_result_t step_record_76_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 76 should not be duplicated */
+SYNTHETIC_result_t step_record_76_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 77 exists */
+SYNTHETIC_result_t step_record_77_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 77 has value 539 */
+SYNTHETIC_result_t step_record_77_has_value_539(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 77 is updated */
+SYNTHETIC_result_t step_record_77_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 77 should be saved */
+SYNTHETIC_result_t step_record_77_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 77 should not be duplicated */
+SYNTHETIC_result_t step_record_77_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 78 exists */
+SYNTHETIC_result_t step_record_78_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 78 has value 546 */
+SYNTHETIC_result_t step_record_78_has_value_546(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 78 is updated */
+SYNTHETIC_result_t step_record_78_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 78 should be saved */
+SYNTHETIC_result_t step_record_78_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 78 should not be duplicated */
+SYNTHETIC_result_t step_record_78_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 79 exists */
+SYNTHETIC_result_t step_record_79_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 79 has value 553 */
+SYNTHETIC_result_t step_record_79_has_value_553(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 79 is updated */
+SYNTHETIC_result_t step_record_79_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 79 should be saved */
+SYNTHETIC_result_t step_record_79_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 79 should not be duplicated */
+SYNTHETIC_result_t step_record_79_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 80 exists */
+SYNTHETIC_result_t step_record_80_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 80 has value 560 */
+SYNTHETIC_result_t step_record_80_has_value_560(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 80 is updated */
+SYNTHETIC_result_t step_record_80_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 80 should be saved */
+SYNTHETIC_result_t step_record_80_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 80 should not be duplicated */
+SYNTHETIC_result_t step_record_80_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 81 exists */
+SYNTHETIC_result_t step_record_81_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 81 has value 567 */
+SYNTHETIC_result_t step_record_81_has_value_567(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 81 is updated */
+SYNTHETIC_result_t step_record_81_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 81 should be saved */
+SYNTHETIC_result_t step_record_81_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 81 should not be duplicated */
+SYNTHETIC_result_t step_record_81_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 82 exists */
+SYNTHETIC_result_t step_record_82_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 82 has value 574 */
+SYNTHETIC_result_t step_record_82_has_value_574(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 82 is updated */
+SYNTHETIC_result_t step_record_82_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 82 should be saved */
+SYNTHETIC_result_t step_record_82_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 82 should not be duplicated */
+SYNTHETIC_result_t step_record_82_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 83 exists */
+SYNTHETIC_result_t step_record_83_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 83 has value 581 */
+SYNTHETIC_result_t step_record_83_has_value_581(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 83 is updated */
+SYNTHETIC_result_t step_record_83_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 83 should be saved */
+SYNTHETIC_result_t step_record_83_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 83 should not be duplicated */
+SYNTHETIC_result_t step_record_83_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 84 exists */
+SYNTHETIC_result_t step_record_84_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 84 has value 588 */
+SYNTHETIC_result_t step_record_84_has_value_588(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 84 is updated */
+SYNTHETIC_result_t step_record_84_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 84 should be saved */
+SYNTHETIC_result_t step_record_84_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 84 should not be duplicated */
+SYNTHETIC_result_t step_record_84_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 85 exists */
+SYNTHETIC_result_t step_record_85_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 85 has value 595 */
+SYNTHETIC_result_t step_record_85_has_value_595(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 85 is updated */
+SYNTHETIC_result_t step_record_85_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 85 should be saved */
+SYNTHETIC_result_t step_record_85_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 85 should not be duplicated */
+SYNTHETIC_result_t step_record_85_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 86 exists */
+SYNTHETIC_result_t step_record_86_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 86 has value 602 */
+SYNTHETIC_result_t step_record_86_has_value_602(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 86 is updated */
+SYNTHETIC_result_t step_record_86_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 86 should be saved */
+SYNTHETIC_result_t step_record_86_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 86 should not be duplicated */
+SYNTHETIC_result_t step_record_86_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 87 exists */
+SYNTHETIC_result_t step_record_87_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 87 has value 609 */
+SYNTHETIC_result_t step_record_87_has_value_609(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 87 is updated */
+SYNTHETIC_result_t step_record_87_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 87 should be saved */
+SYNTHETIC_result_t step_record_87_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 87 should not be duplicated */
+SYNTHETIC_result_t step_record_87_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 88 exists */
+SYNTHETIC_result_t step_record_88_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 88 has value 616 */
+SYNTHETIC_result_t step_record_88_has_value_616(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 88 is updated */
+SYNTHETIC_result_t step_record_88_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 88 should be saved */
+SYNTHETIC_result_t step_record_88_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 88 should not be duplicated */
+SYNTHETIC_result_t step_record_88_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 89 exists */
+SYNTHETIC_result_t step_record_89_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 89 has value 623 */
+SYNTHETIC_result_t step_record_89_has_value_623(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 89 is updated */
+SYNTHETIC_result_t step_record_89_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 89 should be saved */
+SYNTHETIC_result_t step_record_89_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 89 should not be duplicated */
+SYNTHETIC_result_t step_record_89_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 90 exists */
+SYNTHETIC_result_t step_record_90_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 90 has value 630 */
+SYNTHETIC_result_t step_record_90_has_value_630(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 90 is updated */
+SYNTHETIC_result_t step_record_90_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 90 should be saved */
+SYNTHETIC_result_t step_record_90_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 90 should not be duplicated */
+SYNTHETIC_result_t step_record_90_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 91 exists */
+SYNTHETIC_result_t step_record_91_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 91 has value 637 */
+SYNTHETIC_result_t step_record_91_has_value_637(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 91 is updated */
+SYNTHETIC_result_t step_record_91_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 91 should be saved */
+SYNTHETIC_result_t step_record_91_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 91 should not be duplicated */
+SYNTHETIC_result_t step_record_91_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 92 exists */
+SYNTHETIC_result_t step_record_92_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 92 has value 644 */
+SYNTHETIC_result_t step_record_92_has_value_644(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 92 is updated */
+SYNTHETIC_result_t step_record_92_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 92 should be saved */
+SYNTHETIC_result_t step_record_92_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 92 should not be duplicated */
+SYNTHETIC_result_t step_record_92_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 93 exists */
+SYNTHETIC_result_t step_record_93_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 93 has value 651 */
+SYNTHETIC_result_t step_record_93_has_value_651(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 93 is updated */
+SYNTHETIC_result_t step_record_93_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 93 should be saved */
+SYNTHETIC_result_t step_record_93_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 93 should not be duplicated */
+SYNTHETIC_result_t step_record_93_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 94 exists */
+SYNTHETIC_result_t step_record_94_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 94 has value 658 */
+SYNTHETIC_result_t step_record_94_has_value_658(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 94 is updated */
+SYNTHETIC_result_t step_record_94_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 94 should be saved */
+SYNTHETIC_result_t step_record_94_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 94 should not be duplicated */
+SYNTHETIC_result_t step_record_94_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 95 exists */
+SYNTHETIC_result_t step_record_95_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 95 has value 665 */
+SYNTHETIC_result_t step_record_95_has_value_665(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 95 is updated */
+SYNTHETIC_result_t step_record_95_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 95 should be saved */
+SYNTHETIC_result_t step_record_95_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 95 should not be duplicated */
+SYNTHETIC_result_t step_record_95_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 96 exists */
+SYNTHETIC_result_t step_record_96_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 96 has value 672 */
+SYNTHETIC_result_t step_record_96_has_value_672(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 96 is updated */
+SYNTHETIC_result_t step_record_96_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 96 should be saved */
+SYNTHETIC_result_t step_record_96_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 96 should not be duplicated */
+SYNTHETIC_result_t step_record_96_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 97 exists */
+SYNTHETIC_result_t step_record_97_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 97 has value 679 */
+SYNTHETIC_result_t step_record_97_has_value_679(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 97 is updated */
+SYNTHETIC_result_t step_record_97_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 97 should be saved */
+SYNTHETIC_result_t step_record_97_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 97 should not be duplicated */
+SYNTHETIC_result_t step_record_97_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 98 exists */
+SYNTHETIC_result_t step_record_98_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 98 has value 686 */
+SYNTHETIC_result_t step_record_98_has_value_686(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 98 is updated */
+SYNTHETIC_result_t step_record_98_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 98 should be saved */
+SYNTHETIC_result_t step_record_98_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 98 should not be duplicated */
+SYNTHETIC_result_t step_record_98_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 99 exists */
+SYNTHETIC_result_t step_record_99_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 99 has value 693 */
+SYNTHETIC_result_t step_record_99_has_value_693(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 99 is updated */
+SYNTHETIC_result_t step_record_99_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 99 should be saved */
+SYNTHETIC_result_t step_record_99_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 99 should not be duplicated */
+SYNTHETIC_result_t step_record_99_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 100 exists */
+SYNTHETIC_result_t step_record_100_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 100 has value 700 */
+SYNTHETIC_result_t step_record_100_has_value_700(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 100 is updated */
+SYNTHETIC_result_t step_record_100_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 100 should be saved */
+SYNTHETIC_result_t step_record_100_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 100 should not be duplicated */
+SYNTHETIC_result_t step_record_100_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 101 exists */
+SYNTHETIC_result_t step_record_101_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 101 has value 707 */
+SYNTHETIC_result_t step_record_101_has_value_707(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 101 is updated */
+SYNTHETIC_result_t step_record_101_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 101 should be saved */
+SYNTHETIC_result_t step_record_101_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 101 should not be duplicated */
+SYNTHETIC_result_t step_record_101_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 102 exists */
+SYNTHETIC_result_t step_record_102_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 102 has value 714 */
+SYNTHETIC_result_t step_record_102_has_value_714(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 102 is updated */
+SYNTHETIC_result_t step_record_102_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 102 should be saved */
+SYNTHETIC_result_t step_record_102_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 102 should not be duplicated */
+SYNTHETIC_result_t step_record_102_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 103 exists */
+SYNTHETIC_result_t step_record_103_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 103 has value 721 */
+SYNTHETIC_result_t step_record_103_has_value_721(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 103 is updated */
+SYNTHETIC_result_t step_record_103_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 103 should be saved */
+SYNTHETIC_result_t step_record_103_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 103 should not be duplicated */
+SYNTHETIC_result_t step_record_103_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 104 exists */
+SYNTHETIC_result_t step_record_104_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 104 has value 728 */
+SYNTHETIC_result_t step_record_104_has_value_728(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 104 is updated */
+SYNTHETIC_result_t step_record_104_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 104 should be saved */
+SYNTHETIC_result_t step_record_104_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 104 should not be duplicated */
+SYNTHETIC_result_t step_record_104_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 105 exists */
+SYNTHETIC_result_t step_record_105_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 105 has value 735 */
+SYNTHETIC_result_t step_record_105_has_value_735(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 105 is updated */
+SYNTHETIC_result_t step_record_105_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 105 should be saved */
+SYNTHETIC_result_t step_record_105_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 105 should not be duplicated */
+SYNTHETIC_result_t step_record_105_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 106 exists */
+SYNTHETIC_result_t step_record_106_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 106 has value 742 */
+SYNTHETIC_result_t step_record_106_has_value_742(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 106 is updated */
+SYNTHETIC_result_t step_record_106_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 106 should be saved */
+SYNTHETIC_result_t step_record_106_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 106 should not be duplicated */
+SYNTHETIC_result_t step_record_106_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 107 exists */
+SYNTHETIC_result_t step_record_107_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 107 has value 749 */
+SYNTHETIC_result_t step_record_107_has_value_749(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 107 is updated */
+SYNTHETIC_result_t step_record_107_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 107 should be saved */
+SYNTHETIC_result_t step_record_107_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 107 should not be duplicated */
+SYNTHETIC_result_t step_record_107_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 108 exists */
+SYNTHETIC_result_t step_record_108_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 108 has value 756 */
+SYNTHETIC_result_t step_record_108_has_value_756(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 108 is updated */
+SYNTHETIC_result_t step_record_108_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 108 should be saved */
+SYNTHETIC_result_t step_record_108_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 108 should not be duplicated */
+SYNTHETIC_result_t step_record_108_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 109 exists */
+SYNTHETIC_result_t step_record_109_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 109 has value 763 */
+SYNTHETIC_result_t step_record_109_has_value_763(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 109 is updated */
+SYNTHETIC_result_t step_record_109_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 109 should be saved */
+SYNTHETIC_result_t step_record_109_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 109 should not be duplicated */
+SYNTHETIC_result_t step_record_109_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 110 exists */
+SYNTHETIC_result_t step_record_110_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 110 has value 770 */
+SYNTHETIC_result_t step_record_110_has_value_770(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 110 is updated */
+SYNTHETIC_result_t step_record_110_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 110 should be saved */
+SYNTHETIC_result_t step_record_110_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 110 should not be duplicated */
+SYNTHETIC_result_t step_record_110_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 111 exists */
+SYNTHETIC_result_t step_record_111_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 111 has value 777 */
+SYNTHETIC_result_t step_record_111_has_value_777(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 111 is updated */
+SYNTHETIC_result_t step_record_111_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 111 should be saved */
+SYNTHETIC_result_t step_record_111_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 111 should not be duplicated */
+SYNTHETIC_result_t step_record_111_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 112 exists */
+SYNTHETIC_result_t step_record_112_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 112 has value 784 */
+SYNTHETIC_result_t step_record_112_has_value_784(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 112 is updated */
+SYNTHETIC_result_t step_record_112_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 112 should be saved */
+SYNTHETIC_result_t step_record_112_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 112 should not be duplicated */
+SYNTHETIC_result_t step_record_112_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 113 exists */
+SYNTHETIC_result_t step_record_113_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 113 has value 791 */
+SYNTHETIC_result_t step_record_113_has_value_791(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 113 is updated */
+SYNTHETIC_result_t step_record_113_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 113 should be saved */
+SYNTHETIC_result_t step_record_113_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 113 should not be duplicated */
+SYNTHETIC_result_t step_record_113_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 114 exists */
+SYNTHETIC_result_t step_record_114_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 114 has value 798 */
+SYNTHETIC_result_t step_record_114_has_value_798(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 114 is updated */
+SYNTHETIC_result_t step_record_114_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 114 should be saved */
+SYNTHETIC_result_t step_record_114_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 114 should not be duplicated */
+SYNTHETIC_result_t step_record_114_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 115 exists */
+SYNTHETIC_result_t step_record_115_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 115 has value 805 */
+SYNTHETIC_result_t step_record_115_has_value_805(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 115 is updated */
+SYNTHETIC_result_t step_record_115_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 115 should be saved */
+SYNTHETIC_result_t step_record_115_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 115 should not be duplicated */
+SYNTHETIC_result_t step_record_115_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 116 exists */
+SYNTHETIC_result_t step_record_116_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 116 has value 812 */
+SYNTHETIC_result_t step_record_116_has_value_812(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 116 is updated */
+SYNTHETIC_result_t step_record_116_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 116 should be saved */
+SYNTHETIC_result_t step_record_116_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 116 should not be duplicated */
+SYNTHETIC_result_t step_record_116_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 117 exists */
+SYNTHETIC_result_t step_record_117_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 117 has value 819 */
+SYNTHETIC_result_t step_record_117_has_value_819(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 117 is updated */
+SYNTHETIC_result_t step_record_117_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 117 should be saved */
+SYNTHETIC_result_t step_record_117_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 117 should not be duplicated */
+SYNTHETIC_result_t step_record_117_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 118 exists */
+SYNTHETIC_result_t step_record_118_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 118 has value 826 */
+SYNTHETIC_result_t step_record_118_has_value_826(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 118 is updated */
+SYNTHETIC_result_t step_record_118_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 118 should be saved */
+SYNTHETIC_result_t step_record_118_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 118 should not be duplicated */
+SYNTHETIC_result_t step_record_118_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 119 exists */
+SYNTHETIC_result_t step_record_119_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 119 has value 833 */
+SYNTHETIC_result_t step_record_119_has_value_833(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 119 is updated */
+SYNTHETIC_result_t step_record_119_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 119 should be saved */
+SYNTHETIC_result_t step_record_119_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 119 should not be duplicated */
+SYNTHETIC_result_t step_record_119_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 120 exists */
+SYNTHETIC_result_t step_record_120_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 120 has value 840 */
+SYNTHETIC_result_t step_record_120_has_value_840(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 120 is updated */
+SYNTHETIC_result_t step_record_120_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 120 should be saved */
+SYNTHETIC_result_t step_record_120_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 120 should not be duplicated */
+SYNTHETIC_result_t step_record_120_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 121 exists */
+SYNTHETIC_result_t step_record_121_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 121 has value 847 */
+SYNTHETIC_result_t step_record_121_has_value_847(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 121 is updated */
+SYNTHETIC_result_t step_record_121_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 121 should be saved */
+SYNTHETIC_result_t step_record_121_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 121 should not be duplicated */
+SYNTHETIC_result_t step_record_121_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 122 exists */
+SYNTHETIC_result_t step_record_122_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 122 has value 854 */
+SYNTHETIC_result_t step_record_122_has_value_854(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 122 is updated */
+SYNTHETIC_result_t step_record_122_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 122 should be saved */
+SYNTHETIC_result_t step_record_122_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 122 should not be duplicated */
+SYNTHETIC_result_t step_record_122_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 123 exists */
+SYNTHETIC_result_t step_record_123_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 123 has value 861 */
+SYNTHETIC_result_t step_record_123_has_value_861(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 123 is updated */
+SYNTHETIC_result_t step_record_123_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 123 should be saved */
+SYNTHETIC_result_t step_record_123_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 123 should not be duplicated */
+SYNTHETIC_result_t step_record_123_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 124 exists */
+SYNTHETIC_result_t step_record_124_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 124 has value 868 */
+SYNTHETIC_result_t step_record_124_has_value_868(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 124 is updated */
+SYNTHETIC_result_t step_record_124_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 124 should be saved */
+SYNTHETIC_result_t step_record_124_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 124 should not be duplicated */
+SYNTHETIC_result_t step_record_124_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 125 exists */
+SYNTHETIC_result_t step_record_125_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 125 has value 875 */
+SYNTHETIC_result_t step_record_125_has_value_875(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 125 is updated */
+SYNTHETIC_result_t step_record_125_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 125 should be saved */
+SYNTHETIC_result_t step_record_125_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 125 should not be duplicated */
+SYNTHETIC_result_t step_record_125_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 126 exists */
+SYNTHETIC_result_t step_record_126_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 126 has value 882 */
+SYNTHETIC_result_t step_record_126_has_value_882(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 126 is updated */
+SYNTHETIC_result_t step_record_126_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 126 should be saved */
+SYNTHETIC_result_t step_record_126_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 126 should not be duplicated */
+SYNTHETIC_result_t step_record_126_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 127 exists */
+SYNTHETIC_result_t step_record_127_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 127 has value 889 */
+SYNTHETIC_result_t step_record_127_has_value_889(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 127 is updated */
+SYNTHETIC_result_t step_record_127_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 127 should be saved */
+SYNTHETIC_result_t step_record_127_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 127 should not be duplicated */
+SYNTHETIC_result_t step_record_127_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 128 exists */
+SYNTHETIC_result_t step_record_128_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 128 has value 896 */
+SYNTHETIC_result_t step_record_128_has_value_896(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 128 is updated */
+SYNTHETIC_result_t step_record_128_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 128 should be saved */
+SYNTHETIC_result_t step_record_128_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 128 should not be duplicated */
+SYNTHETIC_result_t step_record_128_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 129 exists */
+SYNTHETIC_result_t step_record_129_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 129 has value 903 */
+SYNTHETIC_result_t step_record_129_has_value_903(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 129 is updated */
+SYNTHETIC_result_t step_record_129_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 129 should be saved */
+SYNTHETIC_result_t step_record_129_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 129 should not be duplicated */
+SYNTHETIC_result_t step_record_129_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 130 exists */
+SYNTHETIC_result_t step_record_130_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 130 has value 910 */
+SYNTHETIC_result_t step_record_130_has_value_910(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 130 is updated */
+SYNTHETIC_result_t step_record_130_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 130 should be saved */
+SYNTHETIC_result_t step_record_130_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 130 should not be duplicated */
+SYNTHETIC_result_t step_record_130_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 131 exists */
+SYNTHETIC_result_t step_record_131_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 131 has value 917 */
+SYNTHETIC_result_t step_record_131_has_value_917(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 131 is updated */
+SYNTHETIC_result_t step_record_131_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 131 should be saved */
+SYNTHETIC_result_t step_record_131_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 131 should not be duplicated */
+SYNTHETIC_result_t step_record_131_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 132 exists */
+SYNTHETIC_result_t step_record_132_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 132 has value 924 */
+SYNTHETIC_result_t step_record_132_has_value_924(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 132 is updated */
+SYNTHETIC_result_t step_record_132_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 132 should be saved */
+SYNTHETIC_result_t step_record_132_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 132 should not be duplicated */
+SYNTHETIC_result_t step_record_132_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 133 exists */
+SYNTHETIC_result_t step_record_133_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 133 has value 931 */
+SYNTHETIC_result_t step_record_133_has_value_931(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 133 is updated */
+SYNTHETIC_result_t step_record_133_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 133 should be saved */
+SYNTHETIC_result_t step_record_133_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 133 should not be duplicated */
+SYNTHETIC_result_t step_record_133_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 134 exists */
+SYNTHETIC_result_t step_record_134_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 134 has value 938 */
+SYNTHETIC_result_t step_record_134_has_value_938(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 134 is updated */
+SYNTHETIC_result_t step_record_134_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 134 should be saved */
+SYNTHETIC_result_t step_record_134_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 134 should not be duplicated */
+SYNTHETIC_result_t step_record_134_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 135 exists */
+SYNTHETIC_result_t step_record_135_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 135 has value 945 */
+SYNTHETIC_result_t step_record_135_has_value_945(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 135 is updated */
+SYNTHETIC_result_t step_record_135_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 135 should be saved */
+SYNTHETIC_result_t step_record_135_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 135 should not be duplicated */
+SYNTHETIC_result_t step_record_135_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 136 exists */
+SYNTHETIC_result_t step_record_136_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 136 has value 952 */
+SYNTHETIC_result_t step_record_136_has_value_952(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 136 is updated */
+SYNTHETIC_result_t step_record_136_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 136 should be saved */
+SYNTHETIC_result_t step_record_136_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 136 should not be duplicated */
+SYNTHETIC_result_t step_record_136_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 137 exists */
+SYNTHETIC_result_t step_record_137_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 137 has value 959 */
+SYNTHETIC_result_t step_record_137_has_value_959(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 137 is updated */
+SYNTHETIC_result_t step_record_137_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 137 should be saved */
+SYNTHETIC_result_t step_record_137_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 137 should not be duplicated */
+SYNTHETIC_result_t step_record_137_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 138 exists */
+SYNTHETIC_result_t step_record_138_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 138 has value 966 */
+SYNTHETIC_result_t step_record_138_has_value_966(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 138 is updated */
+SYNTHETIC_result_t step_record_138_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 138 should be saved */
+SYNTHETIC_result_t step_record_138_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 138 should not be duplicated */
+SYNTHETIC_result_t step_record_138_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 139 exists */
+SYNTHETIC_result_t step_record_139_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 139 has value 973 */
+SYNTHETIC_result_t step_record_139_has_value_973(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 139 is updated */
+SYNTHETIC_result_t step_record_139_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 139 should be saved */
+SYNTHETIC_result_t step_record_139_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 139 should not be duplicated */
+SYNTHETIC_result_t step_record_139_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 140 exists */
+SYNTHETIC_result_t step_record_140_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 140 has value 980 */
+SYNTHETIC_result_t step_record_140_has_value_980(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 140 is updated */
+SYNTHETIC_result_t step_record_140_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 140 should be saved */
+SYNTHETIC_result_t step_record_140_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 140 should not be duplicated */
+SYNTHETIC_result_t step_record_140_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 141 exists */
+SYNTHETIC_result_t step_record_141_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 141 has value 987 */
+SYNTHETIC_result_t step_record_141_has_value_987(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 141 is updated */
+SYNTHETIC_result_t step_record_141_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 141 should be saved */
+SYNTHETIC_result_t step_record_141_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 141 should not be duplicated */
+SYNTHETIC_result_t step_record_141_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 142 exists */
+SYNTHETIC_result_t step_record_142_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 142 has value 994 */
+SYNTHETIC_result_t step_record_142_has_value_994(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 142 is updated */
+SYNTHETIC_result_t step_record_142_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 142 should be saved */
+SYNTHETIC_result_t step_record_142_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 142 should not be duplicated */
+SYNTHETIC_result_t step_record_142_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 143 exists */
+SYNTHETIC_result_t step_record_143_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 143 has value 1001 */
+SYNTHETIC_result_t step_record_143_has_value_1001(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 143 is updated */
+SYNTHETIC_result_t step_record_143_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 143 should be saved */
+SYNTHETIC_result_t step_record_143_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 143 should not be duplicated */
+SYNTHETIC_result_t step_record_143_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 144 exists */
+SYNTHETIC_result_t step_record_144_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 144 has value 1008 */
+SYNTHETIC_result_t step_record_144_has_value_1008(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 144 is updated */
+SYNTHETIC_result_t step_record_144_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 144 should be saved */
+SYNTHETIC_result_t step_record_144_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 144 should not be duplicated */
+SYNTHETIC_result_t step_record_144_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 145 exists */
+SYNTHETIC_result_t step_record_145_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 145 has value 1015 */
+SYNTHETIC_result_t step_record_145_has_value_1015(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 145 is updated */
+SYNTHETIC_result_t step_record_145_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 145 should be saved */
+SYNTHETIC_result_t step_record_145_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 145 should not be duplicated */
+SYNTHETIC_result_t step_record_145_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 146 exists */
+SYNTHETIC_result_t step_record_146_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 146 has value 1022 */
+SYNTHETIC_result_t step_record_146_has_value_1022(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 146 is updated */
+SYNTHETIC_result_t step_record_146_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 146 should be saved */
+SYNTHETIC_result_t step_record_146_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 146 should not be duplicated */
+SYNTHETIC_result_t step_record_146_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 147 exists */
+SYNTHETIC_result_t step_record_147_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 147 has value 1029 */
+SYNTHETIC_result_t step_record_147_has_value_1029(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 147 is updated */
+SYNTHETIC_result_t step_record_147_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 147 should be saved */
+SYNTHETIC_result_t step_record_147_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 147 should not be duplicated */
+SYNTHETIC_result_t step_record_147_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 148 exists */
+SYNTHETIC_result_t step_record_148_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 148 has value 1036 */
+SYNTHETIC_result_t step_record_148_has_value_1036(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 148 is updated */
+SYNTHETIC_result_t step_record_148_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 148 should be saved */
+SYNTHETIC_result_t step_record_148_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 148 should not be duplicated */
+SYNTHETIC_result_t step_record_148_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 149 exists */
+SYNTHETIC_result_t step_record_149_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 149 has value 1043 */
+SYNTHETIC_result_t step_record_149_has_value_1043(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 149 is updated */
+SYNTHETIC_result_t step_record_149_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 149 should be saved */
+SYNTHETIC_result_t step_record_149_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 149 should not be duplicated */
+SYNTHETIC_result_t step_record_149_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 150 exists */
+SYNTHETIC_result_t step_record_150_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 150 has value 1050 */
+SYNTHETIC_result_t step_record_150_has_value_1050(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 150 is updated */
+SYNTHETIC_result_t step_record_150_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 150 should be saved */
+SYNTHETIC_result_t step_record_150_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 150 should not be duplicated */
+SYNTHETIC_result_t step_record_150_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 151 exists */
+SYNTHETIC_result_t step_record_151_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 151 has value 1057 */
+SYNTHETIC_result_t step_record_151_has_value_1057(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 151 is updated */
+SYNTHETIC_result_t step_record_151_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 151 should be saved */
+SYNTHETIC_result_t step_record_151_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 151 should not be duplicated */
+SYNTHETIC_result_t step_record_151_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 152 exists */
+SYNTHETIC_result_t step_record_152_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 152 has value 1064 */
+SYNTHETIC_result_t step_record_152_has_value_1064(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 152 is updated */
+SYNTHETIC_result_t step_record_152_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 152 should be saved */
+SYNTHETIC_result_t step_record_152_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 152 should not be duplicated */
+SYNTHETIC_result_t step_record_152_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 153 exists */
+SYNTHETIC_result_t step_record_153_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 153 has value 1071 */
+SYNTHETIC_result_t step_record_153_has_value_1071(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 153 is updated */
+SYNTHETIC_result_t step_record_153_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 153 should be saved */
+SYNTHETIC_result_t step_record_153_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 153 should not be duplicated */
+SYNTHETIC_result_t step_record_153_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 154 exists */
+SYNTHETIC_result_t step_record_154_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 154 has value 1078 */
+SYNTHETIC_result_t step_record_154_has_value_1078(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 154 is updated */
+SYNTHETIC_result_t step_record_154_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 154 should be saved */
+SYNTHETIC_result_t step_record_154_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 154 should not be duplicated */
+SYNTHETIC_result_t step_record_154_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 155 exists */
+SYNTHETIC_result_t step_record_155_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 155 has value 1085 */
+SYNTHETIC_result_t step_record_155_has_value_1085(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 155 is updated */
+SYNTHETIC_result_t step_record_155_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 155 should be saved */
+SYNTHETIC_result_t step_record_155_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 155 should not be duplicated */
+SYNTHETIC_result_t step_record_155_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 156 exists */
+SYNTHETIC_result_t step_record_156_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 156 has value 1092 */
+SYNTHETIC_result_t step_record_156_has_value_1092(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 156 is updated */
+SYNTHETIC_result_t step_record_156_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 156 should be saved */
+SYNTHETIC_result_t step_record_156_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 156 should not be duplicated */
+SYNTHETIC_result_t step_record_156_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 157 exists */
+SYNTHETIC_result_t step_record_157_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 157 has value 1099 */
+SYNTHETIC_result_t step_record_157_has_value_1099(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 157 is updated */
+SYNTHETIC_result_t step_record_157_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 157 should be saved */
+SYNTHETIC_result_t step_record_157_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 157 should not be duplicated */
+SYNTHETIC_result_t step_record_157_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 158 exists */
+SYNTHETIC_result_t step_record_158_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 158 has value 1106 */
+SYNTHETIC_result_t step_record_158_has_value_1106(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 158 is updated */
+SYNTHETIC_result_t step_record_158_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 158 should be saved */
+SYNTHETIC_result_t step_record_158_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 158 should not be duplicated */
+SYNTHETIC_result_t step_record_158_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 159 exists */
+SYNTHETIC_result_t step_record_159_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 159 has value 1113 */
+SYNTHETIC_result_t step_record_159_has_value_1113(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 159 is updated */
+SYNTHETIC_result_t step_record_159_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 159 should be saved */
+SYNTHETIC_result_t step_record_159_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 159 should not be duplicated */
+SYNTHETIC_result_t step_record_159_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 160 exists */
+SYNTHETIC_result_t step_record_160_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 160 has value 1120 */
+SYNTHETIC_result_t step_record_160_has_value_1120(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 160 is updated */
+SYNTHETIC_result_t step_record_160_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 160 should be saved */
+SYNTHETIC_result_t step_record_160_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 160 should not be duplicated */
+SYNTHETIC_result_t step_record_160_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 161 exists */
+SYNTHETIC_result_t step_record_161_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 161 has value 1127 */
+SYNTHETIC_result_t step_record_161_has_value_1127(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 161 is updated */
+SYNTHETIC_result_t step_record_161_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 161 should be saved */
+SYNTHETIC_result_t step_record_161_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 161 should not be duplicated */
+SYNTHETIC_result_t step_record_161_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 162 exists */
+SYNTHETIC_result_t step_record_162_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 162 has value 1134 */
+SYNTHETIC_result_t step_record_162_has_value_1134(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 162 is updated */
+SYNTHETIC_result_t step_record_162_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 162 should be saved */
+SYNTHETIC_result_t step_record_162_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 162 should not be duplicated */
+SYNTHETIC_result_t step_record_162_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 163 exists */
+SYNTHETIC_result_t step_record_163_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 163 has value 1141 */
+SYNTHETIC_result_t step_record_163_has_value_1141(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 163 is updated */
+SYNTHETIC_result_t step_record_163_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 163 should be saved */
+SYNTHETIC_result_t step_record_163_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 163 should not be duplicated */
+SYNTHETIC_result_t step_record_163_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 164 exists */
+SYNTHETIC_result_t step_record_164_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 164 has value 1148 */
+SYNTHETIC_result_t step_record_164_has_value_1148(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 164 is updated */
+SYNTHETIC_result_t step_record_164_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 164 should be saved */
+SYNTHETIC_result_t step_record_164_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 164 should not be duplicated */
+SYNTHETIC_result_t step_record_164_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 165 exists */
+SYNTHETIC_result_t step_record_165_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 165 has value 1155 */
+SYNTHETIC_result_t step_record_165_has_value_1155(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 165 is updated */
+SYNTHETIC_result_t step_record_165_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 165 should be saved */
+SYNTHETIC_result_t step_record_165_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 165 should not be duplicated */
+SYNTHETIC_result_t step_record_165_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 166 exists */
+SYNTHETIC_result_t step_record_166_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 166 has value 1162 */
+SYNTHETIC_result_t step_record_166_has_value_1162(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 166 is updated */
+SYNTHETIC_result_t step_record_166_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 166 should be saved */
+SYNTHETIC_result_t step_record_166_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 166 should not be duplicated */
+SYNTHETIC_result_t step_record_166_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 167 exists */
+SYNTHETIC_result_t step_record_167_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 167 has value 1169 */
+SYNTHETIC_result_t step_record_167_has_value_1169(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 167 is updated */
+SYNTHETIC_result_t step_record_167_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 167 should be saved */
+SYNTHETIC_result_t step_record_167_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 167 should not be duplicated */
+SYNTHETIC_result_t step_record_167_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 168 exists */
+SYNTHETIC_result_t step_record_168_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 168 has value 1176 */
+SYNTHETIC_result_t step_record_168_has_value_1176(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 168 is updated */
+SYNTHETIC_result_t step_record_168_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 168 should be saved */
+SYNTHETIC_result_t step_record_168_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 168 should not be duplicated */
+SYNTHETIC_result_t step_record_168_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 169 exists */
+SYNTHETIC_result_t step_record_169_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 169 has value 1183 */
+SYNTHETIC_result_t step_record_169_has_value_1183(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 169 is updated */
+SYNTHETIC_result_t step_record_169_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 169 should be saved */
+SYNTHETIC_result_t step_record_169_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 169 should not be duplicated */
+SYNTHETIC_result_t step_record_169_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 170 exists */
+SYNTHETIC_result_t step_record_170_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 170 has value 1190 */
+SYNTHETIC_result_t step_record_170_has_value_1190(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 170 is updated */
+SYNTHETIC_result_t step_record_170_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 170 should be saved */
+SYNTHETIC_result_t step_record_170_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 170 should not be duplicated */
+SYNTHETIC_result_t step_record_170_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 171 exists */
+SYNTHETIC_result_t step_record_171_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 171 has value 1197 */
+SYNTHETIC_result_t step_record_171_has_value_1197(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 171 is updated */
+SYNTHETIC_result_t step_record_171_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 171 should be saved */
+SYNTHETIC_result_t step_record_171_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 171 should not be duplicated */
+SYNTHETIC_result_t step_record_171_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 172 exists */
+SYNTHETIC_result_t step_record_172_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 172 has value 1204 */
+SYNTHETIC_result_t step_record_172_has_value_1204(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 172 is updated */
+SYNTHETIC_result_t step_record_172_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 172 should be saved */
+SYNTHETIC_result_t step_record_172_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 172 should not be duplicated */
+SYNTHETIC_result_t step_record_172_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 173 exists */
+SYNTHETIC_result_t step_record_173_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 173 has value 1211 */
+SYNTHETIC_result_t step_record_173_has_value_1211(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 173 is updated */
+SYNTHETIC_result_t step_record_173_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 173 should be saved */
+SYNTHETIC_result_t step_record_173_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 173 should not be duplicated */
+SYNTHETIC_result_t step_record_173_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 174 exists */
+SYNTHETIC_result_t step_record_174_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 174 has value 1218 */
+SYNTHETIC_result_t step_record_174_has_value_1218(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 174 is updated */
+SYNTHETIC_result_t step_record_174_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 174 should be saved */
+SYNTHETIC_result_t step_record_174_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 174 should not be duplicated */
+SYNTHETIC_result_t step_record_174_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 175 exists */
+SYNTHETIC_result_t step_record_175_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 175 has value 1225 */
+SYNTHETIC_result_t step_record_175_has_value_1225(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 175 is updated */
+SYNTHETIC_result_t step_record_175_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 175 should be saved */
+SYNTHETIC_result_t step_record_175_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 175 should not be duplicated */
+SYNTHETIC_result_t step_record_175_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 176 exists */
+SYNTHETIC_result_t step_record_176_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 176 has value 1232 */
+SYNTHETIC_result_t step_record_176_has_value_1232(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 176 is updated */
+SYNTHETIC_result_t step_record_176_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 176 should be saved */
+SYNTHETIC_result_t step_record_176_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 176 should not be duplicated */
+SYNTHETIC_result_t step_record_176_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 177 exists */
+SYNTHETIC_result_t step_record_177_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 177 has value 1239 */
+SYNTHETIC_result_t step_record_177_has_value_1239(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 177 is updated */
+SYNTHETIC_result_t step_record_177_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 177 should be saved */
+SYNTHETIC_result_t step_record_177_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 177 should not be duplicated */
+SYNTHETIC_result_t step_record_177_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 178 exists */
+SYNTHETIC_result_t step_record_178_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 178 has value 1246 */
+SYNTHETIC_result_t step_record_178_has_value_1246(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 178 is updated */
+SYNTHETIC_result_t step_record_178_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 178 should be saved */
+SYNTHETIC_result_t step_record_178_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 178 should not be duplicated */
+SYNTHETIC_result_t step_record_178_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 179 exists */
+SYNTHETIC_result_t step_record_179_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 179 has value 1253 */
+SYNTHETIC_result_t step_record_179_has_value_1253(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 179 is updated */
+SYNTHETIC_result_t step_record_179_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 179 should be saved */
+SYNTHETIC_result_t step_record_179_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 179 should not be duplicated */
+SYNTHETIC_result_t step_record_179_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 180 exists */
+SYNTHETIC_result_t step_record_180_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 180 has value 1260 */
+SYNTHETIC_result_t step_record_180_has_value_1260(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 180 is updated */
+SYNTHETIC_result_t step_record_180_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 180 should be saved */
+SYNTHETIC_result_t step_record_180_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 180 should not be duplicated */
+SYNTHETIC_result_t step_record_180_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 181 exists */
+SYNTHETIC_result_t step_record_181_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 181 has value 1267 */
+SYNTHETIC_result_t step_record_181_has_value_1267(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 181 is updated */
+SYNTHETIC_result_t step_record_181_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 181 should be saved */
+SYNTHETIC_result_t step_record_181_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 181 should not be duplicated */
+SYNTHETIC_result_t step_record_181_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 182 exists */
+SYNTHETIC_result_t step_record_182_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 182 has value 1274 */
+SYNTHETIC_result_t step_record_182_has_value_1274(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 182 is updated */
+SYNTHETIC_result_t step_record_182_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 182 should be saved */
+SYNTHETIC_result_t step_record_182_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 182 should not be duplicated */
+SYNTHETIC_result_t step_record_182_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 183 exists */
+SYNTHETIC_result_t step_record_183_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 183 has value 1281 */
+SYNTHETIC_result_t step_record_183_has_value_1281(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 183 is updated */
+SYNTHETIC_result_t step_record_183_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 183 should be saved */
+SYNTHETIC_result_t step_record_183_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 183 should not be duplicated */
+SYNTHETIC_result_t step_record_183_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 184 exists */
+SYNTHETIC_result_t step_record_184_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 184 has value 1288 */
+SYNTHETIC_result_t step_record_184_has_value_1288(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 184 is updated */
+SYNTHETIC_result_t step_record_184_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 184 should be saved */
+SYNTHETIC_result_t step_record_184_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 184 should not be duplicated */
+SYNTHETIC_result_t step_record_184_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 185 exists */
+SYNTHETIC_result_t step_record_185_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 185 has value 1295 */
+SYNTHETIC_result_t step_record_185_has_value_1295(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 185 is updated */
+SYNTHETIC_result_t step_record_185_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 185 should be saved */
+SYNTHETIC_result_t step_record_185_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 185 should not be duplicated */
+SYNTHETIC_result_t step_record_185_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 186 exists */
+SYNTHETIC_result_t step_record_186_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 186 has value 1302 */
+SYNTHETIC_result_t step_record_186_has_value_1302(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 186 is updated */
+SYNTHETIC_result_t step_record_186_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 186 should be saved */
+SYNTHETIC_result_t step_record_186_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 186 should not be duplicated */
+SYNTHETIC_result_t step_record_186_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 187 exists */
+SYNTHETIC_result_t step_record_187_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 187 has value 1309 */
+SYNTHETIC_result_t step_record_187_has_value_1309(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 187 is updated */
+SYNTHETIC_result_t step_record_187_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 187 should be saved */
+SYNTHETIC_result_t step_record_187_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 187 should not be duplicated */
+SYNTHETIC_result_t step_record_187_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 188 exists */
+SYNTHETIC_result_t step_record_188_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 188 has value 1316 */
+SYNTHETIC_result_t step_record_188_has_value_1316(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 188 is updated */
+SYNTHETIC_result_t step_record_188_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 188 should be saved */
+SYNTHETIC_result_t step_record_188_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 188 should not be duplicated */
+SYNTHETIC_result_t step_record_188_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 189 exists */
+SYNTHETIC_result_t step_record_189_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 189 has value 1323 */
+SYNTHETIC_result_t step_record_189_has_value_1323(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 189 is updated */
+SYNTHETIC_result_t step_record_189_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 189 should be saved */
+SYNTHETIC_result_t step_record_189_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 189 should not be duplicated */
+SYNTHETIC_result_t step_record_189_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 190 exists */
+SYNTHETIC_result_t step_record_190_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 190 has value 1330 */
+SYNTHETIC_result_t step_record_190_has_value_1330(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 190 is updated */
+SYNTHETIC_result_t step_record_190_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 190 should be saved */
+SYNTHETIC_result_t step_record_190_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 190 should not be duplicated */
+SYNTHETIC_result_t step_record_190_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 191 exists */
+SYNTHETIC_result_t step_record_191_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 191 has value 1337 */
+SYNTHETIC_result_t step_record_191_has_value_1337(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 191 is updated */
+SYNTHETIC_result_t step_record_191_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 191 should be saved */
+SYNTHETIC_result_t step_record_191_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 191 should not be duplicated */
+SYNTHETIC_result_t step_record_191_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 192 exists */
+SYNTHETIC_result_t step_record_192_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 192 has value 1344 */
+SYNTHETIC_result_t step_record_192_has_value_1344(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 192 is updated */
+SYNTHETIC_result_t step_record_192_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 192 should be saved */
+SYNTHETIC_result_t step_record_192_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 192 should not be duplicated */
+SYNTHETIC_result_t step_record_192_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 193 exists */
+SYNTHETIC_result_t step_record_193_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 193 has value 1351 */
+SYNTHETIC_result_t step_record_193_has_value_1351(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 193 is updated */
+SYNTHETIC_result_t step_record_193_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 193 should be saved */
+SYNTHETIC_result_t step_record_193_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 193 should not be duplicated */
+SYNTHETIC_result_t step_record_193_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 194 exists */
+SYNTHETIC_result_t step_record_194_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 194 has value 1358 */
+SYNTHETIC_result_t step_record_194_has_value_1358(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 194 is updated */
+SYNTHETIC_result_t step_record_194_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 194 should be saved */
+SYNTHETIC_result_t step_record_194_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 194 should not be duplicated */
+SYNTHETIC_result_t step_record_194_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 195 exists */
+SYNTHETIC_result_t step_record_195_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 195 has value 1365 */
+SYNTHETIC_result_t step_record_195_has_value_1365(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 195 is updated */
+SYNTHETIC_result_t step_record_195_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 195 should be saved */
+SYNTHETIC_result_t step_record_195_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 195 should not be duplicated */
+SYNTHETIC_result_t step_record_195_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 196 exists */
+SYNTHETIC_result_t step_record_196_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 196 has value 1372 */
+SYNTHETIC_result_t step_record_196_has_value_1372(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 196 is updated */
+SYNTHETIC_result_t step_record_196_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 196 should be saved */
+SYNTHETIC_result_t step_record_196_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 196 should not be duplicated */
+SYNTHETIC_result_t step_record_196_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 197 exists */
+SYNTHETIC_result_t step_record_197_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 197 has value 1379 */
+SYNTHETIC_result_t step_record_197_has_value_1379(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 197 is updated */
+SYNTHETIC_result_t step_record_197_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 197 should be saved */
+SYNTHETIC_result_t step_record_197_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 197 should not be duplicated */
+SYNTHETIC_result_t step_record_197_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 198 exists */
+SYNTHETIC_result_t step_record_198_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 198 has value 1386 */
+SYNTHETIC_result_t step_record_198_has_value_1386(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 198 is updated */
+SYNTHETIC_result_t step_record_198_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 198 should be saved */
+SYNTHETIC_result_t step_record_198_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 198 should not be duplicated */
+SYNTHETIC_result_t step_record_198_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 199 exists */
+SYNTHETIC_result_t step_record_199_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 199 has value 1393 */
+SYNTHETIC_result_t step_record_199_has_value_1393(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 199 is updated */
+SYNTHETIC_result_t step_record_199_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 199 should be saved */
+SYNTHETIC_result_t step_record_199_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 199 should not be duplicated */
+SYNTHETIC_result_t step_record_199_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 200 exists */
+SYNTHETIC_result_t step_record_200_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 200 has value 1400 */
+SYNTHETIC_result_t step_record_200_has_value_1400(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 200 is updated */
+SYNTHETIC_result_t step_record_200_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 200 should be saved */
+SYNTHETIC_result_t step_record_200_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 200 should not be duplicated */
+SYNTHETIC_result_t step_record_200_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 201 exists */
+SYNTHETIC_result_t step_record_201_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 201 has value 1407 */
+SYNTHETIC_result_t step_record_201_has_value_1407(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 201 is updated */
+SYNTHETIC_result_t step_record_201_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 201 should be saved */
+SYNTHETIC_result_t step_record_201_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 201 should not be duplicated */
+SYNTHETIC_result_t step_record_201_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 202 exists */
+SYNTHETIC_result_t step_record_202_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 202 has value 1414 */
+SYNTHETIC_result_t step_record_202_has_value_1414(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 202 is updated */
+SYNTHETIC_result_t step_record_202_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 202 should be saved */
+SYNTHETIC_result_t step_record_202_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 202 should not be duplicated */
+SYNTHETIC_result_t step_record_202_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 203 exists */
+SYNTHETIC_result_t step_record_203_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 203 has value 1421 */
+SYNTHETIC_result_t step_record_203_has_value_1421(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 203 is updated */
+SYNTHETIC_result_t step_record_203_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 203 should be saved */
+SYNTHETIC_result_t step_record_203_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 203 should not be duplicated */
+SYNTHETIC_result_t step_record_203_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 204 exists */
+SYNTHETIC_result_t step_record_204_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 204 has value 1428 */
+SYNTHETIC_result_t step_record_204_has_value_1428(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 204 is updated */
+SYNTHETIC_result_t step_record_204_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 204 should be saved */
+SYNTHETIC_result_t step_record_204_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 204 should not be duplicated */
+SYNTHETIC_result_t step_record_204_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 205 exists */
+SYNTHETIC_result_t step_record_205_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 205 has value 1435 */
+SYNTHETIC_result_t step_record_205_has_value_1435(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 205 is updated */
+SYNTHETIC_result_t step_record_205_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 205 should be saved */
+SYNTHETIC_result_t step_record_205_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 205 should not be duplicated */
+SYNTHETIC_result_t step_record_205_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 206 exists */
+SYNTHETIC_result_t step_record_206_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 206 has value 1442 */
+SYNTHETIC_result_t step_record_206_has_value_1442(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 206 is updated */
+SYNTHETIC_result_t step_record_206_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 206 should be saved */
+SYNTHETIC_result_t step_record_206_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 206 should not be duplicated */
+SYNTHETIC_result_t step_record_206_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 207 exists */
+SYNTHETIC_result_t step_record_207_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 207 has value 1449 */
+SYNTHETIC_result_t step_record_207_has_value_1449(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 207 is updated */
+SYNTHETIC_result_t step_record_207_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 207 should be saved */
+SYNTHETIC_result_t step_record_207_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 207 should not be duplicated */
+SYNTHETIC_result_t step_record_207_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 208 exists */
+SYNTHETIC_result_t step_record_208_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 208 has value 1456 */
+SYNTHETIC_result_t step_record_208_has_value_1456(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 208 is updated */
+SYNTHETIC_result_t step_record_208_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 208 should be saved */
+SYNTHETIC_result_t step_record_208_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 208 should not be duplicated */
+SYNTHETIC_result_t step_record_208_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 209 exists */
+SYNTHETIC_result_t step_record_209_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 209 has value 1463 */
+SYNTHETIC_result_t step_record_209_has_value_1463(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 209 is updated */
+SYNTHETIC_result_t step_record_209_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 209 should be saved */
+SYNTHETIC_result_t step_record_209_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 209 should not be duplicated */
+SYNTHETIC_result_t step_record_209_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 210 exists */
+SYNTHETIC_result_t step_record_210_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 210 has value 1470 */
+SYNTHETIC_result_t step_record_210_has_value_1470(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 210 is updated */
+SYNTHETIC_result_t step_record_210_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 210 should be saved */
+SYNTHETIC_result_t step_record_210_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 210 should not be duplicated */
+SYNTHETIC_result_t step_record_210_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 211 exists */
+SYNTHETIC_result_t step_record_211_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 211 has value 1477 */
+SYNTHETIC_result_t step_record_211_has_value_1477(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 211 is updated */
+SYNTHETIC_result_t step_record_211_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 211 should be saved */
+SYNTHETIC_result_t step_record_211_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 211 should not be duplicated */
+SYNTHETIC_result_t step_record_211_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 212 exists */
+SYNTHETIC_result_t step_record_212_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 212 has value 1484 */
+SYNTHETIC_result_t step_record_212_has_value_1484(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 212 is updated */
+SYNTHETIC_result_t step_record_212_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 212 should be saved */
+SYNTHETIC_result_t step_record_212_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 212 should not be duplicated */
+SYNTHETIC_result_t step_record_212_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 213 exists */
+SYNTHETIC_result_t step_record_213_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 213 has value 1491 */
+SYNTHETIC_result_t step_record_213_has_value_1491(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 213 is updated */
+SYNTHETIC_result_t step_record_213_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 213 should be saved */
+SYNTHETIC_result_t step_record_213_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 213 should not be duplicated */
+SYNTHETIC_result_t step_record_213_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 214 exists */
+SYNTHETIC_result_t step_record_214_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 214 has value 1498 */
+SYNTHETIC_result_t step_record_214_has_value_1498(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 214 is updated */
+SYNTHETIC_result_t step_record_214_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 214 should be saved */
+SYNTHETIC_result_t step_record_214_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 214 should not be duplicated */
+SYNTHETIC_result_t step_record_214_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 215 exists */
+SYNTHETIC_result_t step_record_215_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 215 has value 1505 */
+SYNTHETIC_result_t step_record_215_has_value_1505(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 215 is updated */
+SYNTHETIC_result_t step_record_215_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 215 should be saved */
+SYNTHETIC_result_t step_record_215_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 215 should not be duplicated */
+SYNTHETIC_result_t step_record_215_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 216 exists */
+SYNTHETIC_result_t step_record_216_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 216 has value 1512 */
+SYNTHETIC_result_t step_record_216_has_value_1512(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 216 is updated */
+SYNTHETIC_result_t step_record_216_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 216 should be saved */
+SYNTHETIC_result_t step_record_216_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 216 should not be duplicated */
+SYNTHETIC_result_t step_record_216_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 217 exists */
+SYNTHETIC_result_t step_record_217_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 217 has value 1519 */
+SYNTHETIC_result_t step_record_217_has_value_1519(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 217 is updated */
+SYNTHETIC_result_t step_record_217_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 217 should be saved */
+SYNTHETIC_result_t step_record_217_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 217 should not be duplicated */
+SYNTHETIC_result_t step_record_217_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 218 exists */
+SYNTHETIC_result_t step_record_218_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 218 has value 1526 */
+SYNTHETIC_result_t step_record_218_has_value_1526(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 218 is updated */
+SYNTHETIC_result_t step_record_218_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 218 should be saved */
+SYNTHETIC_result_t step_record_218_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 218 should not be duplicated */
+SYNTHETIC_result_t step_record_218_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 219 exists */
+SYNTHETIC_result_t step_record_219_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 219 has value 1533 */
+SYNTHETIC_result_t step_record_219_has_value_1533(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 219 is updated */
+SYNTHETIC_result_t step_record_219_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 219 should be saved */
+SYNTHETIC_result_t step_record_219_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 219 should not be duplicated */
+SYNTHETIC_result_t step_record_219_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 220 exists */
+SYNTHETIC_result_t step_record_220_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 220 has value 1540 */
+SYNTHETIC_result_t step_record_220_has_value_1540(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 220 is updated */
+SYNTHETIC_result_t step_record_220_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 220 should be saved */
+SYNTHETIC_result_t step_record_220_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 220 should not be duplicated */
+SYNTHETIC_result_t step_record_220_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 221 exists */
+SYNTHETIC_result_t step_record_221_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 221 has value 1547 */
+SYNTHETIC_result_t step_record_221_has_value_1547(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 221 is updated */
+SYNTHETIC_result_t step_record_221_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 221 should be saved */
+SYNTHETIC_result_t step_record_221_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 221 should not be duplicated */
+SYNTHETIC_result_t step_record_221_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 222 exists */
+SYNTHETIC_result_t step_record_222_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 222 has value 1554 */
+SYNTHETIC_result_t step_record_222_has_value_1554(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 222 is updated */
+SYNTHETIC_result_t step_record_222_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 222 should be saved */
+SYNTHETIC_result_t step_record_222_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 222 should not be duplicated */
+SYNTHETIC_result_t step_record_222_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 223 exists */
+SYNTHETIC_result_t step_record_223_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 223 has value 1561 */
+SYNTHETIC_result_t step_record_223_has_value_1561(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 223 is updated */
+SYNTHETIC_result_t step_record_223_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 223 should be saved */
+SYNTHETIC_result_t step_record_223_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 223 should not be duplicated */
+SYNTHETIC_result_t step_record_223_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 224 exists */
+SYNTHETIC_result_t step_record_224_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 224 has value 1568 */
+SYNTHETIC_result_t step_record_224_has_value_1568(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 224 is updated */
+SYNTHETIC_result_t step_record_224_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 224 should be saved */
+SYNTHETIC_result_t step_record_224_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 224 should not be duplicated */
+SYNTHETIC_result_t step_record_224_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 225 exists */
+SYNTHETIC_result_t step_record_225_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 225 has value 1575 */
+SYNTHETIC_result_t step_record_225_has_value_1575(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 225 is updated */
+SYNTHETIC_result_t step_record_225_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 225 should be saved */
+SYNTHETIC_result_t step_record_225_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 225 should not be duplicated */
+SYNTHETIC_result_t step_record_225_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 226 exists */
+SYNTHETIC_result_t step_record_226_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 226 has value 1582 */
+SYNTHETIC_result_t step_record_226_has_value_1582(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 226 is updated */
+SYNTHETIC_result_t step_record_226_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 226 should be saved */
+SYNTHETIC_result_t step_record_226_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 226 should not be duplicated */
+SYNTHETIC_result_t step_record_226_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 227 exists */
+SYNTHETIC_result_t step_record_227_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 227 has value 1589 */
+SYNTHETIC_result_t step_record_227_has_value_1589(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 227 is updated */
+SYNTHETIC_result_t step_record_227_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 227 should be saved */
+SYNTHETIC_result_t step_record_227_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 227 should not be duplicated */
+SYNTHETIC_result_t step_record_227_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 228 exists */
+SYNTHETIC_result_t step_record_228_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 228 has value 1596 */
+SYNTHETIC_result_t step_record_228_has_value_1596(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 228 is updated */
+SYNTHETIC_result_t step_record_228_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 228 should be saved */
+SYNTHETIC_result_t step_record_228_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 228 should not be duplicated */
+SYNTHETIC_result_t step_record_228_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 229 exists */
+SYNTHETIC_result_t step_record_229_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 229 has value 1603 */
+SYNTHETIC_result_t step_record_229_has_value_1603(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 229 is updated */
+SYNTHETIC_result_t step_record_229_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 229 should be saved */
+SYNTHETIC_result_t step_record_229_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 229 should not be duplicated */
+SYNTHETIC_result_t step_record_229_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 230 exists */
+SYNTHETIC_result_t step_record_230_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 230 has value 1610 */
+SYNTHETIC_result_t step_record_230_has_value_1610(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 230 is updated */
+SYNTHETIC_result_t step_record_230_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 230 should be saved */
+SYNTHETIC_result_t step_record_230_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 230 should not be duplicated */
+SYNTHETIC_result_t step_record_230_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 231 exists */
+SYNTHETIC_result_t step_record_231_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 231 has value 1617 */
+SYNTHETIC_result_t step_record_231_has_value_1617(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 231 is updated */
+SYNTHETIC_result_t step_record_231_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 231 should be saved */
+SYNTHETIC_result_t step_record_231_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 231 should not be duplicated */
+SYNTHETIC_result_t step_record_231_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 232 exists */
+SYNTHETIC_result_t step_record_232_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 232 has value 1624 */
+SYNTHETIC_result_t step_record_232_has_value_1624(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 232 is updated */
+SYNTHETIC_result_t step_record_232_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 232 should be saved */
+SYNTHETIC_result_t step_record_232_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 232 should not be duplicated */
+SYNTHETIC_result_t step_record_232_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 233 exists */
+SYNTHETIC_result_t step_record_233_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 233 has value 1631 */
+SYNTHETIC_result_t step_record_233_has_value_1631(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 233 is updated */
+SYNTHETIC_result_t step_record_233_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 233 should be saved */
+SYNTHETIC_result_t step_record_233_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 233 should not be duplicated */
+SYNTHETIC_result_t step_record_233_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 234 exists */
+SYNTHETIC_result_t step_record_234_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 234 has value 1638 */
+SYNTHETIC_result_t step_record_234_has_value_1638(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 234 is updated */
+SYNTHETIC_result_t step_record_234_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 234 should be saved */
+SYNTHETIC_result_t step_record_234_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 234 should not be duplicated */
+SYNTHETIC_result_t step_record_234_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 235 exists */
+SYNTHETIC_result_t step_record_235_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 235 has value 1645 */
+SYNTHETIC_result_t step_record_235_has_value_1645(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 235 is updated */
+SYNTHETIC_result_t step_record_235_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 235 should be saved */
+SYNTHETIC_result_t step_record_235_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 235 should not be duplicated */
+SYNTHETIC_result_t step_record_235_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 236 exists */
+SYNTHETIC_result_t step_record_236_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 236 has value 1652 */
+SYNTHETIC_result_t step_record_236_has_value_1652(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 236 is updated */
+SYNTHETIC_result_t step_record_236_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 236 should be saved */
+SYNTHETIC_result_t step_record_236_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 236 should not be duplicated */
+SYNTHETIC_result_t step_record_236_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 237 exists */
+SYNTHETIC_result_t step_record_237_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 237 has value 1659 */
+SYNTHETIC_result_t step_record_237_has_value_1659(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 237 is updated */
+SYNTHETIC_result_t step_record_237_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 237 should be saved */
+SYNTHETIC_result_t step_record_237_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 237 should not be duplicated */
+SYNTHETIC_result_t step_record_237_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 238 exists */
+SYNTHETIC_result_t step_record_238_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 238 has value 1666 */
+SYNTHETIC_result_t step_record_238_has_value_1666(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 238 is updated */
+SYNTHETIC_result_t step_record_238_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 238 should be saved */
+SYNTHETIC_result_t step_record_238_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 238 should not be duplicated */
+SYNTHETIC_result_t step_record_238_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 239 exists */
+SYNTHETIC_result_t step_record_239_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 239 has value 1673 */
+SYNTHETIC_result_t step_record_239_has_value_1673(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 239 is updated */
+SYNTHETIC_result_t step_record_239_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 239 should be saved */
+SYNTHETIC_result_t step_record_239_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 239 should not be duplicated */
+SYNTHETIC_result_t step_record_239_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 240 exists */
+SYNTHETIC_result_t step_record_240_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 240 has value 1680 */
+SYNTHETIC_result_t step_record_240_has_value_1680(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 240 is updated */
+SYNTHETIC_result_t step_record_240_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 240 should be saved */
+SYNTHETIC_result_t step_record_240_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 240 should not be duplicated */
+SYNTHETIC_result_t step_record_240_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 241 exists */
+SYNTHETIC_result_t step_record_241_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 241 has value 1687 */
+SYNTHETIC_result_t step_record_241_has_value_1687(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 241 is updated */
+SYNTHETIC_result_t step_record_241_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 241 should be saved */
+SYNTHETIC_result_t step_record_241_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 241 should not be duplicated */
+SYNTHETIC_result_t step_record_241_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 242 exists */
+SYNTHETIC_result_t step_record_242_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 242 has value 1694 */
+SYNTHETIC_result_t step_record_242_has_value_1694(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 242 is updated */
+SYNTHETIC_result_t step_record_242_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 242 should be saved */
+SYNTHETIC_result_t step_record_242_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 242 should not be duplicated */
+SYNTHETIC_result_t step_record_242_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 243 exists */
+SYNTHETIC_result_t step_record_243_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 243 has value 1701 */
+SYNTHETIC_result_t step_record_243_has_value_1701(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 243 is updated */
+SYNTHETIC_result_t step_record_243_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 243 should be saved */
+SYNTHETIC_result_t step_record_243_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 243 should not be duplicated */
+SYNTHETIC_result_t step_record_243_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 244 exists */
+SYNTHETIC_result_t step_record_244_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 244 has value 1708 */
+SYNTHETIC_result_t step_record_244_has_value_1708(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 244 is updated */
+SYNTHETIC_result_t step_record_244_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 244 should be saved */
+SYNTHETIC_result_t step_record_244_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 244 should not be duplicated */
+SYNTHETIC_result_t step_record_244_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 245 exists */
+SYNTHETIC_result_t step_record_245_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 245 has value 1715 */
+SYNTHETIC_result_t step_record_245_has_value_1715(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 245 is updated */
+SYNTHETIC_result_t step_record_245_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 245 should be saved */
+SYNTHETIC_result_t step_record_245_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 245 should not be duplicated */
+SYNTHETIC_result_t step_record_245_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 246 exists */
+SYNTHETIC_result_t step_record_246_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 246 has value 1722 */
+SYNTHETIC_result_t step_record_246_has_value_1722(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 246 is updated */
+SYNTHETIC_result_t step_record_246_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 246 should be saved */
+SYNTHETIC_result_t step_record_246_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 246 should not be duplicated */
+SYNTHETIC_result_t step_record_246_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 247 exists */
+SYNTHETIC_result_t step_record_247_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 247 has value 1729 */
+SYNTHETIC_result_t step_record_247_has_value_1729(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 247 is updated */
+SYNTHETIC_result_t step_record_247_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 247 should be saved */
+SYNTHETIC_result_t step_record_247_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 247 should not be duplicated */
+SYNTHETIC_result_t step_record_247_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 248 exists */
+SYNTHETIC_result_t step_record_248_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 248 has value 1736 */
+SYNTHETIC_result_t step_record_248_has_value_1736(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 248 is updated */
+SYNTHETIC_result_t step_record_248_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 248 should be saved */
+SYNTHETIC_result_t step_record_248_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 248 should not be duplicated */
+SYNTHETIC_result_t step_record_248_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 249 exists */
+SYNTHETIC_result_t step_record_249_exists(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Given record 249 has value 1743 */
+SYNTHETIC_result_t step_record_249_has_value_1743(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* When record 249 is updated */
+SYNTHETIC_result_t step_record_249_is_updated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 249 should be saved */
+SYNTHETIC_result_t step_record_249_should_be_saved(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
+/* Then record 249 should not be duplicated */
+SYNTHETIC_result_t step_record_249_should_not_be_duplicated(SYNTHETIC_context_t *ctx) {
+    (void)ctx; /* TODO: implement */
+    return SYNTHETIC_PENDING;
+}
+
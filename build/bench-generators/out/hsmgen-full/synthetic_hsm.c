@@ -0,0 +1,15373 @@
+/* AUTO-GENERATED by hsmgen 1.0.0 — DO NOT EDIT */
+
+#include "synthetic_hsm.h"
+#include <stddef.h>
+#include <string.h>
+
+/* State hierarchy table */
+static const Synthetic_state_info_t state_info[] = {
+    {"G0", "G0", -1, 0, 1, 0},
+    {"S0", "G0.S0", 0, 1, -1, 0},
+    {"S1", "G0.S1", 0, 1, -1, 0},
+    {"S2", "G0.S2", 0, 1, -1, 0},
+    {"S3", "G0.S3", 0, 1, -1, 0},
+    {"S4", "G0.S4", 0, 1, -1, 0},
+    {"S5", "G0.S5", 0, 1, -1, 0},
+    {"S6", "G0.S6", 0, 1, -1, 0},
+    {"S7", "G0.S7", 0, 1, -1, 0},
+    {"S8", "G0.S8", 0, 1, -1, 0},
+    {"G1", "G1", -1, 0, 11, 0},
+    {"S0", "G1.S0", 10, 1, -1, 0},
+    {"S1", "G1.S1", 10, 1, -1, 0},
+    {"S2", "G1.S2", 10, 1, -1, 0},
+    {"S3", "G1.S3", 10, 1, -1, 0},
+    {"S4", "G1.S4", 10, 1, -1, 0},
+    {"S5", "G1.S5", 10, 1, -1, 0},
+    {"S6", "G1.S6", 10, 1, -1, 0},
+    {"S7", "G1.S7", 10, 1, -1, 0},
+    {"S8", "G1.S8", 10, 1, -1, 0},
+    {"G2", "G2", -1, 0, 21, 0},
+    {"S0", "G2.S0", 20, 1, -1, 0},
+    {"S1", "G2.S1", 20, 1, -1, 0},
+    {"S2", "G2.S2", 20, 1, -1, 0},
+    {"S3", "G2.S3", 20, 1, -1, 0},
+    {"S4", "G2.S4", 20, 1, -1, 0},
+    {"S5", "G2.S5", 20, 1, -1, 0},
+    {"S6", "G2.S6", 20, 1, -1, 0},
+    {"S7", "G2.S7", 20, 1, -1, 0},
+    {"S8", "G2.S8", 20, 1, -1, 0},
+    {"G3", "G3", -1, 0, 31, 0},
+    {"S0", "G3.S0", 30, 1, -1, 0},
+    {"S1", "G3.S1", 30, 1, -1, 0},
+    {"S2", "G3.S2", 30, 1, -1, 0},
+    {"S3", "G3.S3", 30, 1, -1, 0},
+    {"S4", "G3.S4", 30, 1, -1, 0},
+    {"S5", "G3.S5", 30, 1, -1, 0},
+    {"S6", "G3.S6", 30, 1, -1, 0},
+    {"S7", "G3.S7", 30, 1, -1, 0},
+    {"S8", "G3.S8", 30, 1, -1, 0},
+    {"G4", "G4", -1, 0, 41, 0},
+    {"S0", "G4.S0", 40, 1, -1, 0},
+    {"S1", "G4.S1", 40, 1, -1, 0},
+    {"S2", "G4.S2", 40, 1, -1, 0},
+    {"S3", "G4.S3", 40, 1, -1, 0},
+    {"S4", "G4.S4", 40, 1, -1, 0},
+    {"S5", "G4.S5", 40, 1, -1, 0},
+    {"S6", "G4.S6", 40, 1, -1, 0},
+    {"S7", "G4.S7", 40, 1, -1, 0},
+    {"S8", "G4.S8", 40, 1, -1, 0},
+    {"G5", "G5", -1, 0, 51, 0},
+    {"S0", "G5.S0", 50, 1, -1, 0},
+    {"S1", "G5.S1", 50, 1, -1, 0},
+    {"S2", "G5.S2", 50, 1, -1, 0},
+    {"S3", "G5.S3", 50, 1, -1, 0},
+    {"S4", "G5.S4", 50, 1, -1, 0},
+    {"S5", "G5.S5", 50, 1, -1, 0},
+    {"S6", "G5.S6", 50, 1, -1, 0},
+    {"S7", "G5.S7", 50, 1, -1, 0},
+    {"S8", "G5.S8", 50, 1, -1, 0},
+    {"G6", "G6", -1, 0, 61, 0},
+    {"S0", "G6.S0", 60, 1, -1, 0},
+    {"S1", "G6.S1", 60, 1, -1, 0},
+    {"S2", "G6.S2", 60, 1, -1, 0},
+    {"S3", "G6.S3", 60, 1, -1, 0},
+    {"S4", "G6.S4", 60, 1, -1, 0},
+    {"S5", "G6.S5", 60, 1, -1, 0},
+    {"S6", "G6.S6", 60, 1, -1, 0},
+    {"S7", "G6.S7", 60, 1, -1, 0},
+    {"S8", "G6.S8", 60, 1, -1, 0},
+    {"G7", "G7", -1, 0, 71, 0},
+    {"S0", "G7.S0", 70, 1, -1, 0},
+    {"S1", "G7.S1", 70, 1, -1, 0},
+    {"S2", "G7.S2", 70, 1, -1, 0},
+    {"S3", "G7.S3", 70, 1, -1, 0},
+    {"S4", "G7.S4", 70, 1, -1, 0},
+    {"S5", "G7.S5", 70, 1, -1, 0},
+    {"S6", "G7.S6", 70, 1, -1, 0},
+    {"S7", "G7.S7", 70, 1, -1, 0},
+    {"S8", "G7.S8", 70, 1, -1, 0},
+    {"G8", "G8", -1, 0, 81, 0},
+    {"S0", "G8.S0", 80, 1, -1, 0},
+    {"S1", "G8.S1", 80, 1, -1, 0},
+    {"S2", "G8.S2", 80, 1, -1, 0},
+    {"S3", "G8.S3", 80, 1, -1, 0},
+    {"S4", "G8.S4", 80, 1, -1, 0},
+    {"S5", "G8.S5", 80, 1, -1, 0},
+    {"S6", "G8.S6", 80, 1, -1, 0},
+    {"S7", "G8.S7", 80, 1, -1, 0},
+    {"S8", "G8.S8", 80, 1, -1, 0},
+    {"G9", "G9", -1, 0, 91, 0},
+    {"S0", "G9.S0", 90, 1, -1, 0},
+    {"S1", "G9.S1", 90, 1, -1, 0},
+    {"S2", "G9.S2", 90, 1, -1, 0},
+    {"S3", "G9.S3", 90, 1, -1, 0},
+    {"S4", "G9.S4", 90, 1, -1, 0},
+    {"S5", "G9.S5", 90, 1, -1, 0},
+    {"S6", "G9.S6", 90, 1, -1, 0},
+    {"S7", "G9.S7", 90, 1, -1, 0},
+    {"S8", "G9.S8", 90, 1, -1, 0},
+    {"G10", "G10", -1, 0, 101, 0},
+    {"S0", "G10.S0", 100, 1, -1, 0},
+    {"S1", "G10.S1", 100, 1, -1, 0},
+    {"S2", "G10.S2", 100, 1, -1, 0},
+    {"S3", "G10.S3", 100, 1, -1, 0},
+    {"S4", "G10.S4", 100, 1, -1, 0},
+    {"S5", "G10.S5", 100, 1, -1, 0},
+    {"S6", "G10.S6", 100, 1, -1, 0},
+    {"S7", "G10.S7", 100, 1, -1, 0},
+    {"S8", "G10.S8", 100, 1, -1, 0},
+    {"G11", "G11", -1, 0, 111, 0},
+    {"S0", "G11.S0", 110, 1, -1, 0},
+    {"S1", "G11.S1", 110, 1, -1, 0},
+    {"S2", "G11.S2", 110, 1, -1, 0},
+    {"S3", "G11.S3", 110, 1, -1, 0},
+    {"S4", "G11.S4", 110, 1, -1, 0},
+    {"S5", "G11.S5", 110, 1, -1, 0},
+    {"S6", "G11.S6", 110, 1, -1, 0},
+    {"S7", "G11.S7", 110, 1, -1, 0},
+    {"S8", "G11.S8", 110, 1, -1, 0},
+    {"G12", "G12", -1, 0, 121, 0},
+    {"S0", "G12.S0", 120, 1, -1, 0},
+    {"S1", "G12.S1", 120, 1, -1, 0},
+    {"S2", "G12.S2", 120, 1, -1, 0},
+    {"S3", "G12.S3", 120, 1, -1, 0},
+    {"S4", "G12.S4", 120, 1, -1, 0},
+    {"S5", "G12.S5", 120, 1, -1, 0},
+    {"S6", "G12.S6", 120, 1, -1, 0},
+    {"S7", "G12.S7", 120, 1, -1, 0},
+    {"S8", "G12.S8", 120, 1, -1, 0},
+    {"G13", "G13", -1, 0, 131, 0},
+    {"S0", "G13.S0", 130, 1, -1, 0},
+    {"S1", "G13.S1", 130, 1, -1, 0},
+    {"S2", "G13.S2", 130, 1, -1, 0},
+    {"S3", "G13.S3", 130, 1, -1, 0},
+    {"S4", "G13.S4", 130, 1, -1, 0},
+    {"S5", "G13.S5", 130, 1, -1, 0},
+    {"S6", "G13.S6", 130, 1, -1, 0},
+    {"S7", "G13.S7", 130, 1, -1, 0},
+    {"S8", "G13.S8", 130, 1, -1, 0},
+    {"G14", "G14", -1, 0, 141, 0},
+    {"S0", "G14.S0", 140, 1, -1, 0},
+    {"S1", "G14.S1", 140, 1, -1, 0},
+    {"S2", "G14.S2", 140, 1, -1, 0},
+    {"S3", "G14.S3", 140, 1, -1, 0},
+    {"S4", "G14.S4", 140, 1, -1, 0},
+    {"S5", "G14.S5", 140, 1, -1, 0},
+    {"S6", "G14.S6", 140, 1, -1, 0},
+    {"S7", "G14.S7", 140, 1, -1, 0},
+    {"S8", "G14.S8", 140, 1, -1, 0},
+    {"G15", "G15", -1, 0, 151, 0},
+    {"S0", "G15.S0", 150, 1, -1, 0},
+    {"S1", "G15.S1", 150, 1, -1, 0},
+    {"S2", "G15.S2", 150, 1, -1, 0},
+    {"S3", "G15.S3", 150, 1, -1, 0},
+    {"S4", "G15.S4", 150, 1, -1, 0},
+    {"S5", "G15.S5", 150, 1, -1, 0},
+    {"S6", "G15.S6", 150, 1, -1, 0},
+    {"S7", "G15.S7", 150, 1, -1, 0},
+    {"S8", "G15.S8", 150, 1, -1, 0},
+    {"G16", "G16", -1, 0, 161, 0},
+    {"S0", "G16.S0", 160, 1, -1, 0},
+    {"S1", "G16.S1", 160, 1, -1, 0},
+    {"S2", "G16.S2", 160, 1, -1, 0},
+    {"S3", "G16.S3", 160, 1, -1, 0},
+    {"S4", "G16.S4", 160, 1, -1, 0},
+    {"S5", "G16.S5", 160, 1, -1, 0},
+    {"S6", "G16.S6", 160, 1, -1, 0},
+    {"S7", "G16.S7", 160, 1, -1, 0},
+    {"S8", "G16.S8", 160, 1, -1, 0},
+    {"G17", "G17", -1, 0, 171, 0},
+    {"S0", "G17.S0", 170, 1, -1, 0},
+    {"S1", "G17.S1", 170, 1, -1, 0},
+    {"S2", "G17.S2", 170, 1, -1, 0},
+    {"S3", "G17.S3", 170, 1, -1, 0},
+    {"S4", "G17.S4", 170, 1, -1, 0},
+    {"S5", "G17.S5", 170, 1, -1, 0},
+    {"S6", "G17.S6", 170, 1, -1, 0},
+    {"S7", "G17.S7", 170, 1, -1, 0},
+    {"S8", "G17.S8", 170, 1, -1, 0},
+    {"G18", "G18", -1, 0, 181, 0},
+    {"S0", "G18.S0", 180, 1, -1, 0},
+    {"S1", "G18.S1", 180, 1, -1, 0},
+    {"S2", "G18.S2", 180, 1, -1, 0},
+    {"S3", "G18.S3", 180, 1, -1, 0},
+    {"S4", "G18.S4", 180, 1, -1, 0},
+    {"S5", "G18.S5", 180, 1, -1, 0},
+    {"S6", "G18.S6", 180, 1, -1, 0},
+    {"S7", "G18.S7", 180, 1, -1, 0},
+    {"S8", "G18.S8", 180, 1, -1, 0},
+    {"G19", "G19", -1, 0, 191, 0},
+    {"S0", "G19.S0", 190, 1, -1, 0},
+    {"S1", "G19.S1", 190, 1, -1, 0},
+    {"S2", "G19.S2", 190, 1, -1, 0},
+    {"S3", "G19.S3", 190, 1, -1, 0},
+    {"S4", "G19.S4", 190, 1, -1, 0},
+    {"S5", "G19.S5", 190, 1, -1, 0},
+    {"S6", "G19.S6", 190, 1, -1, 0},
+    {"S7", "G19.S7", 190, 1, -1, 0},
+    {"S8", "G19.S8", 190, 1, -1, 0},
+    {"G20", "G20", -1, 0, 201, 0},
+    {"S0", "G20.S0", 200, 1, -1, 0},
+    {"S1", "G20.S1", 200, 1, -1, 0},
+    {"S2", "G20.S2", 200, 1, -1, 0},
+    {"S3", "G20.S3", 200, 1, -1, 0},
+    {"S4", "G20.S4", 200, 1, -1, 0},
+    {"S5", "G20.S5", 200, 1, -1, 0},
+    {"S6", "G20.S6", 200, 1, -1, 0},
+    {"S7", "G20.S7", 200, 1, -1, 0},
+    {"S8", "G20.S8", 200, 1, -1, 0},
+    {"G21", "G21", -1, 0, 211, 0},
+    {"S0", "G21.S0", 210, 1, -1, 0},
+    {"S1", "G21.S1", 210, 1, -1, 0},
+    {"S2", "G21.S2", 210, 1, -1, 0},
+    {"S3", "G21.S3", 210, 1, -1, 0},
+    {"S4", "G21.S4", 210, 1, -1, 0},
+    {"S5", "G21.S5", 210, 1, -1, 0},
+    {"S6", "G21.S6", 210, 1, -1, 0},
+    {"S7", "G21.S7", 210, 1, -1, 0},
+    {"S8", "G21.S8", 210, 1, -1, 0},
+    {"G22", "G22", -1, 0, 221, 0},
+    {"S0", "G22.S0", 220, 1, -1, 0},
+    {"S1", "G22.S1", 220, 1, -1, 0},
+    {"S2", "G22.S2", 220, 1, -1, 0},
+    {"S3", "G22.S3", 220, 1, -1, 0},
+    {"S4", "G22.S4", 220, 1, -1, 0},
+    {"S5", "G22.S5", 220, 1, -1, 0},
+    {"S6", "G22.S6", 220, 1, -1, 0},
+    {"S7", "G22.S7", 220, 1, -1, 0},
+    {"S8", "G22.S8", 220, 1, -1, 0},
+    {"G23", "G23", -1, 0, 231, 0},
+    {"S0", "G23.S0", 230, 1, -1, 0},
+    {"S1", "G23.S1", 230, 1, -1, 0},
+    {"S2", "G23.S2", 230, 1, -1, 0},
+    {"S3", "G23.S3", 230, 1, -1, 0},
+    {"S4", "G23.S4", 230, 1, -1, 0},
+    {"S5", "G23.S5", 230, 1, -1, 0},
+    {"S6", "G23.S6", 230, 1, -1, 0},
+    {"S7", "G23.S7", 230, 1, -1, 0},
+    {"S8", "G23.S8", 230, 1, -1, 0},
+    {"G24", "G24", -1, 0, 241, 0},
+    {"S0", "G24.S0", 240, 1, -1, 0},
+    {"S1", "G24.S1", 240, 1, -1, 0},
+    {"S2", "G24.S2", 240, 1, -1, 0},
+    {"S3", "G24.S3", 240, 1, -1, 0},
+    {"S4", "G24.S4", 240, 1, -1, 0},
+    {"S5", "G24.S5", 240, 1, -1, 0},
+    {"S6", "G24.S6", 240, 1, -1, 0},
+    {"S7", "G24.S7", 240, 1, -1, 0},
+    {"S8", "G24.S8", 240, 1, -1, 0},
+    {"G25", "G25", -1, 0, 251, 0},
+    {"S0", "G25.S0", 250, 1, -1, 0},
+    {"S1", "G25.S1", 250, 1, -1, 0},
+    {"S2", "G25.S2", 250, 1, -1, 0},
+    {"S3", "G25.S3", 250, 1, -1, 0},
+    {"S4", "G25.S4", 250, 1, -1, 0},
+    {"S5", "G25.S5", 250, 1, -1, 0},
+    {"S6", "G25.S6", 250, 1, -1, 0},
+    {"S7", "G25.S7", 250, 1, -1, 0},
+    {"S8", "G25.S8", 250, 1, -1, 0},
+    {"G26", "G26", -1, 0, 261, 0},
+    {"S0", "G26.S0", 260, 1, -1, 0},
+    {"S1", "G26.S1", 260, 1, -1, 0},
+    {"S2", "G26.S2", 260, 1, -1, 0},
+    {"S3", "G26.S3", 260, 1, -1, 0},
+    {"S4", "G26.S4", 260, 1, -1, 0},
+    {"S5", "G26.S5", 260, 1, -1, 0},
+    {"S6", "G26.S6", 260, 1, -1, 0},
+    {"S7", "G26.S7", 260, 1, -1, 0},
+    {"S8", "G26.S8", 260, 1, -1, 0},
+    {"G27", "G27", -1, 0, 271, 0},
+    {"S0", "G27.S0", 270, 1, -1, 0},
+    {"S1", "G27.S1", 270, 1, -1, 0},
+    {"S2", "G27.S2", 270, 1, -1, 0},
+    {"S3", "G27.S3", 270, 1, -1, 0},
+    {"S4", "G27.S4", 270, 1, -1, 0},
+    {"S5", "G27.S5", 270, 1, -1, 0},
+    {"S6", "G27.S6", 270, 1, -1, 0},
+    {"S7", "G27.S7", 270, 1, -1, 0},
+    {"S8", "G27.S8", 270, 1, -1, 0},
+    {"G28", "G28", -1, 0, 281, 0},
+    {"S0", "G28.S0", 280, 1, -1, 0},
+    {"S1", "G28.S1", 280, 1, -1, 0},
+    {"S2", "G28.S2", 280, 1, -1, 0},
+    {"S3", "G28.S3", 280, 1, -1, 0},
+    {"S4", "G28.S4", 280, 1, -1, 0},
+    {"S5", "G28.S5", 280, 1, -1, 0},
+    {"S6", "G28.S6", 280, 1, -1, 0},
+    {"S7", "G28.S7", 280, 1, -1, 0},
+    {"S8", "G28.S8", 280, 1, -1, 0},
+    {"G29", "G29", -1, 0, 291, 0},
+    {"S0", "G29.S0", 290, 1, -1, 0},
+    {"S1", "G29.S1", 290, 1, -1, 0},
+    {"S2", "G29.S2", 290, 1, -1, 0},
+    {"S3", "G29.S3", 290, 1, -1, 0},
+    {"S4", "G29.S4", 290, 1, -1, 0},
+    {"S5", "G29.S5", 290, 1, -1, 0},
+    {"S6", "G29.S6", 290, 1, -1, 0},
+    {"S7", "G29.S7", 290, 1, -1, 0},
+    {"S8", "G29.S8", 290, 1, -1, 0},
+    {"G30", "G30", -1, 0, 301, 0},
+    {"S0", "G30.S0", 300, 1, -1, 0},
+    {"S1", "G30.S1", 300, 1, -1, 0},
+    {"S2", "G30.S2", 300, 1, -1, 0},
+    {"S3", "G30.S3", 300, 1, -1, 0},
+    {"S4", "G30.S4", 300, 1, -1, 0},
+    {"S5", "G30.S5", 300, 1, -1, 0},
+    {"S6", "G30.S6", 300, 1, -1, 0},
+    {"S7", "G30.S7", 300, 1, -1, 0},
+    {"S8", "G30.S8", 300, 1, -1, 0},
+    {"G31", "G31", -1, 0, 311, 0},
+    {"S0", "G31.S0", 310, 1, -1, 0},
+    {"S1", "G31.S1", 310, 1, -1, 0},
+    {"S2", "G31.S2", 310, 1, -1, 0},
+    {"S3", "G31.S3", 310, 1, -1, 0},
+    {"S4", "G31.S4", 310, 1, -1, 0},
+    {"S5", "G31.S5", 310, 1, -1, 0},
+    {"S6", "G31.S6", 310, 1, -1, 0},
+    {"S7", "G31.S7", 310, 1, -1, 0},
+    {"S8", "G31.S8", 310, 1, -1, 0},
+    {"G32", "G32", -1, 0, 321, 0},
+    {"S0", "G32.S0", 320, 1, -1, 0},
+    {"S1", "G32.S1", 320, 1, -1, 0},
+    {"S2", "G32.S2", 320, 1, -1, 0},
+    {"S3", "G32.S3", 320, 1, -1, 0},
+    {"S4", "G32.S4", 320, 1, -1, 0},
+    {"S5", "G32.S5", 320, 1, -1, 0},
+    {"S6", "G32.S6", 320, 1, -1, 0},
+    {"S7", "G32.S7", 320, 1, -1, 0},
+    {"S8", "G32.S8", 320, 1, -1, 0},
+    {"G33", "G33", -1, 0, 331, 0},
+    {"S0", "G33.S0", 330, 1, -1, 0},
+    {"S1", "G33.S1", 330, 1, -1, 0},
+    {"S2", "G33.S2", 330, 1, -1, 0},
+    {"S3", "G33.S3", 330, 1, -1, 0},
+    {"S4", "G33.S4", 330, 1, -1, 0},
+    {"S5", "G33.S5", 330, 1, -1, 0},
+    {"S6", "G33.S6", 330, 1, -1, 0},
+    {"S7", "G33.S7", 330, 1, -1, 0},
+    {"S8", "G33.S8", 330, 1, -1, 0},
+    {"G34", "G34", -1, 0, 341, 0},
+    {"S0", "G34.S0", 340, 1, -1, 0},
+    {"S1", "G34.S1", 340, 1, -1, 0},
+    {"S2", "G34.S2", 340, 1, -1, 0},
+    {"S3", "G34.S3", 340, 1, -1, 0},
+    {"S4", "G34.S4", 340, 1, -1, 0},
+    {"S5", "G34.S5", 340, 1, -1, 0},
+    {"S6", "G34.S6", 340, 1, -1, 0},
+    {"S7", "G34.S7", 340, 1, -1, 0},
+    {"S8", "G34.S8", 340, 1, -1, 0},
+    {"G35", "G35", -1, 0, 351, 0},
+    {"S0", "G35.S0", 350, 1, -1, 0},
+    {"S1", "G35.S1", 350, 1, -1, 0},
+    {"S2", "G35.S2", 350, 1, -1, 0},
+    {"S3", "G35.S3", 350, 1, -1, 0},
+    {"S4", "G35.S4", 350, 1, -1, 0},
+    {"S5", "G35.S5", 350, 1, -1, 0},
+    {"S6", "G35.S6", 350, 1, -1, 0},
+    {"S7", "G35.S7", 350, 1, -1, 0},
+    {"S8", "G35.S8", 350, 1, -1, 0},
+    {"G36", "G36", -1, 0, 361, 0},
+    {"S0", "G36.S0", 360, 1, -1, 0},
+    {"S1", "G36.S1", 360, 1, -1, 0},
+    {"S2", "G36.S2", 360, 1, -1, 0},
+    {"S3", "G36.S3", 360, 1, -1, 0},
+    {"S4", "G36.S4", 360, 1, -1, 0},
+    {"S5", "G36.S5", 360, 1, -1, 0},
+    {"S6", "G36.S6", 360, 1, -1, 0},
+    {"S7", "G36.S7", 360, 1, -1, 0},
+    {"S8", "G36.S8", 360, 1, -1, 0},
+    {"G37", "G37", -1, 0, 371, 0},
+    {"S0", "G37.S0", 370, 1, -1, 0},
+    {"S1", "G37.S1", 370, 1, -1, 0},
+    {"S2", "G37.S2", 370, 1, -1, 0},
+    {"S3", "G37.S3", 370, 1, -1, 0},
+    {"S4", "G37.S4", 370, 1, -1, 0},
+    {"S5", "G37.S5", 370, 1, -1, 0},
+    {"S6", "G37.S6", 370, 1, -1, 0},
+    {"S7", "G37.S7", 370, 1, -1, 0},
+    {"S8", "G37.S8", 370, 1, -1, 0},
+    {"G38", "G38", -1, 0, 381, 0},
+    {"S0", "G38.S0", 380, 1, -1, 0},
+    {"S1", "G38.S1", 380, 1, -1, 0},
+    {"S2", "G38.S2", 380, 1, -1, 0},
+    {"S3", "G38.S3", 380, 1, -1, 0},
+    {"S4", "G38.S4", 380, 1, -1, 0},
+    {"S5", "G38.S5", 380, 1, -1, 0},
+    {"S6", "G38.S6", 380, 1, -1, 0},
+    {"S7", "G38.S7", 380, 1, -1, 0},
+    {"S8", "G38.S8", 380, 1, -1, 0},
+    {"G39", "G39", -1, 0, 391, 0},
+    {"S0", "G39.S0", 390, 1, -1, 0},
+    {"S1", "G39.S1", 390, 1, -1, 0},
+    {"S2", "G39.S2", 390, 1, -1, 0},
+    {"S3", "G39.S3", 390, 1, -1, 0},
+    {"S4", "G39.S4", 390, 1, -1, 0},
+    {"S5", "G39.S5", 390, 1, -1, 0},
+    {"S6", "G39.S6", 390, 1, -1, 0},
+    {"S7", "G39.S7", 390, 1, -1, 0},
+    {"S8", "G39.S8", 390, 1, -1, 0},
+    {"G40", "G40", -1, 0, 401, 0},
+    {"S0", "G40.S0", 400, 1, -1, 0},
+    {"S1", "G40.S1", 400, 1, -1, 0},
+    {"S2", "G40.S2", 400, 1, -1, 0},
+    {"S3", "G40.S3", 400, 1, -1, 0},
+    {"S4", "G40.S4", 400, 1, -1, 0},
+    {"S5", "G40.S5", 400, 1, -1, 0},
+    {"S6", "G40.S6", 400, 1, -1, 0},
+    {"S7", "G40.S7", 400, 1, -1, 0},
+    {"S8", "G40.S8", 400, 1, -1, 0},
+    {"G41", "G41", -1, 0, 411, 0},
+    {"S0", "G41.S0", 410, 1, -1, 0},
+    {"S1", "G41.S1", 410, 1, -1, 0},
+    {"S2", "G41.S2", 410, 1, -1, 0},
+    {"S3", "G41.S3", 410, 1, -1, 0},
+    {"S4", "G41.S4", 410, 1, -1, 0},
+    {"S5", "G41.S5", 410, 1, -1, 0},
+    {"S6", "G41.S6", 410, 1, -1, 0},
+    {"S7", "G41.S7", 410, 1, -1, 0},
+    {"S8", "G41.S8", 410, 1, -1, 0},
+    {"G42", "G42", -1, 0, 421, 0},
+    {"S0", "G42.S0", 420, 1, -1, 0},
+    {"S1", "G42.S1", 420, 1, -1, 0},
+    {"S2", "G42.S2", 420, 1, -1, 0},
+    {"S3", "G42.S3", 420, 1, -1, 0},
+    {"S4", "G42.S4", 420, 1, -1, 0},
+    {"S5", "G42.S5", 420, 1, -1, 0},
+    {"S6", "G42.S6", 420, 1, -1, 0},
+    {"S7", "G42.S7", 420, 1, -1, 0},
+    {"S8", "G42.S8", 420, 1, -1, 0},
+    {"G43", "G43", -1, 0, 431, 0},
+    {"S0", "G43.S0", 430, 1, -1, 0},
+    {"S1", "G43.S1", 430, 1, -1, 0},
+    {"S2", "G43.S2", 430, 1, -1, 0},
+    {"S3", "G43.S3", 430, 1, -1, 0},
+    {"S4", "G43.S4", 430, 1, -1, 0},
+    {"S5", "G43.S5", 430, 1, -1, 0},
+    {"S6", "G43.S6", 430, 1, -1, 0},
+    {"S7", "G43.S7", 430, 1, -1, 0},
+    {"S8", "G43.S8", 430, 1, -1, 0},
+    {"G44", "G44", -1, 0, 441, 0},
+    {"S0", "G44.S0", 440, 1, -1, 0},
+    {"S1", "G44.S1", 440, 1, -1, 0},
+    {"S2", "G44.S2", 440, 1, -1, 0},
+    {"S3", "G44.S3", 440, 1, -1, 0},
+    {"S4", "G44.S4", 440, 1, -1, 0},
+    {"S5", "G44.S5", 440, 1, -1, 0},
+    {"S6", "G44.S6", 440, 1, -1, 0},
+    {"S7", "G44.S7", 440, 1, -1, 0},
+    {"S8", "G44.S8", 440, 1, -1, 0},
+    {"G45", "G45", -1, 0, 451, 0},
+    {"S0", "G45.S0", 450, 1, -1, 0},
+    {"S1", "G45.S1", 450, 1, -1, 0},
+    {"S2", "G45.S2", 450, 1, -1, 0},
+    {"S3", "G45.S3", 450, 1, -1, 0},
+    {"S4", "G45.S4", 450, 1, -1, 0},
+    {"S5", "G45.S5", 450, 1, -1, 0},
+    {"S6", "G45.S6", 450, 1, -1, 0},
+    {"S7", "G45.S7", 450, 1, -1, 0},
+    {"S8", "G45.S8", 450, 1, -1, 0},
+    {"G46", "G46", -1, 0, 461, 0},
+    {"S0", "G46.S0", 460, 1, -1, 0},
+    {"S1", "G46.S1", 460, 1, -1, 0},
+    {"S2", "G46.S2", 460, 1, -1, 0},
+    {"S3", "G46.S3", 460, 1, -1, 0},
+    {"S4", "G46.S4", 460, 1, -1, 0},
+    {"S5", "G46.S5", 460, 1, -1, 0},
+    {"S6", "G46.S6", 460, 1, -1, 0},
+    {"S7", "G46.S7", 460, 1, -1, 0},
+    {"S8", "G46.S8", 460, 1, -1, 0},
+    {"G47", "G47", -1, 0, 471, 0},
+    {"S0", "G47.S0", 470, 1, -1, 0},
+    {"S1", "G47.S1", 470, 1, -1, 0},
+    {"S2", "G47.S2", 470, 1, -1, 0},
+    {"S3", "G47.S3", 470, 1, -1, 0},
+    {"S4", "G47.S4", 470, 1, -1, 0},
+    {"S5", "G47.S5", 470, 1, -1, 0},
+    {"S6", "G47.S6", 470, 1, -1, 0},
+    {"S7", "G47.S7", 470, 1, -1, 0},
+    {"S8", "G47.S8", 470, 1, -1, 0},
+    {"G48", "G48", -1, 0, 481, 0},
+    {"S0", "G48.S0", 480, 1, -1, 0},
+    {"S1", "G48.S1", 480, 1, -1, 0},
+    {"S2", "G48.S2", 480, 1, -1, 0},
+    {"S3", "G48.S3", 480, 1, -1, 0},
+    {"S4", "G48.S4", 480, 1, -1, 0},
+    {"S5", "G48.S5", 480, 1, -1, 0},
+    {"S6", "G48.S6", 480, 1, -1, 0},
+    {"S7", "G48.S7", 480, 1, -1, 0},
+    {"S8", "G48.S8", 480, 1, -1, 0},
+    {"G49", "G49", -1, 0, 491, 0},
+    {"S0", "G49.S0", 490, 1, -1, 0},
+    {"S1", "G49.S1", 490, 1, -1, 0},
+    {"S2", "G49.S2", 490, 1, -1, 0},
+    {"S3", "G49.S3", 490, 1, -1, 0},
+    {"S4", "G49.S4", 490, 1, -1, 0},
+    {"S5", "G49.S5", 490, 1, -1, 0},
+    {"S6", "G49.S6", 490, 1, -1, 0},
+    {"S7", "G49.S7", 490, 1, -1, 0},
+    {"S8", "G49.S8", 490, 1, -1, 0},
+    {"G50", "G50", -1, 0, 501, 0},
+    {"S0", "G50.S0", 500, 1, -1, 0},
+    {"S1", "G50.S1", 500, 1, -1, 0},
+    {"S2", "G50.S2", 500, 1, -1, 0},
+    {"S3", "G50.S3", 500, 1, -1, 0},
+    {"S4", "G50.S4", 500, 1, -1, 0},
+    {"S5", "G50.S5", 500, 1, -1, 0},
+    {"S6", "G50.S6", 500, 1, -1, 0},
+    {"S7", "G50.S7", 500, 1, -1, 0},
+    {"S8", "G50.S8", 500, 1, -1, 0},
+    {"G51", "G51", -1, 0, 511, 0},
+    {"S0", "G51.S0", 510, 1, -1, 0},
+    {"S1", "G51.S1", 510, 1, -1, 0},
+    {"S2", "G51.S2", 510, 1, -1, 0},
+    {"S3", "G51.S3", 510, 1, -1, 0},
+    {"S4", "G51.S4", 510, 1, -1, 0},
+    {"S5", "G51.S5", 510, 1, -1, 0},
+    {"S6", "G51.S6", 510, 1, -1, 0},
+    {"S7", "G51.S7", 510, 1, -1, 0},
+    {"S8", "G51.S8", 510, 1, -1, 0},
+    {"G52", "G52", -1, 0, 521, 0},
+    {"S0", "G52.S0", 520, 1, -1, 0},
+    {"S1", "G52.S1", 520, 1, -1, 0},
+    {"S2", "G52.S2", 520, 1, -1, 0},
+    {"S3", "G52.S3", 520, 1, -1, 0},
+    {"S4", "G52.S4", 520, 1, -1, 0},
+    {"S5", "G52.S5", 520, 1, -1, 0},
+    {"S6", "G52.S6", 520, 1, -1, 0},
+    {"S7", "G52.S7", 520, 1, -1, 0},
+    {"S8", "G52.S8", 520, 1, -1, 0},
+    {"G53", "G53", -1, 0, 531, 0},
+    {"S0", "G53.S0", 530, 1, -1, 0},
+    {"S1", "G53.S1", 530, 1, -1, 0},
+    {"S2", "G53.S2", 530, 1, -1, 0},
+    {"S3", "G53.S3", 530, 1, -1, 0},
+    {"S4", "G53.S4", 530, 1, -1, 0},
+    {"S5", "G53.S5", 530, 1, -1, 0},
+    {"S6", "G53.S6", 530, 1, -1, 0},
+    {"S7", "G53.S7", 530, 1, -1, 0},
+    {"S8", "G53.S8", 530, 1, -1, 0},
+    {"G54", "G54", -1, 0, 541, 0},
+    {"S0", "G54.S0", 540, 1, -1, 0},
+    {"S1", "G54.S1", 540, 1, -1, 0},
+    {"S2", "G54.S2", 540, 1, -1, 0},
+    {"S3", "G54.S3", 540, 1, -1, 0},
+    {"S4", "G54.S4", 540, 1, -1, 0},
+    {"S5", "G54.S5", 540, 1, -1, 0},
+    {"S6", "G54.S6", 540, 1, -1, 0},
+    {"S7", "G54.S7", 540, 1, -1, 0},
+    {"S8", "G54.S8", 540, 1, -1, 0},
+    {"G55", "G55", -1, 0, 551, 0},
+    {"S0", "G55.S0", 550, 1, -1, 0},
+    {"S1", "G55.S1", 550, 1, -1, 0},
+    {"S2", "G55.S2", 550, 1, -1, 0},
+    {"S3", "G55.S3", 550, 1, -1, 0},
+    {"S4", "G55.S4", 550, 1, -1, 0},
+    {"S5", "G55.S5", 550, 1, -1, 0},
+    {"S6", "G55.S6", 550, 1, -1, 0},
+    {"S7", "G55.S7", 550, 1, -1, 0},
+    {"S8", "G55.S8", 550, 1, -1, 0},
+    {"G56", "G56", -1, 0, 561, 0},
+    {"S0", "G56.S0", 560, 1, -1, 0},
+    {"S1", "G56.S1", 560, 1, -1, 0},
+    {"S2", "G56.S2", 560, 1, -1, 0},
+    {"S3", "G56.S3", 560, 1, -1, 0},
+    {"S4", "G56.S4", 560, 1, -1, 0},
+    {"S5", "G56.S5", 560, 1, -1, 0},
+    {"S6", "G56.S6", 560, 1, -1, 0},
+    {"S7", "G56.S7", 560, 1, -1, 0},
+    {"S8", "G56.S8", 560, 1, -1, 0},
+    {"G57", "G57", -1, 0, 571, 0},
+    {"S0", "G57.S0", 570, 1, -1, 0},
+    {"S1", "G57.S1", 570, 1, -1, 0},
+    {"S2", "G57.S2", 570, 1, -1, 0},
+    {"S3", "G57.S3", 570, 1, -1, 0},
+    {"S4", "G57.S4", 570, 1, -1, 0},
+    {"S5", "G57.S5", 570, 1, -1, 0},
+    {"S6", "G57.S6", 570, 1, -1, 0},
+    {"S7", "G57.S7", 570, 1, -1, 0},
+    {"S8", "G57.S8", 570, 1, -1, 0},
+    {"G58", "G58", -1, 0, 581, 0},
+    {"S0", "G58.S0", 580, 1, -1, 0},
+    {"S1", "G58.S1", 580, 1, -1, 0},
+    {"S2", "G58.S2", 580, 1, -1, 0},
+    {"S3", "G58.S3", 580, 1, -1, 0},
+    {"S4", "G58.S4", 580, 1, -1, 0},
+    {"S5", "G58.S5", 580, 1, -1, 0},
+    {"S6", "G58.S6", 580, 1, -1, 0},
+    {"S7", "G58.S7", 580, 1, -1, 0},
+    {"S8", "G58.S8", 580, 1, -1, 0},
+    {"G59", "G59", -1, 0, 591, 0},
+    {"S0", "G59.S0", 590, 1, -1, 0},
+    {"S1", "G59.S1", 590, 1, -1, 0},
+    {"S2", "G59.S2", 590, 1, -1, 0},
+    {"S3", "G59.S3", 590, 1, -1, 0},
+    {"S4", "G59.S4", 590, 1, -1, 0},
+    {"S5", "G59.S5", 590, 1, -1, 0},
+    {"S6", "G59.S6", 590, 1, -1, 0},
+    {"S7", "G59.S7", 590, 1, -1, 0},
+    {"S8", "G59.S8", 590, 1, -1, 0},
+    {"G60", "G60", -1, 0, 601, 0},
+    {"S0", "G60.S0", 600, 1, -1, 0},
+    {"S1", "G60.S1", 600, 1, -1, 0},
+    {"S2", "G60.S2", 600, 1, -1, 0},
+    {"S3", "G60.S3", 600, 1, -1, 0},
+    {"S4", "G60.S4", 600, 1, -1, 0},
+    {"S5", "G60.S5", 600, 1, -1, 0},
+    {"S6", "G60.S6", 600, 1, -1, 0},
+    {"S7", "G60.S7", 600, 1, -1, 0},
+    {"S8", "G60.S8", 600, 1, -1, 0},
+    {"G61", "G61", -1, 0, 611, 0},
+    {"S0", "G61.S0", 610, 1, -1, 0},
+    {"S1", "G61.S1", 610, 1, -1, 0},
+    {"S2", "G61.S2", 610, 1, -1, 0},
+    {"S3", "G61.S3", 610, 1, -1, 0},
+    {"S4", "G61.S4", 610, 1, -1, 0},
+    {"S5", "G61.S5", 610, 1, -1, 0},
+    {"S6", "G61.S6", 610, 1, -1, 0},
+    {"S7", "G61.S7", 610, 1, -1, 0},
+    {"S8", "G61.S8", 610, 1, -1, 0},
+    {"G62", "G62", -1, 0, 621, 0},
+    {"S0", "G62.S0", 620, 1, -1, 0},
+    {"S1", "G62.S1", 620, 1, -1, 0},
+    {"S2", "G62.S2", 620, 1, -1, 0},
+    {"S3", "G62.S3", 620, 1, -1, 0},
+    {"S4", "G62.S4", 620, 1, -1, 0},
+    {"S5", "G62.S5", 620, 1, -1, 0},
+    {"S6", "G62.S6", 620, 1, -1, 0},
+    {"S7", "G62.S7", 620, 1, -1, 0},
+    {"S8", "G62.S8", 620, 1, -1, 0},
+    {"G63", "G63", -1, 0, 631, 0},
+    {"S0", "G63.S0", 630, 1, -1, 0},
+    {"S1", "G63.S1", 630, 1, -1, 0},
+    {"S2", "G63.S2", 630, 1, -1, 0},
+    {"S3", "G63.S3", 630, 1, -1, 0},
+    {"S4", "G63.S4", 630, 1, -1, 0},
+    {"S5", "G63.S5", 630, 1, -1, 0},
+    {"S6", "G63.S6", 630, 1, -1, 0},
+    {"S7", "G63.S7", 630, 1, -1, 0},
+    {"S8", "G63.S8", 630, 1, -1, 0},
+    {"G64", "G64", -1, 0, 641, 0},
+    {"S0", "G64.S0", 640, 1, -1, 0},
+    {"S1", "G64.S1", 640, 1, -1, 0},
+    {"S2", "G64.S2", 640, 1, -1, 0},
+    {"S3", "G64.S3", 640, 1, -1, 0},
+    {"S4", "G64.S4", 640, 1, -1, 0},
+    {"S5", "G64.S5", 640, 1, -1, 0},
+    {"S6", "G64.S6", 640, 1, -1, 0},
+    {"S7", "G64.S7", 640, 1, -1, 0},
+    {"S8", "G64.S8", 640, 1, -1, 0},
+    {"G65", "G65", -1, 0, 651, 0},
+    {"S0", "G65.S0", 650, 1, -1, 0},
+    {"S1", "G65.S1", 650, 1, -1, 0},
+    {"S2", "G65.S2", 650, 1, -1, 0},
+    {"S3", "G65.S3", 650, 1, -1, 0},
+    {"S4", "G65.S4", 650, 1, -1, 0},
+    {"S5", "G65.S5", 650, 1, -1, 0},
+    {"S6", "G65.S6", 650, 1, -1, 0},
+    {"S7", "G65.S7", 650, 1, -1, 0},
+    {"S8", "G65.S8", 650, 1, -1, 0},
+    {"G66", "G66", -1, 0, 661, 0},
+    {"S0", "G66.S0", 660, 1, -1, 0},
+    {"S1", "G66.S1", 660, 1, -1, 0},
+    {"S2", "G66.S2", 660, 1, -1, 0},
+    {"S3", "G66.S3", 660, 1, -1, 0},
+    {"S4", "G66.S4", 660, 1, -1, 0},
+    {"S5", "G66.S5", 660, 1, -1, 0},
+    {"S6", "G66.S6", 660, 1, -1, 0},
+    {"S7", "G66.S7", 660, 1, -1, 0},
+    {"S8", "G66.S8", 660, 1, -1, 0},
+    {"G67", "G67", -1, 0, 671, 0},
+    {"S0", "G67.S0", 670, 1, -1, 0},
+    {"S1", "G67.S1", 670, 1, -1, 0},
+    {"S2", "G67.S2", 670, 1, -1, 0},
+    {"S3", "G67.S3", 670, 1, -1, 0},
+    {"S4", "G67.S4", 670, 1, -1, 0},
+    {"S5", "G67.S5", 670, 1, -1, 0},
+    {"S6", "G67.S6", 670, 1, -1, 0},
+    {"S7", "G67.S7", 670, 1, -1, 0},
+    {"S8", "G67.S8", 670, 1, -1, 0},
+    {"G68", "G68", -1, 0, 681, 0},
+    {"S0", "G68.S0", 680, 1, -1, 0},
+    {"S1", "G68.S1", 680, 1, -1, 0},
+    {"S2", "G68.S2", 680, 1, -1, 0},
+    {"S3", "G68.S3", 680, 1, -1, 0},
+    {"S4", "G68.S4", 680, 1, -1, 0},
+    {"S5", "G68.S5", 680, 1, -1, 0},
+    {"S6", "G68.S6", 680, 1, -1, 0},
+    {"S7", "G68.S7", 680, 1, -1, 0},
+    {"S8", "G68.S8", 680, 1, -1, 0},
+    {"G69", "G69", -1, 0, 691, 0},
+    {"S0", "G69.S0", 690, 1, -1, 0},
+    {"S1", "G69.S1", 690, 1, -1, 0},
+    {"S2", "G69.S2", 690, 1, -1, 0},
+    {"S3", "G69.S3", 690, 1, -1, 0},
+    {"S4", "G69.S4", 690, 1, -1, 0},
+    {"S5", "G69.S5", 690, 1, -1, 0},
+    {"S6", "G69.S6", 690, 1, -1, 0},
+    {"S7", "G69.S7", 690, 1, -1, 0},
+    {"S8", "G69.S8", 690, 1, -1, 0},
+    {"G70", "G70", -1, 0, 701, 0},
+    {"S0", "G70.S0", 700, 1, -1, 0},
+    {"S1", "G70.S1", 700, 1, -1, 0},
+    {"S2", "G70.S2", 700, 1, -1, 0},
+    {"S3", "G70.S3", 700, 1, -1, 0},
+    {"S4", "G70.S4", 700, 1, -1, 0},
+    {"S5", "G70.S5", 700, 1, -1, 0},
+    {"S6", "G70.S6", 700, 1, -1, 0},
+    {"S7", "G70.S7", 700, 1, -1, 0},
+    {"S8", "G70.S8", 700, 1, -1, 0},
+    {"G71", "G71", -1, 0, 711, 0},
+    {"S0", "G71.S0", 710, 1, -1, 0},
+    {"S1", "G71.S1", 710, 1, -1, 0},
+    {"S2", "G71.S2", 710, 1, -1, 0},
+    {"S3", "G71.S3", 710, 1, -1, 0},
+    {"S4", "G71.S4", 710, 1, -1, 0},
+    {"S5", "G71.S5", 710, 1, -1, 0},
+    {"S6", "G71.S6", 710, 1, -1, 0},
+    {"S7", "G71.S7", 710, 1, -1, 0},
+    {"S8", "G71.S8", 710, 1, -1, 0},
+    {"G72", "G72", -1, 0, 721, 0},
+    {"S0", "G72.S0", 720, 1, -1, 0},
+    {"S1", "G72.S1", 720, 1, -1, 0},
+    {"S2", "G72.S2", 720, 1, -1, 0},
+    {"S3", "G72.S3", 720, 1, -1, 0},
+    {"S4", "G72.S4", 720, 1, -1, 0},
+    {"S5", "G72.S5", 720, 1, -1, 0},
+    {"S6", "G72.S6", 720, 1, -1, 0},
+    {"S7", "G72.S7", 720, 1, -1, 0},
+    {"S8", "G72.S8", 720, 1, -1, 0},
+    {"G73", "G73", -1, 0, 731, 0},
+    {"S0", "G73.S0", 730, 1, -1, 0},
+    {"S1", "G73.S1", 730, 1, -1, 0},
+    {"S2", "G73.S2", 730, 1, -1, 0},
+    {"S3", "G73.S3", 730, 1, -1, 0},
+    {"S4", "G73.S4", 730, 1, -1, 0},
+    {"S5", "G73.S5", 730, 1, -1, 0},
+    {"S6", "G73.S6", 730, 1, -1, 0},
+    {"S7", "G73.S7", 730, 1, -1, 0},
+    {"S8", "G73.S8", 730, 1, -1, 0},
+    {"G74", "G74", -1, 0, 741, 0},
+    {"S0", "G74.S0", 740, 1, -1, 0},
+    {"S1", "G74.S1", 740, 1, -1, 0},
+    {"S2", "G74.S2", 740, 1, -1, 0},
+    {"S3", "G74.S3", 740, 1, -1, 0},
+    {"S4", "G74.S4", 740, 1, -1, 0},
+    {"S5", "G74.S5", 740, 1, -1, 0},
+    {"S6", "G74.S6", 740, 1, -1, 0},
+    {"S7", "G74.S7", 740, 1, -1, 0},
+    {"S8", "G74.S8", 740, 1, -1, 0},
+    {"G75", "G75", -1, 0, 751, 0},
+    {"S0", "G75.S0", 750, 1, -1, 0},
+    {"S1", "G75.S1", 750, 1, -1, 0},
+    {"S2", "G75.S2", 750, 1, -1, 0},
+    {"S3", "G75.S3", 750, 1, -1, 0},
+    {"S4", "G75.S4", 750, 1, -1, 0},
+    {"S5", "G75.S5", 750, 1, -1, 0},
+    {"S6", "G75.S6", 750, 1, -1, 0},
+    {"S7", "G75.S7", 750, 1, -1, 0},
+    {"S8", "G75.S8", 750, 1, -1, 0},
+    {"G76", "G76", -1, 0, 761, 0},
+    {"S0", "G76.S0", 760, 1, -1, 0},
+    {"S1", "G76.S1", 760, 1, -1, 0},
+    {"S2", "G76.S2", 760, 1, -1, 0},
+    {"S3", "G76.S3", 760, 1, -1, 0},
+    {"S4", "G76.S4", 760, 1, -1, 0},
+    {"S5", "G76.S5", 760, 1, -1, 0},
+    {"S6", "G76.S6", 760, 1, -1, 0},
+    {"S7", "G76.S7", 760, 1, -1, 0},
+    {"S8", "G76.S8", 760, 1, -1, 0},
+    {"G77", "G77", -1, 0, 771, 0},
+    {"S0", "G77.S0", 770, 1, -1, 0},
+    {"S1", "G77.S1", 770, 1, -1, 0},
+    {"S2", "G77.S2", 770, 1, -1, 0},
+    {"S3", "G77.S3", 770, 1, -1, 0},
+    {"S4", "G77.S4", 770, 1, -1, 0},
+    {"S5", "G77.S5", 770, 1, -1, 0},
+    {"S6", "G77.S6", 770, 1, -1, 0},
+    {"S7", "G77.S7", 770, 1, -1, 0},
+    {"S8", "G77.S8", 770, 1, -1, 0},
+    {"G78", "G78", -1, 0, 781, 0},
+    {"S0", "G78.S0", 780, 1, -1, 0},
+    {"S1", "G78.S1", 780, 1, -1, 0},
+    {"S2", "G78.S2", 780, 1, -1, 0},
+    {"S3", "G78.S3", 780, 1, -1, 0},
+    {"S4", "G78.S4", 780, 1, -1, 0},
+    {"S5", "G78.S5", 780, 1, -1, 0},
+    {"S6", "G78.S6", 780, 1, -1, 0},
+    {"S7", "G78.S7", 780, 1, -1, 0},
+    {"S8", "G78.S8", 780, 1, -1, 0},
+    {"G79", "G79", -1, 0, 791, 0},
+    {"S0", "G79.S0", 790, 1, -1, 0},
+    {"S1", "G79.S1", 790, 1, -1, 0},
+    {"S2", "G79.S2", 790, 1, -1, 0},
+    {"S3", "G79.S3", 790, 1, -1, 0},
+    {"S4", "G79.S4", 790, 1, -1, 0},
+    {"S5", "G79.S5", 790, 1, -1, 0},
+    {"S6", "G79.S6", 790, 1, -1, 0},
+    {"S7", "G79.S7", 790, 1, -1, 0},
+    {"S8", "G79.S8", 790, 1, -1, 0},
+    {"G80", "G80", -1, 0, 801, 0},
+    {"S0", "G80.S0", 800, 1, -1, 0},
+    {"S1", "G80.S1", 800, 1, -1, 0},
+    {"S2", "G80.S2", 800, 1, -1, 0},
+    {"S3", "G80.S3", 800, 1, -1, 0},
+    {"S4", "G80.S4", 800, 1, -1, 0},
+    {"S5", "G80.S5", 800, 1, -1, 0},
+    {"S6", "G80.S6", 800, 1, -1, 0},
+    {"S7", "G80.S7", 800, 1, -1, 0},
+    {"S8", "G80.S8", 800, 1, -1, 0},
+    {"G81", "G81", -1, 0, 811, 0},
+    {"S0", "G81.S0", 810, 1, -1, 0},
+    {"S1", "G81.S1", 810, 1, -1, 0},
+    {"S2", "G81.S2", 810, 1, -1, 0},
+    {"S3", "G81.S3", 810, 1, -1, 0},
+    {"S4", "G81.S4", 810, 1, -1, 0},
+    {"S5", "G81.S5", 810, 1, -1, 0},
+    {"S6", "G81.S6", 810, 1, -1, 0},
+    {"S7", "G81.S7", 810, 1, -1, 0},
+    {"S8", "G81.S8", 810, 1, -1, 0},
+    {"G82", "G82", -1, 0, 821, 0},
+    {"S0", "G82.S0", 820, 1, -1, 0},
+    {"S1", "G82.S1", 820, 1, -1, 0},
+    {"S2", "G82.S2", 820, 1, -1, 0},
+    {"S3", "G82.S3", 820, 1, -1, 0},
+    {"S4", "G82.S4", 820, 1, -1, 0},
+    {"S5", "G82.S5", 820, 1, -1, 0},
+    {"S6", "G82.S6", 820, 1, -1, 0},
+    {"S7", "G82.S7", 820, 1, -1, 0},
+    {"S8", "G82.S8", 820, 1, -1, 0},
+    {"G83", "G83", -1, 0, 831, 0},
+    {"S0", "G83.S0", 830, 1, -1, 0},
+    {"S1", "G83.S1", 830, 1, -1, 0},
+    {"S2", "G83.S2", 830, 1, -1, 0},
+    {"S3", "G83.S3", 830, 1, -1, 0},
+    {"S4", "G83.S4", 830, 1, -1, 0},
+    {"S5", "G83.S5", 830, 1, -1, 0},
+    {"S6", "G83.S6", 830, 1, -1, 0},
+    {"S7", "G83.S7", 830, 1, -1, 0},
+    {"S8", "G83.S8", 830, 1, -1, 0},
+    {"G84", "G84", -1, 0, 841, 0},
+    {"S0", "G84.S0", 840, 1, -1, 0},
+    {"S1", "G84.S1", 840, 1, -1, 0},
+    {"S2", "G84.S2", 840, 1, -1, 0},
+    {"S3", "G84.S3", 840, 1, -1, 0},
+    {"S4", "G84.S4", 840, 1, -1, 0},
+    {"S5", "G84.S5", 840, 1, -1, 0},
+    {"S6", "G84.S6", 840, 1, -1, 0},
+    {"S7", "G84.S7", 840, 1, -1, 0},
+    {"S8", "G84.S8", 840, 1, -1, 0},
+    {"G85", "G85", -1, 0, 851, 0},
+    {"S0", "G85.S0", 850, 1, -1, 0},
+    {"S1", "G85.S1", 850, 1, -1, 0},
+    {"S2", "G85.S2", 850, 1, -1, 0},
+    {"S3", "G85.S3", 850, 1, -1, 0},
+    {"S4", "G85.S4", 850, 1, -1, 0},
+    {"S5", "G85.S5", 850, 1, -1, 0},
+    {"S6", "G85.S6", 850, 1, -1, 0},
+    {"S7", "G85.S7", 850, 1, -1, 0},
+    {"S8", "G85.S8", 850, 1, -1, 0},
+    {"G86", "G86", -1, 0, 861, 0},
+    {"S0", "G86.S0", 860, 1, -1, 0},
+    {"S1", "G86.S1", 860, 1, -1, 0},
+    {"S2", "G86.S2", 860, 1, -1, 0},
+    {"S3", "G86.S3", 860, 1, -1, 0},
+    {"S4", "G86.S4", 860, 1, -1, 0},
+    {"S5", "G86.S5", 860, 1, -1, 0},
+    {"S6", "G86.S6", 860, 1, -1, 0},
+    {"S7", "G86.S7", 860, 1, -1, 0},
+    {"S8", "G86.S8", 860, 1, -1, 0},
+    {"G87", "G87", -1, 0, 871, 0},
+    {"S0", "G87.S0", 870, 1, -1, 0},
+    {"S1", "G87.S1", 870, 1, -1, 0},
+    {"S2", "G87.S2", 870, 1, -1, 0},
+    {"S3", "G87.S3", 870, 1, -1, 0},
+    {"S4", "G87.S4", 870, 1, -1, 0},
+    {"S5", "G87.S5", 870, 1, -1, 0},
+    {"S6", "G87.S6", 870, 1, -1, 0},
+    {"S7", "G87.S7", 870, 1, -1, 0},
+    {"S8", "G87.S8", 870, 1, -1, 0},
+    {"G88", "G88", -1, 0, 881, 0},
+    {"S0", "G88.S0", 880, 1, -1, 0},
+    {"S1", "G88.S1", 880, 1, -1, 0},
+    {"S2", "G88.S2", 880, 1, -1, 0},
+    {"S3", "G88.S3", 880, 1, -1, 0},
+    {"S4", "G88.S4", 880, 1, -1, 0},
+    {"S5", "G88.S5", 880, 1, -1, 0},
+    {"S6", "G88.S6", 880, 1, -1, 0},
+    {"S7", "G88.S7", 880, 1, -1, 0},
+    {"S8", "G88.S8", 880, 1, -1, 0},
+    {"G89", "G89", -1, 0, 891, 0},
+    {"S0", "G89.S0", 890, 1, -1, 0},
+    {"S1", "G89.S1", 890, 1, -1, 0},
+    {"S2", "G89.S2", 890, 1, -1, 0},
+    {"S3", "G89.S3", 890, 1, -1, 0},
+    {"S4", "G89.S4", 890, 1, -1, 0},
+    {"S5", "G89.S5", 890, 1, -1, 0},
+    {"S6", "G89.S6", 890, 1, -1, 0},
+    {"S7", "G89.S7", 890, 1, -1, 0},
+    {"S8", "G89.S8", 890, 1, -1, 0},
+    {"G90", "G90", -1, 0, 901, 0},
+    {"S0", "G90.S0", 900, 1, -1, 0},
+    {"S1", "G90.S1", 900, 1, -1, 0},
+    {"S2", "G90.S2", 900, 1, -1, 0},
+    {"S3", "G90.S3", 900, 1, -1, 0},
+    {"S4", "G90.S4", 900, 1, -1, 0},
+    {"S5", "G90.S5", 900, 1, -1, 0},
+    {"S6", "G90.S6", 900, 1, -1, 0},
+    {"S7", "G90.S7", 900, 1, -1, 0},
+    {"S8", "G90.S8", 900, 1, -1, 0},
+    {"G91", "G91", -1, 0, 911, 0},
+    {"S0", "G91.S0", 910, 1, -1, 0},
+    {"S1", "G91.S1", 910, 1, -1, 0},
+    {"S2", "G91.S2", 910, 1, -1, 0},
+    {"S3", "G91.S3", 910, 1, -1, 0},
+    {"S4", "G91.S4", 910, 1, -1, 0},
+    {"S5", "G91.S5", 910, 1, -1, 0},
+    {"S6", "G91.S6", 910, 1, -1, 0},
+    {"S7", "G91.S7", 910, 1, -1, 0},
+    {"S8", "G91.S8", 910, 1, -1, 0},
+    {"G92", "G92", -1, 0, 921, 0},
+    {"S0", "G92.S0", 920, 1, -1, 0},
+    {"S1", "G92.S1", 920, 1, -1, 0},
+    {"S2", "G92.S2", 920, 1, -1, 0},
+    {"S3", "G92.S3", 920, 1, -1, 0},
+    {"S4", "G92.S4", 920, 1, -1, 0},
+    {"S5", "G92.S5", 920, 1, -1, 0},
+    {"S6", "G92.S6", 920, 1, -1, 0},
+    {"S7", "G92.S7", 920, 1, -1, 0},
+    {"S8", "G92.S8", 920, 1, -1, 0},
+    {"G93", "G93", -1, 0, 931, 0},
+    {"S0", "G93.S0", 930, 1, -1, 0},
+    {"S1", "G93.S1", 930, 1, -1, 0},
+    {"S2", "G93.S2", 930, 1, -1, 0},
+    {"S3", "G93.S3", 930, 1, -1, 0},
+    {"S4", "G93.S4", 930, 1, -1, 0},
+    {"S5", "G93.S5", 930, 1, -1, 0},
+    {"S6", "G93.S6", 930, 1, -1, 0},
+    {"S7", "G93.S7", 930, 1, -1, 0},
+    {"S8", "G93.S8", 930, 1, -1, 0},
+    {"G94", "G94", -1, 0, 941, 0},
+    {"S0", "G94.S0", 940, 1, -1, 0},
+    {"S1", "G94.S1", 940, 1, -1, 0},
+    {"S2", "G94.S2", 940, 1, -1, 0},
+    {"S3", "G94.S3", 940, 1, -1, 0},
+    {"S4", "G94.S4", 940, 1, -1, 0},
+    {"S5", "G94.S5", 940, 1, -1, 0},
+    {"S6", "G94.S6", 940, 1, -1, 0},
+    {"S7", "G94.S7", 940, 1, -1, 0},
+    {"S8", "G94.S8", 940, 1, -1, 0},
+    {"G95", "G95", -1, 0, 951, 0},
+    {"S0", "G95.S0", 950, 1, -1, 0},
+    {"S1", "G95.S1", 950, 1, -1, 0},
+    {"S2", "G95.S2", 950, 1, -1, 0},
+    {"S3", "G95.S3", 950, 1, -1, 0},
+    {"S4", "G95.S4", 950, 1, -1, 0},
+    {"S5", "G95.S5", 950, 1, -1, 0},
+    {"S6", "G95.S6", 950, 1, -1, 0},
+    {"S7", "G95.S7", 950, 1, -1, 0},
+    {"S8", "G95.S8", 950, 1, -1, 0},
+    {"G96", "G96", -1, 0, 961, 0},
+    {"S0", "G96.S0", 960, 1, -1, 0},
+    {"S1", "G96.S1", 960, 1, -1, 0},
+    {"S2", "G96.S2", 960, 1, -1, 0},
+    {"S3", "G96.S3", 960, 1, -1, 0},
+    {"S4", "G96.S4", 960, 1, -1, 0},
+    {"S5", "G96.S5", 960, 1, -1, 0},
+    {"S6", "G96.S6", 960, 1, -1, 0},
+    {"S7", "G96.S7", 960, 1, -1, 0},
+    {"S8", "G96.S8", 960, 1, -1, 0},
+    {"G97", "G97", -1, 0, 971, 0},
+    {"S0", "G97.S0", 970, 1, -1, 0},
+    {"S1", "G97.S1", 970, 1, -1, 0},
+    {"S2", "G97.S2", 970, 1, -1, 0},
+    {"S3", "G97.S3", 970, 1, -1, 0},
+    {"S4", "G97.S4", 970, 1, -1, 0},
+    {"S5", "G97.S5", 970, 1, -1, 0},
+    {"S6", "G97.S6", 970, 1, -1, 0},
+    {"S7", "G97.S7", 970, 1, -1, 0},
+    {"S8", "G97.S8", 970, 1, -1, 0},
+    {"G98", "G98", -1, 0, 981, 0},
+    {"S0", "G98.S0", 980, 1, -1, 0},
+    {"S1", "G98.S1", 980, 1, -1, 0},
+    {"S2", "G98.S2", 980, 1, -1, 0},
+    {"S3", "G98.S3", 980, 1, -1, 0},
+    {"S4", "G98.S4", 980, 1, -1, 0},
+    {"S5", "G98.S5", 980, 1, -1, 0},
+    {"S6", "G98.S6", 980, 1, -1, 0},
+    {"S7", "G98.S7", 980, 1, -1, 0},
+    {"S8", "G98.S8", 980, 1, -1, 0},
+    {"G99", "G99", -1, 0, 991, 0},
+    {"S0", "G99.S0", 990, 1, -1, 0},
+    {"S1", "G99.S1", 990, 1, -1, 0},
+    {"S2", "G99.S2", 990, 1, -1, 0},
+    {"S3", "G99.S3", 990, 1, -1, 0},
+    {"S4", "G99.S4", 990, 1, -1, 0},
+    {"S5", "G99.S5", 990, 1, -1, 0},
+    {"S6", "G99.S6", 990, 1, -1, 0},
+    {"S7", "G99.S7", 990, 1, -1, 0},
+    {"S8", "G99.S8", 990, 1, -1, 0},
+};
+
+static const char *event_names[] = {
+    "Reset",
+    "Next",
+    "E0",
+    "E1",
+    "E2",
+    "E3",
+    "E4",
+    "E5",
+    "E6",
+    "E7",
+};
+
+const char *Synthetic_state_name(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].name;
+    return "UNKNOWN";
+}
+
+const char *Synthetic_state_path(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].full_path;
+    return "UNKNOWN";
+}
+
+const char *Synthetic_event_name(Synthetic_event_t event) {
+    if (event >= 0 && event < Synthetic_EVENT_COUNT) return event_names[event];
+    return "UNKNOWN";
+}
+
+int Synthetic_get_parent(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].parent;
+    return -1;
+}
+
+bool Synthetic_is_in(Synthetic_context_t *ctx, Synthetic_state_t state) {
+    Synthetic_state_t current = ctx->current_state;
+    while (current >= 0) {
+        if (current == state) return true;
+        current = (Synthetic_state_t)state_info[current].parent;
+    }
+    return false;
+}
+
+void Synthetic_init(Synthetic_context_t *ctx, void *user_data) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->user_data = user_data;
+    for (int i = 0; i < Synthetic_STATE_COUNT; i++) {
+        ctx->history[i] = (Synthetic_state_t)-1;
+    }
+    ctx->current_state = Synthetic_STATE_G0_S0;
+    enter_0_0(ctx); /* Entry action */
+}
+
+bool Synthetic_dispatch(Synthetic_context_t *ctx, Synthetic_event_t event) {
+    /* Check current state and ancestors for handler */
+    Synthetic_state_t check = ctx->current_state;
+    while (check >= 0) {
+        switch (check) {
+        case Synthetic_STATE_G0:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S1;
+                enter_0_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S3;
+                enter_0_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S2;
+                enter_0_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S4;
+                enter_0_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S3;
+                enter_0_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S5;
+                enter_0_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S4;
+                enter_0_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S6;
+                enter_0_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S5;
+                enter_0_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S7;
+                enter_0_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S6;
+                enter_0_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S8;
+                enter_0_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S7;
+                enter_0_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S0;
+                enter_0_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S8;
+                enter_0_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S1;
+                enter_0_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S0;
+                enter_1_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S2;
+                enter_0_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S1;
+                enter_1_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S3;
+                enter_1_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S2;
+                enter_1_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S4;
+                enter_1_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S3;
+                enter_1_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S5;
+                enter_1_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S4;
+                enter_1_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S6;
+                enter_1_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S5;
+                enter_1_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S7;
+                enter_1_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S6;
+                enter_1_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S8;
+                enter_1_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S7;
+                enter_1_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S0;
+                enter_1_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S8;
+                enter_1_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S1;
+                enter_1_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S0;
+                enter_2_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S2;
+                enter_1_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S1;
+                enter_2_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S3;
+                enter_2_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S2;
+                enter_2_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S4;
+                enter_2_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S3;
+                enter_2_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S5;
+                enter_2_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S4;
+                enter_2_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S6;
+                enter_2_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S5;
+                enter_2_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S7;
+                enter_2_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S6;
+                enter_2_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S8;
+                enter_2_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S7;
+                enter_2_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S0;
+                enter_2_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S8;
+                enter_2_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S1;
+                enter_2_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S0;
+                enter_3_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S2;
+                enter_2_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S1;
+                enter_3_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S3;
+                enter_3_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S2;
+                enter_3_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S4;
+                enter_3_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S3;
+                enter_3_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S5;
+                enter_3_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S4;
+                enter_3_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S6;
+                enter_3_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S5;
+                enter_3_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S7;
+                enter_3_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S6;
+                enter_3_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S8;
+                enter_3_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S7;
+                enter_3_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S0;
+                enter_3_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S8;
+                enter_3_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S1;
+                enter_3_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S0;
+                enter_4_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S2;
+                enter_3_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S1;
+                enter_4_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S3;
+                enter_4_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S2;
+                enter_4_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S4;
+                enter_4_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S3;
+                enter_4_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S5;
+                enter_4_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S4;
+                enter_4_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S6;
+                enter_4_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S5;
+                enter_4_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S7;
+                enter_4_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S6;
+                enter_4_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S8;
+                enter_4_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S7;
+                enter_4_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S0;
+                enter_4_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S8;
+                enter_4_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S1;
+                enter_4_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S0;
+                enter_5_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S2;
+                enter_4_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S1;
+                enter_5_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S3;
+                enter_5_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S2;
+                enter_5_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S4;
+                enter_5_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S3;
+                enter_5_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S5;
+                enter_5_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S4;
+                enter_5_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S6;
+                enter_5_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S5;
+                enter_5_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S7;
+                enter_5_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S6;
+                enter_5_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S8;
+                enter_5_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S7;
+                enter_5_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S0;
+                enter_5_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S8;
+                enter_5_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S1;
+                enter_5_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S0;
+                enter_6_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S2;
+                enter_5_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S1;
+                enter_6_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S3;
+                enter_6_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S2;
+                enter_6_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S4;
+                enter_6_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S3;
+                enter_6_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S5;
+                enter_6_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S4;
+                enter_6_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S6;
+                enter_6_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S5;
+                enter_6_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S7;
+                enter_6_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S6;
+                enter_6_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S8;
+                enter_6_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S7;
+                enter_6_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S0;
+                enter_6_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S8;
+                enter_6_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S1;
+                enter_6_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S0;
+                enter_7_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S2;
+                enter_6_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S1;
+                enter_7_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S3;
+                enter_7_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S2;
+                enter_7_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S4;
+                enter_7_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S3;
+                enter_7_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S5;
+                enter_7_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S4;
+                enter_7_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S6;
+                enter_7_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S5;
+                enter_7_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S7;
+                enter_7_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S6;
+                enter_7_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S8;
+                enter_7_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S7;
+                enter_7_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S0;
+                enter_7_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S8;
+                enter_7_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S1;
+                enter_7_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S0;
+                enter_8_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S2;
+                enter_7_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S1;
+                enter_8_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S3;
+                enter_8_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S2;
+                enter_8_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S4;
+                enter_8_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S3;
+                enter_8_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S5;
+                enter_8_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S4;
+                enter_8_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S6;
+                enter_8_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S5;
+                enter_8_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S7;
+                enter_8_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S6;
+                enter_8_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S8;
+                enter_8_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S7;
+                enter_8_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S0;
+                enter_8_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S8;
+                enter_8_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S1;
+                enter_8_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S0;
+                enter_9_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S2;
+                enter_8_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S1;
+                enter_9_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S3;
+                enter_9_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S2;
+                enter_9_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S4;
+                enter_9_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S3;
+                enter_9_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S5;
+                enter_9_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S4;
+                enter_9_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S6;
+                enter_9_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S5;
+                enter_9_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S7;
+                enter_9_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S6;
+                enter_9_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S8;
+                enter_9_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S7;
+                enter_9_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S0;
+                enter_9_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S8;
+                enter_9_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S1;
+                enter_9_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S0;
+                enter_10_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S2;
+                enter_9_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S1;
+                enter_10_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S3;
+                enter_10_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S2;
+                enter_10_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S4;
+                enter_10_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S3;
+                enter_10_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S5;
+                enter_10_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S4;
+                enter_10_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S6;
+                enter_10_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S5;
+                enter_10_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S7;
+                enter_10_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S6;
+                enter_10_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S8;
+                enter_10_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S7;
+                enter_10_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S0;
+                enter_10_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S8;
+                enter_10_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S1;
+                enter_10_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S0;
+                enter_11_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S2;
+                enter_10_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S1;
+                enter_11_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S3;
+                enter_11_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S2;
+                enter_11_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S4;
+                enter_11_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S3;
+                enter_11_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S5;
+                enter_11_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S4;
+                enter_11_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S6;
+                enter_11_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S5;
+                enter_11_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S7;
+                enter_11_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S6;
+                enter_11_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S8;
+                enter_11_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S7;
+                enter_11_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S0;
+                enter_11_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S8;
+                enter_11_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S1;
+                enter_11_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S0;
+                enter_12_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S2;
+                enter_11_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S1;
+                enter_12_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S3;
+                enter_12_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S2;
+                enter_12_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S4;
+                enter_12_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S3;
+                enter_12_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S5;
+                enter_12_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S4;
+                enter_12_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S6;
+                enter_12_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S5;
+                enter_12_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S7;
+                enter_12_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S6;
+                enter_12_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S8;
+                enter_12_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S7;
+                enter_12_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S0;
+                enter_12_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S8;
+                enter_12_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S1;
+                enter_12_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S0;
+                enter_13_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S2;
+                enter_12_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S1;
+                enter_13_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S3;
+                enter_13_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S2;
+                enter_13_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S4;
+                enter_13_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S3;
+                enter_13_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S5;
+                enter_13_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S4;
+                enter_13_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S6;
+                enter_13_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S5;
+                enter_13_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S7;
+                enter_13_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S6;
+                enter_13_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S8;
+                enter_13_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S7;
+                enter_13_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S0;
+                enter_13_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S8;
+                enter_13_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S1;
+                enter_13_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S0;
+                enter_14_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S2;
+                enter_13_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S1;
+                enter_14_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S3;
+                enter_14_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S2;
+                enter_14_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S4;
+                enter_14_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S3;
+                enter_14_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S5;
+                enter_14_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S4;
+                enter_14_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S6;
+                enter_14_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S5;
+                enter_14_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S7;
+                enter_14_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S6;
+                enter_14_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S8;
+                enter_14_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S7;
+                enter_14_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S0;
+                enter_14_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S8;
+                enter_14_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S1;
+                enter_14_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S0;
+                enter_15_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S2;
+                enter_14_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S1;
+                enter_15_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S3;
+                enter_15_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S2;
+                enter_15_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S4;
+                enter_15_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S3;
+                enter_15_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S5;
+                enter_15_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S4;
+                enter_15_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S6;
+                enter_15_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S5;
+                enter_15_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S7;
+                enter_15_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S6;
+                enter_15_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S8;
+                enter_15_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S7;
+                enter_15_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S0;
+                enter_15_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S8;
+                enter_15_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S1;
+                enter_15_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S0;
+                enter_16_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S2;
+                enter_15_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S1;
+                enter_16_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S3;
+                enter_16_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S2;
+                enter_16_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S4;
+                enter_16_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S3;
+                enter_16_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S5;
+                enter_16_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S4;
+                enter_16_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S6;
+                enter_16_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S5;
+                enter_16_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S7;
+                enter_16_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S6;
+                enter_16_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S8;
+                enter_16_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S7;
+                enter_16_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S0;
+                enter_16_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S8;
+                enter_16_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S1;
+                enter_16_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S0;
+                enter_17_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S2;
+                enter_16_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S1;
+                enter_17_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S3;
+                enter_17_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S2;
+                enter_17_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S4;
+                enter_17_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S3;
+                enter_17_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S5;
+                enter_17_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S4;
+                enter_17_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S6;
+                enter_17_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S5;
+                enter_17_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S7;
+                enter_17_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S6;
+                enter_17_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S8;
+                enter_17_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S7;
+                enter_17_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S0;
+                enter_17_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S8;
+                enter_17_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S1;
+                enter_17_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S0;
+                enter_18_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S2;
+                enter_17_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S1;
+                enter_18_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S3;
+                enter_18_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S2;
+                enter_18_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S4;
+                enter_18_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S3;
+                enter_18_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S5;
+                enter_18_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S4;
+                enter_18_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S6;
+                enter_18_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S5;
+                enter_18_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S7;
+                enter_18_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S6;
+                enter_18_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S8;
+                enter_18_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S7;
+                enter_18_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S0;
+                enter_18_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S8;
+                enter_18_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S1;
+                enter_18_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S0;
+                enter_19_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S2;
+                enter_18_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S1;
+                enter_19_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S3;
+                enter_19_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S2;
+                enter_19_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S4;
+                enter_19_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S3;
+                enter_19_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S5;
+                enter_19_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S4;
+                enter_19_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S6;
+                enter_19_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S5;
+                enter_19_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S7;
+                enter_19_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S6;
+                enter_19_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S8;
+                enter_19_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S7;
+                enter_19_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S0;
+                enter_19_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S8;
+                enter_19_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S1;
+                enter_19_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S0;
+                enter_20_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S2;
+                enter_19_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S1;
+                enter_20_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S3;
+                enter_20_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S2;
+                enter_20_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S4;
+                enter_20_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S3;
+                enter_20_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S5;
+                enter_20_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S4;
+                enter_20_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S6;
+                enter_20_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S5;
+                enter_20_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S7;
+                enter_20_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S6;
+                enter_20_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S8;
+                enter_20_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S7;
+                enter_20_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S0;
+                enter_20_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S8;
+                enter_20_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S1;
+                enter_20_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S0;
+                enter_21_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S2;
+                enter_20_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S1;
+                enter_21_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S3;
+                enter_21_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S2;
+                enter_21_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S4;
+                enter_21_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S3;
+                enter_21_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S5;
+                enter_21_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S4;
+                enter_21_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S6;
+                enter_21_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S5;
+                enter_21_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S7;
+                enter_21_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S6;
+                enter_21_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S8;
+                enter_21_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S7;
+                enter_21_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S0;
+                enter_21_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S8;
+                enter_21_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S1;
+                enter_21_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S0;
+                enter_22_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S2;
+                enter_21_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S1;
+                enter_22_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S3;
+                enter_22_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S2;
+                enter_22_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S4;
+                enter_22_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S3;
+                enter_22_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S5;
+                enter_22_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S4;
+                enter_22_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S6;
+                enter_22_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S5;
+                enter_22_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S7;
+                enter_22_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S6;
+                enter_22_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S8;
+                enter_22_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S7;
+                enter_22_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S0;
+                enter_22_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S8;
+                enter_22_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S1;
+                enter_22_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S0;
+                enter_23_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S2;
+                enter_22_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S1;
+                enter_23_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S3;
+                enter_23_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S2;
+                enter_23_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S4;
+                enter_23_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S3;
+                enter_23_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S5;
+                enter_23_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S4;
+                enter_23_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S6;
+                enter_23_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S5;
+                enter_23_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S7;
+                enter_23_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S6;
+                enter_23_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S8;
+                enter_23_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S7;
+                enter_23_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S0;
+                enter_23_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S8;
+                enter_23_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S1;
+                enter_23_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S0;
+                enter_24_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S2;
+                enter_23_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S1;
+                enter_24_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S3;
+                enter_24_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S2;
+                enter_24_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S4;
+                enter_24_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S3;
+                enter_24_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S5;
+                enter_24_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S4;
+                enter_24_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S6;
+                enter_24_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S5;
+                enter_24_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S7;
+                enter_24_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S6;
+                enter_24_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S8;
+                enter_24_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S7;
+                enter_24_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S0;
+                enter_24_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S8;
+                enter_24_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S1;
+                enter_24_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S0;
+                enter_25_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S2;
+                enter_24_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S1;
+                enter_25_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S3;
+                enter_25_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S2;
+                enter_25_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S4;
+                enter_25_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S3;
+                enter_25_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S5;
+                enter_25_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S4;
+                enter_25_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S6;
+                enter_25_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S5;
+                enter_25_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S7;
+                enter_25_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S6;
+                enter_25_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S8;
+                enter_25_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S7;
+                enter_25_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S0;
+                enter_25_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S8;
+                enter_25_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S1;
+                enter_25_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G25_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S0;
+                enter_26_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[250] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G25_S2;
+                enter_25_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S1;
+                enter_26_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S3;
+                enter_26_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S2;
+                enter_26_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S4;
+                enter_26_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S3;
+                enter_26_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S5;
+                enter_26_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S4;
+                enter_26_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S6;
+                enter_26_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S5;
+                enter_26_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S7;
+                enter_26_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S6;
+                enter_26_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S8;
+                enter_26_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S7;
+                enter_26_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S0;
+                enter_26_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S8;
+                enter_26_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S1;
+                enter_26_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G26_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S0;
+                enter_27_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[260] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G26_S2;
+                enter_26_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S1;
+                enter_27_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S3;
+                enter_27_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S2;
+                enter_27_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S4;
+                enter_27_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S3;
+                enter_27_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S5;
+                enter_27_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S4;
+                enter_27_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S6;
+                enter_27_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S5;
+                enter_27_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S7;
+                enter_27_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S6;
+                enter_27_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S8;
+                enter_27_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S7;
+                enter_27_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S0;
+                enter_27_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S8;
+                enter_27_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S1;
+                enter_27_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G27_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S0;
+                enter_28_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[270] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G27_S2;
+                enter_27_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S1;
+                enter_28_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S3;
+                enter_28_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S2;
+                enter_28_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S4;
+                enter_28_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S3;
+                enter_28_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S5;
+                enter_28_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S4;
+                enter_28_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S6;
+                enter_28_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S5;
+                enter_28_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S7;
+                enter_28_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S6;
+                enter_28_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S8;
+                enter_28_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S7;
+                enter_28_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S0;
+                enter_28_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S8;
+                enter_28_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S1;
+                enter_28_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G28_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S0;
+                enter_29_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[280] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G28_S2;
+                enter_28_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S1;
+                enter_29_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S3;
+                enter_29_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S2;
+                enter_29_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S4;
+                enter_29_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S3;
+                enter_29_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S5;
+                enter_29_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S4;
+                enter_29_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S6;
+                enter_29_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S5;
+                enter_29_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S7;
+                enter_29_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S6;
+                enter_29_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S8;
+                enter_29_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S7;
+                enter_29_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S0;
+                enter_29_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S8;
+                enter_29_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S1;
+                enter_29_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G29_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S0;
+                enter_30_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[290] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G29_S2;
+                enter_29_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S1;
+                enter_30_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S3;
+                enter_30_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S2;
+                enter_30_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S4;
+                enter_30_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S3;
+                enter_30_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S5;
+                enter_30_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S4;
+                enter_30_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S6;
+                enter_30_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S5;
+                enter_30_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S7;
+                enter_30_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S6;
+                enter_30_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S8;
+                enter_30_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S7;
+                enter_30_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S0;
+                enter_30_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S8;
+                enter_30_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S1;
+                enter_30_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G30_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S0;
+                enter_31_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[300] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G30_S2;
+                enter_30_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S1;
+                enter_31_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S3;
+                enter_31_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S2;
+                enter_31_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S4;
+                enter_31_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S3;
+                enter_31_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S5;
+                enter_31_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S4;
+                enter_31_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S6;
+                enter_31_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S5;
+                enter_31_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S7;
+                enter_31_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S6;
+                enter_31_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S8;
+                enter_31_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S7;
+                enter_31_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S0;
+                enter_31_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S8;
+                enter_31_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S1;
+                enter_31_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G31_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S0;
+                enter_32_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[310] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G31_S2;
+                enter_31_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S1;
+                enter_32_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S3;
+                enter_32_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S2;
+                enter_32_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S4;
+                enter_32_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S3;
+                enter_32_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S5;
+                enter_32_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S4;
+                enter_32_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S6;
+                enter_32_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S5;
+                enter_32_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S7;
+                enter_32_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S6;
+                enter_32_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S8;
+                enter_32_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S7;
+                enter_32_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S0;
+                enter_32_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S8;
+                enter_32_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S1;
+                enter_32_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G32_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S0;
+                enter_33_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[320] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G32_S2;
+                enter_32_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S1;
+                enter_33_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S3;
+                enter_33_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S2;
+                enter_33_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S4;
+                enter_33_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S3;
+                enter_33_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S5;
+                enter_33_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S4;
+                enter_33_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S6;
+                enter_33_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S5;
+                enter_33_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S7;
+                enter_33_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S6;
+                enter_33_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S8;
+                enter_33_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S7;
+                enter_33_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S0;
+                enter_33_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S8;
+                enter_33_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S1;
+                enter_33_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G33_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S0;
+                enter_34_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[330] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G33_S2;
+                enter_33_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S1;
+                enter_34_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S3;
+                enter_34_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S2;
+                enter_34_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S4;
+                enter_34_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S3;
+                enter_34_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S5;
+                enter_34_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S4;
+                enter_34_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S6;
+                enter_34_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S5;
+                enter_34_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S7;
+                enter_34_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S6;
+                enter_34_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S8;
+                enter_34_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S7;
+                enter_34_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S0;
+                enter_34_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S8;
+                enter_34_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S1;
+                enter_34_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G34_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S0;
+                enter_35_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[340] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G34_S2;
+                enter_34_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S1;
+                enter_35_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S3;
+                enter_35_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S2;
+                enter_35_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S4;
+                enter_35_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S3;
+                enter_35_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S5;
+                enter_35_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S4;
+                enter_35_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S6;
+                enter_35_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S5;
+                enter_35_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S7;
+                enter_35_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S6;
+                enter_35_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S8;
+                enter_35_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S7;
+                enter_35_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S0;
+                enter_35_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S8;
+                enter_35_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S1;
+                enter_35_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G35_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S0;
+                enter_36_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[350] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G35_S2;
+                enter_35_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S1;
+                enter_36_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S3;
+                enter_36_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S2;
+                enter_36_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S4;
+                enter_36_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S3;
+                enter_36_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S5;
+                enter_36_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S4;
+                enter_36_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S6;
+                enter_36_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S5;
+                enter_36_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S7;
+                enter_36_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S6;
+                enter_36_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S8;
+                enter_36_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S7;
+                enter_36_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S0;
+                enter_36_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S8;
+                enter_36_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S1;
+                enter_36_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G36_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S0;
+                enter_37_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[360] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G36_S2;
+                enter_36_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S1;
+                enter_37_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S3;
+                enter_37_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S2;
+                enter_37_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S4;
+                enter_37_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S3;
+                enter_37_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S5;
+                enter_37_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S4;
+                enter_37_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S6;
+                enter_37_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S5;
+                enter_37_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S7;
+                enter_37_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S6;
+                enter_37_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S8;
+                enter_37_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S7;
+                enter_37_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S0;
+                enter_37_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S8;
+                enter_37_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S1;
+                enter_37_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G37_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S0;
+                enter_38_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[370] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G37_S2;
+                enter_37_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S1;
+                enter_38_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S3;
+                enter_38_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S2;
+                enter_38_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S4;
+                enter_38_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S3;
+                enter_38_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S5;
+                enter_38_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S4;
+                enter_38_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S6;
+                enter_38_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S5;
+                enter_38_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S7;
+                enter_38_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S6;
+                enter_38_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S8;
+                enter_38_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S7;
+                enter_38_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S0;
+                enter_38_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S8;
+                enter_38_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S1;
+                enter_38_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G38_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S0;
+                enter_39_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[380] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G38_S2;
+                enter_38_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S1;
+                enter_39_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S3;
+                enter_39_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S2;
+                enter_39_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S4;
+                enter_39_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S3;
+                enter_39_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S5;
+                enter_39_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S4;
+                enter_39_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S6;
+                enter_39_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S5;
+                enter_39_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S7;
+                enter_39_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S6;
+                enter_39_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S8;
+                enter_39_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S7;
+                enter_39_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S0;
+                enter_39_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S8;
+                enter_39_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S1;
+                enter_39_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G39_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S0;
+                enter_40_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[390] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G39_S2;
+                enter_39_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S1;
+                enter_40_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S3;
+                enter_40_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S2;
+                enter_40_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S4;
+                enter_40_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S3;
+                enter_40_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S5;
+                enter_40_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S4;
+                enter_40_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S6;
+                enter_40_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S5;
+                enter_40_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S7;
+                enter_40_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S6;
+                enter_40_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S8;
+                enter_40_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S7;
+                enter_40_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S0;
+                enter_40_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S8;
+                enter_40_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S1;
+                enter_40_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G40_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S0;
+                enter_41_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[400] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G40_S2;
+                enter_40_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S1;
+                enter_41_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S3;
+                enter_41_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S2;
+                enter_41_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S4;
+                enter_41_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S3;
+                enter_41_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S5;
+                enter_41_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S4;
+                enter_41_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S6;
+                enter_41_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S5;
+                enter_41_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S7;
+                enter_41_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S6;
+                enter_41_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S8;
+                enter_41_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S7;
+                enter_41_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S0;
+                enter_41_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S8;
+                enter_41_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S1;
+                enter_41_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G41_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S0;
+                enter_42_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[410] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G41_S2;
+                enter_41_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S1;
+                enter_42_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S3;
+                enter_42_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S2;
+                enter_42_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S4;
+                enter_42_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S3;
+                enter_42_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S5;
+                enter_42_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S4;
+                enter_42_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S6;
+                enter_42_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S5;
+                enter_42_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S7;
+                enter_42_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S6;
+                enter_42_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S8;
+                enter_42_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S7;
+                enter_42_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S0;
+                enter_42_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S8;
+                enter_42_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S1;
+                enter_42_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G42_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S0;
+                enter_43_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[420] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G42_S2;
+                enter_42_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S1;
+                enter_43_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S3;
+                enter_43_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S2;
+                enter_43_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S4;
+                enter_43_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S3;
+                enter_43_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S5;
+                enter_43_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S4;
+                enter_43_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S6;
+                enter_43_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S5;
+                enter_43_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S7;
+                enter_43_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S6;
+                enter_43_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S8;
+                enter_43_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S7;
+                enter_43_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S0;
+                enter_43_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S8;
+                enter_43_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S1;
+                enter_43_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G43_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S0;
+                enter_44_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[430] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G43_S2;
+                enter_43_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S1;
+                enter_44_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S3;
+                enter_44_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S2;
+                enter_44_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S4;
+                enter_44_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S3;
+                enter_44_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S5;
+                enter_44_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S4;
+                enter_44_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S6;
+                enter_44_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S5;
+                enter_44_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S7;
+                enter_44_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S6;
+                enter_44_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S8;
+                enter_44_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S7;
+                enter_44_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S0;
+                enter_44_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S8;
+                enter_44_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S1;
+                enter_44_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G44_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S0;
+                enter_45_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[440] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G44_S2;
+                enter_44_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S1;
+                enter_45_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S3;
+                enter_45_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S2;
+                enter_45_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S4;
+                enter_45_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S3;
+                enter_45_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S5;
+                enter_45_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S4;
+                enter_45_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S6;
+                enter_45_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S5;
+                enter_45_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S7;
+                enter_45_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S6;
+                enter_45_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S8;
+                enter_45_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S7;
+                enter_45_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S0;
+                enter_45_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S8;
+                enter_45_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S1;
+                enter_45_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G45_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S0;
+                enter_46_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[450] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G45_S2;
+                enter_45_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S1;
+                enter_46_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S3;
+                enter_46_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S2;
+                enter_46_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S4;
+                enter_46_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S3;
+                enter_46_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S5;
+                enter_46_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S4;
+                enter_46_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S6;
+                enter_46_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S5;
+                enter_46_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S7;
+                enter_46_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S6;
+                enter_46_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S8;
+                enter_46_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S7;
+                enter_46_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S0;
+                enter_46_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S8;
+                enter_46_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S1;
+                enter_46_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G46_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S0;
+                enter_47_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[460] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G46_S2;
+                enter_46_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S1;
+                enter_47_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S3;
+                enter_47_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S2;
+                enter_47_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S4;
+                enter_47_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S3;
+                enter_47_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S5;
+                enter_47_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S4;
+                enter_47_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S6;
+                enter_47_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S5;
+                enter_47_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S7;
+                enter_47_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S6;
+                enter_47_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S8;
+                enter_47_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S7;
+                enter_47_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S0;
+                enter_47_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S8;
+                enter_47_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S1;
+                enter_47_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G47_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S0;
+                enter_48_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[470] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G47_S2;
+                enter_47_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S1;
+                enter_48_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S3;
+                enter_48_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S2;
+                enter_48_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S4;
+                enter_48_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S3;
+                enter_48_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S5;
+                enter_48_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S4;
+                enter_48_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S6;
+                enter_48_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S5;
+                enter_48_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S7;
+                enter_48_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S6;
+                enter_48_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S8;
+                enter_48_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S7;
+                enter_48_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S0;
+                enter_48_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S8;
+                enter_48_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S1;
+                enter_48_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G48_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S0;
+                enter_49_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[480] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G48_S2;
+                enter_48_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S1;
+                enter_49_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S3;
+                enter_49_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S2;
+                enter_49_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S4;
+                enter_49_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S3;
+                enter_49_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S5;
+                enter_49_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S4;
+                enter_49_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S6;
+                enter_49_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S5;
+                enter_49_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S7;
+                enter_49_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S6;
+                enter_49_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S8;
+                enter_49_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S7;
+                enter_49_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S0;
+                enter_49_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S8;
+                enter_49_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S1;
+                enter_49_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G49_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S0;
+                enter_50_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[490] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G49_S2;
+                enter_49_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S1;
+                enter_50_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S3;
+                enter_50_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S2;
+                enter_50_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S4;
+                enter_50_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S3;
+                enter_50_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S5;
+                enter_50_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S4;
+                enter_50_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S6;
+                enter_50_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S5;
+                enter_50_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S7;
+                enter_50_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S6;
+                enter_50_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S8;
+                enter_50_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S7;
+                enter_50_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S0;
+                enter_50_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S8;
+                enter_50_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S1;
+                enter_50_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G50_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S0;
+                enter_51_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[500] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G50_S2;
+                enter_50_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S1;
+                enter_51_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S3;
+                enter_51_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S2;
+                enter_51_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S4;
+                enter_51_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S3;
+                enter_51_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S5;
+                enter_51_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S4;
+                enter_51_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S6;
+                enter_51_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S5;
+                enter_51_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S7;
+                enter_51_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S6;
+                enter_51_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S8;
+                enter_51_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S7;
+                enter_51_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S0;
+                enter_51_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S8;
+                enter_51_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S1;
+                enter_51_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G51_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S0;
+                enter_52_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[510] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G51_S2;
+                enter_51_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S1;
+                enter_52_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S3;
+                enter_52_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S2;
+                enter_52_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S4;
+                enter_52_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S3;
+                enter_52_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S5;
+                enter_52_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S4;
+                enter_52_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S6;
+                enter_52_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S5;
+                enter_52_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S7;
+                enter_52_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S6;
+                enter_52_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S8;
+                enter_52_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S7;
+                enter_52_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S0;
+                enter_52_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S8;
+                enter_52_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S1;
+                enter_52_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G52_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S0;
+                enter_53_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[520] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G52_S2;
+                enter_52_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S1;
+                enter_53_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S3;
+                enter_53_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S2;
+                enter_53_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S4;
+                enter_53_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S3;
+                enter_53_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S5;
+                enter_53_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S4;
+                enter_53_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S6;
+                enter_53_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S5;
+                enter_53_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S7;
+                enter_53_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S6;
+                enter_53_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S8;
+                enter_53_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S7;
+                enter_53_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S0;
+                enter_53_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S8;
+                enter_53_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S1;
+                enter_53_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G53_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S0;
+                enter_54_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[530] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G53_S2;
+                enter_53_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S1;
+                enter_54_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S3;
+                enter_54_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S2;
+                enter_54_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S4;
+                enter_54_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S3;
+                enter_54_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S5;
+                enter_54_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S4;
+                enter_54_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S6;
+                enter_54_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S5;
+                enter_54_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S7;
+                enter_54_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S6;
+                enter_54_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S8;
+                enter_54_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S7;
+                enter_54_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S0;
+                enter_54_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S8;
+                enter_54_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S1;
+                enter_54_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G54_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S0;
+                enter_55_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[540] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G54_S2;
+                enter_54_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S1;
+                enter_55_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S3;
+                enter_55_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S2;
+                enter_55_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S4;
+                enter_55_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S3;
+                enter_55_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S5;
+                enter_55_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S4;
+                enter_55_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S6;
+                enter_55_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S5;
+                enter_55_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S7;
+                enter_55_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S6;
+                enter_55_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S8;
+                enter_55_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S7;
+                enter_55_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S0;
+                enter_55_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S8;
+                enter_55_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S1;
+                enter_55_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G55_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S0;
+                enter_56_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[550] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G55_S2;
+                enter_55_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S1;
+                enter_56_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S3;
+                enter_56_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S2;
+                enter_56_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S4;
+                enter_56_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S3;
+                enter_56_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S5;
+                enter_56_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S4;
+                enter_56_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S6;
+                enter_56_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S5;
+                enter_56_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S7;
+                enter_56_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S6;
+                enter_56_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S8;
+                enter_56_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S7;
+                enter_56_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S0;
+                enter_56_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S8;
+                enter_56_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S1;
+                enter_56_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G56_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S0;
+                enter_57_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[560] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G56_S2;
+                enter_56_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S1;
+                enter_57_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S3;
+                enter_57_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S2;
+                enter_57_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S4;
+                enter_57_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S3;
+                enter_57_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S5;
+                enter_57_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S4;
+                enter_57_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S6;
+                enter_57_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S5;
+                enter_57_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S7;
+                enter_57_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S6;
+                enter_57_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S8;
+                enter_57_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S7;
+                enter_57_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S0;
+                enter_57_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S8;
+                enter_57_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S1;
+                enter_57_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G57_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S0;
+                enter_58_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[570] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G57_S2;
+                enter_57_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S1;
+                enter_58_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S3;
+                enter_58_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S2;
+                enter_58_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S4;
+                enter_58_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S3;
+                enter_58_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S5;
+                enter_58_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S4;
+                enter_58_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S6;
+                enter_58_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S5;
+                enter_58_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S7;
+                enter_58_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S6;
+                enter_58_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S8;
+                enter_58_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S7;
+                enter_58_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S0;
+                enter_58_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S8;
+                enter_58_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S1;
+                enter_58_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G58_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S0;
+                enter_59_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[580] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G58_S2;
+                enter_58_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S1;
+                enter_59_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S3;
+                enter_59_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S2;
+                enter_59_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S4;
+                enter_59_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S3;
+                enter_59_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S5;
+                enter_59_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S4;
+                enter_59_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S6;
+                enter_59_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S5;
+                enter_59_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S7;
+                enter_59_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S6;
+                enter_59_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S8;
+                enter_59_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S7;
+                enter_59_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S0;
+                enter_59_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S8;
+                enter_59_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S1;
+                enter_59_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G59_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S0;
+                enter_60_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[590] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G59_S2;
+                enter_59_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S1;
+                enter_60_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S3;
+                enter_60_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S2;
+                enter_60_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S4;
+                enter_60_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S3;
+                enter_60_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S5;
+                enter_60_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S4;
+                enter_60_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S6;
+                enter_60_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S5;
+                enter_60_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S7;
+                enter_60_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S6;
+                enter_60_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S8;
+                enter_60_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S7;
+                enter_60_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S0;
+                enter_60_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S8;
+                enter_60_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S1;
+                enter_60_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G60_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S0;
+                enter_61_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[600] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G60_S2;
+                enter_60_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S1;
+                enter_61_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S3;
+                enter_61_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S2;
+                enter_61_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S4;
+                enter_61_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S3;
+                enter_61_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S5;
+                enter_61_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S4;
+                enter_61_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S6;
+                enter_61_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S5;
+                enter_61_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S7;
+                enter_61_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S6;
+                enter_61_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S8;
+                enter_61_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S7;
+                enter_61_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S0;
+                enter_61_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S8;
+                enter_61_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S1;
+                enter_61_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G61_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S0;
+                enter_62_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[610] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G61_S2;
+                enter_61_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S1;
+                enter_62_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S3;
+                enter_62_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S2;
+                enter_62_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S4;
+                enter_62_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S3;
+                enter_62_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S5;
+                enter_62_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S4;
+                enter_62_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S6;
+                enter_62_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S5;
+                enter_62_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S7;
+                enter_62_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S6;
+                enter_62_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S8;
+                enter_62_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S7;
+                enter_62_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S0;
+                enter_62_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S8;
+                enter_62_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S1;
+                enter_62_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G62_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S0;
+                enter_63_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[620] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G62_S2;
+                enter_62_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S1;
+                enter_63_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S3;
+                enter_63_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S2;
+                enter_63_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S4;
+                enter_63_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S3;
+                enter_63_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S5;
+                enter_63_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S4;
+                enter_63_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S6;
+                enter_63_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S5;
+                enter_63_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S7;
+                enter_63_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S6;
+                enter_63_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S8;
+                enter_63_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S7;
+                enter_63_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S0;
+                enter_63_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S8;
+                enter_63_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S1;
+                enter_63_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G63_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S0;
+                enter_64_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[630] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G63_S2;
+                enter_63_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S1;
+                enter_64_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S3;
+                enter_64_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S2;
+                enter_64_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S4;
+                enter_64_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S3;
+                enter_64_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S5;
+                enter_64_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S4;
+                enter_64_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S6;
+                enter_64_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S5;
+                enter_64_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S7;
+                enter_64_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S6;
+                enter_64_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S8;
+                enter_64_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S7;
+                enter_64_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S0;
+                enter_64_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S8;
+                enter_64_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S1;
+                enter_64_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G64_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S0;
+                enter_65_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[640] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G64_S2;
+                enter_64_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S1;
+                enter_65_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S3;
+                enter_65_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S2;
+                enter_65_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S4;
+                enter_65_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S3;
+                enter_65_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S5;
+                enter_65_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S4;
+                enter_65_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S6;
+                enter_65_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S5;
+                enter_65_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S7;
+                enter_65_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S6;
+                enter_65_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S8;
+                enter_65_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S7;
+                enter_65_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S0;
+                enter_65_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S8;
+                enter_65_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S1;
+                enter_65_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G65_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S0;
+                enter_66_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[650] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G65_S2;
+                enter_65_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S1;
+                enter_66_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S3;
+                enter_66_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S2;
+                enter_66_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S4;
+                enter_66_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S3;
+                enter_66_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S5;
+                enter_66_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S4;
+                enter_66_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S6;
+                enter_66_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S5;
+                enter_66_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S7;
+                enter_66_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S6;
+                enter_66_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S8;
+                enter_66_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S7;
+                enter_66_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S0;
+                enter_66_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S8;
+                enter_66_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S1;
+                enter_66_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G66_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S0;
+                enter_67_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[660] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G66_S2;
+                enter_66_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S1;
+                enter_67_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S3;
+                enter_67_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S2;
+                enter_67_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S4;
+                enter_67_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S3;
+                enter_67_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S5;
+                enter_67_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S4;
+                enter_67_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S6;
+                enter_67_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S5;
+                enter_67_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S7;
+                enter_67_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S6;
+                enter_67_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S8;
+                enter_67_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S7;
+                enter_67_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S0;
+                enter_67_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S8;
+                enter_67_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S1;
+                enter_67_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G67_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S0;
+                enter_68_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[670] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G67_S2;
+                enter_67_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S1;
+                enter_68_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S3;
+                enter_68_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S2;
+                enter_68_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S4;
+                enter_68_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S3;
+                enter_68_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S5;
+                enter_68_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S4;
+                enter_68_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S6;
+                enter_68_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S5;
+                enter_68_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S7;
+                enter_68_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S6;
+                enter_68_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S8;
+                enter_68_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S7;
+                enter_68_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S0;
+                enter_68_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S8;
+                enter_68_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S1;
+                enter_68_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G68_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S0;
+                enter_69_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[680] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G68_S2;
+                enter_68_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S1;
+                enter_69_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S3;
+                enter_69_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S2;
+                enter_69_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S4;
+                enter_69_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S3;
+                enter_69_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S5;
+                enter_69_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S4;
+                enter_69_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S6;
+                enter_69_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S5;
+                enter_69_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S7;
+                enter_69_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S6;
+                enter_69_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S8;
+                enter_69_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S7;
+                enter_69_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S0;
+                enter_69_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S8;
+                enter_69_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S1;
+                enter_69_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G69_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S0;
+                enter_70_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[690] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G69_S2;
+                enter_69_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S1;
+                enter_70_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S3;
+                enter_70_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S2;
+                enter_70_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S4;
+                enter_70_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S3;
+                enter_70_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S5;
+                enter_70_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S4;
+                enter_70_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S6;
+                enter_70_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S5;
+                enter_70_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S7;
+                enter_70_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S6;
+                enter_70_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S8;
+                enter_70_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S7;
+                enter_70_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S0;
+                enter_70_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S8;
+                enter_70_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S1;
+                enter_70_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G70_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S0;
+                enter_71_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[700] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G70_S2;
+                enter_70_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S1;
+                enter_71_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S3;
+                enter_71_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S2;
+                enter_71_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S4;
+                enter_71_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S3;
+                enter_71_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S5;
+                enter_71_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S4;
+                enter_71_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S6;
+                enter_71_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S5;
+                enter_71_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S7;
+                enter_71_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S6;
+                enter_71_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S8;
+                enter_71_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S7;
+                enter_71_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S0;
+                enter_71_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S8;
+                enter_71_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S1;
+                enter_71_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G71_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S0;
+                enter_72_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[710] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G71_S2;
+                enter_71_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S1;
+                enter_72_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S3;
+                enter_72_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S2;
+                enter_72_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S4;
+                enter_72_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S3;
+                enter_72_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S5;
+                enter_72_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S4;
+                enter_72_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S6;
+                enter_72_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S5;
+                enter_72_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S7;
+                enter_72_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S6;
+                enter_72_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S8;
+                enter_72_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S7;
+                enter_72_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S0;
+                enter_72_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S8;
+                enter_72_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S1;
+                enter_72_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G72_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S0;
+                enter_73_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[720] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G72_S2;
+                enter_72_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S1;
+                enter_73_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S3;
+                enter_73_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S2;
+                enter_73_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S4;
+                enter_73_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S3;
+                enter_73_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S5;
+                enter_73_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S4;
+                enter_73_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S6;
+                enter_73_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S5;
+                enter_73_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S7;
+                enter_73_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S6;
+                enter_73_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S8;
+                enter_73_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S7;
+                enter_73_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S0;
+                enter_73_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S8;
+                enter_73_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S1;
+                enter_73_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G73_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S0;
+                enter_74_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[730] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G73_S2;
+                enter_73_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S1;
+                enter_74_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S3;
+                enter_74_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S2;
+                enter_74_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S4;
+                enter_74_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S3;
+                enter_74_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S5;
+                enter_74_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S4;
+                enter_74_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S6;
+                enter_74_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S5;
+                enter_74_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S7;
+                enter_74_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S6;
+                enter_74_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S8;
+                enter_74_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S7;
+                enter_74_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S0;
+                enter_74_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S8;
+                enter_74_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S1;
+                enter_74_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G74_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S0;
+                enter_75_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[740] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G74_S2;
+                enter_74_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S1;
+                enter_75_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S3;
+                enter_75_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S2;
+                enter_75_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S4;
+                enter_75_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S3;
+                enter_75_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S5;
+                enter_75_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S4;
+                enter_75_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S6;
+                enter_75_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S5;
+                enter_75_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S7;
+                enter_75_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S6;
+                enter_75_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S8;
+                enter_75_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S7;
+                enter_75_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S0;
+                enter_75_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S8;
+                enter_75_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S1;
+                enter_75_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G75_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S0;
+                enter_76_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[750] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G75_S2;
+                enter_75_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S1;
+                enter_76_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S3;
+                enter_76_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S2;
+                enter_76_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S4;
+                enter_76_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S3;
+                enter_76_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S5;
+                enter_76_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S4;
+                enter_76_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S6;
+                enter_76_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S5;
+                enter_76_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S7;
+                enter_76_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S6;
+                enter_76_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S8;
+                enter_76_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S7;
+                enter_76_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S0;
+                enter_76_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S8;
+                enter_76_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S1;
+                enter_76_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G76_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S0;
+                enter_77_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[760] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G76_S2;
+                enter_76_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S1;
+                enter_77_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S3;
+                enter_77_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S2;
+                enter_77_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S4;
+                enter_77_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S3;
+                enter_77_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S5;
+                enter_77_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S4;
+                enter_77_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S6;
+                enter_77_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S5;
+                enter_77_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S7;
+                enter_77_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S6;
+                enter_77_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S8;
+                enter_77_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S7;
+                enter_77_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S0;
+                enter_77_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S8;
+                enter_77_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S1;
+                enter_77_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G77_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S0;
+                enter_78_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[770] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G77_S2;
+                enter_77_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S1;
+                enter_78_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S3;
+                enter_78_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S2;
+                enter_78_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S4;
+                enter_78_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S3;
+                enter_78_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S5;
+                enter_78_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S4;
+                enter_78_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S6;
+                enter_78_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S5;
+                enter_78_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S7;
+                enter_78_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S6;
+                enter_78_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S8;
+                enter_78_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S7;
+                enter_78_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S0;
+                enter_78_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S8;
+                enter_78_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S1;
+                enter_78_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G78_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S0;
+                enter_79_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[780] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G78_S2;
+                enter_78_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S1;
+                enter_79_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S3;
+                enter_79_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S2;
+                enter_79_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S4;
+                enter_79_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S3;
+                enter_79_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S5;
+                enter_79_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S4;
+                enter_79_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S6;
+                enter_79_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S5;
+                enter_79_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S7;
+                enter_79_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S6;
+                enter_79_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S8;
+                enter_79_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S7;
+                enter_79_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S0;
+                enter_79_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S8;
+                enter_79_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S1;
+                enter_79_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G79_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S0;
+                enter_80_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[790] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G79_S2;
+                enter_79_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S1;
+                enter_80_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S3;
+                enter_80_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S2;
+                enter_80_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S4;
+                enter_80_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S3;
+                enter_80_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S5;
+                enter_80_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S4;
+                enter_80_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S6;
+                enter_80_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S5;
+                enter_80_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S7;
+                enter_80_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S6;
+                enter_80_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S8;
+                enter_80_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S7;
+                enter_80_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S0;
+                enter_80_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S8;
+                enter_80_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S1;
+                enter_80_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G80_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S0;
+                enter_81_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[800] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G80_S2;
+                enter_80_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S1;
+                enter_81_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S3;
+                enter_81_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S2;
+                enter_81_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S4;
+                enter_81_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S3;
+                enter_81_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S5;
+                enter_81_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S4;
+                enter_81_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S6;
+                enter_81_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S5;
+                enter_81_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S7;
+                enter_81_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S6;
+                enter_81_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S8;
+                enter_81_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S7;
+                enter_81_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S0;
+                enter_81_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S8;
+                enter_81_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S1;
+                enter_81_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G81_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S0;
+                enter_82_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[810] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G81_S2;
+                enter_81_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S1;
+                enter_82_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S3;
+                enter_82_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S2;
+                enter_82_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S4;
+                enter_82_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S3;
+                enter_82_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S5;
+                enter_82_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S4;
+                enter_82_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S6;
+                enter_82_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S5;
+                enter_82_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S7;
+                enter_82_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S6;
+                enter_82_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S8;
+                enter_82_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S7;
+                enter_82_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S0;
+                enter_82_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S8;
+                enter_82_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S1;
+                enter_82_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G82_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S0;
+                enter_83_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[820] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G82_S2;
+                enter_82_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S1;
+                enter_83_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S3;
+                enter_83_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S2;
+                enter_83_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S4;
+                enter_83_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S3;
+                enter_83_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S5;
+                enter_83_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S4;
+                enter_83_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S6;
+                enter_83_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S5;
+                enter_83_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S7;
+                enter_83_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S6;
+                enter_83_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S8;
+                enter_83_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S7;
+                enter_83_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S0;
+                enter_83_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S8;
+                enter_83_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S1;
+                enter_83_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G83_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S0;
+                enter_84_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[830] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G83_S2;
+                enter_83_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S1;
+                enter_84_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S3;
+                enter_84_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S2;
+                enter_84_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S4;
+                enter_84_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S3;
+                enter_84_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S5;
+                enter_84_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S4;
+                enter_84_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S6;
+                enter_84_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S5;
+                enter_84_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S7;
+                enter_84_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S6;
+                enter_84_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S8;
+                enter_84_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S7;
+                enter_84_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S0;
+                enter_84_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S8;
+                enter_84_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S1;
+                enter_84_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G84_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S0;
+                enter_85_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[840] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G84_S2;
+                enter_84_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S1;
+                enter_85_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S3;
+                enter_85_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S2;
+                enter_85_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S4;
+                enter_85_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S3;
+                enter_85_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S5;
+                enter_85_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S4;
+                enter_85_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S6;
+                enter_85_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S5;
+                enter_85_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S7;
+                enter_85_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S6;
+                enter_85_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S8;
+                enter_85_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S7;
+                enter_85_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S0;
+                enter_85_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S8;
+                enter_85_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S1;
+                enter_85_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G85_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S0;
+                enter_86_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[850] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G85_S2;
+                enter_85_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S1;
+                enter_86_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S3;
+                enter_86_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S2;
+                enter_86_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S4;
+                enter_86_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S3;
+                enter_86_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S5;
+                enter_86_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S4;
+                enter_86_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S6;
+                enter_86_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S5;
+                enter_86_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S7;
+                enter_86_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S6;
+                enter_86_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S8;
+                enter_86_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S7;
+                enter_86_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S0;
+                enter_86_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S8;
+                enter_86_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S1;
+                enter_86_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G86_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S0;
+                enter_87_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[860] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G86_S2;
+                enter_86_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S1;
+                enter_87_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S3;
+                enter_87_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S2;
+                enter_87_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S4;
+                enter_87_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S3;
+                enter_87_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S5;
+                enter_87_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S4;
+                enter_87_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S6;
+                enter_87_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S5;
+                enter_87_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S7;
+                enter_87_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S6;
+                enter_87_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S8;
+                enter_87_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S7;
+                enter_87_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S0;
+                enter_87_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S8;
+                enter_87_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S1;
+                enter_87_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G87_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S0;
+                enter_88_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[870] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G87_S2;
+                enter_87_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S1;
+                enter_88_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S3;
+                enter_88_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S2;
+                enter_88_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S4;
+                enter_88_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S3;
+                enter_88_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S5;
+                enter_88_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S4;
+                enter_88_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S6;
+                enter_88_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S5;
+                enter_88_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S7;
+                enter_88_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S6;
+                enter_88_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S8;
+                enter_88_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S7;
+                enter_88_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S0;
+                enter_88_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S8;
+                enter_88_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S1;
+                enter_88_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G88_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S0;
+                enter_89_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[880] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G88_S2;
+                enter_88_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S1;
+                enter_89_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S3;
+                enter_89_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S2;
+                enter_89_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S4;
+                enter_89_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S3;
+                enter_89_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S5;
+                enter_89_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S4;
+                enter_89_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S6;
+                enter_89_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S5;
+                enter_89_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S7;
+                enter_89_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S6;
+                enter_89_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S8;
+                enter_89_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S7;
+                enter_89_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S0;
+                enter_89_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S8;
+                enter_89_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S1;
+                enter_89_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G89_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S0;
+                enter_90_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[890] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G89_S2;
+                enter_89_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S1;
+                enter_90_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S3;
+                enter_90_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S2;
+                enter_90_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S4;
+                enter_90_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S3;
+                enter_90_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S5;
+                enter_90_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S4;
+                enter_90_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S6;
+                enter_90_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S5;
+                enter_90_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S7;
+                enter_90_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S6;
+                enter_90_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S8;
+                enter_90_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S7;
+                enter_90_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S0;
+                enter_90_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S8;
+                enter_90_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S1;
+                enter_90_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G90_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S0;
+                enter_91_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[900] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G90_S2;
+                enter_90_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S1;
+                enter_91_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S3;
+                enter_91_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S2;
+                enter_91_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S4;
+                enter_91_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S3;
+                enter_91_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S5;
+                enter_91_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S4;
+                enter_91_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S6;
+                enter_91_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S5;
+                enter_91_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S7;
+                enter_91_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S6;
+                enter_91_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S8;
+                enter_91_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S7;
+                enter_91_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S0;
+                enter_91_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S8;
+                enter_91_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S1;
+                enter_91_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G91_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S0;
+                enter_92_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[910] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G91_S2;
+                enter_91_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S1;
+                enter_92_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S3;
+                enter_92_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S2;
+                enter_92_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S4;
+                enter_92_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S3;
+                enter_92_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S5;
+                enter_92_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S4;
+                enter_92_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S6;
+                enter_92_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S5;
+                enter_92_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S7;
+                enter_92_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S6;
+                enter_92_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S8;
+                enter_92_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S7;
+                enter_92_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S0;
+                enter_92_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S8;
+                enter_92_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S1;
+                enter_92_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G92_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S0;
+                enter_93_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[920] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G92_S2;
+                enter_92_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S1;
+                enter_93_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S3;
+                enter_93_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S2;
+                enter_93_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S4;
+                enter_93_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S3;
+                enter_93_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S5;
+                enter_93_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S4;
+                enter_93_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S6;
+                enter_93_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S5;
+                enter_93_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S7;
+                enter_93_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S6;
+                enter_93_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S8;
+                enter_93_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S7;
+                enter_93_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S0;
+                enter_93_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S8;
+                enter_93_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S1;
+                enter_93_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G93_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S0;
+                enter_94_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[930] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G93_S2;
+                enter_93_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S1;
+                enter_94_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S3;
+                enter_94_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S2;
+                enter_94_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S4;
+                enter_94_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S3;
+                enter_94_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S5;
+                enter_94_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S4;
+                enter_94_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S6;
+                enter_94_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S5;
+                enter_94_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S7;
+                enter_94_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S6;
+                enter_94_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S8;
+                enter_94_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S7;
+                enter_94_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S0;
+                enter_94_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S8;
+                enter_94_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S1;
+                enter_94_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G94_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S0;
+                enter_95_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[940] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G94_S2;
+                enter_94_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S1;
+                enter_95_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S3;
+                enter_95_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S2;
+                enter_95_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S4;
+                enter_95_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S3;
+                enter_95_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S5;
+                enter_95_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S4;
+                enter_95_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S6;
+                enter_95_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S5;
+                enter_95_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S7;
+                enter_95_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S6;
+                enter_95_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S8;
+                enter_95_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S7;
+                enter_95_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S0;
+                enter_95_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S8;
+                enter_95_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S1;
+                enter_95_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G95_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S0;
+                enter_96_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[950] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G95_S2;
+                enter_95_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S1;
+                enter_96_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S3;
+                enter_96_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S2;
+                enter_96_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S4;
+                enter_96_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S3;
+                enter_96_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S5;
+                enter_96_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S4;
+                enter_96_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S6;
+                enter_96_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S5;
+                enter_96_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S7;
+                enter_96_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S6;
+                enter_96_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S8;
+                enter_96_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S7;
+                enter_96_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S0;
+                enter_96_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S8;
+                enter_96_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S1;
+                enter_96_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G96_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S0;
+                enter_97_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[960] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G96_S2;
+                enter_96_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S1;
+                enter_97_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S3;
+                enter_97_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S2;
+                enter_97_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S4;
+                enter_97_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S3;
+                enter_97_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S5;
+                enter_97_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S4;
+                enter_97_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S6;
+                enter_97_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S5;
+                enter_97_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S7;
+                enter_97_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S6;
+                enter_97_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S8;
+                enter_97_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S7;
+                enter_97_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S0;
+                enter_97_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S8;
+                enter_97_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S1;
+                enter_97_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G97_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S0;
+                enter_98_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[970] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G97_S2;
+                enter_97_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S1;
+                enter_98_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S3;
+                enter_98_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S2;
+                enter_98_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S4;
+                enter_98_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S3;
+                enter_98_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S5;
+                enter_98_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S4;
+                enter_98_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S6;
+                enter_98_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S5;
+                enter_98_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S7;
+                enter_98_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S6;
+                enter_98_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S8;
+                enter_98_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S7;
+                enter_98_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S0;
+                enter_98_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S8;
+                enter_98_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S1;
+                enter_98_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G98_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S0;
+                enter_99_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[980] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G98_S2;
+                enter_98_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S1;
+                enter_99_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S3;
+                enter_99_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S2;
+                enter_99_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S4;
+                enter_99_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S3;
+                enter_99_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S5;
+                enter_99_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S4;
+                enter_99_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S6;
+                enter_99_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S5;
+                enter_99_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S7;
+                enter_99_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S6;
+                enter_99_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S8;
+                enter_99_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S7;
+                enter_99_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S0;
+                enter_99_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S8;
+                enter_99_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S1;
+                enter_99_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G99_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S0;
+                enter_0_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[990] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G99_S2;
+                enter_99_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        default: break;
+        }
+        check = (Synthetic_state_t)state_info[check].parent;
+    }
+    return false;
+}
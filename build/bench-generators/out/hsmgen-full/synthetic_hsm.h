@@ -0,0 +1,1955 @@
+/* AUTO-GENERATED by hsmgen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_HSM_H
+#define SYNTHETIC_HSM_H
+
+#include <stdbool.h>
+
+/* States (hierarchical, flattened to enum) */
+typedef enum {
+    Synthetic_STATE_G0 = 0,
+    Synthetic_STATE_G0_S0 = 1,
+    Synthetic_STATE_G0_S1 = 2,
+    Synthetic_STATE_G0_S2 = 3,
+    Synthetic_STATE_G0_S3 = 4,
+    Synthetic_STATE_G0_S4 = 5,
+    Synthetic_STATE_G0_S5 = 6,
+    Synthetic_STATE_G0_S6 = 7,
+    Synthetic_STATE_G0_S7 = 8,
+    Synthetic_STATE_G0_S8 = 9,
+    Synthetic_STATE_G1 = 10,
+    Synthetic_STATE_G1_S0 = 11,
+    Synthetic_STATE_G1_S1 = 12,
+    Synthetic_STATE_G1_S2 = 13,
+    Synthetic_STATE_G1_S3 = 14,
+    Synthetic_STATE_G1_S4 = 15,
+    Synthetic_STATE_G1_S5 = 16,
+    Synthetic_STATE_G1_S6 = 17,
+    Synthetic_STATE_G1_S7 = 18,
+    Synthetic_STATE_G1_S8 = 19,
+    Synthetic_STATE_G2 = 20,
+    Synthetic_STATE_G2_S0 = 21,
+    Synthetic_STATE_G2_S1 = 22,
+    Synthetic_STATE_G2_S2 = 23,
+    Synthetic_STATE_G2_S3 = 24,
+    Synthetic_STATE_G2_S4 = 25,
+    Synthetic_STATE_G2_S5 = 26,
+    Synthetic_STATE_G2_S6 = 27,
+    Synthetic_STATE_G2_S7 = 28,
+    Synthetic_STATE_G2_S8 = 29,
+    Synthetic_STATE_G3 = 30,
+    Synthetic_STATE_G3_S0 = 31,
+    Synthetic_STATE_G3_S1 = 32,
+    Synthetic_STATE_G3_S2 = 33,
+    Synthetic_STATE_G3_S3 = 34,
+    Synthetic_STATE_G3_S4 = 35,
+    Synthetic_STATE_G3_S5 = 36,
+    Synthetic_STATE_G3_S6 = 37,
+    Synthetic_STATE_G3_S7 = 38,
+    Synthetic_STATE_G3_S8 = 39,
+    Synthetic_STATE_G4 = 40,
+    Synthetic_STATE_G4_S0 = 41,
+    Synthetic_STATE_G4_S1 = 42,
+    Synthetic_STATE_G4_S2 = 43,
+    Synthetic_STATE_G4_S3 = 44,
+    Synthetic_STATE_G4_S4 = 45,
+    Synthetic_STATE_G4_S5 = 46,
+    Synthetic_STATE_G4_S6 = 47,
+    Synthetic_STATE_G4_S7 = 48,
+    Synthetic_STATE_G4_S8 = 49,
+    Synthetic_STATE_G5 = 50,
+    Synthetic_STATE_G5_S0 = 51,
+    Synthetic_STATE_G5_S1 = 52,
+    Synthetic_STATE_G5_S2 = 53,
+    Synthetic_STATE_G5_S3 = 54,
+    Synthetic_STATE_G5_S4 = 55,
+    Synthetic_STATE_G5_S5 = 56,
+    Synthetic_STATE_G5_S6 = 57,
+    Synthetic_STATE_G5_S7 = 58,
+    Synthetic_STATE_G5_S8 = 59,
+    Synthetic_STATE_G6 = 60,
+    Synthetic_STATE_G6_S0 = 61,
+    Synthetic_STATE_G6_S1 = 62,
+    Synthetic_STATE_G6_S2 = 63,
+    Synthetic_STATE_G6_S3 = 64,
+    Synthetic_STATE_G6_S4 = 65,
+    Synthetic_STATE_G6_S5 = 66,
+    Synthetic_STATE_G6_S6 = 67,
+    Synthetic_STATE_G6_S7 = 68,
+    Synthetic_STATE_G6_S8 = 69,
+    Synthetic_STATE_G7 = 70,
+    Synthetic_STATE_G7_S0 = 71,
+    Synthetic_STATE_G7_S1 = 72,
+    Synthetic_STATE_G7_S2 = 73,
+    Synthetic_STATE_G7_S3 = 74,
+    Synthetic_STATE_G7_S4 = 75,
+    Synthetic_STATE_G7_S5 = 76,
+    Synthetic_STATE_G7_S6 = 77,
+    Synthetic_STATE_G7_S7 = 78,
+    Synthetic_STATE_G7_S8 = 79,
+    Synthetic_STATE_G8 = 80,
+    Synthetic_STATE_G8_S0 = 81,
+    Synthetic_STATE_G8_S1 = 82,
+    Synthetic_STATE_G8_S2 = 83,
+    Synthetic_STATE_G8_S3 = 84,
+    Synthetic_STATE_G8_S4 = 85,
+    Synthetic_STATE_G8_S5 = 86,
+    Synthetic_STATE_G8_S6 = 87,
+    Synthetic_STATE_G8_S7 = 88,
+    Synthetic_STATE_G8_S8 = 89,
+    Synthetic_STATE_G9 = 90,
+    Synthetic_STATE_G9_S0 = 91,
+    Synthetic_STATE_G9_S1 = 92,
+    Synthetic_STATE_G9_S2 = 93,
+    Synthetic_STATE_G9_S3 = 94,
+    Synthetic_STATE_G9_S4 = 95,
+    Synthetic_STATE_G9_S5 = 96,
+    Synthetic_STATE_G9_S6 = 97,
+    Synthetic_STATE_G9_S7 = 98,
+    Synthetic_STATE_G9_S8 = 99,
+    Synthetic_STATE_G10 = 100,
+    Synthetic_STATE_G10_S0 = 101,
+    Synthetic_STATE_G10_S1 = 102,
+    Synthetic_STATE_G10_S2 = 103,
+    Synthetic_STATE_G10_S3 = 104,
+    Synthetic_STATE_G10_S4 = 105,
+    Synthetic_STATE_G10_S5 = 106,
+    Synthetic_STATE_G10_S6 = 107,
+    Synthetic_STATE_G10_S7 = 108,
+    Synthetic_STATE_G10_S8 = 109,
+    Synthetic_STATE_G11 = 110,
+    Synthetic_STATE_G11_S0 = 111,
+    Synthetic_STATE_G11_S1 = 112,
+    Synthetic_STATE_G11_S2 = 113,
+    Synthetic_STATE_G11_S3 = 114,
+    Synthetic_STATE_G11_S4 = 115,
+    Synthetic_STATE_G11_S5 = 116,
+    Synthetic_STATE_G11_S6 = 117,
+    Synthetic_STATE_G11_S7 = 118,
+    Synthetic_STATE_G11_S8 = 119,
+    Synthetic_STATE_G12 = 120,
+    Synthetic_STATE_G12_S0 = 121,
+    Synthetic_STATE_G12_S1 = 122,
+    Synthetic_STATE_G12_S2 = 123,
+    Synthetic_STATE_G12_S3 = 124,
+    Synthetic_STATE_G12_S4 = 125,
+    Synthetic_STATE_G12_S5 = 126,
+    Synthetic_STATE_G12_S6 = 127,
+    Synthetic_STATE_G12_S7 = 128,
+    Synthetic_STATE_G12_S8 = 129,
+    Synthetic_STATE_G13 = 130,
+    Synthetic_STATE_G13_S0 = 131,
+    Synthetic_STATE_G13_S1 = 132,
+    Synthetic_STATE_G13_S2 = 133,
+    Synthetic_STATE_G13_S3 = 134,
+    Synthetic_STATE_G13_S4 = 135,
+    Synthetic_STATE_G13_S5 = 136,
+    Synthetic_STATE_G13_S6 = 137,
+    Synthetic_STATE_G13_S7 = 138,
+    Synthetic_STATE_G13_S8 = 139,
+    Synthetic_STATE_G14 = 140,
+    Synthetic_STATE_G14_S0 = 141,
+    Synthetic_STATE_G14_S1 = 142,
+    Synthetic_STATE_G14_S2 = 143,
+    Synthetic_STATE_G14_S3 = 144,
+    Synthetic_STATE_G14_S4 = 145,
+    Synthetic_STATE_G14_S5 = 146,
+    Synthetic_STATE_G14_S6 = 147,
+    Synthetic_STATE_G14_S7 = 148,
+    Synthetic_STATE_G14_S8 = 149,
+    Synthetic_STATE_G15 = 150,
+    Synthetic_STATE_G15_S0 = 151,
+    Synthetic_STATE_G15_S1 = 152,
+    Synthetic_STATE_G15_S2 = 153,
+    Synthetic_STATE_G15_S3 = 154,
+    Synthetic_STATE_G15_S4 = 155,
+    Synthetic_STATE_G15_S5 = 156,
+    Synthetic_STATE_G15_S6 = 157,
+    Synthetic_STATE_G15_S7 = 158,
+    Synthetic_STATE_G15_S8 = 159,
+    Synthetic_STATE_G16 = 160,
+    Synthetic_STATE_G16_S0 = 161,
+    Synthetic_STATE_G16_S1 = 162,
+    Synthetic_STATE_G16_S2 = 163,
+    Synthetic_STATE_G16_S3 = 164,
+    Synthetic_STATE_G16_S4 = 165,
+    Synthetic_STATE_G16_S5 = 166,
+    Synthetic_STATE_G16_S6 = 167,
+    Synthetic_STATE_G16_S7 = 168,
+    Synthetic_STATE_G16_S8 = 169,
+    Synthetic_STATE_G17 = 170,
+    Synthetic_STATE_G17_S0 = 171,
+    Synthetic_STATE_G17_S1 = 172,
+    Synthetic_STATE_G17_S2 = 173,
+    Synthetic_STATE_G17_S3 = 174,
+    Synthetic_STATE_G17_S4 = 175,
+    Synthetic_STATE_G17_S5 = 176,
+    Synthetic_STATE_G17_S6 = 177,
+    Synthetic_STATE_G17_S7 = 178,
+    Synthetic_STATE_G17_S8 = 179,
+    Synthetic_STATE_G18 = 180,
+    Synthetic_STATE_G18_S0 = 181,
+    Synthetic_STATE_G18_S1 = 182,
+    Synthetic_STATE_G18_S2 = 183,
+    Synthetic_STATE_G18_S3 = 184,
+    Synthetic_STATE_G18_S4 = 185,
+    Synthetic_STATE_G18_S5 = 186,
+    Synthetic_STATE_G18_S6 = 187,
+    Synthetic_STATE_G18_S7 = 188,
+    Synthetic_STATE_G18_S8 = 189,
+    Synthetic_STATE_G19 = 190,
+    Synthetic_STATE_G19_S0 = 191,
+    Synthetic_STATE_G19_S1 = 192,
+    Synthetic_STATE_G19_S2 = 193,
+    Synthetic_STATE_G19_S3 = 194,
+    Synthetic_STATE_G19_S4 = 195,
+    Synthetic_STATE_G19_S5 = 196,
+    Synthetic_STATE_G19_S6 = 197,
+    Synthetic_STATE_G19_S7 = 198,
+    Synthetic_STATE_G19_S8 = 199,
+    Synthetic_STATE_G20 = 200,
+    Synthetic_STATE_G20_S0 = 201,
+    Synthetic_STATE_G20_S1 = 202,
+    Synthetic_STATE_G20_S2 = 203,
+    Synthetic_STATE_G20_S3 = 204,
+    Synthetic_STATE_G20_S4 = 205,
+    Synthetic_STATE_G20_S5 = 206,
+    Synthetic_STATE_G20_S6 = 207,
+    Synthetic_STATE_G20_S7 = 208,
+    Synthetic_STATE_G20_S8 = 209,
+    Synthetic_STATE_G21 = 210,
+    Synthetic_STATE_G21_S0 = 211,
+    Synthetic_STATE_G21_S1 = 212,
+    Synthetic_STATE_G21_S2 = 213,
+    Synthetic_STATE_G21_S3 = 214,
+    Synthetic_STATE_G21_S4 = 215,
+    Synthetic_STATE_G21_S5 = 216,
+    Synthetic_STATE_G21_S6 = 217,
+    Synthetic_STATE_G21_S7 = 218,
+    Synthetic_STATE_G21_S8 = 219,
+    Synthetic_STATE_G22 = 220,
+    Synthetic_STATE_G22_S0 = 221,
+    Synthetic_STATE_G22_S1 = 222,
+    Synthetic_STATE_G22_S2 = 223,
+    Synthetic_STATE_G22_S3 = 224,
+    Synthetic_STATE_G22_S4 = 225,
+    Synthetic_STATE_G22_S5 = 226,
+    Synthetic_STATE_G22_S6 = 227,
+    Synthetic_STATE_G22_S7 = 228,
+    Synthetic_STATE_G22_S8 = 229,
+    Synthetic_STATE_G23 = 230,
+    Synthetic_STATE_G23_S0 = 231,
+    Synthetic_STATE_G23_S1 = 232,
+    Synthetic_STATE_G23_S2 = 233,
+    Synthetic_STATE_G23_S3 = 234,
+    Synthetic_STATE_G23_S4 = 235,
+    Synthetic_STATE_G23_S5 = 236,
+    Synthetic_STATE_G23_S6 = 237,
+    Synthetic_STATE_G23_S7 = 238,
+    Synthetic_STATE_G23_S8 = 239,
+    Synthetic_STATE_G24 = 240,
+    Synthetic_STATE_G24_S0 = 241,
+    Synthetic_STATE_G24_S1 = 242,
+    Synthetic_STATE_G24_S2 = 243,
+    Synthetic_STATE_G24_S3 = 244,
+    Synthetic_STATE_G24_S4 = 245,
+    Synthetic_STATE_G24_S5 = 246,
+    Synthetic_STATE_G24_S6 = 247,
+    Synthetic_STATE_G24_S7 = 248,
+    Synthetic_STATE_G24_S8 = 249,
+    Synthetic_STATE_G25 = 250,
+    Synthetic_STATE_G25_S0 = 251,
+    Synthetic_STATE_G25_S1 = 252,
+    Synthetic_STATE_G25_S2 = 253,
+    Synthetic_STATE_G25_S3 = 254,
+    Synthetic_STATE_G25_S4 = 255,
+    Synthetic_STATE_G25_S5 = 256,
+    Synthetic_STATE_G25_S6 = 257,
+    Synthetic_STATE_G25_S7 = 258,
+    Synthetic_STATE_G25_S8 = 259,
+    Synthetic_STATE_G26 = 260,
+    Synthetic_STATE_G26_S0 = 261,
+    Synthetic_STATE_G26_S1 = 262,
+    Synthetic_STATE_G26_S2 = 263,
+    Synthetic_STATE_G26_S3 = 264,
+    Synthetic_STATE_G26_S4 = 265,
+    Synthetic_STATE_G26_S5 = 266,
+    Synthetic_STATE_G26_S6 = 267,
+    Synthetic_STATE_G26_S7 = 268,
+    Synthetic_STATE_G26_S8 = 269,
+    Synthetic_STATE_G27 = 270,
+    Synthetic_STATE_G27_S0 = 271,
+    Synthetic_STATE_G27_S1 = 272,
+    Synthetic_STATE_G27_S2 = 273,
+    Synthetic_STATE_G27_S3 = 274,
+    Synthetic_STATE_G27_S4 = 275,
+    Synthetic_STATE_G27_S5 = 276,
+    Synthetic_STATE_G27_S6 = 277,
+    Synthetic_STATE_G27_S7 = 278,
+    Synthetic_STATE_G27_S8 = 279,
+    Synthetic_STATE_G28 = 280,
+    Synthetic_STATE_G28_S0 = 281,
+    Synthetic_STATE_G28_S1 = 282,
+    Synthetic_STATE_G28_S2 = 283,
+    Synthetic_STATE_G28_S3 = 284,
+    Synthetic_STATE_G28_S4 = 285,
+    Synthetic_STATE_G28_S5 = 286,
+    Synthetic_STATE_G28_S6 = 287,
+    Synthetic_STATE_G28_S7 = 288,
+    Synthetic_STATE_G28_S8 = 289,
+    Synthetic_STATE_G29 = 290,
+    Synthetic_STATE_G29_S0 = 291,
+    Synthetic_STATE_G29_S1 = 292,
+    Synthetic_STATE_G29_S2 = 293,
+    Synthetic_STATE_G29_S3 = 294,
+    Synthetic_STATE_G29_S4 = 295,
+    Synthetic_STATE_G29_S5 = 296,
+    Synthetic_STATE_G29_S6 = 297,
+    Synthetic_STATE_G29_S7 = 298,
+    Synthetic_STATE_G29_S8 = 299,
+    Synthetic_STATE_G30 = 300,
+    Synthetic_STATE_G30_S0 = 301,
+    Synthetic_STATE_G30_S1 = 302,
+    Synthetic_STATE_G30_S2 = 303,
+    Synthetic_STATE_G30_S3 = 304,
+    Synthetic_STATE_G30_S4 = 305,
+    Synthetic_STATE_G30_S5 = 306,
+    Synthetic_STATE_G30_S6 = 307,
+    Synthetic_STATE_G30_S7 = 308,
+    Synthetic_STATE_G30_S8 = 309,
+    Synthetic_STATE_G31 = 310,
+    Synthetic_STATE_G31_S0 = 311,
+    Synthetic_STATE_G31_S1 = 312,
+    Synthetic_STATE_G31_S2 = 313,
+    Synthetic_STATE_G31_S3 = 314,
+    Synthetic_STATE_G31_S4 = 315,
+    Synthetic_STATE_G31_S5 = 316,
+    Synthetic_STATE_G31_S6 = 317,
+    Synthetic_STATE_G31_S7 = 318,
+    Synthetic_STATE_G31_S8 = 319,
+    Synthetic_STATE_G32 = 320,
+    Synthetic_STATE_G32_S0 = 321,
+    Synthetic_STATE_G32_S1 = 322,
+    Synthetic_STATE_G32_S2 = 323,
+    Synthetic_STATE_G32_S3 = 324,
+    Synthetic_STATE_G32_S4 = 325,
+    Synthetic_STATE_G32_S5 = 326,
+    Synthetic_STATE_G32_S6 = 327,
+    Synthetic_STATE_G32_S7 = 328,
+    Synthetic_STATE_G32_S8 = 329,
+    Synthetic_STATE_G33 = 330,
+    Synthetic_STATE_G33_S0 = 331,
+    Synthetic_STATE_G33_S1 = 332,
+    Synthetic_STATE_G33_S2 = 333,
+    Synthetic_STATE_G33_S3 = 334,
+    Synthetic_STATE_G33_S4 = 335,
+    Synthetic_STATE_G33_S5 = 336,
+    Synthetic_STATE_G33_S6 = 337,
+    Synthetic_STATE_G33_S7 = 338,
+    Synthetic_STATE_G33_S8 = 339,
+    Synthetic_STATE_G34 = 340,
+    Synthetic_STATE_G34_S0 = 341,
+    Synthetic_STATE_G34_S1 = 342,
+    Synthetic_STATE_G34_S2 = 343,
+    Synthetic_STATE_G34_S3 = 344,
+    Synthetic_STATE_G34_S4 = 345,
+    Synthetic_STATE_G34_S5 = 346,
+    Synthetic_STATE_G34_S6 = 347,
+    Synthetic_STATE_G34_S7 = 348,
+    Synthetic_STATE_G34_S8 = 349,
+    Synthetic_STATE_G35 = 350,
+    Synthetic_STATE_G35_S0 = 351,
+    Synthetic_STATE_G35_S1 = 352,
+    Synthetic_STATE_G35_S2 = 353,
+    Synthetic_STATE_G35_S3 = 354,
+    Synthetic_STATE_G35_S4 = 355,
+    Synthetic_STATE_G35_S5 = 356,
+    Synthetic_STATE_G35_S6 = 357,
+    Synthetic_STATE_G35_S7 = 358,
+    Synthetic_STATE_G35_S8 = 359,
+    Synthetic_STATE_G36 = 360,
+    Synthetic_STATE_G36_S0 = 361,
+    Synthetic_STATE_G36_S1 = 362,
+    Synthetic_STATE_G36_S2 = 363,
+    Synthetic_STATE_G36_S3 = 364,
+    Synthetic_STATE_G36_S4 = 365,
+    Synthetic_STATE_G36_S5 = 366,
+    Synthetic_STATE_G36_S6 = 367,
+    Synthetic_STATE_G36_S7 = 368,
+    Synthetic_STATE_G36_S8 = 369,
+    Synthetic_STATE_G37 = 370,
+    Synthetic_STATE_G37_S0 = 371,
+    Synthetic_STATE_G37_S1 = 372,
+    Synthetic_STATE_G37_S2 = 373,
+    Synthetic_STATE_G37_S3 = 374,
+    Synthetic_STATE_G37_S4 = 375,
+    Synthetic_STATE_G37_S5 = 376,
+    Synthetic_STATE_G37_S6 = 377,
+    Synthetic_STATE_G37_S7 = 378,
+    Synthetic_STATE_G37_S8 = 379,
+    Synthetic_STATE_G38 = 380,
+    Synthetic_STATE_G38_S0 = 381,
+    Synthetic_STATE_G38_S1 = 382,
+    Synthetic_STATE_G38_S2 = 383,
+    Synthetic_STATE_G38_S3 = 384,
+    Synthetic_STATE_G38_S4 = 385,
+    Synthetic_STATE_G38_S5 = 386,
+    Synthetic_STATE_G38_S6 = 387,
+    Synthetic_STATE_G38_S7 = 388,
+    Synthetic_STATE_G38_S8 = 389,
+    Synthetic_STATE_G39 = 390,
+    Synthetic_STATE_G39_S0 = 391,
+    Synthetic_STATE_G39_S1 = 392,
+    Synthetic_STATE_G39_S2 = 393,
+    Synthetic_STATE_G39_S3 = 394,
+    Synthetic_STATE_G39_S4 = 395,
+    Synthetic_STATE_G39_S5 = 396,
+    Synthetic_STATE_G39_S6 = 397,
+    Synthetic_STATE_G39_S7 = 398,
+    Synthetic_STATE_G39_S8 = 399,
+    Synthetic_STATE_G40 = 400,
+    Synthetic_STATE_G40_S0 = 401,
+    Synthetic_STATE_G40_S1 = 402,
+    Synthetic_STATE_G40_S2 = 403,
+    Synthetic_STATE_G40_S3 = 404,
+    Synthetic_STATE_G40_S4 = 405,
+    Synthetic_STATE_G40_S5 = 406,
+    Synthetic_STATE_G40_S6 = 407,
+    Synthetic_STATE_G40_S7 = 408,
+    Synthetic_STATE_G40_S8 = 409,
+    Synthetic_STATE_G41 = 410,
+    Synthetic_STATE_G41_S0 = 411,
+    Synthetic_STATE_G41_S1 = 412,
+    Synthetic_STATE_G41_S2 = 413,
+    Synthetic_STATE_G41_S3 = 414,
+    Synthetic_STATE_G41_S4 = 415,
+    Synthetic_STATE_G41_S5 = 416,
+    Synthetic_STATE_G41_S6 = 417,
+    Synthetic_STATE_G41_S7 = 418,
+    Synthetic_STATE_G41_S8 = 419,
+    Synthetic_STATE_G42 = 420,
+    Synthetic_STATE_G42_S0 = 421,
+    Synthetic_STATE_G42_S1 = 422,
+    Synthetic_STATE_G42_S2 = 423,
+    Synthetic_STATE_G42_S3 = 424,
+    Synthetic_STATE_G42_S4 = 425,
+    Synthetic_STATE_G42_S5 = 426,
+    Synthetic_STATE_G42_S6 = 427,
+    Synthetic_STATE_G42_S7 = 428,
+    Synthetic_STATE_G42_S8 = 429,
+    Synthetic_STATE_G43 = 430,
+    Synthetic_STATE_G43_S0 = 431,
+    Synthetic_STATE_G43_S1 = 432,
+    Synthetic_STATE_G43_S2 = 433,
+    Synthetic_STATE_G43_S3 = 434,
+    Synthetic_STATE_G43_S4 = 435,
+    Synthetic_STATE_G43_S5 = 436,
+    Synthetic_STATE_G43_S6 = 437,
+    Synthetic_STATE_G43_S7 = 438,
+    Synthetic_STATE_G43_S8 = 439,
+    Synthetic_STATE_G44 = 440,
+    Synthetic_STATE_G44_S0 = 441,
+    Synthetic_STATE_G44_S1 = 442,
+    Synthetic_STATE_G44_S2 = 443,
+    Synthetic_STATE_G44_S3 = 444,
+    Synthetic_STATE_G44_S4 = 445,
+    Synthetic_STATE_G44_S5 = 446,
+    Synthetic_STATE_G44_S6 = 447,
+    Synthetic_STATE_G44_S7 = 448,
+    Synthetic_STATE_G44_S8 = 449,
+    Synthetic_STATE_G45 = 450,
+    Synthetic_STATE_G45_S0 = 451,
+    Synthetic_STATE_G45_S1 = 452,
+    Synthetic_STATE_G45_S2 = 453,
+    Synthetic_STATE_G45_S3 = 454,
+    Synthetic_STATE_G45_S4 = 455,
+    Synthetic_STATE_G45_S5 = 456,
+    Synthetic_STATE_G45_S6 = 457,
+    Synthetic_STATE_G45_S7 = 458,
+    Synthetic_STATE_G45_S8 = 459,
+    Synthetic_STATE_G46 = 460,
+    Synthetic_STATE_G46_S0 = 461,
+    Synthetic_STATE_G46_S1 = 462,
+    Synthetic_STATE_G46_S2 = 463,
+    Synthetic_STATE_G46_S3 = 464,
+    Synthetic_STATE_G46_S4 = 465,
+    Synthetic_STATE_G46_S5 = 466,
+    Synthetic_STATE_G46_S6 = 467,
+    Synthetic_STATE_G46_S7 = 468,
+    Synthetic_STATE_G46_S8 = 469,
+    Synthetic_STATE_G47 = 470,
+    Synthetic_STATE_G47_S0 = 471,
+    Synthetic_STATE_G47_S1 = 472,
+    Synthetic_STATE_G47_S2 = 473,
+    Synthetic_STATE_G47_S3 = 474,
+    Synthetic_STATE_G47_S4 = 475,
+    Synthetic_STATE_G47_S5 = 476,
+    Synthetic_STATE_G47_S6 = 477,
+    Synthetic_STATE_G47_S7 = 478,
+    Synthetic_STATE_G47_S8 = 479,
+    Synthetic_STATE_G48 = 480,
+    Synthetic_STATE_G48_S0 = 481,
+    Synthetic_STATE_G48_S1 = 482,
+    Synthetic_STATE_G48_S2 = 483,
+    Synthetic_STATE_G48_S3 = 484,
+    Synthetic_STATE_G48_S4 = 485,
+    Synthetic_STATE_G48_S5 = 486,
+    Synthetic_STATE_G48_S6 = 487,
+    Synthetic_STATE_G48_S7 = 488,
+    Synthetic_STATE_G48_S8 = 489,
+    Synthetic_STATE_G49 = 490,
+    Synthetic_STATE_G49_S0 = 491,
+    Synthetic_STATE_G49_S1 = 492,
+    Synthetic_STATE_G49_S2 = 493,
+    Synthetic_STATE_G49_S3 = 494,
+    Synthetic_STATE_G49_S4 = 495,
+    Synthetic_STATE_G49_S5 = 496,
+    Synthetic_STATE_G49_S6 = 497,
+    Synthetic_STATE_G49_S7 = 498,
+    Synthetic_STATE_G49_S8 = 499,
+    Synthetic_STATE_G50 = 500,
+    Synthetic_STATE_G50_S0 = 501,
+    Synthetic_STATE_G50_S1 = 502,
+    Synthetic_STATE_G50_S2 = 503,
+    Synthetic_STATE_G50_S3 = 504,
+    Synthetic_STATE_G50_S4 = 505,
+    Synthetic_STATE_G50_S5 = 506,
+    Synthetic_STATE_G50_S6 = 507,
+    Synthetic_STATE_G50_S7 = 508,
+    Synthetic_STATE_G50_S8 = 509,
+    Synthetic_STATE_G51 = 510,
+    Synthetic_STATE_G51_S0 = 511,
+    Synthetic_STATE_G51_S1 = 512,
+    Synthetic_STATE_G51_S2 = 513,
+    Synthetic_STATE_G51_S3 = 514,
+    Synthetic_STATE_G51_S4 = 515,
+    Synthetic_STATE_G51_S5 = 516,
+    Synthetic_STATE_G51_S6 = 517,
+    Synthetic_STATE_G51_S7 = 518,
+    Synthetic_STATE_G51_S8 = 519,
+    Synthetic_STATE_G52 = 520,
+    Synthetic_STATE_G52_S0 = 521,
+    Synthetic_STATE_G52_S1 = 522,
+    Synthetic_STATE_G52_S2 = 523,
+    Synthetic_STATE_G52_S3 = 524,
+    Synthetic_STATE_G52_S4 = 525,
+    Synthetic_STATE_G52_S5 = 526,
+    Synthetic_STATE_G52_S6 = 527,
+    Synthetic_STATE_G52_S7 = 528,
+    Synthetic_STATE_G52_S8 = 529,
+    Synthetic_STATE_G53 = 530,
+    Synthetic_STATE_G53_S0 = 531,
+    Synthetic_STATE_G53_S1 = 532,
+    Synthetic_STATE_G53_S2 = 533,
+    Synthetic_STATE_G53_S3 = 534,
+    Synthetic_STATE_G53_S4 = 535,
+    Synthetic_STATE_G53_S5 = 536,
+    Synthetic_STATE_G53_S6 = 537,
+    Synthetic_STATE_G53_S7 = 538,
+    Synthetic_STATE_G53_S8 = 539,
+    Synthetic_STATE_G54 = 540,
+    Synthetic_STATE_G54_S0 = 541,
+    Synthetic_STATE_G54_S1 = 542,
+    Synthetic_STATE_G54_S2 = 543,
+    Synthetic_STATE_G54_S3 = 544,
+    Synthetic_STATE_G54_S4 = 545,
+    Synthetic_STATE_G54_S5 = 546,
+    Synthetic_STATE_G54_S6 = 547,
+    Synthetic_STATE_G54_S7 = 548,
+    Synthetic_STATE_G54_S8 = 549,
+    Synthetic_STATE_G55 = 550,
+    Synthetic_STATE_G55_S0 = 551,
+    Synthetic_STATE_G55_S1 = 552,
+    Synthetic_STATE_G55_S2 = 553,
+    Synthetic_STATE_G55_S3 = 554,
+    Synthetic_STATE_G55_S4 = 555,
+    Synthetic_STATE_G55_S5 = 556,
+    Synthetic_STATE_G55_S6 = 557,
+    Synthetic_STATE_G55_S7 = 558,
+    Synthetic_STATE_G55_S8 = 559,
+    Synthetic_STATE_G56 = 560,
+    Synthetic_STATE_G56_S0 = 561,
+    Synthetic_STATE_G56_S1 = 562,
+    Synthetic_STATE_G56_S2 = 563,
+    Synthetic_STATE_G56_S3 = 564,
+    Synthetic_STATE_G56_S4 = 565,
+    Synthetic_STATE_G56_S5 = 566,
+    Synthetic_STATE_G56_S6 = 567,
+    Synthetic_STATE_G56_S7 = 568,
+    Synthetic_STATE_G56_S8 = 569,
+    Synthetic_STATE_G57 = 570,
+    Synthetic_STATE_G57_S0 = 571,
+    Synthetic_STATE_G57_S1 = 572,
+    Synthetic_STATE_G57_S2 = 573,
+    Synthetic_STATE_G57_S3 = 574,
+    Synthetic_STATE_G57_S4 = 575,
+    Synthetic_STATE_G57_S5 = 576,
+    Synthetic_STATE_G57_S6 = 577,
+    Synthetic_STATE_G57_S7 = 578,
+    Synthetic_STATE_G57_S8 = 579,
+    Synthetic_STATE_G58 = 580,
+    Synthetic_STATE_G58_S0 = 581,
+    Synthetic_STATE_G58_S1 = 582,
+    Synthetic_STATE_G58_S2 = 583,
+    Synthetic_STATE_G58_S3 = 584,
+    Synthetic_STATE_G58_S4 = 585,
+    Synthetic_STATE_G58_S5 = 586,
+    Synthetic_STATE_G58_S6 = 587,
+    Synthetic_STATE_G58_S7 = 588,
+    Synthetic_STATE_G58_S8 = 589,
+    Synthetic_STATE_G59 = 590,
+    Synthetic_STATE_G59_S0 = 591,
+    Synthetic_STATE_G59_S1 = 592,
+    Synthetic_STATE_G59_S2 = 593,
+    Synthetic_STATE_G59_S3 = 594,
+    Synthetic_STATE_G59_S4 = 595,
+    Synthetic_STATE_G59_S5 = 596,
+    Synthetic_STATE_G59_S6 = 597,
+    Synthetic_STATE_G59_S7 = 598,
+    Synthetic_STATE_G59_S8 = 599,
+    Synthetic_STATE_G60 = 600,
+    Synthetic_STATE_G60_S0 = 601,
+    Synthetic_STATE_G60_S1 = 602,
+    Synthetic_STATE_G60_S2 = 603,
+    Synthetic_STATE_G60_S3 = 604,
+    Synthetic_STATE_G60_S4 = 605,
+    Synthetic_STATE_G60_S5 = 606,
+    Synthetic_STATE_G60_S6 = 607,
+    Synthetic_STATE_G60_S7 = 608,
+    Synthetic_STATE_G60_S8 = 609,
+    Synthetic_STATE_G61 = 610,
+    Synthetic_STATE_G61_S0 = 611,
+    Synthetic_STATE_G61_S1 = 612,
+    Synthetic_STATE_G61_S2 = 613,
+    Synthetic_STATE_G61_S3 = 614,
+    Synthetic_STATE_G61_S4 = 615,
+    Synthetic_STATE_G61_S5 = 616,
+    Synthetic_STATE_G61_S6 = 617,
+    Synthetic_STATE_G61_S7 = 618,
+    Synthetic_STATE_G61_S8 = 619,
+    Synthetic_STATE_G62 = 620,
+    Synthetic_STATE_G62_S0 = 621,
+    Synthetic_STATE_G62_S1 = 622,
+    Synthetic_STATE_G62_S2 = 623,
+    Synthetic_STATE_G62_S3 = 624,
+    Synthetic_STATE_G62_S4 = 625,
+    Synthetic_STATE_G62_S5 = 626,
+    Synthetic_STATE_G62_S6 = 627,
+    Synthetic_STATE_G62_S7 = 628,
+    Synthetic_STATE_G62_S8 = 629,
+    Synthetic_STATE_G63 = 630,
+    Synthetic_STATE_G63_S0 = 631,
+    Synthetic_STATE_G63_S1 = 632,
+    Synthetic_STATE_G63_S2 = 633,
+    Synthetic_STATE_G63_S3 = 634,
+    Synthetic_STATE_G63_S4 = 635,
+    Synthetic_STATE_G63_S5 = 636,
+    Synthetic_STATE_G63_S6 = 637,
+    Synthetic_STATE_G63_S7 = 638,
+    Synthetic_STATE_G63_S8 = 639,
+    Synthetic_STATE_G64 = 640,
+    Synthetic_STATE_G64_S0 = 641,
+    Synthetic_STATE_G64_S1 = 642,
+    Synthetic_STATE_G64_S2 = 643,
+    Synthetic_STATE_G64_S3 = 644,
+    Synthetic_STATE_G64_S4 = 645,
+    Synthetic_STATE_G64_S5 = 646,
+    Synthetic_STATE_G64_S6 = 647,
+    Synthetic_STATE_G64_S7 = 648,
+    Synthetic_STATE_G64_S8 = 649,
+    Synthetic_STATE_G65 = 650,
+    Synthetic_STATE_G65_S0 = 651,
+    Synthetic_STATE_G65_S1 = 652,
+    Synthetic_STATE_G65_S2 = 653,
+    Synthetic_STATE_G65_S3 = 654,
+    Synthetic_STATE_G65_S4 = 655,
+    Synthetic_STATE_G65_S5 = 656,
+    Synthetic_STATE_G65_S6 = 657,
+    Synthetic_STATE_G65_S7 = 658,
+    Synthetic_STATE_G65_S8 = 659,
+    Synthetic_STATE_G66 = 660,
+    Synthetic_STATE_G66_S0 = 661,
+    Synthetic_STATE_G66_S1 = 662,
+    Synthetic_STATE_G66_S2 = 663,
+    Synthetic_STATE_G66_S3 = 664,
+    Synthetic_STATE_G66_S4 = 665,
+    Synthetic_STATE_G66_S5 = 666,
+    Synthetic_STATE_G66_S6 = 667,
+    Synthetic_STATE_G66_S7 = 668,
+    Synthetic_STATE_G66_S8 = 669,
+    Synthetic_STATE_G67 = 670,
+    Synthetic_STATE_G67_S0 = 671,
+    Synthetic_STATE_G67_S1 = 672,
+    Synthetic_STATE_G67_S2 = 673,
+    Synthetic_STATE_G67_S3 = 674,
+    Synthetic_STATE_G67_S4 = 675,
+    Synthetic_STATE_G67_S5 = 676,
+    Synthetic_STATE_G67_S6 = 677,
+    Synthetic_STATE_G67_S7 = 678,
+    Synthetic_STATE_G67_S8 = 679,
+    Synthetic_STATE_G68 = 680,
+    Synthetic_STATE_G68_S0 = 681,
+    Synthetic_STATE_G68_S1 = 682,
+    Synthetic_STATE_G68_S2 = 683,
+    Synthetic_STATE_G68_S3 = 684,
+    Synthetic_STATE_G68_S4 = 685,
+    Synthetic_STATE_G68_S5 = 686,
+    Synthetic_STATE_G68_S6 = 687,
+    Synthetic_STATE_G68_S7 = 688,
+    Synthetic_STATE_G68_S8 = 689,
+    Synthetic_STATE_G69 = 690,
+    Synthetic_STATE_G69_S0 = 691,
+    Synthetic_STATE_G69_S1 = 692,
+    Synthetic_STATE_G69_S2 = 693,
+    Synthetic_STATE_G69_S3 = 694,
+    Synthetic_STATE_G69_S4 = 695,
+    Synthetic_STATE_G69_S5 = 696,
+    Synthetic_STATE_G69_S6 = 697,
+    Synthetic_STATE_G69_S7 = 698,
+    Synthetic_STATE_G69_S8 = 699,
+    Synthetic_STATE_G70 = 700,
+    Synthetic_STATE_G70_S0 = 701,
+    Synthetic_STATE_G70_S1 = 702,
+    Synthetic_STATE_G70_S2 = 703,
+    Synthetic_STATE_G70_S3 = 704,
+    Synthetic_STATE_G70_S4 = 705,
+    Synthetic_STATE_G70_S5 = 706,
+    Synthetic_STATE_G70_S6 = 707,
+    Synthetic_STATE_G70_S7 = 708,
+    Synthetic_STATE_G70_S8 = 709,
+    Synthetic_STATE_G71 = 710,
+    Synthetic_STATE_G71_S0 = 711,
+    Synthetic_STATE_G71_S1 = 712,
+    Synthetic_STATE_G71_S2 = 713,
+    Synthetic_STATE_G71_S3 = 714,
+    Synthetic_STATE_G71_S4 = 715,
+    Synthetic_STATE_G71_S5 = 716,
+    Synthetic_STATE_G71_S6 = 717,
+    Synthetic_STATE_G71_S7 = 718,
+    Synthetic_STATE_G71_S8 = 719,
+    Synthetic_STATE_G72 = 720,
+    Synthetic_STATE_G72_S0 = 721,
+    Synthetic_STATE_G72_S1 = 722,
+    Synthetic_STATE_G72_S2 = 723,
+    Synthetic_STATE_G72_S3 = 724,
+    Synthetic_STATE_G72_S4 = 725,
+    Synthetic_STATE_G72_S5 = 726,
+    Synthetic_STATE_G72_S6 = 727,
+    Synthetic_STATE_G72_S7 = 728,
+    Synthetic_STATE_G72_S8 = 729,
+    Synthetic_STATE_G73 = 730,
+    Synthetic_STATE_G73_S0 = 731,
+    Synthetic_STATE_G73_S1 = 732,
+    Synthetic_STATE_G73_S2 = 733,
+    Synthetic_STATE_G73_S3 = 734,
+    Synthetic_STATE_G73_S4 = 735,
+    Synthetic_STATE_G73_S5 = 736,
+    Synthetic_STATE_G73_S6 = 737,
+    Synthetic_STATE_G73_S7 = 738,
+    Synthetic_STATE_G73_S8 = 739,
+    Synthetic_STATE_G74 = 740,
+    Synthetic_STATE_G74_S0 = 741,
+    Synthetic_STATE_G74_S1 = 742,
+    Synthetic_STATE_G74_S2 = 743,
+    Synthetic_STATE_G74_S3 = 744,
+    Synthetic_STATE_G74_S4 = 745,
+    Synthetic_STATE_G74_S5 = 746,
+    Synthetic_STATE_G74_S6 = 747,
+    Synthetic_STATE_G74_S7 = 748,
+    Synthetic_STATE_G74_S8 = 749,
+    Synthetic_STATE_G75 = 750,
+    Synthetic_STATE_G75_S0 = 751,
+    Synthetic_STATE_G75_S1 = 752,
+    Synthetic_STATE_G75_S2 = 753,
+    Synthetic_STATE_G75_S3 = 754,
+    Synthetic_STATE_G75_S4 = 755,
+    Synthetic_STATE_G75_S5 = 756,
+    Synthetic_STATE_G75_S6 = 757,
+    Synthetic_STATE_G75_S7 = 758,
+    Synthetic_STATE_G75_S8 = 759,
+    Synthetic_STATE_G76 = 760,
+    Synthetic_STATE_G76_S0 = 761,
+    Synthetic_STATE_G76_S1 = 762,
+    Synthetic_STATE_G76_S2 = 763,
+    Synthetic_STATE_G76_S3 = 764,
+    Synthetic_STATE_G76_S4 = 765,
+    Synthetic_STATE_G76_S5 = 766,
+    Synthetic_STATE_G76_S6 = 767,
+    Synthetic_STATE_G76_S7 = 768,
+    Synthetic_STATE_G76_S8 = 769,
+    Synthetic_STATE_G77 = 770,
+    Synthetic_STATE_G77_S0 = 771,
+    Synthetic_STATE_G77_S1 = 772,
+    Synthetic_STATE_G77_S2 = 773,
+    Synthetic_STATE_G77_S3 = 774,
+    Synthetic_STATE_G77_S4 = 775,
+    Synthetic_STATE_G77_S5 = 776,
+    Synthetic_STATE_G77_S6 = 777,
+    Synthetic_STATE_G77_S7 = 778,
+    Synthetic_STATE_G77_S8 = 779,
+    Synthetic_STATE_G78 = 780,
+    Synthetic_STATE_G78_S0 = 781,
+    Synthetic_STATE_G78_S1 = 782,
+    Synthetic_STATE_G78_S2 = 783,
+    Synthetic_STATE_G78_S3 = 784,
+    Synthetic_STATE_G78_S4 = 785,
+    Synthetic_STATE_G78_S5 = 786,
+    Synthetic_STATE_G78_S6 = 787,
+    Synthetic_STATE_G78_S7 = 788,
+    Synthetic_STATE_G78_S8 = 789,
+    Synthetic_STATE_G79 = 790,
+    Synthetic_STATE_G79_S0 = 791,
+    Synthetic_STATE_G79_S1 = 792,
+    Synthetic_STATE_G79_S2 = 793,
+    Synthetic_STATE_G79_S3 = 794,
+    Synthetic_STATE_G79_S4 = 795,
+    Synthetic_STATE_G79_S5 = 796,
+    Synthetic_STATE_G79_S6 = 797,
+    Synthetic_STATE_G79_S7 = 798,
+    Synthetic_STATE_G79_S8 = 799,
+    Synthetic_STATE_G80 = 800,
+    Synthetic_STATE_G80_S0 = 801,
+    Synthetic_STATE_G80_S1 = 802,
+    Synthetic_STATE_G80_S2 = 803,
+    Synthetic_STATE_G80_S3 = 804,
+    Synthetic_STATE_G80_S4 = 805,
+    Synthetic_STATE_G80_S5 = 806,
+    Synthetic_STATE_G80_S6 = 807,
+    Synthetic_STATE_G80_S7 = 808,
+    Synthetic_STATE_G80_S8 = 809,
+    Synthetic_STATE_G81 = 810,
+    Synthetic_STATE_G81_S0 = 811,
+    Synthetic_STATE_G81_S1 = 812,
+    Synthetic_STATE_G81_S2 = 813,
+    Synthetic_STATE_G81_S3 = 814,
+    Synthetic_STATE_G81_S4 = 815,
+    Synthetic_STATE_G81_S5 = 816,
+    Synthetic_STATE_G81_S6 = 817,
+    Synthetic_STATE_G81_S7 = 818,
+    Synthetic_STATE_G81_S8 = 819,
+    Synthetic_STATE_G82 = 820,
+    Synthetic_STATE_G82_S0 = 821,
+    Synthetic_STATE_G82_S1 = 822,
+    Synthetic_STATE_G82_S2 = 823,
+    Synthetic_STATE_G82_S3 = 824,
+    Synthetic_STATE_G82_S4 = 825,
+    Synthetic_STATE_G82_S5 = 826,
+    Synthetic_STATE_G82_S6 = 827,
+    Synthetic_STATE_G82_S7 = 828,
+    Synthetic_STATE_G82_S8 = 829,
+    Synthetic_STATE_G83 = 830,
+    Synthetic_STATE_G83_S0 = 831,
+    Synthetic_STATE_G83_S1 = 832,
+    Synthetic_STATE_G83_S2 = 833,
+    Synthetic_STATE_G83_S3 = 834,
+    Synthetic_STATE_G83_S4 = 835,
+    Synthetic_STATE_G83_S5 = 836,
+    Synthetic_STATE_G83_S6 = 837,
+    Synthetic_STATE_G83_S7 = 838,
+    Synthetic_STATE_G83_S8 = 839,
+    Synthetic_STATE_G84 = 840,
+    Synthetic_STATE_G84_S0 = 841,
+    Synthetic_STATE_G84_S1 = 842,
+    Synthetic_STATE_G84_S2 = 843,
+    Synthetic_STATE_G84_S3 = 844,
+    Synthetic_STATE_G84_S4 = 845,
+    Synthetic_STATE_G84_S5 = 846,
+    Synthetic_STATE_G84_S6 = 847,
+    Synthetic_STATE_G84_S7 = 848,
+    Synthetic_STATE_G84_S8 = 849,
+    Synthetic_STATE_G85 = 850,
+    Synthetic_STATE_G85_S0 = 851,
+    Synthetic_STATE_G85_S1 = 852,
+    Synthetic_STATE_G85_S2 = 853,
+    Synthetic_STATE_G85_S3 = 854,
+    Synthetic_STATE_G85_S4 = 855,
+    Synthetic_STATE_G85_S5 = 856,
+    Synthetic_STATE_G85_S6 = 857,
+    Synthetic_STATE_G85_S7 = 858,
+    Synthetic_STATE_G85_S8 = 859,
+    Synthetic_STATE_G86 = 860,
+    Synthetic_STATE_G86_S0 = 861,
+    Synthetic_STATE_G86_S1 = 862,
+    Synthetic_STATE_G86_S2 = 863,
+    Synthetic_STATE_G86_S3 = 864,
+    Synthetic_STATE_G86_S4 = 865,
+    Synthetic_STATE_G86_S5 = 866,
+    Synthetic_STATE_G86_S6 = 867,
+    Synthetic_STATE_G86_S7 = 868,
+    Synthetic_STATE_G86_S8 = 869,
+    Synthetic_STATE_G87 = 870,
+    Synthetic_STATE_G87_S0 = 871,
+    Synthetic_STATE_G87_S1 = 872,
+    Synthetic_STATE_G87_S2 = 873,
+    Synthetic_STATE_G87_S3 = 874,
+    Synthetic_STATE_G87_S4 = 875,
+    Synthetic_STATE_G87_S5 = 876,
+    Synthetic_STATE_G87_S6 = 877,
+    Synthetic_STATE_G87_S7 = 878,
+    Synthetic_STATE_G87_S8 = 879,
+    Synthetic_STATE_G88 = 880,
+    Synthetic_STATE_G88_S0 = 881,
+    Synthetic_STATE_G88_S1 = 882,
+    Synthetic_STATE_G88_S2 = 883,
+    Synthetic_STATE_G88_S3 = 884,
+    Synthetic_STATE_G88_S4 = 885,
+    Synthetic_STATE_G88_S5 = 886,
+    Synthetic_STATE_G88_S6 = 887,
+    Synthetic_STATE_G88_S7 = 888,
+    Synthetic_STATE_G88_S8 = 889,
+    Synthetic_STATE_G89 = 890,
+    Synthetic_STATE_G89_S0 = 891,
+    Synthetic_STATE_G89_S1 = 892,
+    Synthetic_STATE_G89_S2 = 893,
+    Synthetic_STATE_G89_S3 = 894,
+    Synthetic_STATE_G89_S4 = 895,
+    Synthetic_STATE_G89_S5 = 896,
+    Synthetic_STATE_G89_S6 = 897,
+    Synthetic_STATE_G89_S7 = 898,
+    Synthetic_STATE_G89_S8 = 899,
+    Synthetic_STATE_G90 = 900,
+    Synthetic_STATE_G90_S0 = 901,
+    Synthetic_STATE_G90_S1 = 902,
+    Synthetic_STATE_G90_S2 = 903,
+    Synthetic_STATE_G90_S3 = 904,
+    Synthetic_STATE_G90_S4 = 905,
+    Synthetic_STATE_G90_S5 = 906,
+    Synthetic_STATE_G90_S6 = 907,
+    Synthetic_STATE_G90_S7 = 908,
+    Synthetic_STATE_G90_S8 = 909,
+    Synthetic_STATE_G91 = 910,
+    Synthetic_STATE_G91_S0 = 911,
+    Synthetic_STATE_G91_S1 = 912,
+    Synthetic_STATE_G91_S2 = 913,
+    Synthetic_STATE_G91_S3 = 914,
+    Synthetic_STATE_G91_S4 = 915,
+    Synthetic_STATE_G91_S5 = 916,
+    Synthetic_STATE_G91_S6 = 917,
+    Synthetic_STATE_G91_S7 = 918,
+    Synthetic_STATE_G91_S8 = 919,
+    Synthetic_STATE_G92 = 920,
+    Synthetic_STATE_G92_S0 = 921,
+    Synthetic_STATE_G92_S1 = 922,
+    Synthetic_STATE_G92_S2 = 923,
+    Synthetic_STATE_G92_S3 = 924,
+    Synthetic_STATE_G92_S4 = 925,
+    Synthetic_STATE_G92_S5 = 926,
+    Synthetic_STATE_G92_S6 = 927,
+    Synthetic_STATE_G92_S7 = 928,
+    Synthetic_STATE_G92_S8 = 929,
+    Synthetic_STATE_G93 = 930,
+    Synthetic_STATE_G93_S0 = 931,
+    Synthetic_STATE_G93_S1 = 932,
+    Synthetic_STATE_G93_S2 = 933,
+    Synthetic_STATE_G93_S3 = 934,
+    Synthetic_STATE_G93_S4 = 935,
+    Synthetic_STATE_G93_S5 = 936,
+    Synthetic_STATE_G93_S6 = 937,
+    Synthetic_STATE_G93_S7 = 938,
+    Synthetic_STATE_G93_S8 = 939,
+    Synthetic_STATE_G94 = 940,
+    Synthetic_STATE_G94_S0 = 941,
+    Synthetic_STATE_G94_S1 = 942,
+    Synthetic_STATE_G94_S2 = 943,
+    Synthetic_STATE_G94_S3 = 944,
+    Synthetic_STATE_G94_S4 = 945,
+    Synthetic_STATE_G94_S5 = 946,
+    Synthetic_STATE_G94_S6 = 947,
+    Synthetic_STATE_G94_S7 = 948,
+    Synthetic_STATE_G94_S8 = 949,
+    Synthetic_STATE_G95 = 950,
+    Synthetic_STATE_G95_S0 = 951,
+    Synthetic_STATE_G95_S1 = 952,
+    Synthetic_STATE_G95_S2 = 953,
+    Synthetic_STATE_G95_S3 = 954,
+    Synthetic_STATE_G95_S4 = 955,
+    Synthetic_STATE_G95_S5 = 956,
+    Synthetic_STATE_G95_S6 = 957,
+    Synthetic_STATE_G95_S7 = 958,
+    Synthetic_STATE_G95_S8 = 959,
+    Synthetic_STATE_G96 = 960,
+    Synthetic_STATE_G96_S0 = 961,
+    Synthetic_STATE_G96_S1 = 962,
+    Synthetic_STATE_G96_S2 = 963,
+    Synthetic_STATE_G96_S3 = 964,
+    Synthetic_STATE_G96_S4 = 965,
+    Synthetic_STATE_G96_S5 = 966,
+    Synthetic_STATE_G96_S6 = 967,
+    Synthetic_STATE_G96_S7 = 968,
+    Synthetic_STATE_G96_S8 = 969,
+    Synthetic_STATE_G97 = 970,
+    Synthetic_STATE_G97_S0 = 971,
+    Synthetic_STATE_G97_S1 = 972,
+    Synthetic_STATE_G97_S2 = 973,
+    Synthetic_STATE_G97_S3 = 974,
+    Synthetic_STATE_G97_S4 = 975,
+    Synthetic_STATE_G97_S5 = 976,
+    Synthetic_STATE_G97_S6 = 977,
+    Synthetic_STATE_G97_S7 = 978,
+    Synthetic_STATE_G97_S8 = 979,
+    Synthetic_STATE_G98 = 980,
+    Synthetic_STATE_G98_S0 = 981,
+    Synthetic_STATE_G98_S1 = 982,
+    Synthetic_STATE_G98_S2 = 983,
+    Synthetic_STATE_G98_S3 = 984,
+    Synthetic_STATE_G98_S4 = 985,
+    Synthetic_STATE_G98_S5 = 986,
+    Synthetic_STATE_G98_S6 = 987,
+    Synthetic_STATE_G98_S7 = 988,
+    Synthetic_STATE_G98_S8 = 989,
+    Synthetic_STATE_G99 = 990,
+    Synthetic_STATE_G99_S0 = 991,
+    Synthetic_STATE_G99_S1 = 992,
+    Synthetic_STATE_G99_S2 = 993,
+    Synthetic_STATE_G99_S3 = 994,
+    Synthetic_STATE_G99_S4 = 995,
+    Synthetic_STATE_G99_S5 = 996,
+    Synthetic_STATE_G99_S6 = 997,
+    Synthetic_STATE_G99_S7 = 998,
+    Synthetic_STATE_G99_S8 = 999,
+    Synthetic_STATE_COUNT
+} Synthetic_state_t;
+
+/* Events */
+typedef enum {
+    Synthetic_EVENT_RESET = 0,
+    Synthetic_EVENT_NEXT = 1,
+    Synthetic_EVENT_E0 = 2,
+    Synthetic_EVENT_E1 = 3,
+    Synthetic_EVENT_E2 = 4,
+    Synthetic_EVENT_E3 = 5,
+    Synthetic_EVENT_E4 = 6,
+    Synthetic_EVENT_E5 = 7,
+    Synthetic_EVENT_E6 = 8,
+    Synthetic_EVENT_E7 = 9,
+    Synthetic_EVENT_COUNT
+} Synthetic_event_t;
+
+/* State hierarchy info */
+typedef struct {
+    const char *name;
+    const char *full_path;
+    int parent;       /* -1 if root */
+    int depth;
+    int initial_child; /* -1 if leaf */
+    int has_history;
+} Synthetic_state_info_t;
+
+/* HSM context (supports history) */
+typedef struct {
+    Synthetic_state_t current_state;
+    Synthetic_state_t history[Synthetic_STATE_COUNT]; /* History per composite state */
+    void *user_data;
+} Synthetic_context_t;
+
+/* HSM functions */
+void Synthetic_init(Synthetic_context_t *ctx, void *user_data);
+bool Synthetic_dispatch(Synthetic_context_t *ctx, Synthetic_event_t event);
+const char *Synthetic_state_name(Synthetic_state_t state);
+const char *Synthetic_state_path(Synthetic_state_t state);
+const char *Synthetic_event_name(Synthetic_event_t event);
+int Synthetic_get_parent(Synthetic_state_t state);
+bool Synthetic_is_in(Synthetic_context_t *ctx, Synthetic_state_t state);
+
+/* Action functions (implement these) */
+extern void enter_0_0(Synthetic_context_t *ctx);
+extern void enter_0_1(Synthetic_context_t *ctx);
+extern void enter_0_2(Synthetic_context_t *ctx);
+extern void enter_0_3(Synthetic_context_t *ctx);
+extern void enter_0_4(Synthetic_context_t *ctx);
+extern void enter_0_5(Synthetic_context_t *ctx);
+extern void enter_0_6(Synthetic_context_t *ctx);
+extern void enter_0_7(Synthetic_context_t *ctx);
+extern void enter_0_8(Synthetic_context_t *ctx);
+extern void enter_1_0(Synthetic_context_t *ctx);
+extern void enter_1_1(Synthetic_context_t *ctx);
+extern void enter_1_2(Synthetic_context_t *ctx);
+extern void enter_1_3(Synthetic_context_t *ctx);
+extern void enter_1_4(Synthetic_context_t *ctx);
+extern void enter_1_5(Synthetic_context_t *ctx);
+extern void enter_1_6(Synthetic_context_t *ctx);
+extern void enter_1_7(Synthetic_context_t *ctx);
+extern void enter_1_8(Synthetic_context_t *ctx);
+extern void enter_2_0(Synthetic_context_t *ctx);
+extern void enter_2_1(Synthetic_context_t *ctx);
+extern void enter_2_2(Synthetic_context_t *ctx);
+extern void enter_2_3(Synthetic_context_t *ctx);
+extern void enter_2_4(Synthetic_context_t *ctx);
+extern void enter_2_5(Synthetic_context_t *ctx);
+extern void enter_2_6(Synthetic_context_t *ctx);
+extern void enter_2_7(Synthetic_context_t *ctx);
+extern void enter_2_8(Synthetic_context_t *ctx);
+extern void enter_3_0(Synthetic_context_t *ctx);
+extern void enter_3_1(Synthetic_context_t *ctx);
+extern void enter_3_2(Synthetic_context_t *ctx);
+extern void enter_3_3(Synthetic_context_t *ctx);
+extern void enter_3_4(Synthetic_context_t *ctx);
+extern void enter_3_5(Synthetic_context_t *ctx);
+extern void enter_3_6(Synthetic_context_t *ctx);
+extern void enter_3_7(Synthetic_context_t *ctx);
+extern void enter_3_8(Synthetic_context_t *ctx);
+extern void enter_4_0(Synthetic_context_t *ctx);
+extern void enter_4_1(Synthetic_context_t *ctx);
+extern void enter_4_2(Synthetic_context_t *ctx);
+extern void enter_4_3(Synthetic_context_t *ctx);
+extern void enter_4_4(Synthetic_context_t *ctx);
+extern void enter_4_5(Synthetic_context_t *ctx);
+extern void enter_4_6(Synthetic_context_t *ctx);
+extern void enter_4_7(Synthetic_context_t *ctx);
+extern void enter_4_8(Synthetic_context_t *ctx);
+extern void enter_5_0(Synthetic_context_t *ctx);
+extern void enter_5_1(Synthetic_context_t *ctx);
+extern void enter_5_2(Synthetic_context_t *ctx);
+extern void enter_5_3(Synthetic_context_t *ctx);
+extern void enter_5_4(Synthetic_context_t *ctx);
+extern void enter_5_5(Synthetic_context_t *ctx);
+extern void enter_5_6(Synthetic_context_t *ctx);
+extern void enter_5_7(Synthetic_context_t *ctx);
+extern void enter_5_8(Synthetic_context_t *ctx);
+extern void enter_6_0(Synthetic_context_t *ctx);
+extern void enter_6_1(Synthetic_context_t *ctx);
+extern void enter_6_2(Synthetic_context_t *ctx);
+extern void enter_6_3(Synthetic_context_t *ctx);
+extern void enter_6_4(Synthetic_context_t *ctx);
+extern void enter_6_5(Synthetic_context_t *ctx);
+extern void enter_6_6(Synthetic_context_t *ctx);
+extern void enter_6_7(Synthetic_context_t *ctx);
+extern void enter_6_8(Synthetic_context_t *ctx);
+extern void enter_7_0(Synthetic_context_t *ctx);
+extern void enter_7_1(Synthetic_context_t *ctx);
+extern void enter_7_2(Synthetic_context_t *ctx);
+extern void enter_7_3(Synthetic_context_t *ctx);
+extern void enter_7_4(Synthetic_context_t *ctx);
+extern void enter_7_5(Synthetic_context_t *ctx);
+extern void enter_7_6(Synthetic_context_t *ctx);
+extern void enter_7_7(Synthetic_context_t *ctx);
+extern void enter_7_8(Synthetic_context_t *ctx);
+extern void enter_8_0(Synthetic_context_t *ctx);
+extern void enter_8_1(Synthetic_context_t *ctx);
+extern void enter_8_2(Synthetic_context_t *ctx);
+extern void enter_8_3(Synthetic_context_t *ctx);
+extern void enter_8_4(Synthetic_context_t *ctx);
+extern void enter_8_5(Synthetic_context_t *ctx);
+extern void enter_8_6(Synthetic_context_t *ctx);
+extern void enter_8_7(Synthetic_context_t *ctx);
+extern void enter_8_8(Synthetic_context_t *ctx);
+extern void enter_9_0(Synthetic_context_t *ctx);
+extern void enter_9_1(Synthetic_context_t *ctx);
+extern void enter_9_2(Synthetic_context_t *ctx);
+extern void enter_9_3(Synthetic_context_t *ctx);
+extern void enter_9_4(Synthetic_context_t *ctx);
+extern void enter_9_5(Synthetic_context_t *ctx);
+extern void enter_9_6(Synthetic_context_t *ctx);
+extern void enter_9_7(Synthetic_context_t *ctx);
+extern void enter_9_8(Synthetic_context_t *ctx);
+extern void enter_10_0(Synthetic_context_t *ctx);
+extern void enter_10_1(Synthetic_context_t *ctx);
+extern void enter_10_2(Synthetic_context_t *ctx);
+extern void enter_10_3(Synthetic_context_t *ctx);
+extern void enter_10_4(Synthetic_context_t *ctx);
+extern void enter_10_5(Synthetic_context_t *ctx);
+extern void enter_10_6(Synthetic_context_t *ctx);
+extern void enter_10_7(Synthetic_context_t *ctx);
+extern void enter_10_8(Synthetic_context_t *ctx);
+extern void enter_11_0(Synthetic_context_t *ctx);
+extern void enter_11_1(Synthetic_context_t *ctx);
+extern void enter_11_2(Synthetic_context_t *ctx);
+extern void enter_11_3(Synthetic_context_t *ctx);
+extern void enter_11_4(Synthetic_context_t *ctx);
+extern void enter_11_5(Synthetic_context_t *ctx);
+extern void enter_11_6(Synthetic_context_t *ctx);
+extern void enter_11_7(Synthetic_context_t *ctx);
+extern void enter_11_8(Synthetic_context_t *ctx);
+extern void enter_12_0(Synthetic_context_t *ctx);
+extern void enter_12_1(Synthetic_context_t *ctx);
+extern void enter_12_2(Synthetic_context_t *ctx);
+extern void enter_12_3(Synthetic_context_t *ctx);
+extern void enter_12_4(Synthetic_context_t *ctx);
+extern void enter_12_5(Synthetic_context_t *ctx);
+extern void enter_12_6(Synthetic_context_t *ctx);
+extern void enter_12_7(Synthetic_context_t *ctx);
+extern void enter_12_8(Synthetic_context_t *ctx);
+extern void enter_13_0(Synthetic_context_t *ctx);
+extern void enter_13_1(Synthetic_context_t *ctx);
+extern void enter_13_2(Synthetic_context_t *ctx);
+extern void enter_13_3(Synthetic_context_t *ctx);
+extern void enter_13_4(Synthetic_context_t *ctx);
+extern void enter_13_5(Synthetic_context_t *ctx);
+extern void enter_13_6(Synthetic_context_t *ctx);
+extern void enter_13_7(Synthetic_context_t *ctx);
+extern void enter_13_8(Synthetic_context_t *ctx);
+extern void enter_14_0(Synthetic_context_t *ctx);
+extern void enter_14_1(Synthetic_context_t *ctx);
+extern void enter_14_2(Synthetic_context_t *ctx);
+extern void enter_14_3(Synthetic_context_t *ctx);
+extern void enter_14_4(Synthetic_context_t *ctx);
+extern void enter_14_5(Synthetic_context_t *ctx);
+extern void enter_14_6(Synthetic_context_t *ctx);
+extern void enter_14_7(Synthetic_context_t *ctx);
+extern void enter_14_8(Synthetic_context_t *ctx);
+extern void enter_15_0(Synthetic_context_t *ctx);
+extern void enter_15_1(Synthetic_context_t *ctx);
+extern void enter_15_2(Synthetic_context_t *ctx);
+extern void enter_15_3(Synthetic_context_t *ctx);
+extern void enter_15_4(Synthetic_context_t *ctx);
+extern void enter_15_5(Synthetic_context_t *ctx);
+extern void enter_15_6(Synthetic_context_t *ctx);
+extern void enter_15_7(Synthetic_context_t *ctx);
+extern void enter_15_8(Synthetic_context_t *ctx);
+extern void enter_16_0(Synthetic_context_t *ctx);
+extern void enter_16_1(Synthetic_context_t *ctx);
+extern void enter_16_2(Synthetic_context_t *ctx);
+extern void enter_16_3(Synthetic_context_t *ctx);
+extern void enter_16_4(Synthetic_context_t *ctx);
+extern void enter_16_5(Synthetic_context_t *ctx);
+extern void enter_16_6(Synthetic_context_t *ctx);
+extern void enter_16_7(Synthetic_context_t *ctx);
+extern void enter_16_8(Synthetic_context_t *ctx);
+extern void enter_17_0(Synthetic_context_t *ctx);
+extern void enter_17_1(Synthetic_context_t *ctx);
+extern void enter_17_2(Synthetic_context_t *ctx);
+extern void enter_17_3(Synthetic_context_t *ctx);
+extern void enter_17_4(Synthetic_context_t *ctx);
+extern void enter_17_5(Synthetic_context_t *ctx);
+extern void enter_17_6(Synthetic_context_t *ctx);
+extern void enter_17_7(Synthetic_context_t *ctx);
+extern void enter_17_8(Synthetic_context_t *ctx);
+extern void enter_18_0(Synthetic_context_t *ctx);
+extern void enter_18_1(Synthetic_context_t *ctx);
+extern void enter_18_2(Synthetic_context_t *ctx);
+extern void enter_18_3(Synthetic_context_t *ctx);
+extern void enter_18_4(Synthetic_context_t *ctx);
+extern void enter_18_5(Synthetic_context_t *ctx);
+extern void enter_18_6(Synthetic_context_t *ctx);
+extern void enter_18_7(Synthetic_context_t *ctx);
+extern void enter_18_8(Synthetic_context_t *ctx);
+extern void enter_19_0(Synthetic_context_t *ctx);
+extern void enter_19_1(Synthetic_context_t *ctx);
+extern void enter_19_2(Synthetic_context_t *ctx);
+extern void enter_19_3(Synthetic_context_t *ctx);
+extern void enter_19_4(Synthetic_context_t *ctx);
+extern void enter_19_5(Synthetic_context_t *ctx);
+extern void enter_19_6(Synthetic_context_t *ctx);
+extern void enter_19_7(Synthetic_context_t *ctx);
+extern void enter_19_8(Synthetic_context_t *ctx);
+extern void enter_20_0(Synthetic_context_t *ctx);
+extern void enter_20_1(Synthetic_context_t *ctx);
+extern void enter_20_2(Synthetic_context_t *ctx);
+extern void enter_20_3(Synthetic_context_t *ctx);
+extern void enter_20_4(Synthetic_context_t *ctx);
+extern void enter_20_5(Synthetic_context_t *ctx);
+extern void enter_20_6(Synthetic_context_t *ctx);
+extern void enter_20_7(Synthetic_context_t *ctx);
+extern void enter_20_8(Synthetic_context_t *ctx);
+extern void enter_21_0(Synthetic_context_t *ctx);
+extern void enter_21_1(Synthetic_context_t *ctx);
+extern void enter_21_2(Synthetic_context_t *ctx);
+extern void enter_21_3(Synthetic_context_t *ctx);
+extern void enter_21_4(Synthetic_context_t *ctx);
+extern void enter_21_5(Synthetic_context_t *ctx);
+extern void enter_21_6(Synthetic_context_t *ctx);
+extern void enter_21_7(Synthetic_context_t *ctx);
+extern void enter_21_8(Synthetic_context_t *ctx);
+extern void enter_22_0(Synthetic_context_t *ctx);
+extern void enter_22_1(Synthetic_context_t *ctx);
+extern void enter_22_2(Synthetic_context_t *ctx);
+extern void enter_22_3(Synthetic_context_t *ctx);
+extern void enter_22_4(Synthetic_context_t *ctx);
+extern void enter_22_5(Synthetic_context_t *ctx);
+extern void enter_22_6(Synthetic_context_t *ctx);
+extern void enter_22_7(Synthetic_context_t *ctx);
+extern void enter_22_8(Synthetic_context_t *ctx);
+extern void enter_23_0(Synthetic_context_t *ctx);
+extern void enter_23_1(Synthetic_context_t *ctx);
+extern void enter_23_2(Synthetic_context_t *ctx);
+extern void enter_23_3(Synthetic_context_t *ctx);
+extern void enter_23_4(Synthetic_context_t *ctx);
+extern void enter_23_5(Synthetic_context_t *ctx);
+extern void enter_23_6(Synthetic_context_t *ctx);
+extern void enter_23_7(Synthetic_context_t *ctx);
+extern void enter_23_8(Synthetic_context_t *ctx);
+extern void enter_24_0(Synthetic_context_t *ctx);
+extern void enter_24_1(Synthetic_context_t *ctx);
+extern void enter_24_2(Synthetic_context_t *ctx);
+extern void enter_24_3(Synthetic_context_t *ctx);
+extern void enter_24_4(Synthetic_context_t *ctx);
+extern void enter_24_5(Synthetic_context_t *ctx);
+extern void enter_24_6(Synthetic_context_t *ctx);
+extern void enter_24_7(Synthetic_context_t *ctx);
+extern void enter_24_8(Synthetic_context_t *ctx);
+extern void enter_25_0(Synthetic_context_t *ctx);
+extern void enter_25_1(Synthetic_context_t *ctx);
+extern void enter_25_2(Synthetic_context_t *ctx);
+extern void enter_25_3(Synthetic_context_t *ctx);
+extern void enter_25_4(Synthetic_context_t *ctx);
+extern void enter_25_5(Synthetic_context_t *ctx);
+extern void enter_25_6(Synthetic_context_t *ctx);
+extern void enter_25_7(Synthetic_context_t *ctx);
+extern void enter_25_8(Synthetic_context_t *ctx);
+extern void enter_26_0(Synthetic_context_t *ctx);
+extern void enter_26_1(Synthetic_context_t *ctx);
+extern void enter_26_2(Synthetic_context_t *ctx);
+extern void enter_26_3(Synthetic_context_t *ctx);
+extern void enter_26_4(Synthetic_context_t *ctx);
+extern void enter_26_5(Synthetic_context_t *ctx);
+extern void enter_26_6(Synthetic_context_t *ctx);
+extern void enter_26_7(Synthetic_context_t *ctx);
+extern void enter_26_8(Synthetic_context_t *ctx);
+extern void enter_27_0(Synthetic_context_t *ctx);
+extern void enter_27_1(Synthetic_context_t *ctx);
+extern void enter_27_2(Synthetic_context_t *ctx);
+extern void enter_27_3(Synthetic_context_t *ctx);
+extern void enter_27_4(Synthetic_context_t *ctx);
+extern void enter_27_5(Synthetic_context_t *ctx);
+extern void enter_27_6(Synthetic_context_t *ctx);
+extern void enter_27_7(Synthetic_context_t *ctx);
+extern void enter_27_8(Synthetic_context_t *ctx);
+extern void enter_28_0(Synthetic_context_t *ctx);
+extern void enter_28_1(Synthetic_context_t *ctx);
+extern void enter_28_2(Synthetic_context_t *ctx);
+extern void enter_28_3(Synthetic_context_t *ctx);
+extern void enter_28_4(Synthetic_context_t *ctx);
+extern void enter_28_5(Synthetic_context_t *ctx);
+extern void enter_28_6(Synthetic_context_t *ctx);
+extern void enter_28_7(Synthetic_context_t *ctx);
+extern void enter_28_8(Synthetic_context_t *ctx);
+extern void enter_29_0(Synthetic_context_t *ctx);
+extern void enter_29_1(Synthetic_context_t *ctx);
+extern void enter_29_2(Synthetic_context_t *ctx);
+extern void enter_29_3(Synthetic_context_t *ctx);
+extern void enter_29_4(Synthetic_context_t *ctx);
+extern void enter_29_5(Synthetic_context_t *ctx);
+extern void enter_29_6(Synthetic_context_t *ctx);
+extern void enter_29_7(Synthetic_context_t *ctx);
+extern void enter_29_8(Synthetic_context_t *ctx);
+extern void enter_30_0(Synthetic_context_t *ctx);
+extern void enter_30_1(Synthetic_context_t *ctx);
+extern void enter_30_2(Synthetic_context_t *ctx);
+extern void enter_30_3(Synthetic_context_t *ctx);
+extern void enter_30_4(Synthetic_context_t *ctx);
+extern void enter_30_5(Synthetic_context_t *ctx);
+extern void enter_30_6(Synthetic_context_t *ctx);
+extern void enter_30_7(Synthetic_context_t *ctx);
+extern void enter_30_8(Synthetic_context_t *ctx);
+extern void enter_31_0(Synthetic_context_t *ctx);
+extern void enter_31_1(Synthetic_context_t *ctx);
+extern void enter_31_2(Synthetic_context_t *ctx);
+extern void enter_31_3(Synthetic_context_t *ctx);
+extern void enter_31_4(Synthetic_context_t *ctx);
+extern void enter_31_5(Synthetic_context_t *ctx);
+extern void enter_31_6(Synthetic_context_t *ctx);
+extern void enter_31_7(Synthetic_context_t *ctx);
+extern void enter_31_8(Synthetic_context_t *ctx);
+extern void enter_32_0(Synthetic_context_t *ctx);
+extern void enter_32_1(Synthetic_context_t *ctx);
+extern void enter_32_2(Synthetic_context_t *ctx);
+extern void enter_32_3(Synthetic_context_t *ctx);
+extern void enter_32_4(Synthetic_context_t *ctx);
+extern void enter_32_5(Synthetic_context_t *ctx);
+extern void enter_32_6(Synthetic_context_t *ctx);
+extern void enter_32_7(Synthetic_context_t *ctx);
+extern void enter_32_8(Synthetic_context_t *ctx);
+extern void enter_33_0(Synthetic_context_t *ctx);
+extern void enter_33_1(Synthetic_context_t *ctx);
+extern void enter_33_2(Synthetic_context_t *ctx);
+extern void enter_33_3(Synthetic_context_t *ctx);
+extern void enter_33_4(Synthetic_context_t *ctx);
+extern void enter_33_5(Synthetic_context_t *ctx);
+extern void enter_33_6(Synthetic_context_t *ctx);
+extern void enter_33_7(Synthetic_context_t *ctx);
+extern void enter_33_8(Synthetic_context_t *ctx);
+extern void enter_34_0(Synthetic_context_t *ctx);
+extern void enter_34_1(Synthetic_context_t *ctx);
+extern void enter_34_2(Synthetic_context_t *ctx);
+extern void enter_34_3(Synthetic_context_t *ctx);
+extern void enter_34_4(Synthetic_context_t *ctx);
+extern void enter_34_5(Synthetic_context_t *ctx);
+extern void enter_34_6(Synthetic_context_t *ctx);
+extern void enter_34_7(Synthetic_context_t *ctx);
+extern void enter_34_8(Synthetic_context_t *ctx);
+extern void enter_35_0(Synthetic_context_t *ctx);
+extern void enter_35_1(Synthetic_context_t *ctx);
+extern void enter_35_2(Synthetic_context_t *ctx);
+extern void enter_35_3(Synthetic_context_t *ctx);
+extern void enter_35_4(Synthetic_context_t *ctx);
+extern void enter_35_5(Synthetic_context_t *ctx);
+extern void enter_35_6(Synthetic_context_t *ctx);
+extern void enter_35_7(Synthetic_context_t *ctx);
+extern void enter_35_8(Synthetic_context_t *ctx);
+extern void enter_36_0(Synthetic_context_t *ctx);
+extern void enter_36_1(Synthetic_context_t *ctx);
+extern void enter_36_2(Synthetic_context_t *ctx);
+extern void enter_36_3(Synthetic_context_t *ctx);
+extern void enter_36_4(Synthetic_context_t *ctx);
+extern void enter_36_5(Synthetic_context_t *ctx);
+extern void enter_36_6(Synthetic_context_t *ctx);
+extern void enter_36_7(Synthetic_context_t *ctx);
+extern void enter_36_8(Synthetic_context_t *ctx);
+extern void enter_37_0(Synthetic_context_t *ctx);
+extern void enter_37_1(Synthetic_context_t *ctx);
+extern void enter_37_2(Synthetic_context_t *ctx);
+extern void enter_37_3(Synthetic_context_t *ctx);
+extern void enter_37_4(Synthetic_context_t *ctx);
+extern void enter_37_5(Synthetic_context_t *ctx);
+extern void enter_37_6(Synthetic_context_t *ctx);
+extern void enter_37_7(Synthetic_context_t *ctx);
+extern void enter_37_8(Synthetic_context_t *ctx);
+extern void enter_38_0(Synthetic_context_t *ctx);
+extern void enter_38_1(Synthetic_context_t *ctx);
+extern void enter_38_2(Synthetic_context_t *ctx);
+extern void enter_38_3(Synthetic_context_t *ctx);
+extern void enter_38_4(Synthetic_context_t *ctx);
+extern void enter_38_5(Synthetic_context_t *ctx);
+extern void enter_38_6(Synthetic_context_t *ctx);
+extern void enter_38_7(Synthetic_context_t *ctx);
+extern void enter_38_8(Synthetic_context_t *ctx);
+extern void enter_39_0(Synthetic_context_t *ctx);
+extern void enter_39_1(Synthetic_context_t *ctx);
+extern void enter_39_2(Synthetic_context_t *ctx);
+extern void enter_39_3(Synthetic_context_t *ctx);
+extern void enter_39_4(Synthetic_context_t *ctx);
+extern void enter_39_5(Synthetic_context_t *ctx);
+extern void enter_39_6(Synthetic_context_t *ctx);
+extern void enter_39_7(Synthetic_context_t *ctx);
+extern void enter_39_8(Synthetic_context_t *ctx);
+extern void enter_40_0(Synthetic_context_t *ctx);
+extern void enter_40_1(Synthetic_context_t *ctx);
+extern void enter_40_2(Synthetic_context_t *ctx);
+extern void enter_40_3(Synthetic_context_t *ctx);
+extern void enter_40_4(Synthetic_context_t *ctx);
+extern void enter_40_5(Synthetic_context_t *ctx);
+extern void enter_40_6(Synthetic_context_t *ctx);
+extern void enter_40_7(Synthetic_context_t *ctx);
+extern void enter_40_8(Synthetic_context_t *ctx);
+extern void enter_41_0(Synthetic_context_t *ctx);
+extern void enter_41_1(Synthetic_context_t *ctx);
+extern void enter_41_2(Synthetic_context_t *ctx);
+extern void enter_41_3(Synthetic_context_t *ctx);
+extern void enter_41_4(Synthetic_context_t *ctx);
+extern void enter_41_5(Synthetic_context_t *ctx);
+extern void enter_41_6(Synthetic_context_t *ctx);
+extern void enter_41_7(Synthetic_context_t *ctx);
+extern void enter_41_8(Synthetic_context_t *ctx);
+extern void enter_42_0(Synthetic_context_t *ctx);
+extern void enter_42_1(Synthetic_context_t *ctx);
+extern void enter_42_2(Synthetic_context_t *ctx);
+extern void enter_42_3(Synthetic_context_t *ctx);
+extern void enter_42_4(Synthetic_context_t *ctx);
+extern void enter_42_5(Synthetic_context_t *ctx);
+extern void enter_42_6(Synthetic_context_t *ctx);
+extern void enter_42_7(Synthetic_context_t *ctx);
+extern void enter_42_8(Synthetic_context_t *ctx);
+extern void enter_43_0(Synthetic_context_t *ctx);
+extern void enter_43_1(Synthetic_context_t *ctx);
+extern void enter_43_2(Synthetic_context_t *ctx);
+extern void enter_43_3(Synthetic_context_t *ctx);
+extern void enter_43_4(Synthetic_context_t *ctx);
+extern void enter_43_5(Synthetic_context_t *ctx);
+extern void enter_43_6(Synthetic_context_t *ctx);
+extern void enter_43_7(Synthetic_context_t *ctx);
+extern void enter_43_8(Synthetic_context_t *ctx);
+extern void enter_44_0(Synthetic_context_t *ctx);
+extern void enter_44_1(Synthetic_context_t *ctx);
+extern void enter_44_2(Synthetic_context_t *ctx);
+extern void enter_44_3(Synthetic_context_t *ctx);
+extern void enter_44_4(Synthetic_context_t *ctx);
+extern void enter_44_5(Synthetic_context_t *ctx);
+extern void enter_44_6(Synthetic_context_t *ctx);
+extern void enter_44_7(Synthetic_context_t *ctx);
+extern void enter_44_8(Synthetic_context_t *ctx);
+extern void enter_45_0(Synthetic_context_t *ctx);
+extern void enter_45_1(Synthetic_context_t *ctx);
+extern void enter_45_2(Synthetic_context_t *ctx);
+extern void enter_45_3(Synthetic_context_t *ctx);
+extern void enter_45_4(Synthetic_context_t *ctx);
+extern void enter_45_5(Synthetic_context_t *ctx);
+extern void enter_45_6(Synthetic_context_t *ctx);
+extern void enter_45_7(Synthetic_context_t *ctx);
+extern void enter_45_8(Synthetic_context_t *ctx);
+extern void enter_46_0(Synthetic_context_t *ctx);
+extern void enter_46_1(Synthetic_context_t *ctx);
+extern void enter_46_2(Synthetic_context_t *ctx);
+extern void enter_46_3(Synthetic_context_t *ctx);
+extern void enter_46_4(Synthetic_context_t *ctx);
+extern void enter_46_5(Synthetic_context_t *ctx);
+extern void enter_46_6(Synthetic_context_t *ctx);
+extern void enter_46_7(Synthetic_context_t *ctx);
+extern void enter_46_8(Synthetic_context_t *ctx);
+extern void enter_47_0(Synthetic_context_t *ctx);
+extern void enter_47_1(Synthetic_context_t *ctx);
+extern void enter_47_2(Synthetic_context_t *ctx);
+extern void enter_47_3(Synthetic_context_t *ctx);
+extern void enter_47_4(Synthetic_context_t *ctx);
+extern void enter_47_5(Synthetic_context_t *ctx);
+extern void enter_47_6(Synthetic_context_t *ctx);
+extern void enter_47_7(Synthetic_context_t *ctx);
+extern void enter_47_8(Synthetic_context_t *ctx);
+extern void enter_48_0(Synthetic_context_t *ctx);
+extern void enter_48_1(Synthetic_context_t *ctx);
+extern void enter_48_2(Synthetic_context_t *ctx);
+extern void enter_48_3(Synthetic_context_t *ctx);
+extern void enter_48_4(Synthetic_context_t *ctx);
+extern void enter_48_5(Synthetic_context_t *ctx);
+extern void enter_48_6(Synthetic_context_t *ctx);
+extern void enter_48_7(Synthetic_context_t *ctx);
+extern void enter_48_8(Synthetic_context_t *ctx);
+extern void enter_49_0(Synthetic_context_t *ctx);
+extern void enter_49_1(Synthetic_context_t *ctx);
+extern void enter_49_2(Synthetic_context_t *ctx);
+extern void enter_49_3(Synthetic_context_t *ctx);
+extern void enter_49_4(Synthetic_context_t *ctx);
+extern void enter_49_5(Synthetic_context_t *ctx);
+extern void enter_49_6(Synthetic_context_t *ctx);
+extern void enter_49_7(Synthetic_context_t *ctx);
+extern void enter_49_8(Synthetic_context_t *ctx);
+extern void enter_50_0(Synthetic_context_t *ctx);
+extern void enter_50_1(Synthetic_context_t *ctx);
+extern void enter_50_2(Synthetic_context_t *ctx);
+extern void enter_50_3(Synthetic_context_t *ctx);
+extern void enter_50_4(Synthetic_context_t *ctx);
+extern void enter_50_5(Synthetic_context_t *ctx);
+extern void enter_50_6(Synthetic_context_t *ctx);
+extern void enter_50_7(Synthetic_context_t *ctx);
+extern void enter_50_8(Synthetic_context_t *ctx);
+extern void enter_51_0(Synthetic_context_t *ctx);
+extern void enter_51_1(Synthetic_context_t *ctx);
+extern void enter_51_2(Synthetic_context_t *ctx);
+extern void enter_51_3(Synthetic_context_t *ctx);
+extern void enter_51_4(Synthetic_context_t *ctx);
+extern void enter_51_5(Synthetic_context_t *ctx);
+extern void enter_51_6(Synthetic_context_t *ctx);
+extern void enter_51_7(Synthetic_context_t *ctx);
+extern void enter_51_8(Synthetic_context_t *ctx);
+extern void enter_52_0(Synthetic_context_t *ctx);
+extern void enter_52_1(Synthetic_context_t *ctx);
+extern void enter_52_2(Synthetic_context_t *ctx);
+extern void enter_52_3(Synthetic_context_t *ctx);
+extern void enter_52_4(Synthetic_context_t *ctx);
+extern void enter_52_5(Synthetic_context_t *ctx);
+extern void enter_52_6(Synthetic_context_t *ctx);
+extern void enter_52_7(Synthetic_context_t *ctx);
+extern void enter_52_8(Synthetic_context_t *ctx);
+extern void enter_53_0(Synthetic_context_t *ctx);
+extern void enter_53_1(Synthetic_context_t *ctx);
+extern void enter_53_2(Synthetic_context_t *ctx);
+extern void enter_53_3(Synthetic_context_t *ctx);
+extern void enter_53_4(Synthetic_context_t *ctx);
+extern void enter_53_5(Synthetic_context_t *ctx);
+extern void enter_53_6(Synthetic_context_t *ctx);
+extern void enter_53_7(Synthetic_context_t *ctx);
+extern void enter_53_8(Synthetic_context_t *ctx);
+extern void enter_54_0(Synthetic_context_t *ctx);
+extern void enter_54_1(Synthetic_context_t *ctx);
+extern void enter_54_2(Synthetic_context_t *ctx);
+extern void enter_54_3(Synthetic_context_t *ctx);
+extern void enter_54_4(Synthetic_context_t *ctx);
+extern void enter_54_5(Synthetic_context_t *ctx);
+extern void enter_54_6(Synthetic_context_t *ctx);
+extern void enter_54_7(Synthetic_context_t *ctx);
+extern void enter_54_8(Synthetic_context_t *ctx);
+extern void enter_55_0(Synthetic_context_t *ctx);
+extern void enter_55_1(Synthetic_context_t *ctx);
+extern void enter_55_2(Synthetic_context_t *ctx);
+extern void enter_55_3(Synthetic_context_t *ctx);
+extern void enter_55_4(Synthetic_context_t *ctx);
+extern void enter_55_5(Synthetic_context_t *ctx);
+extern void enter_55_6(Synthetic_context_t *ctx);
+extern void enter_55_7(Synthetic_context_t *ctx);
+extern void enter_55_8(Synthetic_context_t *ctx);
+extern void enter_56_0(Synthetic_context_t *ctx);
+extern void enter_56_1(Synthetic_context_t *ctx);
+extern void enter_56_2(Synthetic_context_t *ctx);
+extern void enter_56_3(Synthetic_context_t *ctx);
+extern void enter_56_4(Synthetic_context_t *ctx);
+extern void enter_56_5(Synthetic_context_t *ctx);
+extern void enter_56_6(Synthetic_context_t *ctx);
+extern void enter_56_7(Synthetic_context_t *ctx);
+extern void enter_56_8(Synthetic_context_t *ctx);
+extern void enter_57_0(Synthetic_context_t *ctx);
+extern void enter_57_1(Synthetic_context_t *ctx);
+extern void enter_57_2(Synthetic_context_t *ctx);
+extern void enter_57_3(Synthetic_context_t *ctx);
+extern void enter_57_4(Synthetic_context_t *ctx);
+extern void enter_57_5(Synthetic_context_t *ctx);
+extern void enter_57_6(Synthetic_context_t *ctx);
+extern void enter_57_7(Synthetic_context_t *ctx);
+extern void enter_57_8(Synthetic_context_t *ctx);
+extern void enter_58_0(Synthetic_context_t *ctx);
+extern void enter_58_1(Synthetic_context_t *ctx);
+extern void enter_58_2(Synthetic_context_t *ctx);
+extern void enter_58_3(Synthetic_context_t *ctx);
+extern void enter_58_4(Synthetic_context_t *ctx);
+extern void enter_58_5(Synthetic_context_t *ctx);
+extern void enter_58_6(Synthetic_context_t *ctx);
+extern void enter_58_7(Synthetic_context_t *ctx);
+extern void enter_58_8(Synthetic_context_t *ctx);
+extern void enter_59_0(Synthetic_context_t *ctx);
+extern void enter_59_1(Synthetic_context_t *ctx);
+extern void enter_59_2(Synthetic_context_t *ctx);
+extern void enter_59_3(Synthetic_context_t *ctx);
+extern void enter_59_4(Synthetic_context_t *ctx);
+extern void enter_59_5(Synthetic_context_t *ctx);
+extern void enter_59_6(Synthetic_context_t *ctx);
+extern void enter_59_7(Synthetic_context_t *ctx);
+extern void enter_59_8(Synthetic_context_t *ctx);
+extern void enter_60_0(Synthetic_context_t *ctx);
+extern void enter_60_1(Synthetic_context_t *ctx);
+extern void enter_60_2(Synthetic_context_t *ctx);
+extern void enter_60_3(Synthetic_context_t *ctx);
+extern void enter_60_4(Synthetic_context_t *ctx);
+extern void enter_60_5(Synthetic_context_t *ctx);
+extern void enter_60_6(Synthetic_context_t *ctx);
+extern void enter_60_7(Synthetic_context_t *ctx);
+extern void enter_60_8(Synthetic_context_t *ctx);
+extern void enter_61_0(Synthetic_context_t *ctx);
+extern void enter_61_1(Synthetic_context_t *ctx);
+extern void enter_61_2(Synthetic_context_t *ctx);
+extern void enter_61_3(Synthetic_context_t *ctx);
+extern void enter_61_4(Synthetic_context_t *ctx);
+extern void enter_61_5(Synthetic_context_t *ctx);
+extern void enter_61_6(Synthetic_context_t *ctx);
+extern void enter_61_7(Synthetic_context_t *ctx);
+extern void enter_61_8(Synthetic_context_t *ctx);
+extern void enter_62_0(Synthetic_context_t *ctx);
+extern void enter_62_1(Synthetic_context_t *ctx);
+extern void enter_62_2(Synthetic_context_t *ctx);
+extern void enter_62_3(Synthetic_context_t *ctx);
+extern void enter_62_4(Synthetic_context_t *ctx);
+extern void enter_62_5(Synthetic_context_t *ctx);
+extern void enter_62_6(Synthetic_context_t *ctx);
+extern void enter_62_7(Synthetic_context_t *ctx);
+extern void enter_62_8(Synthetic_context_t *ctx);
+extern void enter_63_0(Synthetic_context_t *ctx);
+extern void enter_63_1(Synthetic_context_t *ctx);
+extern void enter_63_2(Synthetic_context_t *ctx);
+extern void enter_63_3(Synthetic_context_t *ctx);
+extern void enter_63_4(Synthetic_context_t *ctx);
+extern void enter_63_5(Synthetic_context_t *ctx);
+extern void enter_63_6(Synthetic_context_t *ctx);
+extern void enter_63_7(Synthetic_context_t *ctx);
+extern void enter_63_8(Synthetic_context_t *ctx);
+extern void enter_64_0(Synthetic_context_t *ctx);
+extern void enter_64_1(Synthetic_context_t *ctx);
+extern void enter_64_2(Synthetic_context_t *ctx);
+extern void enter_64_3(Synthetic_context_t *ctx);
+extern void enter_64_4(Synthetic_context_t *ctx);
+extern void enter_64_5(Synthetic_context_t *ctx);
+extern void enter_64_6(Synthetic_context_t *ctx);
+extern void enter_64_7(Synthetic_context_t *ctx);
+extern void enter_64_8(Synthetic_context_t *ctx);
+extern void enter_65_0(Synthetic_context_t *ctx);
+extern void enter_65_1(Synthetic_context_t *ctx);
+extern void enter_65_2(Synthetic_context_t *ctx);
+extern void enter_65_3(Synthetic_context_t *ctx);
+extern void enter_65_4(Synthetic_context_t *ctx);
+extern void enter_65_5(Synthetic_context_t *ctx);
+extern void enter_65_6(Synthetic_context_t *ctx);
+extern void enter_65_7(Synthetic_context_t *ctx);
+extern void enter_65_8(Synthetic_context_t *ctx);
+extern void enter_66_0(Synthetic_context_t *ctx);
+extern void enter_66_1(Synthetic_context_t *ctx);
+extern void enter_66_2(Synthetic_context_t *ctx);
+extern void enter_66_3(Synthetic_context_t *ctx);
+extern void enter_66_4(Synthetic_context_t *ctx);
+extern void enter_66_5(Synthetic_context_t *ctx);
+extern void enter_66_6(Synthetic_context_t *ctx);
+extern void enter_66_7(Synthetic_context_t *ctx);
+extern void enter_66_8(Synthetic_context_t *ctx);
+extern void enter_67_0(Synthetic_context_t *ctx);
+extern void enter_67_1(Synthetic_context_t *ctx);
+extern void enter_67_2(Synthetic_context_t *ctx);
+extern void enter_67_3(Synthetic_context_t *ctx);
+extern void enter_67_4(Synthetic_context_t *ctx);
+extern void enter_67_5(Synthetic_context_t *ctx);
+extern void enter_67_6(Synthetic_context_t *ctx);
+extern void enter_67_7(Synthetic_context_t *ctx);
+extern void enter_67_8(Synthetic_context_t *ctx);
+extern void enter_68_0(Synthetic_context_t *ctx);
+extern void enter_68_1(Synthetic_context_t *ctx);
+extern void enter_68_2(Synthetic_context_t *ctx);
+extern void enter_68_3(Synthetic_context_t *ctx);
+extern void enter_68_4(Synthetic_context_t *ctx);
+extern void enter_68_5(Synthetic_context_t *ctx);
+extern void enter_68_6(Synthetic_context_t *ctx);
+extern void enter_68_7(Synthetic_context_t *ctx);
+extern void enter_68_8(Synthetic_context_t *ctx);
+extern void enter_69_0(Synthetic_context_t *ctx);
+extern void enter_69_1(Synthetic_context_t *ctx);
+extern void enter_69_2(Synthetic_context_t *ctx);
+extern void enter_69_3(Synthetic_context_t *ctx);
+extern void enter_69_4(Synthetic_context_t *ctx);
+extern void enter_69_5(Synthetic_context_t *ctx);
+extern void enter_69_6(Synthetic_context_t *ctx);
+extern void enter_69_7(Synthetic_context_t *ctx);
+extern void enter_69_8(Synthetic_context_t *ctx);
+extern void enter_70_0(Synthetic_context_t *ctx);
+extern void enter_70_1(Synthetic_context_t *ctx);
+extern void enter_70_2(Synthetic_context_t *ctx);
+extern void enter_70_3(Synthetic_context_t *ctx);
+extern void enter_70_4(Synthetic_context_t *ctx);
+extern void enter_70_5(Synthetic_context_t *ctx);
+extern void enter_70_6(Synthetic_context_t *ctx);
+extern void enter_70_7(Synthetic_context_t *ctx);
+extern void enter_70_8(Synthetic_context_t *ctx);
+extern void enter_71_0(Synthetic_context_t *ctx);
+extern void enter_71_1(Synthetic_context_t *ctx);
+extern void enter_71_2(Synthetic_context_t *ctx);
+extern void enter_71_3(Synthetic_context_t *ctx);
+extern void enter_71_4(Synthetic_context_t *ctx);
+extern void enter_71_5(Synthetic_context_t *ctx);
+extern void enter_71_6(Synthetic_context_t *ctx);
+extern void enter_71_7(Synthetic_context_t *ctx);
+extern void enter_71_8(Synthetic_context_t *ctx);
+extern void enter_72_0(Synthetic_context_t *ctx);
+extern void enter_72_1(Synthetic_context_t *ctx);
+extern void enter_72_2(Synthetic_context_t *ctx);
+extern void enter_72_3(Synthetic_context_t *ctx);
+extern void enter_72_4(Synthetic_context_t *ctx);
+extern void enter_72_5(Synthetic_context_t *ctx);
+extern void enter_72_6(Synthetic_context_t *ctx);
+extern void enter_72_7(Synthetic_context_t *ctx);
+extern void enter_72_8(Synthetic_context_t *ctx);
+extern void enter_73_0(Synthetic_context_t *ctx);
+extern void enter_73_1(Synthetic_context_t *ctx);
+extern void enter_73_2(Synthetic_context_t *ctx);
+extern void enter_73_3(Synthetic_context_t *ctx);
+extern void enter_73_4(Synthetic_context_t *ctx);
+extern void enter_73_5(Synthetic_context_t *ctx);
+extern void enter_73_6(Synthetic_context_t *ctx);
+extern void enter_73_7(Synthetic_context_t *ctx);
+extern void enter_73_8(Synthetic_context_t *ctx);
+extern void enter_74_0(Synthetic_context_t *ctx);
+extern void enter_74_1(Synthetic_context_t *ctx);
+extern void enter_74_2(Synthetic_context_t *ctx);
+extern void enter_74_3(Synthetic_context_t *ctx);
+extern void enter_74_4(Synthetic_context_t *ctx);
+extern void enter_74_5(Synthetic_context_t *ctx);
+extern void enter_74_6(Synthetic_context_t *ctx);
+extern void enter_74_7(Synthetic_context_t *ctx);
+extern void enter_74_8(Synthetic_context_t *ctx);
+extern void enter_75_0(Synthetic_context_t *ctx);
+extern void enter_75_1(Synthetic_context_t *ctx);
+extern void enter_75_2(Synthetic_context_t *ctx);
+extern void enter_75_3(Synthetic_context_t *ctx);
+extern void enter_75_4(Synthetic_context_t *ctx);
+extern void enter_75_5(Synthetic_context_t *ctx);
+extern void enter_75_6(Synthetic_context_t *ctx);
+extern void enter_75_7(Synthetic_context_t *ctx);
+extern void enter_75_8(Synthetic_context_t *ctx);
+extern void enter_76_0(Synthetic_context_t *ctx);
+extern void enter_76_1(Synthetic_context_t *ctx);
+extern void enter_76_2(Synthetic_context_t *ctx);
+extern void enter_76_3(Synthetic_context_t *ctx);
+extern void enter_76_4(Synthetic_context_t *ctx);
+extern void enter_76_5(Synthetic_context_t *ctx);
+extern void enter_76_6(Synthetic_context_t *ctx);
+extern void enter_76_7(Synthetic_context_t *ctx);
+extern void enter_76_8(Synthetic_context_t *ctx);
+extern void enter_77_0(Synthetic_context_t *ctx);
+extern void enter_77_1(Synthetic_context_t *ctx);
+extern void enter_77_2(Synthetic_context_t *ctx);
+extern void enter_77_3(Synthetic_context_t *ctx);
+extern void enter_77_4(Synthetic_context_t *ctx);
+extern void enter_77_5(Synthetic_context_t *ctx);
+extern void enter_77_6(Synthetic_context_t *ctx);
+extern void enter_77_7(Synthetic_context_t *ctx);
+extern void enter_77_8(Synthetic_context_t *ctx);
+extern void enter_78_0(Synthetic_context_t *ctx);
+extern void enter_78_1(Synthetic_context_t *ctx);
+extern void enter_78_2(Synthetic_context_t *ctx);
+extern void enter_78_3(Synthetic_context_t *ctx);
+extern void enter_78_4(Synthetic_context_t *ctx);
+extern void enter_78_5(Synthetic_context_t *ctx);
+extern void enter_78_6(Synthetic_context_t *ctx);
+extern void enter_78_7(Synthetic_context_t *ctx);
+extern void enter_78_8(Synthetic_context_t *ctx);
+extern void enter_79_0(Synthetic_context_t *ctx);
+extern void enter_79_1(Synthetic_context_t *ctx);
+extern void enter_79_2(Synthetic_context_t *ctx);
+extern void enter_79_3(Synthetic_context_t *ctx);
+extern void enter_79_4(Synthetic_context_t *ctx);
+extern void enter_79_5(Synthetic_context_t *ctx);
+extern void enter_79_6(Synthetic_context_t *ctx);
+extern void enter_79_7(Synthetic_context_t *ctx);
+extern void enter_79_8(Synthetic_context_t *ctx);
+extern void enter_80_0(Synthetic_context_t *ctx);
+extern void enter_80_1(Synthetic_context_t *ctx);
+extern void enter_80_2(Synthetic_context_t *ctx);
+extern void enter_80_3(Synthetic_context_t *ctx);
+extern void enter_80_4(Synthetic_context_t *ctx);
+extern void enter_80_5(Synthetic_context_t *ctx);
+extern void enter_80_6(Synthetic_context_t *ctx);
+extern void enter_80_7(Synthetic_context_t *ctx);
+extern void enter_80_8(Synthetic_context_t *ctx);
+extern void enter_81_0(Synthetic_context_t *ctx);
+extern void enter_81_1(Synthetic_context_t *ctx);
+extern void enter_81_2(Synthetic_context_t *ctx);
+extern void enter_81_3(Synthetic_context_t *ctx);
+extern void enter_81_4(Synthetic_context_t *ctx);
+extern void enter_81_5(Synthetic_context_t *ctx);
+extern void enter_81_6(Synthetic_context_t *ctx);
+extern void enter_81_7(Synthetic_context_t *ctx);
+extern void enter_81_8(Synthetic_context_t *ctx);
+extern void enter_82_0(Synthetic_context_t *ctx);
+extern void enter_82_1(Synthetic_context_t *ctx);
+extern void enter_82_2(Synthetic_context_t *ctx);
+extern void enter_82_3(Synthetic_context_t *ctx);
+extern void enter_82_4(Synthetic_context_t *ctx);
+extern void enter_82_5(Synthetic_context_t *ctx);
+extern void enter_82_6(Synthetic_context_t *ctx);
+extern void enter_82_7(Synthetic_context_t *ctx);
+extern void enter_82_8(Synthetic_context_t *ctx);
+extern void enter_83_0(Synthetic_context_t *ctx);
+extern void enter_83_1(Synthetic_context_t *ctx);
+extern void enter_83_2(Synthetic_context_t *ctx);
+extern void enter_83_3(Synthetic_context_t *ctx);
+extern void enter_83_4(Synthetic_context_t *ctx);
+extern void enter_83_5(Synthetic_context_t *ctx);
+extern void enter_83_6(Synthetic_context_t *ctx);
+extern void enter_83_7(Synthetic_context_t *ctx);
+extern void enter_83_8(Synthetic_context_t *ctx);
+extern void enter_84_0(Synthetic_context_t *ctx);
+extern void enter_84_1(Synthetic_context_t *ctx);
+extern void enter_84_2(Synthetic_context_t *ctx);
+extern void enter_84_3(Synthetic_context_t *ctx);
+extern void enter_84_4(Synthetic_context_t *ctx);
+extern void enter_84_5(Synthetic_context_t *ctx);
+extern void enter_84_6(Synthetic_context_t *ctx);
+extern void enter_84_7(Synthetic_context_t *ctx);
+extern void enter_84_8(Synthetic_context_t *ctx);
+extern void enter_85_0(Synthetic_context_t *ctx);
+extern void enter_85_1(Synthetic_context_t *ctx);
+extern void enter_85_2(Synthetic_context_t *ctx);
+extern void enter_85_3(Synthetic_context_t *ctx);
+extern void enter_85_4(Synthetic_context_t *ctx);
+extern void enter_85_5(Synthetic_context_t *ctx);
+extern void enter_85_6(Synthetic_context_t *ctx);
+extern void enter_85_7(Synthetic_context_t *ctx);
+extern void enter_85_8(Synthetic_context_t *ctx);
+extern void enter_86_0(Synthetic_context_t *ctx);
+extern void enter_86_1(Synthetic_context_t *ctx);
+extern void enter_86_2(Synthetic_context_t *ctx);
+extern void enter_86_3(Synthetic_context_t *ctx);
+extern void enter_86_4(Synthetic_context_t *ctx);
+extern void enter_86_5(Synthetic_context_t *ctx);
+extern void enter_86_6(Synthetic_context_t *ctx);
+extern void enter_86_7(Synthetic_context_t *ctx);
+extern void enter_86_8(Synthetic_context_t *ctx);
+extern void enter_87_0(Synthetic_context_t *ctx);
+extern void enter_87_1(Synthetic_context_t *ctx);
+extern void enter_87_2(Synthetic_context_t *ctx);
+extern void enter_87_3(Synthetic_context_t *ctx);
+extern void enter_87_4(Synthetic_context_t *ctx);
+extern void enter_87_5(Synthetic_context_t *ctx);
+extern void enter_87_6(Synthetic_context_t *ctx);
+extern void enter_87_7(Synthetic_context_t *ctx);
+extern void enter_87_8(Synthetic_context_t *ctx);
+extern void enter_88_0(Synthetic_context_t *ctx);
+extern void enter_88_1(Synthetic_context_t *ctx);
+extern void enter_88_2(Synthetic_context_t *ctx);
+extern void enter_88_3(Synthetic_context_t *ctx);
+extern void enter_88_4(Synthetic_context_t *ctx);
+extern void enter_88_5(Synthetic_context_t *ctx);
+extern void enter_88_6(Synthetic_context_t *ctx);
+extern void enter_88_7(Synthetic_context_t *ctx);
+extern void enter_88_8(Synthetic_context_t *ctx);
+extern void enter_89_0(Synthetic_context_t *ctx);
+extern void enter_89_1(Synthetic_context_t *ctx);
+extern void enter_89_2(Synthetic_context_t *ctx);
+extern void enter_89_3(Synthetic_context_t *ctx);
+extern void enter_89_4(Synthetic_context_t *ctx);
+extern void enter_89_5(Synthetic_context_t *ctx);
+extern void enter_89_6(Synthetic_context_t *ctx);
+extern void enter_89_7(Synthetic_context_t *ctx);
+extern void enter_89_8(Synthetic_context_t *ctx);
+extern void enter_90_0(Synthetic_context_t *ctx);
+extern void enter_90_1(Synthetic_context_t *ctx);
+extern void enter_90_2(Synthetic_context_t *ctx);
+extern void enter_90_3(Synthetic_context_t *ctx);
+extern void enter_90_4(Synthetic_context_t *ctx);
+extern void enter_90_5(Synthetic_context_t *ctx);
+extern void enter_90_6(Synthetic_context_t *ctx);
+extern void enter_90_7(Synthetic_context_t *ctx);
+extern void enter_90_8(Synthetic_context_t *ctx);
+extern void enter_91_0(Synthetic_context_t *ctx);
+extern void enter_91_1(Synthetic_context_t *ctx);
+extern void enter_91_2(Synthetic_context_t *ctx);
+extern void enter_91_3(Synthetic_context_t *ctx);
+extern void enter_91_4(Synthetic_context_t *ctx);
+extern void enter_91_5(Synthetic_context_t *ctx);
+extern void enter_91_6(Synthetic_context_t *ctx);
+extern void enter_91_7(Synthetic_context_t *ctx);
+extern void enter_91_8(Synthetic_context_t *ctx);
+extern void enter_92_0(Synthetic_context_t *ctx);
+extern void enter_92_1(Synthetic_context_t *ctx);
+extern void enter_92_2(Synthetic_context_t *ctx);
+extern void enter_92_3(Synthetic_context_t *ctx);
+extern void enter_92_4(Synthetic_context_t *ctx);
+extern void enter_92_5(Synthetic_context_t *ctx);
+extern void enter_92_6(Synthetic_context_t *ctx);
+extern void enter_92_7(Synthetic_context_t *ctx);
+extern void enter_92_8(Synthetic_context_t *ctx);
+extern void enter_93_0(Synthetic_context_t *ctx);
+extern void enter_93_1(Synthetic_context_t *ctx);
+extern void enter_93_2(Synthetic_context_t *ctx);
+extern void enter_93_3(Synthetic_context_t *ctx);
+extern void enter_93_4(Synthetic_context_t *ctx);
+extern void enter_93_5(Synthetic_context_t *ctx);
+extern void enter_93_6(Synthetic_context_t *ctx);
+extern void enter_93_7(Synthetic_context_t *ctx);
+extern void enter_93_8(Synthetic_context_t *ctx);
+extern void enter_94_0(Synthetic_context_t *ctx);
+extern void enter_94_1(Synthetic_context_t *ctx);
+extern void enter_94_2(Synthetic_context_t *ctx);
+extern void enter_94_3(Synthetic_context_t *ctx);
+extern void enter_94_4(Synthetic_context_t *ctx);
+extern void enter_94_5(Synthetic_context_t *ctx);
+extern void enter_94_6(Synthetic_context_t *ctx);
+extern void enter_94_7(Synthetic_context_t *ctx);
+extern void enter_94_8(Synthetic_context_t *ctx);
+extern void enter_95_0(Synthetic_context_t *ctx);
+extern void enter_95_1(Synthetic_context_t *ctx);
+extern void enter_95_2(Synthetic_context_t *ctx);
+extern void enter_95_3(Synthetic_context_t *ctx);
+extern void enter_95_4(Synthetic_context_t *ctx);
+extern void enter_95_5(Synthetic_context_t *ctx);
+extern void enter_95_6(Synthetic_context_t *ctx);
+extern void enter_95_7(Synthetic_context_t *ctx);
+extern void enter_95_8(Synthetic_context_t *ctx);
+extern void enter_96_0(Synthetic_context_t *ctx);
+extern void enter_96_1(Synthetic_context_t *ctx);
+extern void enter_96_2(Synthetic_context_t *ctx);
+extern void enter_96_3(Synthetic_context_t *ctx);
+extern void enter_96_4(Synthetic_context_t *ctx);
+extern void enter_96_5(Synthetic_context_t *ctx);
+extern void enter_96_6(Synthetic_context_t *ctx);
+extern void enter_96_7(Synthetic_context_t *ctx);
+extern void enter_96_8(Synthetic_context_t *ctx);
+extern void enter_97_0(Synthetic_context_t *ctx);
+extern void enter_97_1(Synthetic_context_t *ctx);
+extern void enter_97_2(Synthetic_context_t *ctx);
+extern void enter_97_3(Synthetic_context_t *ctx);
+extern void enter_97_4(Synthetic_context_t *ctx);
+extern void enter_97_5(Synthetic_context_t *ctx);
+extern void enter_97_6(Synthetic_context_t *ctx);
+extern void enter_97_7(Synthetic_context_t *ctx);
+extern void enter_97_8(Synthetic_context_t *ctx);
+extern void enter_98_0(Synthetic_context_t *ctx);
+extern void enter_98_1(Synthetic_context_t *ctx);
+extern void enter_98_2(Synthetic_context_t *ctx);
+extern void enter_98_3(Synthetic_context_t *ctx);
+extern void enter_98_4(Synthetic_context_t *ctx);
+extern void enter_98_5(Synthetic_context_t *ctx);
+extern void enter_98_6(Synthetic_context_t *ctx);
+extern void enter_98_7(Synthetic_context_t *ctx);
+extern void enter_98_8(Synthetic_context_t *ctx);
+extern void enter_99_0(Synthetic_context_t *ctx);
+extern void enter_99_1(Synthetic_context_t *ctx);
+extern void enter_99_2(Synthetic_context_t *ctx);
+extern void enter_99_3(Synthetic_context_t *ctx);
+extern void enter_99_4(Synthetic_context_t *ctx);
+extern void enter_99_5(Synthetic_context_t *ctx);
+extern void enter_99_6(Synthetic_context_t *ctx);
+extern void enter_99_7(Synthetic_context_t *ctx);
+extern void enter_99_8(Synthetic_context_t *ctx);
+
+#endif /* SYNTHETIC_HSM_H */
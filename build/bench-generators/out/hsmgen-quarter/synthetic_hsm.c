@@ -0,0 +1,3898 @@
+/* AUTO-GENERATED by hsmgen 1.0.0 — DO NOT EDIT */
+
+#include "synthetic_hsm.h"
+#include <stddef.h>
+#include <string.h>
+
+/* State hierarchy table */
+static const Synthetic_state_info_t state_info[] = {
+    {"G0", "G0", -1, 0, 1, 0},
+    {"S0", "G0.S0", 0, 1, -1, 0},
+    {"S1", "G0.S1", 0, 1, -1, 0},
+    {"S2", "G0.S2", 0, 1, -1, 0},
+    {"S3", "G0.S3", 0, 1, -1, 0},
+    {"S4", "G0.S4", 0, 1, -1, 0},
+    {"S5", "G0.S5", 0, 1, -1, 0},
+    {"S6", "G0.S6", 0, 1, -1, 0},
+    {"S7", "G0.S7", 0, 1, -1, 0},
+    {"S8", "G0.S8", 0, 1, -1, 0},
+    {"G1", "G1", -1, 0, 11, 0},
+    {"S0", "G1.S0", 10, 1, -1, 0},
+    {"S1", "G1.S1", 10, 1, -1, 0},
+    {"S2", "G1.S2", 10, 1, -1, 0},
+    {"S3", "G1.S3", 10, 1, -1, 0},
+    {"S4", "G1.S4", 10, 1, -1, 0},
+    {"S5", "G1.S5", 10, 1, -1, 0},
+    {"S6", "G1.S6", 10, 1, -1, 0},
+    {"S7", "G1.S7", 10, 1, -1, 0},
+    {"S8", "G1.S8", 10, 1, -1, 0},
+    {"G2", "G2", -1, 0, 21, 0},
+    {"S0", "G2.S0", 20, 1, -1, 0},
+    {"S1", "G2.S1", 20, 1, -1, 0},
+    {"S2", "G2.S2", 20, 1, -1, 0},
+    {"S3", "G2.S3", 20, 1, -1, 0},
+    {"S4", "G2.S4", 20, 1, -1, 0},
+    {"S5", "G2.S5", 20, 1, -1, 0},
+    {"S6", "G2.S6", 20, 1, -1, 0},
+    {"S7", "G2.S7", 20, 1, -1, 0},
+    {"S8", "G2.S8", 20, 1, -1, 0},
+    {"G3", "G3", -1, 0, 31, 0},
+    {"S0", "G3.S0", 30, 1, -1, 0},
+    {"S1", "G3.S1", 30, 1, -1, 0},
+    {"S2", "G3.S2", 30, 1, -1, 0},
+    {"S3", "G3.S3", 30, 1, -1, 0},
+    {"S4", "G3.S4", 30, 1, -1, 0},
+    {"S5", "G3.S5", 30, 1, -1, 0},
+    {"S6", "G3.S6", 30, 1, -1, 0},
+    {"S7", "G3.S7", 30, 1, -1, 0},
+    {"S8", "G3.S8", 30, 1, -1, 0},
+    {"G4", "G4", -1, 0, 41, 0},
+    {"S0", "G4.S0", 40, 1, -1, 0},
+    {"S1", "G4.S1", 40, 1, -1, 0},
+    {"S2", "G4.S2", 40, 1, -1, 0},
+    {"S3", "G4.S3", 40, 1, -1, 0},
+    {"S4", "G4.S4", 40, 1, -1, 0},
+    {"S5", "G4.S5", 40, 1, -1, 0},
+    {"S6", "G4.S6", 40, 1, -1, 0},
+    {"S7", "G4.S7", 40, 1, -1, 0},
+    {"S8", "G4.S8", 40, 1, -1, 0},
+    {"G5", "G5", -1, 0, 51, 0},
+    {"S0", "G5.S0", 50, 1, -1, 0},
+    {"S1", "G5.S1", 50, 1, -1, 0},
+    {"S2", "G5.S2", 50, 1, -1, 0},
+    {"S3", "G5.S3", 50, 1, -1, 0},
+    {"S4", "G5.S4", 50, 1, -1, 0},
+    {"S5", "G5.S5", 50, 1, -1, 0},
+    {"S6", "G5.S6", 50, 1, -1, 0},
+    {"S7", "G5.S7", 50, 1, -1, 0},
+    {"S8", "G5.S8", 50, 1, -1, 0},
+    {"G6", "G6", -1, 0, 61, 0},
+    {"S0", "G6.S0", 60, 1, -1, 0},
+    {"S1", "G6.S1", 60, 1, -1, 0},
+    {"S2", "G6.S2", 60, 1, -1, 0},
+    {"S3", "G6.S3", 60, 1, -1, 0},
+    {"S4", "G6.S4", 60, 1, -1, 0},
+    {"S5", "G6.S5", 60, 1, -1, 0},
+    {"S6", "G6.S6", 60, 1, -1, 0},
+    {"S7", "G6.S7", 60, 1, -1, 0},
+    {"S8", "G6.S8", 60, 1, -1, 0},
+    {"G7", "G7", -1, 0, 71, 0},
+    {"S0", "G7.S0", 70, 1, -1, 0},
+    {"S1", "G7.S1", 70, 1, -1, 0},
+    {"S2", "G7.S2", 70, 1, -1, 0},
+    {"S3", "G7.S3", 70, 1, -1, 0},
+    {"S4", "G7.S4", 70, 1, -1, 0},
+    {"S5", "G7.S5", 70, 1, -1, 0},
+    {"S6", "G7.S6", 70, 1, -1, 0},
+    {"S7", "G7.S7", 70, 1, -1, 0},
+    {"S8", "G7.S8", 70, 1, -1, 0},
+    {"G8", "G8", -1, 0, 81, 0},
+    {"S0", "G8.S0", 80, 1, -1, 0},
+    {"S1", "G8.S1", 80, 1, -1, 0},
+    {"S2", "G8.S2", 80, 1, -1, 0},
+    {"S3", "G8.S3", 80, 1, -1, 0},
+    {"S4", "G8.S4", 80, 1, -1, 0},
+    {"S5", "G8.S5", 80, 1, -1, 0},
+    {"S6", "G8.S6", 80, 1, -1, 0},
+    {"S7", "G8.S7", 80, 1, -1, 0},
+    {"S8", "G8.S8", 80, 1, -1, 0},
+    {"G9", "G9", -1, 0, 91, 0},
+    {"S0", "G9.S0", 90, 1, -1, 0},
+    {"S1", "G9.S1", 90, 1, -1, 0},
+    {"S2", "G9.S2", 90, 1, -1, 0},
+    {"S3", "G9.S3", 90, 1, -1, 0},
+    {"S4", "G9.S4", 90, 1, -1, 0},
+    {"S5", "G9.S5", 90, 1, -1, 0},
+    {"S6", "G9.S6", 90, 1, -1, 0},
+    {"S7", "G9.S7", 90, 1, -1, 0},
+    {"S8", "G9.S8", 90, 1, -1, 0},
+    {"G10", "G10", -1, 0, 101, 0},
+    {"S0", "G10.S0", 100, 1, -1, 0},
+    {"S1", "G10.S1", 100, 1, -1, 0},
+    {"S2", "G10.S2", 100, 1, -1, 0},
+    {"S3", "G10.S3", 100, 1, -1, 0},
+    {"S4", "G10.S4", 100, 1, -1, 0},
+    {"S5", "G10.S5", 100, 1, -1, 0},
+    {"S6", "G10.S6", 100, 1, -1, 0},
+    {"S7", "G10.S7", 100, 1, -1, 0},
+    {"S8", "G10.S8", 100, 1, -1, 0},
+    {"G11", "G11", -1, 0, 111, 0},
+    {"S0", "G11.S0", 110, 1, -1, 0},
+    {"S1", "G11.S1", 110, 1, -1, 0},
+    {"S2", "G11.S2", 110, 1, -1, 0},
+    {"S3", "G11.S3", 110, 1, -1, 0},
+    {"S4", "G11.S4", 110, 1, -1, 0},
+    {"S5", "G11.S5", 110, 1, -1, 0},
+    {"S6", "G11.S6", 110, 1, -1, 0},
+    {"S7", "G11.S7", 110, 1, -1, 0},
+    {"S8", "G11.S8", 110, 1, -1, 0},
+    {"G12", "G12", -1, 0, 121, 0},
+    {"S0", "G12.S0", 120, 1, -1, 0},
+    {"S1", "G12.S1", 120, 1, -1, 0},
+    {"S2", "G12.S2", 120, 1, -1, 0},
+    {"S3", "G12.S3", 120, 1, -1, 0},
+    {"S4", "G12.S4", 120, 1, -1, 0},
+    {"S5", "G12.S5", 120, 1, -1, 0},
+    {"S6", "G12.S6", 120, 1, -1, 0},
+    {"S7", "G12.S7", 120, 1, -1, 0},
+    {"S8", "G12.S8", 120, 1, -1, 0},
+    {"G13", "G13", -1, 0, 131, 0},
+    {"S0", "G13.S0", 130, 1, -1, 0},
+    {"S1", "G13.S1", 130, 1, -1, 0},
+    {"S2", "G13.S2", 130, 1, -1, 0},
+    {"S3", "G13.S3", 130, 1, -1, 0},
+    {"S4", "G13.S4", 130, 1, -1, 0},
+    {"S5", "G13.S5", 130, 1, -1, 0},
+    {"S6", "G13.S6", 130, 1, -1, 0},
+    {"S7", "G13.S7", 130, 1, -1, 0},
+    {"S8", "G13.S8", 130, 1, -1, 0},
+    {"G14", "G14", -1, 0, 141, 0},
+    {"S0", "G14.S0", 140, 1, -1, 0},
+    {"S1", "G14.S1", 140, 1, -1, 0},
+    {"S2", "G14.S2", 140, 1, -1, 0},
+    {"S3", "G14.S3", 140, 1, -1, 0},
+    {"S4", "G14.S4", 140, 1, -1, 0},
+    {"S5", "G14.S5", 140, 1, -1, 0},
+    {"S6", "G14.S6", 140, 1, -1, 0},
+    {"S7", "G14.S7", 140, 1, -1, 0},
+    {"S8", "G14.S8", 140, 1, -1, 0},
+    {"G15", "G15", -1, 0, 151, 0},
+    {"S0", "G15.S0", 150, 1, -1, 0},
+    {"S1", "G15.S1", 150, 1, -1, 0},
+    {"S2", "G15.S2", 150, 1, -1, 0},
+    {"S3", "G15.S3", 150, 1, -1, 0},
+    {"S4", "G15.S4", 150, 1, -1, 0},
+    {"S5", "G15.S5", 150, 1, -1, 0},
+    {"S6", "G15.S6", 150, 1, -1, 0},
+    {"S7", "G15.S7", 150, 1, -1, 0},
+    {"S8", "G15.S8", 150, 1, -1, 0},
+    {"G16", "G16", -1, 0, 161, 0},
+    {"S0", "G16.S0", 160, 1, -1, 0},
+    {"S1", "G16.S1", 160, 1, -1, 0},
+    {"S2", "G16.S2", 160, 1, -1, 0},
+    {"S3", "G16.S3", 160, 1, -1, 0},
+    {"S4", "G16.S4", 160, 1, -1, 0},
+    {"S5", "G16.S5", 160, 1, -1, 0},
+    {"S6", "G16.S6", 160, 1, -1, 0},
+    {"S7", "G16.S7", 160, 1, -1, 0},
+    {"S8", "G16.S8", 160, 1, -1, 0},
+    {"G17", "G17", -1, 0, 171, 0},
+    {"S0", "G17.S0", 170, 1, -1, 0},
+    {"S1", "G17.S1", 170, 1, -1, 0},
+    {"S2", "G17.S2", 170, 1, -1, 0},
+    {"S3", "G17.S3", 170, 1, -1, 0},
+    {"S4", "G17.S4", 170, 1, -1, 0},
+    {"S5", "G17.S5", 170, 1, -1, 0},
+    {"S6", "G17.S6", 170, 1, -1, 0},
+    {"S7", "G17.S7", 170, 1, -1, 0},
+    {"S8", "G17.S8", 170, 1, -1, 0},
+    {"G18", "G18", -1, 0, 181, 0},
+    {"S0", "G18.S0", 180, 1, -1, 0},
+    {"S1", "G18.S1", 180, 1, -1, 0},
+    {"S2", "G18.S2", 180, 1, -1, 0},
+    {"S3", "G18.S3", 180, 1, -1, 0},
+    {"S4", "G18.S4", 180, 1, -1, 0},
+    {"S5", "G18.S5", 180, 1, -1, 0},
+    {"S6", "G18.S6", 180, 1, -1, 0},
+    {"S7", "G18.S7", 180, 1, -1, 0},
+    {"S8", "G18.S8", 180, 1, -1, 0},
+    {"G19", "G19", -1, 0, 191, 0},
+    {"S0", "G19.S0", 190, 1, -1, 0},
+    {"S1", "G19.S1", 190, 1, -1, 0},
+    {"S2", "G19.S2", 190, 1, -1, 0},
+    {"S3", "G19.S3", 190, 1, -1, 0},
+    {"S4", "G19.S4", 190, 1, -1, 0},
+    {"S5", "G19.S5", 190, 1, -1, 0},
+    {"S6", "G19.S6", 190, 1, -1, 0},
+    {"S7", "G19.S7", 190, 1, -1, 0},
+    {"S8", "G19.S8", 190, 1, -1, 0},
+    {"G20", "G20", -1, 0, 201, 0},
+    {"S0", "G20.S0", 200, 1, -1, 0},
+    {"S1", "G20.S1", 200, 1, -1, 0},
+    {"S2", "G20.S2", 200, 1, -1, 0},
+    {"S3", "G20.S3", 200, 1, -1, 0},
+    {"S4", "G20.S4", 200, 1, -1, 0},
+    {"S5", "G20.S5", 200, 1, -1, 0},
+    {"S6", "G20.S6", 200, 1, -1, 0},
+    {"S7", "G20.S7", 200, 1, -1, 0},
+    {"S8", "G20.S8", 200, 1, -1, 0},
+    {"G21", "G21", -1, 0, 211, 0},
+    {"S0", "G21.S0", 210, 1, -1, 0},
+    {"S1", "G21.S1", 210, 1, -1, 0},
+    {"S2", "G21.S2", 210, 1, -1, 0},
+    {"S3", "G21.S3", 210, 1, -1, 0},
+    {"S4", "G21.S4", 210, 1, -1, 0},
+    {"S5", "G21.S5", 210, 1, -1, 0},
+    {"S6", "G21.S6", 210, 1, -1, 0},
+    {"S7", "G21.S7", 210, 1, -1, 0},
+    {"S8", "G21.S8", 210, 1, -1, 0},
+    {"G22", "G22", -1, 0, 221, 0},
+    {"S0", "G22.S0", 220, 1, -1, 0},
+    {"S1", "G22.S1", 220, 1, -1, 0},
+    {"S2", "G22.S2", 220, 1, -1, 0},
+    {"S3", "G22.S3", 220, 1, -1, 0},
+    {"S4", "G22.S4", 220, 1, -1, 0},
+    {"S5", "G22.S5", 220, 1, -1, 0},
+    {"S6", "G22.S6", 220, 1, -1, 0},
+    {"S7", "G22.S7", 220, 1, -1, 0},
+    {"S8", "G22.S8", 220, 1, -1, 0},
+    {"G23", "G23", -1, 0, 231, 0},
+    {"S0", "G23.S0", 230, 1, -1, 0},
+    {"S1", "G23.S1", 230, 1, -1, 0},
+    {"S2", "G23.S2", 230, 1, -1, 0},
+    {"S3", "G23.S3", 230, 1, -1, 0},
+    {"S4", "G23.S4", 230, 1, -1, 0},
+    {"S5", "G23.S5", 230, 1, -1, 0},
+    {"S6", "G23.S6", 230, 1, -1, 0},
+    {"S7", "G23.S7", 230, 1, -1, 0},
+    {"S8", "G23.S8", 230, 1, -1, 0},
+    {"G24", "G24", -1, 0, 241, 0},
+    {"S0", "G24.S0", 240, 1, -1, 0},
+    {"S1", "G24.S1", 240, 1, -1, 0},
+    {"S2", "G24.S2", 240, 1, -1, 0},
+    {"S3", "G24.S3", 240, 1, -1, 0},
+    {"S4", "G24.S4", 240, 1, -1, 0},
+    {"S5", "G24.S5", 240, 1, -1, 0},
+    {"S6", "G24.S6", 240, 1, -1, 0},
+    {"S7", "G24.S7", 240, 1, -1, 0},
+    {"S8", "G24.S8", 240, 1, -1, 0},
+};
+
+static const char *event_names[] = {
+    "Reset",
+    "Next",
+    "E0",
+    "E1",
+    "E2",
+    "E3",
+    "E4",
+    "E5",
+    "E6",
+    "E7",
+};
+
+const char *Synthetic_state_name(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].name;
+    return "UNKNOWN";
+}
+
+const char *Synthetic_state_path(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].full_path;
+    return "UNKNOWN";
+}
+
+const char *Synthetic_event_name(Synthetic_event_t event) {
+    if (event >= 0 && event < Synthetic_EVENT_COUNT) return event_names[event];
+    return "UNKNOWN";
+}
+
+int Synthetic_get_parent(Synthetic_state_t state) {
+    if (state >= 0 && state < Synthetic_STATE_COUNT) return state_info[state].parent;
+    return -1;
+}
+
+bool Synthetic_is_in(Synthetic_context_t *ctx, Synthetic_state_t state) {
+    Synthetic_state_t current = ctx->current_state;
+    while (current >= 0) {
+        if (current == state) return true;
+        current = (Synthetic_state_t)state_info[current].parent;
+    }
+    return false;
+}
+
+void Synthetic_init(Synthetic_context_t *ctx, void *user_data) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->user_data = user_data;
+    for (int i = 0; i < Synthetic_STATE_COUNT; i++) {
+        ctx->history[i] = (Synthetic_state_t)-1;
+    }
+    ctx->current_state = Synthetic_STATE_G0_S0;
+    enter_0_0(ctx); /* Entry action */
+}
+
+bool Synthetic_dispatch(Synthetic_context_t *ctx, Synthetic_event_t event) {
+    /* Check current state and ancestors for handler */
+    Synthetic_state_t check = ctx->current_state;
+    while (check >= 0) {
+        switch (check) {
+        case Synthetic_STATE_G0:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S1;
+                enter_0_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S3;
+                enter_0_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S2;
+                enter_0_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S4;
+                enter_0_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S3;
+                enter_0_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S5;
+                enter_0_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S4;
+                enter_0_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S6;
+                enter_0_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S5;
+                enter_0_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S7;
+                enter_0_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S6;
+                enter_0_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S8;
+                enter_0_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S7;
+                enter_0_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S0;
+                enter_0_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S8;
+                enter_0_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S1;
+                enter_0_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G0_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S0;
+                enter_1_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[0] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S2;
+                enter_0_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S1;
+                enter_1_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S3;
+                enter_1_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S2;
+                enter_1_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S4;
+                enter_1_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S3;
+                enter_1_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S5;
+                enter_1_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S4;
+                enter_1_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S6;
+                enter_1_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S5;
+                enter_1_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S7;
+                enter_1_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S6;
+                enter_1_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S8;
+                enter_1_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S7;
+                enter_1_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S0;
+                enter_1_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S8;
+                enter_1_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S1;
+                enter_1_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G1_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S0;
+                enter_2_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[10] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G1_S2;
+                enter_1_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S1;
+                enter_2_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S3;
+                enter_2_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S2;
+                enter_2_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S4;
+                enter_2_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S3;
+                enter_2_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S5;
+                enter_2_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S4;
+                enter_2_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S6;
+                enter_2_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S5;
+                enter_2_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S7;
+                enter_2_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S6;
+                enter_2_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S8;
+                enter_2_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S7;
+                enter_2_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S0;
+                enter_2_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S8;
+                enter_2_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S1;
+                enter_2_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G2_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S0;
+                enter_3_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[20] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G2_S2;
+                enter_2_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S1;
+                enter_3_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S3;
+                enter_3_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S2;
+                enter_3_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S4;
+                enter_3_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S3;
+                enter_3_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S5;
+                enter_3_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S4;
+                enter_3_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S6;
+                enter_3_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S5;
+                enter_3_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S7;
+                enter_3_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S6;
+                enter_3_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S8;
+                enter_3_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S7;
+                enter_3_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S0;
+                enter_3_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S8;
+                enter_3_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S1;
+                enter_3_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G3_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S0;
+                enter_4_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[30] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G3_S2;
+                enter_3_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S1;
+                enter_4_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S3;
+                enter_4_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S2;
+                enter_4_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S4;
+                enter_4_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S3;
+                enter_4_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S5;
+                enter_4_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S4;
+                enter_4_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S6;
+                enter_4_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S5;
+                enter_4_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S7;
+                enter_4_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S6;
+                enter_4_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S8;
+                enter_4_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S7;
+                enter_4_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S0;
+                enter_4_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S8;
+                enter_4_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S1;
+                enter_4_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G4_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S0;
+                enter_5_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[40] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G4_S2;
+                enter_4_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S1;
+                enter_5_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S3;
+                enter_5_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S2;
+                enter_5_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S4;
+                enter_5_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S3;
+                enter_5_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S5;
+                enter_5_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S4;
+                enter_5_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S6;
+                enter_5_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S5;
+                enter_5_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S7;
+                enter_5_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S6;
+                enter_5_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S8;
+                enter_5_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S7;
+                enter_5_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S0;
+                enter_5_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S8;
+                enter_5_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S1;
+                enter_5_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G5_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S0;
+                enter_6_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[50] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G5_S2;
+                enter_5_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S1;
+                enter_6_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S3;
+                enter_6_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S2;
+                enter_6_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S4;
+                enter_6_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S3;
+                enter_6_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S5;
+                enter_6_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S4;
+                enter_6_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S6;
+                enter_6_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S5;
+                enter_6_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S7;
+                enter_6_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S6;
+                enter_6_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S8;
+                enter_6_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S7;
+                enter_6_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S0;
+                enter_6_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S8;
+                enter_6_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S1;
+                enter_6_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G6_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S0;
+                enter_7_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[60] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G6_S2;
+                enter_6_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S1;
+                enter_7_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S3;
+                enter_7_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S2;
+                enter_7_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S4;
+                enter_7_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S3;
+                enter_7_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S5;
+                enter_7_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S4;
+                enter_7_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S6;
+                enter_7_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S5;
+                enter_7_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S7;
+                enter_7_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S6;
+                enter_7_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S8;
+                enter_7_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S7;
+                enter_7_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S0;
+                enter_7_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S8;
+                enter_7_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S1;
+                enter_7_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G7_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S0;
+                enter_8_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[70] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G7_S2;
+                enter_7_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S1;
+                enter_8_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S3;
+                enter_8_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S2;
+                enter_8_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S4;
+                enter_8_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S3;
+                enter_8_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S5;
+                enter_8_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S4;
+                enter_8_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S6;
+                enter_8_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S5;
+                enter_8_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S7;
+                enter_8_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S6;
+                enter_8_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S8;
+                enter_8_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S7;
+                enter_8_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S0;
+                enter_8_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S8;
+                enter_8_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S1;
+                enter_8_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G8_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S0;
+                enter_9_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[80] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G8_S2;
+                enter_8_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S1;
+                enter_9_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S3;
+                enter_9_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S2;
+                enter_9_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S4;
+                enter_9_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S3;
+                enter_9_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S5;
+                enter_9_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S4;
+                enter_9_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S6;
+                enter_9_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S5;
+                enter_9_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S7;
+                enter_9_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S6;
+                enter_9_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S8;
+                enter_9_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S7;
+                enter_9_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S0;
+                enter_9_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S8;
+                enter_9_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S1;
+                enter_9_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G9_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S0;
+                enter_10_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[90] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G9_S2;
+                enter_9_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S1;
+                enter_10_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S3;
+                enter_10_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S2;
+                enter_10_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S4;
+                enter_10_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S3;
+                enter_10_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S5;
+                enter_10_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S4;
+                enter_10_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S6;
+                enter_10_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S5;
+                enter_10_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S7;
+                enter_10_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S6;
+                enter_10_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S8;
+                enter_10_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S7;
+                enter_10_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S0;
+                enter_10_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S8;
+                enter_10_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S1;
+                enter_10_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G10_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S0;
+                enter_11_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[100] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G10_S2;
+                enter_10_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S1;
+                enter_11_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S3;
+                enter_11_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S2;
+                enter_11_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S4;
+                enter_11_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S3;
+                enter_11_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S5;
+                enter_11_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S4;
+                enter_11_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S6;
+                enter_11_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S5;
+                enter_11_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S7;
+                enter_11_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S6;
+                enter_11_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S8;
+                enter_11_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S7;
+                enter_11_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S0;
+                enter_11_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S8;
+                enter_11_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S1;
+                enter_11_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G11_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S0;
+                enter_12_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[110] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G11_S2;
+                enter_11_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S1;
+                enter_12_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S3;
+                enter_12_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S2;
+                enter_12_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S4;
+                enter_12_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S3;
+                enter_12_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S5;
+                enter_12_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S4;
+                enter_12_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S6;
+                enter_12_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S5;
+                enter_12_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S7;
+                enter_12_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S6;
+                enter_12_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S8;
+                enter_12_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S7;
+                enter_12_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S0;
+                enter_12_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S8;
+                enter_12_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S1;
+                enter_12_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G12_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S0;
+                enter_13_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[120] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G12_S2;
+                enter_12_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S1;
+                enter_13_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S3;
+                enter_13_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S2;
+                enter_13_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S4;
+                enter_13_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S3;
+                enter_13_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S5;
+                enter_13_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S4;
+                enter_13_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S6;
+                enter_13_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S5;
+                enter_13_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S7;
+                enter_13_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S6;
+                enter_13_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S8;
+                enter_13_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S7;
+                enter_13_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S0;
+                enter_13_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S8;
+                enter_13_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S1;
+                enter_13_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G13_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S0;
+                enter_14_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[130] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G13_S2;
+                enter_13_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S1;
+                enter_14_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S3;
+                enter_14_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S2;
+                enter_14_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S4;
+                enter_14_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S3;
+                enter_14_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S5;
+                enter_14_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S4;
+                enter_14_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S6;
+                enter_14_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S5;
+                enter_14_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S7;
+                enter_14_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S6;
+                enter_14_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S8;
+                enter_14_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S7;
+                enter_14_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S0;
+                enter_14_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S8;
+                enter_14_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S1;
+                enter_14_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G14_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S0;
+                enter_15_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[140] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G14_S2;
+                enter_14_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S1;
+                enter_15_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S3;
+                enter_15_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S2;
+                enter_15_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S4;
+                enter_15_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S3;
+                enter_15_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S5;
+                enter_15_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S4;
+                enter_15_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S6;
+                enter_15_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S5;
+                enter_15_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S7;
+                enter_15_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S6;
+                enter_15_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S8;
+                enter_15_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S7;
+                enter_15_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S0;
+                enter_15_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S8;
+                enter_15_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S1;
+                enter_15_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G15_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S0;
+                enter_16_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[150] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G15_S2;
+                enter_15_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S1;
+                enter_16_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S3;
+                enter_16_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S2;
+                enter_16_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S4;
+                enter_16_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S3;
+                enter_16_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S5;
+                enter_16_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S4;
+                enter_16_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S6;
+                enter_16_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S5;
+                enter_16_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S7;
+                enter_16_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S6;
+                enter_16_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S8;
+                enter_16_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S7;
+                enter_16_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S0;
+                enter_16_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S8;
+                enter_16_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S1;
+                enter_16_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G16_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S0;
+                enter_17_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[160] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G16_S2;
+                enter_16_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S1;
+                enter_17_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S3;
+                enter_17_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S2;
+                enter_17_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S4;
+                enter_17_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S3;
+                enter_17_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S5;
+                enter_17_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S4;
+                enter_17_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S6;
+                enter_17_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S5;
+                enter_17_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S7;
+                enter_17_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S6;
+                enter_17_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S8;
+                enter_17_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S7;
+                enter_17_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S0;
+                enter_17_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S8;
+                enter_17_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S1;
+                enter_17_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G17_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S0;
+                enter_18_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[170] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G17_S2;
+                enter_17_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S1;
+                enter_18_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S3;
+                enter_18_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S2;
+                enter_18_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S4;
+                enter_18_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S3;
+                enter_18_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S5;
+                enter_18_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S4;
+                enter_18_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S6;
+                enter_18_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S5;
+                enter_18_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S7;
+                enter_18_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S6;
+                enter_18_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S8;
+                enter_18_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S7;
+                enter_18_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S0;
+                enter_18_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S8;
+                enter_18_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S1;
+                enter_18_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G18_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S0;
+                enter_19_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[180] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G18_S2;
+                enter_18_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S1;
+                enter_19_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S3;
+                enter_19_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S2;
+                enter_19_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S4;
+                enter_19_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S3;
+                enter_19_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S5;
+                enter_19_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S4;
+                enter_19_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S6;
+                enter_19_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S5;
+                enter_19_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S7;
+                enter_19_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S6;
+                enter_19_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S8;
+                enter_19_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S7;
+                enter_19_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S0;
+                enter_19_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S8;
+                enter_19_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S1;
+                enter_19_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G19_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S0;
+                enter_20_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[190] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G19_S2;
+                enter_19_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S1;
+                enter_20_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S3;
+                enter_20_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S2;
+                enter_20_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S4;
+                enter_20_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S3;
+                enter_20_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S5;
+                enter_20_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S4;
+                enter_20_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S6;
+                enter_20_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S5;
+                enter_20_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S7;
+                enter_20_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S6;
+                enter_20_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S8;
+                enter_20_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S7;
+                enter_20_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S0;
+                enter_20_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S8;
+                enter_20_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S1;
+                enter_20_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G20_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S0;
+                enter_21_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[200] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G20_S2;
+                enter_20_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S1;
+                enter_21_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S3;
+                enter_21_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S2;
+                enter_21_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S4;
+                enter_21_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S3;
+                enter_21_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S5;
+                enter_21_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S4;
+                enter_21_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S6;
+                enter_21_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S5;
+                enter_21_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S7;
+                enter_21_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S6;
+                enter_21_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S8;
+                enter_21_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S7;
+                enter_21_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S0;
+                enter_21_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S8;
+                enter_21_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S1;
+                enter_21_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G21_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S0;
+                enter_22_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[210] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G21_S2;
+                enter_21_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S1;
+                enter_22_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S3;
+                enter_22_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S2;
+                enter_22_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S4;
+                enter_22_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S3;
+                enter_22_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S5;
+                enter_22_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S4;
+                enter_22_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S6;
+                enter_22_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S5;
+                enter_22_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S7;
+                enter_22_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S6;
+                enter_22_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S8;
+                enter_22_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S7;
+                enter_22_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S0;
+                enter_22_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S8;
+                enter_22_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S1;
+                enter_22_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G22_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S0;
+                enter_23_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[220] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G22_S2;
+                enter_22_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S1;
+                enter_23_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S3;
+                enter_23_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S2;
+                enter_23_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S4;
+                enter_23_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S3;
+                enter_23_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S5;
+                enter_23_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S4;
+                enter_23_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S6;
+                enter_23_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S5;
+                enter_23_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S7;
+                enter_23_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S6;
+                enter_23_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S8;
+                enter_23_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S7;
+                enter_23_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S0;
+                enter_23_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S8;
+                enter_23_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S1;
+                enter_23_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G23_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S0;
+                enter_24_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[230] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G23_S2;
+                enter_23_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24:
+            switch (event) {
+            case Synthetic_EVENT_RESET:
+                ctx->current_state = Synthetic_STATE_G0;
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S0:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S1;
+                enter_24_1(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S3;
+                enter_24_3(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S1:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S2;
+                enter_24_2(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E1:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S4;
+                enter_24_4(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S2:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S3;
+                enter_24_3(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E2:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S5;
+                enter_24_5(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S3:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S4;
+                enter_24_4(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E3:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S6;
+                enter_24_6(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S4:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S5;
+                enter_24_5(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E4:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S7;
+                enter_24_7(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S5:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S6;
+                enter_24_6(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E5:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S8;
+                enter_24_8(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S6:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S7;
+                enter_24_7(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E6:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S0;
+                enter_24_0(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S7:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S8;
+                enter_24_8(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E7:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S1;
+                enter_24_1(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        case Synthetic_STATE_G24_S8:
+            switch (event) {
+            case Synthetic_EVENT_NEXT:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G0_S0;
+                enter_0_0(ctx); /* Entry */
+                return true;
+            case Synthetic_EVENT_E0:
+                ctx->history[240] = ctx->current_state; /* Save history */
+                ctx->current_state = Synthetic_STATE_G24_S2;
+                enter_24_2(ctx); /* Entry */
+                return true;
+            default: break;
+            }
+            break;
+        default: break;
+        }
+        check = (Synthetic_state_t)state_info[check].parent;
+    }
+    return false;
+}
@@ -0,0 +1,530 @@
+/* AUTO-GENERATED by hsmgen 1.0.0 — DO NOT EDIT */
+#ifndef SYNTHETIC_HSM_H
+#define SYNTHETIC_HSM_H
+
+#include <stdbool.h>
+
+/* States (hierarchical, flattened to enum) */
+typedef enum {
+    Synthetic_STATE_G0 = 0,
+    Synthetic_STATE_G0_S0 = 1,
+    Synthetic_STATE_G0_S1 = 2,
+    Synthetic_STATE_G0_S2 = 3,
+    Synthetic_STATE_G0_S3 = 4,
+    Synthetic_STATE_G0_S4 = 5,
+    Synthetic_STATE_G0_S5 = 6,
+    Synthetic_STATE_G0_S6 = 7,
+    Synthetic_STATE_G0_S7 = 8,
+    Synthetic_STATE_G0_S8 = 9,
+    Synthetic_STATE_G1 = 10,
+    Synthetic_STATE_G1_S0 = 11,
+    Synthetic_STATE_G1_S1 = 12,
+    Synthetic_STATE_G1_S2 = 13,
+    Synthetic_STATE_G1_S3 = 14,
+    Synthetic_STATE_G1_S4 = 15,
+    Synthetic_STATE_G1_S5 = 16,
+    Synthetic_STATE_G1_S6 = 17,
+    Synthetic_STATE_G1_S7 = 18,
+    Synthetic_STATE_G1_S8 = 19,
+    Synthetic_STATE_G2 = 20,
+    Synthetic_STATE_G2_S0 = 21,
+    Synthetic_STATE_G2_S1 = 22,
+    Synthetic_STATE_G2_S2 = 23,
+    Synthetic_STATE_G2_S3 = 24,
+    Synthetic_STATE_G2_S4 = 25,
+    Synthetic_STATE_G2_S5 = 26,
+    Synthetic_STATE_G2_S6 = 27,
+    Synthetic_STATE_G2_S7 = 28,
+    Synthetic_STATE_G2_S8 = 29,
+    Synthetic_STATE_G3 = 30,
+    Synthetic_STATE_G3_S0 = 31,
+    Synthetic_STATE_G3_S1 = 32,
+    Synthetic_STATE_G3_S2 = 33,
+    Synthetic_STATE_G3_S3 = 34,
+    Synthetic_STATE_G3_S4 = 35,
+    Synthetic_STATE_G3_S5 = 36,
+    Synthetic_STATE_G3_S6 = 37,
+    Synthetic_STATE_G3_S7 = 38,
+    Synthetic_STATE_G3_S8 = 39,
+    Synthetic_STATE_G4 = 40,
+    Synthetic_STATE_G4_S0 = 41,
+    Synthetic_STATE_G4_S1 = 42,
+    Synthetic_STATE_G4_S2 = 43,
+    Synthetic_STATE_G4_S3 = 44,
+    Synthetic_STATE_G4_S4 = 45,
+    Synthetic_STATE_G4_S5 = 46,
+    Synthetic_STATE_G4_S6 = 47,
+    Synthetic_STATE_G4_S7 = 48,
+    Synthetic_STATE_G4_S8 = 49,
+    Synthetic_STATE_G5 = 50,
+    Synthetic_STATE_G5_S0 = 51,
+    Synthetic_STATE_G5_S1 = 52,
+    Synthetic_STATE_G5_S2 = 53,
+    Synthetic_STATE_G5_S3 = 54,
+    Synthetic_STATE_G5_S4 = 55,
+    Synthetic_STATE_G5_S5 = 56,
+    Synthetic_STATE_G5_S6 = 57,
+    Synthetic_STATE_G5_S7 = 58,
+    Synthetic_STATE_G5_S8 = 59,
+    Synthetic_STATE_G6 = 60,
+    Synthetic_STATE_G6_S0 = 61,
+    Synthetic_STATE_G6_S1 = 62,
+    Synthetic_STATE_G6_S2 = 63,
+    Synthetic_STATE_G6_S3 = 64,
+    Synthetic_STATE_G6_S4 = 65,
+    Synthetic_STATE_G6_S5 = 66,
+    Synthetic_STATE_G6_S6 = 67,
+    Synthetic_STATE_G6_S7 = 68,
+    Synthetic_STATE_G6_S8 = 69,
+    Synthetic_STATE_G7 = 70,
+    Synthetic_STATE_G7_S0 = 71,
+    Synthetic_STATE_G7_S1 = 72,
+    Synthetic_STATE_G7_S2 = 73,
+    Synthetic_STATE_G7_S3 = 74,
+    Synthetic_STATE_G7_S4 = 75,
+    Synthetic_STATE_G7_S5 = 76,
+    Synthetic_STATE_G7_S6 = 77,
+    Synthetic_STATE_G7_S7 = 78,
+    Synthetic_STATE_G7_S8 = 79,
+    Synthetic_STATE_G8 = 80,
+    Synthetic_STATE_G8_S0 = 81,
+    Synthetic_STATE_G8_S1 = 82,
+    Synthetic_STATE_G8_S2 = 83,
+    Synthetic_STATE_G8_S3 = 84,
+    Synthetic_STATE_G8_S4 = 85,
+    Synthetic_STATE_G8_S5 = 86,
+    Synthetic_STATE_G8_S6 = 87,
+    Synthetic_STATE_G8_S7 = 88,
+    Synthetic_STATE_G8_S8 = 89,
+    Synthetic_STATE_G9 = 90,
+    Synthetic_STATE_G9_S0 = 91,
+    Synthetic_STATE_G9_S1 = 92,
+    Synthetic_STATE_G9_S2 = 93,
+    Synthetic_STATE_G9_S3 = 94,
+    Synthetic_STATE_G9_S4 = 95,
+    Synthetic_STATE_G9_S5 = 96,
+    Synthetic_STATE_G9_S6 = 97,
+    Synthetic_STATE_G9_S7 = 98,
+    Synthetic_STATE_G9_S8 = 99,
+    Synthetic_STATE_G10 = 100,
+    Synthetic_STATE_G10_S0 = 101,
+    Synthetic_STATE_G10_S1 = 102,
+    Synthetic_STATE_G10_S2 = 103,
+    Synthetic_STATE_G10_S3 = 104,
+    Synthetic_STATE_G10_S4 = 105,
+    Synthetic_STATE_G10_S5 = 106,
+    Synthetic_STATE_G10_S6 = 107,
+    Synthetic_STATE_G10_S7 = 108,
+    Synthetic_STATE_G10_S8 = 109,
+    Synthetic_STATE_G11 = 110,
+    Synthetic_STATE_G11_S0 = 111,
+    Synthetic_STATE_G11_S1 = 112,
+    Synthetic_STATE_G11_S2 = 113,
+    Synthetic_STATE_G11_S3 = 114,
+    Synthetic_STATE_G11_S4 = 115,
+    Synthetic_STATE_G11_S5 = 116,
+    Synthetic_STATE_G11_S6 = 117,
+    Synthetic_STATE_G11_S7 = 118,
+    Synthetic_STATE_G11_S8 = 119,
+    Synthetic_STATE_G12 = 120,
+    Synthetic_STATE_G12_S0 = 121,
+    Synthetic_STATE_G12_S1 = 122,
+    Synthetic_STATE_G12_S2 = 123,
+    Synthetic_STATE_G12_S3 = 124,
+    Synthetic_STATE_G12_S4 = 125,
+    Synthetic_STATE_G12_S5 = 126,
+    Synthetic_STATE_G12_S6 = 127,
+    Synthetic_STATE_G12_S7 = 128,
+    Synthetic_STATE_G12_S8 = 129,
+    Synthetic_STATE_G13 = 130,
+    Synthetic_STATE_G13_S0 = 131,
+    Synthetic_STATE_G13_S1 = 132,
+    Synthetic_STATE_G13_S2 = 133,
+    Synthetic_STATE_G13_S3 = 134,
+    Synthetic_STATE_G13_S4 = 135,
+    Synthetic_STATE_G13_S5 = 136,
+    Synthetic_STATE_G13_S6 = 137,
+    Synthetic_STATE_G13_S7 = 138,
+    Synthetic_STATE_G13_S8 = 139,
+    Synthetic_STATE_G14 = 140,
+    Synthetic_STATE_G14_S0 = 141,
+    Synthetic_STATE_G14_S1 = 142,
+    Synthetic_STATE_G14_S2 = 143,
+    Synthetic_STATE_G14_S3 = 144,
+    Synthetic_STATE_G14_S4 = 145,
+    Synthetic_STATE_G14_S5 = 146,
+    Synthetic_STATE_G14_S6 = 147,
+    Synthetic_STATE_G14_S7 = 148,
+    Synthetic_STATE_G14_S8 = 149,
+    Synthetic_STATE_G15 = 150,
+    Synthetic_STATE_G15_S0 = 151,
+    Synthetic_STATE_G15_S1 = 152,
+    Synthetic_STATE_G15_S2 = 153,
+    Synthetic_STATE_G15_S3 = 154,
+    Synthetic_STATE_G15_S4 = 155,
+    Synthetic_STATE_G15_S5 = 156,
+    Synthetic_STATE_G15_S6 = 157,
+    Synthetic_STATE_G15_S7 = 158,
+    Synthetic_STATE_G15_S8 = 159,
+    Synthetic_STATE_G16 = 160,
+    Synthetic_STATE_G16_S0 = 161,
+    Synthetic_STATE_G16_S1 = 162,
+    Synthetic_STATE_G16_S2 = 163,
+    Synthetic_STATE_G16_S3 = 164,
+    Synthetic_STATE_G16_S4 = 165,
+    Synthetic_STATE_G16_S5 = 166,
+    Synthetic_STATE_G16_S6 = 167,
+    Synthetic_STATE_G16_S7 = 168,
+    Synthetic_STATE_G16_S8 = 169,
+    Synthetic_STATE_G17 = 170,
+    Synthetic_STATE_G17_S0 = 171,
+    Synthetic_STATE_G17_S1 = 172,
+    Synthetic_STATE_G17_S2 = 173,
+    Synthetic_STATE_G17_S3 = 174,
+    Synthetic_STATE_G17_S4 = 175,
+    Synthetic_STATE_G17_S5 = 176,
+    Synthetic_STATE_G17_S6 = 177,
+    Synthetic_STATE_G17_S7 = 178,
+    Synthetic_STATE_G17_S8 = 179,
+    Synthetic_STATE_G18 = 180,
+    Synthetic_STATE_G18_S0 = 181,
+    Synthetic_STATE_G18_S1 = 182,
+    Synthetic_STATE_G18_S2 = 183,
+    Synthetic_STATE_G18_S3 = 184,
+    Synthetic_STATE_G18_S4 = 185,
+    Synthetic_STATE_G18_S5 = 186,
+    Synthetic_STATE_G18_S6 = 187,
+    Synthetic_STATE_G18_S7 = 188,
+    Synthetic_STATE_G18_S8 = 189,
+    Synthetic_STATE_G19 = 190,
+    Synthetic_STATE_G19_S0 = 191,
+    Synthetic_STATE_G19_S1 = 192,
+    Synthetic_STATE_G19_S2 = 193,
+    Synthetic_STATE_G19_S3 = 194,
+    Synthetic_STATE_G19_S4 = 195,
+    Synthetic_STATE_G19_S5 = 196,
+    Synthetic_STATE_G19_S6 = 197,
+    Synthetic_STATE_G19_S7 = 198,
+    Synthetic_STATE_G19_S8 = 199,
+    Synthetic_STATE_G20 = 200,
+    Synthetic_STATE_G20_S0 = 201,
+    Synthetic_STATE_G20_S1 = 202,
+    Synthetic_STATE_G20_S2 = 203,
+    Synthetic_STATE_G20_S3 = 204,
+    Synthetic_STATE_G20_S4 = 205,
+    Synthetic_STATE_G20_S5 = 206,
+    Synthetic_STATE_G20_S6 = 207,
+    Synthetic_STATE_G20_S7 = 208,
+    Synthetic_STATE_G20_S8 = 209,
+    Synthetic_STATE_G21 = 210,
+    Synthetic_STATE_G21_S0 = 211,
+    Synthetic_STATE_G21_S1 = 212,
+    Synthetic_STATE_G21_S2 = 213,
+    Synthetic_STATE_G21_S3 = 214,
+    Synthetic_STATE_G21_S4 = 215,
+    Synthetic_STATE_G21_S5 = 216,
+    Synthetic_STATE_G21_S6 = 217,
+    Synthetic_STATE_G21_S7 = 218,
+    Synthetic_STATE_G21_S8 = 219,
+    Synthetic_STATE_G22 = 220,
+    Synthetic_STATE_G22_S0 = 221,
+    Synthetic_STATE_G22_S1 = 222,
+    Synthetic_STATE_G22_S2 = 223,
+    Synthetic_STATE_G22_S3 = 224,
+    Synthetic_STATE_G22_S4 = 225,
+    Synthetic_STATE_G22_S5 = 226,
+    Synthetic_STATE_G22_S6 = 227,
+    Synthetic_STATE_G22_S7 = 228,
+    Synthetic_STATE_G22_S8 = 229,
+    Synthetic_STATE_G23 = 230,
+    Synthetic_STATE_G23_S0 = 231,
+    Synthetic_STATE_G23_S1 = 232,
+    Synthetic_STATE_G23_S2 = 233,
+    Synthetic_STATE_G23_S3 = 234,
+    Synthetic_STATE_G23_S4 = 235,
+    Synthetic_STATE_G23_S5 = 236,
+    Synthetic_STATE_G23_S6 = 237,
+    Synthetic_STATE_G23_S7 = 238,
+    Synthetic_STATE_G23_S8 = 239,
+    Synthetic_STATE_G24 = 240,
+    Synthetic_STATE_G24_S0 = 241,
+    Synthetic_STATE_G24_S1 = 242,
+    Synthetic_STATE_G24_S2 = 243,
+    Synthetic_STATE_G24_S3 = 244,
+    Synthetic_STATE_G24_S4 = 245,
+    Synthetic_STATE_G24_S5 = 246,
+    Synthetic_STATE_G24_S6 = 247,
+    Synthetic_STATE_G24_S7 = 248,
+    Synthetic_STATE_G24_S8 = 249,
+    Synthetic_STATE_COUNT
+} Synthetic_state_t;
+
+/* Events */
+typedef enum {
+    Synthetic_EVENT_RESET = 0,
+    Synthetic_EVENT_NEXT = 1,
+    Synthetic_EVENT_E0 = 2,
+    Synthetic_EVENT_E1 = 3,
+    Synthetic_EVENT_E2 = 4,
+    Synthetic_EVENT_E3 = 5,
+    Synthetic_EVENT_E4 = 6,
+    Synthetic_EVENT_E5 = 7,
+    Synthetic_EVENT_E6 = 8,
+    Synthetic_EVENT_E7 = 9,
+    Synthetic_EVENT_COUNT
+} Synthetic_event_t;
+
+/* State hierarchy info */
+typedef struct {
+    const char *name;
+    const char *full_path;
+    int parent;       /* -1 if root */
+    int depth;
+    int initial_child; /* -1 if leaf */
+    int has_history;
+} Synthetic_state_info_t;
+
+/* HSM context (supports history) */
+typedef struct {
+    Synthetic_state_t current_state;
+    Synthetic_state_t history[Synthetic_STATE_COUNT]; /* History per composite state */
+    void *user_data;
+} Synthetic_context_t;
+
+/* HSM functions */
+void Synthetic_init(Synthetic_context_t *ctx, void *user_data);
+bool Synthetic_dispatch(Synthetic_context_t *ctx, Synthetic_event_t event);
+const char *Synthetic_state_name(Synthetic_state_t state);
+const char *Synthetic_state_path(Synthetic_state_t state);
+const char *Synthetic_event_name(Synthetic_event_t event);
+int Synthetic_get_parent(Synthetic_state_t state);
+bool Synthetic_is_in(Synthetic_context_t *ctx, Synthetic_state_t state);
+
+/* Action functions (implement these) */
+extern void enter_0_0(Synthetic_context_t *ctx);
+extern void enter_0_1(Synthetic_context_t *ctx);
+extern void enter_0_2(Synthetic_context_t *ctx);
+extern void enter_0_3(Synthetic_context_t *ctx);
+extern void enter_0_4(Synthetic_context_t *ctx);
+extern void enter_0_5(Synthetic_context_t *ctx);
+extern void enter_0_6(Synthetic_context_t *ctx);
+extern void enter_0_7(Synthetic_context_t *ctx);
+extern void enter_0_8(Synthetic_context_t *ctx);
+extern void enter_1_0(Synthetic_context_t *ctx);
+extern void enter_1_1(Synthetic_context_t *ctx);
+extern void enter_1_2(Synthetic_context_t *ctx);
+extern void enter_1_3(Synthetic_context_t *ctx);
+extern void enter_1_4(Synthetic_context_t *ctx);
+extern void enter_1_5(Synthetic_context_t *ctx);
+extern void enter_1_6(Synthetic_context_t *ctx);
+extern void enter_1_7(Synthetic_context_t *ctx);
+extern void enter_1_8(Synthetic_context_t *ctx);
+extern void enter_2_0(Synthetic_context_t *ctx);
+extern void enter_2_1(Synthetic_context_t *ctx);
+extern void enter_2_2(Synthetic_context_t *ctx);
+extern void enter_2_3(Synthetic_context_t *ctx);
+extern void enter_2_4(Synthetic_context_t *ctx);
+extern void enter_2_5(Synthetic_context_t *ctx);
+extern void enter_2_6(Synthetic_context_t *ctx);
+extern void enter_2_7(Synthetic_context_t *ctx);
+extern void enter_2_8(Synthetic_context_t *ctx);
+extern void enter_3_0(Synthetic_context_t *ctx);
+extern void enter_3_1(Synthetic_context_t *ctx);
+extern void enter_3_2(Synthetic_context_t *ctx);
+extern void enter_3_3(Synthetic_context_t *ctx);
+extern void enter_3_4(Synthetic_context_t *ctx);
+extern void enter_3_5(Synthetic_context_t *ctx);
+extern void enter_3_6(Synthetic_context_t *ctx);
+extern void enter_3_7(Synthetic_context_t *ctx);
+extern void enter_3_8(Synthetic_context_t *ctx);
+extern void enter_4_0(Synthetic_context_t *ctx);
+extern void enter_4_1(Synthetic_context_t *ctx);
+extern void enter_4_2(Synthetic_context_t *ctx);
+extern void enter_4_3(Synthetic_context_t *ctx);
+extern void enter_4_4(Synthetic_context_t *ctx);
+extern void enter_4_5(Synthetic_context_t *ctx);
+extern void enter_4_6(Synthetic_context_t *ctx);
+extern void enter_4_7(Synthetic_context_t *ctx);
+extern void enter_4_8(Synthetic_context_t *ctx);
+extern void enter_5_0(Synthetic_context_t *ctx);
+extern void enter_5_1(Synthetic_context_t *ctx);
+extern void enter_5_2(Synthetic_context_t *ctx);
+extern void enter_5_3(Synthetic_context_t *ctx);
+extern void enter_5_4(Synthetic_context_t *ctx);
+extern void enter_5_5(Synthetic_context_t *ctx);
+extern void enter_5_6(Synthetic_context_t *ctx);
+extern void enter_5_7(Synthetic_context_t *ctx);
+extern void enter_5_8(Synthetic_context_t *ctx);
+extern void enter_6_0(Synthetic_context_t *ctx);
+extern void enter_6_1(Synthetic_context_t *ctx);
+extern void enter_6_2(Synthetic_context_t *ctx);
+extern void enter_6_3(Synthetic_context_t *ctx);
+extern void enter_6_4(Synthetic_context_t *ctx);
+extern void enter_6_5(Synthetic_context_t *ctx);
+extern void enter_6_6(Synthetic_context_t *ctx);
+extern void enter_6_7(Synthetic_context_t *ctx);
+extern void enter_6_8(Synthetic_context_t *ctx);
+extern void enter_7_0(Synthetic_context_t *ctx);
+extern void enter_7_1(Synthetic_context_t *ctx);
+extern void enter_7_2(Synthetic_context_t *ctx);
+extern void enter_7_3(Synthetic_context_t *ctx);
+extern void enter_7_4(Synthetic_context_t *ctx);
+extern void enter_7_5(Synthetic_context_t *ctx);
+extern void enter_7_6(Synthetic_context_t *ctx);
+extern void enter_7_7(Synthetic_context_t *ctx);
+extern void enter_7_8(Synthetic_context_t *ctx);
+extern void enter_8_0(Synthetic_context_t *ctx);
+extern void enter_8_1(Synthetic_context_t *ctx);
+extern void enter_8_2(Synthetic_context_t *ctx);
+extern void enter_8_3(Synthetic_context_t *ctx);
+extern void enter_8_4(Synthetic_context_t *ctx);
+extern void enter_8_5(Synthetic_context_t *ctx);
+extern void enter_8_6(Synthetic_context_t *ctx);
+extern void enter_8_7(Synthetic_context_t *ctx);
+extern void enter_8_8(Synthetic_context_t *ctx);
+extern void enter_9_0(Synthetic_context_t *ctx);
+extern void enter_9_1(Synthetic_context_t *ctx);
+extern void enter_9_2(Synthetic_context_t *ctx);
+extern void enter_9_3(Synthetic_context_t *ctx);
+extern void enter_9_4(Synthetic_context_t *ctx);
+extern void enter_9_5(Synthetic_context_t *ctx);
+extern void enter_9_6(Synthetic_context_t *ctx);
+extern void enter_9_7(Synthetic_context_t *ctx);
+extern void enter_9_8(Synthetic_context_t *ctx);
+extern void enter_10_0(Synthetic_context_t *ctx);
+extern void enter_10_1(Synthetic_context_t *ctx);
+extern void enter_10_2(Synthetic_context_t *ctx);
+extern void enter_10_3(Synthetic_context_t *ctx);
+extern void enter_10_4(Synthetic_context_t *ctx);
+extern void enter_10_5(Synthetic_context_t *ctx);
+extern void enter_10_6(Synthetic_context_t *ctx);
+extern void enter_10_7(Synthetic_context_t *ctx);
+extern void enter_10_8(Synthetic_context_t *ctx);
+extern void enter_11_0(Synthetic_context_t *ctx);
+extern void enter_11_1(Synthetic_context_t *ctx);
+extern void enter_11_2(Synthetic_context_t *ctx);
+extern void enter_11_3(Synthetic_context_t *ctx);
+extern void enter_11_4(Synthetic_context_t *ctx);
+extern void enter_11_5(Synthetic_context_t *ctx);
+extern void enter_11_6(Synthetic_context_t *ctx);
+extern void enter_11_7(Synthetic_context_t *ctx);
+extern void enter_11_8(Synthetic_context_t *ctx);
+extern void enter_12_0(Synthetic_context_t *ctx);
+extern void enter_12_1(Synthetic_context_t *ctx);
+extern void enter_12_2(Synthetic_context_t *ctx);
+extern void enter_12_3(Synthetic_context_t *ctx);
+extern void enter_12_4(Synthetic_context_t *ctx);
+extern void enter_12_5(Synthetic_context_t *ctx);
+extern void enter_12_6(Synthetic_context_t *ctx);
+extern void enter_12_7(Synthetic_context_t *ctx);
+extern void enter_12_8(Synthetic_context_t *ctx);
+extern void enter_13_0(Synthetic_context_t *ctx);
+extern void enter_13_1(Synthetic_context_t *ctx);
+extern void enter_13_2(Synthetic_context_t *ctx);
+extern void enter_13_3(Synthetic_context_t *ctx);
+extern void enter_13_4(Synthetic_context_t *ctx);
+extern void enter_13_5(Synthetic_context_t *ctx);
+extern void enter_13_6(Synthetic_context_t *ctx);
+extern void enter_13_7(Synthetic_context_t *ctx);
+extern void enter_13_8(Synthetic_context_t *ctx);
+extern void enter_14_0(Synthetic_context_t *ctx);
+extern void enter_14_1(Synthetic_context_t *ctx);
+extern void enter_14_2(Synthetic_context_t *ctx);
+extern void enter_14_3(Synthetic_context_t *ctx);
+extern void enter_14_4(Synthetic_context_t *ctx);
+extern void enter_14_5(Synthetic_context_t *ctx);
+extern void enter_14_6(Synthetic_context_t *ctx);
+extern void enter_14_7(Synthetic_context_t *ctx);
+extern void enter_14_8(Synthetic_context_t *ctx);
+extern void enter_15_0(Synthetic_context_t *ctx);
+extern void enter_15_1(Synthetic_context_t *ctx);
+extern void enter_15_2(Synthetic_context_t *ctx);
+extern void enter_15_3(Synthetic_context_t *ctx);
+extern void enter_15_4(Synthetic_context_t *ctx);
+extern void enter_15_5(Synthetic_context_t *ctx);
+extern void enter_15_6(Synthetic_context_t *ctx);
+extern void enter_15_7(Synthetic_context_t *ctx);
+extern void enter_15_8(Synthetic_context_t *ctx);
+extern void enter_16_0(Synthetic_context_t *ctx);
+extern void enter_16_1(Synthetic_context_t *ctx);
+extern void enter_16_2(Synthetic_context_t *ctx);
+extern void enter_16_3(Synthetic_context_t *ctx);
+extern void enter_16_4(Synthetic_context_t *ctx);
+extern void enter_16_5(Synthetic_context_t *ctx);
+extern void enter_16_6(Synthetic_context_t *ctx);
+extern void enter_16_7(Synthetic_context_t *ctx);
+extern void enter_16_8(Synthetic_context_t *ctx);
+extern void enter_17_0(Synthetic_context_t *ctx);
+extern void enter_17_1(Synthetic_context_t *ctx);
+extern void enter_17_2(Synthetic_context_t *ctx);
+extern void enter_17_3(Synthetic_context_t *ctx);
+extern void enter_17_4(Synthetic_context_t *ctx);
+extern void enter_17_5(Synthetic_context_t *ctx);
+extern void enter_17_6(Synthetic_context_t *ctx);
+extern void enter_17_7(Synthetic_context_t *ctx);
+extern void enter_17_8(Synthetic_context_t *ctx);
+extern void enter_18_0(Synthetic_context_t *ctx);
+extern void enter_18_1(Synthetic_context_t *ctx);
+extern void enter_18_2(Synthetic_context_t *ctx);
+extern void enter_18_3(Synthetic_context_t *ctx);
+extern void enter_18_4(Synthetic_context_t *ctx);
+extern void enter_18_5(Synthetic_context_t *ctx);
+extern void enter_18_6(Synthetic_context_t *ctx);
+extern void enter_18_7(Synthetic_context_t *ctx);
+extern void enter_18_8(Synthetic_context_t *ctx);
+extern void enter_19_0(Synthetic_context_t *ctx);
+extern void enter_19_1(Synthetic_context_t *ctx);
+extern void enter_19_2(Synthetic_context_t *ctx);
+extern void enter_19_3(Synthetic_context_t *ctx);
+extern void enter_19_4(Synthetic_context_t *ctx);
+extern void enter_19_5(Synthetic_context_t *ctx);
+extern void enter_19_6(Synthetic_context_t *ctx);
+extern void enter_19_7(Synthetic_context_t *ctx);
+extern void enter_19_8(Synthetic_context_t *ctx);
+extern void enter_20_0(Synthetic_context_t *ctx);
+extern void enter_20_1(Synthetic_context_t *ctx);
+extern void enter_20_2(Synthetic_context_t *ctx);
+extern void enter_20_3(Synthetic_context_t *ctx);
+extern void enter_20_4(Synthetic_context_t *ctx);
+extern void enter_20_5(Synthetic_context_t *ctx);
+extern void enter_20_6(Synthetic_context_t *ctx);
+extern void enter_20_7(Synthetic_context_t *ctx);
+extern void enter_20_8(Synthetic_context_t *ctx);
+extern void enter_21_0(Synthetic_context_t *ctx);
+extern void enter_21_1(Synthetic_context_t *ctx);
+extern void enter_21_2(Synthetic_context_t *ctx);
+extern void enter_21_3(Synthetic_context_t *ctx);
+extern void enter_21_4(Synthetic_context_t *ctx);
+extern void enter_21_5(Synthetic_context_t *ctx);
+extern void enter_21_6(Synthetic_context_t *ctx);
+extern void enter_21_7(Synthetic_context_t *ctx);
+extern void enter_21_8(Synthetic_context_t *ctx);
+extern void enter_22_0(Synthetic_context_t *ctx);
+extern void enter_22_1(Synthetic_context_t *ctx);
+extern void enter_22_2(Synthetic_context_t *ctx);
+extern void enter_22_3(Synthetic_context_t *ctx);
+extern void enter_22_4(Synthetic_context_t *ctx);
+extern void enter_22_5(Synthetic_context_t *ctx);
+extern void enter_22_6(Synthetic_context_t *ctx);
+extern void enter_22_7(Synthetic_context_t *ctx);
+extern void enter_22_8(Synthetic_context_t *ctx);
+extern void enter_23_0(Synthetic_context_t *ctx);
+extern void enter_23_1(Synthetic_context_t *ctx);
+extern void enter_23_2(Synthetic_context_t *ctx);
+extern void enter_23_3(Synthetic_context_t *ctx);
+extern void enter_23_4(Synthetic_context_t *ctx);
+extern void enter_23_5(Synthetic_context_t *ctx);
+extern void enter_23_6(Synthetic_context_t *ctx);
+extern void enter_23_7(Synthetic_context_t *ctx);
+extern void enter_23_8(Synthetic_context_t *ctx);
+extern void enter_24_0(Synthetic_context_t *ctx);
+extern void enter_24_1(Synthetic_context_t *ctx);
+extern void enter_24_2(Synthetic_context_t *ctx);
+extern void enter_24_3(Synthetic_context_t *ctx);
+extern void enter_24_4(Synthetic_context_t *ctx);
+extern void enter_24_5(Synthetic_context_t *ctx);
+extern void enter_24_6(Synthetic_context_t *ctx);
+extern void enter_24_7(Synthetic_context_t *ctx);
+extern void enter_24_8(Synthetic_context_t *ctx);
+
+#endif /* SYNTHETIC_HSM_H */
@@ -0,0 +1,1580 @@
+/* AUTO-GENERATED by lexgen 2.0.0 — DO NOT EDIT */
+
+#include "synth_lexer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *token_names[] = {
+    "EOF",
+    "ERROR",
+    "KW0",
+    "KW1",
+    "KW2",
+    "KW3",
+    "KW4",
+    "KW5",
+    "KW6",
+    "KW7",
+    "KW8",
+    "KW9",
+    "KW10",
+    "KW11",
+    "KW12",
+    "KW13",
+    "KW14",
+    "KW15",
+    "KW16",
+    "KW17",
+    "KW18",
+    "KW19",
+    "KW20",
+    "KW21",
+    "KW22",
+    "KW23",
+    "KW24",
+    "KW25",
+    "KW26",
+    "KW27",
+    "KW28",
+    "KW29",
+    "KW30",
+    "KW31",
+    "KW32",
+    "KW33",
+    "KW34",
+    "KW35",
+    "KW36",
+    "KW37",
+    "KW38",
+    "KW39",
+    "KW40",
+    "KW41",
+    "KW42",
+    "KW43",
+    "KW44",
+    "KW45",
+    "KW46",
+    "KW47",
+    "KW48",
+    "KW49",
+    "KW50",
+    "KW51",
+    "KW52",
+    "KW53",
+    "KW54",
+    "KW55",
+    "KW56",
+    "KW57",
+    "KW58",
+    "KW59",
+    "KW60",
+    "KW61",
+    "KW62",
+    "KW63",
+    "KW64",
+    "KW65",
+    "KW66",
+    "KW67",
+    "KW68",
+    "KW69",
+    "KW70",
+    "KW71",
+    "KW72",
+    "KW73",
+    "KW74",
+    "KW75",
+    "KW76",
+    "KW77",
+    "KW78",
+    "KW79",
+    "KW80",
+    "KW81",
+    "KW82",
+    "KW83",
+    "KW84",
+    "KW85",
+    "KW86",
+    "KW87",
+    "KW88",
+    "KW89",
+    "KW90",
+    "KW91",
+    "KW92",
+    "KW93",
+    "KW94",
+    "KW95",
+    "KW96",
+    "KW97",
+    "KW98",
+    "KW99",
+    "KW100",
+    "KW101",
+    "KW102",
+    "KW103",
+    "KW104",
+    "KW105",
+    "KW106",
+    "KW107",
+    "KW108",
+    "KW109",
+    "KW110",
+    "KW111",
+    "KW112",
+    "KW113",
+    "KW114",
+    "KW115",
+    "KW116",
+    "KW117",
+    "KW118",
+    "KW119",
+    "KW120",
+    "KW121",
+    "KW122",
+    "KW123",
+    "KW124",
+    "KW125",
+    "KW126",
+    "KW127",
+    "KW128",
+    "KW129",
+    "KW130",
+    "KW131",
+    "KW132",
+    "KW133",
+    "KW134",
+    "KW135",
+    "KW136",
+    "KW137",
+    "KW138",
+    "KW139",
+    "KW140",
+    "KW141",
+    "KW142",
+    "KW143",
+    "KW144",
+    "KW145",
+    "KW146",
+    "KW147",
+    "KW148",
+    "KW149",
+    "KW150",
+    "KW151",
+    "KW152",
+    "KW153",
+    "KW154",
+    "KW155",
+    "KW156",
+    "KW157",
+    "KW158",
+    "KW159",
+    "KW160",
+    "KW161",
+    "KW162",
+    "KW163",
+    "KW164",
+    "KW165",
+    "KW166",
+    "KW167",
+    "KW168",
+    "KW169",
+    "KW170",
+    "KW171",
+    "KW172",
+    "KW173",
+    "KW174",
+    "KW175",
+    "KW176",
+    "KW177",
+    "KW178",
+    "KW179",
+    "KW180",
+    "KW181",
+    "KW182",
+    "KW183",
+    "KW184",
+    "KW185",
+    "KW186",
+    "KW187",
+    "KW188",
+    "KW189",
+    "KW190",
+    "KW191",
+    "KW192",
+    "KW193",
+    "KW194",
+    "KW195",
+    "KW196",
+    "KW197",
+    "KW198",
+    "KW199",
+    "KW200",
+    "KW201",
+    "KW202",
+    "KW203",
+    "KW204",
+    "KW205",
+    "KW206",
+    "KW207",
+    "KW208",
+    "KW209",
+    "KW210",
+    "KW211",
+    "KW212",
+    "KW213",
+    "KW214",
+    "KW215",
+    "KW216",
+    "KW217",
+    "KW218",
+    "KW219",
+    "KW220",
+    "KW221",
+    "KW222",
+    "KW223",
+    "KW224",
+    "KW225",
+    "KW226",
+    "KW227",
+    "KW228",
+    "KW229",
+    "KW230",
+    "KW231",
+    "KW232",
+    "KW233",
+    "KW234",
+    "KW235",
+    "KW236",
+    "KW237",
+    "KW238",
+    "KW239",
+    "KW240",
+    "KW241",
+    "KW242",
+    "KW243",
+    "KW244",
+    "KW245",
+    "KW246",
+    "KW247",
+    "KW248",
+    "KW249",
+    "KW250",
+    "KW251",
+    "KW252",
+    "KW253",
+    "KW254",
+    "KW255",
+    "KW256",
+    "KW257",
+    "KW258",
+    "KW259",
+    "KW260",
+    "KW261",
+    "KW262",
+    "KW263",
+    "KW264",
+    "KW265",
+    "KW266",
+    "KW267",
+    "KW268",
+    "KW269",
+    "KW270",
+    "KW271",
+    "KW272",
+    "KW273",
+    "KW274",
+    "KW275",
+    "KW276",
+    "KW277",
+    "KW278",
+    "KW279",
+    "KW280",
+    "KW281",
+    "KW282",
+    "KW283",
+    "KW284",
+    "KW285",
+    "KW286",
+    "KW287",
+    "KW288",
+    "KW289",
+    "KW290",
+    "KW291",
+    "KW292",
+    "KW293",
+    "KW294",
+    "KW295",
+    "KW296",
+    "KW297",
+    "KW298",
+    "KW299",
+    "KW300",
+    "KW301",
+    "KW302",
+    "KW303",
+    "KW304",
+    "KW305",
+    "KW306",
+    "KW307",
+    "KW308",
+    "KW309",
+    "KW310",
+    "KW311",
+    "KW312",
+    "KW313",
+    "KW314",
+    "KW315",
+    "KW316",
+    "KW317",
+    "KW318",
+    "KW319",
+    "KW320",
+    "KW321",
+    "KW322",
+    "KW323",
+    "KW324",
+    "KW325",
+    "KW326",
+    "KW327",
+    "KW328",
+    "KW329",
+    "KW330",
+    "KW331",
+    "KW332",
+    "KW333",
+    "KW334",
+    "KW335",
+    "KW336",
+    "KW337",
+    "KW338",
+    "KW339",
+    "KW340",
+    "KW341",
+    "KW342",
+    "KW343",
+    "KW344",
+    "KW345",
+    "KW346",
+    "KW347",
+    "KW348",
+    "KW349",
+    "KW350",
+    "KW351",
+    "KW352",
+    "KW353",
+    "KW354",
+    "KW355",
+    "KW356",
+    "KW357",
+    "KW358",
+    "KW359",
+    "KW360",
+    "KW361",
+    "KW362",
+    "KW363",
+    "KW364",
+    "KW365",
+    "KW366",
+    "KW367",
+    "KW368",
+    "KW369",
+    "KW370",
+    "KW371",
+    "KW372",
+    "KW373",
+    "KW374",
+    "KW375",
+    "KW376",
+    "KW377",
+    "KW378",
+    "KW379",
+    "KW380",
+    "KW381",
+    "KW382",
+    "KW383",
+    "KW384",
+    "KW385",
+    "KW386",
+    "KW387",
+    "KW388",
+    "KW389",
+    "KW390",
+    "KW391",
+    "KW392",
+    "KW393",
+    "KW394",
+    "KW395",
+    "KW396",
+    "KW397",
+    "KW398",
+    "KW399",
+    "KW400",
+    "KW401",
+    "KW402",
+    "KW403",
+    "KW404",
+    "KW405",
+    "KW406",
+    "KW407",
+    "KW408",
+    "KW409",
+    "KW410",
+    "KW411",
+    "KW412",
+    "KW413",
+    "KW414",
+    "KW415",
+    "KW416",
+    "KW417",
+    "KW418",
+    "KW419",
+    "KW420",
+    "KW421",
+    "KW422",
+    "KW423",
+    "KW424",
+    "KW425",
+    "KW426",
+    "KW427",
+    "KW428",
+    "KW429",
+    "KW430",
+    "KW431",
+    "KW432",
+    "KW433",
+    "KW434",
+    "KW435",
+    "KW436",
+    "KW437",
+    "KW438",
+    "KW439",
+    "KW440",
+    "KW441",
+    "KW442",
+    "KW443",
+    "KW444",
+    "KW445",
+    "KW446",
+    "KW447",
+    "KW448",
+    "KW449",
+    "KW450",
+    "KW451",
+    "KW452",
+    "KW453",
+    "KW454",
+    "KW455",
+    "KW456",
+    "KW457",
+    "KW458",
+    "KW459",
+    "KW460",
+    "KW461",
+    "KW462",
+    "KW463",
+    "KW464",
+    "KW465",
+    "KW466",
+    "KW467",
+    "KW468",
+    "KW469",
+    "OP1",
+    "OP2",
+    "OP3",
+    "OP4",
+    "OP5",
+    "OP6",
+    "OP7",
+    "OP8",
+    "OP9",
+    "OP10",
+    "OP11",
+    "OP12",
+    "OP13",
+    "OP14",
+    "OP15",
+    "OP16",
+    "OP17",
+    "OP18",
+    "OP19",
+    "OP20",
+    "OP21",
+    "OP22",
+    "OP23",
+    "OP24",
+    "IDENT",
+    "NUMBER",
+    "STRING_LIT",
+    "WHITESPACE",
+    "NEWLINE",
+    "COMMENT",
+};
+
+static const unsigned char token_skip[SYNTH_TOKEN_COUNT] = {
+    [SYNTH_WHITESPACE] = 1,
+    [SYNTH_NEWLINE] = 1,
+    [SYNTH_COMMENT] = 1,
+};
+
+/* DFA: 34 states x 32 byte classes; state 0 is dead */
+#define DFA_CLASSES 32
+#define DFA_START 1
+#define DFA_START_CONTEXT 1
+
+static const unsigned char byte_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 3, 4, 5, 0, 6, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 19, 20, 21, 22,
+    0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 25, 26, 27, 23,
+    0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 29, 30, 31, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned char dfa_next[1088] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 26, 27, 28, 29, 30, 31,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 32, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 33, 5, 5, 5, 5, 5, 5,
+    6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+static const unsigned short dfa_accept[34] = {
+    0, 0, 499, 500, 480, 0, 501, 476, 481, 490, 491, 474, 472, 488, 473, 489,
+    475, 497, 486, 487, 478, 477, 479, 485, 496, 492, 493, 483, 494, 482, 495, 484,
+    498, 0,
+};
+
+static const unsigned char dfa_run[34] = {
+    0, 0, 1, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+/* 470 keywords: perfect hash on every byte, displaced per bucket */
+#define KW_BITS 10
+#define KW_DBITS 8
+
+static const unsigned short kw_disp[1 << KW_DBITS] = {
+    0, 0, 0, 0, 2, 2, 1, 2, 1, 6, 1, 2, 1, 3, 2, 1,
+    4, 2, 0, 0, 0, 1, 2, 0, 0, 3, 3, 0, 4, 3, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 3, 0, 1, 0, 2, 1, 4, 6,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0,
+    2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 2, 1, 0,
+    4, 3, 1, 0, 0, 1, 2, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 2, 7, 7, 8, 0, 3, 1, 2, 0, 2, 0, 3, 6, 15, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 4, 1,
+    1, 8, 8, 0, 1, 0, 16, 1, 1, 2, 4, 2, 0, 0, 0, 0,
+};
+
+static const unsigned char kw_host[SYNTH_TOKEN_COUNT] = {
+    [SYNTH_IDENT] = 1,
+};
+
+static const struct {
+    unsigned char len;
+    unsigned short host;
+    unsigned short type;
+    const char *text;
+} kw_table[1 << KW_BITS] = {
+    [2] = { 5, SYNTH_IDENT, SYNTH_KW266, "kw266" },
+    [3] = { 4, SYNTH_IDENT, SYNTH_KW15, "kw15" },
+    [7] = { 5, SYNTH_IDENT, SYNTH_KW246, "kw246" },
+    [10] = { 5, SYNTH_IDENT, SYNTH_KW454, "kw454" },
+    [11] = { 4, SYNTH_IDENT, SYNTH_KW24, "kw24" },
+    [12] = { 5, SYNTH_IDENT, SYNTH_KW427, "kw427" },
+    [13] = { 5, SYNTH_IDENT, SYNTH_KW235, "kw235" },
+    [15] = { 5, SYNTH_IDENT, SYNTH_KW411, "kw411" },
+    [16] = { 5, SYNTH_IDENT, SYNTH_KW401, "kw401" },
+    [18] = { 4, SYNTH_IDENT, SYNTH_KW89, "kw89" },
+    [20] = { 5, SYNTH_IDENT, SYNTH_KW290, "kw290" },
+    [21] = { 5, SYNTH_IDENT, SYNTH_KW253, "kw253" },
+    [24] = { 4, SYNTH_IDENT, SYNTH_KW76, "kw76" },
+    [28] = { 5, SYNTH_IDENT, SYNTH_KW210, "kw210" },
+    [29] = { 5, SYNTH_IDENT, SYNTH_KW389, "kw389" },
+    [31] = { 5, SYNTH_IDENT, SYNTH_KW280, "kw280" },
+    [33] = { 5, SYNTH_IDENT, SYNTH_KW446, "kw446" },
+    [34] = { 5, SYNTH_IDENT, SYNTH_KW461, "kw461" },
+    [37] = { 5, SYNTH_IDENT, SYNTH_KW200, "kw200" },
+    [38] = { 5, SYNTH_IDENT, SYNTH_KW263, "kw263" },
+    [39] = { 5, SYNTH_IDENT, SYNTH_KW243, "kw243" },
+    [40] = { 5, SYNTH_IDENT, SYNTH_KW230, "kw230" },
+    [42] = { 5, SYNTH_IDENT, SYNTH_KW128, "kw128" },
+    [43] = { 5, SYNTH_IDENT, SYNTH_KW453, "kw453" },
+    [44] = { 4, SYNTH_IDENT, SYNTH_KW29, "kw29" },
+    [45] = { 5, SYNTH_IDENT, SYNTH_KW378, "kw378" },
+    [46] = { 5, SYNTH_IDENT, SYNTH_KW414, "kw414" },
+    [49] = { 5, SYNTH_IDENT, SYNTH_KW275, "kw275" },
+    [51] = { 5, SYNTH_IDENT, SYNTH_KW146, "kw146" },
+    [52] = { 5, SYNTH_IDENT, SYNTH_KW395, "kw395" },
+    [53] = { 5, SYNTH_IDENT, SYNTH_KW138, "kw138" },
+    [54] = { 5, SYNTH_IDENT, SYNTH_KW369, "kw369" },
+    [55] = { 5, SYNTH_IDENT, SYNTH_KW220, "kw220" },
+    [58] = { 5, SYNTH_IDENT, SYNTH_KW326, "kw326" },
+    [59] = { 5, SYNTH_IDENT, SYNTH_KW177, "kw177" },
+    [62] = { 5, SYNTH_IDENT, SYNTH_KW285, "kw285" },
+    [67] = { 5, SYNTH_IDENT, SYNTH_KW466, "kw466" },
+    [70] = { 5, SYNTH_IDENT, SYNTH_KW205, "kw205" },
+    [71] = { 5, SYNTH_IDENT, SYNTH_KW429, "kw429" },
+    [72] = { 5, SYNTH_IDENT, SYNTH_KW150, "kw150" },
+    [73] = { 5, SYNTH_IDENT, SYNTH_KW248, "kw248" },
+    [77] = { 5, SYNTH_IDENT, SYNTH_KW127, "kw127" },
+    [79] = { 5, SYNTH_IDENT, SYNTH_KW314, "kw314" },
+    [80] = { 3, SYNTH_IDENT, SYNTH_KW6, "kw6" },
+    [81] = { 5, SYNTH_IDENT, SYNTH_KW141, "kw141" },
+    [82] = { 5, SYNTH_IDENT, SYNTH_KW278, "kw278" },
+    [83] = { 5, SYNTH_IDENT, SYNTH_KW259, "kw259" },
+    [86] = { 5, SYNTH_IDENT, SYNTH_KW160, "kw160" },
+    [87] = { 5, SYNTH_IDENT, SYNTH_KW347, "kw347" },
+    [88] = { 5, SYNTH_IDENT, SYNTH_KW225, "kw225" },
+    [89] = { 5, SYNTH_IDENT, SYNTH_KW170, "kw170" },
+    [90] = { 5, SYNTH_IDENT, SYNTH_KW111, "kw111" },
+    [91] = { 5, SYNTH_IDENT, SYNTH_KW321, "kw321" },
+    [94] = { 5, SYNTH_IDENT, SYNTH_KW300, "kw300" },
+    [95] = { 5, SYNTH_IDENT, SYNTH_KW383, "kw383" },
+    [100] = { 5, SYNTH_IDENT, SYNTH_KW337, "kw337" },
+    [101] = { 5, SYNTH_IDENT, SYNTH_KW100, "kw100" },
+    [108] = { 5, SYNTH_IDENT, SYNTH_KW372, "kw372" },
+    [109] = { 5, SYNTH_IDENT, SYNTH_KW180, "kw180" },
+    [112] = { 5, SYNTH_IDENT, SYNTH_KW311, "kw311" },
+    [113] = { 5, SYNTH_IDENT, SYNTH_KW122, "kw122" },
+    [115] = { 5, SYNTH_IDENT, SYNTH_KW167, "kw167" },
+    [117] = { 5, SYNTH_IDENT, SYNTH_KW190, "kw190" },
+    [120] = { 5, SYNTH_IDENT, SYNTH_KW136, "kw136" },
+    [121] = { 5, SYNTH_IDENT, SYNTH_KW367, "kw367" },
+    [122] = { 5, SYNTH_IDENT, SYNTH_KW342, "kw342" },
+    [123] = { 5, SYNTH_IDENT, SYNTH_KW307, "kw307" },
+    [125] = { 4, SYNTH_IDENT, SYNTH_KW57, "kw57" },
+    [127] = { 5, SYNTH_IDENT, SYNTH_KW116, "kw116" },
+    [128] = { 5, SYNTH_IDENT, SYNTH_KW386, "kw386" },
+    [129] = { 5, SYNTH_IDENT, SYNTH_KW356, "kw356" },
+    [144] = { 5, SYNTH_IDENT, SYNTH_KW377, "kw377" },
+    [149] = { 5, SYNTH_IDENT, SYNTH_KW195, "kw195" },
+    [151] = { 4, SYNTH_IDENT, SYNTH_KW67, "kw67" },
+    [154] = { 4, SYNTH_IDENT, SYNTH_KW34, "kw34" },
+    [155] = { 5, SYNTH_IDENT, SYNTH_KW349, "kw349" },
+    [158] = { 4, SYNTH_IDENT, SYNTH_KW52, "kw52" },
+    [161] = { 4, SYNTH_IDENT, SYNTH_KW97, "kw97" },
+    [164] = { 5, SYNTH_IDENT, SYNTH_KW339, "kw339" },
+    [167] = { 4, SYNTH_IDENT, SYNTH_KW46, "kw46" },
+    [168] = { 5, SYNTH_IDENT, SYNTH_KW409, "kw409" },
+    [170] = { 4, SYNTH_IDENT, SYNTH_KW81, "kw81" },
+    [179] = { 4, SYNTH_IDENT, SYNTH_KW60, "kw60" },
+    [180] = { 5, SYNTH_IDENT, SYNTH_KW218, "kw218" },
+    [182] = { 5, SYNTH_IDENT, SYNTH_KW434, "kw434" },
+    [186] = { 5, SYNTH_IDENT, SYNTH_KW469, "kw469" },
+    [187] = { 4, SYNTH_IDENT, SYNTH_KW33, "kw33" },
+    [188] = { 5, SYNTH_IDENT, SYNTH_KW424, "kw424" },
+    [189] = { 5, SYNTH_IDENT, SYNTH_KW208, "kw208" },
+    [191] = { 4, SYNTH_IDENT, SYNTH_KW10, "kw10" },
+    [198] = { 4, SYNTH_IDENT, SYNTH_KW21, "kw21" },
+    [200] = { 4, SYNTH_IDENT, SYNTH_KW43, "kw43" },
+    [201] = { 5, SYNTH_IDENT, SYNTH_KW402, "kw402" },
+    [202] = { 5, SYNTH_IDENT, SYNTH_KW256, "kw256" },
+    [203] = { 4, SYNTH_IDENT, SYNTH_KW86, "kw86" },
+    [205] = { 5, SYNTH_IDENT, SYNTH_KW293, "kw293" },
+    [211] = { 4, SYNTH_IDENT, SYNTH_KW75, "kw75" },
+    [213] = { 5, SYNTH_IDENT, SYNTH_KW213, "kw213" },
+    [216] = { 5, SYNTH_IDENT, SYNTH_KW443, "kw443" },
+    [217] = { 5, SYNTH_IDENT, SYNTH_KW421, "kw421" },
+    [221] = { 5, SYNTH_IDENT, SYNTH_KW264, "kw264" },
+    [224] = { 5, SYNTH_IDENT, SYNTH_KW158, "kw158" },
+    [225] = { 5, SYNTH_IDENT, SYNTH_KW240, "kw240" },
+    [226] = { 4, SYNTH_IDENT, SYNTH_KW58, "kw58" },
+    [228] = { 5, SYNTH_IDENT, SYNTH_KW456, "kw456" },
+    [229] = { 5, SYNTH_IDENT, SYNTH_KW413, "kw413" },
+    [230] = { 4, SYNTH_IDENT, SYNTH_KW48, "kw48" },
+    [231] = { 5, SYNTH_IDENT, SYNTH_KW237, "kw237" },
+    [232] = { 5, SYNTH_IDENT, SYNTH_KW149, "kw149" },
+    [233] = { 5, SYNTH_IDENT, SYNTH_KW251, "kw251" },
+    [234] = { 5, SYNTH_IDENT, SYNTH_KW270, "kw270" },
+    [235] = { 5, SYNTH_IDENT, SYNTH_KW168, "kw168" },
+    [238] = { 5, SYNTH_IDENT, SYNTH_KW296, "kw296" },
+    [242] = { 4, SYNTH_IDENT, SYNTH_KW78, "kw78" },
+    [246] = { 5, SYNTH_IDENT, SYNTH_KW216, "kw216" },
+    [247] = { 5, SYNTH_IDENT, SYNTH_KW282, "kw282" },
+    [250] = { 5, SYNTH_IDENT, SYNTH_KW202, "kw202" },
+    [252] = { 5, SYNTH_IDENT, SYNTH_KW444, "kw444" },
+    [253] = { 5, SYNTH_IDENT, SYNTH_KW396, "kw396" },
+    [254] = { 5, SYNTH_IDENT, SYNTH_KW463, "kw463" },
+    [256] = { 5, SYNTH_IDENT, SYNTH_KW155, "kw155" },
+    [257] = { 5, SYNTH_IDENT, SYNTH_KW261, "kw261" },
+    [260] = { 5, SYNTH_IDENT, SYNTH_KW188, "kw188" },
+    [262] = { 5, SYNTH_IDENT, SYNTH_KW393, "kw393" },
+    [264] = { 5, SYNTH_IDENT, SYNTH_KW319, "kw319" },
+    [265] = { 5, SYNTH_IDENT, SYNTH_KW232, "kw232" },
+    [266] = { 3, SYNTH_IDENT, SYNTH_KW3, "kw3" },
+    [267] = { 5, SYNTH_IDENT, SYNTH_KW277, "kw277" },
+    [268] = { 5, SYNTH_IDENT, SYNTH_KW299, "kw299" },
+    [269] = { 5, SYNTH_IDENT, SYNTH_KW144, "kw144" },
+    [270] = { 5, SYNTH_IDENT, SYNTH_KW198, "kw198" },
+    [271] = { 5, SYNTH_IDENT, SYNTH_KW416, "kw416" },
+    [272] = { 5, SYNTH_IDENT, SYNTH_KW226, "kw226" },
+    [277] = { 5, SYNTH_IDENT, SYNTH_KW175, "kw175" },
+    [278] = { 5, SYNTH_IDENT, SYNTH_KW324, "kw324" },
+    [280] = { 5, SYNTH_IDENT, SYNTH_KW287, "kw287" },
+    [284] = { 5, SYNTH_IDENT, SYNTH_KW449, "kw449" },
+    [285] = { 5, SYNTH_IDENT, SYNTH_KW334, "kw334" },
+    [287] = { 5, SYNTH_IDENT, SYNTH_KW103, "kw103" },
+    [288] = { 5, SYNTH_IDENT, SYNTH_KW207, "kw207" },
+    [291] = { 5, SYNTH_IDENT, SYNTH_KW152, "kw152" },
+    [292] = { 5, SYNTH_IDENT, SYNTH_KW183, "kw183" },
+    [294] = { 5, SYNTH_IDENT, SYNTH_KW458, "kw458" },
+    [297] = { 5, SYNTH_IDENT, SYNTH_KW312, "kw312" },
+    [298] = { 5, SYNTH_IDENT, SYNTH_KW239, "kw239" },
+    [299] = { 3, SYNTH_IDENT, SYNTH_KW4, "kw4" },
+    [301] = { 5, SYNTH_IDENT, SYNTH_KW162, "kw162" },
+    [303] = { 5, SYNTH_IDENT, SYNTH_KW121, "kw121" },
+    [305] = { 5, SYNTH_IDENT, SYNTH_KW341, "kw341" },
+    [306] = { 5, SYNTH_IDENT, SYNTH_KW362, "kw362" },
+    [307] = { 5, SYNTH_IDENT, SYNTH_KW133, "kw133" },
+    [308] = { 5, SYNTH_IDENT, SYNTH_KW113, "kw113" },
+    [309] = { 5, SYNTH_IDENT, SYNTH_KW302, "kw302" },
+    [313] = { 5, SYNTH_IDENT, SYNTH_KW385, "kw385" },
+    [314] = { 5, SYNTH_IDENT, SYNTH_KW353, "kw353" },
+    [318] = { 5, SYNTH_IDENT, SYNTH_KW331, "kw331" },
+    [319] = { 5, SYNTH_IDENT, SYNTH_KW106, "kw106" },
+    [327] = { 5, SYNTH_IDENT, SYNTH_KW186, "kw186" },
+    [329] = { 5, SYNTH_IDENT, SYNTH_KW374, "kw374" },
+    [330] = { 4, SYNTH_IDENT, SYNTH_KW68, "kw68" },
+    [331] = { 5, SYNTH_IDENT, SYNTH_KW192, "kw192" },
+    [334] = { 3, SYNTH_IDENT, SYNTH_KW9, "kw9" },
+    [336] = { 5, SYNTH_IDENT, SYNTH_KW399, "kw399" },
+    [338] = { 5, SYNTH_IDENT, SYNTH_KW134, "kw134" },
+    [339] = { 5, SYNTH_IDENT, SYNTH_KW365, "kw365" },
+    [340] = { 4, SYNTH_IDENT, SYNTH_KW18, "kw18" },
+    [341] = { 5, SYNTH_IDENT, SYNTH_KW309, "kw309" },
+    [342] = { 5, SYNTH_IDENT, SYNTH_KW118, "kw118" },
+    [343] = { 4, SYNTH_IDENT, SYNTH_KW55, "kw55" },
+    [345] = { 4, SYNTH_IDENT, SYNTH_KW92, "kw92" },
+    [347] = { 5, SYNTH_IDENT, SYNTH_KW354, "kw354" },
+    [350] = { 5, SYNTH_IDENT, SYNTH_KW109, "kw109" },
+    [357] = { 5, SYNTH_IDENT, SYNTH_KW437, "kw437" },
+    [364] = { 4, SYNTH_IDENT, SYNTH_KW65, "kw65" },
+    [370] = { 5, SYNTH_IDENT, SYNTH_KW197, "kw197" },
+    [372] = { 4, SYNTH_IDENT, SYNTH_KW36, "kw36" },
+    [373] = { 4, SYNTH_IDENT, SYNTH_KW13, "kw13" },
+    [376] = { 4, SYNTH_IDENT, SYNTH_KW50, "kw50" },
+    [379] = { 4, SYNTH_IDENT, SYNTH_KW95, "kw95" },
+    [380] = { 5, SYNTH_IDENT, SYNTH_KW359, "kw359" },
+    [381] = { 4, SYNTH_IDENT, SYNTH_KW22, "kw22" },
+    [385] = { 4, SYNTH_IDENT, SYNTH_KW40, "kw40" },
+    [386] = { 5, SYNTH_IDENT, SYNTH_KW407, "kw407" },
+    [390] = { 4, SYNTH_IDENT, SYNTH_KW83, "kw83" },
+    [394] = { 4, SYNTH_IDENT, SYNTH_KW70, "kw70" },
+    [398] = { 5, SYNTH_IDENT, SYNTH_KW432, "kw432" },
+    [400] = { 5, SYNTH_IDENT, SYNTH_KW269, "kw269" },
+    [406] = { 4, SYNTH_IDENT, SYNTH_KW16, "kw16" },
+    [407] = { 5, SYNTH_IDENT, SYNTH_KW426, "kw426" },
+    [410] = { 5, SYNTH_IDENT, SYNTH_KW245, "kw245" },
+    [412] = { 4, SYNTH_IDENT, SYNTH_KW98, "kw98" },
+    [413] = { 5, SYNTH_IDENT, SYNTH_KW455, "kw455" },
+    [414] = { 4, SYNTH_IDENT, SYNTH_KW27, "kw27" },
+    [418] = { 5, SYNTH_IDENT, SYNTH_KW254, "kw254" },
+    [419] = { 5, SYNTH_IDENT, SYNTH_KW400, "kw400" },
+    [421] = { 4, SYNTH_IDENT, SYNTH_KW88, "kw88" },
+    [423] = { 5, SYNTH_IDENT, SYNTH_KW291, "kw291" },
+    [427] = { 4, SYNTH_IDENT, SYNTH_KW77, "kw77" },
+    [431] = { 5, SYNTH_IDENT, SYNTH_KW211, "kw211" },
+    [436] = { 5, SYNTH_IDENT, SYNTH_KW460, "kw460" },
+    [437] = { 4, SYNTH_IDENT, SYNTH_KW38, "kw38" },
+    [439] = { 5, SYNTH_IDENT, SYNTH_KW441, "kw441" },
+    [440] = { 5, SYNTH_IDENT, SYNTH_KW423, "kw423" },
+    [441] = { 5, SYNTH_IDENT, SYNTH_KW262, "kw262" },
+    [443] = { 5, SYNTH_IDENT, SYNTH_KW242, "kw242" },
+    [446] = { 5, SYNTH_IDENT, SYNTH_KW450, "kw450" },
+    [447] = { 4, SYNTH_IDENT, SYNTH_KW28, "kw28" },
+    [449] = { 5, SYNTH_IDENT, SYNTH_KW231, "kw231" },
+    [450] = { 5, SYNTH_IDENT, SYNTH_KW415, "kw415" },
+    [451] = { 5, SYNTH_IDENT, SYNTH_KW129, "kw129" },
+    [452] = { 5, SYNTH_IDENT, SYNTH_KW272, "kw272" },
+    [454] = { 5, SYNTH_IDENT, SYNTH_KW394, "kw394" },
+    [455] = { 5, SYNTH_IDENT, SYNTH_KW147, "kw147" },
+    [456] = { 5, SYNTH_IDENT, SYNTH_KW294, "kw294" },
+    [458] = { 5, SYNTH_IDENT, SYNTH_KW223, "kw223" },
+    [460] = { 5, SYNTH_IDENT, SYNTH_KW176, "kw176" },
+    [461] = { 5, SYNTH_IDENT, SYNTH_KW327, "kw327" },
+    [464] = { 5, SYNTH_IDENT, SYNTH_KW214, "kw214" },
+    [465] = { 5, SYNTH_IDENT, SYNTH_KW284, "kw284" },
+    [466] = { 5, SYNTH_IDENT, SYNTH_KW438, "kw438" },
+    [470] = { 5, SYNTH_IDENT, SYNTH_KW465, "kw465" },
+    [472] = { 5, SYNTH_IDENT, SYNTH_KW428, "kw428" },
+    [473] = { 5, SYNTH_IDENT, SYNTH_KW204, "kw204" },
+    [476] = { 5, SYNTH_IDENT, SYNTH_KW157, "kw157" },
+    [480] = { 5, SYNTH_IDENT, SYNTH_KW418, "kw418" },
+    [482] = { 5, SYNTH_IDENT, SYNTH_KW317, "kw317" },
+    [483] = { 5, SYNTH_IDENT, SYNTH_KW124, "kw124" },
+    [484] = { 3, SYNTH_IDENT, SYNTH_KW1, "kw1" },
+    [485] = { 5, SYNTH_IDENT, SYNTH_KW279, "kw279" },
+    [486] = { 5, SYNTH_IDENT, SYNTH_KW161, "kw161" },
+    [487] = { 5, SYNTH_IDENT, SYNTH_KW142, "kw142" },
+    [489] = { 5, SYNTH_IDENT, SYNTH_KW391, "kw391" },
+    [490] = { 5, SYNTH_IDENT, SYNTH_KW344, "kw344" },
+    [491] = { 5, SYNTH_IDENT, SYNTH_KW224, "kw224" },
+    [492] = { 5, SYNTH_IDENT, SYNTH_KW322, "kw322" },
+    [493] = { 5, SYNTH_IDENT, SYNTH_KW110, "kw110" },
+    [494] = { 5, SYNTH_IDENT, SYNTH_KW173, "kw173" },
+    [495] = { 5, SYNTH_IDENT, SYNTH_KW301, "kw301" },
+    [497] = { 5, SYNTH_IDENT, SYNTH_KW380, "kw380" },
+    [498] = { 5, SYNTH_IDENT, SYNTH_KW289, "kw289" },
+    [502] = { 5, SYNTH_IDENT, SYNTH_KW101, "kw101" },
+    [503] = { 5, SYNTH_IDENT, SYNTH_KW336, "kw336" },
+    [508] = { 5, SYNTH_IDENT, SYNTH_KW181, "kw181" },
+    [512] = { 5, SYNTH_IDENT, SYNTH_KW371, "kw371" },
+    [513] = { 5, SYNTH_IDENT, SYNTH_KW123, "kw123" },
+    [515] = { 5, SYNTH_IDENT, SYNTH_KW310, "kw310" },
+    [519] = { 5, SYNTH_IDENT, SYNTH_KW164, "kw164" },
+    [523] = { 5, SYNTH_IDENT, SYNTH_KW343, "kw343" },
+    [524] = { 5, SYNTH_IDENT, SYNTH_KW360, "kw360" },
+    [525] = { 5, SYNTH_IDENT, SYNTH_KW115, "kw115" },
+    [526] = { 5, SYNTH_IDENT, SYNTH_KW229, "kw229" },
+    [527] = { 5, SYNTH_IDENT, SYNTH_KW131, "kw131" },
+    [531] = { 5, SYNTH_IDENT, SYNTH_KW387, "kw387" },
+    [532] = { 5, SYNTH_IDENT, SYNTH_KW351, "kw351" },
+    [536] = { 5, SYNTH_IDENT, SYNTH_KW333, "kw333" },
+    [537] = { 5, SYNTH_IDENT, SYNTH_KW104, "kw104" },
+    [542] = { 5, SYNTH_IDENT, SYNTH_KW304, "kw304" },
+    [545] = { 5, SYNTH_IDENT, SYNTH_KW184, "kw184" },
+    [547] = { 5, SYNTH_IDENT, SYNTH_KW376, "kw376" },
+    [550] = { 4, SYNTH_IDENT, SYNTH_KW66, "kw66" },
+    [555] = { 5, SYNTH_IDENT, SYNTH_KW194, "kw194" },
+    [559] = { 4, SYNTH_IDENT, SYNTH_KW35, "kw35" },
+    [560] = { 5, SYNTH_IDENT, SYNTH_KW328, "kw328" },
+    [561] = { 4, SYNTH_IDENT, SYNTH_KW53, "kw53" },
+    [562] = { 5, SYNTH_IDENT, SYNTH_KW179, "kw179" },
+    [564] = { 4, SYNTH_IDENT, SYNTH_KW90, "kw90" },
+    [568] = { 4, SYNTH_IDENT, SYNTH_KW45, "kw45" },
+    [569] = { 5, SYNTH_IDENT, SYNTH_KW338, "kw338" },
+    [571] = { 5, SYNTH_IDENT, SYNTH_KW408, "kw408" },
+    [573] = { 4, SYNTH_IDENT, SYNTH_KW80, "kw80" },
+    [576] = { 5, SYNTH_IDENT, SYNTH_KW435, "kw435" },
+    [581] = { 5, SYNTH_IDENT, SYNTH_KW219, "kw219" },
+    [582] = { 4, SYNTH_IDENT, SYNTH_KW63, "kw63" },
+    [589] = { 5, SYNTH_IDENT, SYNTH_KW468, "kw468" },
+    [590] = { 4, SYNTH_IDENT, SYNTH_KW30, "kw30" },
+    [591] = { 4, SYNTH_IDENT, SYNTH_KW11, "kw11" },
+    [599] = { 4, SYNTH_IDENT, SYNTH_KW20, "kw20" },
+    [603] = { 4, SYNTH_IDENT, SYNTH_KW42, "kw42" },
+    [604] = { 5, SYNTH_IDENT, SYNTH_KW405, "kw405" },
+    [605] = { 5, SYNTH_IDENT, SYNTH_KW257, "kw257" },
+    [606] = { 4, SYNTH_IDENT, SYNTH_KW85, "kw85" },
+    [612] = { 4, SYNTH_IDENT, SYNTH_KW72, "kw72" },
+    [617] = { 5, SYNTH_IDENT, SYNTH_KW430, "kw430" },
+    [621] = { 5, SYNTH_IDENT, SYNTH_KW442, "kw442" },
+    [624] = { 4, SYNTH_IDENT, SYNTH_KW14, "kw14" },
+    [627] = { 4, SYNTH_IDENT, SYNTH_KW59, "kw59" },
+    [628] = { 5, SYNTH_IDENT, SYNTH_KW247, "kw247" },
+    [629] = { 5, SYNTH_IDENT, SYNTH_KW267, "kw267" },
+    [630] = { 5, SYNTH_IDENT, SYNTH_KW420, "kw420" },
+    [631] = { 5, SYNTH_IDENT, SYNTH_KW457, "kw457" },
+    [632] = { 4, SYNTH_IDENT, SYNTH_KW25, "kw25" },
+    [634] = { 5, SYNTH_IDENT, SYNTH_KW410, "kw410" },
+    [635] = { 5, SYNTH_IDENT, SYNTH_KW234, "kw234" },
+    [636] = { 5, SYNTH_IDENT, SYNTH_KW169, "kw169" },
+    [637] = { 5, SYNTH_IDENT, SYNTH_KW271, "kw271" },
+    [639] = { 5, SYNTH_IDENT, SYNTH_KW252, "kw252" },
+    [641] = { 5, SYNTH_IDENT, SYNTH_KW297, "kw297" },
+    [645] = { 4, SYNTH_IDENT, SYNTH_KW79, "kw79" },
+    [646] = { 5, SYNTH_IDENT, SYNTH_KW447, "kw447" },
+    [648] = { 5, SYNTH_IDENT, SYNTH_KW388, "kw388" },
+    [649] = { 5, SYNTH_IDENT, SYNTH_KW217, "kw217" },
+    [650] = { 5, SYNTH_IDENT, SYNTH_KW281, "kw281" },
+    [655] = { 5, SYNTH_IDENT, SYNTH_KW462, "kw462" },
+    [657] = { 5, SYNTH_IDENT, SYNTH_KW201, "kw201" },
+    [658] = { 5, SYNTH_IDENT, SYNTH_KW260, "kw260" },
+    [659] = { 5, SYNTH_IDENT, SYNTH_KW417, "kw417" },
+    [660] = { 5, SYNTH_IDENT, SYNTH_KW154, "kw154" },
+    [662] = { 5, SYNTH_IDENT, SYNTH_KW189, "kw189" },
+    [664] = { 5, SYNTH_IDENT, SYNTH_KW452, "kw452" },
+    [665] = { 5, SYNTH_IDENT, SYNTH_KW145, "kw145" },
+    [666] = { 5, SYNTH_IDENT, SYNTH_KW379, "kw379" },
+    [667] = { 5, SYNTH_IDENT, SYNTH_KW318, "kw318" },
+    [669] = { 3, SYNTH_IDENT, SYNTH_KW2, "kw2" },
+    [670] = { 5, SYNTH_IDENT, SYNTH_KW274, "kw274" },
+    [671] = { 5, SYNTH_IDENT, SYNTH_KW233, "kw233" },
+    [672] = { 5, SYNTH_IDENT, SYNTH_KW368, "kw368" },
+    [676] = { 5, SYNTH_IDENT, SYNTH_KW221, "kw221" },
+    [677] = { 5, SYNTH_IDENT, SYNTH_KW139, "kw139" },
+    [678] = { 5, SYNTH_IDENT, SYNTH_KW174, "kw174" },
+    [679] = { 5, SYNTH_IDENT, SYNTH_KW325, "kw325" },
+    [681] = { 5, SYNTH_IDENT, SYNTH_KW392, "kw392" },
+    [683] = { 5, SYNTH_IDENT, SYNTH_KW286, "kw286" },
+    [687] = { 5, SYNTH_IDENT, SYNTH_KW448, "kw448" },
+    [688] = { 5, SYNTH_IDENT, SYNTH_KW467, "kw467" },
+    [691] = { 5, SYNTH_IDENT, SYNTH_KW206, "kw206" },
+    [692] = { 5, SYNTH_IDENT, SYNTH_KW249, "kw249" },
+    [694] = { 5, SYNTH_IDENT, SYNTH_KW151, "kw151" },
+    [697] = { 5, SYNTH_IDENT, SYNTH_KW459, "kw459" },
+    [700] = { 5, SYNTH_IDENT, SYNTH_KW315, "kw315" },
+    [701] = { 5, SYNTH_IDENT, SYNTH_KW126, "kw126" },
+    [702] = { 3, SYNTH_IDENT, SYNTH_KW7, "kw7" },
+    [703] = { 5, SYNTH_IDENT, SYNTH_KW163, "kw163" },
+    [704] = { 5, SYNTH_IDENT, SYNTH_KW258, "kw258" },
+    [705] = { 5, SYNTH_IDENT, SYNTH_KW132, "kw132" },
+    [706] = { 5, SYNTH_IDENT, SYNTH_KW140, "kw140" },
+    [708] = { 5, SYNTH_IDENT, SYNTH_KW346, "kw346" },
+    [709] = { 5, SYNTH_IDENT, SYNTH_KW303, "kw303" },
+    [710] = { 5, SYNTH_IDENT, SYNTH_KW112, "kw112" },
+    [711] = { 5, SYNTH_IDENT, SYNTH_KW363, "kw363" },
+    [712] = { 5, SYNTH_IDENT, SYNTH_KW320, "kw320" },
+    [713] = { 5, SYNTH_IDENT, SYNTH_KW171, "kw171" },
+    [716] = { 5, SYNTH_IDENT, SYNTH_KW382, "kw382" },
+    [717] = { 5, SYNTH_IDENT, SYNTH_KW352, "kw352" },
+    [720] = { 5, SYNTH_IDENT, SYNTH_KW107, "kw107" },
+    [721] = { 5, SYNTH_IDENT, SYNTH_KW330, "kw330" },
+    [731] = { 5, SYNTH_IDENT, SYNTH_KW187, "kw187" },
+    [732] = { 5, SYNTH_IDENT, SYNTH_KW373, "kw373" },
+    [734] = { 3, SYNTH_IDENT, SYNTH_KW8, "kw8" },
+    [736] = { 5, SYNTH_IDENT, SYNTH_KW191, "kw191" },
+    [737] = { 5, SYNTH_IDENT, SYNTH_KW166, "kw166" },
+    [739] = { 5, SYNTH_IDENT, SYNTH_KW398, "kw398" },
+    [740] = { 5, SYNTH_IDENT, SYNTH_KW137, "kw137" },
+    [742] = { 5, SYNTH_IDENT, SYNTH_KW366, "kw366" },
+    [743] = { 4, SYNTH_IDENT, SYNTH_KW19, "kw19" },
+    [744] = { 5, SYNTH_IDENT, SYNTH_KW117, "kw117" },
+    [745] = { 5, SYNTH_IDENT, SYNTH_KW306, "kw306" },
+    [746] = { 4, SYNTH_IDENT, SYNTH_KW56, "kw56" },
+    [750] = { 5, SYNTH_IDENT, SYNTH_KW357, "kw357" },
+    [751] = { 4, SYNTH_IDENT, SYNTH_KW93, "kw93" },
+    [767] = { 4, SYNTH_IDENT, SYNTH_KW64, "kw64" },
+    [770] = { 5, SYNTH_IDENT, SYNTH_KW196, "kw196" },
+    [773] = { 5, SYNTH_IDENT, SYNTH_KW348, "kw348" },
+    [775] = { 4, SYNTH_IDENT, SYNTH_KW37, "kw37" },
+    [779] = { 4, SYNTH_IDENT, SYNTH_KW51, "kw51" },
+    [781] = { 5, SYNTH_IDENT, SYNTH_KW358, "kw358" },
+    [782] = { 4, SYNTH_IDENT, SYNTH_KW96, "kw96" },
+    [788] = { 4, SYNTH_IDENT, SYNTH_KW47, "kw47" },
+    [789] = { 5, SYNTH_IDENT, SYNTH_KW406, "kw406" },
+    [791] = { 4, SYNTH_IDENT, SYNTH_KW82, "kw82" },
+    [797] = { 4, SYNTH_IDENT, SYNTH_KW71, "kw71" },
+    [800] = { 4, SYNTH_IDENT, SYNTH_KW61, "kw61" },
+    [801] = { 5, SYNTH_IDENT, SYNTH_KW433, "kw433" },
+    [808] = { 4, SYNTH_IDENT, SYNTH_KW32, "kw32" },
+    [809] = { 5, SYNTH_IDENT, SYNTH_KW425, "kw425" },
+    [810] = { 5, SYNTH_IDENT, SYNTH_KW209, "kw209" },
+    [811] = { 5, SYNTH_IDENT, SYNTH_KW268, "kw268" },
+    [812] = { 4, SYNTH_IDENT, SYNTH_KW17, "kw17" },
+    [813] = { 5, SYNTH_IDENT, SYNTH_KW244, "kw244" },
+    [815] = { 4, SYNTH_IDENT, SYNTH_KW99, "kw99" },
+    [817] = { 4, SYNTH_IDENT, SYNTH_KW26, "kw26" },
+    [822] = { 5, SYNTH_IDENT, SYNTH_KW403, "kw403" },
+    [823] = { 5, SYNTH_IDENT, SYNTH_KW255, "kw255" },
+    [824] = { 4, SYNTH_IDENT, SYNTH_KW87, "kw87" },
+    [826] = { 5, SYNTH_IDENT, SYNTH_KW292, "kw292" },
+    [830] = { 4, SYNTH_IDENT, SYNTH_KW74, "kw74" },
+    [834] = { 5, SYNTH_IDENT, SYNTH_KW212, "kw212" },
+    [838] = { 5, SYNTH_IDENT, SYNTH_KW440, "kw440" },
+    [841] = { 5, SYNTH_IDENT, SYNTH_KW422, "kw422" },
+    [844] = { 5, SYNTH_IDENT, SYNTH_KW265, "kw265" },
+    [845] = { 5, SYNTH_IDENT, SYNTH_KW159, "kw159" },
+    [846] = { 5, SYNTH_IDENT, SYNTH_KW241, "kw241" },
+    [847] = { 4, SYNTH_IDENT, SYNTH_KW39, "kw39" },
+    [848] = { 4, SYNTH_IDENT, SYNTH_KW49, "kw49" },
+    [849] = { 5, SYNTH_IDENT, SYNTH_KW451, "kw451" },
+    [852] = { 5, SYNTH_IDENT, SYNTH_KW236, "kw236" },
+    [853] = { 5, SYNTH_IDENT, SYNTH_KW412, "kw412" },
+    [855] = { 5, SYNTH_IDENT, SYNTH_KW273, "kw273" },
+    [856] = { 5, SYNTH_IDENT, SYNTH_KW250, "kw250" },
+    [857] = { 5, SYNTH_IDENT, SYNTH_KW148, "kw148" },
+    [858] = { 5, SYNTH_IDENT, SYNTH_KW397, "kw397" },
+    [859] = { 5, SYNTH_IDENT, SYNTH_KW295, "kw295" },
+    [861] = { 5, SYNTH_IDENT, SYNTH_KW222, "kw222" },
+    [866] = { 5, SYNTH_IDENT, SYNTH_KW439, "kw439" },
+    [867] = { 5, SYNTH_IDENT, SYNTH_KW215, "kw215" },
+    [868] = { 5, SYNTH_IDENT, SYNTH_KW283, "kw283" },
+    [873] = { 5, SYNTH_IDENT, SYNTH_KW464, "kw464" },
+    [876] = { 5, SYNTH_IDENT, SYNTH_KW203, "kw203" },
+    [878] = { 5, SYNTH_IDENT, SYNTH_KW156, "kw156" },
+    [879] = { 5, SYNTH_IDENT, SYNTH_KW445, "kw445" },
+    [882] = { 5, SYNTH_IDENT, SYNTH_KW419, "kw419" },
+    [885] = { 5, SYNTH_IDENT, SYNTH_KW316, "kw316" },
+    [886] = { 5, SYNTH_IDENT, SYNTH_KW125, "kw125" },
+    [887] = { 3, SYNTH_IDENT, SYNTH_KW0, "kw0" },
+    [888] = { 5, SYNTH_IDENT, SYNTH_KW276, "kw276" },
+    [889] = { 5, SYNTH_IDENT, SYNTH_KW199, "kw199" },
+    [890] = { 5, SYNTH_IDENT, SYNTH_KW390, "kw390" },
+    [891] = { 5, SYNTH_IDENT, SYNTH_KW143, "kw143" },
+    [892] = { 5, SYNTH_IDENT, SYNTH_KW298, "kw298" },
+    [893] = { 5, SYNTH_IDENT, SYNTH_KW345, "kw345" },
+    [894] = { 5, SYNTH_IDENT, SYNTH_KW227, "kw227" },
+    [896] = { 5, SYNTH_IDENT, SYNTH_KW172, "kw172" },
+    [897] = { 5, SYNTH_IDENT, SYNTH_KW323, "kw323" },
+    [901] = { 5, SYNTH_IDENT, SYNTH_KW288, "kw288" },
+    [903] = { 5, SYNTH_IDENT, SYNTH_KW381, "kw381" },
+    [906] = { 5, SYNTH_IDENT, SYNTH_KW335, "kw335" },
+    [907] = { 5, SYNTH_IDENT, SYNTH_KW102, "kw102" },
+    [912] = { 5, SYNTH_IDENT, SYNTH_KW182, "kw182" },
+    [913] = { 5, SYNTH_IDENT, SYNTH_KW153, "kw153" },
+    [915] = { 5, SYNTH_IDENT, SYNTH_KW238, "kw238" },
+    [917] = { 5, SYNTH_IDENT, SYNTH_KW370, "kw370" },
+    [918] = { 5, SYNTH_IDENT, SYNTH_KW313, "kw313" },
+    [919] = { 5, SYNTH_IDENT, SYNTH_KW120, "kw120" },
+    [920] = { 3, SYNTH_IDENT, SYNTH_KW5, "kw5" },
+    [923] = { 5, SYNTH_IDENT, SYNTH_KW165, "kw165" },
+    [924] = { 5, SYNTH_IDENT, SYNTH_KW340, "kw340" },
+    [925] = { 5, SYNTH_IDENT, SYNTH_KW130, "kw130" },
+    [926] = { 5, SYNTH_IDENT, SYNTH_KW228, "kw228" },
+    [927] = { 5, SYNTH_IDENT, SYNTH_KW361, "kw361" },
+    [928] = { 5, SYNTH_IDENT, SYNTH_KW305, "kw305" },
+    [929] = { 5, SYNTH_IDENT, SYNTH_KW114, "kw114" },
+    [934] = { 5, SYNTH_IDENT, SYNTH_KW384, "kw384" },
+    [935] = { 5, SYNTH_IDENT, SYNTH_KW350, "kw350" },
+    [937] = { 5, SYNTH_IDENT, SYNTH_KW332, "kw332" },
+    [938] = { 5, SYNTH_IDENT, SYNTH_KW105, "kw105" },
+    [949] = { 5, SYNTH_IDENT, SYNTH_KW185, "kw185" },
+    [950] = { 5, SYNTH_IDENT, SYNTH_KW375, "kw375" },
+    [952] = { 4, SYNTH_IDENT, SYNTH_KW69, "kw69" },
+    [957] = { 5, SYNTH_IDENT, SYNTH_KW193, "kw193" },
+    [960] = { 5, SYNTH_IDENT, SYNTH_KW364, "kw364" },
+    [961] = { 5, SYNTH_IDENT, SYNTH_KW119, "kw119" },
+    [962] = { 5, SYNTH_IDENT, SYNTH_KW178, "kw178" },
+    [963] = { 5, SYNTH_IDENT, SYNTH_KW329, "kw329" },
+    [964] = { 4, SYNTH_IDENT, SYNTH_KW54, "kw54" },
+    [966] = { 5, SYNTH_IDENT, SYNTH_KW135, "kw135" },
+    [967] = { 4, SYNTH_IDENT, SYNTH_KW91, "kw91" },
+    [968] = { 5, SYNTH_IDENT, SYNTH_KW355, "kw355" },
+    [970] = { 5, SYNTH_IDENT, SYNTH_KW308, "kw308" },
+    [972] = { 5, SYNTH_IDENT, SYNTH_KW108, "kw108" },
+    [973] = { 4, SYNTH_IDENT, SYNTH_KW44, "kw44" },
+    [985] = { 4, SYNTH_IDENT, SYNTH_KW62, "kw62" },
+    [989] = { 5, SYNTH_IDENT, SYNTH_KW436, "kw436" },
+    [993] = { 4, SYNTH_IDENT, SYNTH_KW31, "kw31" },
+    [995] = { 4, SYNTH_IDENT, SYNTH_KW12, "kw12" },
+    [1000] = { 4, SYNTH_IDENT, SYNTH_KW94, "kw94" },
+    [1002] = { 4, SYNTH_IDENT, SYNTH_KW23, "kw23" },
+    [1006] = { 4, SYNTH_IDENT, SYNTH_KW41, "kw41" },
+    [1007] = { 5, SYNTH_IDENT, SYNTH_KW404, "kw404" },
+    [1010] = { 4, SYNTH_IDENT, SYNTH_KW84, "kw84" },
+    [1015] = { 4, SYNTH_IDENT, SYNTH_KW73, "kw73" },
+    [1019] = { 5, SYNTH_IDENT, SYNTH_KW431, "kw431" },
+};
+
+static int kw_lookup(const unsigned char *s, size_t len, int type) {
+    uint32_t h;
+    if (len < 3 || len > 5) return type;
+    h = 723471715u;
+    for (size_t i = 0; i < len; i++) h = (h ^ s[i]) * 16777619u;
+    h = (h ^ kw_disp[h >> (32 - KW_DBITS)]) & ((1u << KW_BITS) - 1);
+    if (kw_table[h].host == type && kw_table[h].len == len &&
+        memcmp(kw_table[h].text, s, len) == 0)
+        return kw_table[h].type;
+    return type;
+}
+
+/* Run scanners: first byte at or after p that leaves a self-loop.
+ * Define LEX_NO_SIMD to keep only the scalar loops. */
+#if !defined(LEX_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define LEX_SIMD_AVX2 1
+#elif !defined(LEX_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define LEX_SIMD_SSE2 1
+#elif !defined(LEX_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LEX_SIMD_NEON 1
+#endif
+
+/* over 9 13 32 */
+static const unsigned char *lex_run1(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i t;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)9));
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)13));
+        m = _mm256_or_si256(m, t);
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)32));
+        m = _mm256_or_si256(m, t);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i t;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)9));
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)13));
+        m = _mm_or_si128(m, t);
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)32));
+        m = _mm_or_si128(m, t);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(9)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(13)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(32)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && (*p == 9 || *p == 13 || *p == 32)) p++;
+    return p;
+}
+
+/* stops at 34 92 */
+static const unsigned char *lex_run2(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i t;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)34));
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)92));
+        m = _mm256_or_si256(m, t);
+        unsigned stop = (unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i t;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)34));
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)92));
+        m = _mm_or_si128(m, t);
+        unsigned stop = (unsigned)_mm_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(34)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(92)));
+        uint64_t stop = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && !(*p == 34 || *p == 92)) p++;
+    return p;
+}
+
+/* stops at 10 */
+static const unsigned char *lex_run3(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)10));
+        unsigned stop = (unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)10));
+        unsigned stop = (unsigned)_mm_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(10)));
+        uint64_t stop = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && !(*p == 10)) p++;
+    return p;
+}
+
+/* over 48-57 */
+static const unsigned char *lex_run4(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i d;
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)48));
+        m = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)9)), d);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i d;
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)48));
+        m = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)9)), d);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(48)), vdupq_n_u8(9)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && ((unsigned char)(*p - 48) <= 9)) p++;
+    return p;
+}
+
+/* over 48-57 65-90 95 97-122 */
+static const unsigned char *lex_run5(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i d;
+        __m256i t;
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)48));
+        m = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)9)), d);
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)65));
+        t = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)25)), d);
+        m = _mm256_or_si256(m, t);
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)95));
+        m = _mm256_or_si256(m, t);
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)97));
+        t = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)25)), d);
+        m = _mm256_or_si256(m, t);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i d;
+        __m128i t;
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)48));
+        m = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)9)), d);
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)65));
+        t = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)25)), d);
+        m = _mm_or_si128(m, t);
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)95));
+        m = _mm_or_si128(m, t);
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)97));
+        t = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)25)), d);
+        m = _mm_or_si128(m, t);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(48)), vdupq_n_u8(9)));
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(65)), vdupq_n_u8(25)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(95)));
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(97)), vdupq_n_u8(25)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && ((unsigned char)(*p - 48) <= 9 || (unsigned char)(*p - 65) <= 25 || *p == 95 || (unsigned char)(*p - 97) <= 25)) p++;
+    return p;
+}
+
+static const unsigned char *lex_run(int k, const unsigned char *p, const unsigned char *end) {
+    switch (k) {
+    case 1: return lex_run1(p, end);
+    case 2: return lex_run2(p, end);
+    case 3: return lex_run3(p, end);
+    case 4: return lex_run4(p, end);
+    case 5: return lex_run5(p, end);
+    default: return p;
+    }
+}
+
+void SYNTH_lexer_init_n(SYNTH_lexer_t *lex, const char *source, size_t length) {
+    memset(lex, 0, sizeof(*lex));
+    lex->source = source;
+    lex->current = source;
+    lex->end = source + length;
+    lex->line = 1;
+    lex->column = 1;
+}
+
+void SYNTH_lexer_init(SYNTH_lexer_t *lex, const char *source) {
+    SYNTH_lexer_init_n(lex, source, strlen(source));
+}
+
+int SYNTH_lexer_init_stream(SYNTH_lexer_t *lex, SYNTH_refill_fn refill, void *ctx, size_t bufsize) {
+    char *buf = malloc(bufsize ? bufsize : 1);
+    if (!buf) return -1;
+    SYNTH_lexer_init_n(lex, "", 0);
+    lex->source = lex->current = lex->end = buf;
+    lex->refill = refill;
+    lex->refill_ctx = ctx;
+    lex->buf = buf;
+    lex->cap = bufsize ? bufsize : 1;
+    return 0;
+}
+
+void SYNTH_lexer_free(SYNTH_lexer_t *lex) {
+    free(lex->buf);
+    lex->buf = NULL;
+}
+
+static int lex_refill(SYNTH_lexer_t *lex) {
+    size_t keep, n;
+    if (!lex->refill || lex->eof) return 0;
+    keep = (size_t)(lex->end - lex->current);
+    if (lex->current != lex->buf) {
+        memmove(lex->buf, lex->current, keep);
+    } else if (keep == lex->cap) {
+        char *grown = realloc(lex->buf, lex->cap * 2);
+        if (!grown) return 0;
+        lex->buf = grown;
+        lex->cap *= 2;
+    }
+    n = lex->refill(lex->refill_ctx, lex->buf + keep, lex->cap - keep);
+    lex->source = lex->buf;
+    lex->current = lex->buf;
+    lex->end = lex->buf + keep + n;
+    if (n == 0) lex->eof = 1;
+    return n > 0;
+}
+
+const char *SYNTH_token_name(SYNTH_token_type_t type) {
+    if (type >= 0 && type < SYNTH_TOKEN_COUNT) {
+        return token_names[type];
+    }
+    return "UNKNOWN";
+}
+
+static void lex_advance(SYNTH_lexer_t *lex, size_t len) {
+    const char *p = lex->current, *end = p + len, *nl;
+    while ((nl = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+        lex->line++;
+        lex->column = 1;
+        p = nl + 1;
+    }
+    lex->column += (int)(end - p);
+    lex->current = end;
+}
+
+static int lex_match(const unsigned char *p, const unsigned char *end, int context,
+                     size_t *length, int *at_end) {
+    const unsigned char *start = p, *last = p + 1;
+    unsigned s = context ? DFA_START_CONTEXT : DFA_START;
+    int type = SYNTH_TOKEN_ERROR;
+
+    *at_end = 0;
+    /* Run to the dead state, remembering the last accept */
+    while (p < end && (s = dfa_next[s * DFA_CLASSES + byte_class[*p]]) != 0) {
+        p++;
+        if (dfa_run[s]) p = lex_run(dfa_run[s], p, end);
+        if (dfa_accept[s]) {
+            type = dfa_accept[s];
+            last = p;
+        }
+    }
+    *at_end = p >= end;
+    *length = (size_t)(last - start);
+    if (kw_host[type]) type = kw_lookup(start, *length, type);
+    return type;
+}
+
+SYNTH_token_t SYNTH_lexer_next(SYNTH_lexer_t *lex) {
+    SYNTH_token_t tok;
+    for (;;) {
+        const unsigned char *p = (const unsigned char *)lex->current;
+        const unsigned char *end = (const unsigned char *)lex->end;
+        int type, at_end;
+
+        tok.start = lex->current;
+        tok.line = lex->line;
+        tok.column = lex->column;
+        if (p >= end) {
+            if (lex_refill(lex)) continue;
+            tok.start = lex->current;
+            tok.type = SYNTH_TOKEN_EOF;
+            tok.length = 0;
+            return tok;
+        }
+        type = lex_match(p, end, lex->context, &tok.length, &at_end);
+        /* input ran out mid-token: refill and rescan it; at EOF the
+         * refill may still have moved the token to the buffer start */
+        if (at_end) {
+            if (lex_refill(lex)) continue;
+            tok.start = lex->current;
+        }
+        tok.type = (SYNTH_token_type_t)type;
+        lex_advance(lex, tok.length);
+        if (!token_skip[type]) return tok;
+    }
+}
+
+static int tokens_grow(SYNTH_tokens_t *t) {
+    size_t cap = t->cap ? t->cap * 2 : 64;
+    void *type = realloc(t->type, cap * sizeof(*t->type));
+    if (!type) return -1;
+    t->type = type;
+    void *offset = realloc(t->offset, cap * sizeof(*t->offset));
+    if (!offset) return -1;
+    t->offset = offset;
+    void *length = realloc(t->length, cap * sizeof(*t->length));
+    if (!length) return -1;
+    t->length = length;
+    t->cap = cap;
+    return 0;
+}
+
+int SYNTH_tokenize_all(const char *source, size_t length, SYNTH_tokens_t *t) {
+    const unsigned char *base = (const unsigned char *)source;
+    size_t pos = 0;
+
+    memset(t, 0, sizeof(*t));
+    t->source = source;
+    t->source_len = length;
+    if (length > UINT32_MAX) return -1;
+    /* one token per ~4 bytes covers typical specs without regrowing */
+    t->cap = length / 4 + 16;
+    t->type = malloc(t->cap * sizeof(*t->type));
+    t->offset = malloc(t->cap * sizeof(*t->offset));
+    t->length = malloc(t->cap * sizeof(*t->length));
+    if (!t->type || !t->offset || !t->length) goto fail;
+
+    while (pos < length) {
+        size_t len;
+        int at_end;
+        int type = lex_match(base + pos, base + length, 0, &len, &at_end);
+        if (!token_skip[type]) {
+            if (t->count == t->cap && tokens_grow(t) != 0) goto fail;
+            t->type[t->count] = (uint16_t)type;
+            t->offset[t->count] = (uint32_t)pos;
+            t->length[t->count] = (uint32_t)len;
+            t->count++;
+        }
+        pos += len;
+    }
+    if (t->count == t->cap && tokens_grow(t) != 0) goto fail;
+    t->type[t->count] = SYNTH_TOKEN_EOF;
+    t->offset[t->count] = (uint32_t)length;
+    t->length[t->count] = 0;
+    t->count++;
+    return 0;
+
+fail:
+    SYNTH_tokens_free(t);
+    return -1;
+}
+
+void SYNTH_tokens_free(SYNTH_tokens_t *t) {
+    free(t->type);
+    free(t->offset);
+    free(t->length);
+    free(t->line_start);
+    memset(t, 0, sizeof(*t));
+}
+
+int SYNTH_tokens_position(SYNTH_tokens_t *t, size_t index, int *line, int *column) {
+    size_t lo = 0, hi;
+    uint32_t off;
+
+    if (index >= t->count) return -1;
+    if (!t->line_start) {
+        const char *p = t->source, *end = t->source + t->source_len, *nl;
+        size_t n = 1;
+        for (nl = p; (nl = memchr(nl, '\n', (size_t)(end - nl))) != NULL; nl++) n++;
+        t->line_start = malloc(n * sizeof(*t->line_start));
+        if (!t->line_start) return -1;
+        t->line_start[0] = 0;
+        t->line_count = 1;
+        for (nl = p; (nl = memchr(nl, '\n', (size_t)(end - nl))) != NULL; nl++)
+            t->line_start[t->line_count++] = (uint32_t)(nl + 1 - p);
+    }
+    /* last line starting at or before the token */
+    off = t->offset[index];
+    hi = t->line_count;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (t->line_start[mid] <= off) lo = mid;
+        else hi = mid;
+    }
+    *line = (int)lo + 1;
+    *column = (int)(off - t->line_start[lo]) + 1;
+    return 0;
+}
@@ -0,0 +1,566 @@
+/* AUTO-GENERATED by lexgen 2.0.0 — DO NOT EDIT */
+#ifndef SYNTH_LEXER_H
+#define SYNTH_LEXER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    SYNTH_TOKEN_EOF = 0,
+    SYNTH_TOKEN_ERROR,
+    SYNTH_KW0,
+    SYNTH_KW1,
+    SYNTH_KW2,
+    SYNTH_KW3,
+    SYNTH_KW4,
+    SYNTH_KW5,
+    SYNTH_KW6,
+    SYNTH_KW7,
+    SYNTH_KW8,
+    SYNTH_KW9,
+    SYNTH_KW10,
+    SYNTH_KW11,
+    SYNTH_KW12,
+    SYNTH_KW13,
+    SYNTH_KW14,
+    SYNTH_KW15,
+    SYNTH_KW16,
+    SYNTH_KW17,
+    SYNTH_KW18,
+    SYNTH_KW19,
+    SYNTH_KW20,
+    SYNTH_KW21,
+    SYNTH_KW22,
+    SYNTH_KW23,
+    SYNTH_KW24,
+    SYNTH_KW25,
+    SYNTH_KW26,
+    SYNTH_KW27,
+    SYNTH_KW28,
+    SYNTH_KW29,
+    SYNTH_KW30,
+    SYNTH_KW31,
+    SYNTH_KW32,
+    SYNTH_KW33,
+    SYNTH_KW34,
+    SYNTH_KW35,
+    SYNTH_KW36,
+    SYNTH_KW37,
+    SYNTH_KW38,
+    SYNTH_KW39,
+    SYNTH_KW40,
+    SYNTH_KW41,
+    SYNTH_KW42,
+    SYNTH_KW43,
+    SYNTH_KW44,
+    SYNTH_KW45,
+    SYNTH_KW46,
+    SYNTH_KW47,
+    SYNTH_KW48,
+    SYNTH_KW49,
+    SYNTH_KW50,
+    SYNTH_KW51,
+    SYNTH_KW52,
+    SYNTH_KW53,
+    SYNTH_KW54,
+    SYNTH_KW55,
+    SYNTH_KW56,
+    SYNTH_KW57,
+    SYNTH_KW58,
+    SYNTH_KW59,
+    SYNTH_KW60,
+    SYNTH_KW61,
+    SYNTH_KW62,
+    SYNTH_KW63,
+    SYNTH_KW64,
+    SYNTH_KW65,
+    SYNTH_KW66,
+    SYNTH_KW67,
+    SYNTH_KW68,
+    SYNTH_KW69,
+    SYNTH_KW70,
+    SYNTH_KW71,
+    SYNTH_KW72,
+    SYNTH_KW73,
+    SYNTH_KW74,
+    SYNTH_KW75,
+    SYNTH_KW76,
+    SYNTH_KW77,
+    SYNTH_KW78,
+    SYNTH_KW79,
+    SYNTH_KW80,
+    SYNTH_KW81,
+    SYNTH_KW82,
+    SYNTH_KW83,
+    SYNTH_KW84,
+    SYNTH_KW85,
+    SYNTH_KW86,
+    SYNTH_KW87,
+    SYNTH_KW88,
+    SYNTH_KW89,
+    SYNTH_KW90,
+    SYNTH_KW91,
+    SYNTH_KW92,
+    SYNTH_KW93,
+    SYNTH_KW94,
+    SYNTH_KW95,
+    SYNTH_KW96,
+    SYNTH_KW97,
+    SYNTH_KW98,
+    SYNTH_KW99,
+    SYNTH_KW100,
+    SYNTH_KW101,
+    SYNTH_KW102,
+    SYNTH_KW103,
+    SYNTH_KW104,
+    SYNTH_KW105,
+    SYNTH_KW106,
+    SYNTH_KW107,
+    SYNTH_KW108,
+    SYNTH_KW109,
+    SYNTH_KW110,
+    SYNTH_KW111,
+    SYNTH_KW112,
+    SYNTH_KW113,
+    SYNTH_KW114,
+    SYNTH_KW115,
+    SYNTH_KW116,
+    SYNTH_KW117,
+    SYNTH_KW118,
+    SYNTH_KW119,
+    SYNTH_KW120,
+    SYNTH_KW121,
+    SYNTH_KW122,
+    SYNTH_KW123,
+    SYNTH_KW124,
+    SYNTH_KW125,
+    SYNTH_KW126,
+    SYNTH_KW127,
+    SYNTH_KW128,
+    SYNTH_KW129,
+    SYNTH_KW130,
+    SYNTH_KW131,
+    SYNTH_KW132,
+    SYNTH_KW133,
+    SYNTH_KW134,
+    SYNTH_KW135,
+    SYNTH_KW136,
+    SYNTH_KW137,
+    SYNTH_KW138,
+    SYNTH_KW139,
+    SYNTH_KW140,
+    SYNTH_KW141,
+    SYNTH_KW142,
+    SYNTH_KW143,
+    SYNTH_KW144,
+    SYNTH_KW145,
+    SYNTH_KW146,
+    SYNTH_KW147,
+    SYNTH_KW148,
+    SYNTH_KW149,
+    SYNTH_KW150,
+    SYNTH_KW151,
+    SYNTH_KW152,
+    SYNTH_KW153,
+    SYNTH_KW154,
+    SYNTH_KW155,
+    SYNTH_KW156,
+    SYNTH_KW157,
+    SYNTH_KW158,
+    SYNTH_KW159,
+    SYNTH_KW160,
+    SYNTH_KW161,
+    SYNTH_KW162,
+    SYNTH_KW163,
+    SYNTH_KW164,
+    SYNTH_KW165,
+    SYNTH_KW166,
+    SYNTH_KW167,
+    SYNTH_KW168,
+    SYNTH_KW169,
+    SYNTH_KW170,
+    SYNTH_KW171,
+    SYNTH_KW172,
+    SYNTH_KW173,
+    SYNTH_KW174,
+    SYNTH_KW175,
+    SYNTH_KW176,
+    SYNTH_KW177,
+    SYNTH_KW178,
+    SYNTH_KW179,
+    SYNTH_KW180,
+    SYNTH_KW181,
+    SYNTH_KW182,
+    SYNTH_KW183,
+    SYNTH_KW184,
+    SYNTH_KW185,
+    SYNTH_KW186,
+    SYNTH_KW187,
+    SYNTH_KW188,
+    SYNTH_KW189,
+    SYNTH_KW190,
+    SYNTH_KW191,
+    SYNTH_KW192,
+    SYNTH_KW193,
+    SYNTH_KW194,
+    SYNTH_KW195,
+    SYNTH_KW196,
+    SYNTH_KW197,
+    SYNTH_KW198,
+    SYNTH_KW199,
+    SYNTH_KW200,
+    SYNTH_KW201,
+    SYNTH_KW202,
+    SYNTH_KW203,
+    SYNTH_KW204,
+    SYNTH_KW205,
+    SYNTH_KW206,
+    SYNTH_KW207,
+    SYNTH_KW208,
+    SYNTH_KW209,
+    SYNTH_KW210,
+    SYNTH_KW211,
+    SYNTH_KW212,
+    SYNTH_KW213,
+    SYNTH_KW214,
+    SYNTH_KW215,
+    SYNTH_KW216,
+    SYNTH_KW217,
+    SYNTH_KW218,
+    SYNTH_KW219,
+    SYNTH_KW220,
+    SYNTH_KW221,
+    SYNTH_KW222,
+    SYNTH_KW223,
+    SYNTH_KW224,
+    SYNTH_KW225,
+    SYNTH_KW226,
+    SYNTH_KW227,
+    SYNTH_KW228,
+    SYNTH_KW229,
+    SYNTH_KW230,
+    SYNTH_KW231,
+    SYNTH_KW232,
+    SYNTH_KW233,
+    SYNTH_KW234,
+    SYNTH_KW235,
+    SYNTH_KW236,
+    SYNTH_KW237,
+    SYNTH_KW238,
+    SYNTH_KW239,
+    SYNTH_KW240,
+    SYNTH_KW241,
+    SYNTH_KW242,
+    SYNTH_KW243,
+    SYNTH_KW244,
+    SYNTH_KW245,
+    SYNTH_KW246,
+    SYNTH_KW247,
+    SYNTH_KW248,
+    SYNTH_KW249,
+    SYNTH_KW250,
+    SYNTH_KW251,
+    SYNTH_KW252,
+    SYNTH_KW253,
+    SYNTH_KW254,
+    SYNTH_KW255,
+    SYNTH_KW256,
+    SYNTH_KW257,
+    SYNTH_KW258,
+    SYNTH_KW259,
+    SYNTH_KW260,
+    SYNTH_KW261,
+    SYNTH_KW262,
+    SYNTH_KW263,
+    SYNTH_KW264,
+    SYNTH_KW265,
+    SYNTH_KW266,
+    SYNTH_KW267,
+    SYNTH_KW268,
+    SYNTH_KW269,
+    SYNTH_KW270,
+    SYNTH_KW271,
+    SYNTH_KW272,
+    SYNTH_KW273,
+    SYNTH_KW274,
+    SYNTH_KW275,
+    SYNTH_KW276,
+    SYNTH_KW277,
+    SYNTH_KW278,
+    SYNTH_KW279,
+    SYNTH_KW280,
+    SYNTH_KW281,
+    SYNTH_KW282,
+    SYNTH_KW283,
+    SYNTH_KW284,
+    SYNTH_KW285,
+    SYNTH_KW286,
+    SYNTH_KW287,
+    SYNTH_KW288,
+    SYNTH_KW289,
+    SYNTH_KW290,
+    SYNTH_KW291,
+    SYNTH_KW292,
+    SYNTH_KW293,
+    SYNTH_KW294,
+    SYNTH_KW295,
+    SYNTH_KW296,
+    SYNTH_KW297,
+    SYNTH_KW298,
+    SYNTH_KW299,
+    SYNTH_KW300,
+    SYNTH_KW301,
+    SYNTH_KW302,
+    SYNTH_KW303,
+    SYNTH_KW304,
+    SYNTH_KW305,
+    SYNTH_KW306,
+    SYNTH_KW307,
+    SYNTH_KW308,
+    SYNTH_KW309,
+    SYNTH_KW310,
+    SYNTH_KW311,
+    SYNTH_KW312,
+    SYNTH_KW313,
+    SYNTH_KW314,
+    SYNTH_KW315,
+    SYNTH_KW316,
+    SYNTH_KW317,
+    SYNTH_KW318,
+    SYNTH_KW319,
+    SYNTH_KW320,
+    SYNTH_KW321,
+    SYNTH_KW322,
+    SYNTH_KW323,
+    SYNTH_KW324,
+    SYNTH_KW325,
+    SYNTH_KW326,
+    SYNTH_KW327,
+    SYNTH_KW328,
+    SYNTH_KW329,
+    SYNTH_KW330,
+    SYNTH_KW331,
+    SYNTH_KW332,
+    SYNTH_KW333,
+    SYNTH_KW334,
+    SYNTH_KW335,
+    SYNTH_KW336,
+    SYNTH_KW337,
+    SYNTH_KW338,
+    SYNTH_KW339,
+    SYNTH_KW340,
+    SYNTH_KW341,
+    SYNTH_KW342,
+    SYNTH_KW343,
+    SYNTH_KW344,
+    SYNTH_KW345,
+    SYNTH_KW346,
+    SYNTH_KW347,
+    SYNTH_KW348,
+    SYNTH_KW349,
+    SYNTH_KW350,
+    SYNTH_KW351,
+    SYNTH_KW352,
+    SYNTH_KW353,
+    SYNTH_KW354,
+    SYNTH_KW355,
+    SYNTH_KW356,
+    SYNTH_KW357,
+    SYNTH_KW358,
+    SYNTH_KW359,
+    SYNTH_KW360,
+    SYNTH_KW361,
+    SYNTH_KW362,
+    SYNTH_KW363,
+    SYNTH_KW364,
+    SYNTH_KW365,
+    SYNTH_KW366,
+    SYNTH_KW367,
+    SYNTH_KW368,
+    SYNTH_KW369,
+    SYNTH_KW370,
+    SYNTH_KW371,
+    SYNTH_KW372,
+    SYNTH_KW373,
+    SYNTH_KW374,
+    SYNTH_KW375,
+    SYNTH_KW376,
+    SYNTH_KW377,
+    SYNTH_KW378,
+    SYNTH_KW379,
+    SYNTH_KW380,
+    SYNTH_KW381,
+    SYNTH_KW382,
+    SYNTH_KW383,
+    SYNTH_KW384,
+    SYNTH_KW385,
+    SYNTH_KW386,
+    SYNTH_KW387,
+    SYNTH_KW388,
+    SYNTH_KW389,
+    SYNTH_KW390,
+    SYNTH_KW391,
+    SYNTH_KW392,
+    SYNTH_KW393,
+    SYNTH_KW394,
+    SYNTH_KW395,
+    SYNTH_KW396,
+    SYNTH_KW397,
+    SYNTH_KW398,
+    SYNTH_KW399,
+    SYNTH_KW400,
+    SYNTH_KW401,
+    SYNTH_KW402,
+    SYNTH_KW403,
+    SYNTH_KW404,
+    SYNTH_KW405,
+    SYNTH_KW406,
+    SYNTH_KW407,
+    SYNTH_KW408,
+    SYNTH_KW409,
+    SYNTH_KW410,
+    SYNTH_KW411,
+    SYNTH_KW412,
+    SYNTH_KW413,
+    SYNTH_KW414,
+    SYNTH_KW415,
+    SYNTH_KW416,
+    SYNTH_KW417,
+    SYNTH_KW418,
+    SYNTH_KW419,
+    SYNTH_KW420,
+    SYNTH_KW421,
+    SYNTH_KW422,
+    SYNTH_KW423,
+    SYNTH_KW424,
+    SYNTH_KW425,
+    SYNTH_KW426,
+    SYNTH_KW427,
+    SYNTH_KW428,
+    SYNTH_KW429,
+    SYNTH_KW430,
+    SYNTH_KW431,
+    SYNTH_KW432,
+    SYNTH_KW433,
+    SYNTH_KW434,
+    SYNTH_KW435,
+    SYNTH_KW436,
+    SYNTH_KW437,
+    SYNTH_KW438,
+    SYNTH_KW439,
+    SYNTH_KW440,
+    SYNTH_KW441,
+    SYNTH_KW442,
+    SYNTH_KW443,
+    SYNTH_KW444,
+    SYNTH_KW445,
+    SYNTH_KW446,
+    SYNTH_KW447,
+    SYNTH_KW448,
+    SYNTH_KW449,
+    SYNTH_KW450,
+    SYNTH_KW451,
+    SYNTH_KW452,
+    SYNTH_KW453,
+    SYNTH_KW454,
+    SYNTH_KW455,
+    SYNTH_KW456,
+    SYNTH_KW457,
+    SYNTH_KW458,
+    SYNTH_KW459,
+    SYNTH_KW460,
+    SYNTH_KW461,
+    SYNTH_KW462,
+    SYNTH_KW463,
+    SYNTH_KW464,
+    SYNTH_KW465,
+    SYNTH_KW466,
+    SYNTH_KW467,
+    SYNTH_KW468,
+    SYNTH_KW469,
+    SYNTH_OP1,
+    SYNTH_OP2,
+    SYNTH_OP3,
+    SYNTH_OP4,
+    SYNTH_OP5,
+    SYNTH_OP6,
+    SYNTH_OP7,
+    SYNTH_OP8,
+    SYNTH_OP9,
+    SYNTH_OP10,
+    SYNTH_OP11,
+    SYNTH_OP12,
+    SYNTH_OP13,
+    SYNTH_OP14,
+    SYNTH_OP15,
+    SYNTH_OP16,
+    SYNTH_OP17,
+    SYNTH_OP18,
+    SYNTH_OP19,
+    SYNTH_OP20,
+    SYNTH_OP21,
+    SYNTH_OP22,
+    SYNTH_OP23,
+    SYNTH_OP24,
+    SYNTH_IDENT,
+    SYNTH_NUMBER,
+    SYNTH_STRING_LIT,
+    SYNTH_WHITESPACE,
+    SYNTH_NEWLINE,
+    SYNTH_COMMENT,
+    SYNTH_TOKEN_COUNT
+} SYNTH_token_type_t;
+
+typedef struct {
+    SYNTH_token_type_t type;
+    const char *start;
+    size_t length;
+    int line;
+    int column;
+} SYNTH_token_t;
+
+typedef size_t (*SYNTH_refill_fn)(void *ctx, char *buf, size_t cap);
+
+typedef struct {
+    const char *source;
+    const char *current;
+    const char *end;
+    int line;
+    int column;
+    int context;        /* nonzero: @context tokens also match */
+    /* streaming only (lexer_init_stream) */
+    SYNTH_refill_fn refill;
+    void *refill_ctx;
+    char *buf;          /* owned; holds the unconsumed input */
+    size_t cap;
+    int eof;
+} SYNTH_lexer_t;
+
+void SYNTH_lexer_init(SYNTH_lexer_t *lex, const char *source);
+void SYNTH_lexer_init_n(SYNTH_lexer_t *lex, const char *source, size_t length);
+/* Tokens stay contiguous across refills; a token's start pointer is
+ * valid until the next _lexer_next() call. Returns -1 if out of memory. */
+int SYNTH_lexer_init_stream(SYNTH_lexer_t *lex, SYNTH_refill_fn refill, void *ctx, size_t bufsize);
+void SYNTH_lexer_free(SYNTH_lexer_t *lex);
+
+/* Whole-buffer token list, one array per field. Skipped tokens are
+ * dropped; the last entry is TOKEN_EOF. @context tokens never match. */
+typedef struct {
+    uint16_t *type;         /* SYNTH_token_type_t */
+    uint32_t *offset;       /* from source */
+    uint32_t *length;
+    size_t count;
+    size_t cap;
+    const char *source;
+    size_t source_len;
+    uint32_t *line_start;   /* built by the first _tokens_position() */
+    size_t line_count;
+} SYNTH_tokens_t;
+
+int SYNTH_tokenize_all(const char *source, size_t length, SYNTH_tokens_t *tokens);
+int SYNTH_tokens_position(SYNTH_tokens_t *tokens, size_t index, int *line, int *column);
+void SYNTH_tokens_free(SYNTH_tokens_t *tokens);
+SYNTH_token_t SYNTH_lexer_next(SYNTH_lexer_t *lex);
+const char *SYNTH_token_name(SYNTH_token_type_t type);
+
+#endif /* SYNTH_LEXER_H */
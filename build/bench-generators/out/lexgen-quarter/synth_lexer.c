@@ -0,0 +1,809 @@
+/* AUTO-GENERATED by lexgen 2.0.0 — DO NOT EDIT */
+
+#include "synth_lexer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *token_names[] = {
+    "EOF",
+    "ERROR",
+    "KW0",
+    "KW1",
+    "KW2",
+    "KW3",
+    "KW4",
+    "KW5",
+    "KW6",
+    "KW7",
+    "KW8",
+    "KW9",
+    "KW10",
+    "KW11",
+    "KW12",
+    "KW13",
+    "KW14",
+    "KW15",
+    "KW16",
+    "KW17",
+    "KW18",
+    "KW19",
+    "KW20",
+    "KW21",
+    "KW22",
+    "KW23",
+    "KW24",
+    "KW25",
+    "KW26",
+    "KW27",
+    "KW28",
+    "KW29",
+    "KW30",
+    "KW31",
+    "KW32",
+    "KW33",
+    "KW34",
+    "KW35",
+    "KW36",
+    "KW37",
+    "KW38",
+    "KW39",
+    "KW40",
+    "KW41",
+    "KW42",
+    "KW43",
+    "KW44",
+    "KW45",
+    "KW46",
+    "KW47",
+    "KW48",
+    "KW49",
+    "KW50",
+    "KW51",
+    "KW52",
+    "KW53",
+    "KW54",
+    "KW55",
+    "KW56",
+    "KW57",
+    "KW58",
+    "KW59",
+    "KW60",
+    "KW61",
+    "KW62",
+    "KW63",
+    "KW64",
+    "KW65",
+    "KW66",
+    "KW67",
+    "KW68",
+    "KW69",
+    "KW70",
+    "KW71",
+    "KW72",
+    "KW73",
+    "KW74",
+    "KW75",
+    "KW76",
+    "KW77",
+    "KW78",
+    "KW79",
+    "KW80",
+    "KW81",
+    "KW82",
+    "KW83",
+    "KW84",
+    "KW85",
+    "KW86",
+    "KW87",
+    "KW88",
+    "KW89",
+    "KW90",
+    "KW91",
+    "KW92",
+    "KW93",
+    "KW94",
+    "OP1",
+    "OP2",
+    "OP3",
+    "OP4",
+    "OP5",
+    "OP6",
+    "OP7",
+    "OP8",
+    "OP9",
+    "OP10",
+    "OP11",
+    "OP12",
+    "OP13",
+    "OP14",
+    "OP15",
+    "OP16",
+    "OP17",
+    "OP18",
+    "OP19",
+    "OP20",
+    "OP21",
+    "OP22",
+    "OP23",
+    "OP24",
+    "IDENT",
+    "NUMBER",
+    "STRING_LIT",
+    "WHITESPACE",
+    "NEWLINE",
+    "COMMENT",
+};
+
+static const unsigned char token_skip[SYNTH_TOKEN_COUNT] = {
+    [SYNTH_WHITESPACE] = 1,
+    [SYNTH_NEWLINE] = 1,
+    [SYNTH_COMMENT] = 1,
+};
+
+/* DFA: 34 states x 32 byte classes; state 0 is dead */
+#define DFA_CLASSES 32
+#define DFA_START 1
+#define DFA_START_CONTEXT 1
+
+static const unsigned char byte_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 3, 4, 5, 0, 6, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 19, 20, 21, 22,
+    0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 25, 26, 27, 23,
+    0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 29, 30, 31, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned char dfa_next[1088] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 26, 27, 28, 29, 30, 31,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 5, 5, 32, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 33, 5, 5, 5, 5, 5, 5,
+    6, 6, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+static const unsigned char dfa_accept[34] = {
+    0, 0, 124, 125, 105, 0, 126, 101, 106, 115, 116, 99, 97, 113, 98, 114,
+    100, 122, 111, 112, 103, 102, 104, 110, 121, 117, 118, 108, 119, 107, 120, 109,
+    123, 0,
+};
+
+static const unsigned char dfa_run[34] = {
+    0, 0, 1, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+/* 95 keywords: perfect hash on length, first, middle and last byte */
+#define KW_BITS 7
+
+static const unsigned char kw_host[SYNTH_TOKEN_COUNT] = {
+    [SYNTH_IDENT] = 1,
+};
+
+static const struct {
+    unsigned char len;
+    unsigned char host;
+    unsigned char type;
+    const char *text;
+} kw_table[1 << KW_BITS] = {
+    [4] = { 4, SYNTH_IDENT, SYNTH_KW91, "kw91" },
+    [5] = { 4, SYNTH_IDENT, SYNTH_KW93, "kw93" },
+    [9] = { 4, SYNTH_IDENT, SYNTH_KW70, "kw70" },
+    [10] = { 4, SYNTH_IDENT, SYNTH_KW72, "kw72" },
+    [11] = { 4, SYNTH_IDENT, SYNTH_KW74, "kw74" },
+    [12] = { 4, SYNTH_IDENT, SYNTH_KW76, "kw76" },
+    [13] = { 4, SYNTH_IDENT, SYNTH_KW78, "kw78" },
+    [15] = { 4, SYNTH_IDENT, SYNTH_KW51, "kw51" },
+    [16] = { 4, SYNTH_IDENT, SYNTH_KW53, "kw53" },
+    [17] = { 4, SYNTH_IDENT, SYNTH_KW55, "kw55" },
+    [18] = { 4, SYNTH_IDENT, SYNTH_KW57, "kw57" },
+    [19] = { 4, SYNTH_IDENT, SYNTH_KW59, "kw59" },
+    [20] = { 4, SYNTH_IDENT, SYNTH_KW30, "kw30" },
+    [21] = { 4, SYNTH_IDENT, SYNTH_KW32, "kw32" },
+    [22] = { 4, SYNTH_IDENT, SYNTH_KW34, "kw34" },
+    [23] = { 4, SYNTH_IDENT, SYNTH_KW36, "kw36" },
+    [24] = { 4, SYNTH_IDENT, SYNTH_KW38, "kw38" },
+    [26] = { 4, SYNTH_IDENT, SYNTH_KW11, "kw11" },
+    [27] = { 4, SYNTH_IDENT, SYNTH_KW13, "kw13" },
+    [28] = { 4, SYNTH_IDENT, SYNTH_KW15, "kw15" },
+    [29] = { 4, SYNTH_IDENT, SYNTH_KW17, "kw17" },
+    [30] = { 4, SYNTH_IDENT, SYNTH_KW19, "kw19" },
+    [33] = { 3, SYNTH_IDENT, SYNTH_KW0, "kw0" },
+    [34] = { 3, SYNTH_IDENT, SYNTH_KW2, "kw2" },
+    [35] = { 3, SYNTH_IDENT, SYNTH_KW4, "kw4" },
+    [36] = { 3, SYNTH_IDENT, SYNTH_KW6, "kw6" },
+    [37] = { 3, SYNTH_IDENT, SYNTH_KW8, "kw8" },
+    [39] = { 4, SYNTH_IDENT, SYNTH_KW80, "kw80" },
+    [40] = { 4, SYNTH_IDENT, SYNTH_KW82, "kw82" },
+    [41] = { 4, SYNTH_IDENT, SYNTH_KW84, "kw84" },
+    [42] = { 4, SYNTH_IDENT, SYNTH_KW86, "kw86" },
+    [43] = { 4, SYNTH_IDENT, SYNTH_KW88, "kw88" },
+    [45] = { 4, SYNTH_IDENT, SYNTH_KW61, "kw61" },
+    [46] = { 4, SYNTH_IDENT, SYNTH_KW63, "kw63" },
+    [47] = { 4, SYNTH_IDENT, SYNTH_KW65, "kw65" },
+    [48] = { 4, SYNTH_IDENT, SYNTH_KW67, "kw67" },
+    [49] = { 4, SYNTH_IDENT, SYNTH_KW69, "kw69" },
+    [50] = { 4, SYNTH_IDENT, SYNTH_KW40, "kw40" },
+    [51] = { 4, SYNTH_IDENT, SYNTH_KW42, "kw42" },
+    [52] = { 4, SYNTH_IDENT, SYNTH_KW44, "kw44" },
+    [53] = { 4, SYNTH_IDENT, SYNTH_KW46, "kw46" },
+    [54] = { 4, SYNTH_IDENT, SYNTH_KW48, "kw48" },
+    [56] = { 4, SYNTH_IDENT, SYNTH_KW21, "kw21" },
+    [57] = { 4, SYNTH_IDENT, SYNTH_KW23, "kw23" },
+    [58] = { 4, SYNTH_IDENT, SYNTH_KW25, "kw25" },
+    [59] = { 4, SYNTH_IDENT, SYNTH_KW27, "kw27" },
+    [60] = { 4, SYNTH_IDENT, SYNTH_KW29, "kw29" },
+    [68] = { 4, SYNTH_IDENT, SYNTH_KW90, "kw90" },
+    [69] = { 4, SYNTH_IDENT, SYNTH_KW92, "kw92" },
+    [70] = { 4, SYNTH_IDENT, SYNTH_KW94, "kw94" },
+    [74] = { 4, SYNTH_IDENT, SYNTH_KW71, "kw71" },
+    [75] = { 4, SYNTH_IDENT, SYNTH_KW73, "kw73" },
+    [76] = { 4, SYNTH_IDENT, SYNTH_KW75, "kw75" },
+    [77] = { 4, SYNTH_IDENT, SYNTH_KW77, "kw77" },
+    [78] = { 4, SYNTH_IDENT, SYNTH_KW79, "kw79" },
+    [79] = { 4, SYNTH_IDENT, SYNTH_KW50, "kw50" },
+    [80] = { 4, SYNTH_IDENT, SYNTH_KW52, "kw52" },
+    [81] = { 4, SYNTH_IDENT, SYNTH_KW54, "kw54" },
+    [82] = { 4, SYNTH_IDENT, SYNTH_KW56, "kw56" },
+    [83] = { 4, SYNTH_IDENT, SYNTH_KW58, "kw58" },
+    [85] = { 4, SYNTH_IDENT, SYNTH_KW31, "kw31" },
+    [86] = { 4, SYNTH_IDENT, SYNTH_KW33, "kw33" },
+    [87] = { 4, SYNTH_IDENT, SYNTH_KW35, "kw35" },
+    [88] = { 4, SYNTH_IDENT, SYNTH_KW37, "kw37" },
+    [89] = { 4, SYNTH_IDENT, SYNTH_KW39, "kw39" },
+    [90] = { 4, SYNTH_IDENT, SYNTH_KW10, "kw10" },
+    [91] = { 4, SYNTH_IDENT, SYNTH_KW12, "kw12" },
+    [92] = { 4, SYNTH_IDENT, SYNTH_KW14, "kw14" },
+    [93] = { 4, SYNTH_IDENT, SYNTH_KW16, "kw16" },
+    [94] = { 4, SYNTH_IDENT, SYNTH_KW18, "kw18" },
+    [98] = { 3, SYNTH_IDENT, SYNTH_KW1, "kw1" },
+    [99] = { 3, SYNTH_IDENT, SYNTH_KW3, "kw3" },
+    [100] = { 3, SYNTH_IDENT, SYNTH_KW5, "kw5" },
+    [101] = { 3, SYNTH_IDENT, SYNTH_KW7, "kw7" },
+    [102] = { 3, SYNTH_IDENT, SYNTH_KW9, "kw9" },
+    [103] = { 4, SYNTH_IDENT, SYNTH_KW81, "kw81" },
+    [104] = { 4, SYNTH_IDENT, SYNTH_KW83, "kw83" },
+    [105] = { 4, SYNTH_IDENT, SYNTH_KW85, "kw85" },
+    [106] = { 4, SYNTH_IDENT, SYNTH_KW87, "kw87" },
+    [107] = { 4, SYNTH_IDENT, SYNTH_KW89, "kw89" },
+    [108] = { 4, SYNTH_IDENT, SYNTH_KW60, "kw60" },
+    [109] = { 4, SYNTH_IDENT, SYNTH_KW62, "kw62" },
+    [110] = { 4, SYNTH_IDENT, SYNTH_KW64, "kw64" },
+    [111] = { 4, SYNTH_IDENT, SYNTH_KW66, "kw66" },
+    [112] = { 4, SYNTH_IDENT, SYNTH_KW68, "kw68" },
+    [114] = { 4, SYNTH_IDENT, SYNTH_KW41, "kw41" },
+    [115] = { 4, SYNTH_IDENT, SYNTH_KW43, "kw43" },
+    [116] = { 4, SYNTH_IDENT, SYNTH_KW45, "kw45" },
+    [117] = { 4, SYNTH_IDENT, SYNTH_KW47, "kw47" },
+    [118] = { 4, SYNTH_IDENT, SYNTH_KW49, "kw49" },
+    [119] = { 4, SYNTH_IDENT, SYNTH_KW20, "kw20" },
+    [120] = { 4, SYNTH_IDENT, SYNTH_KW22, "kw22" },
+    [121] = { 4, SYNTH_IDENT, SYNTH_KW24, "kw24" },
+    [122] = { 4, SYNTH_IDENT, SYNTH_KW26, "kw26" },
+    [123] = { 4, SYNTH_IDENT, SYNTH_KW28, "kw28" },
+};
+
+static int kw_lookup(const unsigned char *s, size_t len, int type) {
+    uint32_t h;
+    if (len < 3 || len > 4) return type;
+    h = (uint32_t)len | (uint32_t)s[0] << 8 | (uint32_t)s[len / 2] << 16 | (uint32_t)s[len - 1] << 24;
+    h = (h * 1885878913u) >> (32 - KW_BITS);
+    if (kw_table[h].host == type && kw_table[h].len == len &&
+        memcmp(kw_table[h].text, s, len) == 0)
+        return kw_table[h].type;
+    return type;
+}
+
+/* Run scanners: first byte at or after p that leaves a self-loop.
+ * Define LEX_NO_SIMD to keep only the scalar loops. */
+#if !defined(LEX_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define LEX_SIMD_AVX2 1
+#elif !defined(LEX_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define LEX_SIMD_SSE2 1
+#elif !defined(LEX_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LEX_SIMD_NEON 1
+#endif
+
+/* over 9 13 32 */
+static const unsigned char *lex_run1(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i t;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)9));
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)13));
+        m = _mm256_or_si256(m, t);
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)32));
+        m = _mm256_or_si256(m, t);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i t;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)9));
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)13));
+        m = _mm_or_si128(m, t);
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)32));
+        m = _mm_or_si128(m, t);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(9)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(13)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(32)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && (*p == 9 || *p == 13 || *p == 32)) p++;
+    return p;
+}
+
+/* stops at 34 92 */
+static const unsigned char *lex_run2(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i t;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)34));
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)92));
+        m = _mm256_or_si256(m, t);
+        unsigned stop = (unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i t;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)34));
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)92));
+        m = _mm_or_si128(m, t);
+        unsigned stop = (unsigned)_mm_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(34)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(92)));
+        uint64_t stop = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && !(*p == 34 || *p == 92)) p++;
+    return p;
+}
+
+/* stops at 10 */
+static const unsigned char *lex_run3(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)10));
+        unsigned stop = (unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)10));
+        unsigned stop = (unsigned)_mm_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(10)));
+        uint64_t stop = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && !(*p == 10)) p++;
+    return p;
+}
+
+/* over 48-57 */
+static const unsigned char *lex_run4(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i d;
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)48));
+        m = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)9)), d);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i d;
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)48));
+        m = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)9)), d);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(48)), vdupq_n_u8(9)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && ((unsigned char)(*p - 48) <= 9)) p++;
+    return p;
+}
+
+/* over 48-57 65-90 95 97-122 */
+static const unsigned char *lex_run5(const unsigned char *p, const unsigned char *end) {
+#if LEX_SIMD_AVX2
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)p), m;
+        __m256i d;
+        __m256i t;
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)48));
+        m = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)9)), d);
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)65));
+        t = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)25)), d);
+        m = _mm256_or_si256(m, t);
+        t = _mm256_cmpeq_epi8(v, _mm256_set1_epi8((char)95));
+        m = _mm256_or_si256(m, t);
+        d = _mm256_sub_epi8(v, _mm256_set1_epi8((char)97));
+        t = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8((char)25)), d);
+        m = _mm256_or_si256(m, t);
+        unsigned stop = ~(unsigned)_mm256_movemask_epi8(m);
+        if (stop) return p + __builtin_ctz(stop);
+        p += 32;
+    }
+#elif LEX_SIMD_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p), m;
+        __m128i d;
+        __m128i t;
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)48));
+        m = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)9)), d);
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)65));
+        t = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)25)), d);
+        m = _mm_or_si128(m, t);
+        t = _mm_cmpeq_epi8(v, _mm_set1_epi8((char)95));
+        m = _mm_or_si128(m, t);
+        d = _mm_sub_epi8(v, _mm_set1_epi8((char)97));
+        t = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8((char)25)), d);
+        m = _mm_or_si128(m, t);
+        unsigned stop = ~(unsigned)_mm_movemask_epi8(m) & 0xffffu;
+        if (stop) return p + __builtin_ctz(stop);
+        p += 16;
+    }
+#elif LEX_SIMD_NEON
+    while (end - p >= 16) {
+        uint8x16_t v = vld1q_u8(p), m = vdupq_n_u8(0);
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(48)), vdupq_n_u8(9)));
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(65)), vdupq_n_u8(25)));
+        m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(95)));
+        m = vorrq_u8(m, vcleq_u8(vsubq_u8(v, vdupq_n_u8(97)), vdupq_n_u8(25)));
+        uint64_t stop = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (stop) return p + (__builtin_ctzll(stop) >> 2);
+        p += 16;
+    }
+#endif
+    while (p < end && ((unsigned char)(*p - 48) <= 9 || (unsigned char)(*p - 65) <= 25 || *p == 95 || (unsigned char)(*p - 97) <= 25)) p++;
+    return p;
+}
+
+static const unsigned char *lex_run(int k, const unsigned char *p, const unsigned char *end) {
+    switch (k) {
+    case 1: return lex_run1(p, end);
+    case 2: return lex_run2(p, end);
+    case 3: return lex_run3(p, end);
+    case 4: return lex_run4(p, end);
+    case 5: return lex_run5(p, end);
+    default: return p;
+    }
+}
+
+void SYNTH_lexer_init_n(SYNTH_lexer_t *lex, const char *source, size_t length) {
+    memset(lex, 0, sizeof(*lex));
+    lex->source = source;
+    lex->current = source;
+    lex->end = source + length;
+    lex->line = 1;
+    lex->column = 1;
+}
+
+void SYNTH_lexer_init(SYNTH_lexer_t *lex, const char *source) {
+    SYNTH_lexer_init_n(lex, source, strlen(source));
+}
+
+int SYNTH_lexer_init_stream(SYNTH_lexer_t *lex, SYNTH_refill_fn refill, void *ctx, size_t bufsize) {
+    char *buf = malloc(bufsize ? bufsize : 1);
+    if (!buf) return -1;
+    SYNTH_lexer_init_n(lex, "", 0);
+    lex->source = lex->current = lex->end = buf;
+    lex->refill = refill;
+    lex->refill_ctx = ctx;
+    lex->buf = buf;
+    lex->cap = bufsize ? bufsize : 1;
+    return 0;
+}
+
+void SYNTH_lexer_free(SYNTH_lexer_t *lex) {
+    free(lex->buf);
+    lex->buf = NULL;
+}
+
+static int lex_refill(SYNTH_lexer_t *lex) {
+    size_t keep, n;
+    if (!lex->refill || lex->eof) return 0;
+    keep = (size_t)(lex->end - lex->current);
+    if (lex->current != lex->buf) {
+        memmove(lex->buf, lex->current, keep);
+    } else if (keep == lex->cap) {
+        char *grown = realloc(lex->buf, lex->cap * 2);
+        if (!grown) return 0;
+        lex->buf = grown;
+        lex->cap *= 2;
+    }
+    n = lex->refill(lex->refill_ctx, lex->buf + keep, lex->cap - keep);
+    lex->source = lex->buf;
+    lex->current = lex->buf;
+    lex->end = lex->buf + keep + n;
+    if (n == 0) lex->eof = 1;
+    return n > 0;
+}
+
+const char *SYNTH_token_name(SYNTH_token_type_t type) {
+    if (type >= 0 && type < SYNTH_TOKEN_COUNT) {
+        return token_names[type];
+    }
+    return "UNKNOWN";
+}
+
+static void lex_advance(SYNTH_lexer_t *lex, size_t len) {
+    const char *p = lex->current, *end = p + len, *nl;
+    while ((nl = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+        lex->line++;
+        lex->column = 1;
+        p = nl + 1;
+    }
+    lex->column += (int)(end - p);
+    lex->current = end;
+}
+
+static int lex_match(const unsigned char *p, const unsigned char *end, int context,
+                     size_t *length, int *at_end) {
+    const unsigned char *start = p, *last = p + 1;
+    unsigned s = context ? DFA_START_CONTEXT : DFA_START;
+    int type = SYNTH_TOKEN_ERROR;
+
+    *at_end = 0;
+    /* Run to the dead state, remembering the last accept */
+    while (p < end && (s = dfa_next[s * DFA_CLASSES + byte_class[*p]]) != 0) {
+        p++;
+        if (dfa_run[s]) p = lex_run(dfa_run[s], p, end);
+        if (dfa_accept[s]) {
+            type = dfa_accept[s];
+            last = p;
+        }
+    }
+    *at_end = p >= end;
+    *length = (size_t)(last - start);
+    if (kw_host[type]) type = kw_lookup(start, *length, type);
+    return type;
+}
+
+SYNTH_token_t SYNTH_lexer_next(SYNTH_lexer_t *lex) {
+    SYNTH_token_t tok;
+    for (;;) {
+        const unsigned char *p = (const unsigned char *)lex->current;
+        const unsigned char *end = (const unsigned char *)lex->end;
+        int type, at_end;
+
+        tok.start = lex->current;
+        tok.line = lex->line;
+        tok.column = lex->column;
+        if (p >= end) {
+            if (lex_refill(lex)) continue;
+            tok.start = lex->current;
+            tok.type = SYNTH_TOKEN_EOF;
+            tok.length = 0;
+            return tok;
+        }
+        type = lex_match(p, end, lex->context, &tok.length, &at_end);
+        /* input ran out mid-token: refill and rescan it; at EOF the
+         * refill may still have moved the token to the buffer start */
+        if (at_end) {
+            if (lex_refill(lex)) continue;
+            tok.start = lex->current;
+        }
+        tok.type = (SYNTH_token_type_t)type;
+        lex_advance(lex, tok.length);
+        if (!token_skip[type]) return tok;
+    }
+}
+
+static int tokens_grow(SYNTH_tokens_t *t) {
+    size_t cap = t->cap ? t->cap * 2 : 64;
+    void *type = realloc(t->type, cap * sizeof(*t->type));
+    if (!type) return -1;
+    t->type = type;
+    void *offset = realloc(t->offset, cap * sizeof(*t->offset));
+    if (!offset) return -1;
+    t->offset = offset;
+    void *length = realloc(t->length, cap * sizeof(*t->length));
+    if (!length) return -1;
+    t->length = length;
+    t->cap = cap;
+    return 0;
+}
+
+int SYNTH_tokenize_all(const char *source, size_t length, SYNTH_tokens_t *t) {
+    const unsigned char *base = (const unsigned char *)source;
+    size_t pos = 0;
+
+    memset(t, 0, sizeof(*t));
+    t->source = source;
+    t->source_len = length;
+    if (length > UINT32_MAX) return -1;
+    /* one token per ~4 bytes covers typical specs without regrowing */
+    t->cap = length / 4 + 16;
+    t->type = malloc(t->cap * sizeof(*t->type));
+    t->offset = malloc(t->cap * sizeof(*t->offset));
+    t->length = malloc(t->cap * sizeof(*t->length));
+    if (!t->type || !t->offset || !t->length) goto fail;
+
+    while (pos < length) {
+        size_t len;
+        int at_end;
+        int type = lex_match(base + pos, base + length, 0, &len, &at_end);
+        if (!token_skip[type]) {
+            if (t->count == t->cap && tokens_grow(t) != 0) goto fail;
+            t->type[t->count] = (uint8_t)type;
+            t->offset[t->count] = (uint32_t)pos;
+            t->length[t->count] = (uint32_t)len;
+            t->count++;
+        }
+        pos += len;
+    }
+    if (t->count == t->cap && tokens_grow(t) != 0) goto fail;
+    t->type[t->count] = SYNTH_TOKEN_EOF;
+    t->offset[t->count] = (uint32_t)length;
+    t->length[t->count] = 0;
+    t->count++;
+    return 0;
+
+fail:
+    SYNTH_tokens_free(t);
+    return -1;
+}
+
+void SYNTH_tokens_free(SYNTH_tokens_t *t) {
+    free(t->type);
+    free(t->offset);
+    free(t->length);
+    free(t->line_start);
+    memset(t, 0, sizeof(*t));
+}
+
+int SYNTH_tokens_position(SYNTH_tokens_t *t, size_t index, int *line, int *column) {
+    size_t lo = 0, hi;
+    uint32_t off;
+
+    if (index >= t->count) return -1;
+    if (!t->line_start) {
+        const char *p = t->source, *end = t->source + t->source_len, *nl;
+        size_t n = 1;
+        for (nl = p; (nl = memchr(nl, '\n', (size_t)(end - nl))) != NULL; nl++) n++;
+        t->line_start = malloc(n * sizeof(*t->line_start));
+        if (!t->line_start) return -1;
+        t->line_start[0] = 0;
+        t->line_count = 1;
+        for (nl = p; (nl = memchr(nl, '\n', (size_t)(end - nl))) != NULL; nl++)
+            t->line_start[t->line_count++] = (uint32_t)(nl + 1 - p);
+    }
+    /* last line starting at or before the token */
+    off = t->offset[index];
+    hi = t->line_count;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (t->line_start[mid] <= off) lo = mid;
+        else hi = mid;
+    }
+    *line = (int)lo + 1;
+    *column = (int)(off - t->line_start[lo]) + 1;
+    return 0;
+}
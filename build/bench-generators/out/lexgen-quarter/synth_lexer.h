@@ -0,0 +1,191 @@
+/* AUTO-GENERATED by lexgen 2.0.0 — DO NOT EDIT */
+#ifndef SYNTH_LEXER_H
+#define SYNTH_LEXER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    SYNTH_TOKEN_EOF = 0,
+    SYNTH_TOKEN_ERROR,
+    SYNTH_KW0,
+    SYNTH_KW1,
+    SYNTH_KW2,
+    SYNTH_KW3,
+    SYNTH_KW4,
+    SYNTH_KW5,
+    SYNTH_KW6,
+    SYNTH_KW7,
+    SYNTH_KW8,
+    SYNTH_KW9,
+    SYNTH_KW10,
+    SYNTH_KW11,
+    SYNTH_KW12,
+    SYNTH_KW13,
+    SYNTH_KW14,
+    SYNTH_KW15,
+    SYNTH_KW16,
+    SYNTH_KW17,
+    SYNTH_KW18,
+    SYNTH_KW19,
+    SYNTH_KW20,
+    SYNTH_KW21,
+    SYNTH_KW22,
+    SYNTH_KW23,
+    SYNTH_KW24,
+    SYNTH_KW25,
+    SYNTH_KW26,
+    SYNTH_KW27,
+    SYNTH_KW28,
+    SYNTH_KW29,
+    SYNTH_KW30,
+    SYNTH_KW31,
+    SYNTH_KW32,
+    SYNTH_KW33,
+    SYNTH_KW34,
+    SYNTH_KW35,
+    SYNTH_KW36,
+    SYNTH_KW37,
+    SYNTH_KW38,
+    SYNTH_KW39,
+    SYNTH_KW40,
+    SYNTH_KW41,
+    SYNTH_KW42,
+    SYNTH_KW43,
+    SYNTH_KW44,
+    SYNTH_KW45,
+    SYNTH_KW46,
+    SYNTH_KW47,
+    SYNTH_KW48,
+    SYNTH_KW49,
+    SYNTH_KW50,
+    SYNTH_KW51,
+    SYNTH_KW52,
+    SYNTH_KW53,
+    SYNTH_KW54,
+    SYNTH_KW55,
+    SYNTH_KW56,
+    SYNTH_KW57,
+    SYNTH_KW58,
+    SYNTH_KW59,
+    SYNTH_KW60,
+    SYNTH_KW61,
+    SYNTH_KW62,
+    SYNTH_KW63,
+    SYNTH_KW64,
+    SYNTH_KW65,
+    SYNTH_KW66,
+    SYNTH_KW67,
+    SYNTH_KW68,
+    SYNTH_KW69,
+    SYNTH_KW70,
+    SYNTH_KW71,
+    SYNTH_KW72,
+    SYNTH_KW73,
+    SYNTH_KW74,
+    SYNTH_KW75,
+    SYNTH_KW76,
+    SYNTH_KW77,
+    SYNTH_KW78,
+    SYNTH_KW79,
+    SYNTH_KW80,
+    SYNTH_KW81,
+    SYNTH_KW82,
+    SYNTH_KW83,
+    SYNTH_KW84,
+    SYNTH_KW85,
+    SYNTH_KW86,
+    SYNTH_KW87,
+    SYNTH_KW88,
+    SYNTH_KW89,
+    SYNTH_KW90,
+    SYNTH_KW91,
+    SYNTH_KW92,
+    SYNTH_KW93,
+    SYNTH_KW94,
+    SYNTH_OP1,
+    SYNTH_OP2,
+    SYNTH_OP3,
+    SYNTH_OP4,
+    SYNTH_OP5,
+    SYNTH_OP6,
+    SYNTH_OP7,
+    SYNTH_OP8,
+    SYNTH_OP9,
+    SYNTH_OP10,
+    SYNTH_OP11,
+    SYNTH_OP12,
+    SYNTH_OP13,
+    SYNTH_OP14,
+    SYNTH_OP15,
+    SYNTH_OP16,
+    SYNTH_OP17,
+    SYNTH_OP18,
+    SYNTH_OP19,
+    SYNTH_OP20,
+    SYNTH_OP21,
+    SYNTH_OP22,
+    SYNTH_OP23,
+    SYNTH_OP24,
+    SYNTH_IDENT,
+    SYNTH_NUMBER,
+    SYNTH_STRING_LIT,
+    SYNTH_WHITESPACE,
+    SYNTH_NEWLINE,
+    SYNTH_COMMENT,
+    SYNTH_TOKEN_COUNT
+} SYNTH_token_type_t;
+
+typedef struct {
+    SYNTH_token_type_t type;
+    const char *start;
+    size_t length;
+    int line;
+    int column;
+} SYNTH_token_t;
+
+typedef size_t (*SYNTH_refill_fn)(void *ctx, char *buf, size_t cap);
+
+typedef struct {
+    const char *source;
+    const char *current;
+    const char *end;
+    int line;
+    int column;
+    int context;        /* nonzero: @context tokens also match */
+    /* streaming only (lexer_init_stream) */
+    SYNTH_refill_fn refill;
+    void *refill_ctx;
+    char *buf;          /* owned; holds the unconsumed input */
+    size_t cap;
+    int eof;
+} SYNTH_lexer_t;
+
+void SYNTH_lexer_init(SYNTH_lexer_t *lex, const char *source);
+void SYNTH_lexer_init_n(SYNTH_lexer_t *lex, const char *source, size_t length);
+/* Tokens stay contiguous across refills; a token's start pointer is
+ * valid until the next _lexer_next() call. Returns -1 if out of memory. */
+int SYNTH_lexer_init_stream(SYNTH_lexer_t *lex, SYNTH_refill_fn refill, void *ctx, size_t bufsize);
+void SYNTH_lexer_free(SYNTH_lexer_t *lex);
+
+/* Whole-buffer token list, one array per field. Skipped tokens are
+ * dropped; the last entry is TOKEN_EOF. @context tokens never match. */
+typedef struct {
+    uint8_t *type;          /* SYNTH_token_type_t */
+    uint32_t *offset;       /* from source */
+    uint32_t *length;
+    size_t count;
+    size_t cap;
+    const char *source;
+    size_t source_len;
+    uint32_t *line_start;   /* built by the first _tokens_position() */
+    size_t line_count;
+} SYNTH_tokens_t;
+
+int SYNTH_tokenize_all(const char *source, size_t length, SYNTH_tokens_t *tokens);
+int SYNTH_tokens_position(SYNTH_tokens_t *tokens, size_t index, int *line, int *column);
+void SYNTH_tokens_free(SYNTH_tokens_t *tokens);
+SYNTH_token_t SYNTH_lexer_next(SYNTH_lexer_t *lex);
+const char *SYNTH_token_name(SYNTH_token_type_t type);
+
+#endif /* SYNTH_LEXER_H */